@@ -82,6 +82,32 @@ zelEnableTracingLayer();
 ZE_DLLEXPORT ze_result_t ZE_APICALL
 zelDisableTracingLayer();
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Validation checks that can be selected at runtime.
+typedef uint32_t zel_validation_check_flags_t;
+typedef enum _zel_validation_check_flag_t {
+   ZEL_VALIDATION_CHECK_FLAG_PARAMETER = ZE_BIT(0),       ///< same as ZE_ENABLE_PARAMETER_VALIDATION
+   ZEL_VALIDATION_CHECK_FLAG_HANDLE_LIFETIME = ZE_BIT(1), ///< same as ZE_ENABLE_HANDLE_LIFETIME
+   ZEL_VALIDATION_CHECK_FLAG_MEMORY_TRACKER = ZE_BIT(2),  ///< same as ZE_ENABLE_MEMORY_TRACKER
+   ZEL_VALIDATION_CHECK_FLAG_THREADING = ZE_BIT(3),       ///< same as ZE_ENABLE_THREADING_VALIDATION
+   ZEL_VALIDATION_CHECK_FLAG_FORCE_UINT32 = 0x7fffffff
+} zel_validation_check_flag_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for Enabling the Validation Layer During Runtime.
+///
+/// Selects the checks to run; may be called again to change them.
+/// The layer must be loaded with ZE_ENABLE_VALIDATION_LAYER or
+/// ZEL_ENABLE_RUNTIME_VALIDATION_LAYER set before zeInit.
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelEnableValidationLayer(zel_validation_check_flags_t checks);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for Disabling the Validation Layer During Runtime.
+///
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelDisableValidationLayer();
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
@@ -232,6 +232,23 @@ def _mako_tracing_layer_cpp(path, namespace, tags, version, specs, meta):
     filename = "%s.cpp"%(name)
     fout = os.path.join(dstpath, filename)
 
+    print("Generating %s..."%fout)
+    loc += util.makoWrite(
+        fin, fout,
+        name=name,
+        ver=version,
+        namespace=namespace,
+        tags=tags,
+        specs=specs,
+        meta=meta)
+
+    template = "trc_api_ids.h.mako"
+    fin = os.path.join(tracing_templates_dir, template)
+
+    name = "%s_tracing_api_ids"%(namespace)
+    filename = "%s.h"%(name)
+    fout = os.path.join(dstpath, filename)
+
     print("Generating %s..."%fout)
     loc += util.makoWrite(
         fin, fout,
@@ -1931,6 +1931,121 @@ def get_loader_epilogue(namespace, tags, obj, meta):
 
     return epilogue
 
+"""
+Public:
+    returns a list of dict of the handles checked by the threading validation:
+    the handle the application must not use from simultaneous threads, and the
+    kernel of a launch, which may be shared but not modified during the call
+"""
+def get_threading_validation_params(namespace, tags, obj):
+    details = " ".join(str(d) for d in obj.get('details', []))
+    m = re.search(r"simultaneous threads with the same (command list|kernel) handle", details, re.IGNORECASE)
+    if not m:
+        return []
+
+    name = "hCommandList" if m.group(1).lower() == "command list" else "hKernel"
+    params = [item['name'] for item in obj['params']]
+    if name not in params:
+        return []
+
+    checks = [{'name': name, 'mode': 'exclusive'}]
+    if name == "hCommandList" and "hKernel" in params:
+        checks.append({'name': "hKernel", 'mode': 'shared'})
+    return checks
+
+"""
+Public:
+    returns which memory tracker hooks the validation layer calls for a function:
+    'prologue' checks the call, 'epilogue' records allocations after it succeeds
+"""
+def get_memory_tracker_hooks(namespace, tags, obj):
+    prologues = ["zeMemFree", "zeMemFreeExt", "zeMemCloseIpcHandle",
+                 "zeCommandListAppendMemoryCopy", "zeCommandListAppendMemoryFill",
+                 "zeCommandListAppendMemoryCopyFromContext", "zeCommandListAppendMemoryPrefetch",
+                 "zeCommandListAppendMemAdvise"]
+    epilogues = ["zeMemAllocShared", "zeMemAllocDevice", "zeMemAllocHost", "zeMemFree", "zeMemFreeExt",
+                 "zeMemOpenIpcHandle", "zeMemCloseIpcHandle"]
+    name = make_func_name(namespace, tags, obj)
+    return {'prologue': name in prologues, 'epilogue': name in epilogues}
+
+"""
+Public:
+    returns how the performance advisor sees a successful call: 'api' for the
+    calls it has a hook for, 'append' for the other command list appends
+    whose arguments only feed the fingerprint of the recording, 'kernel' for
+    the calls that set the state of a kernel, or None
+"""
+def get_performance_advisor_hook(namespace, tags, obj):
+    hooks = ["zeCommandQueueExecuteCommandLists", "zeCommandQueueSynchronize", "zeCommandListHostSynchronize",
+             "zeEventHostSynchronize", "zeFenceHostSynchronize", "zeCommandListCreate",
+             "zeCommandListCreateImmediate", "zeCommandListDestroy", "zeCommandListClose", "zeCommandListReset",
+             "zeCommandListAppendMemoryCopy", "zeEventCreate", "zeEventDestroy",
+             "zeMemAllocShared", "zeMemAllocDevice", "zeMemAllocHost", "zeMemFree",
+             "zeCommandListAppendMemoryFill", "zeCommandListAppendLaunchKernelIndirect",
+             "zeCommandListAppendLaunchMultipleKernelsIndirect", "zeKernelDestroy"]
+    name = make_func_name(namespace, tags, obj)
+    if name in hooks:
+        return 'api'
+    if re.match(r"zeCommandListAppend\w+$", name):
+        return 'append'
+    if re.match(r"zeKernelSet\w+$|zeKernelSchedulingHintExp$", name):
+        return 'kernel'
+    return None
+
+"""
+Public:
+    returns how the loader property cache answers a query whose result the
+    spec defines as constant: 'get' for a single structure, 'getArray' for
+    a counted array of structures, or None for calls it does not cache
+"""
+def get_loader_property_cache(namespace, tags, obj):
+    structs = ["zeDriverGetProperties", "zeDeviceGetProperties", "zeDeviceGetComputeProperties",
+               "zeDeviceGetModuleProperties", "zeDeviceGetMemoryAccessProperties", "zeDeviceGetImageProperties",
+               "zeDeviceGetExternalMemoryProperties", "zesDeviceGetProperties", "zesEngineGetProperties",
+               "zesDevicePciGetProperties", "zesFrequencyGetProperties", "zesMemoryGetProperties",
+               "zesPowerGetProperties", "zesTemperatureGetProperties"]
+    arrays = ["zeDeviceGetMemoryProperties", "zeDeviceGetCommandQueueGroupProperties", "zeDeviceGetCacheProperties"]
+    name = make_func_name(namespace, tags, obj)
+    if name in structs:
+        return 'get'
+    if name in arrays:
+        return 'getArray'
+    return None
+
+"""
+Public:
+    returns a dict of the handle parameters the validation layer replaces with
+    generational ids: 'inputs' are translated before the call (with 'range' for
+    arrays), 'outputs' are wrapped after it and 'releases' free their id
+"""
+def get_generational_handle_params(namespace, tags, obj, meta):
+    types = ["ze_command_queue_handle_t", "ze_command_list_handle_t", "ze_fence_handle_t",
+             "ze_event_pool_handle_t", "ze_event_handle_t", "ze_module_handle_t", "ze_kernel_handle_t",
+             "zet_command_list_handle_t", "zet_module_handle_t", "zet_kernel_handle_t"]
+    params = {'inputs': [], 'outputs': [], 'releases': []}
+
+    for item in obj['params']:
+        if param_traits.is_mbz(item):
+            continue
+        tname = _remove_const_ptr(subt(namespace, tags, item['type']))
+        if tname not in types:
+            continue
+        name = subt(namespace, tags, item['name'])
+        if param_traits.is_output(item) or param_traits.is_inoutput(item):
+            params['outputs'].append({'name': name, 'type': tname})
+        elif type_traits.is_pointer(item['type']):
+            params['inputs'].append({
+                'name': name,
+                'type': tname,
+                'range': (param_traits.range_start(item), param_traits.range_end(item))
+            })
+        else:
+            params['inputs'].append({'name': name, 'type': tname})
+            if param_traits.is_release(item):
+                params['releases'].append(name)
+
+    return params
+
 """
 Public:
     returns true if proc table is added after 1.0
@@ -17,6 +17,7 @@ from templates import helper as th
  *
  */
 #include "${x}_loader_internal.h"
+#include "ze_probes.h"
 
 namespace loader
 {
@@ -55,6 +56,7 @@ namespace loader
     %>
 
         %if re.match(r"Init", obj['name']):
+        ZE_PROBE_ENTRY(loader, "${th.make_func_name(n, tags, obj)}");
         bool atLeastOneDriverValid = false;
         for( auto& drv : context->drivers )
         {
@@ -67,8 +69,10 @@ namespace loader
 
         if(!atLeastOneDriverValid)
             result=ZE_RESULT_ERROR_UNINITIALIZED;
+        ZE_PROBE_EXIT(loader, "${th.make_func_name(n, tags, obj)}", result);
 
         %elif re.match(r"\w+DriverGet$", th.make_func_name(n, tags, obj)):
+        ZE_PROBE_ENTRY(loader, "${th.make_func_name(n, tags, obj)}");
         uint32_t total_driver_handle_count = 0;
 
         for( auto& drv : context->drivers )
@@ -111,6 +115,7 @@ namespace loader
 
         if( ${X}_RESULT_SUCCESS == result )
             *${obj['params'][0]['name']} = total_driver_handle_count;
+        ZE_PROBE_EXIT(loader, "${th.make_func_name(n, tags, obj)}", result);
 
         %else:
         %for i, item in enumerate(th.get_loader_prologue(n, tags, obj, meta)):
@@ -168,17 +173,25 @@ namespace loader
         }
         %endif
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "${th.make_func_name(n, tags, obj)}");
         %if add_local:
         result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name", "local"]))} );
+        ZE_PROBE_EXIT(loader, "${th.make_func_name(n, tags, obj)}", result);
         %for array_name in arrays_to_delete:
         delete []${array_name};
         %endfor
         %else:
         %if re.match(r"\w+KernelSetArgumentValue$", th.make_func_name(n, tags, obj)):
         result = pfnSetArgumentValue( hKernel, argIndex, argSize, const_cast<const void *>(internalArgValue) );
+        %elif th.get_loader_property_cache(n, tags, obj):
+        if( context->propertyCacheEnabled )
+            result = property_cache.${th.get_loader_property_cache(n, tags, obj)}( ${th.make_pfn_name(n, tags, obj)}, ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+        else
+            result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
         %else:
         result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
         %endif
+        ZE_PROBE_EXIT(loader, "${th.make_func_name(n, tags, obj)}", result);
         %endif
 <%
         del arrays_to_delete
@@ -343,18 +356,42 @@ ${tbl['export']['name']}(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    %if namespace in ("ze", "zet"):
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ${X}_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<${tbl['pfn']}>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "${tbl['export']['name']}") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    %endif
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ${X}_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<${tbl['pfn']}>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "${tbl['export']['name']}") );
         if(!getTable)
             return ${X}_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ${tbl['type']} dditable;
+            memcpy(&dditable, pDdiTable, sizeof(${tbl['type']}));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.${n}.${tbl['name']} = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
     %if namespace == "ze":
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ${X}_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<${tbl['pfn']}>(
@@ -362,14 +399,29 @@ ${tbl['export']['name']}(
         if(!getTable)
             return ${X}_RESULT_ERROR_UNINITIALIZED;
         ${tbl['type']} dditable;
-        memcpy(&dditable, pDdiTable, sizeof(${tbl['type']}));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.${n}.${tbl['name']};
+        else
+            memcpy(&dditable, pDdiTable, sizeof(${tbl['type']}));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.${n}.${tbl['name']} = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(${tbl['type']}));
         }
     }
 
+    %else:
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ${X}_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.${n}.${tbl['name']} = loader::context->validation_dditable.${n}.${tbl['name']};
+        else
+            loader::context->tracing_dditable.${n}.${tbl['name']} = *pDdiTable;
+    }
+
     %endif
     return result;
 }
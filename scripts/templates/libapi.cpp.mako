@@ -27,6 +27,7 @@ def define_dbg(obj, tags):
  *
  */
 #include "${x}_lib.h"
+#include "ze_probes.h"
 
 extern "C" {
 
@@ -98,7 +99,9 @@ ${th.make_func_name(n, tags, obj)}(
                 return ${X}_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
 
+        ZE_PROBE_ENTRY(lib, "${th.make_func_name(n, tags, obj)}");
         result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+        ZE_PROBE_EXIT(lib, "${th.make_func_name(n, tags, obj)}", result);
         return result;
     });
 
@@ -128,7 +131,10 @@ ${th.make_func_name(n, tags, obj)}(
             return ${X}_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+    ZE_PROBE_ENTRY(lib, "${th.make_func_name(n, tags, obj)}");
+    auto result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+    ZE_PROBE_EXIT(lib, "${th.make_func_name(n, tags, obj)}", result);
+    return result;
 }
 %endif
 %if 'condition' in obj:
@@ -0,0 +1,46 @@
+<%
+import re
+from templates import helper as th
+%><%
+    n=namespace
+    N=n.upper()
+
+    x=tags['$x']
+    X=x.upper()
+%>/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file ${name}.h
+ *
+ */
+#pragma once
+#include <cstdint>
+
+namespace tracing_layer
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Identifiers of the traced ${n} functions
+    enum class api_id_t : uint32_t
+    {
+        %for obj in th.extract_objs(specs, r"function"):
+        ${th.make_func_name(n, tags, obj)},
+        %endfor
+        count
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Returns the name of the function identified by id
+    inline const char *getApiName(api_id_t id)
+    {
+        static const char *names[] = {
+            %for obj in th.extract_objs(specs, r"function"):
+            "${th.make_func_name(n, tags, obj)}",
+            %endfor
+        };
+        auto index = static_cast<uint32_t>(id);
+        return (index < static_cast<uint32_t>(api_id_t::count)) ? names[index] : "unknown";
+    }
+} // namespace tracing_layer
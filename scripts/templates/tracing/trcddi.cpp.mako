@@ -40,6 +40,8 @@ namespace tracing_layer
         if( nullptr == ${th.make_pfn_name(n, tags, obj)})
             return ${X}_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::${th.make_func_name(n, tags, obj)}, context.${n}DdiTable.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)}, ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))});
+
         ZE_HANDLE_TRACER_RECURSION(context.${n}DdiTable.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)}, ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))});
 
         // capture parameters
@@ -53,6 +55,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.${n}DdiTable.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)},
+                                                  api_id_t::${th.make_func_name(n, tags, obj)},
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
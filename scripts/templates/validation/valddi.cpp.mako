@@ -40,7 +40,7 @@ namespace validation_layer
         if( nullptr == ${th.make_pfn_name(n, tags, obj)} )
             return ${X}_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "${th.make_func_name(n, tags, obj)}", ${th.make_param_lines(n, tags, obj, format=['name'])[0] if th.type_traits.is_handle(obj['params'][0]['type']) else "nullptr"} ) )
         {
             auto result = context.paramValidation->${n}ParamValidation.${th.make_func_name(n, tags, obj)}( \
 % for line in th.make_param_lines(n, tags, obj, format=['name','delim']):
@@ -51,13 +51,42 @@ ${line} \
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        <%
+        threading_params = th.get_threading_validation_params(n, tags, obj)
+        %>
+        %if threading_params:
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            %for item in threading_params:
+            threadingGuard.${item['mode']}( ${item['name']}, "${th.make_func_name(n, tags, obj)}" );
+            %endfor
         }
 
+        %endif
         <% 
         func_name = th.make_func_name(n, tags, obj)
         generate_post_call = re.match(r"\w+Create\w*$|\w+Get$|\w+Get\w*Exp$|\w+GetIpcHandle$|\w+GetSubDevices$", func_name)
+        memory_tracker = th.get_memory_tracker_hooks(n, tags, obj)
+        advisor_hook = th.get_performance_advisor_hook(n, tags, obj)
+        async_copies = [item for item in th.get_loader_prologue(n, tags, obj, meta) if 'range' in item]
+        async_args = []
+        for param in th.make_param_lines(n, tags, obj, format=["name"]):
+            if param in [item['name'] for item in async_copies]:
+                async_args.append(param + "Copy.data()")
+            else:
+                async_args.append(param)
+        async_release = re.match(r"\w+Destroy$", func_name)
+        async_parent = th.make_param_lines(n, tags, obj, format=['name','delim'])[0]
+        generational = th.get_generational_handle_params(n, tags, obj, meta)
+        translated = dict((item['name'], item) for item in generational['inputs'])
+        call_args = []
+        for param in th.make_param_lines(n, tags, obj, format=["name"]):
+            if param not in translated:
+                call_args.append(param)
+            elif 'range' in translated[param]:
+                call_args.append(param + "Local.data()")
+            else:
+                call_args.append(param + "Local")
         %>
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->${n}HandleLifetime.${th.make_func_name(n, tags, obj)}( \
@@ -68,7 +97,121 @@ ${line} \
             if(result!=${X}_RESULT_SUCCESS) return result;    
         }
 
-        auto result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+        %if memory_tracker['prologue']:
+        if( context.enableMemoryTracker ){
+            auto result = context.memoryTracker->${func_name}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+            if(result!=${X}_RESULT_SUCCESS) return result;
+        }
+
+        %endif
+        %if generational['inputs']:
+        %for item in generational['inputs']:
+        %if 'range' in item:
+        GenerationalHandleArray<${item['type']}> ${item['name']}Local( ${item['name']} );
+        %else:
+        auto ${item['name']}Local = ${item['name']};
+        %endif
+        %endfor
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            %for item in generational['inputs']:
+            %if 'range' in item:
+            if( !${item['name']}Local.translate( generations, ${item['range'][1]} ) )
+            %else:
+            if( !generations.translate( ${item['name']}Local ) )
+            %endif
+                return ${X}_RESULT_ERROR_INVALID_NULL_HANDLE;
+            %endfor
+        }
+
+        %endif
+        %if async_release:
+        // Released handles are ordered before the driver can hand them out again.
+        bool asyncEnabled = context.enableAsyncValidation;
+        auto asyncSequence = asyncEnabled ? context.asyncValidation->reserve() : 0;
+        %endif
+        auto result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(call_args)} );
+        %if generational['outputs'] or generational['releases']:
+
+        if( result == ${X}_RESULT_SUCCESS && context.enableGenerationalHandles ){
+            %for item in generational['outputs']:
+            if( ${item['name']} ) *${item['name']} = context.generationalHandles->wrap( *${item['name']} );
+            %endfor
+            %for param in generational['releases']:
+            context.generationalHandles->release( ${param} );
+            %endfor
+        }
+        %endif
+        %if threading_params and async_release:
+
+        if( result == ${X}_RESULT_SUCCESS ){
+            threadingGuard.retire();
+        }
+        %endif
+        %if memory_tracker['epilogue']:
+
+        if( result == ${X}_RESULT_SUCCESS && context.enableMemoryTracker ){
+            context.memoryTracker->${func_name}Epilogue( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+        }
+        %endif
+        %if advisor_hook:
+
+        if( result == ${X}_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            %if advisor_hook == 'append':
+            context.performanceAdvisor->commandListAppend( "${func_name}", ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+            %elif advisor_hook == 'kernel':
+            context.performanceAdvisor->kernelChanged( hKernel );
+            %else:
+            context.performanceAdvisor->${func_name}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+            %endif
+        }
+        %endif
+
+        if( ${"asyncEnabled" if async_release else "context.enableAsyncValidation"} ){
+            %for item in async_copies:
+            auto ${item['name']}Copy = AsyncValidation::copy( ${item['name']}, ${item['range'][1]} );
+            %endfor
+            %if generate_post_call:
+            %for item in th.get_loader_epilogue(n, tags, obj, meta):
+            %if 'range' in item:
+            auto ${item['name']}Copy = AsyncValidation::copy( ${item['name']}, ( result == ${X}_RESULT_SUCCESS && nullptr != ${item['name']} ) ? ${item['range'][1]} : 0 );
+            %else:
+            auto ${item['name']}Value = ( result == ${X}_RESULT_SUCCESS && ${item['name']} ) ? *${item['name']} : nullptr;
+            %endif
+            %endfor
+            %endif
+            context.asyncValidation->submit( ${"asyncSequence, " if async_release else ""}"${func_name}", [=]() mutable {
+                auto check = context.handleLifetime->${n}HandleLifetime.${func_name}( ${", ".join(async_args)} );
+                %if generate_post_call:
+                if( result == ${X}_RESULT_SUCCESS ){
+                    %for item in th.get_loader_epilogue(n, tags, obj, meta):
+                    %if 'range' in item:
+                    for (size_t i = 0; i < ${item['name']}Copy.size(); ++i){
+                        if (${item['name']}Copy[i]){
+                            context.handleLifetime->addHandle( ${item['name']}Copy[i] );
+                            %if th.type_traits.is_handle(item['type']):
+                            context.handleLifetime->addDependent( ${async_parent} ${item['name']}Copy[i] );
+                            %endif
+                        }
+                    }
+                    %else:
+                    if (${item['name']}Value){
+                        %if re.match(r"\w+Immediate$", func_name):
+                        context.handleLifetime->addHandle( ${item['name']}Value, false );
+                        %else:
+                        context.handleLifetime->addHandle( ${item['name']}Value );
+                        %if th.type_traits.is_handle(item['type']):
+                        context.handleLifetime->addDependent( ${async_parent} ${item['name']}Value );
+                        %endif
+                        %endif
+                    }
+                    %endif
+                    %endfor
+                }
+                %endif
+                return check;
+            } );
+        }
         %if generate_post_call:
 
         if( result == ${X}_RESULT_SUCCESS && context.enableHandleLifetime ){
@@ -0,0 +1,26 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file ze_probes.h
+ *
+ * Static probe points for tools such as bpftrace, perf and SystemTap.
+ * The provider is "level_zero"; the probes are lib_entry/lib_exit around
+ * the API trampolines and loader_entry/loader_exit around the loader
+ * intercepts. arg0 is the API name and arg1 of the exit probes is the
+ * returned result. When no tool is attached a probe is a single nop.
+ *
+ */
+#pragma once
+
+#if defined(ZE_ENABLE_SDT_PROBES)
+#include <sys/sdt.h>
+
+#define ZE_PROBE_ENTRY(layer, api) DTRACE_PROBE1(level_zero, layer##_entry, api)
+#define ZE_PROBE_EXIT(layer, api, result) DTRACE_PROBE2(level_zero, layer##_exit, api, static_cast<int>(result))
+#else
+#define ZE_PROBE_ENTRY(layer, api)
+#define ZE_PROBE_EXIT(layer, api, result)
+#endif
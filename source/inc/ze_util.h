@@ -155,4 +155,14 @@ inline std::string getenv_string ( const char* name){
     if ((nullptr == env))
         return "";
     return std::string(env);
+}
+
+inline size_t getenv_tosize( const char* name, size_t defaultValue )
+{
+    auto value = getenv_string(name);
+    if (value.empty())
+        return defaultValue;
+    char *end = nullptr;
+    auto size = strtoull(value.c_str(), &end, 10);
+    return *end == '\0' ? static_cast<size_t>(size) : defaultValue;
 }
\ No newline at end of file
@@ -0,0 +1,246 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include "barrier_pruner.h"
+#include <algorithm>
+#include <cinttypes>
+
+namespace optimization_layer
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    BarrierPruner::BarrierPruner(const ze_dditable_t &driver) : driver(driver) {}
+
+    BarrierPruner::~BarrierPruner() {}
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // The lock must be held; a list that has not seen the last event pool
+    // destroyed forgets its events first.
+    BarrierPruner::list_t *BarrierPruner::find( ze_command_list_handle_t hCommandList )
+    {
+        auto it = lists.find(hCommandList);
+        if (it == lists.end())
+            return nullptr;
+        auto &list = it->second;
+        if (list.epoch != epoch) {
+            list.waited.clear();
+            list.pending.clear();
+            list.epoch = epoch;
+        }
+        return &list;
+    }
+
+    bool BarrierPruner::isWaited( const list_t &list, ze_event_handle_t hEvent ) const
+    {
+        auto waited = list.waited.find(hEvent);
+        if (waited == list.waited.end())
+            return false;
+        auto reset = resets.find(hEvent);
+        return reset == resets.end() || reset->second <= waited->second;
+    }
+
+    void BarrierPruner::prune( list_t &list, uint32_t &numWaitEvents, ze_event_handle_t* &phWaitEvents )
+    {
+        list.stamp = clock;
+        if (!numWaitEvents || !phWaitEvents)
+            return;
+
+        list.waitEvents.clear();
+        for (uint32_t i = 0; i < numWaitEvents; ++i)
+            if (!isWaited(list, phWaitEvents[i]))
+                list.waitEvents.push_back(phWaitEvents[i]);
+        auto removed = numWaitEvents - static_cast<uint32_t>(list.waitEvents.size());
+        if (removed == 0)
+            return;
+
+        waitsRemoved.fetch_add(removed, std::memory_order_relaxed);
+        numWaitEvents = static_cast<uint32_t>(list.waitEvents.size());
+        phWaitEvents = numWaitEvents ? list.waitEvents.data() : nullptr;
+    }
+
+    // Commands of an in-order list start after the previous one completes,
+    // so every later command follows the waits of a command.
+    void BarrierPruner::record( list_t &list, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents )
+    {
+        list.lastWasBarrier = false;
+        auto &stamps = list.inOrder ? list.waited : list.pending;
+        for (uint32_t i = 0; phWaitEvents && i < numWaitEvents; ++i)
+            stamps[phWaitEvents[i]] = list.stamp;
+    }
+
+    void BarrierPruner::reset( ze_event_handle_t hEvent )
+    {
+        resets[hEvent] = ++clock;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void BarrierPruner::add( ze_command_list_handle_t hCommandList, bool inOrder )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (stopped)
+            return;
+        auto &list = lists[hCommandList];
+        list = list_t();
+        list.inOrder = inOrder;
+        list.epoch = epoch;
+    }
+
+    void BarrierPruner::registerCommandList( ze_command_list_handle_t hCommandList, const ze_command_list_desc_t* desc )
+    {
+        if (desc && !desc->pNext)
+            add(hCommandList, desc->flags & ZE_COMMAND_LIST_FLAG_IN_ORDER);
+    }
+
+    void BarrierPruner::registerCommandList( ze_command_list_handle_t hCommandList, const ze_command_queue_desc_t* altdesc )
+    {
+        if (altdesc && !altdesc->pNext)
+            add(hCommandList, altdesc->flags & ZE_COMMAND_QUEUE_FLAG_IN_ORDER);
+    }
+
+    void BarrierPruner::resetCommandList( ze_command_list_handle_t hCommandList )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto list = find(hCommandList);
+        if (list) {
+            list->lastWasBarrier = false;
+            list->waited.clear();
+            list->pending.clear();
+        }
+    }
+
+    void BarrierPruner::releaseCommandList( ze_command_list_handle_t hCommandList )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        lists.erase(hCommandList);
+    }
+
+    void BarrierPruner::stop()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopped = true;
+        lists.clear();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void BarrierPruner::pruneWaits( ze_command_list_handle_t hCommandList, uint32_t &numWaitEvents, ze_event_handle_t* &phWaitEvents )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto list = find(hCommandList);
+        if (list)
+            prune(*list, numWaitEvents, phWaitEvents);
+    }
+
+    // The signal event is forgotten after the waits are recorded, so a
+    // command waiting on the event it signals does not count as a wait on
+    // the new signal; lists that are not tracked signal events too.
+    void BarrierPruner::recordCommand( ze_command_list_handle_t hCommandList, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto list = find(hCommandList);
+        if (list)
+            record(*list, numWaitEvents, phWaitEvents);
+        if (hSignalEvent)
+            reset(hSignalEvent);
+    }
+
+    void BarrierPruner::releaseEvent( ze_event_handle_t hEvent )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        reset(hEvent);
+    }
+
+    void BarrierPruner::releaseEventPool( ze_event_pool_handle_t hEventPool )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ++epoch;
+        resets.clear();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Every command before a barrier completes before any command after it,
+    // which makes the waits of the commands before it hold for the rest of
+    // the list.
+    ze_result_t BarrierPruner::zeCommandListAppendBarrier( ze_command_list_handle_t hCommandList, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents )
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto list = find(hCommandList);
+            if (list) {
+                prune(*list, numWaitEvents, phWaitEvents);
+                if (!hSignalEvent && !numWaitEvents && list->lastWasBarrier) {
+                    barriersRemoved.fetch_add(1, std::memory_order_relaxed);
+                    return ZE_RESULT_SUCCESS;
+                }
+            }
+        }
+
+        auto result = driver.CommandList.pfnAppendBarrier(hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
+        if (result != ZE_RESULT_SUCCESS)
+            return result;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto list = find(hCommandList);
+        if (list) {
+            record(*list, numWaitEvents, phWaitEvents);
+            for (auto &pending : list->pending) {
+                auto waited = list->waited.emplace(pending);
+                if (!waited.second)
+                    waited.first->second = std::max(waited.first->second, pending.second);
+            }
+            list->pending.clear();
+            list->lastWasBarrier = true;
+        }
+        if (hSignalEvent)
+            reset(hSignalEvent);
+        return result;
+    }
+
+    ze_result_t BarrierPruner::zeCommandListAppendWaitOnEvents( ze_command_list_handle_t hCommandList, uint32_t numEvents, ze_event_handle_t* phEvents )
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto list = find(hCommandList);
+            if (list && numEvents && phEvents) {
+                prune(*list, numEvents, phEvents);
+                if (!numEvents) {
+                    waitCallsRemoved.fetch_add(1, std::memory_order_relaxed);
+                    return ZE_RESULT_SUCCESS;
+                }
+            }
+        }
+
+        auto result = driver.CommandList.pfnAppendWaitOnEvents(hCommandList, numEvents, phEvents);
+        if (result == ZE_RESULT_SUCCESS)
+            recordCommand(hCommandList, nullptr, numEvents, phEvents);
+        return result;
+    }
+
+    // The event is forgotten before the reset is appended, so no other list
+    // counts on it meanwhile.
+    ze_result_t BarrierPruner::zeCommandListAppendEventReset( ze_command_list_handle_t hCommandList, ze_event_handle_t hEvent )
+    {
+        releaseEvent(hEvent);
+        auto result = driver.CommandList.pfnAppendEventReset(hCommandList, hEvent);
+        if (result == ZE_RESULT_SUCCESS)
+            recordCommand(hCommandList, nullptr, 0, nullptr);
+        return result;
+    }
+
+    ze_result_t BarrierPruner::zeEventHostReset( ze_event_handle_t hEvent )
+    {
+        releaseEvent(hEvent);
+        return driver.Event.pfnHostReset(hEvent);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void BarrierPruner::report( FILE *stream ) const
+    {
+        fprintf(stream, "Barrier pruning: %" PRIu64 " barriers, %" PRIu64 " waits on events and %" PRIu64
+                " zeCommandListAppendWaitOnEvents calls removed\n",
+                barriersRemoved.load(), waitsRemoved.load(), waitCallsRemoved.load());
+    }
+
+} // namespace optimization_layer
@@ -0,0 +1,123 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#pragma once
+
+#include "ze_ddi.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace optimization_layer
+{
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Tracks, for every command list, the events that all later commands of
+    // the list are already ordered after, and removes:
+    //   - those events from the wait lists of later commands
+    //   - zeCommandListAppendWaitOnEvents calls left without events
+    //   - barriers without a signal event or events left to wait on that
+    //     directly follow another barrier
+    // An event is known to have been waited for once a command waited on it
+    // and, unless the list executes in order, a barrier followed. Resetting
+    // or destroying the event, on the host or in any command list, forgets
+    // it everywhere, and destroying an event pool forgets every event.
+    // Appending a command that signals the event, to any command list, also
+    // forgets it, as signaling a counter-based event arms it anew.
+    //
+    // Lists created with a pNext chain, such as mutable command lists whose
+    // wait lists can be updated later, are left alone, and so is every list
+    // once the driver hands out a function of an extension, as commands it
+    // appends are not seen.
+    class BarrierPruner {
+    public:
+        // The driver table is filled when the layer is chained, after
+        // the pruner is created.
+        explicit BarrierPruner(const ze_dditable_t &driver);
+        ~BarrierPruner();
+
+        ze_result_t zeCommandListAppendBarrier( ze_command_list_handle_t hCommandList, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents );
+        ze_result_t zeCommandListAppendWaitOnEvents( ze_command_list_handle_t hCommandList, uint32_t numEvents, ze_event_handle_t* phEvents );
+        ze_result_t zeCommandListAppendEventReset( ze_command_list_handle_t hCommandList, ze_event_handle_t hEvent );
+        ze_result_t zeEventHostReset( ze_event_handle_t hEvent );
+
+        // Starts tracking a command list once it is created.
+        void registerCommandList( ze_command_list_handle_t hCommandList, const ze_command_list_desc_t* desc );
+        void registerCommandList( ze_command_list_handle_t hCommandList, const ze_command_queue_desc_t* altdesc );
+        // Forgets what was appended to a command list when it is reset.
+        void resetCommandList( ze_command_list_handle_t hCommandList );
+        // Forgets a command list before it is destroyed.
+        void releaseCommandList( ze_command_list_handle_t hCommandList );
+        // Forgets every command list and stops tracking new ones.
+        void stop();
+
+        // Removes the events of a command's wait list that the list has
+        // already waited for; the pruned list is valid until the next
+        // command is appended to the list.
+        void pruneWaits( ze_command_list_handle_t hCommandList, uint32_t &numWaitEvents, ze_event_handle_t* &phWaitEvents );
+        // Records a command the driver appended with its pruned wait list
+        // and the event it signals.
+        void recordCommand( ze_command_list_handle_t hCommandList, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents );
+
+        // Forgets that an event was waited for before it is destroyed, or
+        // once it is signaled again.
+        void releaseEvent( ze_event_handle_t hEvent );
+        // Forgets every event before the events of a pool are destroyed.
+        void releaseEventPool( ze_event_pool_handle_t hEventPool );
+
+        // Prints the barriers and waits removed.
+        void report( FILE *stream ) const;
+
+    private:
+        // Events are stamped with the clock when they are waited for, and
+        // a wait only counts if the event was not reset since.
+        using stamps_t = std::unordered_map<ze_event_handle_t, uint64_t>;
+
+        struct list_t {
+            bool inOrder = false;
+            bool lastWasBarrier = false;
+            uint64_t epoch = 0;
+            // The clock when the wait list of the last command was pruned.
+            uint64_t stamp = 0;
+            // Events every later command is ordered after.
+            stamps_t waited;
+            // Events waited for by commands later commands may overtake,
+            // until a barrier.
+            stamps_t pending;
+            std::vector<ze_event_handle_t> waitEvents;
+        };
+
+        list_t *find(ze_command_list_handle_t hCommandList);
+        void add(ze_command_list_handle_t hCommandList, bool inOrder);
+        bool isWaited(const list_t &list, ze_event_handle_t hEvent) const;
+        void prune(list_t &list, uint32_t &numWaitEvents, ze_event_handle_t *&phWaitEvents);
+        void record(list_t &list, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents);
+        void reset(ze_event_handle_t hEvent);
+
+        const ze_dditable_t &driver;
+
+        // The specification does not allow appending to one list from
+        // simultaneous threads, but events are shared between lists.
+        std::mutex mutex;
+        std::unordered_map<ze_command_list_handle_t, list_t> lists;
+        uint64_t clock = 0;
+        // The clock when each event was last reset or destroyed.
+        stamps_t resets;
+        // Counts the event pools destroyed; a list waited for its events
+        // before the current epoch forgets them.
+        uint64_t epoch = 0;
+        bool stopped = false;
+
+        std::atomic<uint64_t> barriersRemoved{0};
+        std::atomic<uint64_t> waitsRemoved{0};
+        std::atomic<uint64_t> waitCallsRemoved{0};
+    };
+
+} // namespace optimization_layer
@@ -0,0 +1,169 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include "command_list_recycler.h"
+#include "ze_util.h"
+#include <vector>
+
+namespace optimization_layer
+{
+    namespace
+    {
+        bool isOutOfMemory(ze_result_t result)
+        {
+            return result == ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY || result == ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+        }
+    } // namespace
+
+    ///////////////////////////////////////////////////////////////////////////////
+    CommandListRecycler::CommandListRecycler(const ze_dditable_t &driver) : driver(driver)
+    {
+        maxKeptLists = getenv_tosize("ZE_COMMAND_LIST_RECYCLING_MAX_LISTS", maxKeptLists);
+    }
+
+    // Command lists still kept are left to the driver: contexts may already
+    // be destroyed, and the driver may be unloaded before this layer.
+    CommandListRecycler::~CommandListRecycler() {}
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ze_result_t CommandListRecycler::zeCommandListCreate( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_list_desc_t* desc, ze_command_list_handle_t* phCommandList )
+    {
+        if (!desc || !phCommandList || desc->pNext)
+            return driver.CommandList.pfnCreate(hContext, hDevice, desc, phCommandList);
+
+        key_t key = {hContext, hDevice, false, desc->commandQueueGroupOrdinal, desc->flags, 0,
+                     ZE_COMMAND_QUEUE_MODE_DEFAULT, ZE_COMMAND_QUEUE_PRIORITY_NORMAL};
+        if (takeKept(key, phCommandList))
+            return ZE_RESULT_SUCCESS;
+
+        auto result = driver.CommandList.pfnCreate(hContext, hDevice, desc, phCommandList);
+        if (isOutOfMemory(result)) {
+            trim();
+            result = driver.CommandList.pfnCreate(hContext, hDevice, desc, phCommandList);
+        }
+        if (result == ZE_RESULT_SUCCESS) {
+            std::lock_guard<std::mutex> lock(mutex);
+            liveLists[*phCommandList] = key;
+        }
+        return result;
+    }
+
+    ze_result_t CommandListRecycler::zeCommandListCreateImmediate( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_queue_desc_t* altdesc, ze_command_list_handle_t* phCommandList )
+    {
+        if (!altdesc || !phCommandList || altdesc->pNext)
+            return driver.CommandList.pfnCreateImmediate(hContext, hDevice, altdesc, phCommandList);
+
+        key_t key = {hContext, hDevice, true, altdesc->ordinal, altdesc->flags, altdesc->index,
+                     altdesc->mode, altdesc->priority};
+        if (takeKept(key, phCommandList))
+            return ZE_RESULT_SUCCESS;
+
+        auto result = driver.CommandList.pfnCreateImmediate(hContext, hDevice, altdesc, phCommandList);
+        if (isOutOfMemory(result)) {
+            trim();
+            result = driver.CommandList.pfnCreateImmediate(hContext, hDevice, altdesc, phCommandList);
+        }
+        if (result == ZE_RESULT_SUCCESS) {
+            std::lock_guard<std::mutex> lock(mutex);
+            liveLists[*phCommandList] = key;
+        }
+        return result;
+    }
+
+    ze_result_t CommandListRecycler::zeCommandListDestroy( ze_command_list_handle_t hCommandList )
+    {
+        key_t key;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = liveLists.find(hCommandList);
+            if (it == liveLists.end())
+                return driver.CommandList.pfnDestroy(hCommandList);
+            key = it->second;
+            liveLists.erase(it);
+        }
+
+        // Like destroy, reset requires the device to be done with the list,
+        // so the application already guarantees it here.
+        if (!key.immediate && driver.CommandList.pfnReset(hCommandList) != ZE_RESULT_SUCCESS)
+            return driver.CommandList.pfnDestroy(hCommandList);
+
+        ze_command_list_handle_t evicted = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (maxKeptLists == 0)
+                evicted = hCommandList;
+            else {
+                if (kept.size() == maxKeptLists) {
+                    auto &oldest = kept.front();
+                    evicted = oldest.second;
+                    auto range = keptByKey.equal_range(oldest.first);
+                    for (auto it = range.first; it != range.second; ++it) {
+                        if (it->second == kept.begin()) {
+                            keptByKey.erase(it);
+                            break;
+                        }
+                    }
+                    kept.pop_front();
+                }
+                keptByKey.emplace(key, kept.emplace(kept.end(), key, hCommandList));
+            }
+        }
+        if (evicted)
+            driver.CommandList.pfnDestroy(evicted);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    bool CommandListRecycler::takeKept(const key_t &key, ze_command_list_handle_t *phCommandList)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = keptByKey.find(key);
+        if (it == keptByKey.end())
+            return false;
+        *phCommandList = it->second->second;
+        kept.erase(it->second);
+        keptByKey.erase(it);
+        liveLists[*phCommandList] = key;
+        return true;
+    }
+
+    // Gives the memory of all kept command lists back to the driver.
+    void CommandListRecycler::trim()
+    {
+        kept_list_t released;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            released.swap(kept);
+            keptByKey.clear();
+        }
+        for (auto &list : released)
+            driver.CommandList.pfnDestroy(list.second);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void CommandListRecycler::releaseContext( ze_context_handle_t hContext )
+    {
+        std::vector<ze_command_list_handle_t> released;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (auto it = keptByKey.begin(); it != keptByKey.end();) {
+                if (it->first.context != hContext) {
+                    ++it;
+                    continue;
+                }
+                released.push_back(it->second->second);
+                kept.erase(it->second);
+                it = keptByKey.erase(it);
+            }
+            for (auto it = liveLists.begin(); it != liveLists.end();)
+                it = it->second.context == hContext ? liveLists.erase(it) : std::next(it);
+        }
+        for (auto hCommandList : released)
+            driver.CommandList.pfnDestroy(hCommandList);
+    }
+
+} // namespace optimization_layer
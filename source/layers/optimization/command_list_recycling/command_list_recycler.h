@@ -0,0 +1,82 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#pragma once
+
+#include "ze_ddi.h"
+#include <cstdint>
+#include <list>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+
+namespace optimization_layer
+{
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Keeps destroyed command lists to hand them out again, so creating a
+    // command list per task does not create one in the driver each time.
+    // A destroyed regular command list is reset and kept; an immediate one
+    // is kept as it is, since its commands were already submitted. The next
+    // create with the same context, device, ordinal and flags, and for
+    // immediate lists the same queue index, mode and priority, returns it.
+    //
+    // Command lists with a pNext chain are passed to the driver unchanged.
+    // Past the limit of kept lists the least recently kept is destroyed;
+    // when the driver runs out of memory creating a list, the kept lists
+    // are destroyed and the create is retried.
+    class CommandListRecycler {
+    public:
+        // The driver table is filled when the layer is chained, after
+        // the recycler is created.
+        explicit CommandListRecycler(const ze_dditable_t &driver);
+        ~CommandListRecycler();
+
+        ze_result_t zeCommandListCreate( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_list_desc_t* desc, ze_command_list_handle_t* phCommandList );
+        ze_result_t zeCommandListCreateImmediate( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_queue_desc_t* altdesc, ze_command_list_handle_t* phCommandList );
+        ze_result_t zeCommandListDestroy( ze_command_list_handle_t hCommandList );
+
+        // Destroys the command lists kept for a context before it is destroyed.
+        void releaseContext( ze_context_handle_t hContext );
+
+    private:
+        struct key_t {
+            ze_context_handle_t context;
+            ze_device_handle_t device;
+            bool immediate;
+            uint32_t ordinal;
+            uint32_t flags;
+            uint32_t index;
+            ze_command_queue_mode_t mode;
+            ze_command_queue_priority_t priority;
+
+            bool operator<(const key_t &other) const
+            {
+                return std::tie(context, device, immediate, ordinal, flags, index, mode, priority) <
+                       std::tie(other.context, other.device, other.immediate, other.ordinal, other.flags,
+                                other.index, other.mode, other.priority);
+            }
+        };
+
+        // Kept lists, least recently kept first.
+        using kept_list_t = std::list<std::pair<key_t, ze_command_list_handle_t>>;
+
+        bool takeKept(const key_t &key, ze_command_list_handle_t *phCommandList);
+        void trim();
+
+        const ze_dditable_t &driver;
+        size_t maxKeptLists = 64;
+
+        std::mutex mutex;
+        // Command lists created by the application and not destroyed.
+        std::unordered_map<ze_command_list_handle_t, key_t> liveLists;
+        kept_list_t kept;
+        std::multimap<key_t, kept_list_t::iterator> keptByKey;
+    };
+
+} // namespace optimization_layer
@@ -0,0 +1,175 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include "copy_coalescer.h"
+#include <cinttypes>
+
+namespace optimization_layer
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    CopyCoalescer::CopyCoalescer(const ze_dditable_t &driver) : driver(driver) {}
+
+    CopyCoalescer::~CopyCoalescer() {}
+
+    ///////////////////////////////////////////////////////////////////////////////
+    CopyCoalescer::list_t *CopyCoalescer::find( ze_command_list_handle_t hCommandList )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto list = lists.find(hCommandList);
+        return list == lists.end() ? nullptr : &list->second;
+    }
+
+    void CopyCoalescer::registerCommandList( ze_command_list_handle_t hCommandList, ze_context_handle_t hContext, const ze_command_list_desc_t* desc )
+    {
+        if (!desc || desc->pNext)
+            return;
+        std::lock_guard<std::mutex> lock(mutex);
+        auto &list = lists[hCommandList];
+        list = {};
+        list.hContext = hContext;
+    }
+
+    void CopyCoalescer::releaseCommandList( ze_command_list_handle_t hCommandList )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto list = lists.find(hCommandList);
+        if (list == lists.end())
+            return;
+        if (list->second.pending)
+            --pendingLists;
+        lists.erase(list);
+    }
+
+    void CopyCoalescer::stop()
+    {
+        stopped = true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ze_result_t CopyCoalescer::flush( ze_command_list_handle_t hCommandList )
+    {
+        if (pendingLists.load(std::memory_order_relaxed) == 0)
+            return ZE_RESULT_SUCCESS;
+        auto list = find(hCommandList);
+        return list ? flush(hCommandList, *list) : ZE_RESULT_SUCCESS;
+    }
+
+    // A copy the driver fails is dropped, and the error returned from the
+    // call that flushed it.
+    ze_result_t CopyCoalescer::flush( ze_command_list_handle_t hCommandList, list_t &list )
+    {
+        if (!list.pending)
+            return ZE_RESULT_SUCCESS;
+        list.pending = false;
+        --pendingLists;
+        auto &copy = list.copy;
+        return append(hCommandList, reinterpret_cast<void *>(copy.dst), reinterpret_cast<const void *>(copy.src),
+                      copy.size, nullptr, 0, nullptr);
+    }
+
+    ze_result_t CopyCoalescer::append( ze_command_list_handle_t hCommandList, void* dstptr, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents )
+    {
+        copiesOut.fetch_add(1, std::memory_order_relaxed);
+        bytesOut.fetch_add(size, std::memory_order_relaxed);
+        return driver.CommandList.pfnAppendMemoryCopy(hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents,
+                                                      phWaitEvents);
+    }
+
+    CopyCoalescer::range_t CopyCoalescer::getRange( ze_context_handle_t hContext, uintptr_t ptr )
+    {
+        range_t range;
+        void *base = nullptr;
+        size_t size = 0;
+        if (driver.Mem.pfnGetAddressRange &&
+            driver.Mem.pfnGetAddressRange(hContext, reinterpret_cast<const void *>(ptr), &base, &size) == ZE_RESULT_SUCCESS &&
+            base && size) {
+            range.begin = reinterpret_cast<uintptr_t>(base);
+            range.end = range.begin + size;
+        }
+        return range;
+    }
+
+    // Copies that only touch, such as the ends of two allocations the driver
+    // happened to place next to each other, are not merged.
+    bool CopyCoalescer::merge( list_t &list, uintptr_t dst, uintptr_t src, size_t size )
+    {
+        auto &copy = list.copy;
+        copy_t merged;
+        if (dst == copy.dst + copy.size && src == copy.src + copy.size)
+            merged = {copy.dst, copy.src, copy.size + size};
+        else if (dst + size == copy.dst && src + size == copy.src)
+            merged = {dst, src, copy.size + size};
+        else
+            return false;
+
+        if (merged.dst < merged.src + merged.size && merged.src < merged.dst + merged.size)
+            return false;
+
+        if (!list.ranged) {
+            list.dstRange = getRange(list.hContext, copy.dst);
+            list.srcRange = getRange(list.hContext, copy.src);
+            list.ranged = true;
+        }
+        if (merged.dst < list.dstRange.begin || merged.dst + merged.size > list.dstRange.end ||
+            merged.src < list.srcRange.begin || merged.src + merged.size > list.srcRange.end)
+            return false;
+        copy = merged;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ze_result_t CopyCoalescer::zeCommandListReset( ze_command_list_handle_t hCommandList )
+    {
+        if (pendingLists.load(std::memory_order_relaxed) != 0) {
+            auto list = find(hCommandList);
+            if (list && list->pending) {
+                list->pending = false;
+                --pendingLists;
+            }
+        }
+        return driver.CommandList.pfnReset(hCommandList);
+    }
+
+    ze_result_t CopyCoalescer::zeCommandListAppendMemoryCopy( ze_command_list_handle_t hCommandList, void* dstptr, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents )
+    {
+        copiesIn.fetch_add(1, std::memory_order_relaxed);
+        bytesIn.fetch_add(size, std::memory_order_relaxed);
+
+        auto list = find(hCommandList);
+        if (!list || stopped.load(std::memory_order_relaxed) || hSignalEvent || numWaitEvents || !dstptr || !srcptr ||
+            !size) {
+            auto result = list ? flush(hCommandList, *list) : ZE_RESULT_SUCCESS;
+            if (result != ZE_RESULT_SUCCESS)
+                return result;
+            return append(hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents);
+        }
+
+        auto dst = reinterpret_cast<uintptr_t>(dstptr);
+        auto src = reinterpret_cast<uintptr_t>(srcptr);
+        if (list->pending) {
+            if (merge(*list, dst, src, size))
+                return ZE_RESULT_SUCCESS;
+            auto result = flush(hCommandList, *list);
+            if (result != ZE_RESULT_SUCCESS)
+                return result;
+        }
+        list->pending = true;
+        list->copy = {dst, src, size};
+        list->ranged = false;
+        ++pendingLists;
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void CopyCoalescer::report( FILE *stream ) const
+    {
+        fprintf(stream, "Copy coalescing: %" PRIu64 " copies of %" PRIu64 " bytes appended, %" PRIu64
+                " copies of %" PRIu64 " bytes sent to the driver\n",
+                copiesIn.load(), bytesIn.load(), copiesOut.load(), bytesOut.load());
+    }
+
+} // namespace optimization_layer
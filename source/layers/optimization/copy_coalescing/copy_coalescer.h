@@ -0,0 +1,109 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#pragma once
+
+#include "ze_ddi.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <unordered_map>
+
+namespace optimization_layer
+{
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Holds back the last zeCommandListAppendMemoryCopy without events on a
+    // regular command list, and merges the next copy into it when both its
+    // source and destination continue the held copy's, or end where they
+    // start. The held copy is appended before any other command, when the
+    // list is closed, and dropped when the list is reset or destroyed.
+    //
+    // Copies are only merged when the merged copy does not read what it
+    // writes, so merging cannot change the result whatever order the copies
+    // would have run in, and when its source and destination each stay in
+    // the allocation the driver reports for the held copy. Lists created
+    // with a pNext chain, such as mutable command lists, are left alone.
+    //
+    // Commands appended through functions of driver extensions are not
+    // seen, so no copy is held back once the driver hands one out.
+    class CopyCoalescer {
+    public:
+        // The driver table is filled when the layer is chained, after
+        // the coalescer is created.
+        explicit CopyCoalescer(const ze_dditable_t &driver);
+        ~CopyCoalescer();
+
+        ze_result_t zeCommandListReset( ze_command_list_handle_t hCommandList );
+        ze_result_t zeCommandListAppendMemoryCopy( ze_command_list_handle_t hCommandList, void* dstptr, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents );
+
+        // Coalesces the copies of a regular command list once it is created.
+        void registerCommandList( ze_command_list_handle_t hCommandList, ze_context_handle_t hContext, const ze_command_list_desc_t* desc );
+        // Appends the copy held back on a command list.
+        ze_result_t flush( ze_command_list_handle_t hCommandList );
+        // Forgets a command list before it is destroyed.
+        void releaseCommandList( ze_command_list_handle_t hCommandList );
+        // Stops holding back copies once an extension function may append
+        // commands the coalescer does not see; copies already held are
+        // still appended before the next command the layer intercepts.
+        void stop();
+
+        // Prints the copies appended by the application and to the driver.
+        void report( FILE *stream ) const;
+
+    private:
+        struct copy_t {
+            uintptr_t dst;
+            uintptr_t src;
+            size_t size;
+        };
+
+        // An allocation as [begin, end); empty when the driver does not
+        // know the address.
+        struct range_t {
+            uintptr_t begin = 0;
+            uintptr_t end = 0;
+        };
+
+        struct list_t {
+            ze_context_handle_t hContext = nullptr;
+            bool pending = false;
+            copy_t copy;
+            // The allocations of the held copy, asked for the first time
+            // a copy could be merged into it.
+            bool ranged = false;
+            range_t dstRange;
+            range_t srcRange;
+        };
+
+        list_t *find(ze_command_list_handle_t hCommandList);
+        ze_result_t flush(ze_command_list_handle_t hCommandList, list_t &list);
+        ze_result_t append(ze_command_list_handle_t hCommandList, void *dstptr, const void *srcptr, size_t size,
+                           ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents);
+        bool merge(list_t &list, uintptr_t dst, uintptr_t src, size_t size);
+        range_t getRange(ze_context_handle_t hContext, uintptr_t ptr);
+
+        const ze_dditable_t &driver;
+
+        std::mutex mutex;
+        // Regular command lists; the specification does not allow appending
+        // to one list from simultaneous threads, so a list is only locked
+        // while it is looked up.
+        std::unordered_map<ze_command_list_handle_t, list_t> lists;
+        // Lists holding back a copy, so other lists skip the lookup.
+        std::atomic<uint32_t> pendingLists{0};
+        std::atomic<bool> stopped{false};
+
+        std::atomic<uint64_t> copiesIn{0};
+        std::atomic<uint64_t> bytesIn{0};
+        std::atomic<uint64_t> copiesOut{0};
+        std::atomic<uint64_t> bytesOut{0};
+    };
+
+} // namespace optimization_layer
@@ -0,0 +1,244 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include "event_recycler.h"
+#include "ze_util.h"
+
+namespace optimization_layer
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    EventRecycler::EventRecycler(const ze_dditable_t &driver) : driver(driver)
+    {
+        maxKeptPools = getenv_tosize("ZE_EVENT_RECYCLING_MAX_POOLS", maxKeptPools);
+        maxKeptFences = getenv_tosize("ZE_EVENT_RECYCLING_MAX_FENCES", maxKeptFences);
+    }
+
+    // Objects still kept are left to the driver: contexts may already be
+    // destroyed, and the driver may be unloaded before this layer.
+    EventRecycler::~EventRecycler() {}
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ze_result_t EventRecycler::zeEventPoolCreate( ze_context_handle_t hContext, const ze_event_pool_desc_t* desc, uint32_t numDevices, ze_device_handle_t* phDevices, ze_event_pool_handle_t* phEventPool )
+    {
+        if (!desc || !phEventPool || desc->pNext || (desc->flags & ZE_EVENT_POOL_FLAG_IPC) || (numDevices && !phDevices))
+            return driver.EventPool.pfnCreate(hContext, desc, numDevices, phDevices, phEventPool);
+
+        pool_key_t key = {hContext, desc->flags, desc->count, {phDevices, phDevices + numDevices}};
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto kept = keptPools.find(key);
+            if (kept != keptPools.end()) {
+                *phEventPool = kept->second;
+                keptPools.erase(kept);
+                return ZE_RESULT_SUCCESS;
+            }
+        }
+
+        auto result = driver.EventPool.pfnCreate(hContext, desc, numDevices, phDevices, phEventPool);
+        if (result == ZE_RESULT_SUCCESS) {
+            std::lock_guard<std::mutex> lock(mutex);
+            pools[*phEventPool].key = std::move(key);
+        }
+        return result;
+    }
+
+    ze_result_t EventRecycler::zeEventPoolDestroy( ze_event_pool_handle_t hEventPool )
+    {
+        pool_t pool;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = pools.find(hEventPool);
+            if (it == pools.end())
+                return driver.EventPool.pfnDestroy(hEventPool);
+            // A pool with live events is the application's error to report;
+            // the driver sees it as it would without the layer.
+            if (it->second.liveEvents == 0 && keptPools.size() < maxKeptPools) {
+                keptPools.emplace(it->second.key, hEventPool);
+                return ZE_RESULT_SUCCESS;
+            }
+            pool = std::move(it->second);
+            pools.erase(it);
+            for (auto event = liveEvents.begin(); event != liveEvents.end();)
+                event = event->second.pool == hEventPool ? liveEvents.erase(event) : std::next(event);
+        }
+        destroyCachedEvents(pool);
+        return driver.EventPool.pfnDestroy(hEventPool);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ze_result_t EventRecycler::zeEventCreate( ze_event_pool_handle_t hEventPool, const ze_event_desc_t* desc, ze_event_handle_t* phEvent )
+    {
+        if (!desc || !phEvent || desc->pNext)
+            return driver.Event.pfnCreate(hEventPool, desc, phEvent);
+
+        ze_event_handle_t stale = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto pool = pools.find(hEventPool);
+            if (pool == pools.end())
+                return driver.Event.pfnCreate(hEventPool, desc, phEvent);
+            auto cached = pool->second.cached.find(desc->index);
+            if (cached != pool->second.cached.end()) {
+                auto event = cached->second;
+                pool->second.cached.erase(cached);
+                if (event.signal == desc->signal && event.wait == desc->wait) {
+                    liveEvents[event.event] = {hEventPool, desc->index, desc->signal, desc->wait};
+                    ++pool->second.liveEvents;
+                    *phEvent = event.event;
+                    return ZE_RESULT_SUCCESS;
+                }
+                // The index is taken by an event with other scopes.
+                stale = event.event;
+            }
+        }
+        if (stale)
+            driver.Event.pfnDestroy(stale);
+
+        auto result = driver.Event.pfnCreate(hEventPool, desc, phEvent);
+        if (result == ZE_RESULT_SUCCESS) {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto pool = pools.find(hEventPool);
+            if (pool != pools.end()) {
+                liveEvents[*phEvent] = {hEventPool, desc->index, desc->signal, desc->wait};
+                ++pool->second.liveEvents;
+            }
+        }
+        return result;
+    }
+
+    ze_result_t EventRecycler::zeEventDestroy( ze_event_handle_t hEvent )
+    {
+        event_t event;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = liveEvents.find(hEvent);
+            if (it == liveEvents.end())
+                return driver.Event.pfnDestroy(hEvent);
+            event = it->second;
+            liveEvents.erase(it);
+            auto pool = pools.find(event.pool);
+            if (pool != pools.end())
+                --pool->second.liveEvents;
+        }
+
+        // The next create must find the event unsignaled, as a new one is.
+        if (driver.Event.pfnHostReset(hEvent) == ZE_RESULT_SUCCESS) {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto pool = pools.find(event.pool);
+            if (pool != pools.end() && pool->second.cached.emplace(event.index, cached_event_t{hEvent, event.signal, event.wait}).second)
+                return ZE_RESULT_SUCCESS;
+        }
+        return driver.Event.pfnDestroy(hEvent);
+    }
+
+    void EventRecycler::destroyCachedEvents(const pool_t &pool)
+    {
+        for (auto &cached : pool.cached)
+            driver.Event.pfnDestroy(cached.second.event);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ze_result_t EventRecycler::zeFenceCreate( ze_command_queue_handle_t hCommandQueue, const ze_fence_desc_t* desc, ze_fence_handle_t* phFence )
+    {
+        if (!desc || !phFence || desc->pNext || desc->flags)
+            return driver.Fence.pfnCreate(hCommandQueue, desc, phFence);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto kept = keptFences.find(hCommandQueue);
+            if (kept != keptFences.end() && !kept->second.empty()) {
+                *phFence = kept->second.back();
+                kept->second.pop_back();
+                liveFences[*phFence] = hCommandQueue;
+                return ZE_RESULT_SUCCESS;
+            }
+        }
+
+        auto result = driver.Fence.pfnCreate(hCommandQueue, desc, phFence);
+        if (result == ZE_RESULT_SUCCESS) {
+            std::lock_guard<std::mutex> lock(mutex);
+            liveFences[*phFence] = hCommandQueue;
+        }
+        return result;
+    }
+
+    ze_result_t EventRecycler::zeFenceDestroy( ze_fence_handle_t hFence )
+    {
+        ze_command_queue_handle_t hCommandQueue;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = liveFences.find(hFence);
+            if (it == liveFences.end())
+                return driver.Fence.pfnDestroy(hFence);
+            hCommandQueue = it->second;
+            liveFences.erase(it);
+        }
+
+        if (driver.Fence.pfnReset(hFence) == ZE_RESULT_SUCCESS) {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto &kept = keptFences[hCommandQueue];
+            if (kept.size() < maxKeptFences) {
+                kept.push_back(hFence);
+                return ZE_RESULT_SUCCESS;
+            }
+        }
+        return driver.Fence.pfnDestroy(hFence);
+    }
+
+    ze_result_t EventRecycler::zeCommandQueueDestroy( ze_command_queue_handle_t hCommandQueue )
+    {
+        std::vector<ze_fence_handle_t> fences;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto kept = keptFences.find(hCommandQueue);
+            if (kept != keptFences.end()) {
+                fences = std::move(kept->second);
+                keptFences.erase(kept);
+            }
+            for (auto it = liveFences.begin(); it != liveFences.end();)
+                it = it->second == hCommandQueue ? liveFences.erase(it) : std::next(it);
+        }
+        for (auto fence : fences)
+            driver.Fence.pfnDestroy(fence);
+        return driver.CommandQueue.pfnDestroy(hCommandQueue);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Pools the application still holds are only forgotten; the driver
+    // destroys them with the context.
+    void EventRecycler::releaseContext( ze_context_handle_t hContext )
+    {
+        std::vector<pool_t> released;
+        std::vector<ze_event_pool_handle_t> kept;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (auto it = keptPools.begin(); it != keptPools.end();) {
+                if (it->first.context != hContext) {
+                    ++it;
+                    continue;
+                }
+                kept.push_back(it->second);
+                it = keptPools.erase(it);
+            }
+            for (auto it = pools.begin(); it != pools.end();) {
+                if (it->second.key.context != hContext) {
+                    ++it;
+                    continue;
+                }
+                released.push_back(std::move(it->second));
+                it = pools.erase(it);
+            }
+            for (auto it = liveEvents.begin(); it != liveEvents.end();)
+                it = pools.count(it->second.pool) ? std::next(it) : liveEvents.erase(it);
+        }
+        for (auto &pool : released)
+            destroyCachedEvents(pool);
+        for (auto hEventPool : kept)
+            driver.EventPool.pfnDestroy(hEventPool);
+    }
+
+} // namespace optimization_layer
@@ -0,0 +1,103 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#pragma once
+
+#include "ze_ddi.h"
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace optimization_layer
+{
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Keeps destroyed events, fences and event pools to hand them out again,
+    // so creating and destroying them in a loop makes no driver calls beyond
+    // the host reset of the recycled object.
+    //   - A destroyed event is reset and kept in its pool at its index. The
+    //     next create at that index with the same scopes returns it; one
+    //     with other scopes destroys it first, since the index is taken.
+    //   - A destroyed event pool without live events is kept, with its
+    //     cached events, for the next create with the same context, flags,
+    //     count and devices, up to a limit of kept pools.
+    //   - A destroyed fence is reset and kept for the next create on its
+    //     command queue.
+    // Objects with a pNext chain, IPC event pools and fences created
+    // signaled are passed to the driver unchanged. Kept objects are
+    // destroyed with their command queue or context.
+    class EventRecycler {
+    public:
+        // The driver table is filled when the layer is chained, after
+        // the recycler is created.
+        explicit EventRecycler(const ze_dditable_t &driver);
+        ~EventRecycler();
+
+        ze_result_t zeEventPoolCreate( ze_context_handle_t hContext, const ze_event_pool_desc_t* desc, uint32_t numDevices, ze_device_handle_t* phDevices, ze_event_pool_handle_t* phEventPool );
+        ze_result_t zeEventPoolDestroy( ze_event_pool_handle_t hEventPool );
+        ze_result_t zeEventCreate( ze_event_pool_handle_t hEventPool, const ze_event_desc_t* desc, ze_event_handle_t* phEvent );
+        ze_result_t zeEventDestroy( ze_event_handle_t hEvent );
+        ze_result_t zeFenceCreate( ze_command_queue_handle_t hCommandQueue, const ze_fence_desc_t* desc, ze_fence_handle_t* phFence );
+        ze_result_t zeFenceDestroy( ze_fence_handle_t hFence );
+        ze_result_t zeCommandQueueDestroy( ze_command_queue_handle_t hCommandQueue );
+
+        // Destroys the event pools kept for a context before it is destroyed.
+        void releaseContext( ze_context_handle_t hContext );
+
+    private:
+        struct pool_key_t {
+            ze_context_handle_t context;
+            ze_event_pool_flags_t flags;
+            uint32_t count;
+            std::vector<ze_device_handle_t> devices;
+
+            bool operator<(const pool_key_t &other) const
+            {
+                return std::tie(context, flags, count, devices) <
+                       std::tie(other.context, other.flags, other.count, other.devices);
+            }
+        };
+
+        struct cached_event_t {
+            ze_event_handle_t event;
+            ze_event_scope_flags_t signal;
+            ze_event_scope_flags_t wait;
+        };
+
+        struct pool_t {
+            pool_key_t key;
+            uint32_t liveEvents = 0;
+            // Destroyed events by index.
+            std::unordered_map<uint32_t, cached_event_t> cached;
+        };
+
+        struct event_t {
+            ze_event_pool_handle_t pool;
+            uint32_t index;
+            ze_event_scope_flags_t signal;
+            ze_event_scope_flags_t wait;
+        };
+
+        void destroyCachedEvents(const pool_t &pool);
+
+        const ze_dditable_t &driver;
+        size_t maxKeptPools = 16;
+        size_t maxKeptFences = 64;
+
+        std::mutex mutex;
+        // Recyclable pools created by the application, live or kept.
+        std::unordered_map<ze_event_pool_handle_t, pool_t> pools;
+        std::multimap<pool_key_t, ze_event_pool_handle_t> keptPools;
+        std::unordered_map<ze_event_handle_t, event_t> liveEvents;
+        std::unordered_map<ze_fence_handle_t, ze_command_queue_handle_t> liveFences;
+        std::unordered_map<ze_command_queue_handle_t, std::vector<ze_fence_handle_t>> keptFences;
+    };
+
+} // namespace optimization_layer
@@ -0,0 +1,255 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include "ipc_cache.h"
+#include "ze_util.h"
+#include <iterator>
+#include <vector>
+
+namespace optimization_layer
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    IpcCache::IpcCache(const ze_dditable_t &driver) : driver(driver)
+    {
+        matchOpened = getenv_tobool("ZE_IPC_CACHE_MATCH_OPENED");
+    }
+
+    IpcCache::~IpcCache() {}
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Exporting under the lock keeps two threads from exporting the same
+    // allocation twice.
+    ze_result_t IpcCache::zeMemGetIpcHandle( ze_context_handle_t hContext, const void* ptr, ze_ipc_mem_handle_t* pIpcHandle )
+    {
+        if (!ptr || !pIpcHandle)
+            return driver.Mem.pfnGetIpcHandle(hContext, ptr, pIpcHandle);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto exported = exportedMemory.find({hContext, ptr});
+        if (exported != exportedMemory.end()) {
+            *pIpcHandle = exported->second.handle;
+            return ZE_RESULT_SUCCESS;
+        }
+
+        auto result = driver.Mem.pfnGetIpcHandle(hContext, ptr, pIpcHandle);
+        if (result != ZE_RESULT_SUCCESS)
+            return result;
+
+        // The handle is put when the allocation it was exported from is
+        // freed, whichever pointer into it was exported.
+        void *base = nullptr;
+        if (driver.Mem.pfnGetAddressRange(hContext, ptr, &base, nullptr) != ZE_RESULT_SUCCESS || !base)
+            base = const_cast<void *>(ptr);
+        exportedMemory[{hContext, ptr}] = {base, *pIpcHandle};
+        exportedMemoryHandles[{hContext, bytesOf(*pIpcHandle)}] = ptr;
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t IpcCache::zeMemPutIpcHandle( ze_context_handle_t hContext, ze_ipc_mem_handle_t handle )
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (exportedMemoryHandles.count({hContext, bytesOf(handle)}))
+                return ZE_RESULT_SUCCESS;
+        }
+        if (driver.Mem.pfnPutIpcHandle == nullptr)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        return driver.Mem.pfnPutIpcHandle(hContext, handle);
+    }
+
+    ze_result_t IpcCache::zeMemOpenIpcHandle( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_ipc_mem_handle_t handle, ze_ipc_memory_flags_t flags, void** pptr )
+    {
+        if (!matchOpened || !pptr)
+            return driver.Mem.pfnOpenIpcHandle(hContext, hDevice, handle, flags, pptr);
+
+        memory_key_t key{hContext, hDevice, flags, bytesOf(handle)};
+        std::lock_guard<std::mutex> lock(mutex);
+        if (descriptorHandles.count(std::get<3>(key)))
+            return driver.Mem.pfnOpenIpcHandle(hContext, hDevice, handle, flags, pptr);
+        auto opened = openedMemoryByKey.find(key);
+        if (opened != openedMemoryByKey.end()) {
+            ++openedMemory[opened->second].references;
+            *pptr = opened->second;
+            return ZE_RESULT_SUCCESS;
+        }
+
+        auto result = driver.Mem.pfnOpenIpcHandle(hContext, hDevice, handle, flags, pptr);
+        if (result == ZE_RESULT_SUCCESS) {
+            openedMemoryByKey[key] = *pptr;
+            openedMemory[*pptr].key = std::move(key);
+        }
+        return result;
+    }
+
+    ze_result_t IpcCache::zeMemCloseIpcHandle( ze_context_handle_t hContext, const void* ptr )
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto opened = openedMemory.find(ptr);
+            if (opened != openedMemory.end()) {
+                if (--opened->second.references > 0)
+                    return ZE_RESULT_SUCCESS;
+                openedMemoryByKey.erase(opened->second.key);
+                openedMemory.erase(opened);
+            }
+        }
+        return driver.Mem.pfnCloseIpcHandle(hContext, ptr);
+    }
+
+    // Descriptors are small integers, so the handles made from them repeat.
+    ze_result_t IpcCache::zeMemGetIpcHandleFromFileDescriptorExp( ze_context_handle_t hContext, uint64_t handle, ze_ipc_mem_handle_t* pIpcHandle )
+    {
+        if (driver.MemExp.pfnGetIpcHandleFromFileDescriptorExp == nullptr)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        auto result = driver.MemExp.pfnGetIpcHandleFromFileDescriptorExp(hContext, handle, pIpcHandle);
+        if (result == ZE_RESULT_SUCCESS && pIpcHandle) {
+            std::lock_guard<std::mutex> lock(mutex);
+            descriptorHandles.insert(bytesOf(*pIpcHandle));
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ze_result_t IpcCache::zeEventPoolGetIpcHandle( ze_event_pool_handle_t hEventPool, ze_ipc_event_pool_handle_t* phIpc )
+    {
+        if (!phIpc)
+            return driver.EventPool.pfnGetIpcHandle(hEventPool, phIpc);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto exported = exportedEventPools.find(hEventPool);
+        if (exported != exportedEventPools.end()) {
+            *phIpc = exported->second.handle;
+            return ZE_RESULT_SUCCESS;
+        }
+
+        auto result = driver.EventPool.pfnGetIpcHandle(hEventPool, phIpc);
+        if (result != ZE_RESULT_SUCCESS)
+            return result;
+
+        // Without the context of the pool, the handle cannot be put back.
+        ze_context_handle_t hContext = nullptr;
+        if (driver.EventPool.pfnGetContextHandle == nullptr ||
+            driver.EventPool.pfnGetContextHandle(hEventPool, &hContext) != ZE_RESULT_SUCCESS || !hContext)
+            return ZE_RESULT_SUCCESS;
+        exportedEventPools[hEventPool] = {hContext, *phIpc};
+        exportedEventPoolHandles[{hContext, bytesOf(*phIpc)}] = hEventPool;
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t IpcCache::zeEventPoolPutIpcHandle( ze_context_handle_t hContext, ze_ipc_event_pool_handle_t hIpc )
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (exportedEventPoolHandles.count({hContext, bytesOf(hIpc)}))
+                return ZE_RESULT_SUCCESS;
+        }
+        if (driver.EventPool.pfnPutIpcHandle == nullptr)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        return driver.EventPool.pfnPutIpcHandle(hContext, hIpc);
+    }
+
+    ze_result_t IpcCache::zeEventPoolOpenIpcHandle( ze_context_handle_t hContext, ze_ipc_event_pool_handle_t hIpc, ze_event_pool_handle_t* phEventPool )
+    {
+        if (!matchOpened || !phEventPool)
+            return driver.EventPool.pfnOpenIpcHandle(hContext, hIpc, phEventPool);
+
+        event_pool_key_t key{hContext, bytesOf(hIpc)};
+        std::lock_guard<std::mutex> lock(mutex);
+        auto opened = openedEventPoolsByKey.find(key);
+        if (opened != openedEventPoolsByKey.end()) {
+            ++openedEventPools[opened->second].references;
+            *phEventPool = opened->second;
+            return ZE_RESULT_SUCCESS;
+        }
+
+        auto result = driver.EventPool.pfnOpenIpcHandle(hContext, hIpc, phEventPool);
+        if (result == ZE_RESULT_SUCCESS) {
+            openedEventPoolsByKey[key] = *phEventPool;
+            openedEventPools[*phEventPool].key = std::move(key);
+        }
+        return result;
+    }
+
+    ze_result_t IpcCache::zeEventPoolCloseIpcHandle( ze_event_pool_handle_t hEventPool )
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto opened = openedEventPools.find(hEventPool);
+            if (opened != openedEventPools.end()) {
+                if (--opened->second.references > 0)
+                    return ZE_RESULT_SUCCESS;
+                openedEventPoolsByKey.erase(opened->second.key);
+                openedEventPools.erase(opened);
+            }
+        }
+        return driver.EventPool.pfnCloseIpcHandle(hEventPool);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // The pointers exported from one allocation are adjacent in the map, as
+    // allocations do not overlap.
+    void IpcCache::releaseAllocation( ze_context_handle_t hContext, const void* ptr )
+    {
+        std::vector<ze_ipc_mem_handle_t> handles;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto exported = exportedMemory.lower_bound({hContext, ptr});
+            while (exported != exportedMemory.end() && exported->first.first == hContext &&
+                   exported->second.base == ptr) {
+                // Pointers into one allocation may share their handle.
+                if (exportedMemoryHandles.erase({hContext, bytesOf(exported->second.handle)}))
+                    handles.push_back(exported->second.handle);
+                exported = exportedMemory.erase(exported);
+            }
+        }
+        if (driver.Mem.pfnPutIpcHandle == nullptr)
+            return;
+        for (auto &handle : handles)
+            driver.Mem.pfnPutIpcHandle(hContext, handle);
+    }
+
+    void IpcCache::releaseEventPool( ze_event_pool_handle_t hEventPool )
+    {
+        exported_event_pool_t exported;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto pool = exportedEventPools.find(hEventPool);
+            if (pool == exportedEventPools.end())
+                return;
+            exported = pool->second;
+            exportedEventPoolHandles.erase({exported.context, bytesOf(exported.handle)});
+            exportedEventPools.erase(pool);
+        }
+        if (driver.EventPool.pfnPutIpcHandle != nullptr)
+            driver.EventPool.pfnPutIpcHandle(exported.context, exported.handle);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // The driver releases whatever was left exported or open in the context.
+    void IpcCache::releaseContext( ze_context_handle_t hContext )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto it = exportedMemory.lower_bound({hContext, nullptr});
+             it != exportedMemory.end() && it->first.first == hContext;)
+            it = exportedMemory.erase(it);
+        for (auto it = exportedMemoryHandles.begin(); it != exportedMemoryHandles.end();)
+            it = it->first.first == hContext ? exportedMemoryHandles.erase(it) : std::next(it);
+        for (auto it = exportedEventPools.begin(); it != exportedEventPools.end();)
+            it = it->second.context == hContext ? exportedEventPools.erase(it) : std::next(it);
+        for (auto it = exportedEventPoolHandles.begin(); it != exportedEventPoolHandles.end();)
+            it = it->first.first == hContext ? exportedEventPoolHandles.erase(it) : std::next(it);
+        for (auto it = openedMemory.begin(); it != openedMemory.end();)
+            it = std::get<0>(it->second.key) == hContext ? openedMemory.erase(it) : std::next(it);
+        for (auto it = openedMemoryByKey.begin(); it != openedMemoryByKey.end();)
+            it = std::get<0>(it->first) == hContext ? openedMemoryByKey.erase(it) : std::next(it);
+        for (auto it = openedEventPools.begin(); it != openedEventPools.end();)
+            it = it->second.key.first == hContext ? openedEventPools.erase(it) : std::next(it);
+        for (auto it = openedEventPoolsByKey.begin(); it != openedEventPoolsByKey.end();)
+            it = it->first.first == hContext ? openedEventPoolsByKey.erase(it) : std::next(it);
+    }
+
+} // namespace optimization_layer
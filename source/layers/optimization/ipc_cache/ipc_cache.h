@@ -0,0 +1,109 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#pragma once
+
+#include "ze_ddi.h"
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+namespace optimization_layer
+{
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Keeps the IPC handles exported from allocations and event pools, and
+    // the allocations and event pools opened from IPC handles, so processes
+    // exchanging the same buffers every iteration only ask the driver once:
+    //   - zeMemGetIpcHandle and zeEventPoolGetIpcHandle return the handle
+    //     exported first until the allocation is freed or the event pool is
+    //     destroyed; putting such a handle is deferred until then.
+    //   - zeMemOpenIpcHandle and zeEventPoolOpenIpcHandle of a handle already
+    //     open in the context return the same pointer or event pool, which
+    //     is closed in the driver with its last close.
+    // The API does not say which process a handle was received from, so
+    // opened handles are only matched, on their bytes, when the application
+    // states that its driver encodes the exporting process in them. Handles
+    // made from file descriptors are never matched, as a descriptor number
+    // is reused for another allocation once closed.
+    class IpcCache {
+    public:
+        // The driver table is filled when the layer is chained, after
+        // the cache is created.
+        explicit IpcCache(const ze_dditable_t &driver);
+        ~IpcCache();
+
+        ze_result_t zeMemGetIpcHandle( ze_context_handle_t hContext, const void* ptr, ze_ipc_mem_handle_t* pIpcHandle );
+        ze_result_t zeMemPutIpcHandle( ze_context_handle_t hContext, ze_ipc_mem_handle_t handle );
+        ze_result_t zeMemOpenIpcHandle( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_ipc_mem_handle_t handle, ze_ipc_memory_flags_t flags, void** pptr );
+        ze_result_t zeMemCloseIpcHandle( ze_context_handle_t hContext, const void* ptr );
+        ze_result_t zeMemGetIpcHandleFromFileDescriptorExp( ze_context_handle_t hContext, uint64_t handle, ze_ipc_mem_handle_t* pIpcHandle );
+        ze_result_t zeEventPoolGetIpcHandle( ze_event_pool_handle_t hEventPool, ze_ipc_event_pool_handle_t* phIpc );
+        ze_result_t zeEventPoolPutIpcHandle( ze_context_handle_t hContext, ze_ipc_event_pool_handle_t hIpc );
+        ze_result_t zeEventPoolOpenIpcHandle( ze_context_handle_t hContext, ze_ipc_event_pool_handle_t hIpc, ze_event_pool_handle_t* phEventPool );
+        ze_result_t zeEventPoolCloseIpcHandle( ze_event_pool_handle_t hEventPool );
+
+        // Puts the handles exported from an allocation before it is freed.
+        void releaseAllocation( ze_context_handle_t hContext, const void* ptr );
+        // Puts the handle exported from an event pool before it is destroyed.
+        void releaseEventPool( ze_event_pool_handle_t hEventPool );
+        // Forgets the handles of a context before it is destroyed.
+        void releaseContext( ze_context_handle_t hContext );
+
+    private:
+        template <typename handle_t>
+        static std::string bytesOf(const handle_t &handle)
+        {
+            return std::string(handle.data, sizeof(handle.data));
+        }
+
+        struct exported_memory_t {
+            const void *base;
+            ze_ipc_mem_handle_t handle;
+        };
+
+        struct exported_event_pool_t {
+            ze_context_handle_t context;
+            ze_ipc_event_pool_handle_t handle;
+        };
+
+        using memory_key_t = std::tuple<ze_context_handle_t, ze_device_handle_t, ze_ipc_memory_flags_t, std::string>;
+        using event_pool_key_t = std::pair<ze_context_handle_t, std::string>;
+
+        template <typename key_t>
+        struct opened_t {
+            key_t key;
+            uint32_t references = 1;
+        };
+
+        const ze_dditable_t &driver;
+        // Whether the bytes of a handle identify the process it was
+        // exported from.
+        bool matchOpened = false;
+
+        std::mutex mutex;
+        // Handles exported from allocations, by context and exported pointer.
+        std::map<std::pair<ze_context_handle_t, const void *>, exported_memory_t> exportedMemory;
+        std::map<std::pair<ze_context_handle_t, std::string>, const void *> exportedMemoryHandles;
+        std::unordered_map<ze_event_pool_handle_t, exported_event_pool_t> exportedEventPools;
+        std::map<event_pool_key_t, ze_event_pool_handle_t> exportedEventPoolHandles;
+        // Allocations and event pools opened from handles.
+        std::map<memory_key_t, void *> openedMemoryByKey;
+        std::unordered_map<const void *, opened_t<memory_key_t>> openedMemory;
+        std::map<event_pool_key_t, ze_event_pool_handle_t> openedEventPoolsByKey;
+        std::unordered_map<ze_event_pool_handle_t, opened_t<event_pool_key_t>> openedEventPools;
+        // Handles made from file descriptors.
+        std::set<std::string> descriptorHandles;
+    };
+
+} // namespace optimization_layer
@@ -0,0 +1,157 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include "kernel_cache.h"
+#include "ze_util.h"
+#include <algorithm>
+#include <cstring>
+
+namespace optimization_layer
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    KernelCache::KernelCache(const ze_dditable_t &driver) : driver(driver)
+    {
+        shareKernels = getenv_tobool("ZE_KERNEL_CACHE_SHARE_KERNELS");
+    }
+
+    KernelCache::~KernelCache() {}
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // The kernels of a module must be destroyed before it, so only the
+    // names are left to forget.
+    ze_result_t KernelCache::zeModuleDestroy( ze_module_handle_t hModule )
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            kernelNames.erase(hModule);
+        }
+        return driver.Module.pfnDestroy(hModule);
+    }
+
+    ze_result_t KernelCache::zeModuleGetKernelNames( ze_module_handle_t hModule, uint32_t* pCount, const char** pNames )
+    {
+        if (!pCount)
+            return driver.Module.pfnGetKernelNames(hModule, pCount, pNames);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto names = kernelNames.find(hModule);
+        if (names == kernelNames.end()) {
+            uint32_t count = 0;
+            auto result = driver.Module.pfnGetKernelNames(hModule, &count, nullptr);
+            if (result != ZE_RESULT_SUCCESS)
+                return result;
+            std::vector<const char *> driverNames(count);
+            if (count) {
+                result = driver.Module.pfnGetKernelNames(hModule, &count, driverNames.data());
+                if (result != ZE_RESULT_SUCCESS)
+                    return result;
+                driverNames.resize(count);
+            }
+            names = kernelNames.emplace(hModule, std::move(driverNames)).first;
+        }
+
+        auto count = static_cast<uint32_t>(names->second.size());
+        if (*pCount == 0 || !pNames) {
+            *pCount = count;
+            return ZE_RESULT_SUCCESS;
+        }
+        *pCount = std::min(*pCount, count);
+        std::copy_n(names->second.begin(), *pCount, pNames);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ze_result_t KernelCache::zeKernelCreate( ze_module_handle_t hModule, const ze_kernel_desc_t* desc, ze_kernel_handle_t* phKernel )
+    {
+        if (!desc || !phKernel || desc->pNext || !desc->pKernelName)
+            return driver.Kernel.pfnCreate(hModule, desc, phKernel);
+
+        key_t key = {hModule, desc->flags, desc->pKernelName};
+        std::lock_guard<std::mutex> lock(mutex);
+        if (shareKernels) {
+            auto shared = kernelsByKey.find(key);
+            if (shared != kernelsByKey.end()) {
+                ++kernels[shared->second].references;
+                *phKernel = shared->second;
+                return ZE_RESULT_SUCCESS;
+            }
+        }
+
+        // Creating under the lock keeps two threads from creating the
+        // same kernel twice.
+        auto result = driver.Kernel.pfnCreate(hModule, desc, phKernel);
+        if (result == ZE_RESULT_SUCCESS) {
+            if (shareKernels)
+                kernelsByKey[key] = *phKernel;
+            kernels[*phKernel].key = std::move(key);
+        }
+        return result;
+    }
+
+    ze_result_t KernelCache::zeKernelDestroy( ze_kernel_handle_t hKernel )
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto kernel = kernels.find(hKernel);
+            if (kernel != kernels.end()) {
+                if (--kernel->second.references > 0)
+                    return ZE_RESULT_SUCCESS;
+                if (shareKernels)
+                    kernelsByKey.erase(kernel->second.key);
+                kernels.erase(kernel);
+            }
+        }
+        return driver.Kernel.pfnDestroy(hKernel);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ze_result_t KernelCache::zeKernelGetProperties( ze_kernel_handle_t hKernel, ze_kernel_properties_t* pKernelProperties )
+    {
+        if (!pKernelProperties || pKernelProperties->pNext)
+            return driver.Kernel.pfnGetProperties(hKernel, pKernelProperties);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto kernel = kernels.find(hKernel);
+        if (kernel == kernels.end())
+            return driver.Kernel.pfnGetProperties(hKernel, pKernelProperties);
+
+        auto &properties = kernel->second.properties;
+        if (!properties) {
+            auto result = driver.Kernel.pfnGetProperties(hKernel, pKernelProperties);
+            if (result == ZE_RESULT_SUCCESS)
+                properties = std::make_unique<ze_kernel_properties_t>(*pKernelProperties);
+            return result;
+        }
+        auto stype = pKernelProperties->stype;
+        *pKernelProperties = *properties;
+        pKernelProperties->stype = stype;
+        pKernelProperties->pNext = nullptr;
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t KernelCache::zeKernelGetName( ze_kernel_handle_t hKernel, size_t* pSize, char* pName )
+    {
+        if (!pSize)
+            return driver.Kernel.pfnGetName(hKernel, pSize, pName);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto kernel = kernels.find(hKernel);
+        if (kernel == kernels.end())
+            return driver.Kernel.pfnGetName(hKernel, pSize, pName);
+
+        auto &name = kernel->second.key.name;
+        auto size = name.size() + 1;
+        // Too small a buffer gets the answer of the driver.
+        if (pName && *pSize && *pSize < size)
+            return driver.Kernel.pfnGetName(hKernel, pSize, pName);
+        if (pName && *pSize)
+            memcpy(pName, name.c_str(), size);
+        *pSize = size;
+        return ZE_RESULT_SUCCESS;
+    }
+
+} // namespace optimization_layer
@@ -0,0 +1,80 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#pragma once
+
+#include "ze_ddi.h"
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace optimization_layer
+{
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Answers the queries whose results cannot change from the first answer
+    // of the driver:
+    //   - zeKernelGetProperties without a pNext chain
+    //   - zeKernelGetName
+    //   - zeModuleGetKernelNames
+    // With ZE_KERNEL_CACHE_SHARE_KERNELS, it also shares one kernel between
+    // the creates of the same kernel name on the same module. A shared
+    // kernel counts its creates and is destroyed in the driver with its last
+    // reference. This is not transparent: the creates also share the
+    // arguments, group size and other state set on the kernel, so a create
+    // sees the state another one set, and the state it sets changes the
+    // launches of the others.
+    class KernelCache {
+    public:
+        // The driver table is filled when the layer is chained, after
+        // the cache is created.
+        explicit KernelCache(const ze_dditable_t &driver);
+        ~KernelCache();
+
+        ze_result_t zeModuleDestroy( ze_module_handle_t hModule );
+        ze_result_t zeModuleGetKernelNames( ze_module_handle_t hModule, uint32_t* pCount, const char** pNames );
+        ze_result_t zeKernelCreate( ze_module_handle_t hModule, const ze_kernel_desc_t* desc, ze_kernel_handle_t* phKernel );
+        ze_result_t zeKernelDestroy( ze_kernel_handle_t hKernel );
+        ze_result_t zeKernelGetProperties( ze_kernel_handle_t hKernel, ze_kernel_properties_t* pKernelProperties );
+        ze_result_t zeKernelGetName( ze_kernel_handle_t hKernel, size_t* pSize, char* pName );
+
+    private:
+        struct key_t {
+            ze_module_handle_t module;
+            ze_kernel_flags_t flags;
+            std::string name;
+
+            bool operator<(const key_t &other) const
+            {
+                return std::tie(module, flags, name) < std::tie(other.module, other.flags, other.name);
+            }
+        };
+
+        struct kernel_t {
+            key_t key;
+            uint32_t references = 1;
+            std::unique_ptr<ze_kernel_properties_t> properties;
+        };
+
+        const ze_dditable_t &driver;
+        bool shareKernels = false;
+
+        std::mutex mutex;
+        // Kernels shared by later creates.
+        std::map<key_t, ze_kernel_handle_t> kernelsByKey;
+        // Kernels created through the cache.
+        std::unordered_map<ze_kernel_handle_t, kernel_t> kernels;
+        // Names returned by the driver, owned by their module.
+        std::unordered_map<ze_module_handle_t, std::vector<const char *>> kernelNames;
+    };
+
+} // namespace optimization_layer
@@ -0,0 +1,134 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include "kernel_state_filter.h"
+#include <cstring>
+
+namespace optimization_layer
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    KernelStateFilter::KernelStateFilter(const ze_dditable_t &driver) : driver(driver) {}
+
+    KernelStateFilter::~KernelStateFilter() {}
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Launch state is set on the same kernel several times in a row, so the
+    // last shadow a thread used is looked up without the lock.
+    KernelStateFilter::shadow_t &KernelStateFilter::shadowOf( ze_kernel_handle_t hKernel )
+    {
+        struct last_t {
+            const KernelStateFilter *filter;
+            ze_kernel_handle_t kernel;
+            uint64_t generation;
+            shadow_t *shadow;
+        };
+        static thread_local last_t last = {};
+
+        auto current = generation.load(std::memory_order_acquire);
+        if (last.filter == this && last.kernel == hKernel && last.generation == current)
+            return *last.shadow;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        last = {this, hKernel, current, &shadows[hKernel]};
+        return *last.shadow;
+    }
+
+    void KernelStateFilter::releaseKernel( ze_kernel_handle_t hKernel )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (shadows.erase(hKernel))
+            generation.fetch_add(1, std::memory_order_release);
+    }
+
+    // Called before the driver releases anything, so no new allocation or
+    // handle can be set as an argument under the previous generation.
+    void KernelStateFilter::releaseArguments()
+    {
+        argumentsGeneration.fetch_add(1, std::memory_order_release);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ze_result_t KernelStateFilter::zeKernelSetGroupSize( ze_kernel_handle_t hKernel, uint32_t groupSizeX, uint32_t groupSizeY, uint32_t groupSizeZ )
+    {
+        auto &groupSize = shadowOf(hKernel).groupSize;
+        if (groupSize.is(groupSizeX, groupSizeY, groupSizeZ))
+            return ZE_RESULT_SUCCESS;
+
+        groupSize.set = false;
+        auto result = driver.Kernel.pfnSetGroupSize(hKernel, groupSizeX, groupSizeY, groupSizeZ);
+        if (result == ZE_RESULT_SUCCESS)
+            groupSize = {true, groupSizeX, groupSizeY, groupSizeZ};
+        return result;
+    }
+
+    // Arguments set without a value, such as the size of local memory, are
+    // compared on their size alone.
+    ze_result_t KernelStateFilter::zeKernelSetArgumentValue( ze_kernel_handle_t hKernel, uint32_t argIndex, size_t argSize, const void* pArgValue )
+    {
+        auto &shadow = shadowOf(hKernel);
+        auto current = argumentsGeneration.load(std::memory_order_acquire);
+        if (shadow.argumentsGeneration != current) {
+            shadow.arguments.clear();
+            shadow.argumentsGeneration = current;
+        }
+
+        auto &arguments = shadow.arguments;
+        if (argIndex < arguments.size()) {
+            auto &argument = arguments[argIndex];
+            if (argument.set && argument.value.size() == argSize && argument.null == (pArgValue == nullptr) &&
+                (!pArgValue || memcmp(argument.value.data(), pArgValue, argSize) == 0))
+                return ZE_RESULT_SUCCESS;
+            argument.set = false;
+        }
+
+        auto result = driver.Kernel.pfnSetArgumentValue(hKernel, argIndex, argSize, pArgValue);
+        if (result != ZE_RESULT_SUCCESS)
+            return result;
+
+        if (argIndex >= arguments.size())
+            arguments.resize(argIndex + 1);
+        auto &argument = arguments[argIndex];
+        argument.set = true;
+        argument.null = pArgValue == nullptr;
+        if (pArgValue) {
+            auto bytes = static_cast<const uint8_t *>(pArgValue);
+            argument.value.assign(bytes, bytes + argSize);
+        } else {
+            argument.value.resize(argSize);
+        }
+        return result;
+    }
+
+    ze_result_t KernelStateFilter::zeKernelSetIndirectAccess( ze_kernel_handle_t hKernel, ze_kernel_indirect_access_flags_t flags )
+    {
+        auto &shadow = shadowOf(hKernel);
+        if (shadow.indirectAccessSet && shadow.indirectAccess == flags)
+            return ZE_RESULT_SUCCESS;
+
+        shadow.indirectAccessSet = false;
+        auto result = driver.Kernel.pfnSetIndirectAccess(hKernel, flags);
+        if (result == ZE_RESULT_SUCCESS) {
+            shadow.indirectAccessSet = true;
+            shadow.indirectAccess = flags;
+        }
+        return result;
+    }
+
+    ze_result_t KernelStateFilter::zeKernelSetGlobalOffsetExp( ze_kernel_handle_t hKernel, uint32_t offsetX, uint32_t offsetY, uint32_t offsetZ )
+    {
+        auto &globalOffset = shadowOf(hKernel).globalOffset;
+        if (globalOffset.is(offsetX, offsetY, offsetZ))
+            return ZE_RESULT_SUCCESS;
+
+        globalOffset.set = false;
+        auto result = driver.KernelExp.pfnSetGlobalOffsetExp(hKernel, offsetX, offsetY, offsetZ);
+        if (result == ZE_RESULT_SUCCESS)
+            globalOffset = {true, offsetX, offsetY, offsetZ};
+        return result;
+    }
+
+} // namespace optimization_layer
@@ -0,0 +1,96 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#pragma once
+
+#include "ze_ddi.h"
+#include <cstddef>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace optimization_layer
+{
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Keeps a shadow of the launch state set on every kernel, and drops the
+    // calls that set it to the value it already has:
+    //   - zeKernelSetArgumentValue
+    //   - zeKernelSetGroupSize
+    //   - zeKernelSetGlobalOffsetExp
+    //   - zeKernelSetIndirectAccess
+    // The shadow only records values the driver accepted, and is forgotten
+    // when the kernel is destroyed. Arguments are forgotten on every kernel
+    // when memory, a mapping, an image or a sampler is released, as a new
+    // one may get the same address or handle. The specification does not
+    // allow these calls on one kernel from simultaneous threads, so the
+    // shadow of a kernel is only locked while it is looked up, and every
+    // thread remembers the last shadow it used until a kernel is destroyed.
+    class KernelStateFilter {
+    public:
+        // The driver table is filled when the layer is chained, after
+        // the filter is created.
+        explicit KernelStateFilter(const ze_dditable_t &driver);
+        ~KernelStateFilter();
+
+        ze_result_t zeKernelSetGroupSize( ze_kernel_handle_t hKernel, uint32_t groupSizeX, uint32_t groupSizeY, uint32_t groupSizeZ );
+        ze_result_t zeKernelSetArgumentValue( ze_kernel_handle_t hKernel, uint32_t argIndex, size_t argSize, const void* pArgValue );
+        ze_result_t zeKernelSetIndirectAccess( ze_kernel_handle_t hKernel, ze_kernel_indirect_access_flags_t flags );
+        ze_result_t zeKernelSetGlobalOffsetExp( ze_kernel_handle_t hKernel, uint32_t offsetX, uint32_t offsetY, uint32_t offsetZ );
+
+        // Forgets the shadow of a kernel before it is destroyed.
+        void releaseKernel( ze_kernel_handle_t hKernel );
+        // Forgets the arguments of every kernel before memory, an image or
+        // a sampler is released.
+        void releaseArguments();
+
+    private:
+        struct argument_t {
+            bool set = false;
+            bool null = false;
+            std::vector<uint8_t> value;
+        };
+
+        struct dimensions_t {
+            bool set = false;
+            uint32_t x, y, z;
+
+            bool is(uint32_t x, uint32_t y, uint32_t z) const
+            {
+                return set && this->x == x && this->y == y && this->z == z;
+            }
+        };
+
+        struct shadow_t {
+            // The releases of arguments when they were last set.
+            uint64_t argumentsGeneration = 0;
+            std::vector<argument_t> arguments;
+            dimensions_t groupSize;
+            dimensions_t globalOffset;
+            bool indirectAccessSet = false;
+            ze_kernel_indirect_access_flags_t indirectAccess;
+        };
+
+        shadow_t &shadowOf(ze_kernel_handle_t hKernel);
+
+        const ze_dditable_t &driver;
+
+        std::mutex mutex;
+        // The elements of an unordered_map do not move, so a shadow can be
+        // used after the lock is released.
+        std::unordered_map<ze_kernel_handle_t, shadow_t> shadows;
+        // Counts the kernels destroyed, which invalidates the shadows
+        // remembered by threads.
+        std::atomic<uint64_t> generation{0};
+        // Counts the releases of memory, images and samplers; a shadow
+        // whose arguments were set before clears them on its next use.
+        std::atomic<uint64_t> argumentsGeneration{0};
+    };
+
+} // namespace optimization_layer
@@ -0,0 +1,441 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include "module_cache.h"
+#include "ze_util.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+#if defined(_WIN32)
+#include <direct.h>
+#include <process.h>
+#include <sys/utime.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utime.h>
+#endif
+
+namespace optimization_layer
+{
+    namespace
+    {
+        // Bumped when the hash input or the entry layout changes.
+        constexpr uint32_t cacheVersion = 1;
+        constexpr char entryMagic[8] = {'Z', 'E', 'M', 'O', 'D', 'B', 'I', 'N'};
+        constexpr char entrySuffix[] = ".zebin";
+
+#if defined(_WIN32)
+        constexpr char pathSeparator = '\\';
+#else
+        constexpr char pathSeparator = '/';
+#endif
+
+        struct entry_header_t {
+            char magic[8];
+            uint32_t version;
+            uint32_t reserved;
+            uint64_t inputSize;
+            uint64_t fnv;
+            uint64_t mix;
+            uint64_t binarySize;
+        };
+
+        struct file_t {
+            std::string path;
+            uint64_t size;
+            time_t lastUse;
+        };
+
+        std::string defaultDirectory()
+        {
+#if defined(_WIN32)
+            auto base = getenv_string("LOCALAPPDATA");
+#else
+            auto base = getenv_string("XDG_CACHE_HOME");
+            if (base.empty()) {
+                base = getenv_string("HOME");
+                if (!base.empty())
+                    base += "/.cache";
+            }
+#endif
+            if (base.empty())
+                return "";
+            return base + pathSeparator + "level_zero_module_cache";
+        }
+
+        // Creates the directory and its missing parents.
+        bool makeDirectory(const std::string &path)
+        {
+            for (size_t end = path.find_first_of("/\\", 1);; end = path.find_first_of("/\\", end + 1)) {
+                auto part = path.substr(0, end);
+#if defined(_WIN32)
+                _mkdir(part.c_str());
+#else
+                mkdir(part.c_str(), 0700);
+#endif
+                if (end == std::string::npos)
+                    break;
+            }
+#if defined(_WIN32)
+            DWORD attributes = GetFileAttributesA(path.c_str());
+            return attributes != INVALID_FILE_ATTRIBUTES && (attributes & FILE_ATTRIBUTE_DIRECTORY);
+#else
+            struct stat status;
+            return stat(path.c_str(), &status) == 0 && S_ISDIR(status.st_mode);
+#endif
+        }
+
+        std::vector<file_t> listEntries(const std::string &directory)
+        {
+            std::vector<file_t> files;
+#if defined(_WIN32)
+            WIN32_FIND_DATAA data;
+            HANDLE find = FindFirstFileA((directory + "\\*" + entrySuffix).c_str(), &data);
+            if (find == INVALID_HANDLE_VALUE)
+                return files;
+            do {
+                ULARGE_INTEGER lastUse;
+                lastUse.LowPart = data.ftLastWriteTime.dwLowDateTime;
+                lastUse.HighPart = data.ftLastWriteTime.dwHighDateTime;
+                files.push_back({directory + pathSeparator + data.cFileName,
+                                 (uint64_t(data.nFileSizeHigh) << 32) | data.nFileSizeLow,
+                                 static_cast<time_t>(lastUse.QuadPart / 10000000)});
+            } while (FindNextFileA(find, &data));
+            FindClose(find);
+#else
+            DIR *dir = opendir(directory.c_str());
+            if (!dir)
+                return files;
+            auto suffixLength = strlen(entrySuffix);
+            while (auto entry = readdir(dir)) {
+                std::string name = entry->d_name;
+                if (name.size() <= suffixLength || name.compare(name.size() - suffixLength, suffixLength, entrySuffix))
+                    continue;
+                auto path = directory + pathSeparator + name;
+                struct stat status;
+                if (stat(path.c_str(), &status) == 0)
+                    files.push_back({path, static_cast<uint64_t>(status.st_size), status.st_mtime});
+            }
+            closedir(dir);
+#endif
+            return files;
+        }
+
+        // Marks an entry as used, for the eviction order.
+        void touch(const std::string &path)
+        {
+#if defined(_WIN32)
+            _utime(path.c_str(), nullptr);
+#else
+            utime(path.c_str(), nullptr);
+#endif
+        }
+
+        bool replaceFile(const std::string &from, const std::string &to)
+        {
+#if defined(_WIN32)
+            return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+            return rename(from.c_str(), to.c_str()) == 0;
+#endif
+        }
+
+        std::string temporaryPath(const std::string &path)
+        {
+            static std::atomic<uint32_t> counter{0};
+#if defined(_WIN32)
+            auto pid = _getpid();
+#else
+            auto pid = getpid();
+#endif
+            return path + ".tmp." + std::to_string(pid) + "." + std::to_string(counter++);
+        }
+
+        // Sizes in bytes of the specialization constants of a SPIR-V module,
+        // by constant id. Returns false if the module cannot be parsed.
+        bool specConstantSizes(const uint8_t *module, size_t size, std::unordered_map<uint32_t, uint32_t> &sizes)
+        {
+            constexpr uint32_t spirvMagic = 0x07230203;
+            constexpr uint32_t opTypeBool = 20, opTypeInt = 21, opTypeFloat = 22;
+            constexpr uint32_t opSpecConstantTrue = 48, opSpecConstantFalse = 49, opSpecConstant = 50;
+            constexpr uint32_t opDecorate = 71, decorationSpecId = 1;
+
+            if (size % 4 || size < 20)
+                return false;
+            std::vector<uint32_t> words(size / 4);
+            memcpy(words.data(), module, size);
+            if (words[0] != spirvMagic)
+                return false;
+
+            std::unordered_map<uint32_t, uint32_t> typeSizes;
+            std::unordered_map<uint32_t, uint32_t> constantTypes;
+            std::unordered_map<uint32_t, uint32_t> specIds;
+            for (size_t i = 5; i < words.size();) {
+                uint32_t count = words[i] >> 16;
+                uint32_t opcode = words[i] & 0xffff;
+                if (count == 0 || i + count > words.size())
+                    return false;
+                const uint32_t *operands = &words[i + 1];
+                if (opcode == opTypeBool && count >= 2)
+                    typeSizes[operands[0]] = 1;
+                else if ((opcode == opTypeInt || opcode == opTypeFloat) && count >= 3)
+                    typeSizes[operands[0]] = operands[1] / 8;
+                else if ((opcode == opSpecConstantTrue || opcode == opSpecConstantFalse || opcode == opSpecConstant) &&
+                         count >= 3)
+                    constantTypes[operands[1]] = operands[0];
+                else if (opcode == opDecorate && count >= 4 && operands[1] == decorationSpecId)
+                    specIds[operands[0]] = operands[2];
+                i += count;
+            }
+
+            for (auto &specId : specIds) {
+                auto type = constantTypes.find(specId.first);
+                if (type == constantTypes.end())
+                    continue;
+                auto typeSize = typeSizes.find(type->second);
+                if (typeSize != typeSizes.end())
+                    sizes[specId.second] = typeSize->second;
+            }
+            return true;
+        }
+    } // namespace
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void ModuleCache::hash_t::add(const void *data, size_t size)
+    {
+        auto bytes = static_cast<const uint8_t *>(data);
+        for (size_t i = 0; i < size; ++i) {
+            fnv = (fnv ^ bytes[i]) * 0x100000001b3ull;
+            mix = ((mix << 5) | (mix >> 59)) ^ bytes[i];
+            mix *= 0xff51afd7ed558ccdull;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ModuleCache::ModuleCache(const ze_dditable_t &driver) : driver(driver)
+    {
+        directory = getenv_string("ZE_MODULE_CACHE_DIR");
+        if (directory.empty())
+            directory = defaultDirectory();
+        maxSize = getenv_tosize("ZE_MODULE_CACHE_MAX_SIZE", maxSize);
+        if (!directory.empty() && !makeDirectory(directory))
+            directory.clear();
+    }
+
+    ModuleCache::~ModuleCache() {}
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ze_result_t ModuleCache::zeContextCreate( ze_driver_handle_t hDriver, const ze_context_desc_t* desc, ze_context_handle_t* phContext )
+    {
+        auto result = driver.Context.pfnCreate(hDriver, desc, phContext);
+        if (result == ZE_RESULT_SUCCESS) {
+            std::lock_guard<std::mutex> lock(mutex);
+            contextDrivers[*phContext] = hDriver;
+        }
+        return result;
+    }
+
+    ze_result_t ModuleCache::zeContextCreateEx( ze_driver_handle_t hDriver, const ze_context_desc_t* desc, uint32_t numDevices, ze_device_handle_t* phDevices, ze_context_handle_t* phContext )
+    {
+        auto result = driver.Context.pfnCreateEx(hDriver, desc, numDevices, phDevices, phContext);
+        if (result == ZE_RESULT_SUCCESS) {
+            std::lock_guard<std::mutex> lock(mutex);
+            contextDrivers[*phContext] = hDriver;
+        }
+        return result;
+    }
+
+    void ModuleCache::releaseContext( ze_context_handle_t hContext )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        contextDrivers.erase(hContext);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ze_result_t ModuleCache::zeModuleCreate( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_module_desc_t* desc, ze_module_handle_t* phModule, ze_module_build_log_handle_t* phBuildLog )
+    {
+        hash_t hash;
+        if (directory.empty() || !desc || !phModule || desc->pNext || desc->format != ZE_MODULE_FORMAT_IL_SPIRV ||
+            !desc->pInputModule || !hashModule(hContext, hDevice, desc, hash))
+            return driver.Module.pfnCreate(hContext, hDevice, desc, phModule, phBuildLog);
+
+        auto path = pathFor(hash);
+        std::vector<uint8_t> binary;
+        if (load(path, hash, desc->inputSize, binary)) {
+            ze_module_desc_t native = *desc;
+            native.format = ZE_MODULE_FORMAT_NATIVE;
+            native.inputSize = binary.size();
+            native.pInputModule = binary.data();
+            native.pConstants = nullptr;
+            if (driver.Module.pfnCreate(hContext, hDevice, &native, phModule, phBuildLog) == ZE_RESULT_SUCCESS) {
+                touch(path);
+                return ZE_RESULT_SUCCESS;
+            }
+            // The driver refused the binary; build the module and replace it.
+            if (phBuildLog && *phBuildLog)
+                driver.ModuleBuildLog.pfnDestroy(*phBuildLog);
+        }
+
+        auto result = driver.Module.pfnCreate(hContext, hDevice, desc, phModule, phBuildLog);
+        if (result == ZE_RESULT_SUCCESS)
+            store(path, hash, desc->inputSize, *phModule);
+        return result;
+    }
+
+    // The hash covers everything the driver builds the module from.
+    bool ModuleCache::hashModule(ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_module_desc_t *desc,
+                                 hash_t &hash)
+    {
+        ze_device_properties_t deviceProperties;
+        ze_driver_properties_t driverProperties;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto context = contextDrivers.find(hContext);
+            if (context == contextDrivers.end())
+                return false;
+            auto hDriver = context->second;
+
+            auto device = devices.find(hDevice);
+            if (device == devices.end()) {
+                ze_device_properties_t properties = {};
+                properties.stype = ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES;
+                if (driver.Device.pfnGetProperties(hDevice, &properties) != ZE_RESULT_SUCCESS)
+                    return false;
+                device = devices.emplace(hDevice, properties).first;
+            }
+            deviceProperties = device->second;
+
+            auto driverIt = drivers.find(hDriver);
+            if (driverIt == drivers.end()) {
+                ze_driver_properties_t properties = {};
+                properties.stype = ZE_STRUCTURE_TYPE_DRIVER_PROPERTIES;
+                if (driver.Driver.pfnGetProperties(hDriver, &properties) != ZE_RESULT_SUCCESS)
+                    return false;
+                driverIt = drivers.emplace(hDriver, properties).first;
+            }
+            driverProperties = driverIt->second;
+        }
+
+        std::unordered_map<uint32_t, uint32_t> constantSizes;
+        auto numConstants = desc->pConstants ? desc->pConstants->numConstants : 0;
+        if (numConstants) {
+            if (!desc->pConstants->pConstantIds || !desc->pConstants->pConstantValues ||
+                !specConstantSizes(desc->pInputModule, desc->inputSize, constantSizes))
+                return false;
+        }
+
+        hash.add(cacheVersion);
+        hash.add(driverProperties.uuid);
+        hash.add(driverProperties.driverVersion);
+        hash.add(deviceProperties.uuid);
+        hash.add(deviceProperties.vendorId);
+        hash.add(deviceProperties.deviceId);
+        hash.add(desc->format);
+        hash.add(desc->inputSize);
+        hash.add(desc->pInputModule, desc->inputSize);
+        const char *flags = desc->pBuildFlags ? desc->pBuildFlags : "";
+        hash.add(flags, strlen(flags) + 1);
+        hash.add(numConstants);
+        for (uint32_t i = 0; i < numConstants; ++i) {
+            auto id = desc->pConstants->pConstantIds[i];
+            auto size = constantSizes.find(id);
+            // The driver reads as many bytes as the constant's type holds.
+            if (size == constantSizes.end() || !desc->pConstants->pConstantValues[i])
+                return false;
+            hash.add(id);
+            hash.add(desc->pConstants->pConstantValues[i], size->second);
+        }
+        return true;
+    }
+
+    std::string ModuleCache::pathFor(const hash_t &hash) const
+    {
+        char name[33];
+        snprintf(name, sizeof(name), "%016llx%016llx", static_cast<unsigned long long>(hash.fnv),
+                 static_cast<unsigned long long>(hash.mix));
+        return directory + pathSeparator + name + entrySuffix;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    bool ModuleCache::load(const std::string &path, const hash_t &hash, size_t inputSize, std::vector<uint8_t> &binary)
+    {
+        FILE *file = fopen(path.c_str(), "rb");
+        if (!file)
+            return false;
+        entry_header_t header;
+        bool valid = fread(&header, sizeof(header), 1, file) == 1 &&
+                     !memcmp(header.magic, entryMagic, sizeof(entryMagic)) && header.version == cacheVersion &&
+                     header.inputSize == inputSize && header.fnv == hash.fnv && header.mix == hash.mix &&
+                     header.binarySize > 0 && header.binarySize <= maxSize;
+        if (valid) {
+            binary.resize(static_cast<size_t>(header.binarySize));
+            valid = fread(binary.data(), 1, binary.size(), file) == binary.size() && fgetc(file) == EOF;
+        }
+        fclose(file);
+        return valid;
+    }
+
+    void ModuleCache::store(const std::string &path, const hash_t &hash, size_t inputSize, ze_module_handle_t hModule)
+    {
+        size_t size = 0;
+        if (driver.Module.pfnGetNativeBinary(hModule, &size, nullptr) != ZE_RESULT_SUCCESS || size == 0 ||
+            size > maxSize)
+            return;
+        std::vector<uint8_t> binary(size);
+        if (driver.Module.pfnGetNativeBinary(hModule, &size, binary.data()) != ZE_RESULT_SUCCESS)
+            return;
+
+        entry_header_t header = {};
+        memcpy(header.magic, entryMagic, sizeof(entryMagic));
+        header.version = cacheVersion;
+        header.inputSize = inputSize;
+        header.fnv = hash.fnv;
+        header.mix = hash.mix;
+        header.binarySize = size;
+
+        auto temporary = temporaryPath(path);
+        FILE *file = fopen(temporary.c_str(), "wb");
+        if (!file)
+            return;
+        bool written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                       fwrite(binary.data(), 1, size, file) == size;
+        written = fclose(file) == 0 && written;
+        if (!written || !replaceFile(temporary, path)) {
+            remove(temporary.c_str());
+            return;
+        }
+        evict();
+    }
+
+    // Removes the least recently used entries until the cache fits its
+    // limit. Other processes may be removing entries at the same time, so
+    // failures to remove are ignored.
+    void ModuleCache::evict()
+    {
+        auto files = listEntries(directory);
+        uint64_t total = 0;
+        for (auto &file : files)
+            total += file.size;
+        if (total <= maxSize)
+            return;
+
+        std::sort(files.begin(), files.end(),
+                  [](const file_t &a, const file_t &b) { return a.lastUse < b.lastUse; });
+        for (auto &file : files) {
+            if (total <= maxSize)
+                break;
+            remove(file.path.c_str());
+            total -= file.size;
+        }
+    }
+
+} // namespace optimization_layer
@@ -0,0 +1,73 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#pragma once
+
+#include "ze_ddi.h"
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace optimization_layer
+{
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Keeps the native binaries of modules built from SPIR-V in a directory,
+    // so later processes create the module from the binary instead of
+    // compiling the SPIR-V again. Entries are named after a hash of the
+    // SPIR-V, the build flags, the specialization constants, the device
+    // and the driver version, so a new driver or device misses the cache.
+    //
+    // Entries are written to a temporary file and renamed into place, so
+    // processes sharing the directory only see complete entries; an entry
+    // that does not match its name is ignored. Past the size limit, the
+    // least recently used entries are removed.
+    class ModuleCache {
+    public:
+        // The driver table is filled when the layer is chained, after
+        // the cache is created.
+        explicit ModuleCache(const ze_dditable_t &driver);
+        ~ModuleCache();
+
+        ze_result_t zeContextCreate( ze_driver_handle_t hDriver, const ze_context_desc_t* desc, ze_context_handle_t* phContext );
+        ze_result_t zeContextCreateEx( ze_driver_handle_t hDriver, const ze_context_desc_t* desc, uint32_t numDevices, ze_device_handle_t* phDevices, ze_context_handle_t* phContext );
+        ze_result_t zeModuleCreate( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_module_desc_t* desc, ze_module_handle_t* phModule, ze_module_build_log_handle_t* phBuildLog );
+
+        // Forgets the driver of a context before it is destroyed.
+        void releaseContext( ze_context_handle_t hContext );
+
+    private:
+        struct hash_t {
+            uint64_t fnv = 0xcbf29ce484222325ull;
+            uint64_t mix = 0x9e3779b97f4a7c15ull;
+
+            void add(const void *data, size_t size);
+            template <typename T>
+            void add(const T &value) { add(&value, sizeof(value)); }
+        };
+
+        bool hashModule(ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_module_desc_t *desc,
+                        hash_t &hash);
+        std::string pathFor(const hash_t &hash) const;
+        bool load(const std::string &path, const hash_t &hash, size_t inputSize, std::vector<uint8_t> &binary);
+        void store(const std::string &path, const hash_t &hash, size_t inputSize, ze_module_handle_t hModule);
+        void evict();
+
+        const ze_dditable_t &driver;
+        std::string directory;
+        size_t maxSize = size_t(1) << 30;
+
+        std::mutex mutex;
+        std::unordered_map<ze_context_handle_t, ze_driver_handle_t> contextDrivers;
+        // Identity of every device and driver seen, as it enters the hash.
+        std::unordered_map<ze_device_handle_t, ze_device_properties_t> devices;
+        std::unordered_map<ze_driver_handle_t, ze_driver_properties_t> drivers;
+    };
+
+} // namespace optimization_layer
@@ -0,0 +1,353 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include "usm_pool.h"
+#include "ze_util.h"
+
+namespace optimization_layer
+{
+    namespace
+    {
+        constexpr size_t minChunkSize = 64;
+
+        // Set in the ids of pooled allocations, so they do not collide with
+        // the ids the driver gives its own allocations.
+        constexpr uint64_t pooledIdBit = 1ull << 63;
+
+        bool isPowerOfTwo(size_t value) { return value && !(value & (value - 1)); }
+    } // namespace
+
+    ///////////////////////////////////////////////////////////////////////////////
+    UsmPool::UsmPool(const ze_dditable_t &driver) : driver(driver)
+    {
+        maxPooledSize = getenv_tosize("ZE_USM_POOL_MAX_SIZE", maxPooledSize);
+        slabSize = getenv_tosize("ZE_USM_POOL_SLAB_SIZE", slabSize);
+        maxFreeBytes = getenv_tosize("ZE_USM_POOL_MAX_FREE_BYTES", maxFreeBytes);
+    }
+
+    // Slabs still held are left to the driver: contexts may already be
+    // destroyed, and the driver may be unloaded before this layer.
+    UsmPool::~UsmPool() {}
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ze_result_t UsmPool::zeMemAllocShared( ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr )
+    {
+        key_t key = {hContext, hDevice, ZE_MEMORY_TYPE_SHARED, device_desc ? device_desc->flags : 0,
+                     device_desc ? device_desc->ordinal : 0, host_desc ? host_desc->flags : 0, 0};
+        if (!pptr || !device_desc || !host_desc || device_desc->pNext || host_desc->pNext ||
+            !chunkSizeFor(size, alignment, key.chunkSize))
+            return driver.Mem.pfnAllocShared(hContext, device_desc, host_desc, size, alignment, hDevice, pptr);
+        return allocate(key, device_desc, host_desc, size, pptr);
+    }
+
+    ze_result_t UsmPool::zeMemAllocDevice( ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr )
+    {
+        key_t key = {hContext, hDevice, ZE_MEMORY_TYPE_DEVICE, device_desc ? device_desc->flags : 0,
+                     device_desc ? device_desc->ordinal : 0, 0, 0};
+        if (!pptr || !device_desc || device_desc->pNext || !chunkSizeFor(size, alignment, key.chunkSize))
+            return driver.Mem.pfnAllocDevice(hContext, device_desc, size, alignment, hDevice, pptr);
+        return allocate(key, device_desc, nullptr, size, pptr);
+    }
+
+    ze_result_t UsmPool::zeMemAllocHost( ze_context_handle_t hContext, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, void** pptr )
+    {
+        key_t key = {hContext, nullptr, ZE_MEMORY_TYPE_HOST, 0, 0, host_desc ? host_desc->flags : 0, 0};
+        if (!pptr || !host_desc || host_desc->pNext || !chunkSizeFor(size, alignment, key.chunkSize))
+            return driver.Mem.pfnAllocHost(hContext, host_desc, size, alignment, pptr);
+        return allocate(key, nullptr, host_desc, size, pptr);
+    }
+
+    // The size class holds the size and is aligned to the alignment, since
+    // chunks are aligned to their size.
+    bool UsmPool::chunkSizeFor(size_t size, size_t alignment, size_t &chunkSize) const
+    {
+        if (size == 0 || size > maxPooledSize || (alignment && !isPowerOfTwo(alignment)))
+            return false;
+        chunkSize = minChunkSize;
+        while (chunkSize < size || chunkSize < alignment)
+            chunkSize <<= 1;
+        return chunkSize <= maxPooledSize;
+    }
+
+    // The driver allocates a slab outside the lock, so other allocations
+    // and frees are not held up behind it. Another thread may have filled
+    // the bucket meanwhile; the new slab is then returned to the driver.
+    ze_result_t UsmPool::allocate(const key_t &key, const ze_device_mem_alloc_desc_t *device_desc,
+                                  const ze_host_mem_alloc_desc_t *host_desc, size_t size, void **pptr)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto &bucket = buckets[key];
+            if (!bucket.freeChunks.empty()) {
+                *pptr = take(bucket, size);
+                return ZE_RESULT_SUCCESS;
+            }
+        }
+
+        std::unique_ptr<slab_t> slab;
+        auto result = allocateSlab(key, device_desc, host_desc, slab);
+        if (result != ZE_RESULT_SUCCESS)
+            return result;
+
+        void *unused = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto &bucket = buckets[key];
+            bucket.key = key;
+            if (bucket.freeChunks.empty())
+                publish(bucket, std::move(slab));
+            else
+                unused = slab->allocation;
+            *pptr = take(bucket, size);
+        }
+        if (unused)
+            driver.Mem.pfnFree(key.context, unused);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    void *UsmPool::take(bucket_t &bucket, size_t size)
+    {
+        auto chunk = bucket.freeChunks.back();
+        bucket.freeChunks.pop_back();
+        auto slab = findSlab(reinterpret_cast<void *>(chunk));
+        auto index = (chunk - slab->base) / bucket.key.chunkSize;
+        slab->sizes[index] = size;
+        slab->ids[index] = pooledIdBit | ++nextId;
+        if (slab->used++ == 0)
+            freeSlabBytes -= slab->bytes;
+        return reinterpret_cast<void *>(chunk);
+    }
+
+    // Slabs are requested aligned to the chunk size; drivers that do not
+    // honour the alignment get a slab one chunk larger to align inside.
+    ze_result_t UsmPool::allocateSlab(const key_t &key, const ze_device_mem_alloc_desc_t *device_desc,
+                                      const ze_host_mem_alloc_desc_t *host_desc, std::unique_ptr<slab_t> &slab)
+    {
+        auto bytes = slabSize > key.chunkSize ? slabSize - slabSize % key.chunkSize : key.chunkSize;
+
+        void *allocation = nullptr;
+        auto result = allocateFromDriver(key, device_desc, host_desc, bytes, key.chunkSize, &allocation);
+        if (result != ZE_RESULT_SUCCESS)
+            return result;
+        auto base = reinterpret_cast<uintptr_t>(allocation);
+        if (base % key.chunkSize) {
+            driver.Mem.pfnFree(key.context, allocation);
+            result = allocateFromDriver(key, device_desc, host_desc, bytes + key.chunkSize, 0, &allocation);
+            if (result != ZE_RESULT_SUCCESS)
+                return result;
+            base = (reinterpret_cast<uintptr_t>(allocation) + key.chunkSize - 1) & ~(uintptr_t(key.chunkSize) - 1);
+        }
+
+        slab.reset(new slab_t);
+        slab->bucket = nullptr;
+        slab->allocation = allocation;
+        slab->base = base;
+        slab->bytes = bytes;
+        slab->chunkCount = static_cast<uint32_t>(bytes / key.chunkSize);
+        slab->sizes.assign(slab->chunkCount, 0);
+        slab->ids.assign(slab->chunkCount, 0);
+        return ZE_RESULT_SUCCESS;
+    }
+
+    void UsmPool::publish(bucket_t &bucket, std::unique_ptr<slab_t> slab)
+    {
+        slab->bucket = &bucket;
+        // Lowest addresses are handed out first.
+        for (auto i = slab->chunkCount; i-- > 0;)
+            bucket.freeChunks.push_back(slab->base + i * bucket.key.chunkSize);
+        freeSlabBytes += slab->bytes;
+        slabs[slab->base] = std::move(slab);
+    }
+
+    ze_result_t UsmPool::allocateFromDriver(const key_t &key, const ze_device_mem_alloc_desc_t *device_desc,
+                                            const ze_host_mem_alloc_desc_t *host_desc, size_t size, size_t alignment,
+                                            void **pptr)
+    {
+        switch (key.type) {
+        case ZE_MEMORY_TYPE_SHARED:
+            return driver.Mem.pfnAllocShared(key.context, device_desc, host_desc, size, alignment, key.device, pptr);
+        case ZE_MEMORY_TYPE_DEVICE:
+            return driver.Mem.pfnAllocDevice(key.context, device_desc, size, alignment, key.device, pptr);
+        default:
+            return driver.Mem.pfnAllocHost(key.context, host_desc, size, alignment, pptr);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    UsmPool::slab_t *UsmPool::findSlab(const void *ptr)
+    {
+        auto address = reinterpret_cast<uintptr_t>(ptr);
+        auto it = slabs.upper_bound(address);
+        if (it == slabs.begin())
+            return nullptr;
+        auto slab = (--it)->second.get();
+        return address < slab->base + slab->bytes ? slab : nullptr;
+    }
+
+    // Returns the driver allocation of the slab if it was trimmed, for the
+    // caller to free outside the lock.
+    void *UsmPool::release(slab_t *slab, uintptr_t chunk)
+    {
+        auto &bucket = *slab->bucket;
+        auto index = (chunk - slab->base) / bucket.key.chunkSize;
+        slab->sizes[index] = 0;
+        slab->ids[index] = 0;
+        bucket.freeChunks.push_back(chunk);
+        if (--slab->used != 0)
+            return nullptr;
+
+        freeSlabBytes += slab->bytes;
+        if (freeSlabBytes <= maxFreeBytes)
+            return nullptr;
+
+        auto end = slab->base + slab->bytes;
+        auto &chunks = bucket.freeChunks;
+        size_t kept = 0;
+        for (auto free : chunks)
+            if (free < slab->base || free >= end)
+                chunks[kept++] = free;
+        chunks.resize(kept);
+        freeSlabBytes -= slab->bytes;
+        auto allocation = slab->allocation;
+        slabs.erase(slab->base);
+        return allocation;
+    }
+
+    ze_result_t UsmPool::zeMemFree( ze_context_handle_t hContext, void* ptr )
+    {
+        void *trimmed;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto slab = findSlab(ptr);
+            if (slab == nullptr || slab->bucket->key.context != hContext)
+                return driver.Mem.pfnFree(hContext, ptr);
+            auto chunk = reinterpret_cast<uintptr_t>(ptr);
+            auto offset = chunk - slab->base;
+            if (offset % slab->bucket->key.chunkSize || slab->sizes[offset / slab->bucket->key.chunkSize] == 0)
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+            trimmed = release(slab, chunk);
+        }
+        return trimmed ? driver.Mem.pfnFree(hContext, trimmed) : ZE_RESULT_SUCCESS;
+    }
+
+    // The free policies wait for the device to stop using the allocation,
+    // which the pool cannot see; a pooled chunk is reused like after
+    // zeMemFree, so it must no longer be in use.
+    ze_result_t UsmPool::zeMemFreeExt( ze_context_handle_t hContext, const ze_memory_free_ext_desc_t* pMemFreeDesc, void* ptr )
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto slab = findSlab(ptr);
+            if (slab == nullptr || slab->bucket->key.context != hContext) {
+                if (driver.Mem.pfnFreeExt == nullptr)
+                    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+                return driver.Mem.pfnFreeExt(hContext, pMemFreeDesc, ptr);
+            }
+        }
+        return zeMemFree(hContext, ptr);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // The driver is still asked for the slab, for the page size and any
+    // extension structures; the type, id and device are the chunk's.
+    ze_result_t UsmPool::zeMemGetAllocProperties( ze_context_handle_t hContext, const void* ptr, ze_memory_allocation_properties_t* pMemAllocProperties, ze_device_handle_t* phDevice )
+    {
+        void *allocation;
+        key_t key;
+        size_t size;
+        uint64_t id;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto slab = findSlab(ptr);
+            if (slab == nullptr || slab->bucket->key.context != hContext || pMemAllocProperties == nullptr)
+                return driver.Mem.pfnGetAllocProperties(hContext, ptr, pMemAllocProperties, phDevice);
+            key = slab->bucket->key;
+            auto offset = reinterpret_cast<uintptr_t>(ptr) - slab->base;
+            size = slab->sizes[offset / key.chunkSize];
+            id = slab->ids[offset / key.chunkSize];
+            if (offset % key.chunkSize >= size)
+                size = 0;
+            allocation = slab->allocation;
+        }
+
+        if (size == 0) {
+            pMemAllocProperties->type = ZE_MEMORY_TYPE_UNKNOWN;
+            pMemAllocProperties->id = 0;
+            pMemAllocProperties->pageSize = 0;
+            if (phDevice)
+                *phDevice = nullptr;
+            return ZE_RESULT_SUCCESS;
+        }
+        auto result = driver.Mem.pfnGetAllocProperties(hContext, allocation, pMemAllocProperties, phDevice);
+        if (result != ZE_RESULT_SUCCESS)
+            return result;
+        pMemAllocProperties->type = key.type;
+        pMemAllocProperties->id = id;
+        if (phDevice)
+            *phDevice = key.device;
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t UsmPool::zeMemGetAddressRange( ze_context_handle_t hContext, const void* ptr, void** pBase, size_t* pSize )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto slab = findSlab(ptr);
+        if (slab == nullptr || slab->bucket->key.context != hContext)
+            return driver.Mem.pfnGetAddressRange(hContext, ptr, pBase, pSize);
+        auto chunkSize = slab->bucket->key.chunkSize;
+        auto offset = reinterpret_cast<uintptr_t>(ptr) - slab->base;
+        auto size = slab->sizes[offset / chunkSize];
+        if (offset % chunkSize >= size)
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        if (pBase)
+            *pBase = reinterpret_cast<void *>(slab->base + offset - offset % chunkSize);
+        if (pSize)
+            *pSize = size;
+        return ZE_RESULT_SUCCESS;
+    }
+
+    // An IPC handle would export the whole slab, and the importer would map
+    // it at the slab's base rather than the chunk's.
+    ze_result_t UsmPool::zeMemGetIpcHandle( ze_context_handle_t hContext, const void* ptr, ze_ipc_mem_handle_t* pIpcHandle )
+    {
+        if (isPooled(hContext, ptr))
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        return driver.Mem.pfnGetIpcHandle(hContext, ptr, pIpcHandle);
+    }
+
+    bool UsmPool::isPooled( ze_context_handle_t hContext, const void* ptr )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto slab = findSlab(ptr);
+        return slab && slab->bucket->key.context == hContext;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void UsmPool::releaseContext( ze_context_handle_t hContext )
+    {
+        std::vector<void *> allocations;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (auto it = slabs.begin(); it != slabs.end();) {
+                auto &slab = *it->second;
+                if (slab.bucket->key.context != hContext) {
+                    ++it;
+                    continue;
+                }
+                if (slab.used == 0)
+                    freeSlabBytes -= slab.bytes;
+                allocations.push_back(slab.allocation);
+                it = slabs.erase(it);
+            }
+            for (auto it = buckets.begin(); it != buckets.end();)
+                it = it->first.context == hContext ? buckets.erase(it) : std::next(it);
+        }
+        for (auto allocation : allocations)
+            driver.Mem.pfnFree(hContext, allocation);
+    }
+
+} // namespace optimization_layer
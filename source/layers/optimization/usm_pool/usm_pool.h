@@ -0,0 +1,123 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#pragma once
+
+#include "ze_ddi.h"
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+namespace optimization_layer
+{
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Serves small USM allocations from slabs allocated from the driver, so
+    // allocating and freeing in a loop does not pay for a driver allocation
+    // each time. Allocations are rounded up to a power of two size class and
+    // pooled per context, device, memory type and allocation flags; every
+    // slab is carved into chunks of one class, aligned to the class size, so
+    // any alignment up to the class size is honoured. Allocations larger than
+    // the largest class, with a pNext chain, or with an invalid alignment are
+    // passed to the driver unchanged.
+    //
+    // Slabs left without allocations are kept for reuse until their total
+    // size passes the trim limit, and released when their context is
+    // destroyed. Pooled pointers are answered for by the pool in
+    // zeMemGetAllocProperties and zeMemGetAddressRange; they cannot be
+    // exported with zeMemGetIpcHandle.
+    class UsmPool {
+    public:
+        // The driver table is filled when the layer is chained, after
+        // the pool is created.
+        explicit UsmPool(const ze_dditable_t &driver);
+        ~UsmPool();
+
+        ze_result_t zeMemAllocShared( ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr );
+        ze_result_t zeMemAllocDevice( ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr );
+        ze_result_t zeMemAllocHost( ze_context_handle_t hContext, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, void** pptr );
+        ze_result_t zeMemFree( ze_context_handle_t hContext, void* ptr );
+        ze_result_t zeMemFreeExt( ze_context_handle_t hContext, const ze_memory_free_ext_desc_t* pMemFreeDesc, void* ptr );
+        ze_result_t zeMemGetAllocProperties( ze_context_handle_t hContext, const void* ptr, ze_memory_allocation_properties_t* pMemAllocProperties, ze_device_handle_t* phDevice );
+        ze_result_t zeMemGetAddressRange( ze_context_handle_t hContext, const void* ptr, void** pBase, size_t* pSize );
+        ze_result_t zeMemGetIpcHandle( ze_context_handle_t hContext, const void* ptr, ze_ipc_mem_handle_t* pIpcHandle );
+
+        // Whether a pointer was allocated from a slab of the pool.
+        bool isPooled( ze_context_handle_t hContext, const void* ptr );
+
+        // Returns the slabs of a context to the driver before it is destroyed.
+        void releaseContext( ze_context_handle_t hContext );
+
+    private:
+        struct key_t {
+            ze_context_handle_t context;
+            ze_device_handle_t device;
+            ze_memory_type_t type;
+            ze_device_mem_alloc_flags_t deviceFlags;
+            uint32_t ordinal;
+            ze_host_mem_alloc_flags_t hostFlags;
+            size_t chunkSize;
+
+            bool operator<(const key_t &other) const
+            {
+                return std::tie(context, device, type, deviceFlags, ordinal, hostFlags, chunkSize) <
+                       std::tie(other.context, other.device, other.type, other.deviceFlags, other.ordinal,
+                                other.hostFlags, other.chunkSize);
+            }
+        };
+
+        struct bucket_t;
+
+        struct slab_t {
+            bucket_t *bucket;
+            void *allocation;
+            uintptr_t base;
+            size_t bytes;
+            uint32_t chunkCount;
+            uint32_t used = 0;
+            // Requested size of every chunk, 0 for free chunks.
+            std::vector<size_t> sizes;
+            std::vector<uint64_t> ids;
+        };
+
+        struct bucket_t {
+            key_t key;
+            std::vector<uintptr_t> freeChunks;
+        };
+
+        ze_result_t allocate(const key_t &key, const ze_device_mem_alloc_desc_t *device_desc,
+                             const ze_host_mem_alloc_desc_t *host_desc, size_t size, void **pptr);
+        ze_result_t allocateSlab(const key_t &key, const ze_device_mem_alloc_desc_t *device_desc,
+                                 const ze_host_mem_alloc_desc_t *host_desc, std::unique_ptr<slab_t> &slab);
+        // Both called with the lock held.
+        void publish(bucket_t &bucket, std::unique_ptr<slab_t> slab);
+        void *take(bucket_t &bucket, size_t size);
+        ze_result_t allocateFromDriver(const key_t &key, const ze_device_mem_alloc_desc_t *device_desc,
+                                       const ze_host_mem_alloc_desc_t *host_desc, size_t size, size_t alignment,
+                                       void **pptr);
+        bool chunkSizeFor(size_t size, size_t alignment, size_t &chunkSize) const;
+        slab_t *findSlab(const void *ptr);
+        void *release(slab_t *slab, uintptr_t chunk);
+
+        const ze_dditable_t &driver;
+        size_t maxPooledSize = 1 << 20;
+        size_t slabSize = 2 << 20;
+        size_t maxFreeBytes = 32 << 20;
+
+        std::mutex mutex;
+        std::map<key_t, bucket_t> buckets;
+        // Slabs by the address of their first chunk.
+        std::map<uintptr_t, std::unique_ptr<slab_t>> slabs;
+        size_t freeSlabBytes = 0;
+        uint64_t nextId = 0;
+    };
+
+} // namespace optimization_layer
@@ -0,0 +1,2299 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file ze_optddi.cpp
+ *
+ */
+#include "ze_optimization_layer.h"
+
+namespace optimization_layer
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeDriverGetExtensionFunctionAddress
+    __zedlllocal ze_result_t ZE_APICALL
+    zeDriverGetExtensionFunctionAddress(
+        ze_driver_handle_t hDriver,                     ///< [in] handle of the driver instance
+        const char* name,                               ///< [in] extension function name
+        void** ppFunctionAddress                        ///< [out] pointer to function pointer
+        )
+    {
+        auto result = context.zeDdiTable.Driver.pfnGetExtensionFunctionAddress( hDriver, name, ppFunctionAddress );
+        if( ZE_RESULT_SUCCESS != result || nullptr == ppFunctionAddress || nullptr == *ppFunctionAddress )
+            return result;
+
+        // The commands an extension function appends bypass the layer.
+        if( context.enableCopyCoalescing )
+            context.copyCoalescer->stop();
+        if( context.enableBarrierPruning )
+            context.barrierPruner->stop();
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeContextCreate
+    __zedlllocal ze_result_t ZE_APICALL
+    zeContextCreate(
+        ze_driver_handle_t hDriver,                     ///< [in] handle of the driver object
+        const ze_context_desc_t* desc,                  ///< [in] pointer to context descriptor
+        ze_context_handle_t* phContext                  ///< [out] pointer to handle of context object created
+        )
+    {
+        return context.moduleCache->zeContextCreate( hDriver, desc, phContext );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeContextDestroy
+    __zedlllocal ze_result_t ZE_APICALL
+    zeContextDestroy(
+        ze_context_handle_t hContext                    ///< [in][release] handle of context object to destroy
+        )
+    {
+        if( context.enableUsmPool )
+            context.usmPool->releaseContext( hContext );
+        if( context.enableEventRecycling )
+            context.eventRecycler->releaseContext( hContext );
+        if( context.enableCommandListRecycling )
+            context.commandListRecycler->releaseContext( hContext );
+        if( context.enableModuleCache )
+            context.moduleCache->releaseContext( hContext );
+        if( context.enableIpcCache )
+            context.ipcCache->releaseContext( hContext );
+        return context.zeDdiTable.Context.pfnDestroy( hContext );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeContextCreateEx
+    __zedlllocal ze_result_t ZE_APICALL
+    zeContextCreateEx(
+        ze_driver_handle_t hDriver,                     ///< [in] handle of the driver object
+        const ze_context_desc_t* desc,                  ///< [in] pointer to context descriptor
+        uint32_t numDevices,                            ///< [in][optional] number of device handles; must be 0 if `nullptr ==
+                                                        ///< phDevices`
+        ze_device_handle_t* phDevices,                  ///< [in][optional][range(0, numDevices)] array of device handles which
+                                                        ///< context has visibility.
+                                                        ///< if nullptr, then all devices and any sub-devices supported by the
+                                                        ///< driver instance are
+                                                        ///< visible to the context.
+                                                        ///< otherwise, the context only has visibility to the devices and any
+                                                        ///< sub-devices of the
+                                                        ///< devices in this array.
+        ze_context_handle_t* phContext                  ///< [out] pointer to handle of context object created
+        )
+    {
+        return context.moduleCache->zeContextCreateEx( hDriver, desc, numDevices, phDevices, phContext );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandQueueDestroy
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandQueueDestroy(
+        ze_command_queue_handle_t hCommandQueue         ///< [in][release] handle of command queue object to destroy
+        )
+    {
+        return context.eventRecycler->zeCommandQueueDestroy( hCommandQueue );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListCreate
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListCreate(
+        ze_context_handle_t hContext,                   ///< [in] handle of the context object
+        ze_device_handle_t hDevice,                     ///< [in] handle of the device object
+        const ze_command_list_desc_t* desc,             ///< [in] pointer to command list descriptor
+        ze_command_list_handle_t* phCommandList         ///< [out] pointer to handle of command list object created
+        )
+    {
+        auto result = context.enableCommandListRecycling
+            ? context.commandListRecycler->zeCommandListCreate( hContext, hDevice, desc, phCommandList )
+            : context.zeDdiTable.CommandList.pfnCreate( hContext, hDevice, desc, phCommandList );
+        if( context.enableCopyCoalescing && ZE_RESULT_SUCCESS == result )
+            context.copyCoalescer->registerCommandList( *phCommandList, hContext, desc );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->registerCommandList( *phCommandList, desc );
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListCreateImmediate
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListCreateImmediate(
+        ze_context_handle_t hContext,                   ///< [in] handle of the context object
+        ze_device_handle_t hDevice,                     ///< [in] handle of the device object
+        const ze_command_queue_desc_t* altdesc,         ///< [in] pointer to command queue descriptor
+        ze_command_list_handle_t* phCommandList         ///< [out] pointer to handle of command list object created
+        )
+    {
+        auto result = context.enableCommandListRecycling
+            ? context.commandListRecycler->zeCommandListCreateImmediate( hContext, hDevice, altdesc, phCommandList )
+            : context.zeDdiTable.CommandList.pfnCreateImmediate( hContext, hDevice, altdesc, phCommandList );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->registerCommandList( *phCommandList, altdesc );
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListDestroy
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListDestroy(
+        ze_command_list_handle_t hCommandList           ///< [in][release] handle of command list object to destroy
+        )
+    {
+        if( context.enableCopyCoalescing )
+            context.copyCoalescer->releaseCommandList( hCommandList );
+        if( context.enableBarrierPruning )
+            context.barrierPruner->releaseCommandList( hCommandList );
+        if( context.enableCommandListRecycling )
+            return context.commandListRecycler->zeCommandListDestroy( hCommandList );
+        return context.zeDdiTable.CommandList.pfnDestroy( hCommandList );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListClose
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListClose(
+        ze_command_list_handle_t hCommandList           ///< [in] handle of command list object to close
+        )
+    {
+        auto result = context.copyCoalescer->flush( hCommandList );
+        if( ZE_RESULT_SUCCESS != result )
+            return result;
+        return context.zeDdiTable.CommandList.pfnClose( hCommandList );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListReset
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListReset(
+        ze_command_list_handle_t hCommandList           ///< [in] handle of command list object to reset
+        )
+    {
+        if( context.enableBarrierPruning )
+            context.barrierPruner->resetCommandList( hCommandList );
+        if( context.enableCopyCoalescing )
+            return context.copyCoalescer->zeCommandListReset( hCommandList );
+        return context.zeDdiTable.CommandList.pfnReset( hCommandList );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListAppendWriteGlobalTimestamp
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListAppendWriteGlobalTimestamp(
+        ze_command_list_handle_t hCommandList,          ///< [in] handle of the command list
+        uint64_t* dstptr,                               ///< [in,out] pointer to memory where timestamp value will be written; must
+                                                        ///< be 8byte-aligned.
+        ze_event_handle_t hSignalEvent,                 ///< [in][optional] handle of the event to signal on completion
+        uint32_t numWaitEvents,                         ///< [in][optional] number of events to wait on before executing query;
+                                                        ///< must be 0 if `nullptr == phWaitEvents`
+        ze_event_handle_t* phWaitEvents                 ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
+                                                        ///< on before executing query
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        if( context.enableBarrierPruning )
+            context.barrierPruner->pruneWaits( hCommandList, numWaitEvents, phWaitEvents );
+        auto result = context.zeDdiTable.CommandList.pfnAppendWriteGlobalTimestamp( hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->recordCommand( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListAppendBarrier
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListAppendBarrier(
+        ze_command_list_handle_t hCommandList,          ///< [in] handle of the command list
+        ze_event_handle_t hSignalEvent,                 ///< [in][optional] handle of the event to signal on completion
+        uint32_t numWaitEvents,                         ///< [in][optional] number of events to wait on before executing barrier;
+                                                        ///< must be 0 if `nullptr == phWaitEvents`
+        ze_event_handle_t* phWaitEvents                 ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
+                                                        ///< on before executing barrier
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        if( context.enableBarrierPruning )
+            return context.barrierPruner->zeCommandListAppendBarrier( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+        return context.zeDdiTable.CommandList.pfnAppendBarrier( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListAppendMemoryRangesBarrier
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListAppendMemoryRangesBarrier(
+        ze_command_list_handle_t hCommandList,          ///< [in] handle of the command list
+        uint32_t numRanges,                             ///< [in] number of memory ranges
+        const size_t* pRangeSizes,                      ///< [in][range(0, numRanges)] array of sizes of memory range
+        const void** pRanges,                           ///< [in][range(0, numRanges)] array of memory ranges
+        ze_event_handle_t hSignalEvent,                 ///< [in][optional] handle of the event to signal on completion
+        uint32_t numWaitEvents,                         ///< [in][optional] number of events to wait on before executing barrier;
+                                                        ///< must be 0 if `nullptr == phWaitEvents`
+        ze_event_handle_t* phWaitEvents                 ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
+                                                        ///< on before executing barrier
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        if( context.enableBarrierPruning )
+            context.barrierPruner->pruneWaits( hCommandList, numWaitEvents, phWaitEvents );
+        auto result = context.zeDdiTable.CommandList.pfnAppendMemoryRangesBarrier( hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->recordCommand( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListAppendMemoryCopy
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListAppendMemoryCopy(
+        ze_command_list_handle_t hCommandList,          ///< [in] handle of command list
+        void* dstptr,                                   ///< [in] pointer to destination memory to copy to
+        const void* srcptr,                             ///< [in] pointer to source memory to copy from
+        size_t size,                                    ///< [in] size in bytes to copy
+        ze_event_handle_t hSignalEvent,                 ///< [in][optional] handle of the event to signal on completion
+        uint32_t numWaitEvents,                         ///< [in][optional] number of events to wait on before launching; must be 0
+                                                        ///< if `nullptr == phWaitEvents`
+        ze_event_handle_t* phWaitEvents                 ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
+                                                        ///< on before launching
+        )
+    {
+        if( context.enableBarrierPruning )
+            context.barrierPruner->pruneWaits( hCommandList, numWaitEvents, phWaitEvents );
+        auto result = context.enableCopyCoalescing
+            ? context.copyCoalescer->zeCommandListAppendMemoryCopy( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents )
+            : context.zeDdiTable.CommandList.pfnAppendMemoryCopy( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->recordCommand( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListAppendMemoryFill
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListAppendMemoryFill(
+        ze_command_list_handle_t hCommandList,          ///< [in] handle of command list
+        void* ptr,                                      ///< [in] pointer to memory to initialize
+        const void* pattern,                            ///< [in] pointer to value to initialize memory to
+        size_t pattern_size,                            ///< [in] size in bytes of the value to initialize memory to
+        size_t size,                                    ///< [in] size in bytes to initialize
+        ze_event_handle_t hSignalEvent,                 ///< [in][optional] handle of the event to signal on completion
+        uint32_t numWaitEvents,                         ///< [in][optional] number of events to wait on before launching; must be 0
+                                                        ///< if `nullptr == phWaitEvents`
+        ze_event_handle_t* phWaitEvents                 ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
+                                                        ///< on before launching
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        if( context.enableBarrierPruning )
+            context.barrierPruner->pruneWaits( hCommandList, numWaitEvents, phWaitEvents );
+        auto result = context.zeDdiTable.CommandList.pfnAppendMemoryFill( hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->recordCommand( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListAppendMemoryCopyRegion
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListAppendMemoryCopyRegion(
+        ze_command_list_handle_t hCommandList,          ///< [in] handle of command list
+        void* dstptr,                                   ///< [in] pointer to destination memory to copy to
+        const ze_copy_region_t* dstRegion,              ///< [in] pointer to destination region to copy to
+        uint32_t dstPitch,                              ///< [in] destination pitch in bytes
+        uint32_t dstSlicePitch,                         ///< [in] destination slice pitch in bytes. This is required for 3D region
+                                                        ///< copies where the `depth` member of ::ze_copy_region_t is not 0,
+                                                        ///< otherwise it's ignored.
+        const void* srcptr,                             ///< [in] pointer to source memory to copy from
+        const ze_copy_region_t* srcRegion,              ///< [in] pointer to source region to copy from
+        uint32_t srcPitch,                              ///< [in] source pitch in bytes
+        uint32_t srcSlicePitch,                         ///< [in] source slice pitch in bytes. This is required for 3D region
+                                                        ///< copies where the `depth` member of ::ze_copy_region_t is not 0,
+                                                        ///< otherwise it's ignored.
+        ze_event_handle_t hSignalEvent,                 ///< [in][optional] handle of the event to signal on completion
+        uint32_t numWaitEvents,                         ///< [in][optional] number of events to wait on before launching; must be 0
+                                                        ///< if `nullptr == phWaitEvents`
+        ze_event_handle_t* phWaitEvents                 ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
+                                                        ///< on before launching
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        if( context.enableBarrierPruning )
+            context.barrierPruner->pruneWaits( hCommandList, numWaitEvents, phWaitEvents );
+        auto result = context.zeDdiTable.CommandList.pfnAppendMemoryCopyRegion( hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->recordCommand( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListAppendMemoryCopyFromContext
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListAppendMemoryCopyFromContext(
+        ze_command_list_handle_t hCommandList,          ///< [in] handle of command list
+        void* dstptr,                                   ///< [in] pointer to destination memory to copy to
+        ze_context_handle_t hContextSrc,                ///< [in] handle of source context object
+        const void* srcptr,                             ///< [in] pointer to source memory to copy from
+        size_t size,                                    ///< [in] size in bytes to copy
+        ze_event_handle_t hSignalEvent,                 ///< [in][optional] handle of the event to signal on completion
+        uint32_t numWaitEvents,                         ///< [in][optional] number of events to wait on before launching; must be 0
+                                                        ///< if `nullptr == phWaitEvents`
+        ze_event_handle_t* phWaitEvents                 ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
+                                                        ///< on before launching
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        if( context.enableBarrierPruning )
+            context.barrierPruner->pruneWaits( hCommandList, numWaitEvents, phWaitEvents );
+        auto result = context.zeDdiTable.CommandList.pfnAppendMemoryCopyFromContext( hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->recordCommand( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListAppendImageCopy
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListAppendImageCopy(
+        ze_command_list_handle_t hCommandList,          ///< [in] handle of command list
+        ze_image_handle_t hDstImage,                    ///< [in] handle of destination image to copy to
+        ze_image_handle_t hSrcImage,                    ///< [in] handle of source image to copy from
+        ze_event_handle_t hSignalEvent,                 ///< [in][optional] handle of the event to signal on completion
+        uint32_t numWaitEvents,                         ///< [in][optional] number of events to wait on before launching; must be 0
+                                                        ///< if `nullptr == phWaitEvents`
+        ze_event_handle_t* phWaitEvents                 ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
+                                                        ///< on before launching
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        if( context.enableBarrierPruning )
+            context.barrierPruner->pruneWaits( hCommandList, numWaitEvents, phWaitEvents );
+        auto result = context.zeDdiTable.CommandList.pfnAppendImageCopy( hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->recordCommand( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListAppendImageCopyRegion
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListAppendImageCopyRegion(
+        ze_command_list_handle_t hCommandList,          ///< [in] handle of command list
+        ze_image_handle_t hDstImage,                    ///< [in] handle of destination image to copy to
+        ze_image_handle_t hSrcImage,                    ///< [in] handle of source image to copy from
+        const ze_image_region_t* pDstRegion,            ///< [in][optional] destination region descriptor
+        const ze_image_region_t* pSrcRegion,            ///< [in][optional] source region descriptor
+        ze_event_handle_t hSignalEvent,                 ///< [in][optional] handle of the event to signal on completion
+        uint32_t numWaitEvents,                         ///< [in][optional] number of events to wait on before launching; must be 0
+                                                        ///< if `nullptr == phWaitEvents`
+        ze_event_handle_t* phWaitEvents                 ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
+                                                        ///< on before launching
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        if( context.enableBarrierPruning )
+            context.barrierPruner->pruneWaits( hCommandList, numWaitEvents, phWaitEvents );
+        auto result = context.zeDdiTable.CommandList.pfnAppendImageCopyRegion( hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->recordCommand( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListAppendImageCopyToMemory
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListAppendImageCopyToMemory(
+        ze_command_list_handle_t hCommandList,          ///< [in] handle of command list
+        void* dstptr,                                   ///< [in] pointer to destination memory to copy to
+        ze_image_handle_t hSrcImage,                    ///< [in] handle of source image to copy from
+        const ze_image_region_t* pSrcRegion,            ///< [in][optional] source region descriptor
+        ze_event_handle_t hSignalEvent,                 ///< [in][optional] handle of the event to signal on completion
+        uint32_t numWaitEvents,                         ///< [in][optional] number of events to wait on before launching; must be 0
+                                                        ///< if `nullptr == phWaitEvents`
+        ze_event_handle_t* phWaitEvents                 ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
+                                                        ///< on before launching
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        if( context.enableBarrierPruning )
+            context.barrierPruner->pruneWaits( hCommandList, numWaitEvents, phWaitEvents );
+        auto result = context.zeDdiTable.CommandList.pfnAppendImageCopyToMemory( hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->recordCommand( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListAppendImageCopyFromMemory
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListAppendImageCopyFromMemory(
+        ze_command_list_handle_t hCommandList,          ///< [in] handle of command list
+        ze_image_handle_t hDstImage,                    ///< [in] handle of destination image to copy to
+        const void* srcptr,                             ///< [in] pointer to source memory to copy from
+        const ze_image_region_t* pDstRegion,            ///< [in][optional] destination region descriptor
+        ze_event_handle_t hSignalEvent,                 ///< [in][optional] handle of the event to signal on completion
+        uint32_t numWaitEvents,                         ///< [in][optional] number of events to wait on before launching; must be 0
+                                                        ///< if `nullptr == phWaitEvents`
+        ze_event_handle_t* phWaitEvents                 ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
+                                                        ///< on before launching
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        if( context.enableBarrierPruning )
+            context.barrierPruner->pruneWaits( hCommandList, numWaitEvents, phWaitEvents );
+        auto result = context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemory( hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->recordCommand( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListAppendMemoryPrefetch
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListAppendMemoryPrefetch(
+        ze_command_list_handle_t hCommandList,          ///< [in] handle of command list
+        const void* ptr,                                ///< [in] pointer to start of the memory range to prefetch
+        size_t size                                     ///< [in] size in bytes of the memory range to prefetch
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        auto result = context.zeDdiTable.CommandList.pfnAppendMemoryPrefetch( hCommandList, ptr, size );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->recordCommand( hCommandList, nullptr, 0, nullptr );
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListAppendMemAdvise
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListAppendMemAdvise(
+        ze_command_list_handle_t hCommandList,          ///< [in] handle of command list
+        ze_device_handle_t hDevice,                     ///< [in] device associated with the memory advice
+        const void* ptr,                                ///< [in] Pointer to the start of the memory range
+        size_t size,                                    ///< [in] Size in bytes of the memory range
+        ze_memory_advice_t advice                       ///< [in] Memory advice for the memory range
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        auto result = context.zeDdiTable.CommandList.pfnAppendMemAdvise( hCommandList, hDevice, ptr, size, advice );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->recordCommand( hCommandList, nullptr, 0, nullptr );
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListAppendSignalEvent
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListAppendSignalEvent(
+        ze_command_list_handle_t hCommandList,          ///< [in] handle of the command list
+        ze_event_handle_t hEvent                        ///< [in] handle of the event
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        auto result = context.zeDdiTable.CommandList.pfnAppendSignalEvent( hCommandList, hEvent );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->recordCommand( hCommandList, hEvent, 0, nullptr );
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListAppendWaitOnEvents
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListAppendWaitOnEvents(
+        ze_command_list_handle_t hCommandList,          ///< [in] handle of the command list
+        uint32_t numEvents,                             ///< [in] number of events to wait on before continuing
+        ze_event_handle_t* phEvents                     ///< [in][range(0, numEvents)] handles of the events to wait on before
+                                                        ///< continuing
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        if( context.enableBarrierPruning )
+            return context.barrierPruner->zeCommandListAppendWaitOnEvents( hCommandList, numEvents, phEvents );
+        return context.zeDdiTable.CommandList.pfnAppendWaitOnEvents( hCommandList, numEvents, phEvents );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListAppendEventReset
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListAppendEventReset(
+        ze_command_list_handle_t hCommandList,          ///< [in] handle of the command list
+        ze_event_handle_t hEvent                        ///< [in] handle of the event
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        if( context.enableBarrierPruning )
+            return context.barrierPruner->zeCommandListAppendEventReset( hCommandList, hEvent );
+        return context.zeDdiTable.CommandList.pfnAppendEventReset( hCommandList, hEvent );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListAppendQueryKernelTimestamps
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListAppendQueryKernelTimestamps(
+        ze_command_list_handle_t hCommandList,          ///< [in] handle of the command list
+        uint32_t numEvents,                             ///< [in] the number of timestamp events to query
+        ze_event_handle_t* phEvents,                    ///< [in][range(0, numEvents)] handles of timestamp events to query
+        void* dstptr,                                   ///< [in,out] pointer to memory where ::ze_kernel_timestamp_result_t will
+                                                        ///< be written; must be size-aligned.
+        const size_t* pOffsets,                         ///< [in][optional][range(0, numEvents)] offset, in bytes, to write
+                                                        ///< results; address must be 4byte-aligned and offsets must be
+                                                        ///< size-aligned.
+        ze_event_handle_t hSignalEvent,                 ///< [in][optional] handle of the event to signal on completion
+        uint32_t numWaitEvents,                         ///< [in][optional] number of events to wait on before executing query;
+                                                        ///< must be 0 if `nullptr == phWaitEvents`
+        ze_event_handle_t* phWaitEvents                 ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
+                                                        ///< on before executing query
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        if( context.enableBarrierPruning )
+            context.barrierPruner->pruneWaits( hCommandList, numWaitEvents, phWaitEvents );
+        auto result = context.zeDdiTable.CommandList.pfnAppendQueryKernelTimestamps( hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->recordCommand( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListAppendLaunchKernel
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListAppendLaunchKernel(
+        ze_command_list_handle_t hCommandList,          ///< [in] handle of the command list
+        ze_kernel_handle_t hKernel,                     ///< [in] handle of the kernel object
+        const ze_group_count_t* pLaunchFuncArgs,        ///< [in] thread group launch arguments
+        ze_event_handle_t hSignalEvent,                 ///< [in][optional] handle of the event to signal on completion
+        uint32_t numWaitEvents,                         ///< [in][optional] number of events to wait on before launching; must be 0
+                                                        ///< if `nullptr == phWaitEvents`
+        ze_event_handle_t* phWaitEvents                 ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
+                                                        ///< on before launching
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        if( context.enableBarrierPruning )
+            context.barrierPruner->pruneWaits( hCommandList, numWaitEvents, phWaitEvents );
+        auto result = context.zeDdiTable.CommandList.pfnAppendLaunchKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->recordCommand( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListAppendLaunchCooperativeKernel
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListAppendLaunchCooperativeKernel(
+        ze_command_list_handle_t hCommandList,          ///< [in] handle of the command list
+        ze_kernel_handle_t hKernel,                     ///< [in] handle of the kernel object
+        const ze_group_count_t* pLaunchFuncArgs,        ///< [in] thread group launch arguments
+        ze_event_handle_t hSignalEvent,                 ///< [in][optional] handle of the event to signal on completion
+        uint32_t numWaitEvents,                         ///< [in][optional] number of events to wait on before launching; must be 0
+                                                        ///< if `nullptr == phWaitEvents`
+        ze_event_handle_t* phWaitEvents                 ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
+                                                        ///< on before launching
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        if( context.enableBarrierPruning )
+            context.barrierPruner->pruneWaits( hCommandList, numWaitEvents, phWaitEvents );
+        auto result = context.zeDdiTable.CommandList.pfnAppendLaunchCooperativeKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->recordCommand( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListAppendLaunchKernelIndirect
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListAppendLaunchKernelIndirect(
+        ze_command_list_handle_t hCommandList,          ///< [in] handle of the command list
+        ze_kernel_handle_t hKernel,                     ///< [in] handle of the kernel object
+        const ze_group_count_t* pLaunchArgumentsBuffer, ///< [in] pointer to device buffer that will contain thread group launch
+                                                        ///< arguments
+        ze_event_handle_t hSignalEvent,                 ///< [in][optional] handle of the event to signal on completion
+        uint32_t numWaitEvents,                         ///< [in][optional] number of events to wait on before launching; must be 0
+                                                        ///< if `nullptr == phWaitEvents`
+        ze_event_handle_t* phWaitEvents                 ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
+                                                        ///< on before launching
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        if( context.enableBarrierPruning )
+            context.barrierPruner->pruneWaits( hCommandList, numWaitEvents, phWaitEvents );
+        auto result = context.zeDdiTable.CommandList.pfnAppendLaunchKernelIndirect( hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->recordCommand( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListAppendLaunchMultipleKernelsIndirect
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListAppendLaunchMultipleKernelsIndirect(
+        ze_command_list_handle_t hCommandList,          ///< [in] handle of the command list
+        uint32_t numKernels,                            ///< [in] maximum number of kernels to launch
+        ze_kernel_handle_t* phKernels,                  ///< [in][range(0, numKernels)] handles of the kernel objects
+        const uint32_t* pCountBuffer,                   ///< [in] pointer to device memory location that will contain the actual
+                                                        ///< number of kernels to launch; value must be less than or equal to
+                                                        ///< numKernels
+        const ze_group_count_t* pLaunchArgumentsBuffer, ///< [in][range(0, numKernels)] pointer to device buffer that will contain
+                                                        ///< a contiguous array of thread group launch arguments
+        ze_event_handle_t hSignalEvent,                 ///< [in][optional] handle of the event to signal on completion
+        uint32_t numWaitEvents,                         ///< [in][optional] number of events to wait on before launching; must be 0
+                                                        ///< if `nullptr == phWaitEvents`
+        ze_event_handle_t* phWaitEvents                 ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
+                                                        ///< on before launching
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        if( context.enableBarrierPruning )
+            context.barrierPruner->pruneWaits( hCommandList, numWaitEvents, phWaitEvents );
+        auto result = context.zeDdiTable.CommandList.pfnAppendLaunchMultipleKernelsIndirect( hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->recordCommand( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListAppendImageCopyToMemoryExt
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListAppendImageCopyToMemoryExt(
+        ze_command_list_handle_t hCommandList,          ///< [in] handle of command list
+        void* dstptr,                                   ///< [in] pointer to destination memory to copy to
+        ze_image_handle_t hSrcImage,                    ///< [in] handle of source image to copy from
+        const ze_image_region_t* pSrcRegion,            ///< [in][optional] source region descriptor
+        uint32_t destRowPitch,                          ///< [in] size in bytes of the 1D slice of the 2D region of a 2D or 3D
+                                                        ///< image or each image of a 1D or 2D image array being written
+        uint32_t destSlicePitch,                        ///< [in] size in bytes of the 2D slice of the 3D region of a 3D image or
+                                                        ///< each image of a 1D or 2D image array being written
+        ze_event_handle_t hSignalEvent,                 ///< [in][optional] handle of the event to signal on completion
+        uint32_t numWaitEvents,                         ///< [in][optional] number of events to wait on before launching; must be 0
+                                                        ///< if `nullptr == phWaitEvents`
+        ze_event_handle_t* phWaitEvents                 ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
+                                                        ///< on before launching
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        if( context.enableBarrierPruning )
+            context.barrierPruner->pruneWaits( hCommandList, numWaitEvents, phWaitEvents );
+        auto result = context.zeDdiTable.CommandList.pfnAppendImageCopyToMemoryExt( hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->recordCommand( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListAppendImageCopyFromMemoryExt
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListAppendImageCopyFromMemoryExt(
+        ze_command_list_handle_t hCommandList,          ///< [in] handle of command list
+        ze_image_handle_t hDstImage,                    ///< [in] handle of destination image to copy to
+        const void* srcptr,                             ///< [in] pointer to source memory to copy from
+        const ze_image_region_t* pDstRegion,            ///< [in][optional] destination region descriptor
+        uint32_t srcRowPitch,                           ///< [in] size in bytes of the 1D slice of the 2D region of a 2D or 3D
+                                                        ///< image or each image of a 1D or 2D image array being read
+        uint32_t srcSlicePitch,                         ///< [in] size in bytes of the 2D slice of the 3D region of a 3D image or
+                                                        ///< each image of a 1D or 2D image array being read
+        ze_event_handle_t hSignalEvent,                 ///< [in][optional] handle of the event to signal on completion
+        uint32_t numWaitEvents,                         ///< [in][optional] number of events to wait on before launching; must be 0
+                                                        ///< if `nullptr == phWaitEvents`
+        ze_event_handle_t* phWaitEvents                 ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
+                                                        ///< on before launching
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        if( context.enableBarrierPruning )
+            context.barrierPruner->pruneWaits( hCommandList, numWaitEvents, phWaitEvents );
+        auto result = context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemoryExt( hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->recordCommand( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeEventPoolCreate
+    __zedlllocal ze_result_t ZE_APICALL
+    zeEventPoolCreate(
+        ze_context_handle_t hContext,                   ///< [in] handle of the context object
+        const ze_event_pool_desc_t* desc,               ///< [in] pointer to event pool descriptor
+        uint32_t numDevices,                            ///< [in][optional] number of device handles; must be 0 if `nullptr ==
+                                                        ///< phDevices`
+        ze_device_handle_t* phDevices,                  ///< [in][optional][range(0, numDevices)] array of device handles which
+                                                        ///< have visibility to the event pool.
+                                                        ///< if nullptr, then event pool is visible to all devices supported by the
+                                                        ///< driver instance.
+        ze_event_pool_handle_t* phEventPool             ///< [out] pointer handle of event pool object created
+        )
+    {
+        return context.eventRecycler->zeEventPoolCreate( hContext, desc, numDevices, phDevices, phEventPool );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeEventPoolDestroy
+    __zedlllocal ze_result_t ZE_APICALL
+    zeEventPoolDestroy(
+        ze_event_pool_handle_t hEventPool               ///< [in][release] handle of event pool object to destroy
+        )
+    {
+        if( context.enableIpcCache )
+            context.ipcCache->releaseEventPool( hEventPool );
+        if( context.enableBarrierPruning )
+            context.barrierPruner->releaseEventPool( hEventPool );
+        if( context.enableEventRecycling )
+            return context.eventRecycler->zeEventPoolDestroy( hEventPool );
+        return context.zeDdiTable.EventPool.pfnDestroy( hEventPool );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeEventCreate
+    __zedlllocal ze_result_t ZE_APICALL
+    zeEventCreate(
+        ze_event_pool_handle_t hEventPool,              ///< [in] handle of the event pool
+        const ze_event_desc_t* desc,                    ///< [in] pointer to event descriptor
+        ze_event_handle_t* phEvent                      ///< [out] pointer to handle of event object created
+        )
+    {
+        return context.eventRecycler->zeEventCreate( hEventPool, desc, phEvent );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeEventDestroy
+    __zedlllocal ze_result_t ZE_APICALL
+    zeEventDestroy(
+        ze_event_handle_t hEvent                        ///< [in][release] handle of event object to destroy
+        )
+    {
+        if( context.enableBarrierPruning )
+            context.barrierPruner->releaseEvent( hEvent );
+        if( context.enableEventRecycling )
+            return context.eventRecycler->zeEventDestroy( hEvent );
+        return context.zeDdiTable.Event.pfnDestroy( hEvent );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeEventHostReset
+    __zedlllocal ze_result_t ZE_APICALL
+    zeEventHostReset(
+        ze_event_handle_t hEvent                        ///< [in] handle of the event
+        )
+    {
+        return context.barrierPruner->zeEventHostReset( hEvent );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeEventPoolGetIpcHandle
+    __zedlllocal ze_result_t ZE_APICALL
+    zeEventPoolGetIpcHandle(
+        ze_event_pool_handle_t hEventPool,              ///< [in] handle of event pool object
+        ze_ipc_event_pool_handle_t* phIpc               ///< [out] Returned IPC event handle
+        )
+    {
+        return context.ipcCache->zeEventPoolGetIpcHandle( hEventPool, phIpc );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeEventPoolPutIpcHandle
+    __zedlllocal ze_result_t ZE_APICALL
+    zeEventPoolPutIpcHandle(
+        ze_context_handle_t hContext,                   ///< [in] handle of the context object associated with the IPC event pool
+                                                        ///< handle
+        ze_ipc_event_pool_handle_t hIpc                 ///< [in] IPC event pool handle
+        )
+    {
+        return context.ipcCache->zeEventPoolPutIpcHandle( hContext, hIpc );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeEventPoolOpenIpcHandle
+    __zedlllocal ze_result_t ZE_APICALL
+    zeEventPoolOpenIpcHandle(
+        ze_context_handle_t hContext,                   ///< [in] handle of the context object to associate with the IPC event pool
+                                                        ///< handle
+        ze_ipc_event_pool_handle_t hIpc,                ///< [in] IPC event pool handle
+        ze_event_pool_handle_t* phEventPool             ///< [out] pointer handle of event pool object created
+        )
+    {
+        return context.ipcCache->zeEventPoolOpenIpcHandle( hContext, hIpc, phEventPool );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeEventPoolCloseIpcHandle
+    __zedlllocal ze_result_t ZE_APICALL
+    zeEventPoolCloseIpcHandle(
+        ze_event_pool_handle_t hEventPool               ///< [in][release] handle of event pool object
+        )
+    {
+        return context.ipcCache->zeEventPoolCloseIpcHandle( hEventPool );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeFenceCreate
+    __zedlllocal ze_result_t ZE_APICALL
+    zeFenceCreate(
+        ze_command_queue_handle_t hCommandQueue,        ///< [in] handle of command queue
+        const ze_fence_desc_t* desc,                    ///< [in] pointer to fence descriptor
+        ze_fence_handle_t* phFence                      ///< [out] pointer to handle of fence object created
+        )
+    {
+        return context.eventRecycler->zeFenceCreate( hCommandQueue, desc, phFence );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeFenceDestroy
+    __zedlllocal ze_result_t ZE_APICALL
+    zeFenceDestroy(
+        ze_fence_handle_t hFence                        ///< [in][release] handle of fence object to destroy
+        )
+    {
+        return context.eventRecycler->zeFenceDestroy( hFence );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeImageDestroy
+    __zedlllocal ze_result_t ZE_APICALL
+    zeImageDestroy(
+        ze_image_handle_t hImage                        ///< [in][release] handle of image object to destroy
+        )
+    {
+        context.kernelStateFilter->releaseArguments();
+        return context.zeDdiTable.Image.pfnDestroy( hImage );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeMemAllocShared
+    __zedlllocal ze_result_t ZE_APICALL
+    zeMemAllocShared(
+        ze_context_handle_t hContext,                   ///< [in] handle of the context object
+        const ze_device_mem_alloc_desc_t* device_desc,  ///< [in] pointer to device memory allocation descriptor
+        const ze_host_mem_alloc_desc_t* host_desc,      ///< [in] pointer to host memory allocation descriptor
+        size_t size,                                    ///< [in] size in bytes to allocate; must be less than or equal to the
+                                                        ///< `maxMemAllocSize` member of ::ze_device_properties_t
+        size_t alignment,                               ///< [in] minimum alignment in bytes for the allocation; must be a power of
+                                                        ///< two
+        ze_device_handle_t hDevice,                     ///< [in][optional] device handle to associate with
+        void** pptr                                     ///< [out] pointer to shared allocation
+        )
+    {
+        return context.usmPool->zeMemAllocShared( hContext, device_desc, host_desc, size, alignment, hDevice, pptr );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeMemAllocDevice
+    __zedlllocal ze_result_t ZE_APICALL
+    zeMemAllocDevice(
+        ze_context_handle_t hContext,                   ///< [in] handle of the context object
+        const ze_device_mem_alloc_desc_t* device_desc,  ///< [in] pointer to device memory allocation descriptor
+        size_t size,                                    ///< [in] size in bytes to allocate; must be less than or equal to the
+                                                        ///< `maxMemAllocSize` member of ::ze_device_properties_t
+        size_t alignment,                               ///< [in] minimum alignment in bytes for the allocation; must be a power of
+                                                        ///< two
+        ze_device_handle_t hDevice,                     ///< [in] handle of the device
+        void** pptr                                     ///< [out] pointer to device allocation
+        )
+    {
+        return context.usmPool->zeMemAllocDevice( hContext, device_desc, size, alignment, hDevice, pptr );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeMemAllocHost
+    __zedlllocal ze_result_t ZE_APICALL
+    zeMemAllocHost(
+        ze_context_handle_t hContext,                   ///< [in] handle of the context object
+        const ze_host_mem_alloc_desc_t* host_desc,      ///< [in] pointer to host memory allocation descriptor
+        size_t size,                                    ///< [in] size in bytes to allocate; must be less than or equal to the
+                                                        ///< `maxMemAllocSize` member of ::ze_device_properties_t
+        size_t alignment,                               ///< [in] minimum alignment in bytes for the allocation; must be a power of
+                                                        ///< two
+        void** pptr                                     ///< [out] pointer to host allocation
+        )
+    {
+        return context.usmPool->zeMemAllocHost( hContext, host_desc, size, alignment, pptr );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeMemFree
+    __zedlllocal ze_result_t ZE_APICALL
+    zeMemFree(
+        ze_context_handle_t hContext,                   ///< [in] handle of the context object
+        void* ptr                                       ///< [in][release] pointer to memory to free
+        )
+    {
+        if( context.enableKernelStateFilter )
+            context.kernelStateFilter->releaseArguments();
+        if( context.enableIpcCache )
+            context.ipcCache->releaseAllocation( hContext, ptr );
+        if( context.enableUsmPool )
+            return context.usmPool->zeMemFree( hContext, ptr );
+        return context.zeDdiTable.Mem.pfnFree( hContext, ptr );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeMemFreeExt
+    __zedlllocal ze_result_t ZE_APICALL
+    zeMemFreeExt(
+        ze_context_handle_t hContext,                   ///< [in] handle of the context object
+        const ze_memory_free_ext_desc_t* pMemFreeDesc,  ///< [in] pointer to memory free descriptor
+        void* ptr                                       ///< [in][release] pointer to memory to free
+        )
+    {
+        if( context.enableKernelStateFilter )
+            context.kernelStateFilter->releaseArguments();
+        if( context.enableIpcCache )
+            context.ipcCache->releaseAllocation( hContext, ptr );
+        if( context.enableUsmPool )
+            return context.usmPool->zeMemFreeExt( hContext, pMemFreeDesc, ptr );
+        if( nullptr == context.zeDdiTable.Mem.pfnFreeExt )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        return context.zeDdiTable.Mem.pfnFreeExt( hContext, pMemFreeDesc, ptr );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeMemGetAllocProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zeMemGetAllocProperties(
+        ze_context_handle_t hContext,                   ///< [in] handle of the context object
+        const void* ptr,                                ///< [in] memory pointer to query
+        ze_memory_allocation_properties_t* pMemAllocProperties, ///< [in,out] query result for memory allocation properties
+        ze_device_handle_t* phDevice                    ///< [out][optional] device associated with this allocation
+        )
+    {
+        return context.usmPool->zeMemGetAllocProperties( hContext, ptr, pMemAllocProperties, phDevice );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeMemGetAddressRange
+    __zedlllocal ze_result_t ZE_APICALL
+    zeMemGetAddressRange(
+        ze_context_handle_t hContext,                   ///< [in] handle of the context object
+        const void* ptr,                                ///< [in] memory pointer to query
+        void** pBase,                                   ///< [in,out][optional] base address of the allocation
+        size_t* pSize                                   ///< [in,out][optional] size of the allocation
+        )
+    {
+        return context.usmPool->zeMemGetAddressRange( hContext, ptr, pBase, pSize );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeMemGetIpcHandle
+    __zedlllocal ze_result_t ZE_APICALL
+    zeMemGetIpcHandle(
+        ze_context_handle_t hContext,                   ///< [in] handle of the context object
+        const void* ptr,                                ///< [in] pointer to the device memory allocation
+        ze_ipc_mem_handle_t* pIpcHandle                 ///< [out] Returned IPC memory handle
+        )
+    {
+        if( !context.enableIpcCache )
+            return context.usmPool->zeMemGetIpcHandle( hContext, ptr, pIpcHandle );
+        if( context.enableUsmPool && context.usmPool->isPooled( hContext, ptr ) )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        return context.ipcCache->zeMemGetIpcHandle( hContext, ptr, pIpcHandle );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeMemPutIpcHandle
+    __zedlllocal ze_result_t ZE_APICALL
+    zeMemPutIpcHandle(
+        ze_context_handle_t hContext,                   ///< [in] handle of the context object
+        ze_ipc_mem_handle_t handle                      ///< [in] IPC memory handle
+        )
+    {
+        return context.ipcCache->zeMemPutIpcHandle( hContext, handle );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeMemOpenIpcHandle
+    __zedlllocal ze_result_t ZE_APICALL
+    zeMemOpenIpcHandle(
+        ze_context_handle_t hContext,                   ///< [in] handle of the context object
+        ze_device_handle_t hDevice,                     ///< [in] handle of the device to associate with the IPC memory handle
+        ze_ipc_mem_handle_t handle,                     ///< [in] IPC memory handle
+        ze_ipc_memory_flags_t flags,                    ///< [in] flags controlling the operation.
+                                                        ///< must be 0 (default) or a valid combination of ::ze_ipc_memory_flag_t.
+        void** pptr                                     ///< [out] pointer to device allocation in this process
+        )
+    {
+        return context.ipcCache->zeMemOpenIpcHandle( hContext, hDevice, handle, flags, pptr );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeMemCloseIpcHandle
+    __zedlllocal ze_result_t ZE_APICALL
+    zeMemCloseIpcHandle(
+        ze_context_handle_t hContext,                   ///< [in] handle of the context object
+        const void* ptr                                 ///< [in][release] pointer to device allocation in this process
+        )
+    {
+        if( context.enableKernelStateFilter )
+            context.kernelStateFilter->releaseArguments();
+        if( !context.enableIpcCache )
+            return context.zeDdiTable.Mem.pfnCloseIpcHandle( hContext, ptr );
+        return context.ipcCache->zeMemCloseIpcHandle( hContext, ptr );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeMemGetIpcHandleFromFileDescriptorExp
+    __zedlllocal ze_result_t ZE_APICALL
+    zeMemGetIpcHandleFromFileDescriptorExp(
+        ze_context_handle_t hContext,                   ///< [in] handle of the context object
+        uint64_t handle,                                ///< [in] file descriptor
+        ze_ipc_mem_handle_t* pIpcHandle                 ///< [out] Returned IPC memory handle
+        )
+    {
+        return context.ipcCache->zeMemGetIpcHandleFromFileDescriptorExp( hContext, handle, pIpcHandle );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeModuleCreate
+    __zedlllocal ze_result_t ZE_APICALL
+    zeModuleCreate(
+        ze_context_handle_t hContext,                   ///< [in] handle of the context object
+        ze_device_handle_t hDevice,                     ///< [in] handle of the device
+        const ze_module_desc_t* desc,                   ///< [in] pointer to module descriptor
+        ze_module_handle_t* phModule,                   ///< [out] pointer to handle of module object created
+        ze_module_build_log_handle_t* phBuildLog        ///< [out][optional] pointer to handle of module's build log.
+        )
+    {
+        return context.moduleCache->zeModuleCreate( hContext, hDevice, desc, phModule, phBuildLog );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeModuleDestroy
+    __zedlllocal ze_result_t ZE_APICALL
+    zeModuleDestroy(
+        ze_module_handle_t hModule                      ///< [in][release] handle of the module
+        )
+    {
+        return context.kernelCache->zeModuleDestroy( hModule );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeModuleGetKernelNames
+    __zedlllocal ze_result_t ZE_APICALL
+    zeModuleGetKernelNames(
+        ze_module_handle_t hModule,                     ///< [in] handle of the module
+        uint32_t* pCount,                               ///< [in,out] pointer to the number of names.
+                                                        ///< if count is zero, then the driver shall update the value with the
+                                                        ///< total number of names available.
+                                                        ///< if count is greater than the number of names available, then the
+                                                        ///< driver shall update the value with the correct number of names available.
+        const char** pNames                             ///< [in,out][optional][range(0, *pCount)] array of names of functions.
+                                                        ///< if count is less than the number of names available, then driver shall
+                                                        ///< only retrieve that number of names.
+        )
+    {
+        return context.kernelCache->zeModuleGetKernelNames( hModule, pCount, pNames );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeKernelCreate
+    __zedlllocal ze_result_t ZE_APICALL
+    zeKernelCreate(
+        ze_module_handle_t hModule,                     ///< [in] handle of the module
+        const ze_kernel_desc_t* desc,                   ///< [in] pointer to kernel descriptor
+        ze_kernel_handle_t* phKernel                    ///< [out] handle of the Function object
+        )
+    {
+        return context.kernelCache->zeKernelCreate( hModule, desc, phKernel );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeKernelDestroy
+    __zedlllocal ze_result_t ZE_APICALL
+    zeKernelDestroy(
+        ze_kernel_handle_t hKernel                      ///< [in][release] handle of the kernel object
+        )
+    {
+        if( context.enableKernelStateFilter )
+            context.kernelStateFilter->releaseKernel( hKernel );
+        if( context.enableKernelCache )
+            return context.kernelCache->zeKernelDestroy( hKernel );
+        return context.zeDdiTable.Kernel.pfnDestroy( hKernel );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeKernelSetGroupSize
+    __zedlllocal ze_result_t ZE_APICALL
+    zeKernelSetGroupSize(
+        ze_kernel_handle_t hKernel,                     ///< [in] handle of the kernel object
+        uint32_t groupSizeX,                            ///< [in] group size for X dimension to use for this kernel
+        uint32_t groupSizeY,                            ///< [in] group size for Y dimension to use for this kernel
+        uint32_t groupSizeZ                             ///< [in] group size for Z dimension to use for this kernel
+        )
+    {
+        return context.kernelStateFilter->zeKernelSetGroupSize( hKernel, groupSizeX, groupSizeY, groupSizeZ );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeKernelSetArgumentValue
+    __zedlllocal ze_result_t ZE_APICALL
+    zeKernelSetArgumentValue(
+        ze_kernel_handle_t hKernel,                     ///< [in] handle of the kernel object
+        uint32_t argIndex,                              ///< [in] argument index in range [0, num args - 1]
+        size_t argSize,                                 ///< [in] size of argument type
+        const void* pArgValue                           ///< [in][optional] argument value represented as matching arg type. If
+                                                        ///< null then argument value is considered null.
+        )
+    {
+        return context.kernelStateFilter->zeKernelSetArgumentValue( hKernel, argIndex, argSize, pArgValue );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeKernelSetIndirectAccess
+    __zedlllocal ze_result_t ZE_APICALL
+    zeKernelSetIndirectAccess(
+        ze_kernel_handle_t hKernel,                     ///< [in] handle of the kernel object
+        ze_kernel_indirect_access_flags_t flags         ///< [in] kernel indirect access flags
+        )
+    {
+        return context.kernelStateFilter->zeKernelSetIndirectAccess( hKernel, flags );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeKernelGetProperties
+    __zedlllocal ze_result_t ZE_APICALL
+    zeKernelGetProperties(
+        ze_kernel_handle_t hKernel,                     ///< [in] handle of the kernel object
+        ze_kernel_properties_t* pKernelProperties       ///< [in,out] query result for kernel properties.
+        )
+    {
+        return context.kernelCache->zeKernelGetProperties( hKernel, pKernelProperties );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeKernelGetName
+    __zedlllocal ze_result_t ZE_APICALL
+    zeKernelGetName(
+        ze_kernel_handle_t hKernel,                     ///< [in] handle of the kernel object
+        size_t* pSize,                                  ///< [in,out] size of kernel name string, including null terminator, in
+                                                        ///< bytes.
+        char* pName                                     ///< [in,out][optional] char pointer to kernel name.
+        )
+    {
+        return context.kernelCache->zeKernelGetName( hKernel, pSize, pName );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeSamplerDestroy
+    __zedlllocal ze_result_t ZE_APICALL
+    zeSamplerDestroy(
+        ze_sampler_handle_t hSampler                    ///< [in][release] handle of the sampler
+        )
+    {
+        context.kernelStateFilter->releaseArguments();
+        return context.zeDdiTable.Sampler.pfnDestroy( hSampler );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zePhysicalMemDestroy
+    __zedlllocal ze_result_t ZE_APICALL
+    zePhysicalMemDestroy(
+        ze_context_handle_t hContext,                   ///< [in] handle of the context object
+        ze_physical_mem_handle_t hPhysicalMemory        ///< [in][release] handle of physical memory object to destroy
+        )
+    {
+        context.kernelStateFilter->releaseArguments();
+        return context.zeDdiTable.PhysicalMem.pfnDestroy( hContext, hPhysicalMemory );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeVirtualMemFree
+    __zedlllocal ze_result_t ZE_APICALL
+    zeVirtualMemFree(
+        ze_context_handle_t hContext,                   ///< [in] handle of the context object
+        const void* ptr,                                ///< [in] pointer to start of region to free.
+        size_t size                                     ///< [in] size in bytes to free; must be page aligned.
+        )
+    {
+        context.kernelStateFilter->releaseArguments();
+        return context.zeDdiTable.VirtualMem.pfnFree( hContext, ptr, size );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeVirtualMemUnmap
+    __zedlllocal ze_result_t ZE_APICALL
+    zeVirtualMemUnmap(
+        ze_context_handle_t hContext,                   ///< [in] handle of the context object
+        const void* ptr,                                ///< [in] pointer to start of region to unmap.
+        size_t size                                     ///< [in] size in bytes to unmap; must be page aligned.
+        )
+    {
+        context.kernelStateFilter->releaseArguments();
+        return context.zeDdiTable.VirtualMem.pfnUnmap( hContext, ptr, size );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeKernelSetGlobalOffsetExp
+    __zedlllocal ze_result_t ZE_APICALL
+    zeKernelSetGlobalOffsetExp(
+        ze_kernel_handle_t hKernel,                     ///< [in] handle of the kernel object
+        uint32_t offsetX,                               ///< [in] global offset for X dimension to use for this kernel
+        uint32_t offsetY,                               ///< [in] global offset for Y dimension to use for this kernel
+        uint32_t offsetZ                                ///< [in] global offset for Z dimension to use for this kernel
+        )
+    {
+        return context.kernelStateFilter->zeKernelSetGlobalOffsetExp( hKernel, offsetX, offsetY, offsetZ );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListUpdateMutableCommandSignalEventExp
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListUpdateMutableCommandSignalEventExp(
+        ze_command_list_handle_t hCommandList,          ///< [in] handle of the command list
+        uint64_t commandId,                             ///< [in] command identifier
+        ze_event_handle_t hSignalEvent                  ///< [in][optional] handle of the event to signal on completion
+        )
+    {
+        // Mutable command lists are not tracked, but the events they signal
+        // are waited on by other lists.
+        if( nullptr != hSignalEvent )
+            context.barrierPruner->releaseEvent( hSignalEvent );
+        if( nullptr == context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandSignalEventExp )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        return context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandSignalEventExp( hCommandList, commandId, hSignalEvent );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zeCommandListImmediateAppendCommandListsExp
+    __zedlllocal ze_result_t ZE_APICALL
+    zeCommandListImmediateAppendCommandListsExp(
+        ze_command_list_handle_t hCommandListImmediate, ///< [in] handle of the immediate command list
+        uint32_t numCommandLists,                       ///< [in] number of command lists
+        ze_command_list_handle_t* phCommandLists,       ///< [in][range(0, numCommandLists)] handles of command lists
+        ze_event_handle_t hSignalEvent,                 ///< [in][optional] handle of the event to signal on completion
+                                                        ///<    - if not null, this event is signaled after the completion of all
+                                                        ///< appended command lists
+        uint32_t numWaitEvents,                         ///< [in][optional] number of events to wait on before executing appended
+                                                        ///< command lists; must be 0 if nullptr == phWaitEvents
+        ze_event_handle_t* phWaitEvents                 ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait
+                                                        ///< on before executing appended command lists.
+                                                        ///<    - if not null, all wait events must be satisfied prior to the start
+                                                        ///< of any appended command list(s)
+        )
+    {
+        context.barrierPruner->pruneWaits( hCommandListImmediate, numWaitEvents, phWaitEvents );
+        auto result = context.zeDdiTable.CommandListExp.pfnImmediateAppendCommandListsExp( hCommandListImmediate, numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents );
+        // The lists appended may reset the events waited for.
+        context.barrierPruner->resetCommandList( hCommandListImmediate );
+        if( nullptr != hSignalEvent )
+            context.barrierPruner->releaseEvent( hSignalEvent );
+        return result;
+    }
+
+} // namespace optimization_layer
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Driver table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zeGetDriverProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    ze_driver_dditable_t* pDdiTable                 ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = optimization_layer::context.zeDdiTable.Driver;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(optimization_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(optimization_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    if( optimization_layer::context.enableModuleCache )
+    {
+        dditable.pfnGetProperties                            = pDdiTable->pfnGetProperties;
+    }
+
+    if( optimization_layer::context.enableCopyCoalescing ||
+        optimization_layer::context.enableBarrierPruning )
+    {
+        dditable.pfnGetExtensionFunctionAddress              = pDdiTable->pfnGetExtensionFunctionAddress;
+        pDdiTable->pfnGetExtensionFunctionAddress            = optimization_layer::zeDriverGetExtensionFunctionAddress;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Device table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zeGetDeviceProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    ze_device_dditable_t* pDdiTable                 ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = optimization_layer::context.zeDdiTable.Device;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(optimization_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(optimization_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    if( optimization_layer::context.enableModuleCache )
+    {
+        dditable.pfnGetProperties                            = pDdiTable->pfnGetProperties;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Context table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zeGetContextProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    ze_context_dditable_t* pDdiTable                ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = optimization_layer::context.zeDdiTable.Context;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(optimization_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(optimization_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    if( optimization_layer::context.enableUsmPool ||
+        optimization_layer::context.enableEventRecycling ||
+        optimization_layer::context.enableCommandListRecycling ||
+        optimization_layer::context.enableModuleCache ||
+        optimization_layer::context.enableIpcCache )
+    {
+        dditable.pfnDestroy                                  = pDdiTable->pfnDestroy;
+        pDdiTable->pfnDestroy                                = optimization_layer::zeContextDestroy;
+    }
+
+    if( optimization_layer::context.enableModuleCache )
+    {
+        dditable.pfnCreate                                   = pDdiTable->pfnCreate;
+        pDdiTable->pfnCreate                                 = optimization_layer::zeContextCreate;
+
+        dditable.pfnCreateEx                                 = pDdiTable->pfnCreateEx;
+        pDdiTable->pfnCreateEx                               = optimization_layer::zeContextCreateEx;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's CommandQueue table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zeGetCommandQueueProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    ze_command_queue_dditable_t* pDdiTable          ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = optimization_layer::context.zeDdiTable.CommandQueue;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(optimization_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(optimization_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    if( optimization_layer::context.enableEventRecycling )
+    {
+        dditable.pfnDestroy                                  = pDdiTable->pfnDestroy;
+        pDdiTable->pfnDestroy                                = optimization_layer::zeCommandQueueDestroy;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's CommandList table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zeGetCommandListProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    ze_command_list_dditable_t* pDdiTable           ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = optimization_layer::context.zeDdiTable.CommandList;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(optimization_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(optimization_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    if( optimization_layer::context.enableCommandListRecycling ||
+        optimization_layer::context.enableCopyCoalescing ||
+        optimization_layer::context.enableBarrierPruning )
+    {
+        dditable.pfnCreate                                   = pDdiTable->pfnCreate;
+        pDdiTable->pfnCreate                                 = optimization_layer::zeCommandListCreate;
+
+        dditable.pfnDestroy                                  = pDdiTable->pfnDestroy;
+        pDdiTable->pfnDestroy                                = optimization_layer::zeCommandListDestroy;
+    }
+
+    if( optimization_layer::context.enableCommandListRecycling ||
+        optimization_layer::context.enableBarrierPruning )
+    {
+        dditable.pfnCreateImmediate                          = pDdiTable->pfnCreateImmediate;
+        pDdiTable->pfnCreateImmediate                        = optimization_layer::zeCommandListCreateImmediate;
+    }
+
+    if( optimization_layer::context.enableCommandListRecycling )
+    {
+        dditable.pfnReset                                    = pDdiTable->pfnReset;
+    }
+
+    if( optimization_layer::context.enableCopyCoalescing )
+    {
+        dditable.pfnClose                                    = pDdiTable->pfnClose;
+        pDdiTable->pfnClose                                  = optimization_layer::zeCommandListClose;
+    }
+
+    if( optimization_layer::context.enableCopyCoalescing ||
+        optimization_layer::context.enableBarrierPruning )
+    {
+        dditable.pfnReset                                    = pDdiTable->pfnReset;
+        pDdiTable->pfnReset                                  = optimization_layer::zeCommandListReset;
+
+        dditable.pfnAppendWriteGlobalTimestamp               = pDdiTable->pfnAppendWriteGlobalTimestamp;
+        pDdiTable->pfnAppendWriteGlobalTimestamp             = optimization_layer::zeCommandListAppendWriteGlobalTimestamp;
+
+        dditable.pfnAppendBarrier                            = pDdiTable->pfnAppendBarrier;
+        pDdiTable->pfnAppendBarrier                          = optimization_layer::zeCommandListAppendBarrier;
+
+        dditable.pfnAppendMemoryRangesBarrier                = pDdiTable->pfnAppendMemoryRangesBarrier;
+        pDdiTable->pfnAppendMemoryRangesBarrier              = optimization_layer::zeCommandListAppendMemoryRangesBarrier;
+
+        dditable.pfnAppendMemoryCopy                         = pDdiTable->pfnAppendMemoryCopy;
+        pDdiTable->pfnAppendMemoryCopy                       = optimization_layer::zeCommandListAppendMemoryCopy;
+
+        dditable.pfnAppendMemoryFill                         = pDdiTable->pfnAppendMemoryFill;
+        pDdiTable->pfnAppendMemoryFill                       = optimization_layer::zeCommandListAppendMemoryFill;
+
+        dditable.pfnAppendMemoryCopyRegion                   = pDdiTable->pfnAppendMemoryCopyRegion;
+        pDdiTable->pfnAppendMemoryCopyRegion                 = optimization_layer::zeCommandListAppendMemoryCopyRegion;
+
+        dditable.pfnAppendMemoryCopyFromContext              = pDdiTable->pfnAppendMemoryCopyFromContext;
+        pDdiTable->pfnAppendMemoryCopyFromContext            = optimization_layer::zeCommandListAppendMemoryCopyFromContext;
+
+        dditable.pfnAppendImageCopy                          = pDdiTable->pfnAppendImageCopy;
+        pDdiTable->pfnAppendImageCopy                        = optimization_layer::zeCommandListAppendImageCopy;
+
+        dditable.pfnAppendImageCopyRegion                    = pDdiTable->pfnAppendImageCopyRegion;
+        pDdiTable->pfnAppendImageCopyRegion                  = optimization_layer::zeCommandListAppendImageCopyRegion;
+
+        dditable.pfnAppendImageCopyToMemory                  = pDdiTable->pfnAppendImageCopyToMemory;
+        pDdiTable->pfnAppendImageCopyToMemory                = optimization_layer::zeCommandListAppendImageCopyToMemory;
+
+        dditable.pfnAppendImageCopyFromMemory                = pDdiTable->pfnAppendImageCopyFromMemory;
+        pDdiTable->pfnAppendImageCopyFromMemory              = optimization_layer::zeCommandListAppendImageCopyFromMemory;
+
+        dditable.pfnAppendMemoryPrefetch                     = pDdiTable->pfnAppendMemoryPrefetch;
+        pDdiTable->pfnAppendMemoryPrefetch                   = optimization_layer::zeCommandListAppendMemoryPrefetch;
+
+        dditable.pfnAppendMemAdvise                          = pDdiTable->pfnAppendMemAdvise;
+        pDdiTable->pfnAppendMemAdvise                        = optimization_layer::zeCommandListAppendMemAdvise;
+
+        dditable.pfnAppendSignalEvent                        = pDdiTable->pfnAppendSignalEvent;
+        pDdiTable->pfnAppendSignalEvent                      = optimization_layer::zeCommandListAppendSignalEvent;
+
+        dditable.pfnAppendWaitOnEvents                       = pDdiTable->pfnAppendWaitOnEvents;
+        pDdiTable->pfnAppendWaitOnEvents                     = optimization_layer::zeCommandListAppendWaitOnEvents;
+
+        dditable.pfnAppendEventReset                         = pDdiTable->pfnAppendEventReset;
+        pDdiTable->pfnAppendEventReset                       = optimization_layer::zeCommandListAppendEventReset;
+
+        dditable.pfnAppendQueryKernelTimestamps              = pDdiTable->pfnAppendQueryKernelTimestamps;
+        pDdiTable->pfnAppendQueryKernelTimestamps            = optimization_layer::zeCommandListAppendQueryKernelTimestamps;
+
+        dditable.pfnAppendLaunchKernel                       = pDdiTable->pfnAppendLaunchKernel;
+        pDdiTable->pfnAppendLaunchKernel                     = optimization_layer::zeCommandListAppendLaunchKernel;
+
+        dditable.pfnAppendLaunchCooperativeKernel            = pDdiTable->pfnAppendLaunchCooperativeKernel;
+        pDdiTable->pfnAppendLaunchCooperativeKernel          = optimization_layer::zeCommandListAppendLaunchCooperativeKernel;
+
+        dditable.pfnAppendLaunchKernelIndirect               = pDdiTable->pfnAppendLaunchKernelIndirect;
+        pDdiTable->pfnAppendLaunchKernelIndirect             = optimization_layer::zeCommandListAppendLaunchKernelIndirect;
+
+        dditable.pfnAppendLaunchMultipleKernelsIndirect      = pDdiTable->pfnAppendLaunchMultipleKernelsIndirect;
+        pDdiTable->pfnAppendLaunchMultipleKernelsIndirect    = optimization_layer::zeCommandListAppendLaunchMultipleKernelsIndirect;
+
+        dditable.pfnAppendImageCopyToMemoryExt               = pDdiTable->pfnAppendImageCopyToMemoryExt;
+        pDdiTable->pfnAppendImageCopyToMemoryExt             = optimization_layer::zeCommandListAppendImageCopyToMemoryExt;
+
+        dditable.pfnAppendImageCopyFromMemoryExt             = pDdiTable->pfnAppendImageCopyFromMemoryExt;
+        pDdiTable->pfnAppendImageCopyFromMemoryExt           = optimization_layer::zeCommandListAppendImageCopyFromMemoryExt;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's CommandListExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zeGetCommandListExpProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    ze_command_list_exp_dditable_t* pDdiTable       ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = optimization_layer::context.zeDdiTable.CommandListExp;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(optimization_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(optimization_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    if( optimization_layer::context.enableBarrierPruning )
+    {
+        dditable.pfnImmediateAppendCommandListsExp           = pDdiTable->pfnImmediateAppendCommandListsExp;
+        pDdiTable->pfnImmediateAppendCommandListsExp         = optimization_layer::zeCommandListImmediateAppendCommandListsExp;
+
+        dditable.pfnUpdateMutableCommandSignalEventExp       = pDdiTable->pfnUpdateMutableCommandSignalEventExp;
+        pDdiTable->pfnUpdateMutableCommandSignalEventExp     = optimization_layer::zeCommandListUpdateMutableCommandSignalEventExp;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Event table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zeGetEventProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    ze_event_dditable_t* pDdiTable                  ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = optimization_layer::context.zeDdiTable.Event;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(optimization_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(optimization_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    if( optimization_layer::context.enableEventRecycling ||
+        optimization_layer::context.enableBarrierPruning )
+    {
+        dditable.pfnDestroy                                  = pDdiTable->pfnDestroy;
+        pDdiTable->pfnDestroy                                = optimization_layer::zeEventDestroy;
+    }
+
+    if( optimization_layer::context.enableEventRecycling )
+    {
+        dditable.pfnCreate                                   = pDdiTable->pfnCreate;
+        pDdiTable->pfnCreate                                 = optimization_layer::zeEventCreate;
+
+        dditable.pfnHostReset                                = pDdiTable->pfnHostReset;
+    }
+
+    if( optimization_layer::context.enableBarrierPruning )
+    {
+        dditable.pfnHostReset                                = pDdiTable->pfnHostReset;
+        pDdiTable->pfnHostReset                              = optimization_layer::zeEventHostReset;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's EventPool table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zeGetEventPoolProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    ze_event_pool_dditable_t* pDdiTable             ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = optimization_layer::context.zeDdiTable.EventPool;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(optimization_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(optimization_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    if( optimization_layer::context.enableEventRecycling ||
+        optimization_layer::context.enableIpcCache ||
+        optimization_layer::context.enableBarrierPruning )
+    {
+        dditable.pfnDestroy                                  = pDdiTable->pfnDestroy;
+        pDdiTable->pfnDestroy                                = optimization_layer::zeEventPoolDestroy;
+    }
+
+    if( optimization_layer::context.enableEventRecycling )
+    {
+        dditable.pfnCreate                                   = pDdiTable->pfnCreate;
+        pDdiTable->pfnCreate                                 = optimization_layer::zeEventPoolCreate;
+    }
+
+    if( optimization_layer::context.enableIpcCache )
+    {
+        dditable.pfnGetIpcHandle                             = pDdiTable->pfnGetIpcHandle;
+        pDdiTable->pfnGetIpcHandle                           = optimization_layer::zeEventPoolGetIpcHandle;
+
+        dditable.pfnOpenIpcHandle                            = pDdiTable->pfnOpenIpcHandle;
+        pDdiTable->pfnOpenIpcHandle                          = optimization_layer::zeEventPoolOpenIpcHandle;
+
+        dditable.pfnCloseIpcHandle                           = pDdiTable->pfnCloseIpcHandle;
+        pDdiTable->pfnCloseIpcHandle                         = optimization_layer::zeEventPoolCloseIpcHandle;
+
+        dditable.pfnPutIpcHandle                             = pDdiTable->pfnPutIpcHandle;
+        pDdiTable->pfnPutIpcHandle                           = optimization_layer::zeEventPoolPutIpcHandle;
+
+        dditable.pfnGetContextHandle                         = pDdiTable->pfnGetContextHandle;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Fence table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zeGetFenceProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    ze_fence_dditable_t* pDdiTable                  ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = optimization_layer::context.zeDdiTable.Fence;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(optimization_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(optimization_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    if( optimization_layer::context.enableEventRecycling )
+    {
+        dditable.pfnCreate                                   = pDdiTable->pfnCreate;
+        pDdiTable->pfnCreate                                 = optimization_layer::zeFenceCreate;
+
+        dditable.pfnDestroy                                  = pDdiTable->pfnDestroy;
+        pDdiTable->pfnDestroy                                = optimization_layer::zeFenceDestroy;
+
+        dditable.pfnReset                                    = pDdiTable->pfnReset;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Image table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zeGetImageProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    ze_image_dditable_t* pDdiTable                  ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = optimization_layer::context.zeDdiTable.Image;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(optimization_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(optimization_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    if( optimization_layer::context.enableKernelStateFilter )
+    {
+        dditable.pfnDestroy                                  = pDdiTable->pfnDestroy;
+        pDdiTable->pfnDestroy                                = optimization_layer::zeImageDestroy;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Kernel table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zeGetKernelProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    ze_kernel_dditable_t* pDdiTable                 ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = optimization_layer::context.zeDdiTable.Kernel;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(optimization_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(optimization_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    if( optimization_layer::context.enableKernelCache ||
+        optimization_layer::context.enableKernelStateFilter )
+    {
+        dditable.pfnDestroy                                  = pDdiTable->pfnDestroy;
+        pDdiTable->pfnDestroy                                = optimization_layer::zeKernelDestroy;
+    }
+
+    if( optimization_layer::context.enableKernelCache )
+    {
+        dditable.pfnCreate                                   = pDdiTable->pfnCreate;
+        pDdiTable->pfnCreate                                 = optimization_layer::zeKernelCreate;
+
+        dditable.pfnGetProperties                            = pDdiTable->pfnGetProperties;
+        pDdiTable->pfnGetProperties                          = optimization_layer::zeKernelGetProperties;
+
+        dditable.pfnGetName                                  = pDdiTable->pfnGetName;
+        pDdiTable->pfnGetName                                = optimization_layer::zeKernelGetName;
+    }
+
+    if( optimization_layer::context.enableKernelStateFilter )
+    {
+        dditable.pfnSetGroupSize                             = pDdiTable->pfnSetGroupSize;
+        pDdiTable->pfnSetGroupSize                           = optimization_layer::zeKernelSetGroupSize;
+
+        dditable.pfnSetArgumentValue                         = pDdiTable->pfnSetArgumentValue;
+        pDdiTable->pfnSetArgumentValue                       = optimization_layer::zeKernelSetArgumentValue;
+
+        dditable.pfnSetIndirectAccess                        = pDdiTable->pfnSetIndirectAccess;
+        pDdiTable->pfnSetIndirectAccess                      = optimization_layer::zeKernelSetIndirectAccess;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's KernelExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zeGetKernelExpProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    ze_kernel_exp_dditable_t* pDdiTable             ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = optimization_layer::context.zeDdiTable.KernelExp;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(optimization_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(optimization_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    if( optimization_layer::context.enableKernelStateFilter )
+    {
+        dditable.pfnSetGlobalOffsetExp                       = pDdiTable->pfnSetGlobalOffsetExp;
+        pDdiTable->pfnSetGlobalOffsetExp                     = optimization_layer::zeKernelSetGlobalOffsetExp;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Mem table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zeGetMemProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    ze_mem_dditable_t* pDdiTable                    ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = optimization_layer::context.zeDdiTable.Mem;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(optimization_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(optimization_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    // Freeing an allocation makes the arguments pointing into it stale.
+    if( optimization_layer::context.enableUsmPool ||
+        optimization_layer::context.enableIpcCache ||
+        optimization_layer::context.enableKernelStateFilter )
+    {
+        dditable.pfnFree                                     = pDdiTable->pfnFree;
+        pDdiTable->pfnFree                                   = optimization_layer::zeMemFree;
+
+        dditable.pfnFreeExt                                  = pDdiTable->pfnFreeExt;
+        pDdiTable->pfnFreeExt                                = optimization_layer::zeMemFreeExt;
+
+        dditable.pfnCloseIpcHandle                           = pDdiTable->pfnCloseIpcHandle;
+        pDdiTable->pfnCloseIpcHandle                         = optimization_layer::zeMemCloseIpcHandle;
+    }
+
+    if( optimization_layer::context.enableUsmPool ||
+        optimization_layer::context.enableIpcCache )
+    {
+        dditable.pfnGetIpcHandle                             = pDdiTable->pfnGetIpcHandle;
+        pDdiTable->pfnGetIpcHandle                           = optimization_layer::zeMemGetIpcHandle;
+    }
+
+    // The cache asks the driver for the allocation of an exported pointer,
+    // before the pool replaces the entry.
+    if( optimization_layer::context.enableIpcCache )
+    {
+        dditable.pfnGetAddressRange                          = pDdiTable->pfnGetAddressRange;
+
+        dditable.pfnOpenIpcHandle                            = pDdiTable->pfnOpenIpcHandle;
+        pDdiTable->pfnOpenIpcHandle                          = optimization_layer::zeMemOpenIpcHandle;
+
+        dditable.pfnPutIpcHandle                             = pDdiTable->pfnPutIpcHandle;
+        pDdiTable->pfnPutIpcHandle                           = optimization_layer::zeMemPutIpcHandle;
+    }
+
+    // The coalescer asks the driver which allocation a copy falls in.
+    if( optimization_layer::context.enableCopyCoalescing )
+    {
+        dditable.pfnGetAddressRange                          = pDdiTable->pfnGetAddressRange;
+    }
+
+    if( optimization_layer::context.enableUsmPool )
+    {
+        dditable.pfnAllocShared                              = pDdiTable->pfnAllocShared;
+        pDdiTable->pfnAllocShared                            = optimization_layer::zeMemAllocShared;
+
+        dditable.pfnAllocDevice                              = pDdiTable->pfnAllocDevice;
+        pDdiTable->pfnAllocDevice                            = optimization_layer::zeMemAllocDevice;
+
+        dditable.pfnAllocHost                                = pDdiTable->pfnAllocHost;
+        pDdiTable->pfnAllocHost                              = optimization_layer::zeMemAllocHost;
+
+        dditable.pfnGetAllocProperties                       = pDdiTable->pfnGetAllocProperties;
+        pDdiTable->pfnGetAllocProperties                     = optimization_layer::zeMemGetAllocProperties;
+
+        dditable.pfnGetAddressRange                          = pDdiTable->pfnGetAddressRange;
+        pDdiTable->pfnGetAddressRange                        = optimization_layer::zeMemGetAddressRange;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's MemExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zeGetMemExpProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    ze_mem_exp_dditable_t* pDdiTable                ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = optimization_layer::context.zeDdiTable.MemExp;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(optimization_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(optimization_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    if( optimization_layer::context.enableIpcCache )
+    {
+        dditable.pfnGetIpcHandleFromFileDescriptorExp        = pDdiTable->pfnGetIpcHandleFromFileDescriptorExp;
+        pDdiTable->pfnGetIpcHandleFromFileDescriptorExp      = optimization_layer::zeMemGetIpcHandleFromFileDescriptorExp;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Module table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zeGetModuleProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    ze_module_dditable_t* pDdiTable                 ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = optimization_layer::context.zeDdiTable.Module;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(optimization_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(optimization_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    if( optimization_layer::context.enableModuleCache )
+    {
+        dditable.pfnCreate                                   = pDdiTable->pfnCreate;
+        pDdiTable->pfnCreate                                 = optimization_layer::zeModuleCreate;
+
+        dditable.pfnGetNativeBinary                          = pDdiTable->pfnGetNativeBinary;
+    }
+
+    if( optimization_layer::context.enableKernelCache )
+    {
+        dditable.pfnDestroy                                  = pDdiTable->pfnDestroy;
+        pDdiTable->pfnDestroy                                = optimization_layer::zeModuleDestroy;
+
+        dditable.pfnGetKernelNames                           = pDdiTable->pfnGetKernelNames;
+        pDdiTable->pfnGetKernelNames                         = optimization_layer::zeModuleGetKernelNames;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's ModuleBuildLog table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zeGetModuleBuildLogProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    ze_module_build_log_dditable_t* pDdiTable       ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = optimization_layer::context.zeDdiTable.ModuleBuildLog;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(optimization_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(optimization_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    if( optimization_layer::context.enableModuleCache )
+    {
+        dditable.pfnDestroy                                  = pDdiTable->pfnDestroy;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Sampler table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zeGetSamplerProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    ze_sampler_dditable_t* pDdiTable                ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = optimization_layer::context.zeDdiTable.Sampler;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(optimization_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(optimization_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    if( optimization_layer::context.enableKernelStateFilter )
+    {
+        dditable.pfnDestroy                                  = pDdiTable->pfnDestroy;
+        pDdiTable->pfnDestroy                                = optimization_layer::zeSamplerDestroy;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's PhysicalMem table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zeGetPhysicalMemProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    ze_physical_mem_dditable_t* pDdiTable           ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = optimization_layer::context.zeDdiTable.PhysicalMem;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(optimization_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(optimization_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    if( optimization_layer::context.enableKernelStateFilter )
+    {
+        dditable.pfnDestroy                                  = pDdiTable->pfnDestroy;
+        pDdiTable->pfnDestroy                                = optimization_layer::zePhysicalMemDestroy;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's VirtualMem table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zeGetVirtualMemProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    ze_virtual_mem_dditable_t* pDdiTable            ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = optimization_layer::context.zeDdiTable.VirtualMem;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(optimization_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(optimization_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    if( optimization_layer::context.enableKernelStateFilter )
+    {
+        dditable.pfnFree                                     = pDdiTable->pfnFree;
+        pDdiTable->pfnFree                                   = optimization_layer::zeVirtualMemFree;
+
+        dditable.pfnUnmap                                    = pDdiTable->pfnUnmap;
+        pDdiTable->pfnUnmap                                  = optimization_layer::zeVirtualMemUnmap;
+    }
+
+    return result;
+}
+
+#if defined(__cplusplus)
+};
+#endif
@@ -0,0 +1,101 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file ze_optimization_layer.cpp
+ *
+ */
+#include "ze_optimization_layer.h"
+
+namespace optimization_layer
+{
+    context_t context;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    context_t::context_t()
+    {
+        enableUsmPool = getenv_tobool( "ZE_ENABLE_USM_POOL" );
+        if (enableUsmPool) {
+            usmPool = std::make_unique<UsmPool>(zeDdiTable);
+        }
+
+        enableEventRecycling = getenv_tobool( "ZE_ENABLE_EVENT_RECYCLING" );
+        if (enableEventRecycling) {
+            eventRecycler = std::make_unique<EventRecycler>(zeDdiTable);
+        }
+
+        enableCommandListRecycling = getenv_tobool( "ZE_ENABLE_COMMAND_LIST_RECYCLING" );
+        if (enableCommandListRecycling) {
+            commandListRecycler = std::make_unique<CommandListRecycler>(zeDdiTable);
+        }
+
+        enableModuleCache = getenv_tobool( "ZE_ENABLE_MODULE_CACHE" );
+        if (enableModuleCache) {
+            moduleCache = std::make_unique<ModuleCache>(zeDdiTable);
+        }
+
+        enableKernelCache = getenv_tobool( "ZE_ENABLE_KERNEL_CACHE" );
+        if (enableKernelCache) {
+            kernelCache = std::make_unique<KernelCache>(zeDdiTable);
+        }
+
+        enableIpcCache = getenv_tobool( "ZE_ENABLE_IPC_CACHE" );
+        if (enableIpcCache) {
+            ipcCache = std::make_unique<IpcCache>(zeDdiTable);
+        }
+
+        enableKernelStateFilter = getenv_tobool( "ZE_ENABLE_KERNEL_STATE_FILTER" );
+        if (enableKernelStateFilter) {
+            kernelStateFilter = std::make_unique<KernelStateFilter>(zeDdiTable);
+        }
+
+        enableCopyCoalescing = getenv_tobool( "ZE_ENABLE_COPY_COALESCING" );
+        if (enableCopyCoalescing) {
+            copyCoalescer = std::make_unique<CopyCoalescer>(zeDdiTable);
+        }
+
+        enableBarrierPruning = getenv_tobool( "ZE_ENABLE_BARRIER_PRUNING" );
+        if (enableBarrierPruning) {
+            barrierPruner = std::make_unique<BarrierPruner>(zeDdiTable);
+        }
+
+        enableReport = getenv_tobool( "ZE_OPTIMIZATION_LAYER_REPORT" );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    context_t::~context_t()
+    {
+        if (enableReport && enableCopyCoalescing) {
+            copyCoalescer->report(stderr);
+        }
+        if (enableReport && enableBarrierPruning) {
+            barrierPruner->report(stderr);
+        }
+    }
+} // namespace optimization_layer
+
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelLoaderGetVersion(zel_component_version_t *version)
+{
+    if(version == nullptr)
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    string_copy_s(version->component_name, OPTIMIZATION_COMP_NAME, ZEL_COMPONENT_STRING_SIZE);
+    version->spec_version = ZE_API_VERSION_CURRENT;
+    version->component_lib_version.major = LOADER_VERSION_MAJOR;
+    version->component_lib_version.minor = LOADER_VERSION_MINOR;
+    version->component_lib_version.patch = LOADER_VERSION_PATCH;
+
+    return ZE_RESULT_SUCCESS;
+}
+
+
+#if defined(__cplusplus)
+};
+#endif
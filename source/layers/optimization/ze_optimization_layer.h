@@ -0,0 +1,68 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file ze_optimization_layer.h
+ *
+ */
+#pragma once
+#include "ze_ddi.h"
+#include "zet_ddi.h"
+#include "ze_util.h"
+#include "loader/ze_loader.h"
+#include "usm_pool.h"
+#include "event_recycler.h"
+#include "command_list_recycler.h"
+#include "module_cache.h"
+#include "kernel_cache.h"
+#include "ipc_cache.h"
+#include "kernel_state_filter.h"
+#include "copy_coalescer.h"
+#include "barrier_pruner.h"
+#include <memory>
+
+#define OPTIMIZATION_COMP_NAME "optimization layer"
+
+namespace optimization_layer
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // Only the entries the enabled optimizations intercept or call are
+    // filled in zeDdiTable and zetDdiTable; the others stay null.
+    class __zedlllocal context_t
+    {
+    public:
+        ze_api_version_t version = ZE_API_VERSION_CURRENT;
+
+        bool enableUsmPool = false;
+        bool enableEventRecycling = false;
+        bool enableCommandListRecycling = false;
+        bool enableModuleCache = false;
+        bool enableKernelCache = false;
+        bool enableIpcCache = false;
+        bool enableKernelStateFilter = false;
+        bool enableCopyCoalescing = false;
+        bool enableBarrierPruning = false;
+        // Prints what the optimizations did when the layer is unloaded.
+        bool enableReport = false;
+
+        ze_dditable_t   zeDdiTable = {};
+        zet_dditable_t  zetDdiTable = {};
+
+        std::unique_ptr<UsmPool> usmPool;
+        std::unique_ptr<EventRecycler> eventRecycler;
+        std::unique_ptr<CommandListRecycler> commandListRecycler;
+        std::unique_ptr<ModuleCache> moduleCache;
+        std::unique_ptr<KernelCache> kernelCache;
+        std::unique_ptr<IpcCache> ipcCache;
+        std::unique_ptr<KernelStateFilter> kernelStateFilter;
+        std::unique_ptr<CopyCoalescer> copyCoalescer;
+        std::unique_ptr<BarrierPruner> barrierPruner;
+
+        context_t();
+        ~context_t();
+    };
+
+    extern context_t context;
+} // namespace optimization_layer
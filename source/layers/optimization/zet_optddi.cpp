@@ -0,0 +1,153 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file zet_optddi.cpp
+ *
+ */
+#include "ze_optimization_layer.h"
+
+namespace optimization_layer
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetCommandListAppendMetricStreamerMarker
+    __zedlllocal ze_result_t ZE_APICALL
+    zetCommandListAppendMetricStreamerMarker(
+        zet_command_list_handle_t hCommandList,         ///< [in] handle of the command list
+        zet_metric_streamer_handle_t hMetricStreamer,   ///< [in] handle of the metric streamer
+        uint32_t value                                  ///< [in] streamer marker value
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        auto result = context.zetDdiTable.CommandList.pfnAppendMetricStreamerMarker( hCommandList, hMetricStreamer, value );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->recordCommand( hCommandList, nullptr, 0, nullptr );
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetCommandListAppendMetricQueryBegin
+    __zedlllocal ze_result_t ZE_APICALL
+    zetCommandListAppendMetricQueryBegin(
+        zet_command_list_handle_t hCommandList,         ///< [in] handle of the command list
+        zet_metric_query_handle_t hMetricQuery          ///< [in] handle of the metric query
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        auto result = context.zetDdiTable.CommandList.pfnAppendMetricQueryBegin( hCommandList, hMetricQuery );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->recordCommand( hCommandList, nullptr, 0, nullptr );
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetCommandListAppendMetricQueryEnd
+    __zedlllocal ze_result_t ZE_APICALL
+    zetCommandListAppendMetricQueryEnd(
+        zet_command_list_handle_t hCommandList,         ///< [in] handle of the command list
+        zet_metric_query_handle_t hMetricQuery,         ///< [in] handle of the metric query
+        ze_event_handle_t hSignalEvent,                 ///< [in][optional] handle of the event to signal on completion
+        uint32_t numWaitEvents,                         ///< [in] must be zero
+        ze_event_handle_t* phWaitEvents                 ///< [in][mbz] must be nullptr
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        if( context.enableBarrierPruning )
+            context.barrierPruner->pruneWaits( hCommandList, numWaitEvents, phWaitEvents );
+        auto result = context.zetDdiTable.CommandList.pfnAppendMetricQueryEnd( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->recordCommand( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Intercept function for zetCommandListAppendMetricMemoryBarrier
+    __zedlllocal ze_result_t ZE_APICALL
+    zetCommandListAppendMetricMemoryBarrier(
+        zet_command_list_handle_t hCommandList          ///< [in] handle of the command list
+        )
+    {
+        if( context.enableCopyCoalescing )
+        {
+            auto result = context.copyCoalescer->flush( hCommandList );
+            if( ZE_RESULT_SUCCESS != result )
+                return result;
+        }
+        auto result = context.zetDdiTable.CommandList.pfnAppendMetricMemoryBarrier( hCommandList );
+        if( context.enableBarrierPruning && ZE_RESULT_SUCCESS == result )
+            context.barrierPruner->recordCommand( hCommandList, nullptr, 0, nullptr );
+        return result;
+    }
+
+} // namespace optimization_layer
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's CommandList table
+///        with current process' addresses
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_VERSION
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zetGetCommandListProcAddrTable(
+    ze_api_version_t version,                       ///< [in] API version requested
+    zet_command_list_dditable_t* pDdiTable          ///< [in,out] pointer to table of DDI function pointers
+    )
+{
+    auto& dditable = optimization_layer::context.zetDdiTable.CommandList;
+
+    if( nullptr == pDdiTable )
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+
+    if (ZE_MAJOR_VERSION(optimization_layer::context.version) != ZE_MAJOR_VERSION(version) ||
+        ZE_MINOR_VERSION(optimization_layer::context.version) > ZE_MINOR_VERSION(version))
+        return ZE_RESULT_ERROR_UNSUPPORTED_VERSION;
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    // Metric commands are appended to the same lists, so held copies are
+    // appended before them, and a barrier after them is not pruned.
+    if( optimization_layer::context.enableCopyCoalescing ||
+        optimization_layer::context.enableBarrierPruning )
+    {
+        dditable.pfnAppendMetricStreamerMarker               = pDdiTable->pfnAppendMetricStreamerMarker;
+        pDdiTable->pfnAppendMetricStreamerMarker             = optimization_layer::zetCommandListAppendMetricStreamerMarker;
+
+        dditable.pfnAppendMetricQueryBegin                   = pDdiTable->pfnAppendMetricQueryBegin;
+        pDdiTable->pfnAppendMetricQueryBegin                 = optimization_layer::zetCommandListAppendMetricQueryBegin;
+
+        dditable.pfnAppendMetricQueryEnd                     = pDdiTable->pfnAppendMetricQueryEnd;
+        pDdiTable->pfnAppendMetricQueryEnd                   = optimization_layer::zetCommandListAppendMetricQueryEnd;
+
+        dditable.pfnAppendMetricMemoryBarrier                = pDdiTable->pfnAppendMetricMemoryBarrier;
+        pDdiTable->pfnAppendMetricMemoryBarrier              = optimization_layer::zetCommandListAppendMetricMemoryBarrier;
+    }
+
+    return result;
+}
+
+#if defined(__cplusplus)
+};
+#endif
@@ -0,0 +1,584 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "api_capture.h"
+#include "ze_tracing_layer.h"
+
+#include <atomic>
+
+namespace tracing_layer {
+
+ApiCapture *pApiCapture = nullptr;
+
+namespace {
+
+std::atomic<uint32_t> nextCaptureThreadId{1};
+thread_local uint32_t captureThreadId = 0;
+
+// Builds one record while holding the capture lock and writes it out when
+// it goes out of scope.
+class CaptureRecord {
+  public:
+    CaptureRecord(void *pTracerUserData, api_id_t apiId, ze_result_t result)
+        : capture(*static_cast<ApiCapture *>(pTracerUserData)), lock(capture.mutex),
+          writer(capture.writer), apiId(apiId), result(result) {
+        writer.clear();
+    }
+    ~CaptureRecord() { capture.commit(apiId, result); }
+
+    template <typename T>
+    void put(const T &value) { writer.put(value); }
+    void handle(const void *handle) { writer.put(capture.getId(handle)); }
+    void newHandle(const void *handle) { writer.put(capture.assignId(handle)); }
+    void chain(const void *pNext) { writer.putChain(pNext); }
+
+    void handles(uint32_t count, const void *const *phHandles) {
+        writer.put(count);
+        for (uint32_t i = 0; i < count; i++)
+            handle(phHandles ? phHandles[i] : nullptr);
+    }
+
+    void pointer(const void *ptr) {
+        uint64_t id = 0, offset = 0;
+        capture.findAllocation(ptr, id, offset);
+        writer.put(id);
+        writer.put(offset);
+    }
+
+    void newAllocation(const void *ptr, size_t size) {
+        auto id = capture.assignId(ptr);
+        capture.addAllocation(ptr, size, id);
+        writer.put(id);
+    }
+
+    ApiCapture &capture;
+
+  private:
+    std::lock_guard<std::mutex> lock;
+    CaptureWriter &writer;
+    api_id_t apiId;
+    ze_result_t result;
+};
+
+// Failed calls are not recorded; NOT_READY is kept since it is the normal
+// outcome of polling and synchronizing with a timeout.
+#define CAPTURE_EPILOGUE(function, params_t) \
+    void ZE_APICALL function##Epilogue(params_t *params, ze_result_t result, void *pTracerUserData, void **)
+
+#define CAPTURE_BEGIN(function)                                            \
+    if (result != ZE_RESULT_SUCCESS && result != ZE_RESULT_NOT_READY)      \
+        return;                                                            \
+    CaptureRecord r(pTracerUserData, api_id_t::function, result)
+
+CAPTURE_EPILOGUE(zeDriverGet, ze_driver_get_params_t) {
+    if (*params->pphDrivers == nullptr)
+        return;
+    CAPTURE_BEGIN(zeDriverGet);
+    auto count = **params->ppCount;
+    r.put(count);
+    for (uint32_t i = 0; i < count; i++)
+        r.put(r.capture.getOrAssignId((*params->pphDrivers)[i]));
+}
+
+CAPTURE_EPILOGUE(zeDeviceGet, ze_device_get_params_t) {
+    if (*params->pphDevices == nullptr)
+        return;
+    CAPTURE_BEGIN(zeDeviceGet);
+    r.handle(*params->phDriver);
+    auto count = **params->ppCount;
+    r.put(count);
+    for (uint32_t i = 0; i < count; i++)
+        r.put(r.capture.getOrAssignId((*params->pphDevices)[i]));
+}
+
+CAPTURE_EPILOGUE(zeContextCreate, ze_context_create_params_t) {
+    CAPTURE_BEGIN(zeContextCreate);
+    r.handle(*params->phDriver);
+    r.put((*params->pdesc)->flags);
+    r.chain((*params->pdesc)->pNext);
+    r.newHandle(**params->pphContext);
+}
+
+CAPTURE_EPILOGUE(zeContextDestroy, ze_context_destroy_params_t) {
+    CAPTURE_BEGIN(zeContextDestroy);
+    r.handle(*params->phContext);
+}
+
+CAPTURE_EPILOGUE(zeCommandQueueCreate, ze_command_queue_create_params_t) {
+    CAPTURE_BEGIN(zeCommandQueueCreate);
+    r.handle(*params->phContext);
+    r.handle(*params->phDevice);
+    auto desc = *params->pdesc;
+    r.put(desc->ordinal);
+    r.put(desc->index);
+    r.put(desc->flags);
+    r.put(desc->mode);
+    r.put(desc->priority);
+    r.chain(desc->pNext);
+    r.newHandle(**params->pphCommandQueue);
+}
+
+CAPTURE_EPILOGUE(zeCommandQueueDestroy, ze_command_queue_destroy_params_t) {
+    CAPTURE_BEGIN(zeCommandQueueDestroy);
+    r.handle(*params->phCommandQueue);
+}
+
+CAPTURE_EPILOGUE(zeCommandQueueExecuteCommandLists, ze_command_queue_execute_command_lists_params_t) {
+    CAPTURE_BEGIN(zeCommandQueueExecuteCommandLists);
+    r.handle(*params->phCommandQueue);
+    r.handles(*params->pnumCommandLists, reinterpret_cast<const void *const *>(*params->pphCommandLists));
+    r.handle(*params->phFence);
+}
+
+CAPTURE_EPILOGUE(zeCommandQueueSynchronize, ze_command_queue_synchronize_params_t) {
+    CAPTURE_BEGIN(zeCommandQueueSynchronize);
+    r.handle(*params->phCommandQueue);
+    r.put(*params->ptimeout);
+}
+
+CAPTURE_EPILOGUE(zeCommandListCreate, ze_command_list_create_params_t) {
+    CAPTURE_BEGIN(zeCommandListCreate);
+    r.handle(*params->phContext);
+    r.handle(*params->phDevice);
+    auto desc = *params->pdesc;
+    r.put(desc->commandQueueGroupOrdinal);
+    r.put(desc->flags);
+    r.chain(desc->pNext);
+    r.newHandle(**params->pphCommandList);
+}
+
+CAPTURE_EPILOGUE(zeCommandListCreateImmediate, ze_command_list_create_immediate_params_t) {
+    CAPTURE_BEGIN(zeCommandListCreateImmediate);
+    r.handle(*params->phContext);
+    r.handle(*params->phDevice);
+    auto desc = *params->paltdesc;
+    r.put(desc->ordinal);
+    r.put(desc->index);
+    r.put(desc->flags);
+    r.put(desc->mode);
+    r.put(desc->priority);
+    r.chain(desc->pNext);
+    r.newHandle(**params->pphCommandList);
+}
+
+CAPTURE_EPILOGUE(zeCommandListClose, ze_command_list_close_params_t) {
+    CAPTURE_BEGIN(zeCommandListClose);
+    r.handle(*params->phCommandList);
+}
+
+CAPTURE_EPILOGUE(zeCommandListReset, ze_command_list_reset_params_t) {
+    CAPTURE_BEGIN(zeCommandListReset);
+    r.handle(*params->phCommandList);
+}
+
+CAPTURE_EPILOGUE(zeCommandListDestroy, ze_command_list_destroy_params_t) {
+    CAPTURE_BEGIN(zeCommandListDestroy);
+    r.handle(*params->phCommandList);
+}
+
+CAPTURE_EPILOGUE(zeCommandListHostSynchronize, ze_command_list_host_synchronize_params_t) {
+    CAPTURE_BEGIN(zeCommandListHostSynchronize);
+    r.handle(*params->phCommandList);
+    r.put(*params->ptimeout);
+}
+
+CAPTURE_EPILOGUE(zeCommandListAppendBarrier, ze_command_list_append_barrier_params_t) {
+    CAPTURE_BEGIN(zeCommandListAppendBarrier);
+    r.handle(*params->phCommandList);
+    r.handle(*params->phSignalEvent);
+    r.handles(*params->pnumWaitEvents, reinterpret_cast<const void *const *>(*params->pphWaitEvents));
+}
+
+CAPTURE_EPILOGUE(zeCommandListAppendMemoryCopy, ze_command_list_append_memory_copy_params_t) {
+    CAPTURE_BEGIN(zeCommandListAppendMemoryCopy);
+    r.handle(*params->phCommandList);
+    r.put(static_cast<uint64_t>(*params->psize));
+    r.pointer(*params->pdstptr);
+    r.pointer(*params->psrcptr);
+    r.handle(*params->phSignalEvent);
+    r.handles(*params->pnumWaitEvents, reinterpret_cast<const void *const *>(*params->pphWaitEvents));
+}
+
+CAPTURE_EPILOGUE(zeCommandListAppendMemoryFill, ze_command_list_append_memory_fill_params_t) {
+    CAPTURE_BEGIN(zeCommandListAppendMemoryFill);
+    r.handle(*params->phCommandList);
+    r.put(static_cast<uint64_t>(*params->psize));
+    r.pointer(*params->pptr);
+    auto patternSize = static_cast<uint32_t>(*params->ppattern_size);
+    r.put(patternSize);
+    r.capture.writer.putBytes(*params->ppattern, patternSize);
+    r.handle(*params->phSignalEvent);
+    r.handles(*params->pnumWaitEvents, reinterpret_cast<const void *const *>(*params->pphWaitEvents));
+}
+
+CAPTURE_EPILOGUE(zeCommandListAppendLaunchKernel, ze_command_list_append_launch_kernel_params_t) {
+    CAPTURE_BEGIN(zeCommandListAppendLaunchKernel);
+    r.handle(*params->phCommandList);
+    r.handle(*params->phKernel);
+    r.put(**params->ppLaunchFuncArgs);
+    r.handle(*params->phSignalEvent);
+    r.handles(*params->pnumWaitEvents, reinterpret_cast<const void *const *>(*params->pphWaitEvents));
+}
+
+CAPTURE_EPILOGUE(zeCommandListAppendSignalEvent, ze_command_list_append_signal_event_params_t) {
+    CAPTURE_BEGIN(zeCommandListAppendSignalEvent);
+    r.handle(*params->phCommandList);
+    r.handle(*params->phEvent);
+}
+
+CAPTURE_EPILOGUE(zeCommandListAppendWaitOnEvents, ze_command_list_append_wait_on_events_params_t) {
+    CAPTURE_BEGIN(zeCommandListAppendWaitOnEvents);
+    r.handle(*params->phCommandList);
+    r.handles(*params->pnumEvents, reinterpret_cast<const void *const *>(*params->pphEvents));
+}
+
+CAPTURE_EPILOGUE(zeCommandListAppendEventReset, ze_command_list_append_event_reset_params_t) {
+    CAPTURE_BEGIN(zeCommandListAppendEventReset);
+    r.handle(*params->phCommandList);
+    r.handle(*params->phEvent);
+}
+
+CAPTURE_EPILOGUE(zeEventPoolCreate, ze_event_pool_create_params_t) {
+    CAPTURE_BEGIN(zeEventPoolCreate);
+    r.handle(*params->phContext);
+    auto desc = *params->pdesc;
+    r.put(desc->flags);
+    r.put(desc->count);
+    r.chain(desc->pNext);
+    r.handles(*params->pnumDevices, reinterpret_cast<const void *const *>(*params->pphDevices));
+    r.newHandle(**params->pphEventPool);
+}
+
+CAPTURE_EPILOGUE(zeEventPoolDestroy, ze_event_pool_destroy_params_t) {
+    CAPTURE_BEGIN(zeEventPoolDestroy);
+    r.handle(*params->phEventPool);
+}
+
+CAPTURE_EPILOGUE(zeEventCreate, ze_event_create_params_t) {
+    CAPTURE_BEGIN(zeEventCreate);
+    r.handle(*params->phEventPool);
+    auto desc = *params->pdesc;
+    r.put(desc->index);
+    r.put(desc->signal);
+    r.put(desc->wait);
+    r.chain(desc->pNext);
+    r.newHandle(**params->pphEvent);
+}
+
+CAPTURE_EPILOGUE(zeEventDestroy, ze_event_destroy_params_t) {
+    CAPTURE_BEGIN(zeEventDestroy);
+    r.handle(*params->phEvent);
+}
+
+CAPTURE_EPILOGUE(zeEventHostSignal, ze_event_host_signal_params_t) {
+    CAPTURE_BEGIN(zeEventHostSignal);
+    r.handle(*params->phEvent);
+}
+
+CAPTURE_EPILOGUE(zeEventHostSynchronize, ze_event_host_synchronize_params_t) {
+    CAPTURE_BEGIN(zeEventHostSynchronize);
+    r.handle(*params->phEvent);
+    r.put(*params->ptimeout);
+}
+
+CAPTURE_EPILOGUE(zeEventQueryStatus, ze_event_query_status_params_t) {
+    CAPTURE_BEGIN(zeEventQueryStatus);
+    r.handle(*params->phEvent);
+}
+
+CAPTURE_EPILOGUE(zeEventHostReset, ze_event_host_reset_params_t) {
+    CAPTURE_BEGIN(zeEventHostReset);
+    r.handle(*params->phEvent);
+}
+
+CAPTURE_EPILOGUE(zeFenceCreate, ze_fence_create_params_t) {
+    CAPTURE_BEGIN(zeFenceCreate);
+    r.handle(*params->phCommandQueue);
+    r.put((*params->pdesc)->flags);
+    r.chain((*params->pdesc)->pNext);
+    r.newHandle(**params->pphFence);
+}
+
+CAPTURE_EPILOGUE(zeFenceDestroy, ze_fence_destroy_params_t) {
+    CAPTURE_BEGIN(zeFenceDestroy);
+    r.handle(*params->phFence);
+}
+
+CAPTURE_EPILOGUE(zeFenceHostSynchronize, ze_fence_host_synchronize_params_t) {
+    CAPTURE_BEGIN(zeFenceHostSynchronize);
+    r.handle(*params->phFence);
+    r.put(*params->ptimeout);
+}
+
+CAPTURE_EPILOGUE(zeFenceReset, ze_fence_reset_params_t) {
+    CAPTURE_BEGIN(zeFenceReset);
+    r.handle(*params->phFence);
+}
+
+CAPTURE_EPILOGUE(zeMemAllocDevice, ze_mem_alloc_device_params_t) {
+    CAPTURE_BEGIN(zeMemAllocDevice);
+    r.handle(*params->phContext);
+    auto desc = *params->pdevice_desc;
+    r.put(desc->flags);
+    r.put(desc->ordinal);
+    r.chain(desc->pNext);
+    r.put(static_cast<uint64_t>(*params->psize));
+    r.put(static_cast<uint64_t>(*params->palignment));
+    r.handle(*params->phDevice);
+    r.newAllocation(**params->ppptr, *params->psize);
+}
+
+CAPTURE_EPILOGUE(zeMemAllocHost, ze_mem_alloc_host_params_t) {
+    CAPTURE_BEGIN(zeMemAllocHost);
+    r.handle(*params->phContext);
+    auto desc = *params->phost_desc;
+    r.put(desc->flags);
+    r.chain(desc->pNext);
+    r.put(static_cast<uint64_t>(*params->psize));
+    r.put(static_cast<uint64_t>(*params->palignment));
+    r.newAllocation(**params->ppptr, *params->psize);
+}
+
+CAPTURE_EPILOGUE(zeMemAllocShared, ze_mem_alloc_shared_params_t) {
+    CAPTURE_BEGIN(zeMemAllocShared);
+    r.handle(*params->phContext);
+    auto deviceDesc = *params->pdevice_desc;
+    r.put(deviceDesc->flags);
+    r.put(deviceDesc->ordinal);
+    r.chain(deviceDesc->pNext);
+    auto hostDesc = *params->phost_desc;
+    r.put(hostDesc->flags);
+    r.chain(hostDesc->pNext);
+    r.put(static_cast<uint64_t>(*params->psize));
+    r.put(static_cast<uint64_t>(*params->palignment));
+    r.handle(*params->phDevice);
+    r.newAllocation(**params->ppptr, *params->psize);
+}
+
+CAPTURE_EPILOGUE(zeMemFree, ze_mem_free_params_t) {
+    CAPTURE_BEGIN(zeMemFree);
+    r.handle(*params->phContext);
+    r.pointer(*params->pptr);
+    r.capture.removeAllocation(*params->pptr);
+}
+
+CAPTURE_EPILOGUE(zeModuleCreate, ze_module_create_params_t) {
+    CAPTURE_BEGIN(zeModuleCreate);
+    r.handle(*params->phContext);
+    r.handle(*params->phDevice);
+    auto desc = *params->pdesc;
+    r.put(desc->format);
+    r.put(static_cast<uint64_t>(desc->inputSize));
+    r.capture.writer.putBytes(desc->pInputModule, desc->inputSize);
+    r.capture.writer.putString(desc->pBuildFlags);
+    r.chain(desc->pNext);
+    r.newHandle(**params->pphModule);
+}
+
+CAPTURE_EPILOGUE(zeModuleDestroy, ze_module_destroy_params_t) {
+    CAPTURE_BEGIN(zeModuleDestroy);
+    r.handle(*params->phModule);
+}
+
+CAPTURE_EPILOGUE(zeKernelCreate, ze_kernel_create_params_t) {
+    CAPTURE_BEGIN(zeKernelCreate);
+    r.handle(*params->phModule);
+    auto desc = *params->pdesc;
+    r.put(desc->flags);
+    r.capture.writer.putString(desc->pKernelName);
+    r.chain(desc->pNext);
+    r.newHandle(**params->pphKernel);
+}
+
+CAPTURE_EPILOGUE(zeKernelDestroy, ze_kernel_destroy_params_t) {
+    CAPTURE_BEGIN(zeKernelDestroy);
+    r.handle(*params->phKernel);
+}
+
+CAPTURE_EPILOGUE(zeKernelSetGroupSize, ze_kernel_set_group_size_params_t) {
+    CAPTURE_BEGIN(zeKernelSetGroupSize);
+    r.handle(*params->phKernel);
+    r.put(*params->pgroupSizeX);
+    r.put(*params->pgroupSizeY);
+    r.put(*params->pgroupSizeZ);
+}
+
+CAPTURE_EPILOGUE(zeKernelSetArgumentValue, ze_kernel_set_argument_value_params_t) {
+    CAPTURE_BEGIN(zeKernelSetArgumentValue);
+    r.handle(*params->phKernel);
+    r.put(*params->pargIndex);
+    auto argSize = static_cast<uint32_t>(*params->pargSize);
+    r.put(argSize);
+    auto pArgValue = *params->ppArgValue;
+
+    uint64_t id = 0, offset = 0;
+    if (pArgValue == nullptr) {
+        r.put(static_cast<uint32_t>(CAPTURE_ARG_NULL));
+    } else if (argSize == sizeof(void *) &&
+               r.capture.findAllocation(*static_cast<void *const *>(pArgValue), id, offset)) {
+        r.put(static_cast<uint32_t>(CAPTURE_ARG_POINTER));
+        r.put(id);
+        r.put(offset);
+    } else {
+        // Other handles passed by value (images, samplers) are not remapped.
+        r.put(static_cast<uint32_t>(CAPTURE_ARG_BYTES));
+        r.capture.writer.putBytes(pArgValue, argSize);
+    }
+}
+
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+ApiCapture *ApiCapture::create() {
+    std::string fileName = getenv_string("ZEL_TRACING_CAPTURE_FILE");
+    if (fileName.empty())
+        return nullptr;
+
+    auto capture = new ApiCapture;
+    capture->stream = fopen(fileName.c_str(), "wb");
+    if (capture->stream == nullptr) {
+        fprintf(stderr, "Unable to open capture file %s\n", fileName.c_str());
+        delete capture;
+        return nullptr;
+    }
+
+    capture_file_header_t header = {};
+    memcpy(header.magic, ZEL_CAPTURE_FILE_MAGIC, sizeof(header.magic));
+    header.version = ZEL_CAPTURE_FILE_VERSION;
+    header.apiCount = static_cast<uint32_t>(api_id_t::count);
+    fwrite(&header, sizeof(header), 1, capture->stream);
+
+    if (!capture->registerTracer()) {
+        fprintf(stderr, "Unable to register the capture tracer\n");
+        delete capture;
+        return nullptr;
+    }
+    return capture;
+}
+
+ApiCapture::~ApiCapture() {
+    if (stream)
+        fclose(stream);
+}
+
+#define CAPTURE_REGISTER(table, callback, function) epilogues.table.callback = function##Epilogue
+
+bool ApiCapture::registerTracer() {
+    zel_tracer_desc_t desc = {ZEL_STRUCTURE_TYPE_TRACER_DESC, nullptr, this};
+    if (createAPITracer(&desc, &hTracer) != ZE_RESULT_SUCCESS)
+        return false;
+
+    auto tracer = APITracer::fromHandle(hTracer);
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    auto &epilogues = tracer->getProEpilogues(ZEL_REGISTER_EPILOGUE, result);
+    if (result != ZE_RESULT_SUCCESS)
+        return false;
+
+    CAPTURE_REGISTER(Driver, pfnGetCb, zeDriverGet);
+    CAPTURE_REGISTER(Device, pfnGetCb, zeDeviceGet);
+    CAPTURE_REGISTER(Context, pfnCreateCb, zeContextCreate);
+    CAPTURE_REGISTER(Context, pfnDestroyCb, zeContextDestroy);
+    CAPTURE_REGISTER(CommandQueue, pfnCreateCb, zeCommandQueueCreate);
+    CAPTURE_REGISTER(CommandQueue, pfnDestroyCb, zeCommandQueueDestroy);
+    CAPTURE_REGISTER(CommandQueue, pfnExecuteCommandListsCb, zeCommandQueueExecuteCommandLists);
+    CAPTURE_REGISTER(CommandQueue, pfnSynchronizeCb, zeCommandQueueSynchronize);
+    CAPTURE_REGISTER(CommandList, pfnCreateCb, zeCommandListCreate);
+    CAPTURE_REGISTER(CommandList, pfnCreateImmediateCb, zeCommandListCreateImmediate);
+    CAPTURE_REGISTER(CommandList, pfnCloseCb, zeCommandListClose);
+    CAPTURE_REGISTER(CommandList, pfnResetCb, zeCommandListReset);
+    CAPTURE_REGISTER(CommandList, pfnDestroyCb, zeCommandListDestroy);
+    CAPTURE_REGISTER(CommandList, pfnHostSynchronizeCb, zeCommandListHostSynchronize);
+    CAPTURE_REGISTER(CommandList, pfnAppendBarrierCb, zeCommandListAppendBarrier);
+    CAPTURE_REGISTER(CommandList, pfnAppendMemoryCopyCb, zeCommandListAppendMemoryCopy);
+    CAPTURE_REGISTER(CommandList, pfnAppendMemoryFillCb, zeCommandListAppendMemoryFill);
+    CAPTURE_REGISTER(CommandList, pfnAppendLaunchKernelCb, zeCommandListAppendLaunchKernel);
+    CAPTURE_REGISTER(CommandList, pfnAppendSignalEventCb, zeCommandListAppendSignalEvent);
+    CAPTURE_REGISTER(CommandList, pfnAppendWaitOnEventsCb, zeCommandListAppendWaitOnEvents);
+    CAPTURE_REGISTER(CommandList, pfnAppendEventResetCb, zeCommandListAppendEventReset);
+    CAPTURE_REGISTER(EventPool, pfnCreateCb, zeEventPoolCreate);
+    CAPTURE_REGISTER(EventPool, pfnDestroyCb, zeEventPoolDestroy);
+    CAPTURE_REGISTER(Event, pfnCreateCb, zeEventCreate);
+    CAPTURE_REGISTER(Event, pfnDestroyCb, zeEventDestroy);
+    CAPTURE_REGISTER(Event, pfnHostSignalCb, zeEventHostSignal);
+    CAPTURE_REGISTER(Event, pfnHostSynchronizeCb, zeEventHostSynchronize);
+    CAPTURE_REGISTER(Event, pfnQueryStatusCb, zeEventQueryStatus);
+    CAPTURE_REGISTER(Event, pfnHostResetCb, zeEventHostReset);
+    CAPTURE_REGISTER(Fence, pfnCreateCb, zeFenceCreate);
+    CAPTURE_REGISTER(Fence, pfnDestroyCb, zeFenceDestroy);
+    CAPTURE_REGISTER(Fence, pfnHostSynchronizeCb, zeFenceHostSynchronize);
+    CAPTURE_REGISTER(Fence, pfnResetCb, zeFenceReset);
+    CAPTURE_REGISTER(Mem, pfnAllocDeviceCb, zeMemAllocDevice);
+    CAPTURE_REGISTER(Mem, pfnAllocHostCb, zeMemAllocHost);
+    CAPTURE_REGISTER(Mem, pfnAllocSharedCb, zeMemAllocShared);
+    CAPTURE_REGISTER(Mem, pfnFreeCb, zeMemFree);
+    CAPTURE_REGISTER(Module, pfnCreateCb, zeModuleCreate);
+    CAPTURE_REGISTER(Module, pfnDestroyCb, zeModuleDestroy);
+    CAPTURE_REGISTER(Kernel, pfnCreateCb, zeKernelCreate);
+    CAPTURE_REGISTER(Kernel, pfnDestroyCb, zeKernelDestroy);
+    CAPTURE_REGISTER(Kernel, pfnSetGroupSizeCb, zeKernelSetGroupSize);
+    CAPTURE_REGISTER(Kernel, pfnSetArgumentValueCb, zeKernelSetArgumentValue);
+
+    return tracer->enableTracer(true) == ZE_RESULT_SUCCESS;
+}
+
+uint64_t ApiCapture::getId(const void *handle) {
+    if (handle == nullptr)
+        return 0;
+    auto it = ids.find(handle);
+    return (it != ids.end()) ? it->second : 0;
+}
+
+uint64_t ApiCapture::assignId(const void *handle) {
+    if (handle == nullptr)
+        return 0;
+    // Drivers may reuse the address of a destroyed object, in which case
+    // the new object gets a new id.
+    auto id = nextId++;
+    ids[handle] = id;
+    return id;
+}
+
+uint64_t ApiCapture::getOrAssignId(const void *handle) {
+    auto id = getId(handle);
+    return id ? id : assignId(handle);
+}
+
+void ApiCapture::addAllocation(const void *ptr, size_t size, uint64_t id) {
+    allocations[reinterpret_cast<uintptr_t>(ptr)] = std::make_pair(size, id);
+}
+
+void ApiCapture::removeAllocation(const void *ptr) {
+    allocations.erase(reinterpret_cast<uintptr_t>(ptr));
+}
+
+bool ApiCapture::findAllocation(const void *ptr, uint64_t &id, uint64_t &offset) {
+    auto address = reinterpret_cast<uintptr_t>(ptr);
+    auto it = allocations.upper_bound(address);
+    if (it == allocations.begin())
+        return false;
+    --it;
+    if (address - it->first >= it->second.first)
+        return false;
+    id = it->second.second;
+    offset = address - it->first;
+    return true;
+}
+
+void ApiCapture::commit(api_id_t apiId, ze_result_t result) {
+    if (captureThreadId == 0)
+        captureThreadId = nextCaptureThreadId++;
+
+    capture_record_header_t header = {};
+    header.apiId = static_cast<uint32_t>(apiId);
+    header.payloadSize = static_cast<uint32_t>(writer.data.size());
+    header.result = static_cast<int32_t>(result);
+    header.threadId = captureThreadId;
+    fwrite(&header, sizeof(header), 1, stream);
+    fwrite(writer.data.data(), 1, writer.data.size(), stream);
+}
+
+} // namespace tracing_layer
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "capture_format.h"
+#include "layers/zel_tracing_api.h"
+
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+namespace tracing_layer {
+
+// Serializes the API call stream to ZEL_TRACING_CAPTURE_FILE so that it can
+// be re-issued later with zel_replay. Calls are recorded from tracer
+// epilogues, in the order in which they complete. See capture_format.h for
+// the file layout and README.md for the list of recorded functions.
+class ApiCapture {
+  public:
+    static ApiCapture *create();
+    ~ApiCapture();
+
+    uint64_t getId(const void *handle);
+    uint64_t assignId(const void *handle);
+    uint64_t getOrAssignId(const void *handle);
+
+    void addAllocation(const void *ptr, size_t size, uint64_t id);
+    void removeAllocation(const void *ptr);
+    bool findAllocation(const void *ptr, uint64_t &id, uint64_t &offset);
+
+    void commit(api_id_t apiId, ze_result_t result);
+
+    std::mutex mutex;
+    CaptureWriter writer;
+
+  private:
+    ApiCapture() = default;
+    bool registerTracer();
+
+    FILE *stream = nullptr;
+    zel_tracer_handle_t hTracer = nullptr;
+    uint64_t nextId = 1;
+    std::unordered_map<const void *, uint64_t> ids;
+    std::map<uintptr_t, std::pair<size_t, uint64_t>> allocations;
+};
+
+extern ApiCapture *pApiCapture;
+
+} // namespace tracing_layer
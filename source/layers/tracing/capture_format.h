@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "ze_api.h"
+#include "ze_tracing_api_ids.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace tracing_layer {
+
+// Capture file layout:
+//   capture_file_header_t
+//   { capture_record_header_t; payload[payloadSize]; }...
+//
+// Handles are written as stable ids in creation order (0 is nullptr).
+// Memory addresses are written as an allocation id plus an offset; an
+// allocation id of 0 means host memory not allocated through the API, of
+// which only the size matters for replay. Descriptors are written field
+// by field, followed by their pNext chain (see CaptureWriter::putChain).
+#define ZEL_CAPTURE_FILE_MAGIC "ZELCAPTR"
+#define ZEL_CAPTURE_FILE_VERSION 1
+
+typedef struct capture_file_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t apiCount;
+} capture_file_header_t;
+
+typedef struct capture_record_header {
+    uint32_t apiId;
+    uint32_t payloadSize;
+    int32_t result;
+    uint32_t threadId;
+} capture_record_header_t;
+
+typedef enum capture_arg_kind {
+    CAPTURE_ARG_NULL = 0,    // pArgValue was nullptr (local memory)
+    CAPTURE_ARG_BYTES = 1,   // plain value
+    CAPTURE_ARG_POINTER = 2, // value is an address inside an API allocation
+} capture_arg_kind_t;
+
+// Extension structures that contain no pointers besides pNext, and can
+// therefore be captured as plain bytes. Other chain elements are recorded
+// with a size of 0 and dropped on replay.
+inline size_t getCapturableExtensionSize(ze_structure_type_t stype) {
+    switch (stype) {
+    case ZE_STRUCTURE_TYPE_RELAXED_ALLOCATION_LIMITS_EXP_DESC:
+        return sizeof(ze_relaxed_allocation_limits_exp_desc_t);
+    case ZE_STRUCTURE_TYPE_EXTERNAL_MEMORY_EXPORT_DESC:
+        return sizeof(ze_external_memory_export_desc_t);
+    case ZE_STRUCTURE_TYPE_MEMORY_COMPRESSION_HINTS_EXT_DESC:
+        return sizeof(ze_memory_compression_hints_ext_desc_t);
+    case ZE_STRUCTURE_TYPE_RAYTRACING_MEM_ALLOC_EXT_DESC:
+        return sizeof(ze_raytracing_mem_alloc_ext_desc_t);
+    case ZE_STRUCTURE_TYPE_COUNTER_BASED_EVENT_POOL_EXP_DESC:
+        return sizeof(ze_event_pool_counter_based_exp_desc_t);
+    default:
+        return 0;
+    }
+}
+
+class CaptureWriter {
+  public:
+    void clear() { data.clear(); }
+
+    template <typename T>
+    void put(const T &value) {
+        putBytes(&value, sizeof(T));
+    }
+
+    void putBytes(const void *bytes, size_t size) {
+        auto p = static_cast<const uint8_t *>(bytes);
+        data.insert(data.end(), p, p + size);
+    }
+
+    void putString(const char *str) {
+        uint32_t length = str ? static_cast<uint32_t>(strlen(str)) : 0;
+        put(length);
+        putBytes(str, length);
+    }
+
+    // { uint32_t count; { uint32_t stype; uint32_t size; bytes[size]; }... }
+    void putChain(const void *pNext) {
+        uint32_t count = 0;
+        for (auto p = static_cast<const ze_base_desc_t *>(pNext); p; p = static_cast<const ze_base_desc_t *>(p->pNext))
+            count++;
+        put(count);
+        for (auto p = static_cast<const ze_base_desc_t *>(pNext); p; p = static_cast<const ze_base_desc_t *>(p->pNext)) {
+            auto size = static_cast<uint32_t>(getCapturableExtensionSize(p->stype));
+            put(static_cast<uint32_t>(p->stype));
+            put(size);
+            putBytes(p, size);
+        }
+    }
+
+    std::vector<uint8_t> data;
+};
+
+class CaptureReader {
+  public:
+    CaptureReader(const uint8_t *data, size_t size) : data(data), size(size) {}
+
+    template <typename T>
+    T get() {
+        T value = {};
+        getBytes(&value, sizeof(T));
+        return value;
+    }
+
+    void getBytes(void *bytes, size_t length) {
+        if (offset + length > size) {
+            overrun = true;
+            return;
+        }
+        memcpy(bytes, data + offset, length);
+        offset += length;
+    }
+
+    std::string getString() {
+        auto length = get<uint32_t>();
+        std::string str(length, '\0');
+        if (length)
+            getBytes(&str[0], length);
+        return str;
+    }
+
+    // Rebuilds a pNext chain into storage, which must outlive its use.
+    // Returns the number of chain elements that could not be restored.
+    uint32_t getChain(std::vector<std::vector<uint8_t>> &storage, const void **ppNext) {
+        uint32_t dropped = 0;
+        auto count = get<uint32_t>();
+        storage.clear();
+        *ppNext = nullptr;
+        ze_base_desc_t *last = nullptr;
+        for (uint32_t i = 0; i < count; i++) {
+            get<uint32_t>(); // stype
+            auto elementSize = get<uint32_t>();
+            if (elementSize == 0) {
+                dropped++;
+                continue;
+            }
+            storage.emplace_back(elementSize);
+            getBytes(storage.back().data(), elementSize);
+            auto element = reinterpret_cast<ze_base_desc_t *>(storage.back().data());
+            element->pNext = nullptr;
+            if (last)
+                last->pNext = element;
+            else
+                *ppNext = element;
+            last = element;
+        }
+        return dropped;
+    }
+
+    bool overrun = false;
+
+  private:
+    const uint8_t *data;
+    size_t size;
+    size_t offset = 0;
+};
+
+} // namespace tracing_layer
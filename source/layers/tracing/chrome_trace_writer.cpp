@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "trace_export.h"
+
+#include <cinttypes>
+
+#if defined(_WIN32)
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace tracing_layer {
+
+uint32_t getCurrentProcessId() {
+#if defined(_WIN32)
+    return static_cast<uint32_t>(_getpid());
+#else
+    return static_cast<uint32_t>(getpid());
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void ChromeTraceWriter::writeBegin() {
+    fputs("[\n", stream);
+}
+
+void ChromeTraceWriter::writeEvent(const trace_record_t &record, const char *apiName, uint32_t processId) {
+    fprintf(stream,
+            "%s{\"name\":\"%s\",\"cat\":\"ze\",\"ph\":\"X\",\"pid\":%" PRIu32 ",\"tid\":%" PRIu32
+            ",\"ts\":%" PRIu64 ".%03" PRIu64 ",\"dur\":%" PRIu64 ".%03" PRIu64
+            ",\"args\":{\"result\":\"0x%" PRIx32 "\"",
+            firstEvent ? "" : ",\n",
+            apiName, processId, record.threadId,
+            record.start / 1000, record.start % 1000,
+            record.duration / 1000, record.duration % 1000,
+            static_cast<uint32_t>(record.result));
+    if (record.hCommandList)
+        fprintf(stream, ",\"hCommandList\":\"0x%" PRIx64 "\"", record.hCommandList);
+    if (record.hCommandQueue)
+        fprintf(stream, ",\"hCommandQueue\":\"0x%" PRIx64 "\"", record.hCommandQueue);
+    fputs("}}", stream);
+    firstEvent = false;
+}
+
+void ChromeTraceWriter::writeEnd() {
+    fputs("\n]\n", stream);
+}
+
+} // namespace tracing_layer
@@ -0,0 +1,455 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "kernel_timing.h"
+#include "ze_tracing_layer.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+
+namespace tracing_layer {
+
+KernelTimer *pKernelTimer = nullptr;
+
+///////////////////////////////////////////////////////////////////////////////
+// Tracer callbacks. The layer registers them as an ordinary tracer, so they
+// run inside the intercepts and may replace the signal event argument.
+namespace {
+
+template <typename TParams>
+void ZE_APICALL launchPrologue(TParams *params, ze_result_t, void *pTracerUserData, void **ppTracerInstanceUserData) {
+    *ppTracerInstanceUserData = nullptr;
+    if (*params->phSignalEvent != nullptr)
+        return;
+    auto timer = static_cast<KernelTimer *>(pTracerUserData);
+    auto launch = timer->beginLaunch(*params->phCommandList, *params->phKernel);
+    if (launch) {
+        *params->phSignalEvent = launch->hEvent;
+        *ppTracerInstanceUserData = launch;
+    }
+}
+
+template <typename TParams>
+void ZE_APICALL launchEpilogue(TParams *params, ze_result_t result, void *pTracerUserData, void **ppTracerInstanceUserData) {
+    auto launch = static_cast<KernelTimer::launch_t *>(*ppTracerInstanceUserData);
+    if (launch == nullptr)
+        return;
+    // Don't hand the internal event back to the application's view of the call.
+    *params->phSignalEvent = nullptr;
+    static_cast<KernelTimer *>(pTracerUserData)->endLaunch(*params->phCommandList, launch, result);
+}
+
+void ZE_APICALL commandListCreateEpilogue(ze_command_list_create_params_t *params, ze_result_t result, void *pTracerUserData, void **) {
+    if (result == ZE_RESULT_SUCCESS)
+        static_cast<KernelTimer *>(pTracerUserData)->onCommandListCreate(*params->phContext, *params->phDevice, **params->pphCommandList, false);
+}
+
+void ZE_APICALL commandListCreateImmediateEpilogue(ze_command_list_create_immediate_params_t *params, ze_result_t result, void *pTracerUserData, void **) {
+    if (result == ZE_RESULT_SUCCESS)
+        static_cast<KernelTimer *>(pTracerUserData)->onCommandListCreate(*params->phContext, *params->phDevice, **params->pphCommandList, true);
+}
+
+void ZE_APICALL commandListResetEpilogue(ze_command_list_reset_params_t *params, ze_result_t result, void *pTracerUserData, void **) {
+    if (result == ZE_RESULT_SUCCESS)
+        static_cast<KernelTimer *>(pTracerUserData)->onCommandListReset(*params->phCommandList);
+}
+
+void ZE_APICALL commandListDestroyEpilogue(ze_command_list_destroy_params_t *params, ze_result_t result, void *pTracerUserData, void **) {
+    if (result == ZE_RESULT_SUCCESS)
+        static_cast<KernelTimer *>(pTracerUserData)->onCommandListDestroy(*params->phCommandList);
+}
+
+void ZE_APICALL executeCommandListsEpilogue(ze_command_queue_execute_command_lists_params_t *params, ze_result_t result, void *pTracerUserData, void **) {
+    if (result == ZE_RESULT_SUCCESS)
+        static_cast<KernelTimer *>(pTracerUserData)->onExecute(*params->pnumCommandLists, *params->pphCommandLists);
+}
+
+template <typename TParams>
+void ZE_APICALL synchronizeEpilogue(TParams *, ze_result_t result, void *pTracerUserData, void **) {
+    if (result == ZE_RESULT_SUCCESS)
+        static_cast<KernelTimer *>(pTracerUserData)->harvest();
+}
+
+void ZE_APICALL kernelCreateEpilogue(ze_kernel_create_params_t *params, ze_result_t result, void *pTracerUserData, void **) {
+    if (result == ZE_RESULT_SUCCESS)
+        static_cast<KernelTimer *>(pTracerUserData)->onKernelCreate(**params->pphKernel, (*params->pdesc)->pKernelName);
+}
+
+void ZE_APICALL kernelDestroyEpilogue(ze_kernel_destroy_params_t *params, ze_result_t result, void *pTracerUserData, void **) {
+    if (result == ZE_RESULT_SUCCESS)
+        static_cast<KernelTimer *>(pTracerUserData)->onKernelDestroy(*params->phKernel);
+}
+
+void ZE_APICALL contextDestroyPrologue(ze_context_destroy_params_t *params, ze_result_t, void *pTracerUserData, void **) {
+    static_cast<KernelTimer *>(pTracerUserData)->onContextDestroy(*params->phContext);
+}
+
+void releaseEventsAtExit() {
+    if (pKernelTimer)
+        pKernelTimer->releaseEvents();
+}
+
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////
+void KernelTimer::histogram_t::add(uint64_t duration) {
+    count++;
+    total += duration;
+    min = std::min(min, duration);
+    max = std::max(max, duration);
+    size_t bucket = 0;
+    for (uint64_t us = duration / 1000; us && bucket < bucketCount - 1; us >>= 1)
+        bucket++;
+    buckets[bucket]++;
+}
+
+KernelTimer *KernelTimer::create() {
+    if (!getenv_tobool("ZEL_TRACING_KERNEL_TIMING"))
+        return nullptr;
+
+    auto timer = new KernelTimer;
+    timer->maxEvents = 65536;
+    std::string maxEvents = getenv_string("ZEL_TRACING_KERNEL_TIMING_MAX_EVENTS");
+    if (!maxEvents.empty()) {
+        char *end = nullptr;
+        auto value = strtoul(maxEvents.c_str(), &end, 10);
+        if (end != maxEvents.c_str() && *end == '\0' && value <= UINT32_MAX)
+            timer->maxEvents = static_cast<uint32_t>(value);
+        else
+            fprintf(stderr, "Ignoring invalid value ZEL_TRACING_KERNEL_TIMING_MAX_EVENTS=%s\n", maxEvents.c_str());
+    }
+    if (!timer->registerTracer()) {
+        fprintf(stderr, "Unable to register the kernel timing tracer\n");
+        delete timer;
+        return nullptr;
+    }
+    return timer;
+}
+
+KernelTimer::~KernelTimer() {
+    // The driver may already be gone at unload, so the internal events and
+    // pools were released by releaseEvents() at exit.
+    report();
+    for (auto launch : allLaunches)
+        delete launch;
+}
+
+bool KernelTimer::registerTracer() {
+    zel_tracer_desc_t desc = {ZEL_STRUCTURE_TYPE_TRACER_DESC, nullptr, this};
+    if (createAPITracer(&desc, &hTracer) != ZE_RESULT_SUCCESS)
+        return false;
+
+    auto tracer = APITracer::fromHandle(hTracer);
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    auto &prologues = tracer->getProEpilogues(ZEL_REGISTER_PROLOGUE, result);
+    auto &epilogues = tracer->getProEpilogues(ZEL_REGISTER_EPILOGUE, result);
+    if (result != ZE_RESULT_SUCCESS)
+        return false;
+
+    prologues.CommandList.pfnAppendLaunchKernelCb = launchPrologue<ze_command_list_append_launch_kernel_params_t>;
+    prologues.CommandList.pfnAppendLaunchCooperativeKernelCb = launchPrologue<ze_command_list_append_launch_cooperative_kernel_params_t>;
+    prologues.CommandList.pfnAppendLaunchKernelIndirectCb = launchPrologue<ze_command_list_append_launch_kernel_indirect_params_t>;
+    epilogues.CommandList.pfnAppendLaunchKernelCb = launchEpilogue<ze_command_list_append_launch_kernel_params_t>;
+    epilogues.CommandList.pfnAppendLaunchCooperativeKernelCb = launchEpilogue<ze_command_list_append_launch_cooperative_kernel_params_t>;
+    epilogues.CommandList.pfnAppendLaunchKernelIndirectCb = launchEpilogue<ze_command_list_append_launch_kernel_indirect_params_t>;
+
+    epilogues.CommandList.pfnCreateCb = commandListCreateEpilogue;
+    epilogues.CommandList.pfnCreateImmediateCb = commandListCreateImmediateEpilogue;
+    epilogues.CommandList.pfnResetCb = commandListResetEpilogue;
+    epilogues.CommandList.pfnDestroyCb = commandListDestroyEpilogue;
+    epilogues.CommandQueue.pfnExecuteCommandListsCb = executeCommandListsEpilogue;
+
+    epilogues.CommandQueue.pfnSynchronizeCb = synchronizeEpilogue<ze_command_queue_synchronize_params_t>;
+    epilogues.CommandList.pfnHostSynchronizeCb = synchronizeEpilogue<ze_command_list_host_synchronize_params_t>;
+    epilogues.Fence.pfnHostSynchronizeCb = synchronizeEpilogue<ze_fence_host_synchronize_params_t>;
+    epilogues.Event.pfnHostSynchronizeCb = synchronizeEpilogue<ze_event_host_synchronize_params_t>;
+
+    epilogues.Kernel.pfnCreateCb = kernelCreateEpilogue;
+    epilogues.Kernel.pfnDestroyCb = kernelDestroyEpilogue;
+    prologues.Context.pfnDestroyCb = contextDestroyPrologue;
+
+    return tracer->enableTracer(true) == ZE_RESULT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ze_event_handle_t KernelTimer::acquireEvent(ze_context_handle_t hContext) {
+    auto &cache = eventPools[hContext];
+    if (cache.freeEvents.empty()) {
+        if (eventCount >= maxEvents)
+            return nullptr;
+        // Exit handlers run in the reverse order they were registered, or
+        // when the layer is unloaded. Registered once the layers and drivers
+        // below are loaded, this one runs before they are torn down.
+        if (!releaseAtExit) {
+            releaseAtExit = true;
+            atexit(releaseEventsAtExit);
+        }
+        // Grow geometrically so that steady state needs no new pools.
+        ze_event_pool_desc_t poolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC, nullptr,
+                                         ZE_EVENT_POOL_FLAG_HOST_VISIBLE | ZE_EVENT_POOL_FLAG_KERNEL_TIMESTAMP,
+                                         std::min(cache.nextPoolSize, maxEvents - eventCount)};
+        ze_event_pool_handle_t hEventPool = nullptr;
+        if (context.zeDdiTable.EventPool.pfnCreate(hContext, &poolDesc, 0, nullptr, &hEventPool) != ZE_RESULT_SUCCESS)
+            return nullptr;
+        cache.pools.push_back(hEventPool);
+        for (uint32_t i = 0; i < poolDesc.count; i++) {
+            ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC, nullptr, i,
+                                         ZE_EVENT_SCOPE_FLAG_HOST, ZE_EVENT_SCOPE_FLAG_HOST};
+            ze_event_handle_t hEvent = nullptr;
+            if (context.zeDdiTable.Event.pfnCreate(hEventPool, &eventDesc, &hEvent) == ZE_RESULT_SUCCESS) {
+                cache.events.push_back(hEvent);
+                cache.freeEvents.push_back(hEvent);
+            }
+        }
+        cache.capacity += poolDesc.count;
+        eventCount += poolDesc.count;
+        cache.nextPoolSize = std::min(cache.nextPoolSize * 2, 4096u);
+        if (cache.freeEvents.empty())
+            return nullptr;
+    }
+    auto hEvent = cache.freeEvents.back();
+    cache.freeEvents.pop_back();
+    return hEvent;
+}
+
+// Releases the events and pools of a context, including the events of
+// launches not harvested yet, which are dropped: the context is being
+// destroyed, or the process exits.
+KernelTimer::event_pool_map_t::iterator KernelTimer::releaseContext(event_pool_map_t::iterator cache) {
+    auto hContext = cache->first;
+    for (auto launch : allLaunches) {
+        if (launch->hEvent == nullptr || launch->hContext != hContext)
+            continue;
+        launch->hEvent = nullptr;
+        launch->inFlight = false;
+        freeLaunches.push_back(launch);
+    }
+    inFlight.erase(std::remove_if(inFlight.begin(), inFlight.end(),
+                                  [](launch_t *launch) { return launch->hEvent == nullptr; }),
+                   inFlight.end());
+    for (auto list = commandLists.begin(); list != commandLists.end();) {
+        if (list->second.hContext == hContext)
+            list = commandLists.erase(list);
+        else
+            ++list;
+    }
+
+    for (auto hEvent : cache->second.events)
+        context.zeDdiTable.Event.pfnDestroy(hEvent);
+    for (auto hEventPool : cache->second.pools)
+        context.zeDdiTable.EventPool.pfnDestroy(hEventPool);
+    eventCount -= cache->second.capacity;
+    return eventPools.erase(cache);
+}
+
+void KernelTimer::releaseLaunch(launch_t *launch) {
+    if (launch->inFlight) {
+        auto it = std::find(inFlight.begin(), inFlight.end(), launch);
+        if (it != inFlight.end()) {
+            *it = inFlight.back();
+            inFlight.pop_back();
+        }
+        launch->inFlight = false;
+    }
+    context.zeDdiTable.Event.pfnHostReset(launch->hEvent);
+    eventPools[launch->hContext].freeEvents.push_back(launch->hEvent);
+    launch->hEvent = nullptr;
+    freeLaunches.push_back(launch);
+}
+
+KernelTimer::launch_t *KernelTimer::beginLaunch(ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto list = commandLists.find(hCommandList);
+    if (list == commandLists.end())
+        return nullptr;
+
+    auto hEvent = acquireEvent(list->second.hContext);
+    if (hEvent == nullptr) {
+        untimedLaunches++;
+        return nullptr;
+    }
+
+    launch_t *launch = nullptr;
+    if (freeLaunches.empty()) {
+        launch = new launch_t;
+        allLaunches.push_back(launch);
+    } else {
+        launch = freeLaunches.back();
+        freeLaunches.pop_back();
+    }
+
+    auto kernel = kernels.find(hKernel);
+    launch->hEvent = hEvent;
+    launch->hContext = list->second.hContext;
+    launch->histogram = (kernel != kernels.end()) ? kernel->second : &histograms["<unknown>"];
+    launch->device = list->second.device;
+    launch->immediate = list->second.immediate;
+    launch->inFlight = false;
+    return launch;
+}
+
+void KernelTimer::endLaunch(ze_command_list_handle_t hCommandList, launch_t *launch, ze_result_t result) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (result != ZE_RESULT_SUCCESS) {
+        releaseLaunch(launch);
+        return;
+    }
+
+    if (launch->immediate) {
+        launch->inFlight = true;
+        inFlight.push_back(launch);
+    } else {
+        // Regular command lists keep their events until they are reset or
+        // destroyed, since they may be executed again.
+        commandLists[hCommandList].launches.push_back(launch);
+    }
+}
+
+void KernelTimer::onCommandListCreate(ze_context_handle_t hContext, ze_device_handle_t hDevice,
+                                      ze_command_list_handle_t hCommandList, bool immediate) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto device = devices.find(hDevice);
+    if (device == devices.end()) {
+        device_info_t info;
+        ze_device_properties_t properties = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES};
+        if (context.zeDdiTable.Device.pfnGetProperties(hDevice, &properties) == ZE_RESULT_SUCCESS) {
+            if (properties.timerResolution)
+                info.timerResolution = static_cast<double>(properties.timerResolution);
+            if (properties.kernelTimestampValidBits && properties.kernelTimestampValidBits < 64)
+                info.validBitsMask = (1ull << properties.kernelTimestampValidBits) - 1;
+        }
+        device = devices.emplace(hDevice, info).first;
+    }
+
+    auto &list = commandLists[hCommandList];
+    list.hContext = hContext;
+    list.device = &device->second;
+    list.immediate = immediate;
+    list.launches.clear();
+}
+
+void KernelTimer::onCommandListReset(ze_command_list_handle_t hCommandList) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto list = commandLists.find(hCommandList);
+    if (list == commandLists.end())
+        return;
+    for (auto launch : list->second.launches)
+        releaseLaunch(launch);
+    list->second.launches.clear();
+}
+
+void KernelTimer::onCommandListDestroy(ze_command_list_handle_t hCommandList) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto list = commandLists.find(hCommandList);
+    if (list == commandLists.end())
+        return;
+    for (auto launch : list->second.launches)
+        releaseLaunch(launch);
+    commandLists.erase(list);
+}
+
+void KernelTimer::onExecute(uint32_t numCommandLists, ze_command_list_handle_t *phCommandLists) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (uint32_t i = 0; i < numCommandLists; i++) {
+        auto list = commandLists.find(phCommandLists[i]);
+        if (list == commandLists.end())
+            continue;
+        for (auto launch : list->second.launches) {
+            if (!launch->inFlight) {
+                launch->inFlight = true;
+                inFlight.push_back(launch);
+            }
+        }
+    }
+}
+
+void KernelTimer::onKernelCreate(ze_kernel_handle_t hKernel, const char *name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    kernels[hKernel] = &histograms[name ? name : "<unknown>"];
+}
+
+void KernelTimer::onKernelDestroy(ze_kernel_handle_t hKernel) {
+    std::lock_guard<std::mutex> lock(mutex);
+    kernels.erase(hKernel);
+}
+
+void KernelTimer::onContextDestroy(ze_context_handle_t hContext) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto cache = eventPools.find(hContext);
+    if (cache != eventPools.end())
+        releaseContext(cache);
+}
+
+void KernelTimer::releaseEvents() {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (auto cache = eventPools.begin(); cache != eventPools.end();)
+        cache = releaseContext(cache);
+}
+
+void KernelTimer::harvest() {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    for (size_t i = 0; i < inFlight.size();) {
+        auto launch = inFlight[i];
+        if (context.zeDdiTable.Event.pfnQueryStatus(launch->hEvent) != ZE_RESULT_SUCCESS) {
+            i++;
+            continue;
+        }
+
+        ze_kernel_timestamp_result_t timestamp = {};
+        if (context.zeDdiTable.Event.pfnQueryKernelTimestamp(launch->hEvent, &timestamp) == ZE_RESULT_SUCCESS) {
+            auto ticks = (timestamp.context.kernelEnd - timestamp.context.kernelStart) & launch->device->validBitsMask;
+            launch->histogram->add(static_cast<uint64_t>(ticks * launch->device->timerResolution));
+        }
+
+        inFlight[i] = inFlight.back();
+        inFlight.pop_back();
+        launch->inFlight = false;
+
+        if (launch->immediate) {
+            releaseLaunch(launch);
+        } else {
+            context.zeDdiTable.Event.pfnHostReset(launch->hEvent);
+        }
+    }
+}
+
+void KernelTimer::report() {
+    fprintf(stderr, "\nKernel timing report (device time in microseconds)\n");
+    fprintf(stderr, "%-40s %10s %14s %12s %12s %12s\n", "kernel", "count", "total", "mean", "min", "max");
+    for (auto &entry : histograms) {
+        auto &histogram = entry.second;
+        if (histogram.count == 0)
+            continue;
+        fprintf(stderr, "%-40s %10" PRIu64 " %14.3f %12.3f %12.3f %12.3f\n",
+                entry.first.c_str(), histogram.count,
+                histogram.total / 1000.0,
+                histogram.total / 1000.0 / histogram.count,
+                histogram.min / 1000.0,
+                histogram.max / 1000.0);
+        for (size_t i = 0; i < histogram_t::bucketCount; i++) {
+            if (histogram.buckets[i] == 0)
+                continue;
+            uint64_t low = i ? (static_cast<uint64_t>(1) << (i - 1)) : 0;
+            fprintf(stderr, "    [%" PRIu64 ", %" PRIu64 ") us: %" PRIu64 "\n", low, static_cast<uint64_t>(1) << i, histogram.buckets[i]);
+        }
+    }
+    if (untimedLaunches)
+        fprintf(stderr, "%" PRIu64 " launches not timed: all %" PRIu32 " events were in use\n", untimedLaunches, maxEvents);
+}
+
+} // namespace tracing_layer
@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "ze_api.h"
+#include "layers/zel_tracing_api.h"
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace tracing_layer {
+
+// Measures the device duration of kernels launched without a signal
+// event. Such launches get a timestamp event from an internal pool; the
+// timestamps are harvested after the application synchronizes and are
+// accumulated into per-kernel-name histograms, which are reported when the
+// layer is unloaded. Enabled with ZEL_TRACING_KERNEL_TIMING=1.
+//
+// The layer creates at most ZEL_TRACING_KERNEL_TIMING_MAX_EVENTS events;
+// launches made while all of them are in use are counted but not timed.
+class KernelTimer {
+  public:
+    static KernelTimer *create();
+    ~KernelTimer();
+
+    struct histogram_t {
+        static constexpr size_t bucketCount = 32; // power of two microseconds
+        uint64_t count = 0;
+        uint64_t total = 0;
+        uint64_t min = UINT64_MAX;
+        uint64_t max = 0;
+        uint64_t buckets[bucketCount] = {};
+        void add(uint64_t duration);
+    };
+
+    struct device_info_t {
+        double timerResolution = 1.0; // nanoseconds per tick
+        uint64_t validBitsMask = UINT64_MAX;
+    };
+
+    struct launch_t {
+        ze_event_handle_t hEvent = nullptr;
+        ze_context_handle_t hContext = nullptr;
+        histogram_t *histogram = nullptr;
+        device_info_t *device = nullptr;
+        bool immediate = false;
+        bool inFlight = false;
+    };
+
+    struct command_list_info_t {
+        ze_context_handle_t hContext = nullptr;
+        device_info_t *device = nullptr;
+        bool immediate = false;
+        std::vector<launch_t *> launches;
+    };
+
+    struct event_pool_cache_t {
+        std::vector<ze_event_pool_handle_t> pools;
+        std::vector<ze_event_handle_t> events;
+        std::vector<ze_event_handle_t> freeEvents;
+        uint32_t capacity = 0;
+        uint32_t nextPoolSize = 64;
+    };
+
+    launch_t *beginLaunch(ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel);
+    void endLaunch(ze_command_list_handle_t hCommandList, launch_t *launch, ze_result_t result);
+
+    void onCommandListCreate(ze_context_handle_t hContext, ze_device_handle_t hDevice,
+                             ze_command_list_handle_t hCommandList, bool immediate);
+    void onCommandListReset(ze_command_list_handle_t hCommandList);
+    void onCommandListDestroy(ze_command_list_handle_t hCommandList);
+    void onExecute(uint32_t numCommandLists, ze_command_list_handle_t *phCommandLists);
+    void onKernelCreate(ze_kernel_handle_t hKernel, const char *name);
+    void onKernelDestroy(ze_kernel_handle_t hKernel);
+    void onContextDestroy(ze_context_handle_t hContext);
+    void harvest();
+    // Releases the events and pools of the contexts the application did not
+    // destroy, while the drivers are still loaded.
+    void releaseEvents();
+
+  private:
+    KernelTimer() = default;
+    bool registerTracer();
+
+    using event_pool_map_t = std::unordered_map<ze_context_handle_t, event_pool_cache_t>;
+
+    ze_event_handle_t acquireEvent(ze_context_handle_t hContext);
+    event_pool_map_t::iterator releaseContext(event_pool_map_t::iterator cache);
+    void releaseLaunch(launch_t *launch);
+    void report();
+
+    zel_tracer_handle_t hTracer = nullptr;
+
+    std::mutex mutex;
+    std::map<std::string, histogram_t> histograms;
+    std::unordered_map<ze_kernel_handle_t, histogram_t *> kernels;
+    std::unordered_map<ze_device_handle_t, device_info_t> devices;
+    std::unordered_map<ze_command_list_handle_t, command_list_info_t> commandLists;
+    event_pool_map_t eventPools;
+    std::vector<launch_t *> inFlight;
+    std::vector<launch_t *> freeLaunches;
+    std::vector<launch_t *> allLaunches;
+    uint32_t maxEvents = 0;
+    uint32_t eventCount = 0;
+    uint64_t untimedLaunches = 0;
+    bool releaseAtExit = false;
+};
+
+extern KernelTimer *pKernelTimer;
+
+} // namespace tracing_layer
@@ -6,14 +6,21 @@
  *
  */
 #include "../tracing_imp.h"
+#include "../kernel_timing.h"
+#include "../api_capture.h"
 
 namespace tracing_layer
 {
     void __attribute__((constructor)) createAPITracerContextImp() {
         pGlobalAPITracerContextImp = new struct APITracerContextImp;
+        pKernelTimer = KernelTimer::create();
+        pApiCapture = ApiCapture::create();
     }
 
     void __attribute__((destructor)) deleteAPITracerContextImp() {
+        delete pApiCapture;
+        delete pKernelTimer;
+        pKernelTimer = nullptr;
         delete pGlobalAPITracerContextImp;
     }
 }
@@ -0,0 +1,551 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Re-issues a call stream recorded with ZEL_TRACING_CAPTURE_FILE against the
+// drivers found by the loader, which may differ from the ones it was
+// recorded on (ZE_ENABLE_NULL_DRIVER=1 replays against the null driver).
+// Handles and allocations are remapped by id; memory contents are not part
+// of the capture, so results that depend on data may differ.
+
+#include "capture_format.h"
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <unordered_map>
+
+using namespace tracing_layer;
+
+namespace {
+
+class Replayer {
+  public:
+    bool replay(api_id_t apiId, ze_result_t recorded, CaptureReader &r);
+    void report(double seconds);
+
+  private:
+    struct allocation_t {
+        void *ptr = nullptr;
+        ze_context_handle_t hContext = nullptr;
+    };
+
+    struct api_stats_t {
+        uint64_t count = 0;
+        uint64_t mismatches = 0;
+    };
+
+    template <typename T>
+    T handle(CaptureReader &r) {
+        auto id = r.get<uint64_t>();
+        auto it = handles.find(id);
+        return static_cast<T>(it != handles.end() ? it->second : nullptr);
+    }
+
+    template <typename T>
+    std::vector<T> handleList(CaptureReader &r) {
+        std::vector<T> list(r.get<uint32_t>());
+        for (auto &h : list)
+            h = handle<T>(r);
+        return list;
+    }
+
+    void bind(CaptureReader &r, void *h) {
+        auto id = r.get<uint64_t>();
+        if (id)
+            handles[id] = h;
+    }
+
+    void *pointer(CaptureReader &r, size_t size, std::vector<uint8_t> &scratch);
+    const void *chain(CaptureReader &r, std::vector<std::vector<uint8_t>> &storage);
+    void allocated(CaptureReader &r, void *ptr, ze_context_handle_t hContext);
+
+    std::unordered_map<uint64_t, void *> handles;
+    std::unordered_map<uint64_t, allocation_t> allocations;
+    std::vector<uint8_t> dstScratch;
+    std::vector<uint8_t> srcScratch;
+    api_stats_t stats[static_cast<size_t>(api_id_t::count)];
+    uint64_t unsupported = 0;
+    uint64_t droppedExtensions = 0;
+};
+
+// Host memory that was not allocated through the API is replaced by a
+// scratch buffer of the required size.
+void *Replayer::pointer(CaptureReader &r, size_t size, std::vector<uint8_t> &scratch) {
+    auto id = r.get<uint64_t>();
+    auto offset = r.get<uint64_t>();
+    if (id == 0) {
+        if (scratch.size() < size)
+            scratch.resize(size);
+        return scratch.data();
+    }
+    auto it = allocations.find(id);
+    if (it == allocations.end())
+        return nullptr;
+    return static_cast<uint8_t *>(it->second.ptr) + offset;
+}
+
+const void *Replayer::chain(CaptureReader &r, std::vector<std::vector<uint8_t>> &storage) {
+    const void *pNext = nullptr;
+    droppedExtensions += r.getChain(storage, &pNext);
+    return pNext;
+}
+
+void Replayer::allocated(CaptureReader &r, void *ptr, ze_context_handle_t hContext) {
+    auto id = r.get<uint64_t>();
+    if (id && ptr)
+        allocations[id] = {ptr, hContext};
+}
+
+bool Replayer::replay(api_id_t apiId, ze_result_t recorded, CaptureReader &r) {
+    std::vector<std::vector<uint8_t>> storage;
+    ze_result_t result = ZE_RESULT_SUCCESS;
+
+    switch (apiId) {
+    case api_id_t::zeDriverGet: {
+        auto count = r.get<uint32_t>();
+        uint32_t available = 0;
+        result = zeDriverGet(&available, nullptr);
+        std::vector<ze_driver_handle_t> drivers(available);
+        if (available)
+            result = zeDriverGet(&available, drivers.data());
+        for (uint32_t i = 0; i < count; i++)
+            bind(r, i < available ? drivers[i] : nullptr);
+        break;
+    }
+    case api_id_t::zeDeviceGet: {
+        auto hDriver = handle<ze_driver_handle_t>(r);
+        auto count = r.get<uint32_t>();
+        uint32_t available = 0;
+        result = zeDeviceGet(hDriver, &available, nullptr);
+        std::vector<ze_device_handle_t> devices(available);
+        if (available)
+            result = zeDeviceGet(hDriver, &available, devices.data());
+        for (uint32_t i = 0; i < count; i++)
+            bind(r, i < available ? devices[i] : nullptr);
+        break;
+    }
+    case api_id_t::zeContextCreate: {
+        auto hDriver = handle<ze_driver_handle_t>(r);
+        ze_context_desc_t desc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+        desc.flags = r.get<ze_context_flags_t>();
+        desc.pNext = chain(r, storage);
+        ze_context_handle_t hContext = nullptr;
+        result = zeContextCreate(hDriver, &desc, &hContext);
+        bind(r, hContext);
+        break;
+    }
+    case api_id_t::zeContextDestroy:
+        result = zeContextDestroy(handle<ze_context_handle_t>(r));
+        break;
+    case api_id_t::zeCommandQueueCreate: {
+        auto hContext = handle<ze_context_handle_t>(r);
+        auto hDevice = handle<ze_device_handle_t>(r);
+        ze_command_queue_desc_t desc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+        desc.ordinal = r.get<uint32_t>();
+        desc.index = r.get<uint32_t>();
+        desc.flags = r.get<ze_command_queue_flags_t>();
+        desc.mode = r.get<ze_command_queue_mode_t>();
+        desc.priority = r.get<ze_command_queue_priority_t>();
+        desc.pNext = chain(r, storage);
+        ze_command_queue_handle_t hCommandQueue = nullptr;
+        result = zeCommandQueueCreate(hContext, hDevice, &desc, &hCommandQueue);
+        bind(r, hCommandQueue);
+        break;
+    }
+    case api_id_t::zeCommandQueueDestroy:
+        result = zeCommandQueueDestroy(handle<ze_command_queue_handle_t>(r));
+        break;
+    case api_id_t::zeCommandQueueExecuteCommandLists: {
+        auto hCommandQueue = handle<ze_command_queue_handle_t>(r);
+        auto commandLists = handleList<ze_command_list_handle_t>(r);
+        auto hFence = handle<ze_fence_handle_t>(r);
+        result = zeCommandQueueExecuteCommandLists(hCommandQueue, static_cast<uint32_t>(commandLists.size()),
+                                                   commandLists.data(), hFence);
+        break;
+    }
+    case api_id_t::zeCommandQueueSynchronize: {
+        auto hCommandQueue = handle<ze_command_queue_handle_t>(r);
+        result = zeCommandQueueSynchronize(hCommandQueue, r.get<uint64_t>());
+        break;
+    }
+    case api_id_t::zeCommandListCreate: {
+        auto hContext = handle<ze_context_handle_t>(r);
+        auto hDevice = handle<ze_device_handle_t>(r);
+        ze_command_list_desc_t desc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
+        desc.commandQueueGroupOrdinal = r.get<uint32_t>();
+        desc.flags = r.get<ze_command_list_flags_t>();
+        desc.pNext = chain(r, storage);
+        ze_command_list_handle_t hCommandList = nullptr;
+        result = zeCommandListCreate(hContext, hDevice, &desc, &hCommandList);
+        bind(r, hCommandList);
+        break;
+    }
+    case api_id_t::zeCommandListCreateImmediate: {
+        auto hContext = handle<ze_context_handle_t>(r);
+        auto hDevice = handle<ze_device_handle_t>(r);
+        ze_command_queue_desc_t desc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+        desc.ordinal = r.get<uint32_t>();
+        desc.index = r.get<uint32_t>();
+        desc.flags = r.get<ze_command_queue_flags_t>();
+        desc.mode = r.get<ze_command_queue_mode_t>();
+        desc.priority = r.get<ze_command_queue_priority_t>();
+        desc.pNext = chain(r, storage);
+        ze_command_list_handle_t hCommandList = nullptr;
+        result = zeCommandListCreateImmediate(hContext, hDevice, &desc, &hCommandList);
+        bind(r, hCommandList);
+        break;
+    }
+    case api_id_t::zeCommandListClose:
+        result = zeCommandListClose(handle<ze_command_list_handle_t>(r));
+        break;
+    case api_id_t::zeCommandListReset:
+        result = zeCommandListReset(handle<ze_command_list_handle_t>(r));
+        break;
+    case api_id_t::zeCommandListDestroy:
+        result = zeCommandListDestroy(handle<ze_command_list_handle_t>(r));
+        break;
+    case api_id_t::zeCommandListHostSynchronize: {
+        auto hCommandList = handle<ze_command_list_handle_t>(r);
+        result = zeCommandListHostSynchronize(hCommandList, r.get<uint64_t>());
+        break;
+    }
+    case api_id_t::zeCommandListAppendBarrier: {
+        auto hCommandList = handle<ze_command_list_handle_t>(r);
+        auto hSignalEvent = handle<ze_event_handle_t>(r);
+        auto waitEvents = handleList<ze_event_handle_t>(r);
+        result = zeCommandListAppendBarrier(hCommandList, hSignalEvent, static_cast<uint32_t>(waitEvents.size()),
+                                            waitEvents.empty() ? nullptr : waitEvents.data());
+        break;
+    }
+    case api_id_t::zeCommandListAppendMemoryCopy: {
+        auto hCommandList = handle<ze_command_list_handle_t>(r);
+        auto size = static_cast<size_t>(r.get<uint64_t>());
+        auto dstptr = pointer(r, size, dstScratch);
+        auto srcptr = pointer(r, size, srcScratch);
+        auto hSignalEvent = handle<ze_event_handle_t>(r);
+        auto waitEvents = handleList<ze_event_handle_t>(r);
+        result = zeCommandListAppendMemoryCopy(hCommandList, dstptr, srcptr, size, hSignalEvent,
+                                               static_cast<uint32_t>(waitEvents.size()),
+                                               waitEvents.empty() ? nullptr : waitEvents.data());
+        break;
+    }
+    case api_id_t::zeCommandListAppendMemoryFill: {
+        auto hCommandList = handle<ze_command_list_handle_t>(r);
+        auto size = static_cast<size_t>(r.get<uint64_t>());
+        auto ptr = pointer(r, size, dstScratch);
+        std::vector<uint8_t> pattern(r.get<uint32_t>());
+        r.getBytes(pattern.data(), pattern.size());
+        auto hSignalEvent = handle<ze_event_handle_t>(r);
+        auto waitEvents = handleList<ze_event_handle_t>(r);
+        result = zeCommandListAppendMemoryFill(hCommandList, ptr, pattern.data(), pattern.size(), size, hSignalEvent,
+                                               static_cast<uint32_t>(waitEvents.size()),
+                                               waitEvents.empty() ? nullptr : waitEvents.data());
+        break;
+    }
+    case api_id_t::zeCommandListAppendLaunchKernel: {
+        auto hCommandList = handle<ze_command_list_handle_t>(r);
+        auto hKernel = handle<ze_kernel_handle_t>(r);
+        auto launchArgs = r.get<ze_group_count_t>();
+        auto hSignalEvent = handle<ze_event_handle_t>(r);
+        auto waitEvents = handleList<ze_event_handle_t>(r);
+        result = zeCommandListAppendLaunchKernel(hCommandList, hKernel, &launchArgs, hSignalEvent,
+                                                 static_cast<uint32_t>(waitEvents.size()),
+                                                 waitEvents.empty() ? nullptr : waitEvents.data());
+        break;
+    }
+    case api_id_t::zeCommandListAppendSignalEvent: {
+        auto hCommandList = handle<ze_command_list_handle_t>(r);
+        result = zeCommandListAppendSignalEvent(hCommandList, handle<ze_event_handle_t>(r));
+        break;
+    }
+    case api_id_t::zeCommandListAppendWaitOnEvents: {
+        auto hCommandList = handle<ze_command_list_handle_t>(r);
+        auto events = handleList<ze_event_handle_t>(r);
+        result = zeCommandListAppendWaitOnEvents(hCommandList, static_cast<uint32_t>(events.size()),
+                                                 events.empty() ? nullptr : events.data());
+        break;
+    }
+    case api_id_t::zeCommandListAppendEventReset: {
+        auto hCommandList = handle<ze_command_list_handle_t>(r);
+        result = zeCommandListAppendEventReset(hCommandList, handle<ze_event_handle_t>(r));
+        break;
+    }
+    case api_id_t::zeEventPoolCreate: {
+        auto hContext = handle<ze_context_handle_t>(r);
+        ze_event_pool_desc_t desc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+        desc.flags = r.get<ze_event_pool_flags_t>();
+        desc.count = r.get<uint32_t>();
+        desc.pNext = chain(r, storage);
+        auto devices = handleList<ze_device_handle_t>(r);
+        ze_event_pool_handle_t hEventPool = nullptr;
+        result = zeEventPoolCreate(hContext, &desc, static_cast<uint32_t>(devices.size()),
+                                   devices.empty() ? nullptr : devices.data(), &hEventPool);
+        bind(r, hEventPool);
+        break;
+    }
+    case api_id_t::zeEventPoolDestroy:
+        result = zeEventPoolDestroy(handle<ze_event_pool_handle_t>(r));
+        break;
+    case api_id_t::zeEventCreate: {
+        auto hEventPool = handle<ze_event_pool_handle_t>(r);
+        ze_event_desc_t desc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+        desc.index = r.get<uint32_t>();
+        desc.signal = r.get<ze_event_scope_flags_t>();
+        desc.wait = r.get<ze_event_scope_flags_t>();
+        desc.pNext = chain(r, storage);
+        ze_event_handle_t hEvent = nullptr;
+        result = zeEventCreate(hEventPool, &desc, &hEvent);
+        bind(r, hEvent);
+        break;
+    }
+    case api_id_t::zeEventDestroy:
+        result = zeEventDestroy(handle<ze_event_handle_t>(r));
+        break;
+    case api_id_t::zeEventHostSignal:
+        result = zeEventHostSignal(handle<ze_event_handle_t>(r));
+        break;
+    case api_id_t::zeEventHostSynchronize: {
+        auto hEvent = handle<ze_event_handle_t>(r);
+        result = zeEventHostSynchronize(hEvent, r.get<uint64_t>());
+        break;
+    }
+    case api_id_t::zeEventQueryStatus:
+        result = zeEventQueryStatus(handle<ze_event_handle_t>(r));
+        break;
+    case api_id_t::zeEventHostReset:
+        result = zeEventHostReset(handle<ze_event_handle_t>(r));
+        break;
+    case api_id_t::zeFenceCreate: {
+        auto hCommandQueue = handle<ze_command_queue_handle_t>(r);
+        ze_fence_desc_t desc = {ZE_STRUCTURE_TYPE_FENCE_DESC};
+        desc.flags = r.get<ze_fence_flags_t>();
+        desc.pNext = chain(r, storage);
+        ze_fence_handle_t hFence = nullptr;
+        result = zeFenceCreate(hCommandQueue, &desc, &hFence);
+        bind(r, hFence);
+        break;
+    }
+    case api_id_t::zeFenceDestroy:
+        result = zeFenceDestroy(handle<ze_fence_handle_t>(r));
+        break;
+    case api_id_t::zeFenceHostSynchronize: {
+        auto hFence = handle<ze_fence_handle_t>(r);
+        result = zeFenceHostSynchronize(hFence, r.get<uint64_t>());
+        break;
+    }
+    case api_id_t::zeFenceReset:
+        result = zeFenceReset(handle<ze_fence_handle_t>(r));
+        break;
+    case api_id_t::zeMemAllocDevice: {
+        auto hContext = handle<ze_context_handle_t>(r);
+        ze_device_mem_alloc_desc_t desc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+        desc.flags = r.get<ze_device_mem_alloc_flags_t>();
+        desc.ordinal = r.get<uint32_t>();
+        desc.pNext = chain(r, storage);
+        auto size = static_cast<size_t>(r.get<uint64_t>());
+        auto alignment = static_cast<size_t>(r.get<uint64_t>());
+        auto hDevice = handle<ze_device_handle_t>(r);
+        void *ptr = nullptr;
+        result = zeMemAllocDevice(hContext, &desc, size, alignment, hDevice, &ptr);
+        allocated(r, ptr, hContext);
+        break;
+    }
+    case api_id_t::zeMemAllocHost: {
+        auto hContext = handle<ze_context_handle_t>(r);
+        ze_host_mem_alloc_desc_t desc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
+        desc.flags = r.get<ze_host_mem_alloc_flags_t>();
+        desc.pNext = chain(r, storage);
+        auto size = static_cast<size_t>(r.get<uint64_t>());
+        auto alignment = static_cast<size_t>(r.get<uint64_t>());
+        void *ptr = nullptr;
+        result = zeMemAllocHost(hContext, &desc, size, alignment, &ptr);
+        allocated(r, ptr, hContext);
+        break;
+    }
+    case api_id_t::zeMemAllocShared: {
+        auto hContext = handle<ze_context_handle_t>(r);
+        ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+        deviceDesc.flags = r.get<ze_device_mem_alloc_flags_t>();
+        deviceDesc.ordinal = r.get<uint32_t>();
+        deviceDesc.pNext = chain(r, storage);
+        std::vector<std::vector<uint8_t>> hostStorage;
+        ze_host_mem_alloc_desc_t hostDesc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
+        hostDesc.flags = r.get<ze_host_mem_alloc_flags_t>();
+        hostDesc.pNext = chain(r, hostStorage);
+        auto size = static_cast<size_t>(r.get<uint64_t>());
+        auto alignment = static_cast<size_t>(r.get<uint64_t>());
+        auto hDevice = handle<ze_device_handle_t>(r);
+        void *ptr = nullptr;
+        result = zeMemAllocShared(hContext, &deviceDesc, &hostDesc, size, alignment, hDevice, &ptr);
+        allocated(r, ptr, hContext);
+        break;
+    }
+    case api_id_t::zeMemFree: {
+        auto hContext = handle<ze_context_handle_t>(r);
+        auto id = r.get<uint64_t>();
+        r.get<uint64_t>();
+        auto it = allocations.find(id);
+        result = zeMemFree(hContext, it != allocations.end() ? it->second.ptr : nullptr);
+        if (it != allocations.end())
+            allocations.erase(it);
+        break;
+    }
+    case api_id_t::zeModuleCreate: {
+        auto hContext = handle<ze_context_handle_t>(r);
+        auto hDevice = handle<ze_device_handle_t>(r);
+        ze_module_desc_t desc = {ZE_STRUCTURE_TYPE_MODULE_DESC};
+        desc.format = r.get<ze_module_format_t>();
+        std::vector<uint8_t> input(static_cast<size_t>(r.get<uint64_t>()));
+        r.getBytes(input.data(), input.size());
+        auto buildFlags = r.getString();
+        desc.inputSize = input.size();
+        desc.pInputModule = input.data();
+        desc.pBuildFlags = buildFlags.c_str();
+        desc.pNext = chain(r, storage);
+        ze_module_handle_t hModule = nullptr;
+        result = zeModuleCreate(hContext, hDevice, &desc, &hModule, nullptr);
+        bind(r, hModule);
+        break;
+    }
+    case api_id_t::zeModuleDestroy:
+        result = zeModuleDestroy(handle<ze_module_handle_t>(r));
+        break;
+    case api_id_t::zeKernelCreate: {
+        auto hModule = handle<ze_module_handle_t>(r);
+        ze_kernel_desc_t desc = {ZE_STRUCTURE_TYPE_KERNEL_DESC};
+        desc.flags = r.get<ze_kernel_flags_t>();
+        auto name = r.getString();
+        desc.pKernelName = name.c_str();
+        desc.pNext = chain(r, storage);
+        ze_kernel_handle_t hKernel = nullptr;
+        result = zeKernelCreate(hModule, &desc, &hKernel);
+        bind(r, hKernel);
+        break;
+    }
+    case api_id_t::zeKernelDestroy:
+        result = zeKernelDestroy(handle<ze_kernel_handle_t>(r));
+        break;
+    case api_id_t::zeKernelSetGroupSize: {
+        auto hKernel = handle<ze_kernel_handle_t>(r);
+        auto x = r.get<uint32_t>();
+        auto y = r.get<uint32_t>();
+        auto z = r.get<uint32_t>();
+        result = zeKernelSetGroupSize(hKernel, x, y, z);
+        break;
+    }
+    case api_id_t::zeKernelSetArgumentValue: {
+        auto hKernel = handle<ze_kernel_handle_t>(r);
+        auto argIndex = r.get<uint32_t>();
+        auto argSize = r.get<uint32_t>();
+        auto kind = r.get<uint32_t>();
+        std::vector<uint8_t> value;
+        void *ptr = nullptr;
+        const void *pArgValue = nullptr;
+        if (kind == CAPTURE_ARG_POINTER) {
+            auto id = r.get<uint64_t>();
+            auto offset = r.get<uint64_t>();
+            if (allocations.count(id))
+                ptr = static_cast<uint8_t *>(allocations[id].ptr) + offset;
+            pArgValue = &ptr;
+        } else if (kind == CAPTURE_ARG_BYTES) {
+            value.resize(argSize);
+            r.getBytes(value.data(), argSize);
+            pArgValue = value.data();
+        }
+        result = zeKernelSetArgumentValue(hKernel, argIndex, argSize, pArgValue);
+        break;
+    }
+    default:
+        unsupported++;
+        return !r.overrun;
+    }
+
+    auto &apiStats = stats[static_cast<size_t>(apiId)];
+    apiStats.count++;
+    if (result != recorded)
+        apiStats.mismatches++;
+    return !r.overrun;
+}
+
+void Replayer::report(double seconds) {
+    uint64_t calls = 0, mismatches = 0;
+    fprintf(stdout, "%-40s %10s %10s\n", "Function", "Calls", "Mismatch");
+    for (size_t i = 0; i < static_cast<size_t>(api_id_t::count); i++) {
+        if (stats[i].count == 0)
+            continue;
+        fprintf(stdout, "%-40s %10" PRIu64 " %10" PRIu64 "\n", getApiName(static_cast<api_id_t>(i)), stats[i].count,
+                stats[i].mismatches);
+        calls += stats[i].count;
+        mismatches += stats[i].mismatches;
+    }
+    fprintf(stdout, "\nReplayed %" PRIu64 " calls in %.3f s, %" PRIu64 " with a different result\n", calls, seconds,
+            mismatches);
+    if (unsupported)
+        fprintf(stdout, "Skipped %" PRIu64 " records of unsupported functions\n", unsupported);
+    if (droppedExtensions)
+        fprintf(stdout, "Dropped %" PRIu64 " extension structures that could not be captured\n", droppedExtensions);
+}
+
+} // namespace
+
+static int usage(const char *argv0) {
+    fprintf(stderr, "usage: %s <capture.bin>\n", argv0);
+    return 1;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 2)
+        return usage(argv[0]);
+
+    FILE *input = fopen(argv[1], "rb");
+    if (input == nullptr) {
+        fprintf(stderr, "Unable to open %s\n", argv[1]);
+        return 1;
+    }
+
+    capture_file_header_t header = {};
+    if (fread(&header, sizeof(header), 1, input) != 1 ||
+        memcmp(header.magic, ZEL_CAPTURE_FILE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != ZEL_CAPTURE_FILE_VERSION ||
+        header.apiCount != static_cast<uint32_t>(api_id_t::count)) {
+        fprintf(stderr, "%s is not a supported capture file\n", argv[1]);
+        fclose(input);
+        return 1;
+    }
+
+    if (zeInit(0) != ZE_RESULT_SUCCESS) {
+        fprintf(stderr, "zeInit failed\n");
+        fclose(input);
+        return 1;
+    }
+
+    Replayer replayer;
+    std::vector<uint8_t> payload;
+    capture_record_header_t record = {};
+    int status = 0;
+    auto start = std::chrono::steady_clock::now();
+    while (fread(&record, sizeof(record), 1, input) == 1) {
+        payload.resize(record.payloadSize);
+        if (record.apiId >= header.apiCount ||
+            (record.payloadSize && fread(payload.data(), 1, record.payloadSize, input) != record.payloadSize)) {
+            fprintf(stderr, "%s is truncated or corrupt\n", argv[1]);
+            status = 1;
+            break;
+        }
+        CaptureReader reader(payload.data(), payload.size());
+        if (!replayer.replay(static_cast<api_id_t>(record.apiId), static_cast<ze_result_t>(record.result), reader)) {
+            fprintf(stderr, "Malformed %s record\n", getApiName(static_cast<api_id_t>(record.apiId)));
+            status = 1;
+            break;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    fclose(input);
+
+    replayer.report(std::chrono::duration<double>(end - start).count());
+    return status;
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Converts a binary trace recorded with ZEL_TRACING_EXPORT_FORMAT=binary
+// into Chrome trace event format JSON, one chunk of records at a time.
+
+#include "trace_export.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace tracing_layer;
+
+static int usage(const char *argv0) {
+    fprintf(stderr, "usage: %s <input.bin> [output.json]\n", argv0);
+    return 1;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2 || argc > 3)
+        return usage(argv[0]);
+
+    FILE *input = fopen(argv[1], "rb");
+    if (input == nullptr) {
+        fprintf(stderr, "Unable to open %s\n", argv[1]);
+        return 1;
+    }
+
+    trace_file_header_t header = {};
+    if (fread(&header, sizeof(header), 1, input) != 1 ||
+        memcmp(header.magic, ZEL_TRACE_FILE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != ZEL_TRACE_FILE_VERSION ||
+        header.recordSize != sizeof(trace_record_t)) {
+        fprintf(stderr, "%s is not a supported trace file\n", argv[1]);
+        fclose(input);
+        return 1;
+    }
+
+    // The name table makes the file independent of the layer version
+    // that recorded it.
+    std::vector<std::string> apiNames(header.apiCount);
+    for (auto &name : apiNames) {
+        uint32_t length = 0;
+        if (fread(&length, sizeof(length), 1, input) != 1) {
+            fprintf(stderr, "%s is truncated\n", argv[1]);
+            fclose(input);
+            return 1;
+        }
+        name.resize(length);
+        if (length && fread(&name[0], 1, length, input) != length) {
+            fprintf(stderr, "%s is truncated\n", argv[1]);
+            fclose(input);
+            return 1;
+        }
+    }
+
+    FILE *output = (argc == 3) ? fopen(argv[2], "w") : stdout;
+    if (output == nullptr) {
+        fprintf(stderr, "Unable to open %s\n", argv[2]);
+        fclose(input);
+        return 1;
+    }
+
+    ChromeTraceWriter writer(output);
+    writer.writeBegin();
+
+    std::vector<trace_record_t> records(ThreadTraceBuffer::capacity);
+    size_t count = 0;
+    while ((count = fread(records.data(), sizeof(trace_record_t), records.size(), input)) > 0) {
+        for (size_t i = 0; i < count; i++) {
+            const char *name = (records[i].apiId < apiNames.size()) ? apiNames[records[i].apiId].c_str() : "unknown";
+            writer.writeEvent(records[i], name, header.processId);
+        }
+    }
+
+    writer.writeEnd();
+
+    fclose(input);
+    if (output != stdout)
+        fclose(output);
+    return 0;
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "trace_export.h"
+#include "ze_util.h"
+
+#include <atomic>
+#include <cstring>
+
+namespace tracing_layer {
+
+TraceExporter traceExporter;
+
+static std::atomic<uint32_t> nextTraceThreadId{1};
+
+thread_local ThreadTraceBuffer threadTraceBuffer;
+
+///////////////////////////////////////////////////////////////////////////////
+TraceExporter::TraceExporter() {
+    std::string fileName = getenv_string("ZEL_TRACING_EXPORT_FILE");
+    if (fileName.empty())
+        return;
+
+    std::string formatName = getenv_string("ZEL_TRACING_EXPORT_FORMAT");
+    if (formatName == "binary") {
+        format = format_t::binary;
+    } else if (!formatName.empty() && formatName != "chrome") {
+        fprintf(stderr, "ZEL_TRACING_EXPORT_FORMAT=%s is not supported, using chrome\n", formatName.c_str());
+    }
+
+    stream = fopen(fileName.c_str(), (format == format_t::binary) ? "wb" : "w");
+    if (stream == nullptr) {
+        fprintf(stderr, "Unable to open trace export file %s\n", fileName.c_str());
+        return;
+    }
+
+    processId = getCurrentProcessId();
+
+    if (format == format_t::binary) {
+        trace_file_header_t header = {};
+        memcpy(header.magic, ZEL_TRACE_FILE_MAGIC, sizeof(header.magic));
+        header.version = ZEL_TRACE_FILE_VERSION;
+        header.processId = processId;
+        header.apiCount = static_cast<uint32_t>(api_id_t::count);
+        header.recordSize = sizeof(trace_record_t);
+        fwrite(&header, sizeof(header), 1, stream);
+        for (uint32_t i = 0; i < header.apiCount; i++) {
+            const char *name = getApiName(static_cast<api_id_t>(i));
+            uint32_t length = static_cast<uint32_t>(strlen(name));
+            fwrite(&length, sizeof(length), 1, stream);
+            fwrite(name, 1, length, stream);
+        }
+    } else {
+        chromeWriter = new ChromeTraceWriter(stream);
+        chromeWriter->writeBegin();
+    }
+
+    enabled = true;
+}
+
+TraceExporter::~TraceExporter() {
+    std::lock_guard<std::mutex> lock(streamMutex);
+    if (stream == nullptr)
+        return;
+
+    enabled = false;
+
+    // Threads that are still running at unload have not flushed yet; a
+    // thread exiting meanwhile waits for the lock to unregister.
+    for (auto buffer : bufferList) {
+        write(buffer);
+        buffer->registered = false;
+    }
+    bufferList.clear();
+
+    if (chromeWriter) {
+        chromeWriter->writeEnd();
+        delete chromeWriter;
+        chromeWriter = nullptr;
+    }
+    fclose(stream);
+    stream = nullptr;
+}
+
+void TraceExporter::record(const trace_record_t &record) {
+    threadTraceBuffer.append(record);
+}
+
+void TraceExporter::write(ThreadTraceBuffer *buffer) {
+    if (stream == nullptr)
+        return;
+
+    auto records = buffer->records.get();
+    auto count = buffer->count.load(std::memory_order_acquire);
+    if (count == 0)
+        return;
+    if (format == format_t::binary) {
+        fwrite(records, sizeof(trace_record_t), count, stream);
+    } else {
+        for (size_t i = 0; i < count; i++)
+            chromeWriter->writeEvent(records[i], getApiName(static_cast<api_id_t>(records[i].apiId)), processId);
+    }
+    fflush(stream);
+}
+
+void TraceExporter::flush(ThreadTraceBuffer *buffer) {
+    std::lock_guard<std::mutex> lock(streamMutex);
+    write(buffer);
+    buffer->count.store(0, std::memory_order_relaxed);
+}
+
+void TraceExporter::registerBuffer(ThreadTraceBuffer *buffer) {
+    std::lock_guard<std::mutex> lock(streamMutex);
+    if (stream == nullptr)
+        return;
+    bufferList.push_back(buffer);
+    buffer->registered = true;
+}
+
+void TraceExporter::unregisterBuffer(ThreadTraceBuffer *buffer) {
+    std::lock_guard<std::mutex> lock(streamMutex);
+    if (!buffer->registered)
+        return;
+    write(buffer);
+    bufferList.remove(buffer);
+    buffer->registered = false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ThreadTraceBuffer::ThreadTraceBuffer() : threadId(nextTraceThreadId++), records(new trace_record_t[capacity]) {
+    if (traceExporter.isEnabled())
+        traceExporter.registerBuffer(this);
+}
+
+ThreadTraceBuffer::~ThreadTraceBuffer() {
+    if (traceExporter.isEnabled())
+        traceExporter.unregisterBuffer(this);
+}
+
+} // namespace tracing_layer
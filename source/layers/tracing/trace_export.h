@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "ze_api.h"
+#include "ze_tracing_api_ids.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+
+namespace tracing_layer {
+
+// One completed API call. The same layout is used for the in-memory
+// per-thread buffers and for the records of the binary trace file.
+typedef struct trace_record {
+    uint64_t start;         // steady clock, nanoseconds
+    uint64_t duration;      // nanoseconds
+    uint64_t hCommandList;  // first command list handle argument, or 0
+    uint64_t hCommandQueue; // first command queue handle argument, or 0
+    uint32_t apiId;
+    uint32_t threadId;
+    int32_t result;
+    uint32_t reserved;
+} trace_record_t;
+
+// Binary trace file layout:
+//   trace_file_header_t
+//   apiCount x { uint32_t length; char name[length]; }
+//   trace_record_t...
+#define ZEL_TRACE_FILE_MAGIC "ZELTRACE"
+#define ZEL_TRACE_FILE_VERSION 1
+
+typedef struct trace_file_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t processId;
+    uint32_t apiCount;
+    uint32_t recordSize;
+} trace_file_header_t;
+
+uint32_t getCurrentProcessId();
+
+// Streams records as Chrome trace event format JSON, which is also
+// accepted by the Perfetto UI.
+class ChromeTraceWriter {
+  public:
+    explicit ChromeTraceWriter(FILE *stream) : stream(stream) {}
+
+    void writeBegin();
+    void writeEvent(const trace_record_t &record, const char *apiName, uint32_t processId);
+    void writeEnd();
+
+  private:
+    FILE *stream;
+    bool firstEvent = true;
+};
+
+class ThreadTraceBuffer;
+
+class TraceExporter {
+  public:
+    enum class format_t {
+        chrome,
+        binary
+    };
+
+    TraceExporter();
+    ~TraceExporter();
+
+    // Read without locking on every traced call.
+    bool isEnabled() const { return enabled.load(std::memory_order_relaxed); }
+
+    void record(const trace_record_t &record);
+
+    static uint64_t now() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::steady_clock::now().time_since_epoch())
+                                         .count());
+    }
+
+    // Writes out the records of a buffer and empties it.
+    void flush(ThreadTraceBuffer *buffer);
+    void registerBuffer(ThreadTraceBuffer *buffer);
+    // Writes out the records of a buffer before forgetting it.
+    void unregisterBuffer(ThreadTraceBuffer *buffer);
+
+  private:
+    // streamMutex must be held.
+    void write(ThreadTraceBuffer *buffer);
+
+    std::atomic<bool> enabled{false};
+    format_t format = format_t::chrome;
+    uint32_t processId = 0;
+
+    // Guards the stream and the buffer list; buffers are only written out
+    // while registered, and unregister themselves before they go away.
+    std::mutex streamMutex;
+    FILE *stream = nullptr;
+    ChromeTraceWriter *chromeWriter = nullptr;
+    std::list<ThreadTraceBuffer *> bufferList;
+};
+
+extern TraceExporter traceExporter;
+
+// Records are batched per thread and handed to the exporter when the
+// buffer fills up, when the thread exits, or when the layer is unloaded.
+// Only the owning thread appends; the exporter may write out the records
+// appended so far from another thread at unload, so the count is
+// published after each record is complete.
+class ThreadTraceBuffer {
+  public:
+    static constexpr size_t capacity = 1024;
+
+    ThreadTraceBuffer();
+    ~ThreadTraceBuffer();
+
+    void append(const trace_record_t &record) {
+        auto index = count.load(std::memory_order_relaxed);
+        records[index] = record;
+        records[index].threadId = threadId;
+        count.store(index + 1, std::memory_order_release);
+        if (index + 1 == capacity)
+            traceExporter.flush(this);
+    }
+
+    uint32_t threadId;
+
+  private:
+    friend class TraceExporter;
+
+    std::unique_ptr<trace_record_t[]> records;
+    std::atomic<size_t> count{0};
+    bool registered = false;
+};
+
+// Fills in the handle fields of a record from the arguments of a traced
+// call; arguments of any other type are ignored.
+inline void captureTraceHandle(trace_record_t &record, ze_command_list_handle_t hCommandList) {
+    if (record.hCommandList == 0)
+        record.hCommandList = reinterpret_cast<uint64_t>(hCommandList);
+}
+
+inline void captureTraceHandle(trace_record_t &record, ze_command_queue_handle_t hCommandQueue) {
+    if (record.hCommandQueue == 0)
+        record.hCommandQueue = reinterpret_cast<uint64_t>(hCommandQueue);
+}
+
+template <typename T>
+inline void captureTraceHandle(trace_record_t &, const T &) {}
+
+inline void captureTraceHandles(trace_record_t &) {}
+
+template <typename T, typename... Args>
+inline void captureTraceHandles(trace_record_t &record, T &&arg, Args &&... args) {
+    captureTraceHandle(record, static_cast<typename std::decay<T>::type>(arg));
+    captureTraceHandles(record, std::forward<Args>(args)...);
+}
+
+} // namespace tracing_layer
@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "trace_sampler.h"
+#include "ze_util.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace tracing_layer {
+
+thread_local trace_sampler_thread_state_t traceSamplerThreadState;
+
+TraceSampler traceSampler;
+
+static uint64_t getenv_uint64(const char *name) {
+    std::string value = getenv_string(name);
+    if (value.empty())
+        return 0;
+    char *end = nullptr;
+    auto result = strtoull(value.c_str(), &end, 10);
+    if (end == value.c_str() || *end != '\0') {
+        fprintf(stderr, "Ignoring invalid value %s=%s\n", name, value.c_str());
+        return 0;
+    }
+    return result;
+}
+
+TraceSampler::TraceSampler() {
+    interval = static_cast<uint32_t>(getenv_uint64("ZEL_TRACING_SAMPLE_INTERVAL"));
+    period = getenv_uint64("ZEL_TRACING_SAMPLE_PERIOD_MS") * 1000000;
+    window = getenv_uint64("ZEL_TRACING_SAMPLE_WINDOW_MS") * 1000000;
+    minDuration = getenv_uint64("ZEL_TRACING_SAMPLE_THRESHOLD_US") * 1000;
+
+    if (period && (window == 0 || window >= period)) {
+        fprintf(stderr, "ZEL_TRACING_SAMPLE_WINDOW_MS must be set and smaller than ZEL_TRACING_SAMPLE_PERIOD_MS, ignoring the sampling window\n");
+        period = 0;
+    }
+
+    enabled = (interval > 1) || (period != 0);
+}
+
+} // namespace tracing_layer
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "ze_tracing_api_ids.h"
+
+#include <chrono>
+#include <cstdint>
+
+namespace tracing_layer {
+
+// Per-thread sampling state. Zero initialized, so accessing it costs no
+// more than any other thread_local and needs no atomics.
+typedef struct trace_sampler_thread_state {
+    uint32_t callCount[static_cast<uint32_t>(api_id_t::count)];
+    // Whether the outermost call in progress on the thread is exported.
+    bool exportCall;
+} trace_sampler_thread_state_t;
+
+extern thread_local trace_sampler_thread_state_t traceSamplerThreadState;
+
+// Decides whether a call is exported. Tracer callbacks, including the
+// layer's own kernel timing and API capture, see every call, so sampling
+// cannot leave gaps in the state they track. The configuration is read
+// once from the environment and is immutable afterwards:
+//   ZEL_TRACING_SAMPLE_INTERVAL=N         trace 1 in N calls of each API on each thread
+//   ZEL_TRACING_SAMPLE_PERIOD_MS=T        together with ZEL_TRACING_SAMPLE_WINDOW_MS=W,
+//                                         trace only the first W ms of every T ms
+//   ZEL_TRACING_SAMPLE_THRESHOLD_US=D     export only calls that took at least D us
+class TraceSampler {
+  public:
+    TraceSampler();
+
+    bool shouldTrace(api_id_t apiId) const {
+        if (!enabled)
+            return true;
+        if (interval > 1) {
+            auto &count = traceSamplerThreadState.callCount[static_cast<uint32_t>(apiId)];
+            bool sampled = (count == 0);
+            count = (count + 1 == interval) ? 0 : count + 1;
+            if (!sampled)
+                return false;
+        }
+        if (period) {
+            auto now = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                                 std::chrono::steady_clock::now().time_since_epoch())
+                                                 .count());
+            if ((now % period) >= window)
+                return false;
+        }
+        return true;
+    }
+
+    // The duration is only known after the call, so the threshold can
+    // filter exported records but not tracer callbacks, whose prologues
+    // have already run by then.
+    bool isSlowEnough(uint64_t duration) const { return duration >= minDuration; }
+
+  private:
+    bool enabled = false;
+    uint32_t interval = 0;
+    uint64_t period = 0;
+    uint64_t window = 0;
+    uint64_t minDuration = 0;
+};
+
+extern TraceSampler traceSampler;
+
+} // namespace tracing_layer
@@ -372,6 +372,7 @@ size_t APITracerContextImp::updateTracerArrays() {
     // from this thread to the tracing threads.
     //
     activeTracerArray.store(newTracerArray, std::memory_order_release);
+    enabledTracerCount.store(newTracerArrayCount, std::memory_order_release);
     return testAndFreeRetiredTracers();
 }
 
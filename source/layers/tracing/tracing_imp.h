@@ -10,6 +10,8 @@
 #include "tracing.h"
 #include "ze_api.h"
 #include "ze_tracing_cb_structs.h"
+#include "trace_export.h"
+#include "trace_sampler.h"
 
 #include <atomic>
 #include <chrono>
@@ -100,6 +102,9 @@ struct APITracerContextImp : APITracerContext {
     ze_result_t finalizeDisableImpTracingWait(struct APITracerImp *oldTracer);
 
     bool isTracingEnabled();
+    bool hasEnabledTracers() const {
+        return enabledTracerCount.load(std::memory_order_acquire) != 0;
+    }
 
     void addThreadTracerDataToList(ThreadPrivateTracerData *threadDataP);
     void removeThreadTracerDataFromList(ThreadPrivateTracerData *threadDataP);
@@ -108,6 +113,7 @@ struct APITracerContextImp : APITracerContext {
     std::mutex traceTableMutex;
     tracer_array_t emptyTracerArray = {0, NULL};
     std::atomic<tracer_array_t *> activeTracerArray;
+    std::atomic<size_t> enabledTracerCount{0};
 
     //
     // a list of tracer arrays that were once active, but
@@ -153,6 +159,19 @@ class APITracerCallbackDataImp {
         tracing_layer::tracingInProgress = 1;       \
     } while (0)
 
+// A call that is not sampled skips the tracer machinery altogether only
+// when no tracer is enabled; otherwise it only skips the exporter.
+#define ZE_HANDLE_TRACER_SAMPLING(api_id, ze_api_ptr, ...)                          \
+    do {                                                                           \
+        if (!tracing_layer::tracingInProgress) {                                   \
+            bool sampled = tracing_layer::traceSampler.shouldTrace(api_id);        \
+            if (!sampled &&                                                        \
+                !tracing_layer::pGlobalAPITracerContextImp->hasEnabledTracers())   \
+                return ze_api_ptr(__VA_ARGS__);                                    \
+            tracing_layer::traceSamplerThreadState.exportCall = sampled;           \
+        }                                                                          \
+    } while (0)
+
 #define ZE_GEN_TRACER_ARRAY_ENTRY(callbackPtr, tracerArray, tracerArrayIndex, \
                                   callbackType, callbackCategory,             \
                                   callbackFunction)                           \
@@ -196,7 +215,7 @@ template <typename TFunction_pointer, typename TParams, typename TTracer,
           typename TTracerPrologCallbacks, typename TTracerEpilogCallbacks,
           typename... Args>
 ze_result_t
-APITracerWrapperImp(TFunction_pointer zeApiPtr, TParams paramsStruct,
+APITracerWrapperImp(TFunction_pointer zeApiPtr, api_id_t apiId, TParams paramsStruct,
                     TTracer apiOrdinal, TTracerPrologCallbacks prologCallbacks,
                     TTracerEpilogCallbacks epilogCallbacks, Args &&... args) {
     ze_result_t ret = ZE_RESULT_SUCCESS;
@@ -212,7 +231,21 @@ APITracerWrapperImp(TFunction_pointer zeApiPtr, TParams paramsStruct,
                 paramsStruct, ret, callbacks_prologs->at(i).pUserData,
                 &ppTracerInstanceUserData[i]);
     }
+    uint64_t exportStart = 0;
+    if (traceExporter.isEnabled() && traceSamplerThreadState.exportCall)
+        exportStart = TraceExporter::now();
     ret = zeApiPtr(args...);
+    if (exportStart) {
+        trace_record_t record = {};
+        record.start = exportStart;
+        record.duration = TraceExporter::now() - exportStart;
+        if (traceSampler.isSlowEnough(record.duration)) {
+            record.apiId = static_cast<uint32_t>(apiId);
+            record.result = static_cast<int32_t>(ret);
+            captureTraceHandles(record, args...);
+            traceExporter.record(record);
+        }
+    }
     std::vector<APITracerCallbackStateImp<TTracer>> *callbacksEpilogs =
         &epilogCallbacks;
     for (size_t i = 0; i < callbacksEpilogs->size(); i++) {
@@ -6,14 +6,21 @@
  *
  */
 #include "../tracing_imp.h"
+#include "../kernel_timing.h"
+#include "../api_capture.h"
 #include <windows.h>
 
 namespace tracing_layer {
 extern "C" BOOL APIENTRY DllMain(HINSTANCE hinstDLL, DWORD fdwReason, LPVOID lpvReserved) {
     if (fdwReason == DLL_PROCESS_DETACH) {
+      delete pApiCapture;
+      delete pKernelTimer;
+      pKernelTimer = nullptr;
       delete pGlobalAPITracerContextImp;
     } else if (fdwReason == DLL_PROCESS_ATTACH) {
       pGlobalAPITracerContextImp = new APITracerContextImp;
+      pKernelTimer = KernelTimer::create();
+      pApiCapture = ApiCapture::create();
     }
    return TRUE;
 }
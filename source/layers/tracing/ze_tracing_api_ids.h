@@ -0,0 +1,399 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file ze_tracing_api_ids.h
+ *
+ */
+#pragma once
+#include <cstdint>
+
+namespace tracing_layer
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Identifiers of the traced ze functions
+    enum class api_id_t : uint32_t
+    {
+        zeInit,
+        zeDriverGet,
+        zeDriverGetApiVersion,
+        zeDriverGetProperties,
+        zeDriverGetIpcProperties,
+        zeDriverGetExtensionProperties,
+        zeDriverGetExtensionFunctionAddress,
+        zeDriverGetLastErrorDescription,
+        zeDeviceGet,
+        zeDeviceGetRootDevice,
+        zeDeviceGetSubDevices,
+        zeDeviceGetProperties,
+        zeDeviceGetComputeProperties,
+        zeDeviceGetModuleProperties,
+        zeDeviceGetCommandQueueGroupProperties,
+        zeDeviceGetMemoryProperties,
+        zeDeviceGetMemoryAccessProperties,
+        zeDeviceGetCacheProperties,
+        zeDeviceGetImageProperties,
+        zeDeviceGetExternalMemoryProperties,
+        zeDeviceGetP2PProperties,
+        zeDeviceCanAccessPeer,
+        zeDeviceGetStatus,
+        zeDeviceGetGlobalTimestamps,
+        zeContextCreate,
+        zeContextCreateEx,
+        zeContextDestroy,
+        zeContextGetStatus,
+        zeCommandQueueCreate,
+        zeCommandQueueDestroy,
+        zeCommandQueueExecuteCommandLists,
+        zeCommandQueueSynchronize,
+        zeCommandQueueGetOrdinal,
+        zeCommandQueueGetIndex,
+        zeCommandListCreate,
+        zeCommandListCreateImmediate,
+        zeCommandListDestroy,
+        zeCommandListClose,
+        zeCommandListReset,
+        zeCommandListAppendWriteGlobalTimestamp,
+        zeCommandListHostSynchronize,
+        zeCommandListGetDeviceHandle,
+        zeCommandListGetContextHandle,
+        zeCommandListGetOrdinal,
+        zeCommandListImmediateGetIndex,
+        zeCommandListIsImmediate,
+        zeCommandListAppendBarrier,
+        zeCommandListAppendMemoryRangesBarrier,
+        zeContextSystemBarrier,
+        zeCommandListAppendMemoryCopy,
+        zeCommandListAppendMemoryFill,
+        zeCommandListAppendMemoryCopyRegion,
+        zeCommandListAppendMemoryCopyFromContext,
+        zeCommandListAppendImageCopy,
+        zeCommandListAppendImageCopyRegion,
+        zeCommandListAppendImageCopyToMemory,
+        zeCommandListAppendImageCopyFromMemory,
+        zeCommandListAppendMemoryPrefetch,
+        zeCommandListAppendMemAdvise,
+        zeEventPoolCreate,
+        zeEventPoolDestroy,
+        zeEventCreate,
+        zeEventDestroy,
+        zeEventPoolGetIpcHandle,
+        zeEventPoolPutIpcHandle,
+        zeEventPoolOpenIpcHandle,
+        zeEventPoolCloseIpcHandle,
+        zeCommandListAppendSignalEvent,
+        zeCommandListAppendWaitOnEvents,
+        zeEventHostSignal,
+        zeEventHostSynchronize,
+        zeEventQueryStatus,
+        zeCommandListAppendEventReset,
+        zeEventHostReset,
+        zeEventQueryKernelTimestamp,
+        zeCommandListAppendQueryKernelTimestamps,
+        zeEventGetEventPool,
+        zeEventGetSignalScope,
+        zeEventGetWaitScope,
+        zeEventPoolGetContextHandle,
+        zeEventPoolGetFlags,
+        zeFenceCreate,
+        zeFenceDestroy,
+        zeFenceHostSynchronize,
+        zeFenceQueryStatus,
+        zeFenceReset,
+        zeImageGetProperties,
+        zeImageCreate,
+        zeImageDestroy,
+        zeMemAllocShared,
+        zeMemAllocDevice,
+        zeMemAllocHost,
+        zeMemFree,
+        zeMemGetAllocProperties,
+        zeMemGetAddressRange,
+        zeMemGetIpcHandle,
+        zeMemGetIpcHandleFromFileDescriptorExp,
+        zeMemGetFileDescriptorFromIpcHandleExp,
+        zeMemPutIpcHandle,
+        zeMemOpenIpcHandle,
+        zeMemCloseIpcHandle,
+        zeMemSetAtomicAccessAttributeExp,
+        zeMemGetAtomicAccessAttributeExp,
+        zeModuleCreate,
+        zeModuleDestroy,
+        zeModuleDynamicLink,
+        zeModuleBuildLogDestroy,
+        zeModuleBuildLogGetString,
+        zeModuleGetNativeBinary,
+        zeModuleGetGlobalPointer,
+        zeModuleGetKernelNames,
+        zeModuleGetProperties,
+        zeKernelCreate,
+        zeKernelDestroy,
+        zeModuleGetFunctionPointer,
+        zeKernelSetGroupSize,
+        zeKernelSuggestGroupSize,
+        zeKernelSuggestMaxCooperativeGroupCount,
+        zeKernelSetArgumentValue,
+        zeKernelSetIndirectAccess,
+        zeKernelGetIndirectAccess,
+        zeKernelGetSourceAttributes,
+        zeKernelSetCacheConfig,
+        zeKernelGetProperties,
+        zeKernelGetName,
+        zeCommandListAppendLaunchKernel,
+        zeCommandListAppendLaunchCooperativeKernel,
+        zeCommandListAppendLaunchKernelIndirect,
+        zeCommandListAppendLaunchMultipleKernelsIndirect,
+        zeContextMakeMemoryResident,
+        zeContextEvictMemory,
+        zeContextMakeImageResident,
+        zeContextEvictImage,
+        zeSamplerCreate,
+        zeSamplerDestroy,
+        zeVirtualMemReserve,
+        zeVirtualMemFree,
+        zeVirtualMemQueryPageSize,
+        zePhysicalMemCreate,
+        zePhysicalMemDestroy,
+        zeVirtualMemMap,
+        zeVirtualMemUnmap,
+        zeVirtualMemSetAccessAttribute,
+        zeVirtualMemGetAccessAttribute,
+        zeKernelSetGlobalOffsetExp,
+        zeDeviceReserveCacheExt,
+        zeDeviceSetCacheAdviceExt,
+        zeEventQueryTimestampsExp,
+        zeImageGetMemoryPropertiesExp,
+        zeImageViewCreateExt,
+        zeImageViewCreateExp,
+        zeKernelSchedulingHintExp,
+        zeDevicePciGetPropertiesExt,
+        zeCommandListAppendImageCopyToMemoryExt,
+        zeCommandListAppendImageCopyFromMemoryExt,
+        zeImageGetAllocPropertiesExt,
+        zeModuleInspectLinkageExt,
+        zeMemFreeExt,
+        zeFabricVertexGetExp,
+        zeFabricVertexGetSubVerticesExp,
+        zeFabricVertexGetPropertiesExp,
+        zeFabricVertexGetDeviceExp,
+        zeDeviceGetFabricVertexExp,
+        zeFabricEdgeGetExp,
+        zeFabricEdgeGetVerticesExp,
+        zeFabricEdgeGetPropertiesExp,
+        zeEventQueryKernelTimestampsExt,
+        zeRTASBuilderCreateExp,
+        zeRTASBuilderGetBuildPropertiesExp,
+        zeDriverRTASFormatCompatibilityCheckExp,
+        zeRTASBuilderBuildExp,
+        zeRTASBuilderDestroyExp,
+        zeRTASParallelOperationCreateExp,
+        zeRTASParallelOperationGetPropertiesExp,
+        zeRTASParallelOperationJoinExp,
+        zeRTASParallelOperationDestroyExp,
+        zeMemGetPitchFor2dImage,
+        zeImageGetDeviceOffsetExp,
+        zeCommandListCreateCloneExp,
+        zeCommandListImmediateAppendCommandListsExp,
+        zeCommandListGetNextCommandIdExp,
+        zeCommandListUpdateMutableCommandsExp,
+        zeCommandListUpdateMutableCommandSignalEventExp,
+        zeCommandListUpdateMutableCommandWaitEventsExp,
+        count
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Returns the name of the function identified by id
+    inline const char *getApiName(api_id_t id)
+    {
+        static const char *names[] = {
+            "zeInit",
+            "zeDriverGet",
+            "zeDriverGetApiVersion",
+            "zeDriverGetProperties",
+            "zeDriverGetIpcProperties",
+            "zeDriverGetExtensionProperties",
+            "zeDriverGetExtensionFunctionAddress",
+            "zeDriverGetLastErrorDescription",
+            "zeDeviceGet",
+            "zeDeviceGetRootDevice",
+            "zeDeviceGetSubDevices",
+            "zeDeviceGetProperties",
+            "zeDeviceGetComputeProperties",
+            "zeDeviceGetModuleProperties",
+            "zeDeviceGetCommandQueueGroupProperties",
+            "zeDeviceGetMemoryProperties",
+            "zeDeviceGetMemoryAccessProperties",
+            "zeDeviceGetCacheProperties",
+            "zeDeviceGetImageProperties",
+            "zeDeviceGetExternalMemoryProperties",
+            "zeDeviceGetP2PProperties",
+            "zeDeviceCanAccessPeer",
+            "zeDeviceGetStatus",
+            "zeDeviceGetGlobalTimestamps",
+            "zeContextCreate",
+            "zeContextCreateEx",
+            "zeContextDestroy",
+            "zeContextGetStatus",
+            "zeCommandQueueCreate",
+            "zeCommandQueueDestroy",
+            "zeCommandQueueExecuteCommandLists",
+            "zeCommandQueueSynchronize",
+            "zeCommandQueueGetOrdinal",
+            "zeCommandQueueGetIndex",
+            "zeCommandListCreate",
+            "zeCommandListCreateImmediate",
+            "zeCommandListDestroy",
+            "zeCommandListClose",
+            "zeCommandListReset",
+            "zeCommandListAppendWriteGlobalTimestamp",
+            "zeCommandListHostSynchronize",
+            "zeCommandListGetDeviceHandle",
+            "zeCommandListGetContextHandle",
+            "zeCommandListGetOrdinal",
+            "zeCommandListImmediateGetIndex",
+            "zeCommandListIsImmediate",
+            "zeCommandListAppendBarrier",
+            "zeCommandListAppendMemoryRangesBarrier",
+            "zeContextSystemBarrier",
+            "zeCommandListAppendMemoryCopy",
+            "zeCommandListAppendMemoryFill",
+            "zeCommandListAppendMemoryCopyRegion",
+            "zeCommandListAppendMemoryCopyFromContext",
+            "zeCommandListAppendImageCopy",
+            "zeCommandListAppendImageCopyRegion",
+            "zeCommandListAppendImageCopyToMemory",
+            "zeCommandListAppendImageCopyFromMemory",
+            "zeCommandListAppendMemoryPrefetch",
+            "zeCommandListAppendMemAdvise",
+            "zeEventPoolCreate",
+            "zeEventPoolDestroy",
+            "zeEventCreate",
+            "zeEventDestroy",
+            "zeEventPoolGetIpcHandle",
+            "zeEventPoolPutIpcHandle",
+            "zeEventPoolOpenIpcHandle",
+            "zeEventPoolCloseIpcHandle",
+            "zeCommandListAppendSignalEvent",
+            "zeCommandListAppendWaitOnEvents",
+            "zeEventHostSignal",
+            "zeEventHostSynchronize",
+            "zeEventQueryStatus",
+            "zeCommandListAppendEventReset",
+            "zeEventHostReset",
+            "zeEventQueryKernelTimestamp",
+            "zeCommandListAppendQueryKernelTimestamps",
+            "zeEventGetEventPool",
+            "zeEventGetSignalScope",
+            "zeEventGetWaitScope",
+            "zeEventPoolGetContextHandle",
+            "zeEventPoolGetFlags",
+            "zeFenceCreate",
+            "zeFenceDestroy",
+            "zeFenceHostSynchronize",
+            "zeFenceQueryStatus",
+            "zeFenceReset",
+            "zeImageGetProperties",
+            "zeImageCreate",
+            "zeImageDestroy",
+            "zeMemAllocShared",
+            "zeMemAllocDevice",
+            "zeMemAllocHost",
+            "zeMemFree",
+            "zeMemGetAllocProperties",
+            "zeMemGetAddressRange",
+            "zeMemGetIpcHandle",
+            "zeMemGetIpcHandleFromFileDescriptorExp",
+            "zeMemGetFileDescriptorFromIpcHandleExp",
+            "zeMemPutIpcHandle",
+            "zeMemOpenIpcHandle",
+            "zeMemCloseIpcHandle",
+            "zeMemSetAtomicAccessAttributeExp",
+            "zeMemGetAtomicAccessAttributeExp",
+            "zeModuleCreate",
+            "zeModuleDestroy",
+            "zeModuleDynamicLink",
+            "zeModuleBuildLogDestroy",
+            "zeModuleBuildLogGetString",
+            "zeModuleGetNativeBinary",
+            "zeModuleGetGlobalPointer",
+            "zeModuleGetKernelNames",
+            "zeModuleGetProperties",
+            "zeKernelCreate",
+            "zeKernelDestroy",
+            "zeModuleGetFunctionPointer",
+            "zeKernelSetGroupSize",
+            "zeKernelSuggestGroupSize",
+            "zeKernelSuggestMaxCooperativeGroupCount",
+            "zeKernelSetArgumentValue",
+            "zeKernelSetIndirectAccess",
+            "zeKernelGetIndirectAccess",
+            "zeKernelGetSourceAttributes",
+            "zeKernelSetCacheConfig",
+            "zeKernelGetProperties",
+            "zeKernelGetName",
+            "zeCommandListAppendLaunchKernel",
+            "zeCommandListAppendLaunchCooperativeKernel",
+            "zeCommandListAppendLaunchKernelIndirect",
+            "zeCommandListAppendLaunchMultipleKernelsIndirect",
+            "zeContextMakeMemoryResident",
+            "zeContextEvictMemory",
+            "zeContextMakeImageResident",
+            "zeContextEvictImage",
+            "zeSamplerCreate",
+            "zeSamplerDestroy",
+            "zeVirtualMemReserve",
+            "zeVirtualMemFree",
+            "zeVirtualMemQueryPageSize",
+            "zePhysicalMemCreate",
+            "zePhysicalMemDestroy",
+            "zeVirtualMemMap",
+            "zeVirtualMemUnmap",
+            "zeVirtualMemSetAccessAttribute",
+            "zeVirtualMemGetAccessAttribute",
+            "zeKernelSetGlobalOffsetExp",
+            "zeDeviceReserveCacheExt",
+            "zeDeviceSetCacheAdviceExt",
+            "zeEventQueryTimestampsExp",
+            "zeImageGetMemoryPropertiesExp",
+            "zeImageViewCreateExt",
+            "zeImageViewCreateExp",
+            "zeKernelSchedulingHintExp",
+            "zeDevicePciGetPropertiesExt",
+            "zeCommandListAppendImageCopyToMemoryExt",
+            "zeCommandListAppendImageCopyFromMemoryExt",
+            "zeImageGetAllocPropertiesExt",
+            "zeModuleInspectLinkageExt",
+            "zeMemFreeExt",
+            "zeFabricVertexGetExp",
+            "zeFabricVertexGetSubVerticesExp",
+            "zeFabricVertexGetPropertiesExp",
+            "zeFabricVertexGetDeviceExp",
+            "zeDeviceGetFabricVertexExp",
+            "zeFabricEdgeGetExp",
+            "zeFabricEdgeGetVerticesExp",
+            "zeFabricEdgeGetPropertiesExp",
+            "zeEventQueryKernelTimestampsExt",
+            "zeRTASBuilderCreateExp",
+            "zeRTASBuilderGetBuildPropertiesExp",
+            "zeDriverRTASFormatCompatibilityCheckExp",
+            "zeRTASBuilderBuildExp",
+            "zeRTASBuilderDestroyExp",
+            "zeRTASParallelOperationCreateExp",
+            "zeRTASParallelOperationGetPropertiesExp",
+            "zeRTASParallelOperationJoinExp",
+            "zeRTASParallelOperationDestroyExp",
+            "zeMemGetPitchFor2dImage",
+            "zeImageGetDeviceOffsetExp",
+            "zeCommandListCreateCloneExp",
+            "zeCommandListImmediateAppendCommandListsExp",
+            "zeCommandListGetNextCommandIdExp",
+            "zeCommandListUpdateMutableCommandsExp",
+            "zeCommandListUpdateMutableCommandSignalEventExp",
+            "zeCommandListUpdateMutableCommandWaitEventsExp",
+        };
+        auto index = static_cast<uint32_t>(id);
+        return (index < static_cast<uint32_t>(api_id_t::count)) ? names[index] : "unknown";
+    }
+} // namespace tracing_layer
@@ -26,6 +26,8 @@ namespace tracing_layer
         if( nullptr == pfnInit)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeInit, context.zeDdiTable.Global.pfnInit, flags);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Global.pfnInit, flags);
 
         // capture parameters
@@ -39,6 +41,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Global.pfnInit,
+                                                  api_id_t::zeInit,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -65,6 +68,8 @@ namespace tracing_layer
         if( nullptr == pfnGet)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDriverGet, context.zeDdiTable.Driver.pfnGet, pCount, phDrivers);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGet, pCount, phDrivers);
 
         // capture parameters
@@ -79,6 +84,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Driver.pfnGet,
+                                                  api_id_t::zeDriverGet,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -100,6 +106,8 @@ namespace tracing_layer
         if( nullptr == pfnGetApiVersion)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDriverGetApiVersion, context.zeDdiTable.Driver.pfnGetApiVersion, hDriver, version);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGetApiVersion, hDriver, version);
 
         // capture parameters
@@ -114,6 +122,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Driver.pfnGetApiVersion,
+                                                  api_id_t::zeDriverGetApiVersion,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -135,6 +144,8 @@ namespace tracing_layer
         if( nullptr == pfnGetProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDriverGetProperties, context.zeDdiTable.Driver.pfnGetProperties, hDriver, pDriverProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGetProperties, hDriver, pDriverProperties);
 
         // capture parameters
@@ -149,6 +160,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Driver.pfnGetProperties,
+                                                  api_id_t::zeDriverGetProperties,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -170,6 +182,8 @@ namespace tracing_layer
         if( nullptr == pfnGetIpcProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDriverGetIpcProperties, context.zeDdiTable.Driver.pfnGetIpcProperties, hDriver, pIpcProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGetIpcProperties, hDriver, pIpcProperties);
 
         // capture parameters
@@ -184,6 +198,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Driver.pfnGetIpcProperties,
+                                                  api_id_t::zeDriverGetIpcProperties,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -214,6 +229,8 @@ namespace tracing_layer
         if( nullptr == pfnGetExtensionProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDriverGetExtensionProperties, context.zeDdiTable.Driver.pfnGetExtensionProperties, hDriver, pCount, pExtensionProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGetExtensionProperties, hDriver, pCount, pExtensionProperties);
 
         // capture parameters
@@ -229,6 +246,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Driver.pfnGetExtensionProperties,
+                                                  api_id_t::zeDriverGetExtensionProperties,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -252,6 +270,8 @@ namespace tracing_layer
         if( nullptr == pfnGetExtensionFunctionAddress)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDriverGetExtensionFunctionAddress, context.zeDdiTable.Driver.pfnGetExtensionFunctionAddress, hDriver, name, ppFunctionAddress);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGetExtensionFunctionAddress, hDriver, name, ppFunctionAddress);
 
         // capture parameters
@@ -267,6 +287,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Driver.pfnGetExtensionFunctionAddress,
+                                                  api_id_t::zeDriverGetExtensionFunctionAddress,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -290,6 +311,8 @@ namespace tracing_layer
         if( nullptr == pfnGetLastErrorDescription)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDriverGetLastErrorDescription, context.zeDdiTable.Driver.pfnGetLastErrorDescription, hDriver, ppString);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Driver.pfnGetLastErrorDescription, hDriver, ppString);
 
         // capture parameters
@@ -304,6 +327,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Driver.pfnGetLastErrorDescription,
+                                                  api_id_t::zeDriverGetLastErrorDescription,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -332,6 +356,8 @@ namespace tracing_layer
         if( nullptr == pfnGet)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDeviceGet, context.zeDdiTable.Device.pfnGet, hDriver, pCount, phDevices);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGet, hDriver, pCount, phDevices);
 
         // capture parameters
@@ -347,6 +373,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGet,
+                                                  api_id_t::zeDeviceGet,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -369,6 +396,8 @@ namespace tracing_layer
         if( nullptr == pfnGetRootDevice)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDeviceGetRootDevice, context.zeDdiTable.Device.pfnGetRootDevice, hDevice, phRootDevice);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetRootDevice, hDevice, phRootDevice);
 
         // capture parameters
@@ -383,6 +412,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetRootDevice,
+                                                  api_id_t::zeDeviceGetRootDevice,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -411,6 +441,8 @@ namespace tracing_layer
         if( nullptr == pfnGetSubDevices)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDeviceGetSubDevices, context.zeDdiTable.Device.pfnGetSubDevices, hDevice, pCount, phSubdevices);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetSubDevices, hDevice, pCount, phSubdevices);
 
         // capture parameters
@@ -426,6 +458,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetSubDevices,
+                                                  api_id_t::zeDeviceGetSubDevices,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -448,6 +481,8 @@ namespace tracing_layer
         if( nullptr == pfnGetProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDeviceGetProperties, context.zeDdiTable.Device.pfnGetProperties, hDevice, pDeviceProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetProperties, hDevice, pDeviceProperties);
 
         // capture parameters
@@ -462,6 +497,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetProperties,
+                                                  api_id_t::zeDeviceGetProperties,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -483,6 +519,8 @@ namespace tracing_layer
         if( nullptr == pfnGetComputeProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDeviceGetComputeProperties, context.zeDdiTable.Device.pfnGetComputeProperties, hDevice, pComputeProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetComputeProperties, hDevice, pComputeProperties);
 
         // capture parameters
@@ -497,6 +535,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetComputeProperties,
+                                                  api_id_t::zeDeviceGetComputeProperties,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -518,6 +557,8 @@ namespace tracing_layer
         if( nullptr == pfnGetModuleProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDeviceGetModuleProperties, context.zeDdiTable.Device.pfnGetModuleProperties, hDevice, pModuleProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetModuleProperties, hDevice, pModuleProperties);
 
         // capture parameters
@@ -532,6 +573,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetModuleProperties,
+                                                  api_id_t::zeDeviceGetModuleProperties,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -563,6 +605,8 @@ namespace tracing_layer
         if( nullptr == pfnGetCommandQueueGroupProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDeviceGetCommandQueueGroupProperties, context.zeDdiTable.Device.pfnGetCommandQueueGroupProperties, hDevice, pCount, pCommandQueueGroupProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetCommandQueueGroupProperties, hDevice, pCount, pCommandQueueGroupProperties);
 
         // capture parameters
@@ -578,6 +622,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetCommandQueueGroupProperties,
+                                                  api_id_t::zeDeviceGetCommandQueueGroupProperties,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -609,6 +654,8 @@ namespace tracing_layer
         if( nullptr == pfnGetMemoryProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDeviceGetMemoryProperties, context.zeDdiTable.Device.pfnGetMemoryProperties, hDevice, pCount, pMemProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetMemoryProperties, hDevice, pCount, pMemProperties);
 
         // capture parameters
@@ -624,6 +671,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetMemoryProperties,
+                                                  api_id_t::zeDeviceGetMemoryProperties,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -646,6 +694,8 @@ namespace tracing_layer
         if( nullptr == pfnGetMemoryAccessProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDeviceGetMemoryAccessProperties, context.zeDdiTable.Device.pfnGetMemoryAccessProperties, hDevice, pMemAccessProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetMemoryAccessProperties, hDevice, pMemAccessProperties);
 
         // capture parameters
@@ -660,6 +710,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetMemoryAccessProperties,
+                                                  api_id_t::zeDeviceGetMemoryAccessProperties,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -689,6 +740,8 @@ namespace tracing_layer
         if( nullptr == pfnGetCacheProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDeviceGetCacheProperties, context.zeDdiTable.Device.pfnGetCacheProperties, hDevice, pCount, pCacheProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetCacheProperties, hDevice, pCount, pCacheProperties);
 
         // capture parameters
@@ -704,6 +757,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetCacheProperties,
+                                                  api_id_t::zeDeviceGetCacheProperties,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -726,6 +780,8 @@ namespace tracing_layer
         if( nullptr == pfnGetImageProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDeviceGetImageProperties, context.zeDdiTable.Device.pfnGetImageProperties, hDevice, pImageProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetImageProperties, hDevice, pImageProperties);
 
         // capture parameters
@@ -740,6 +796,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetImageProperties,
+                                                  api_id_t::zeDeviceGetImageProperties,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -761,6 +818,8 @@ namespace tracing_layer
         if( nullptr == pfnGetExternalMemoryProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDeviceGetExternalMemoryProperties, context.zeDdiTable.Device.pfnGetExternalMemoryProperties, hDevice, pExternalMemoryProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetExternalMemoryProperties, hDevice, pExternalMemoryProperties);
 
         // capture parameters
@@ -775,6 +834,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetExternalMemoryProperties,
+                                                  api_id_t::zeDeviceGetExternalMemoryProperties,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -797,6 +857,8 @@ namespace tracing_layer
         if( nullptr == pfnGetP2PProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDeviceGetP2PProperties, context.zeDdiTable.Device.pfnGetP2PProperties, hDevice, hPeerDevice, pP2PProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetP2PProperties, hDevice, hPeerDevice, pP2PProperties);
 
         // capture parameters
@@ -812,6 +874,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetP2PProperties,
+                                                  api_id_t::zeDeviceGetP2PProperties,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -835,6 +898,8 @@ namespace tracing_layer
         if( nullptr == pfnCanAccessPeer)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDeviceCanAccessPeer, context.zeDdiTable.Device.pfnCanAccessPeer, hDevice, hPeerDevice, value);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnCanAccessPeer, hDevice, hPeerDevice, value);
 
         // capture parameters
@@ -850,6 +915,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnCanAccessPeer,
+                                                  api_id_t::zeDeviceCanAccessPeer,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -871,6 +937,8 @@ namespace tracing_layer
         if( nullptr == pfnGetStatus)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDeviceGetStatus, context.zeDdiTable.Device.pfnGetStatus, hDevice);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetStatus, hDevice);
 
         // capture parameters
@@ -884,6 +952,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetStatus,
+                                                  api_id_t::zeDeviceGetStatus,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -907,6 +976,8 @@ namespace tracing_layer
         if( nullptr == pfnGetGlobalTimestamps)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDeviceGetGlobalTimestamps, context.zeDdiTable.Device.pfnGetGlobalTimestamps, hDevice, hostTimestamp, deviceTimestamp);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnGetGlobalTimestamps, hDevice, hostTimestamp, deviceTimestamp);
 
         // capture parameters
@@ -922,6 +993,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnGetGlobalTimestamps,
+                                                  api_id_t::zeDeviceGetGlobalTimestamps,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -945,6 +1017,8 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeContextCreate, context.zeDdiTable.Context.pfnCreate, hDriver, desc, phContext);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnCreate, hDriver, desc, phContext);
 
         // capture parameters
@@ -960,6 +1034,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnCreate,
+                                                  api_id_t::zeContextCreate,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -993,6 +1068,8 @@ namespace tracing_layer
         if( nullptr == pfnCreateEx)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeContextCreateEx, context.zeDdiTable.Context.pfnCreateEx, hDriver, desc, numDevices, phDevices, phContext);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnCreateEx, hDriver, desc, numDevices, phDevices, phContext);
 
         // capture parameters
@@ -1010,6 +1087,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnCreateEx,
+                                                  api_id_t::zeContextCreateEx,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -1033,6 +1111,8 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeContextDestroy, context.zeDdiTable.Context.pfnDestroy, hContext);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnDestroy, hContext);
 
         // capture parameters
@@ -1046,6 +1126,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnDestroy,
+                                                  api_id_t::zeContextDestroy,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -1065,6 +1146,8 @@ namespace tracing_layer
         if( nullptr == pfnGetStatus)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeContextGetStatus, context.zeDdiTable.Context.pfnGetStatus, hContext);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnGetStatus, hContext);
 
         // capture parameters
@@ -1078,6 +1161,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnGetStatus,
+                                                  api_id_t::zeContextGetStatus,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -1100,6 +1184,8 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandQueueCreate, context.zeDdiTable.CommandQueue.pfnCreate, hContext, hDevice, desc, phCommandQueue);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandQueue.pfnCreate, hContext, hDevice, desc, phCommandQueue);
 
         // capture parameters
@@ -1116,6 +1202,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandQueue.pfnCreate,
+                                                  api_id_t::zeCommandQueueCreate,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -1138,6 +1225,8 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandQueueDestroy, context.zeDdiTable.CommandQueue.pfnDestroy, hCommandQueue);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandQueue.pfnDestroy, hCommandQueue);
 
         // capture parameters
@@ -1151,6 +1240,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandQueue.pfnDestroy,
+                                                  api_id_t::zeCommandQueueDestroy,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -1174,6 +1264,8 @@ namespace tracing_layer
         if( nullptr == pfnExecuteCommandLists)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandQueueExecuteCommandLists, context.zeDdiTable.CommandQueue.pfnExecuteCommandLists, hCommandQueue, numCommandLists, phCommandLists, hFence);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandQueue.pfnExecuteCommandLists, hCommandQueue, numCommandLists, phCommandLists, hFence);
 
         // capture parameters
@@ -1190,6 +1282,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandQueue.pfnExecuteCommandLists,
+                                                  api_id_t::zeCommandQueueExecuteCommandLists,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -1219,6 +1312,8 @@ namespace tracing_layer
         if( nullptr == pfnSynchronize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandQueueSynchronize, context.zeDdiTable.CommandQueue.pfnSynchronize, hCommandQueue, timeout);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandQueue.pfnSynchronize, hCommandQueue, timeout);
 
         // capture parameters
@@ -1233,6 +1328,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandQueue.pfnSynchronize,
+                                                  api_id_t::zeCommandQueueSynchronize,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -1254,6 +1350,8 @@ namespace tracing_layer
         if( nullptr == pfnGetOrdinal)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandQueueGetOrdinal, context.zeDdiTable.CommandQueue.pfnGetOrdinal, hCommandQueue, pOrdinal);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandQueue.pfnGetOrdinal, hCommandQueue, pOrdinal);
 
         // capture parameters
@@ -1268,6 +1366,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandQueue.pfnGetOrdinal,
+                                                  api_id_t::zeCommandQueueGetOrdinal,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -1289,6 +1388,8 @@ namespace tracing_layer
         if( nullptr == pfnGetIndex)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandQueueGetIndex, context.zeDdiTable.CommandQueue.pfnGetIndex, hCommandQueue, pIndex);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandQueue.pfnGetIndex, hCommandQueue, pIndex);
 
         // capture parameters
@@ -1303,6 +1404,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandQueue.pfnGetIndex,
+                                                  api_id_t::zeCommandQueueGetIndex,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -1326,6 +1428,8 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListCreate, context.zeDdiTable.CommandList.pfnCreate, hContext, hDevice, desc, phCommandList);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnCreate, hContext, hDevice, desc, phCommandList);
 
         // capture parameters
@@ -1342,6 +1446,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnCreate,
+                                                  api_id_t::zeCommandListCreate,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -1367,6 +1472,8 @@ namespace tracing_layer
         if( nullptr == pfnCreateImmediate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListCreateImmediate, context.zeDdiTable.CommandList.pfnCreateImmediate, hContext, hDevice, altdesc, phCommandList);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnCreateImmediate, hContext, hDevice, altdesc, phCommandList);
 
         // capture parameters
@@ -1383,6 +1490,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnCreateImmediate,
+                                                  api_id_t::zeCommandListCreateImmediate,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -1405,6 +1513,8 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListDestroy, context.zeDdiTable.CommandList.pfnDestroy, hCommandList);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnDestroy, hCommandList);
 
         // capture parameters
@@ -1418,6 +1528,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnDestroy,
+                                                  api_id_t::zeCommandListDestroy,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -1437,6 +1548,8 @@ namespace tracing_layer
         if( nullptr == pfnClose)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListClose, context.zeDdiTable.CommandList.pfnClose, hCommandList);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnClose, hCommandList);
 
         // capture parameters
@@ -1450,6 +1563,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnClose,
+                                                  api_id_t::zeCommandListClose,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -1469,6 +1583,8 @@ namespace tracing_layer
         if( nullptr == pfnReset)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListReset, context.zeDdiTable.CommandList.pfnReset, hCommandList);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnReset, hCommandList);
 
         // capture parameters
@@ -1482,6 +1598,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnReset,
+                                                  api_id_t::zeCommandListReset,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -1508,6 +1625,8 @@ namespace tracing_layer
         if( nullptr == pfnAppendWriteGlobalTimestamp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListAppendWriteGlobalTimestamp, context.zeDdiTable.CommandList.pfnAppendWriteGlobalTimestamp, hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendWriteGlobalTimestamp, hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -1525,6 +1644,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendWriteGlobalTimestamp,
+                                                  api_id_t::zeCommandListAppendWriteGlobalTimestamp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -1555,6 +1675,8 @@ namespace tracing_layer
         if( nullptr == pfnHostSynchronize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListHostSynchronize, context.zeDdiTable.CommandList.pfnHostSynchronize, hCommandList, timeout);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnHostSynchronize, hCommandList, timeout);
 
         // capture parameters
@@ -1569,6 +1691,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnHostSynchronize,
+                                                  api_id_t::zeCommandListHostSynchronize,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -1590,6 +1713,8 @@ namespace tracing_layer
         if( nullptr == pfnGetDeviceHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListGetDeviceHandle, context.zeDdiTable.CommandList.pfnGetDeviceHandle, hCommandList, phDevice);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnGetDeviceHandle, hCommandList, phDevice);
 
         // capture parameters
@@ -1604,6 +1729,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnGetDeviceHandle,
+                                                  api_id_t::zeCommandListGetDeviceHandle,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -1625,6 +1751,8 @@ namespace tracing_layer
         if( nullptr == pfnGetContextHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListGetContextHandle, context.zeDdiTable.CommandList.pfnGetContextHandle, hCommandList, phContext);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnGetContextHandle, hCommandList, phContext);
 
         // capture parameters
@@ -1639,6 +1767,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnGetContextHandle,
+                                                  api_id_t::zeCommandListGetContextHandle,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -1660,6 +1789,8 @@ namespace tracing_layer
         if( nullptr == pfnGetOrdinal)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListGetOrdinal, context.zeDdiTable.CommandList.pfnGetOrdinal, hCommandList, pOrdinal);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnGetOrdinal, hCommandList, pOrdinal);
 
         // capture parameters
@@ -1674,6 +1805,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnGetOrdinal,
+                                                  api_id_t::zeCommandListGetOrdinal,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -1696,6 +1828,8 @@ namespace tracing_layer
         if( nullptr == pfnImmediateGetIndex)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListImmediateGetIndex, context.zeDdiTable.CommandList.pfnImmediateGetIndex, hCommandListImmediate, pIndex);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnImmediateGetIndex, hCommandListImmediate, pIndex);
 
         // capture parameters
@@ -1710,6 +1844,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnImmediateGetIndex,
+                                                  api_id_t::zeCommandListImmediateGetIndex,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -1732,6 +1867,8 @@ namespace tracing_layer
         if( nullptr == pfnIsImmediate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListIsImmediate, context.zeDdiTable.CommandList.pfnIsImmediate, hCommandList, pIsImmediate);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnIsImmediate, hCommandList, pIsImmediate);
 
         // capture parameters
@@ -1746,6 +1883,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnIsImmediate,
+                                                  api_id_t::zeCommandListIsImmediate,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -1771,6 +1909,8 @@ namespace tracing_layer
         if( nullptr == pfnAppendBarrier)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListAppendBarrier, context.zeDdiTable.CommandList.pfnAppendBarrier, hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendBarrier, hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -1787,6 +1927,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendBarrier,
+                                                  api_id_t::zeCommandListAppendBarrier,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -1817,6 +1958,8 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemoryRangesBarrier)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListAppendMemoryRangesBarrier, context.zeDdiTable.CommandList.pfnAppendMemoryRangesBarrier, hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemoryRangesBarrier, hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -1836,6 +1979,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendMemoryRangesBarrier,
+                                                  api_id_t::zeCommandListAppendMemoryRangesBarrier,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -1862,6 +2006,8 @@ namespace tracing_layer
         if( nullptr == pfnSystemBarrier)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeContextSystemBarrier, context.zeDdiTable.Context.pfnSystemBarrier, hContext, hDevice);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnSystemBarrier, hContext, hDevice);
 
         // capture parameters
@@ -1876,6 +2022,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnSystemBarrier,
+                                                  api_id_t::zeContextSystemBarrier,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -1904,6 +2051,8 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemoryCopy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListAppendMemoryCopy, context.zeDdiTable.CommandList.pfnAppendMemoryCopy, hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemoryCopy, hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -1923,6 +2072,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendMemoryCopy,
+                                                  api_id_t::zeCommandListAppendMemoryCopy,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -1957,6 +2107,8 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemoryFill)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListAppendMemoryFill, context.zeDdiTable.CommandList.pfnAppendMemoryFill, hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemoryFill, hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -1977,6 +2129,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendMemoryFill,
+                                                  api_id_t::zeCommandListAppendMemoryFill,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -2020,6 +2173,8 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemoryCopyRegion)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListAppendMemoryCopyRegion, context.zeDdiTable.CommandList.pfnAppendMemoryCopyRegion, hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemoryCopyRegion, hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -2044,6 +2199,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendMemoryCopyRegion,
+                                                  api_id_t::zeCommandListAppendMemoryCopyRegion,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -2083,6 +2239,8 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemoryCopyFromContext)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListAppendMemoryCopyFromContext, context.zeDdiTable.CommandList.pfnAppendMemoryCopyFromContext, hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemoryCopyFromContext, hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -2103,6 +2261,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendMemoryCopyFromContext,
+                                                  api_id_t::zeCommandListAppendMemoryCopyFromContext,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -2136,6 +2295,8 @@ namespace tracing_layer
         if( nullptr == pfnAppendImageCopy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListAppendImageCopy, context.zeDdiTable.CommandList.pfnAppendImageCopy, hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendImageCopy, hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -2154,6 +2315,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendImageCopy,
+                                                  api_id_t::zeCommandListAppendImageCopy,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -2187,6 +2349,8 @@ namespace tracing_layer
         if( nullptr == pfnAppendImageCopyRegion)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListAppendImageCopyRegion, context.zeDdiTable.CommandList.pfnAppendImageCopyRegion, hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendImageCopyRegion, hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -2207,6 +2371,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendImageCopyRegion,
+                                                  api_id_t::zeCommandListAppendImageCopyRegion,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -2241,6 +2406,8 @@ namespace tracing_layer
         if( nullptr == pfnAppendImageCopyToMemory)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListAppendImageCopyToMemory, context.zeDdiTable.CommandList.pfnAppendImageCopyToMemory, hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendImageCopyToMemory, hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -2260,6 +2427,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendImageCopyToMemory,
+                                                  api_id_t::zeCommandListAppendImageCopyToMemory,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -2293,6 +2461,8 @@ namespace tracing_layer
         if( nullptr == pfnAppendImageCopyFromMemory)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListAppendImageCopyFromMemory, context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemory, hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemory, hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -2312,6 +2482,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemory,
+                                                  api_id_t::zeCommandListAppendImageCopyFromMemory,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -2339,6 +2510,8 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemoryPrefetch)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListAppendMemoryPrefetch, context.zeDdiTable.CommandList.pfnAppendMemoryPrefetch, hCommandList, ptr, size);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemoryPrefetch, hCommandList, ptr, size);
 
         // capture parameters
@@ -2354,6 +2527,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendMemoryPrefetch,
+                                                  api_id_t::zeCommandListAppendMemoryPrefetch,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -2379,6 +2553,8 @@ namespace tracing_layer
         if( nullptr == pfnAppendMemAdvise)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListAppendMemAdvise, context.zeDdiTable.CommandList.pfnAppendMemAdvise, hCommandList, hDevice, ptr, size, advice);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendMemAdvise, hCommandList, hDevice, ptr, size, advice);
 
         // capture parameters
@@ -2396,6 +2572,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendMemAdvise,
+                                                  api_id_t::zeCommandListAppendMemAdvise,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -2427,6 +2604,8 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeEventPoolCreate, context.zeDdiTable.EventPool.pfnCreate, hContext, desc, numDevices, phDevices, phEventPool);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnCreate, hContext, desc, numDevices, phDevices, phEventPool);
 
         // capture parameters
@@ -2444,6 +2623,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.EventPool.pfnCreate,
+                                                  api_id_t::zeEventPoolCreate,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -2467,6 +2647,8 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeEventPoolDestroy, context.zeDdiTable.EventPool.pfnDestroy, hEventPool);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnDestroy, hEventPool);
 
         // capture parameters
@@ -2480,6 +2662,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.EventPool.pfnDestroy,
+                                                  api_id_t::zeEventPoolDestroy,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -2501,6 +2684,8 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeEventCreate, context.zeDdiTable.Event.pfnCreate, hEventPool, desc, phEvent);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnCreate, hEventPool, desc, phEvent);
 
         // capture parameters
@@ -2516,6 +2701,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnCreate,
+                                                  api_id_t::zeEventCreate,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -2537,6 +2723,8 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeEventDestroy, context.zeDdiTable.Event.pfnDestroy, hEvent);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnDestroy, hEvent);
 
         // capture parameters
@@ -2550,6 +2738,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnDestroy,
+                                                  api_id_t::zeEventDestroy,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -2570,6 +2759,8 @@ namespace tracing_layer
         if( nullptr == pfnGetIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeEventPoolGetIpcHandle, context.zeDdiTable.EventPool.pfnGetIpcHandle, hEventPool, phIpc);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnGetIpcHandle, hEventPool, phIpc);
 
         // capture parameters
@@ -2584,6 +2775,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.EventPool.pfnGetIpcHandle,
+                                                  api_id_t::zeEventPoolGetIpcHandle,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -2606,6 +2798,8 @@ namespace tracing_layer
         if( nullptr == pfnPutIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeEventPoolPutIpcHandle, context.zeDdiTable.EventPool.pfnPutIpcHandle, hContext, hIpc);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnPutIpcHandle, hContext, hIpc);
 
         // capture parameters
@@ -2620,6 +2814,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.EventPool.pfnPutIpcHandle,
+                                                  api_id_t::zeEventPoolPutIpcHandle,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -2643,6 +2838,8 @@ namespace tracing_layer
         if( nullptr == pfnOpenIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeEventPoolOpenIpcHandle, context.zeDdiTable.EventPool.pfnOpenIpcHandle, hContext, hIpc, phEventPool);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnOpenIpcHandle, hContext, hIpc, phEventPool);
 
         // capture parameters
@@ -2658,6 +2855,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.EventPool.pfnOpenIpcHandle,
+                                                  api_id_t::zeEventPoolOpenIpcHandle,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -2679,6 +2877,8 @@ namespace tracing_layer
         if( nullptr == pfnCloseIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeEventPoolCloseIpcHandle, context.zeDdiTable.EventPool.pfnCloseIpcHandle, hEventPool);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnCloseIpcHandle, hEventPool);
 
         // capture parameters
@@ -2692,6 +2892,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.EventPool.pfnCloseIpcHandle,
+                                                  api_id_t::zeEventPoolCloseIpcHandle,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -2712,6 +2913,8 @@ namespace tracing_layer
         if( nullptr == pfnAppendSignalEvent)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListAppendSignalEvent, context.zeDdiTable.CommandList.pfnAppendSignalEvent, hCommandList, hEvent);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendSignalEvent, hCommandList, hEvent);
 
         // capture parameters
@@ -2726,6 +2929,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendSignalEvent,
+                                                  api_id_t::zeCommandListAppendSignalEvent,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -2749,6 +2953,8 @@ namespace tracing_layer
         if( nullptr == pfnAppendWaitOnEvents)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListAppendWaitOnEvents, context.zeDdiTable.CommandList.pfnAppendWaitOnEvents, hCommandList, numEvents, phEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendWaitOnEvents, hCommandList, numEvents, phEvents);
 
         // capture parameters
@@ -2764,6 +2970,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendWaitOnEvents,
+                                                  api_id_t::zeCommandListAppendWaitOnEvents,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -2785,6 +2992,8 @@ namespace tracing_layer
         if( nullptr == pfnHostSignal)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeEventHostSignal, context.zeDdiTable.Event.pfnHostSignal, hEvent);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnHostSignal, hEvent);
 
         // capture parameters
@@ -2798,6 +3007,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnHostSignal,
+                                                  api_id_t::zeEventHostSignal,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -2824,6 +3034,8 @@ namespace tracing_layer
         if( nullptr == pfnHostSynchronize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeEventHostSynchronize, context.zeDdiTable.Event.pfnHostSynchronize, hEvent, timeout);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnHostSynchronize, hEvent, timeout);
 
         // capture parameters
@@ -2838,6 +3050,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnHostSynchronize,
+                                                  api_id_t::zeEventHostSynchronize,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -2858,6 +3071,8 @@ namespace tracing_layer
         if( nullptr == pfnQueryStatus)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeEventQueryStatus, context.zeDdiTable.Event.pfnQueryStatus, hEvent);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnQueryStatus, hEvent);
 
         // capture parameters
@@ -2871,6 +3086,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnQueryStatus,
+                                                  api_id_t::zeEventQueryStatus,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -2891,6 +3107,8 @@ namespace tracing_layer
         if( nullptr == pfnAppendEventReset)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListAppendEventReset, context.zeDdiTable.CommandList.pfnAppendEventReset, hCommandList, hEvent);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendEventReset, hCommandList, hEvent);
 
         // capture parameters
@@ -2905,6 +3123,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendEventReset,
+                                                  api_id_t::zeCommandListAppendEventReset,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -2925,6 +3144,8 @@ namespace tracing_layer
         if( nullptr == pfnHostReset)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeEventHostReset, context.zeDdiTable.Event.pfnHostReset, hEvent);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnHostReset, hEvent);
 
         // capture parameters
@@ -2938,6 +3159,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnHostReset,
+                                                  api_id_t::zeEventHostReset,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -2958,6 +3180,8 @@ namespace tracing_layer
         if( nullptr == pfnQueryKernelTimestamp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeEventQueryKernelTimestamp, context.zeDdiTable.Event.pfnQueryKernelTimestamp, hEvent, dstptr);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnQueryKernelTimestamp, hEvent, dstptr);
 
         // capture parameters
@@ -2972,6 +3196,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnQueryKernelTimestamp,
+                                                  api_id_t::zeEventQueryKernelTimestamp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3004,6 +3229,8 @@ namespace tracing_layer
         if( nullptr == pfnAppendQueryKernelTimestamps)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListAppendQueryKernelTimestamps, context.zeDdiTable.CommandList.pfnAppendQueryKernelTimestamps, hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendQueryKernelTimestamps, hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -3024,6 +3251,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendQueryKernelTimestamps,
+                                                  api_id_t::zeCommandListAppendQueryKernelTimestamps,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3051,6 +3279,8 @@ namespace tracing_layer
         if( nullptr == pfnGetEventPool)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeEventGetEventPool, context.zeDdiTable.Event.pfnGetEventPool, hEvent, phEventPool);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnGetEventPool, hEvent, phEventPool);
 
         // capture parameters
@@ -3065,6 +3295,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnGetEventPool,
+                                                  api_id_t::zeEventGetEventPool,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3088,6 +3319,8 @@ namespace tracing_layer
         if( nullptr == pfnGetSignalScope)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeEventGetSignalScope, context.zeDdiTable.Event.pfnGetSignalScope, hEvent, pSignalScope);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnGetSignalScope, hEvent, pSignalScope);
 
         // capture parameters
@@ -3102,6 +3335,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnGetSignalScope,
+                                                  api_id_t::zeEventGetSignalScope,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3125,6 +3359,8 @@ namespace tracing_layer
         if( nullptr == pfnGetWaitScope)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeEventGetWaitScope, context.zeDdiTable.Event.pfnGetWaitScope, hEvent, pWaitScope);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnGetWaitScope, hEvent, pWaitScope);
 
         // capture parameters
@@ -3139,6 +3375,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnGetWaitScope,
+                                                  api_id_t::zeEventGetWaitScope,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3160,6 +3397,8 @@ namespace tracing_layer
         if( nullptr == pfnGetContextHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeEventPoolGetContextHandle, context.zeDdiTable.EventPool.pfnGetContextHandle, hEventPool, phContext);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnGetContextHandle, hEventPool, phContext);
 
         // capture parameters
@@ -3174,6 +3413,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.EventPool.pfnGetContextHandle,
+                                                  api_id_t::zeEventPoolGetContextHandle,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3196,6 +3436,8 @@ namespace tracing_layer
         if( nullptr == pfnGetFlags)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeEventPoolGetFlags, context.zeDdiTable.EventPool.pfnGetFlags, hEventPool, pFlags);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventPool.pfnGetFlags, hEventPool, pFlags);
 
         // capture parameters
@@ -3210,6 +3452,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.EventPool.pfnGetFlags,
+                                                  api_id_t::zeEventPoolGetFlags,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3232,6 +3475,8 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeFenceCreate, context.zeDdiTable.Fence.pfnCreate, hCommandQueue, desc, phFence);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Fence.pfnCreate, hCommandQueue, desc, phFence);
 
         // capture parameters
@@ -3247,6 +3492,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Fence.pfnCreate,
+                                                  api_id_t::zeFenceCreate,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3268,6 +3514,8 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeFenceDestroy, context.zeDdiTable.Fence.pfnDestroy, hFence);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Fence.pfnDestroy, hFence);
 
         // capture parameters
@@ -3281,6 +3529,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Fence.pfnDestroy,
+                                                  api_id_t::zeFenceDestroy,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3307,6 +3556,8 @@ namespace tracing_layer
         if( nullptr == pfnHostSynchronize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeFenceHostSynchronize, context.zeDdiTable.Fence.pfnHostSynchronize, hFence, timeout);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Fence.pfnHostSynchronize, hFence, timeout);
 
         // capture parameters
@@ -3321,6 +3572,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Fence.pfnHostSynchronize,
+                                                  api_id_t::zeFenceHostSynchronize,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3341,6 +3593,8 @@ namespace tracing_layer
         if( nullptr == pfnQueryStatus)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeFenceQueryStatus, context.zeDdiTable.Fence.pfnQueryStatus, hFence);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Fence.pfnQueryStatus, hFence);
 
         // capture parameters
@@ -3354,6 +3608,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Fence.pfnQueryStatus,
+                                                  api_id_t::zeFenceQueryStatus,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3373,6 +3628,8 @@ namespace tracing_layer
         if( nullptr == pfnReset)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeFenceReset, context.zeDdiTable.Fence.pfnReset, hFence);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Fence.pfnReset, hFence);
 
         // capture parameters
@@ -3386,6 +3643,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Fence.pfnReset,
+                                                  api_id_t::zeFenceReset,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3407,6 +3665,8 @@ namespace tracing_layer
         if( nullptr == pfnGetProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeImageGetProperties, context.zeDdiTable.Image.pfnGetProperties, hDevice, desc, pImageProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Image.pfnGetProperties, hDevice, desc, pImageProperties);
 
         // capture parameters
@@ -3422,6 +3682,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Image.pfnGetProperties,
+                                                  api_id_t::zeImageGetProperties,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3446,6 +3707,8 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeImageCreate, context.zeDdiTable.Image.pfnCreate, hContext, hDevice, desc, phImage);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Image.pfnCreate, hContext, hDevice, desc, phImage);
 
         // capture parameters
@@ -3462,6 +3725,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Image.pfnCreate,
+                                                  api_id_t::zeImageCreate,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3484,6 +3748,8 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeImageDestroy, context.zeDdiTable.Image.pfnDestroy, hImage);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Image.pfnDestroy, hImage);
 
         // capture parameters
@@ -3497,6 +3763,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Image.pfnDestroy,
+                                                  api_id_t::zeImageDestroy,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3524,6 +3791,8 @@ namespace tracing_layer
         if( nullptr == pfnAllocShared)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeMemAllocShared, context.zeDdiTable.Mem.pfnAllocShared, hContext, device_desc, host_desc, size, alignment, hDevice, pptr);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnAllocShared, hContext, device_desc, host_desc, size, alignment, hDevice, pptr);
 
         // capture parameters
@@ -3543,6 +3812,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnAllocShared,
+                                                  api_id_t::zeMemAllocShared,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3575,6 +3845,8 @@ namespace tracing_layer
         if( nullptr == pfnAllocDevice)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeMemAllocDevice, context.zeDdiTable.Mem.pfnAllocDevice, hContext, device_desc, size, alignment, hDevice, pptr);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnAllocDevice, hContext, device_desc, size, alignment, hDevice, pptr);
 
         // capture parameters
@@ -3593,6 +3865,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnAllocDevice,
+                                                  api_id_t::zeMemAllocDevice,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3623,6 +3896,8 @@ namespace tracing_layer
         if( nullptr == pfnAllocHost)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeMemAllocHost, context.zeDdiTable.Mem.pfnAllocHost, hContext, host_desc, size, alignment, pptr);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnAllocHost, hContext, host_desc, size, alignment, pptr);
 
         // capture parameters
@@ -3640,6 +3915,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnAllocHost,
+                                                  api_id_t::zeMemAllocHost,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3664,6 +3940,8 @@ namespace tracing_layer
         if( nullptr == pfnFree)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeMemFree, context.zeDdiTable.Mem.pfnFree, hContext, ptr);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnFree, hContext, ptr);
 
         // capture parameters
@@ -3678,6 +3956,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnFree,
+                                                  api_id_t::zeMemFree,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3701,6 +3980,8 @@ namespace tracing_layer
         if( nullptr == pfnGetAllocProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeMemGetAllocProperties, context.zeDdiTable.Mem.pfnGetAllocProperties, hContext, ptr, pMemAllocProperties, phDevice);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnGetAllocProperties, hContext, ptr, pMemAllocProperties, phDevice);
 
         // capture parameters
@@ -3717,6 +3998,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnGetAllocProperties,
+                                                  api_id_t::zeMemGetAllocProperties,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3742,6 +4024,8 @@ namespace tracing_layer
         if( nullptr == pfnGetAddressRange)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeMemGetAddressRange, context.zeDdiTable.Mem.pfnGetAddressRange, hContext, ptr, pBase, pSize);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnGetAddressRange, hContext, ptr, pBase, pSize);
 
         // capture parameters
@@ -3758,6 +4042,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnGetAddressRange,
+                                                  api_id_t::zeMemGetAddressRange,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3782,6 +4067,8 @@ namespace tracing_layer
         if( nullptr == pfnGetIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeMemGetIpcHandle, context.zeDdiTable.Mem.pfnGetIpcHandle, hContext, ptr, pIpcHandle);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnGetIpcHandle, hContext, ptr, pIpcHandle);
 
         // capture parameters
@@ -3797,6 +4084,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnGetIpcHandle,
+                                                  api_id_t::zeMemGetIpcHandle,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3820,6 +4108,8 @@ namespace tracing_layer
         if( nullptr == pfnGetIpcHandleFromFileDescriptorExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeMemGetIpcHandleFromFileDescriptorExp, context.zeDdiTable.MemExp.pfnGetIpcHandleFromFileDescriptorExp, hContext, handle, pIpcHandle);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.MemExp.pfnGetIpcHandleFromFileDescriptorExp, hContext, handle, pIpcHandle);
 
         // capture parameters
@@ -3835,6 +4125,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.MemExp.pfnGetIpcHandleFromFileDescriptorExp,
+                                                  api_id_t::zeMemGetIpcHandleFromFileDescriptorExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3858,6 +4149,8 @@ namespace tracing_layer
         if( nullptr == pfnGetFileDescriptorFromIpcHandleExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeMemGetFileDescriptorFromIpcHandleExp, context.zeDdiTable.MemExp.pfnGetFileDescriptorFromIpcHandleExp, hContext, ipcHandle, pHandle);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.MemExp.pfnGetFileDescriptorFromIpcHandleExp, hContext, ipcHandle, pHandle);
 
         // capture parameters
@@ -3873,6 +4166,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.MemExp.pfnGetFileDescriptorFromIpcHandleExp,
+                                                  api_id_t::zeMemGetFileDescriptorFromIpcHandleExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3895,6 +4189,8 @@ namespace tracing_layer
         if( nullptr == pfnPutIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeMemPutIpcHandle, context.zeDdiTable.Mem.pfnPutIpcHandle, hContext, handle);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnPutIpcHandle, hContext, handle);
 
         // capture parameters
@@ -3909,6 +4205,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnPutIpcHandle,
+                                                  api_id_t::zeMemPutIpcHandle,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3934,6 +4231,8 @@ namespace tracing_layer
         if( nullptr == pfnOpenIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeMemOpenIpcHandle, context.zeDdiTable.Mem.pfnOpenIpcHandle, hContext, hDevice, handle, flags, pptr);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnOpenIpcHandle, hContext, hDevice, handle, flags, pptr);
 
         // capture parameters
@@ -3951,6 +4250,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnOpenIpcHandle,
+                                                  api_id_t::zeMemOpenIpcHandle,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -3975,6 +4275,8 @@ namespace tracing_layer
         if( nullptr == pfnCloseIpcHandle)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeMemCloseIpcHandle, context.zeDdiTable.Mem.pfnCloseIpcHandle, hContext, ptr);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnCloseIpcHandle, hContext, ptr);
 
         // capture parameters
@@ -3989,6 +4291,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnCloseIpcHandle,
+                                                  api_id_t::zeMemCloseIpcHandle,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4014,6 +4317,8 @@ namespace tracing_layer
         if( nullptr == pfnSetAtomicAccessAttributeExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeMemSetAtomicAccessAttributeExp, context.zeDdiTable.MemExp.pfnSetAtomicAccessAttributeExp, hContext, hDevice, ptr, size, attr);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.MemExp.pfnSetAtomicAccessAttributeExp, hContext, hDevice, ptr, size, attr);
 
         // capture parameters
@@ -4031,6 +4336,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.MemExp.pfnSetAtomicAccessAttributeExp,
+                                                  api_id_t::zeMemSetAtomicAccessAttributeExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4058,6 +4364,8 @@ namespace tracing_layer
         if( nullptr == pfnGetAtomicAccessAttributeExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeMemGetAtomicAccessAttributeExp, context.zeDdiTable.MemExp.pfnGetAtomicAccessAttributeExp, hContext, hDevice, ptr, size, pAttr);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.MemExp.pfnGetAtomicAccessAttributeExp, hContext, hDevice, ptr, size, pAttr);
 
         // capture parameters
@@ -4075,6 +4383,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.MemExp.pfnGetAtomicAccessAttributeExp,
+                                                  api_id_t::zeMemGetAtomicAccessAttributeExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4102,6 +4411,8 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeModuleCreate, context.zeDdiTable.Module.pfnCreate, hContext, hDevice, desc, phModule, phBuildLog);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnCreate, hContext, hDevice, desc, phModule, phBuildLog);
 
         // capture parameters
@@ -4119,6 +4430,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnCreate,
+                                                  api_id_t::zeModuleCreate,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4142,6 +4454,8 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeModuleDestroy, context.zeDdiTable.Module.pfnDestroy, hModule);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnDestroy, hModule);
 
         // capture parameters
@@ -4155,6 +4469,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnDestroy,
+                                                  api_id_t::zeModuleDestroy,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4177,6 +4492,8 @@ namespace tracing_layer
         if( nullptr == pfnDynamicLink)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeModuleDynamicLink, context.zeDdiTable.Module.pfnDynamicLink, numModules, phModules, phLinkLog);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnDynamicLink, numModules, phModules, phLinkLog);
 
         // capture parameters
@@ -4192,6 +4509,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnDynamicLink,
+                                                  api_id_t::zeModuleDynamicLink,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4213,6 +4531,8 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeModuleBuildLogDestroy, context.zeDdiTable.ModuleBuildLog.pfnDestroy, hModuleBuildLog);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.ModuleBuildLog.pfnDestroy, hModuleBuildLog);
 
         // capture parameters
@@ -4226,6 +4546,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.ModuleBuildLog.pfnDestroy,
+                                                  api_id_t::zeModuleBuildLogDestroy,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4247,6 +4568,8 @@ namespace tracing_layer
         if( nullptr == pfnGetString)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeModuleBuildLogGetString, context.zeDdiTable.ModuleBuildLog.pfnGetString, hModuleBuildLog, pSize, pBuildLog);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.ModuleBuildLog.pfnGetString, hModuleBuildLog, pSize, pBuildLog);
 
         // capture parameters
@@ -4262,6 +4585,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.ModuleBuildLog.pfnGetString,
+                                                  api_id_t::zeModuleBuildLogGetString,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4285,6 +4609,8 @@ namespace tracing_layer
         if( nullptr == pfnGetNativeBinary)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeModuleGetNativeBinary, context.zeDdiTable.Module.pfnGetNativeBinary, hModule, pSize, pModuleNativeBinary);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnGetNativeBinary, hModule, pSize, pModuleNativeBinary);
 
         // capture parameters
@@ -4300,6 +4626,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnGetNativeBinary,
+                                                  api_id_t::zeModuleGetNativeBinary,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4324,6 +4651,8 @@ namespace tracing_layer
         if( nullptr == pfnGetGlobalPointer)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeModuleGetGlobalPointer, context.zeDdiTable.Module.pfnGetGlobalPointer, hModule, pGlobalName, pSize, pptr);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnGetGlobalPointer, hModule, pGlobalName, pSize, pptr);
 
         // capture parameters
@@ -4340,6 +4669,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnGetGlobalPointer,
+                                                  api_id_t::zeModuleGetGlobalPointer,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4370,6 +4700,8 @@ namespace tracing_layer
         if( nullptr == pfnGetKernelNames)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeModuleGetKernelNames, context.zeDdiTable.Module.pfnGetKernelNames, hModule, pCount, pNames);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnGetKernelNames, hModule, pCount, pNames);
 
         // capture parameters
@@ -4385,6 +4717,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnGetKernelNames,
+                                                  api_id_t::zeModuleGetKernelNames,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4407,6 +4740,8 @@ namespace tracing_layer
         if( nullptr == pfnGetProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeModuleGetProperties, context.zeDdiTable.Module.pfnGetProperties, hModule, pModuleProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnGetProperties, hModule, pModuleProperties);
 
         // capture parameters
@@ -4421,6 +4756,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnGetProperties,
+                                                  api_id_t::zeModuleGetProperties,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4443,6 +4779,8 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeKernelCreate, context.zeDdiTable.Kernel.pfnCreate, hModule, desc, phKernel);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnCreate, hModule, desc, phKernel);
 
         // capture parameters
@@ -4458,6 +4796,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnCreate,
+                                                  api_id_t::zeKernelCreate,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4479,6 +4818,8 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeKernelDestroy, context.zeDdiTable.Kernel.pfnDestroy, hKernel);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnDestroy, hKernel);
 
         // capture parameters
@@ -4492,6 +4833,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnDestroy,
+                                                  api_id_t::zeKernelDestroy,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4513,6 +4855,8 @@ namespace tracing_layer
         if( nullptr == pfnGetFunctionPointer)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeModuleGetFunctionPointer, context.zeDdiTable.Module.pfnGetFunctionPointer, hModule, pFunctionName, pfnFunction);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnGetFunctionPointer, hModule, pFunctionName, pfnFunction);
 
         // capture parameters
@@ -4528,6 +4872,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnGetFunctionPointer,
+                                                  api_id_t::zeModuleGetFunctionPointer,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4552,6 +4897,8 @@ namespace tracing_layer
         if( nullptr == pfnSetGroupSize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeKernelSetGroupSize, context.zeDdiTable.Kernel.pfnSetGroupSize, hKernel, groupSizeX, groupSizeY, groupSizeZ);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnSetGroupSize, hKernel, groupSizeX, groupSizeY, groupSizeZ);
 
         // capture parameters
@@ -4568,6 +4915,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnSetGroupSize,
+                                                  api_id_t::zeKernelSetGroupSize,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4596,6 +4944,8 @@ namespace tracing_layer
         if( nullptr == pfnSuggestGroupSize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeKernelSuggestGroupSize, context.zeDdiTable.Kernel.pfnSuggestGroupSize, hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnSuggestGroupSize, hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ);
 
         // capture parameters
@@ -4615,6 +4965,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnSuggestGroupSize,
+                                                  api_id_t::zeKernelSuggestGroupSize,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4641,6 +4992,8 @@ namespace tracing_layer
         if( nullptr == pfnSuggestMaxCooperativeGroupCount)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeKernelSuggestMaxCooperativeGroupCount, context.zeDdiTable.Kernel.pfnSuggestMaxCooperativeGroupCount, hKernel, totalGroupCount);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnSuggestMaxCooperativeGroupCount, hKernel, totalGroupCount);
 
         // capture parameters
@@ -4655,6 +5008,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnSuggestMaxCooperativeGroupCount,
+                                                  api_id_t::zeKernelSuggestMaxCooperativeGroupCount,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4679,6 +5033,8 @@ namespace tracing_layer
         if( nullptr == pfnSetArgumentValue)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeKernelSetArgumentValue, context.zeDdiTable.Kernel.pfnSetArgumentValue, hKernel, argIndex, argSize, pArgValue);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnSetArgumentValue, hKernel, argIndex, argSize, pArgValue);
 
         // capture parameters
@@ -4695,6 +5051,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnSetArgumentValue,
+                                                  api_id_t::zeKernelSetArgumentValue,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4718,6 +5075,8 @@ namespace tracing_layer
         if( nullptr == pfnSetIndirectAccess)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeKernelSetIndirectAccess, context.zeDdiTable.Kernel.pfnSetIndirectAccess, hKernel, flags);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnSetIndirectAccess, hKernel, flags);
 
         // capture parameters
@@ -4732,6 +5091,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnSetIndirectAccess,
+                                                  api_id_t::zeKernelSetIndirectAccess,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4753,6 +5113,8 @@ namespace tracing_layer
         if( nullptr == pfnGetIndirectAccess)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeKernelGetIndirectAccess, context.zeDdiTable.Kernel.pfnGetIndirectAccess, hKernel, pFlags);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnGetIndirectAccess, hKernel, pFlags);
 
         // capture parameters
@@ -4767,6 +5129,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnGetIndirectAccess,
+                                                  api_id_t::zeKernelGetIndirectAccess,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4796,6 +5159,8 @@ namespace tracing_layer
         if( nullptr == pfnGetSourceAttributes)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeKernelGetSourceAttributes, context.zeDdiTable.Kernel.pfnGetSourceAttributes, hKernel, pSize, pString);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnGetSourceAttributes, hKernel, pSize, pString);
 
         // capture parameters
@@ -4811,6 +5176,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnGetSourceAttributes,
+                                                  api_id_t::zeKernelGetSourceAttributes,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4834,6 +5200,8 @@ namespace tracing_layer
         if( nullptr == pfnSetCacheConfig)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeKernelSetCacheConfig, context.zeDdiTable.Kernel.pfnSetCacheConfig, hKernel, flags);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnSetCacheConfig, hKernel, flags);
 
         // capture parameters
@@ -4848,6 +5216,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnSetCacheConfig,
+                                                  api_id_t::zeKernelSetCacheConfig,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4869,6 +5238,8 @@ namespace tracing_layer
         if( nullptr == pfnGetProperties)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeKernelGetProperties, context.zeDdiTable.Kernel.pfnGetProperties, hKernel, pKernelProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnGetProperties, hKernel, pKernelProperties);
 
         // capture parameters
@@ -4883,6 +5254,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnGetProperties,
+                                                  api_id_t::zeKernelGetProperties,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4906,6 +5278,8 @@ namespace tracing_layer
         if( nullptr == pfnGetName)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeKernelGetName, context.zeDdiTable.Kernel.pfnGetName, hKernel, pSize, pName);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Kernel.pfnGetName, hKernel, pSize, pName);
 
         // capture parameters
@@ -4921,6 +5295,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Kernel.pfnGetName,
+                                                  api_id_t::zeKernelGetName,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4949,6 +5324,8 @@ namespace tracing_layer
         if( nullptr == pfnAppendLaunchKernel)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListAppendLaunchKernel, context.zeDdiTable.CommandList.pfnAppendLaunchKernel, hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendLaunchKernel, hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -4967,6 +5344,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendLaunchKernel,
+                                                  api_id_t::zeCommandListAppendLaunchKernel,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -4998,6 +5376,8 @@ namespace tracing_layer
         if( nullptr == pfnAppendLaunchCooperativeKernel)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListAppendLaunchCooperativeKernel, context.zeDdiTable.CommandList.pfnAppendLaunchCooperativeKernel, hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendLaunchCooperativeKernel, hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -5016,6 +5396,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendLaunchCooperativeKernel,
+                                                  api_id_t::zeCommandListAppendLaunchCooperativeKernel,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -5048,6 +5429,8 @@ namespace tracing_layer
         if( nullptr == pfnAppendLaunchKernelIndirect)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListAppendLaunchKernelIndirect, context.zeDdiTable.CommandList.pfnAppendLaunchKernelIndirect, hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendLaunchKernelIndirect, hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -5066,6 +5449,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendLaunchKernelIndirect,
+                                                  api_id_t::zeCommandListAppendLaunchKernelIndirect,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -5102,6 +5486,8 @@ namespace tracing_layer
         if( nullptr == pfnAppendLaunchMultipleKernelsIndirect)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListAppendLaunchMultipleKernelsIndirect, context.zeDdiTable.CommandList.pfnAppendLaunchMultipleKernelsIndirect, hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendLaunchMultipleKernelsIndirect, hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -5122,6 +5508,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendLaunchMultipleKernelsIndirect,
+                                                  api_id_t::zeCommandListAppendLaunchMultipleKernelsIndirect,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -5151,6 +5538,8 @@ namespace tracing_layer
         if( nullptr == pfnMakeMemoryResident)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeContextMakeMemoryResident, context.zeDdiTable.Context.pfnMakeMemoryResident, hContext, hDevice, ptr, size);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnMakeMemoryResident, hContext, hDevice, ptr, size);
 
         // capture parameters
@@ -5167,6 +5556,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnMakeMemoryResident,
+                                                  api_id_t::zeContextMakeMemoryResident,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -5192,6 +5582,8 @@ namespace tracing_layer
         if( nullptr == pfnEvictMemory)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeContextEvictMemory, context.zeDdiTable.Context.pfnEvictMemory, hContext, hDevice, ptr, size);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnEvictMemory, hContext, hDevice, ptr, size);
 
         // capture parameters
@@ -5208,6 +5600,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnEvictMemory,
+                                                  api_id_t::zeContextEvictMemory,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -5232,6 +5625,8 @@ namespace tracing_layer
         if( nullptr == pfnMakeImageResident)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeContextMakeImageResident, context.zeDdiTable.Context.pfnMakeImageResident, hContext, hDevice, hImage);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnMakeImageResident, hContext, hDevice, hImage);
 
         // capture parameters
@@ -5247,6 +5642,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnMakeImageResident,
+                                                  api_id_t::zeContextMakeImageResident,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -5270,6 +5666,8 @@ namespace tracing_layer
         if( nullptr == pfnEvictImage)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeContextEvictImage, context.zeDdiTable.Context.pfnEvictImage, hContext, hDevice, hImage);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Context.pfnEvictImage, hContext, hDevice, hImage);
 
         // capture parameters
@@ -5285,6 +5683,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Context.pfnEvictImage,
+                                                  api_id_t::zeContextEvictImage,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -5309,6 +5708,8 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeSamplerCreate, context.zeDdiTable.Sampler.pfnCreate, hContext, hDevice, desc, phSampler);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Sampler.pfnCreate, hContext, hDevice, desc, phSampler);
 
         // capture parameters
@@ -5325,6 +5726,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Sampler.pfnCreate,
+                                                  api_id_t::zeSamplerCreate,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -5347,6 +5749,8 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeSamplerDestroy, context.zeDdiTable.Sampler.pfnDestroy, hSampler);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Sampler.pfnDestroy, hSampler);
 
         // capture parameters
@@ -5360,6 +5764,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Sampler.pfnDestroy,
+                                                  api_id_t::zeSamplerDestroy,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -5383,6 +5788,8 @@ namespace tracing_layer
         if( nullptr == pfnReserve)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeVirtualMemReserve, context.zeDdiTable.VirtualMem.pfnReserve, hContext, pStart, size, pptr);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnReserve, hContext, pStart, size, pptr);
 
         // capture parameters
@@ -5399,6 +5806,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.VirtualMem.pfnReserve,
+                                                  api_id_t::zeVirtualMemReserve,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -5423,6 +5831,8 @@ namespace tracing_layer
         if( nullptr == pfnFree)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeVirtualMemFree, context.zeDdiTable.VirtualMem.pfnFree, hContext, ptr, size);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnFree, hContext, ptr, size);
 
         // capture parameters
@@ -5438,6 +5848,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.VirtualMem.pfnFree,
+                                                  api_id_t::zeVirtualMemFree,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -5463,6 +5874,8 @@ namespace tracing_layer
         if( nullptr == pfnQueryPageSize)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeVirtualMemQueryPageSize, context.zeDdiTable.VirtualMem.pfnQueryPageSize, hContext, hDevice, size, pagesize);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnQueryPageSize, hContext, hDevice, size, pagesize);
 
         // capture parameters
@@ -5479,6 +5892,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.VirtualMem.pfnQueryPageSize,
+                                                  api_id_t::zeVirtualMemQueryPageSize,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -5504,6 +5918,8 @@ namespace tracing_layer
         if( nullptr == pfnCreate)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zePhysicalMemCreate, context.zeDdiTable.PhysicalMem.pfnCreate, hContext, hDevice, desc, phPhysicalMemory);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.PhysicalMem.pfnCreate, hContext, hDevice, desc, phPhysicalMemory);
 
         // capture parameters
@@ -5520,6 +5936,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.PhysicalMem.pfnCreate,
+                                                  api_id_t::zePhysicalMemCreate,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -5543,6 +5960,8 @@ namespace tracing_layer
         if( nullptr == pfnDestroy)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zePhysicalMemDestroy, context.zeDdiTable.PhysicalMem.pfnDestroy, hContext, hPhysicalMemory);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.PhysicalMem.pfnDestroy, hContext, hPhysicalMemory);
 
         // capture parameters
@@ -5557,6 +5976,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.PhysicalMem.pfnDestroy,
+                                                  api_id_t::zePhysicalMemDestroy,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -5585,6 +6005,8 @@ namespace tracing_layer
         if( nullptr == pfnMap)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeVirtualMemMap, context.zeDdiTable.VirtualMem.pfnMap, hContext, ptr, size, hPhysicalMemory, offset, access);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnMap, hContext, ptr, size, hPhysicalMemory, offset, access);
 
         // capture parameters
@@ -5603,6 +6025,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.VirtualMem.pfnMap,
+                                                  api_id_t::zeVirtualMemMap,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -5629,6 +6052,8 @@ namespace tracing_layer
         if( nullptr == pfnUnmap)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeVirtualMemUnmap, context.zeDdiTable.VirtualMem.pfnUnmap, hContext, ptr, size);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnUnmap, hContext, ptr, size);
 
         // capture parameters
@@ -5644,6 +6069,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.VirtualMem.pfnUnmap,
+                                                  api_id_t::zeVirtualMemUnmap,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -5669,6 +6095,8 @@ namespace tracing_layer
         if( nullptr == pfnSetAccessAttribute)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeVirtualMemSetAccessAttribute, context.zeDdiTable.VirtualMem.pfnSetAccessAttribute, hContext, ptr, size, access);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnSetAccessAttribute, hContext, ptr, size, access);
 
         // capture parameters
@@ -5685,6 +6113,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.VirtualMem.pfnSetAccessAttribute,
+                                                  api_id_t::zeVirtualMemSetAccessAttribute,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -5712,6 +6141,8 @@ namespace tracing_layer
         if( nullptr == pfnGetAccessAttribute)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeVirtualMemGetAccessAttribute, context.zeDdiTable.VirtualMem.pfnGetAccessAttribute, hContext, ptr, size, access, outSize);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.VirtualMem.pfnGetAccessAttribute, hContext, ptr, size, access, outSize);
 
         // capture parameters
@@ -5729,6 +6160,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.VirtualMem.pfnGetAccessAttribute,
+                                                  api_id_t::zeVirtualMemGetAccessAttribute,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -5755,6 +6187,8 @@ namespace tracing_layer
         if( nullptr == pfnSetGlobalOffsetExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeKernelSetGlobalOffsetExp, context.zeDdiTable.KernelExp.pfnSetGlobalOffsetExp, hKernel, offsetX, offsetY, offsetZ);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.KernelExp.pfnSetGlobalOffsetExp, hKernel, offsetX, offsetY, offsetZ);
 
         // capture parameters
@@ -5771,6 +6205,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.KernelExp.pfnSetGlobalOffsetExp,
+                                                  api_id_t::zeKernelSetGlobalOffsetExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -5798,6 +6233,8 @@ namespace tracing_layer
         if( nullptr == pfnReserveCacheExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDeviceReserveCacheExt, context.zeDdiTable.Device.pfnReserveCacheExt, hDevice, cacheLevel, cacheReservationSize);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnReserveCacheExt, hDevice, cacheLevel, cacheReservationSize);
 
         // capture parameters
@@ -5813,6 +6250,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnReserveCacheExt,
+                                                  api_id_t::zeDeviceReserveCacheExt,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -5837,6 +6275,8 @@ namespace tracing_layer
         if( nullptr == pfnSetCacheAdviceExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDeviceSetCacheAdviceExt, context.zeDdiTable.Device.pfnSetCacheAdviceExt, hDevice, ptr, regionSize, cacheRegion);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnSetCacheAdviceExt, hDevice, ptr, regionSize, cacheRegion);
 
         // capture parameters
@@ -5853,6 +6293,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnSetCacheAdviceExt,
+                                                  api_id_t::zeDeviceSetCacheAdviceExt,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -5884,6 +6325,8 @@ namespace tracing_layer
         if( nullptr == pfnQueryTimestampsExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeEventQueryTimestampsExp, context.zeDdiTable.EventExp.pfnQueryTimestampsExp, hEvent, hDevice, pCount, pTimestamps);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.EventExp.pfnQueryTimestampsExp, hEvent, hDevice, pCount, pTimestamps);
 
         // capture parameters
@@ -5900,6 +6343,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.EventExp.pfnQueryTimestampsExp,
+                                                  api_id_t::zeEventQueryTimestampsExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -5923,6 +6367,8 @@ namespace tracing_layer
         if( nullptr == pfnGetMemoryPropertiesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeImageGetMemoryPropertiesExp, context.zeDdiTable.ImageExp.pfnGetMemoryPropertiesExp, hImage, pMemoryProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.ImageExp.pfnGetMemoryPropertiesExp, hImage, pMemoryProperties);
 
         // capture parameters
@@ -5937,6 +6383,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.ImageExp.pfnGetMemoryPropertiesExp,
+                                                  api_id_t::zeImageGetMemoryPropertiesExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -5961,6 +6408,8 @@ namespace tracing_layer
         if( nullptr == pfnViewCreateExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeImageViewCreateExt, context.zeDdiTable.Image.pfnViewCreateExt, hContext, hDevice, desc, hImage, phImageView);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Image.pfnViewCreateExt, hContext, hDevice, desc, hImage, phImageView);
 
         // capture parameters
@@ -5978,6 +6427,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Image.pfnViewCreateExt,
+                                                  api_id_t::zeImageViewCreateExt,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -6005,6 +6455,8 @@ namespace tracing_layer
         if( nullptr == pfnViewCreateExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeImageViewCreateExp, context.zeDdiTable.ImageExp.pfnViewCreateExp, hContext, hDevice, desc, hImage, phImageView);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.ImageExp.pfnViewCreateExp, hContext, hDevice, desc, hImage, phImageView);
 
         // capture parameters
@@ -6022,6 +6474,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.ImageExp.pfnViewCreateExp,
+                                                  api_id_t::zeImageViewCreateExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -6046,6 +6499,8 @@ namespace tracing_layer
         if( nullptr == pfnSchedulingHintExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeKernelSchedulingHintExp, context.zeDdiTable.KernelExp.pfnSchedulingHintExp, hKernel, pHint);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.KernelExp.pfnSchedulingHintExp, hKernel, pHint);
 
         // capture parameters
@@ -6060,6 +6515,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.KernelExp.pfnSchedulingHintExp,
+                                                  api_id_t::zeKernelSchedulingHintExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -6081,6 +6537,8 @@ namespace tracing_layer
         if( nullptr == pfnPciGetPropertiesExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDevicePciGetPropertiesExt, context.zeDdiTable.Device.pfnPciGetPropertiesExt, hDevice, pPciProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Device.pfnPciGetPropertiesExt, hDevice, pPciProperties);
 
         // capture parameters
@@ -6095,6 +6553,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Device.pfnPciGetPropertiesExt,
+                                                  api_id_t::zeDevicePciGetPropertiesExt,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -6127,6 +6586,8 @@ namespace tracing_layer
         if( nullptr == pfnAppendImageCopyToMemoryExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListAppendImageCopyToMemoryExt, context.zeDdiTable.CommandList.pfnAppendImageCopyToMemoryExt, hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendImageCopyToMemoryExt, hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -6148,6 +6609,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendImageCopyToMemoryExt,
+                                                  api_id_t::zeCommandListAppendImageCopyToMemoryExt,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -6187,6 +6649,8 @@ namespace tracing_layer
         if( nullptr == pfnAppendImageCopyFromMemoryExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListAppendImageCopyFromMemoryExt, context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemoryExt, hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemoryExt, hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -6208,6 +6672,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandList.pfnAppendImageCopyFromMemoryExt,
+                                                  api_id_t::zeCommandListAppendImageCopyFromMemoryExt,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -6237,6 +6702,8 @@ namespace tracing_layer
         if( nullptr == pfnGetAllocPropertiesExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeImageGetAllocPropertiesExt, context.zeDdiTable.Image.pfnGetAllocPropertiesExt, hContext, hImage, pImageAllocProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Image.pfnGetAllocPropertiesExt, hContext, hImage, pImageAllocProperties);
 
         // capture parameters
@@ -6252,6 +6719,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Image.pfnGetAllocPropertiesExt,
+                                                  api_id_t::zeImageGetAllocPropertiesExt,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -6278,6 +6746,8 @@ namespace tracing_layer
         if( nullptr == pfnInspectLinkageExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeModuleInspectLinkageExt, context.zeDdiTable.Module.pfnInspectLinkageExt, pInspectDesc, numModules, phModules, phLog);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Module.pfnInspectLinkageExt, pInspectDesc, numModules, phModules, phLog);
 
         // capture parameters
@@ -6294,6 +6764,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Module.pfnInspectLinkageExt,
+                                                  api_id_t::zeModuleInspectLinkageExt,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -6318,6 +6789,8 @@ namespace tracing_layer
         if( nullptr == pfnFreeExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeMemFreeExt, context.zeDdiTable.Mem.pfnFreeExt, hContext, pMemFreeDesc, ptr);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnFreeExt, hContext, pMemFreeDesc, ptr);
 
         // capture parameters
@@ -6333,6 +6806,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnFreeExt,
+                                                  api_id_t::zeMemFreeExt,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -6363,6 +6837,8 @@ namespace tracing_layer
         if( nullptr == pfnGetExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeFabricVertexGetExp, context.zeDdiTable.FabricVertexExp.pfnGetExp, hDriver, pCount, phVertices);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricVertexExp.pfnGetExp, hDriver, pCount, phVertices);
 
         // capture parameters
@@ -6378,6 +6854,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.FabricVertexExp.pfnGetExp,
+                                                  api_id_t::zeFabricVertexGetExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -6408,6 +6885,8 @@ namespace tracing_layer
         if( nullptr == pfnGetSubVerticesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeFabricVertexGetSubVerticesExp, context.zeDdiTable.FabricVertexExp.pfnGetSubVerticesExp, hVertex, pCount, phSubvertices);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricVertexExp.pfnGetSubVerticesExp, hVertex, pCount, phSubvertices);
 
         // capture parameters
@@ -6423,6 +6902,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.FabricVertexExp.pfnGetSubVerticesExp,
+                                                  api_id_t::zeFabricVertexGetSubVerticesExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -6445,6 +6925,8 @@ namespace tracing_layer
         if( nullptr == pfnGetPropertiesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeFabricVertexGetPropertiesExp, context.zeDdiTable.FabricVertexExp.pfnGetPropertiesExp, hVertex, pVertexProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricVertexExp.pfnGetPropertiesExp, hVertex, pVertexProperties);
 
         // capture parameters
@@ -6459,6 +6941,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.FabricVertexExp.pfnGetPropertiesExp,
+                                                  api_id_t::zeFabricVertexGetPropertiesExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -6480,6 +6963,8 @@ namespace tracing_layer
         if( nullptr == pfnGetDeviceExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeFabricVertexGetDeviceExp, context.zeDdiTable.FabricVertexExp.pfnGetDeviceExp, hVertex, phDevice);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricVertexExp.pfnGetDeviceExp, hVertex, phDevice);
 
         // capture parameters
@@ -6494,6 +6979,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.FabricVertexExp.pfnGetDeviceExp,
+                                                  api_id_t::zeFabricVertexGetDeviceExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -6515,6 +7001,8 @@ namespace tracing_layer
         if( nullptr == pfnGetFabricVertexExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDeviceGetFabricVertexExp, context.zeDdiTable.DeviceExp.pfnGetFabricVertexExp, hDevice, phVertex);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.DeviceExp.pfnGetFabricVertexExp, hDevice, phVertex);
 
         // capture parameters
@@ -6529,6 +7017,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.DeviceExp.pfnGetFabricVertexExp,
+                                                  api_id_t::zeDeviceGetFabricVertexExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -6559,6 +7048,8 @@ namespace tracing_layer
         if( nullptr == pfnGetExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeFabricEdgeGetExp, context.zeDdiTable.FabricEdgeExp.pfnGetExp, hVertexA, hVertexB, pCount, phEdges);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricEdgeExp.pfnGetExp, hVertexA, hVertexB, pCount, phEdges);
 
         // capture parameters
@@ -6575,6 +7066,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.FabricEdgeExp.pfnGetExp,
+                                                  api_id_t::zeFabricEdgeGetExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -6599,6 +7091,8 @@ namespace tracing_layer
         if( nullptr == pfnGetVerticesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeFabricEdgeGetVerticesExp, context.zeDdiTable.FabricEdgeExp.pfnGetVerticesExp, hEdge, phVertexA, phVertexB);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricEdgeExp.pfnGetVerticesExp, hEdge, phVertexA, phVertexB);
 
         // capture parameters
@@ -6614,6 +7108,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.FabricEdgeExp.pfnGetVerticesExp,
+                                                  api_id_t::zeFabricEdgeGetVerticesExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -6636,6 +7131,8 @@ namespace tracing_layer
         if( nullptr == pfnGetPropertiesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeFabricEdgeGetPropertiesExp, context.zeDdiTable.FabricEdgeExp.pfnGetPropertiesExp, hEdge, pEdgeProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.FabricEdgeExp.pfnGetPropertiesExp, hEdge, pEdgeProperties);
 
         // capture parameters
@@ -6650,6 +7147,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.FabricEdgeExp.pfnGetPropertiesExp,
+                                                  api_id_t::zeFabricEdgeGetPropertiesExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -6686,6 +7184,8 @@ namespace tracing_layer
         if( nullptr == pfnQueryKernelTimestampsExt)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeEventQueryKernelTimestampsExt, context.zeDdiTable.Event.pfnQueryKernelTimestampsExt, hEvent, hDevice, pCount, pResults);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Event.pfnQueryKernelTimestampsExt, hEvent, hDevice, pCount, pResults);
 
         // capture parameters
@@ -6702,6 +7202,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Event.pfnQueryKernelTimestampsExt,
+                                                  api_id_t::zeEventQueryKernelTimestampsExt,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -6726,6 +7227,8 @@ namespace tracing_layer
         if( nullptr == pfnCreateExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeRTASBuilderCreateExp, context.zeDdiTable.RTASBuilderExp.pfnCreateExp, hDriver, pDescriptor, phBuilder);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASBuilderExp.pfnCreateExp, hDriver, pDescriptor, phBuilder);
 
         // capture parameters
@@ -6741,6 +7244,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.RTASBuilderExp.pfnCreateExp,
+                                                  api_id_t::zeRTASBuilderCreateExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -6764,6 +7268,8 @@ namespace tracing_layer
         if( nullptr == pfnGetBuildPropertiesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeRTASBuilderGetBuildPropertiesExp, context.zeDdiTable.RTASBuilderExp.pfnGetBuildPropertiesExp, hBuilder, pBuildOpDescriptor, pProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASBuilderExp.pfnGetBuildPropertiesExp, hBuilder, pBuildOpDescriptor, pProperties);
 
         // capture parameters
@@ -6779,6 +7285,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.RTASBuilderExp.pfnGetBuildPropertiesExp,
+                                                  api_id_t::zeRTASBuilderGetBuildPropertiesExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -6802,6 +7309,8 @@ namespace tracing_layer
         if( nullptr == pfnRTASFormatCompatibilityCheckExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeDriverRTASFormatCompatibilityCheckExp, context.zeDdiTable.DriverExp.pfnRTASFormatCompatibilityCheckExp, hDriver, rtasFormatA, rtasFormatB);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.DriverExp.pfnRTASFormatCompatibilityCheckExp, hDriver, rtasFormatA, rtasFormatB);
 
         // capture parameters
@@ -6817,6 +7326,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.DriverExp.pfnRTASFormatCompatibilityCheckExp,
+                                                  api_id_t::zeDriverRTASFormatCompatibilityCheckExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -6850,6 +7360,8 @@ namespace tracing_layer
         if( nullptr == pfnBuildExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeRTASBuilderBuildExp, context.zeDdiTable.RTASBuilderExp.pfnBuildExp, hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASBuilderExp.pfnBuildExp, hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes);
 
         // capture parameters
@@ -6872,6 +7384,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.RTASBuilderExp.pfnBuildExp,
+                                                  api_id_t::zeRTASBuilderBuildExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -6900,6 +7413,8 @@ namespace tracing_layer
         if( nullptr == pfnDestroyExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeRTASBuilderDestroyExp, context.zeDdiTable.RTASBuilderExp.pfnDestroyExp, hBuilder);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASBuilderExp.pfnDestroyExp, hBuilder);
 
         // capture parameters
@@ -6913,6 +7428,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.RTASBuilderExp.pfnDestroyExp,
+                                                  api_id_t::zeRTASBuilderDestroyExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -6933,6 +7449,8 @@ namespace tracing_layer
         if( nullptr == pfnCreateExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeRTASParallelOperationCreateExp, context.zeDdiTable.RTASParallelOperationExp.pfnCreateExp, hDriver, phParallelOperation);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASParallelOperationExp.pfnCreateExp, hDriver, phParallelOperation);
 
         // capture parameters
@@ -6947,6 +7465,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.RTASParallelOperationExp.pfnCreateExp,
+                                                  api_id_t::zeRTASParallelOperationCreateExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -6968,6 +7487,8 @@ namespace tracing_layer
         if( nullptr == pfnGetPropertiesExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeRTASParallelOperationGetPropertiesExp, context.zeDdiTable.RTASParallelOperationExp.pfnGetPropertiesExp, hParallelOperation, pProperties);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASParallelOperationExp.pfnGetPropertiesExp, hParallelOperation, pProperties);
 
         // capture parameters
@@ -6982,6 +7503,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.RTASParallelOperationExp.pfnGetPropertiesExp,
+                                                  api_id_t::zeRTASParallelOperationGetPropertiesExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -7002,6 +7524,8 @@ namespace tracing_layer
         if( nullptr == pfnJoinExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeRTASParallelOperationJoinExp, context.zeDdiTable.RTASParallelOperationExp.pfnJoinExp, hParallelOperation);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASParallelOperationExp.pfnJoinExp, hParallelOperation);
 
         // capture parameters
@@ -7015,6 +7539,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.RTASParallelOperationExp.pfnJoinExp,
+                                                  api_id_t::zeRTASParallelOperationJoinExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -7034,6 +7559,8 @@ namespace tracing_layer
         if( nullptr == pfnDestroyExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeRTASParallelOperationDestroyExp, context.zeDdiTable.RTASParallelOperationExp.pfnDestroyExp, hParallelOperation);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.RTASParallelOperationExp.pfnDestroyExp, hParallelOperation);
 
         // capture parameters
@@ -7047,6 +7574,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.RTASParallelOperationExp.pfnDestroyExp,
+                                                  api_id_t::zeRTASParallelOperationDestroyExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -7071,6 +7599,8 @@ namespace tracing_layer
         if( nullptr == pfnGetPitchFor2dImage)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeMemGetPitchFor2dImage, context.zeDdiTable.Mem.pfnGetPitchFor2dImage, hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.Mem.pfnGetPitchFor2dImage, hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch);
 
         // capture parameters
@@ -7089,6 +7619,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.Mem.pfnGetPitchFor2dImage,
+                                                  api_id_t::zeMemGetPitchFor2dImage,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -7114,6 +7645,8 @@ namespace tracing_layer
         if( nullptr == pfnGetDeviceOffsetExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeImageGetDeviceOffsetExp, context.zeDdiTable.ImageExp.pfnGetDeviceOffsetExp, hImage, pDeviceOffset);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.ImageExp.pfnGetDeviceOffsetExp, hImage, pDeviceOffset);
 
         // capture parameters
@@ -7128,6 +7661,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.ImageExp.pfnGetDeviceOffsetExp,
+                                                  api_id_t::zeImageGetDeviceOffsetExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -7149,6 +7683,8 @@ namespace tracing_layer
         if( nullptr == pfnCreateCloneExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListCreateCloneExp, context.zeDdiTable.CommandListExp.pfnCreateCloneExp, hCommandList, phClonedCommandList);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandListExp.pfnCreateCloneExp, hCommandList, phClonedCommandList);
 
         // capture parameters
@@ -7163,6 +7699,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandListExp.pfnCreateCloneExp,
+                                                  api_id_t::zeCommandListCreateCloneExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -7194,6 +7731,8 @@ namespace tracing_layer
         if( nullptr == pfnImmediateAppendCommandListsExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListImmediateAppendCommandListsExp, context.zeDdiTable.CommandListExp.pfnImmediateAppendCommandListsExp, hCommandListImmediate, numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandListExp.pfnImmediateAppendCommandListsExp, hCommandListImmediate, numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -7212,6 +7751,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandListExp.pfnImmediateAppendCommandListsExp,
+                                                  api_id_t::zeCommandListImmediateAppendCommandListsExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -7238,6 +7778,8 @@ namespace tracing_layer
         if( nullptr == pfnGetNextCommandIdExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListGetNextCommandIdExp, context.zeDdiTable.CommandListExp.pfnGetNextCommandIdExp, hCommandList, desc, pCommandId);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandListExp.pfnGetNextCommandIdExp, hCommandList, desc, pCommandId);
 
         // capture parameters
@@ -7253,6 +7795,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandListExp.pfnGetNextCommandIdExp,
+                                                  api_id_t::zeCommandListGetNextCommandIdExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -7276,6 +7819,8 @@ namespace tracing_layer
         if( nullptr == pfnUpdateMutableCommandsExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListUpdateMutableCommandsExp, context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandsExp, hCommandList, desc);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandsExp, hCommandList, desc);
 
         // capture parameters
@@ -7290,6 +7835,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandsExp,
+                                                  api_id_t::zeCommandListUpdateMutableCommandsExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -7312,6 +7858,8 @@ namespace tracing_layer
         if( nullptr == pfnUpdateMutableCommandSignalEventExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListUpdateMutableCommandSignalEventExp, context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandSignalEventExp, hCommandList, commandId, hSignalEvent);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandSignalEventExp, hCommandList, commandId, hSignalEvent);
 
         // capture parameters
@@ -7327,6 +7875,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandSignalEventExp,
+                                                  api_id_t::zeCommandListUpdateMutableCommandSignalEventExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
@@ -7352,6 +7901,8 @@ namespace tracing_layer
         if( nullptr == pfnUpdateMutableCommandWaitEventsExp)
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        ZE_HANDLE_TRACER_SAMPLING(api_id_t::zeCommandListUpdateMutableCommandWaitEventsExp, context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandWaitEventsExp, hCommandList, commandId, numWaitEvents, phWaitEvents);
+
         ZE_HANDLE_TRACER_RECURSION(context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandWaitEventsExp, hCommandList, commandId, numWaitEvents, phWaitEvents);
 
         // capture parameters
@@ -7368,6 +7919,7 @@ namespace tracing_layer
 
 
         return tracing_layer::APITracerWrapperImp(context.zeDdiTable.CommandListExp.pfnUpdateMutableCommandWaitEventsExp,
+                                                  api_id_t::zeCommandListUpdateMutableCommandWaitEventsExp,
                                                   &tracerParams,
                                                   apiCallbackData.apiOrdinal,
                                                   apiCallbackData.prologCallbacks,
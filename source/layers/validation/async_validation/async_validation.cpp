@@ -0,0 +1,180 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include "async_validation.h"
+#include "ze_util.h"
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+
+namespace validation_layer
+{
+    namespace
+    {
+        // The queue of the calling thread; the flag is shared with the queue
+        // so it can be set after the layer released the queue.
+        struct thread_queue_t {
+            ~thread_queue_t() { retire(); }
+
+            void retire()
+            {
+                if (retired)
+                    retired->store(true, std::memory_order_release);
+            }
+
+            const void *owner = nullptr;
+            void *queue = nullptr;
+            std::shared_ptr<std::atomic<bool>> retired;
+        };
+
+        thread_local thread_queue_t currentQueue;
+
+        const char *resultName(ze_result_t result)
+        {
+            switch (result) {
+            case ZE_RESULT_ERROR_INVALID_NULL_HANDLE:
+                return "ZE_RESULT_ERROR_INVALID_NULL_HANDLE";
+            case ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE:
+                return "ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE";
+            case ZE_RESULT_ERROR_INVALID_ARGUMENT:
+                return "ZE_RESULT_ERROR_INVALID_ARGUMENT";
+            default:
+                return nullptr;
+            }
+        }
+    } // namespace
+
+    ///////////////////////////////////////////////////////////////////////////////
+    AsyncValidation::queue_t::queue_t()
+        : head(new stub_record_t), tail(head), retired(std::make_shared<std::atomic<bool>>(false))
+    {
+    }
+
+    AsyncValidation::queue_t::~queue_t()
+    {
+        while (head) {
+            auto next = head->next.load(std::memory_order_relaxed);
+            delete head;
+            head = next;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    AsyncValidation::AsyncValidation()
+    {
+        auto logFile = getenv_string("ZEL_LOADER_LOG_FILE");
+        auto logLevel = getenv_string("ZEL_LOADER_LOGGING_LEVEL");
+        logger = std::make_unique<loader::Logger>("ze_validation_layer", logFile.empty() ? LOADER_LOG_FILE_DEFAULT : logFile,
+                                                  logLevel.empty() ? "warn" : logLevel,
+                                                  getenv_tobool("ZEL_ENABLE_LOADER_LOGGING"));
+    }
+
+    AsyncValidation::~AsyncValidation()
+    {
+        stopping = true;
+        if (thread.joinable())
+            thread.join();
+        if (errors)
+            fprintf(stderr, "Async validation reported %" PRIu64 " errors in %" PRIu64 " calls\n", errors,
+                    expectedSequence);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // The validation thread is started with the first queue rather than in
+    // the constructor, which runs while the library is being loaded.
+    AsyncValidation::queue_t *AsyncValidation::threadQueue()
+    {
+        if (currentQueue.owner != this) {
+            std::lock_guard<std::mutex> lock(queuesMutex);
+            queues.emplace_back(new queue_t);
+            currentQueue.retire();
+            currentQueue.owner = this;
+            currentQueue.queue = queues.back().get();
+            currentQueue.retired = queues.back()->retired;
+            if (!thread.joinable())
+                thread = std::thread(&AsyncValidation::validationThread, this);
+        }
+        return static_cast<queue_t *>(currentQueue.queue);
+    }
+
+    void AsyncValidation::push(record_t *record, uint64_t sequence)
+    {
+        auto queue = threadQueue();
+        record->sequence = sequence;
+        queue->tail->next.store(record, std::memory_order_release);
+        queue->tail = record;
+    }
+
+    // Sequence numbers are dense, so the record to run next is always the
+    // head of one of the queues; if none holds it yet, its thread is between
+    // taking the number and queueing the record. The queues of exited
+    // threads are dropped once they are empty.
+    bool AsyncValidation::runNext()
+    {
+        std::lock_guard<std::mutex> lock(queuesMutex);
+        bool progress = false;
+        for (auto it = queues.begin(); it != queues.end();) {
+            auto &queue = *it;
+            // The flag is read first: once it is set, the thread queues
+            // nothing more.
+            bool retired = queue->retired->load(std::memory_order_acquire);
+            for (;;) {
+                auto next = queue->head->next.load(std::memory_order_acquire);
+                if (next == nullptr || next->sequence != expectedSequence)
+                    break;
+                auto result = next->run();
+                if (result != ZE_RESULT_SUCCESS)
+                    report(next, result);
+                delete queue->head;
+                queue->head = next;
+                expectedSequence++;
+                progress = true;
+            }
+            if (retired && queue->head->next.load(std::memory_order_acquire) == nullptr)
+                it = queues.erase(it);
+            else
+                ++it;
+        }
+        return progress;
+    }
+
+    void AsyncValidation::report(record_t *record, ze_result_t result)
+    {
+        errors++;
+        char message[256];
+        auto name = resultName(result);
+        if (name)
+            snprintf(message, sizeof(message), "Validation failed for %s (call %" PRIu64 "): %s", record->api,
+                     record->sequence, name);
+        else
+            snprintf(message, sizeof(message), "Validation failed for %s (call %" PRIu64 "): 0x%x", record->api,
+                     record->sequence, static_cast<unsigned>(result));
+
+        if (logger->logging_enabled)
+            logger->log_error(message);
+        else
+            fprintf(stderr, "%s\n", message);
+    }
+
+    void AsyncValidation::validationThread()
+    {
+        unsigned idle = 0;
+        for (;;) {
+            if (runNext()) {
+                idle = 0;
+                continue;
+            }
+            if (stopping && expectedSequence == nextSequence.load(std::memory_order_acquire))
+                break;
+            if (++idle < 64)
+                std::this_thread::yield();
+            else
+                std::this_thread::sleep_for(std::chrono::microseconds(idle < 1024 ? 100 : 1000));
+        }
+    }
+
+} // namespace validation_layer
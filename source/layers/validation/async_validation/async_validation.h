@@ -0,0 +1,133 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#pragma once
+
+#include "ze_api.h"
+#include "logging.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace validation_layer
+{
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Copy of a handle array passed to a call, taken so the check can run
+    // after the application reused the array. Short arrays stay inline.
+    template <typename T> class AsyncHandleArray {
+    public:
+        AsyncHandleArray(const T *handles, size_t count) : count(handles ? count : 0), isNull(handles == nullptr)
+        {
+            if (this->count > inlineCount)
+                heapHandles.assign(handles, handles + count);
+            else
+                for (size_t i = 0; i < this->count; ++i)
+                    inlineHandles[i] = handles[i];
+        }
+
+        T *data() { return isNull ? nullptr : (count > inlineCount ? heapHandles.data() : inlineHandles); }
+        size_t size() const { return count; }
+        T operator[](size_t i) const { return count > inlineCount ? heapHandles[i] : inlineHandles[i]; }
+
+    private:
+        static constexpr size_t inlineCount = 8;
+
+        size_t count;
+        bool isNull;
+        T inlineHandles[inlineCount];
+        std::vector<T> heapHandles;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Runs the handle lifetime checks on a background thread. Every call
+    // appends a record holding a copy of its arguments and the driver result
+    // to a queue owned by the calling thread; records take a global sequence
+    // number after the driver call, or before it for destroys, so creates
+    // and destroys are replayed in an order consistent with the
+    // application's own synchronization. The validation thread merges the queues in
+    // sequence order and reports failed checks through the loader log, or
+    // stderr when logging is off, with the sequence number of the call.
+    class AsyncValidation {
+    public:
+        AsyncValidation();
+        ~AsyncValidation();
+
+        template <typename T> static AsyncHandleArray<T> copy(const T *handles, size_t count)
+        {
+            return AsyncHandleArray<T>(handles, count);
+        }
+
+        // Takes a sequence number ahead of the driver call, for calls that
+        // release handles the driver may hand out again before they return.
+        uint64_t reserve() { return nextSequence.fetch_add(1, std::memory_order_relaxed); }
+
+        template <typename F> void submit(const char *api, F &&check) { submit(reserve(), api, std::forward<F>(check)); }
+
+        template <typename F> void submit(uint64_t sequence, const char *api, F &&check)
+        {
+            push(new callable_record_t<typename std::decay<F>::type>(api, std::forward<F>(check)), sequence);
+        }
+
+    private:
+        struct record_t {
+            explicit record_t(const char *api) : api(api) {}
+            virtual ~record_t() = default;
+            virtual ze_result_t run() = 0;
+
+            const char *api;
+            uint64_t sequence = 0;
+            std::atomic<record_t *> next{nullptr};
+        };
+
+        template <typename F> struct callable_record_t : record_t {
+            callable_record_t(const char *api, F &&check) : record_t(api), check(std::move(check)) {}
+            callable_record_t(const char *api, const F &check) : record_t(api), check(check) {}
+            ze_result_t run() override { return check(); }
+
+            F check;
+        };
+
+        // Single producer, single consumer list: the owning thread appends at
+        // the tail, the validation thread consumes behind a stub head. The
+        // owning thread sets the flag when it exits, and the validation
+        // thread drops the queue once it is empty.
+        struct queue_t {
+            queue_t();
+            ~queue_t();
+
+            record_t *head;
+            record_t *tail;
+            std::shared_ptr<std::atomic<bool>> retired;
+        };
+
+        struct stub_record_t : record_t {
+            stub_record_t() : record_t(nullptr) {}
+            ze_result_t run() override { return ZE_RESULT_SUCCESS; }
+        };
+
+        void push(record_t *record, uint64_t sequence);
+        queue_t *threadQueue();
+        bool runNext();
+        void report(record_t *record, ze_result_t result);
+        void validationThread();
+
+        std::atomic<uint64_t> nextSequence{0};
+        uint64_t expectedSequence = 0;
+        std::mutex queuesMutex;
+        std::vector<std::unique_ptr<queue_t>> queues;
+        std::atomic<bool> stopping{false};
+        uint64_t errors = 0;
+        std::unique_ptr<loader::Logger> logger;
+        std::thread thread;
+    };
+
+} // namespace validation_layer
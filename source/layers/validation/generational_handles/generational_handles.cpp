@@ -0,0 +1,101 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include "generational_handles.h"
+#include <cinttypes>
+#include <cstdio>
+
+namespace validation_layer
+{
+
+    ///////////////////////////////////////////////////////////////////////////////
+    GenerationalHandleTable::GenerationalHandleTable() : pages(new std::atomic<slot_t *>[pageCount])
+    {
+        for (size_t i = 0; i < pageCount; ++i)
+            pages[i].store(nullptr, std::memory_order_relaxed);
+    }
+
+    GenerationalHandleTable::~GenerationalHandleTable()
+    {
+        if (staleHandles || invalidHandles)
+            fprintf(stderr, "Generational handles rejected %" PRIu64 " stale and %" PRIu64 " unknown handles\n",
+                    staleHandles.load(), invalidHandles.load());
+        for (size_t i = 0; i < pageCount; ++i)
+            delete[] pages[i].load(std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Pages are only ever added, so a reader that sees a page pointer can
+    // use it without a lock. The slot's id is stored after its handle with
+    // release ordering, so a matching id always sees the handle it names.
+    void *GenerationalHandleTable::lookup(uint64_t id, uint8_t type)
+    {
+        auto index = static_cast<uint32_t>(id >> indexShift) & indexMask;
+        auto page = pages[index >> pageBits].load(std::memory_order_acquire);
+        if ((id & tagBit) == 0 || ((id >> typeShift) & 0x7f) != type || page == nullptr) {
+            invalidHandles++;
+            return nullptr;
+        }
+
+        auto &slot = page[index & (pageSize - 1)];
+        if (slot.id.load(std::memory_order_acquire) != id) {
+            staleHandles++;
+            return nullptr;
+        }
+        return slot.handle.load(std::memory_order_relaxed);
+    }
+
+    uint64_t GenerationalHandleTable::allocate(void *handle, uint8_t type)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto &live = liveIds[type];
+        auto it = live.find(handle);
+        if (it != live.end())
+            return it->second;
+
+        uint32_t index;
+        if (!freeSlots.empty()) {
+            index = freeSlots.back();
+            freeSlots.pop_back();
+        } else {
+            // Out of ids: hand back the driver handle, which later fails to
+            // translate rather than aliasing a live slot.
+            if (slotCount > indexMask)
+                return reinterpret_cast<uintptr_t>(handle);
+            index = slotCount++;
+            auto &page = pages[index >> pageBits];
+            if (page.load(std::memory_order_relaxed) == nullptr)
+                page.store(new slot_t[pageSize], std::memory_order_release);
+        }
+
+        auto &slot = pages[index >> pageBits].load(std::memory_order_relaxed)[index & (pageSize - 1)];
+        uint64_t id = (static_cast<uint64_t>(slot.generation) << generationShift) |
+                      (static_cast<uint64_t>(index) << indexShift) | (static_cast<uint64_t>(type) << typeShift) | tagBit;
+        slot.handle.store(handle, std::memory_order_relaxed);
+        slot.id.store(id, std::memory_order_release);
+        live.emplace(handle, id);
+        return id;
+    }
+
+    void GenerationalHandleTable::releaseId(uint64_t id, uint8_t type)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto index = static_cast<uint32_t>(id >> indexShift) & indexMask;
+        auto page = pages[index >> pageBits].load(std::memory_order_relaxed);
+        if ((id & tagBit) == 0 || page == nullptr)
+            return;
+
+        auto &slot = page[index & (pageSize - 1)];
+        if (slot.id.load(std::memory_order_relaxed) != id)
+            return;
+        liveIds[type].erase(slot.handle.load(std::memory_order_relaxed));
+        slot.id.store(0, std::memory_order_release);
+        slot.generation++;
+        freeSlots.push_back(index);
+    }
+
+} // namespace validation_layer
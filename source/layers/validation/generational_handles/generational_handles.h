@@ -0,0 +1,140 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#pragma once
+
+#include "ze_api.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace validation_layer
+{
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Types whose handles are replaced by generational ids. Devices, drivers
+    // and contexts are shared with sysman and tools, and images and samplers
+    // are passed by value through kernel arguments, so they stay raw.
+    template <typename T> struct generational_handle_type { static constexpr uint8_t value = 0; };
+    template <> struct generational_handle_type<ze_command_queue_handle_t> { static constexpr uint8_t value = 1; };
+    template <> struct generational_handle_type<ze_command_list_handle_t> { static constexpr uint8_t value = 2; };
+    template <> struct generational_handle_type<ze_fence_handle_t> { static constexpr uint8_t value = 3; };
+    template <> struct generational_handle_type<ze_event_pool_handle_t> { static constexpr uint8_t value = 4; };
+    template <> struct generational_handle_type<ze_event_handle_t> { static constexpr uint8_t value = 5; };
+    template <> struct generational_handle_type<ze_module_handle_t> { static constexpr uint8_t value = 6; };
+    template <> struct generational_handle_type<ze_kernel_handle_t> { static constexpr uint8_t value = 7; };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Hands the application ids into a slot table instead of driver handles.
+    // An id packs a tag bit, the handle type, the slot index and the slot's
+    // generation; the generation is bumped whenever the slot is released, so
+    // an id kept past its destroy call no longer matches even if the driver
+    // hands out the same address again. Translating an id is a page lookup
+    // and a single atomic compare, without taking a lock.
+    class GenerationalHandleTable {
+    public:
+        GenerationalHandleTable();
+        ~GenerationalHandleTable();
+
+        // Ids need 64-bit handles; on 32-bit builds the mode stays disabled.
+        static constexpr bool isSupported() { return sizeof(uintptr_t) == sizeof(uint64_t); }
+
+        // Replaces an id with the driver handle. Null passes through; any
+        // other value that is not a live id of the right type fails.
+        template <typename T> bool translate(T &handle)
+        {
+            if (handle == nullptr)
+                return true;
+            auto raw = lookup(reinterpret_cast<uintptr_t>(handle), generational_handle_type<T>::value);
+            handle = reinterpret_cast<T>(raw);
+            return raw != nullptr;
+        }
+
+        // Returns the id for a driver handle, reusing the live id when the
+        // driver returns a handle the application already holds.
+        template <typename T> T wrap(T handle)
+        {
+            if (handle == nullptr)
+                return nullptr;
+            return reinterpret_cast<T>(static_cast<uintptr_t>(allocate(handle, generational_handle_type<T>::value)));
+        }
+
+        template <typename T> void release(T handle)
+        {
+            if (handle != nullptr)
+                releaseId(reinterpret_cast<uintptr_t>(handle), generational_handle_type<T>::value);
+        }
+
+    private:
+        static constexpr uint64_t tagBit = 1;
+        static constexpr unsigned typeShift = 1;
+        static constexpr unsigned indexShift = 8;
+        static constexpr unsigned generationShift = 32;
+        static constexpr uint32_t indexMask = (1u << (generationShift - indexShift)) - 1;
+        static constexpr unsigned pageBits = 12;
+        static constexpr size_t pageSize = size_t(1) << pageBits;
+        static constexpr size_t pageCount = (size_t(indexMask) + 1) >> pageBits;
+        static constexpr size_t typeCount = 8;
+
+        struct slot_t {
+            std::atomic<uint64_t> id{0}; // current id while live, zero when free
+            std::atomic<void *> handle{nullptr};
+            uint32_t generation = 1;
+        };
+
+        void *lookup(uint64_t id, uint8_t type);
+        uint64_t allocate(void *handle, uint8_t type);
+        void releaseId(uint64_t id, uint8_t type);
+
+        std::unique_ptr<std::atomic<slot_t *>[]> pages;
+        std::mutex mutex;
+        uint32_t slotCount = 0;
+        std::vector<uint32_t> freeSlots;
+        std::unordered_map<const void *, uint64_t> liveIds[typeCount];
+        std::atomic<uint64_t> staleHandles{0};
+        std::atomic<uint64_t> invalidHandles{0};
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Translated copy of an input handle array. Short arrays, like the wait
+    // lists of most appends, stay on the stack.
+    template <typename T> class GenerationalHandleArray {
+    public:
+        explicit GenerationalHandleArray(T *handles) : handles(handles) {}
+
+        bool translate(GenerationalHandleTable &table, uint32_t count)
+        {
+            if (handles == nullptr || count == 0)
+                return true;
+            T *local = inlineHandles;
+            if (count > inlineCount) {
+                heapHandles.resize(count);
+                local = heapHandles.data();
+            }
+            for (uint32_t i = 0; i < count; ++i) {
+                local[i] = handles[i];
+                if (!table.translate(local[i]))
+                    return false;
+            }
+            handles = local;
+            return true;
+        }
+
+        T *data() const { return handles; }
+
+    private:
+        static constexpr uint32_t inlineCount = 16;
+
+        T *handles;
+        T inlineHandles[inlineCount];
+        std::vector<T> heapHandles;
+    };
+
+} // namespace validation_layer
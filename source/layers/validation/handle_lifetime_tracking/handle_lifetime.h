@@ -10,16 +10,71 @@
 #include "ze_handle_lifetime.h"
 #include "zes_handle_lifetime.h"
 #include "zet_handle_lifetime.h"
-#include <memory>
-#include <type_traits>
+#include "handle_table.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace validation_layer {
 
-typedef struct _zel_handle_state_t {
-  bool is_open;
-} zel_handle_state_t;
+// Maps a handle type to its tag in the handle table. Handle types without a
+// tag are tracked as zel_handle_type_t::unknown.
+template <class T> struct zel_handle_type {
+  static constexpr zel_handle_type_t value = zel_handle_type_t::unknown;
+};
+
+#define ZEL_HANDLE_TYPE(T, tag)                                                \
+  template <> struct zel_handle_type<T> {                                      \
+    static constexpr zel_handle_type_t value = zel_handle_type_t::tag;         \
+  }
+
+ZEL_HANDLE_TYPE(ze_driver_handle_t, driver);
+ZEL_HANDLE_TYPE(ze_device_handle_t, device);
+ZEL_HANDLE_TYPE(ze_context_handle_t, context);
+ZEL_HANDLE_TYPE(ze_command_queue_handle_t, command_queue);
+ZEL_HANDLE_TYPE(ze_command_list_handle_t, command_list);
+ZEL_HANDLE_TYPE(ze_fence_handle_t, fence);
+ZEL_HANDLE_TYPE(ze_event_pool_handle_t, event_pool);
+ZEL_HANDLE_TYPE(ze_event_handle_t, event);
+ZEL_HANDLE_TYPE(ze_image_handle_t, image);
+ZEL_HANDLE_TYPE(ze_module_handle_t, module);
+ZEL_HANDLE_TYPE(ze_module_build_log_handle_t, module_build_log);
+ZEL_HANDLE_TYPE(ze_kernel_handle_t, kernel);
+ZEL_HANDLE_TYPE(ze_sampler_handle_t, sampler);
+ZEL_HANDLE_TYPE(ze_physical_mem_handle_t, physical_mem);
+ZEL_HANDLE_TYPE(ze_fabric_vertex_handle_t, fabric_vertex);
+ZEL_HANDLE_TYPE(ze_fabric_edge_handle_t, fabric_edge);
+ZEL_HANDLE_TYPE(zet_metric_group_handle_t, metric_group);
+ZEL_HANDLE_TYPE(zet_metric_handle_t, metric);
+ZEL_HANDLE_TYPE(zet_metric_streamer_handle_t, metric_streamer);
+ZEL_HANDLE_TYPE(zet_metric_query_pool_handle_t, metric_query_pool);
+ZEL_HANDLE_TYPE(zet_metric_query_handle_t, metric_query);
+ZEL_HANDLE_TYPE(zet_tracer_exp_handle_t, tracer_exp);
+ZEL_HANDLE_TYPE(zet_debug_session_handle_t, debug_session);
+ZEL_HANDLE_TYPE(zes_sched_handle_t, sched);
+ZEL_HANDLE_TYPE(zes_perf_handle_t, perf);
+ZEL_HANDLE_TYPE(zes_pwr_handle_t, pwr);
+ZEL_HANDLE_TYPE(zes_freq_handle_t, freq);
+ZEL_HANDLE_TYPE(zes_engine_handle_t, engine);
+ZEL_HANDLE_TYPE(zes_standby_handle_t, standby);
+ZEL_HANDLE_TYPE(zes_firmware_handle_t, firmware);
+ZEL_HANDLE_TYPE(zes_mem_handle_t, mem);
+ZEL_HANDLE_TYPE(zes_fabric_port_handle_t, fabric_port);
+ZEL_HANDLE_TYPE(zes_temp_handle_t, temp);
+ZEL_HANDLE_TYPE(zes_psu_handle_t, psu);
+ZEL_HANDLE_TYPE(zes_fan_handle_t, fan);
+ZEL_HANDLE_TYPE(zes_led_handle_t, led);
+ZEL_HANDLE_TYPE(zes_ras_handle_t, ras);
+ZEL_HANDLE_TYPE(zes_diag_handle_t, diag);
+ZEL_HANDLE_TYPE(zes_overclock_handle_t, overclock);
+ZEL_HANDLE_TYPE(ze_rtas_parallel_operation_exp_handle_t, rtas_parallel_operation);
+ZEL_HANDLE_TYPE(ze_rtas_builder_exp_handle_t, rtas_builder);
+
+#undef ZEL_HANDLE_TYPE
 
 class HandleLifetimeValidation {
 public:
@@ -27,483 +82,115 @@ public:
   ZESHandleLifetimeValidation zesHandleLifetime;
   ZETHandleLifetimeValidation zetHandleLifetime;
 
-  // default methods
   template <class T> void addHandle(T handle) {
-    // TODO : Log warning
-    untrackedHandles++;
-    defaultHandleStateMap.insert({static_cast<void *>(handle), nullptr});
+    auto type = zel_handle_type<T>::value;
+    if (type == zel_handle_type_t::unknown) {
+      // TODO : Log warning
+      untrackedHandles++;
+    }
+    handles.insert(handle, type);
+  }
+  void addHandle(ze_command_list_handle_t handle, bool is_open = true) {
+    handles.insert(handle, zel_handle_type_t::command_list,
+                   is_open ? ZEL_HANDLE_FLAG_OPEN : 0);
   }
 
   template <class T> void removeHandle(T handle) {
-    // TODO: Log warning
-    untrackedHandles--;
-    defaultHandleStateMap.erase(static_cast<void *>(handle));
+    auto type = zel_handle_type<T>::value;
+    if (type == zel_handle_type_t::unknown) {
+      // TODO: Log warning
+      untrackedHandles--;
+    }
+    if (adoptUntracked) {
+      handles.insert(handle, type, ZEL_HANDLE_FLAG_RELEASED);
+    } else {
+      handles.erase(handle, type);
+    }
   }
 
   template <class T> bool isHandleValid(T handle) {
-    return defaultHandleStateMap.find(static_cast<void *>(handle)) !=
-           defaultHandleStateMap.end();
-  }
-
-  template <class S, class T> S get_handle_map(T handle) {
-    if (std::is_same<T, ze_context_handle_t>::value) {
-      return contextHandleStateMap;
-    } else if (std::is_same<T, ze_driver_handle_t>::value) {
-      return driverHandleStateMap;
-    } else {
-      return defaultHandleStateMap;
+    auto type = zel_handle_type<T>::value;
+    if (!adoptUntracked) {
+      return handles.contains(handle, type);
+    }
+    uint8_t flags = 0;
+    if (handles.getFlags(handle, type, flags)) {
+      return (flags & ZEL_HANDLE_FLAG_RELEASED) == 0;
     }
+    if (handle == nullptr) {
+      return false;
+    }
+    // Created before tracking started; its state is unknown, so a command
+    // list is taken to be open.
+    handles.insert(handle, type,
+                   type == zel_handle_type_t::command_list
+                       ? ZEL_HANDLE_FLAG_OPEN
+                       : 0);
+    return true;
   }
 
-  void addHandle(ze_context_handle_t handle) {
-    contextHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_driver_handle_t handle) {
-    driverHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_device_handle_t handle) {
-    deviceHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_command_queue_handle_t handle) {
-    commandQueueHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_command_list_handle_t handle, bool is_open = true) {
-    commandListHandleStateMap.insert(
-        {handle, std::make_unique<zel_handle_state_t>()});
-    commandListHandleStateMap[handle]->is_open = is_open;
-  }
-  void addHandle(ze_fence_handle_t handle) {
-    fenceHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_event_pool_handle_t handle) {
-    eventPoolHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_event_handle_t handle) {
-    eventHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_image_handle_t handle) {
-    imageHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_module_handle_t handle) {
-    moduleHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_module_build_log_handle_t handle) {
-    moduleBuildLogHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_kernel_handle_t handle) {
-    kernelHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_sampler_handle_t handle) {
-    samplerHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_fabric_vertex_handle_t handle) {
-    fabricVertexHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_fabric_edge_handle_t handle) {
-    fabricEdgeHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_physical_mem_handle_t handle) {
-    physicalMemHandleStateMap.insert({handle, nullptr});
-  }
+  // Used when tracking starts after handles were created: unknown handles
+  // are added on first use, and destroyed handles stay in the table as
+  // released so that using them again is still reported.
+  void adoptUntrackedHandles() { adoptUntracked = true; }
+
+  // IPC and external memory handles are structures, tracked by address.
   void addHandle(ze_ipc_event_pool_handle_t handle) {
-    ipcEventPoolHandleStateMap.insert({&handle, nullptr});
+    handles.insert(&handle, zel_handle_type_t::ipc_event_pool);
   }
   void addHandle(ze_ipc_mem_handle_t handle) {
-    ipcMemHandleStateMap.insert({&handle, nullptr});
+    handles.insert(&handle, zel_handle_type_t::ipc_mem);
   }
   void addHandle(ze_external_memory_import_win32_handle_t &handle) {
-    externalMemoryImportWin32HandleStateMap.insert({&handle, nullptr});
+    handles.insert(&handle, zel_handle_type_t::external_memory_import_win32);
   }
   void addHandle(ze_external_memory_export_win32_handle_t &handle) {
-    externalMemoryExportWin32HandleStateMap.insert({&handle, nullptr});
-  }
-
-  void addHandle(zet_metric_group_handle_t handle) {
-    metricGroupHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zet_metric_handle_t handle) {
-    metricHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zet_metric_streamer_handle_t handle) {
-    metricStreamerHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zet_metric_query_pool_handle_t handle) {
-    metricQueryPoolHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zet_metric_query_handle_t handle) {
-    metricQueryHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zet_tracer_exp_handle_t handle) {
-    tracerExpHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zet_debug_session_handle_t handle) {
-    debugSessionHandleStateMap.insert({handle, nullptr});
-  }
-
-  void addHandle(zes_sched_handle_t handle) {
-    schedHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_perf_handle_t handle) {
-    perfHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_pwr_handle_t handle) {
-    pwrHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_freq_handle_t handle) {
-    freqHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_engine_handle_t handle) {
-    engineHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_standby_handle_t handle) {
-    standbyHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_firmware_handle_t handle) {
-    firmwareHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_mem_handle_t handle) {
-    memHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_fabric_port_handle_t handle) {
-    fabricPortHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_temp_handle_t handle) {
-    tempHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_psu_handle_t handle) {
-    psuHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_fan_handle_t handle) {
-    fanHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_led_handle_t handle) {
-    ledHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_ras_handle_t handle) {
-    rasHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_diag_handle_t handle) {
-    diagHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(zes_overclock_handle_t handle) {
-    overclockHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_rtas_parallel_operation_exp_handle_t handle) {
-    rtasParallelOperationHandleStateMap.insert({handle, nullptr});
-  }
-  void addHandle(ze_rtas_builder_exp_handle_t handle) {
-    rtasBuilderHandleStateMap.insert({handle, nullptr});
+    handles.insert(&handle, zel_handle_type_t::external_memory_export_win32);
   }
 
-  void removeHandle(ze_context_handle_t handle) {
-    contextHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_driver_handle_t handle) {
-    driverHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_device_handle_t handle) {
-    deviceHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_command_queue_handle_t handle) {
-    commandQueueHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_command_list_handle_t handle) {
-    commandListHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_fence_handle_t handle) {
-    fenceHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_event_pool_handle_t handle) {
-    eventPoolHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_event_handle_t handle) {
-    eventHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_image_handle_t handle) {
-    imageHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_module_handle_t handle) {
-    moduleHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_module_build_log_handle_t handle) {
-    moduleBuildLogHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_kernel_handle_t handle) {
-    kernelHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_sampler_handle_t handle) {
-    samplerHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_physical_mem_handle_t handle) {
-    physicalMemHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_fabric_vertex_handle_t handle) {
-    fabricVertexHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_fabric_edge_handle_t handle) {
-    fabricEdgeHandleStateMap.erase(handle);
-  }
   void removeHandle(ze_ipc_mem_handle_t &handle) {
-    ipcMemHandleStateMap.erase(&handle);
+    handles.erase(&handle, zel_handle_type_t::ipc_mem);
   }
   void removeHandle(ze_ipc_event_pool_handle_t &handle) {
-    ipcEventPoolHandleStateMap.erase(&handle);
+    handles.erase(&handle, zel_handle_type_t::ipc_event_pool);
   }
   void removeHandle(ze_external_memory_export_win32_handle_t &handle) {
-    externalMemoryExportWin32HandleStateMap.erase(&handle);
+    handles.erase(&handle, zel_handle_type_t::external_memory_export_win32);
   }
   void removeHandle(ze_external_memory_import_win32_handle_t &handle) {
-    externalMemoryImportWin32HandleStateMap.erase(&handle);
-  }
-
-  void removeHandle(zet_metric_group_handle_t handle) {
-    metricGroupHandleStateMap.erase(handle);
-  }
-  void removeHandle(zet_metric_handle_t handle) {
-    metricHandleStateMap.erase(handle);
-  }
-  void removeHandle(zet_metric_streamer_handle_t handle) {
-    metricStreamerHandleStateMap.erase(handle);
-  }
-  void removeHandle(zet_metric_query_pool_handle_t handle) {
-    metricQueryPoolHandleStateMap.erase(handle);
-  }
-  void removeHandle(zet_metric_query_handle_t handle) {
-    metricQueryHandleStateMap.erase(handle);
-  }
-  void removeHandle(zet_tracer_exp_handle_t handle) {
-    tracerExpHandleStateMap.erase(handle);
-  }
-  void removeHandle(zet_debug_session_handle_t handle) {
-    debugSessionHandleStateMap.erase(handle);
+    handles.erase(&handle, zel_handle_type_t::external_memory_import_win32);
   }
 
-  void removeHandle(zes_sched_handle_t handle) {
-    schedHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_perf_handle_t handle) {
-    perfHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_pwr_handle_t handle) {
-    pwrHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_freq_handle_t handle) {
-    freqHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_engine_handle_t handle) {
-    engineHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_standby_handle_t handle) {
-    standbyHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_firmware_handle_t handle) {
-    firmwareHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_mem_handle_t handle) {
-    memHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_fabric_port_handle_t handle) {
-    fabricPortHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_temp_handle_t handle) {
-    tempHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_psu_handle_t handle) {
-    psuHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_fan_handle_t handle) {
-    fanHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_led_handle_t handle) {
-    ledHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_ras_handle_t handle) {
-    rasHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_diag_handle_t handle) {
-    diagHandleStateMap.erase(handle);
-  }
-  void removeHandle(zes_overclock_handle_t handle) {
-    overclockHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_rtas_parallel_operation_exp_handle_t handle) {
-    rtasParallelOperationHandleStateMap.erase(handle);
-  }
-  void removeHandle(ze_rtas_builder_exp_handle_t handle) {
-    rtasBuilderHandleStateMap.erase(handle);
-  }
-
-  bool isHandleValid(ze_context_handle_t handle) {
-    return contextHandleStateMap.find(handle) != contextHandleStateMap.end();
-  }
-  bool isHandleValid(ze_driver_handle_t handle) {
-    return driverHandleStateMap.find(handle) != driverHandleStateMap.end();
-  }
-  bool isHandleValid(ze_device_handle_t handle) {
-    return deviceHandleStateMap.find(handle) != deviceHandleStateMap.end();
-  }
-  bool isHandleValid(ze_command_queue_handle_t handle) {
-    return commandQueueHandleStateMap.find(handle) !=
-           commandQueueHandleStateMap.end();
-  }
-  bool isHandleValid(ze_command_list_handle_t handle) {
-    return commandListHandleStateMap.find(handle) !=
-           commandListHandleStateMap.end();
-  }
-  bool isHandleValid(ze_fence_handle_t handle) {
-    return fenceHandleStateMap.find(handle) != fenceHandleStateMap.end();
-  }
-  bool isHandleValid(ze_event_pool_handle_t handle) {
-    return eventPoolHandleStateMap.find(handle) !=
-           eventPoolHandleStateMap.end();
-  }
-  bool isHandleValid(ze_event_handle_t handle) {
-    return eventHandleStateMap.find(handle) != eventHandleStateMap.end();
-  }
-  bool isHandleValid(ze_image_handle_t handle) {
-    return imageHandleStateMap.find(handle) != imageHandleStateMap.end();
-  }
-  bool isHandleValid(ze_module_handle_t handle) {
-    return moduleHandleStateMap.find(handle) != moduleHandleStateMap.end();
-  }
-  bool isHandleValid(ze_module_build_log_handle_t handle) {
-    return moduleBuildLogHandleStateMap.find(handle) !=
-           moduleBuildLogHandleStateMap.end();
-  }
-  bool isHandleValid(ze_kernel_handle_t handle) {
-    return kernelHandleStateMap.find(handle) != kernelHandleStateMap.end();
-  }
-  bool isHandleValid(ze_sampler_handle_t handle) {
-    return samplerHandleStateMap.find(handle) != samplerHandleStateMap.end();
-  }
-  bool isHandleValid(ze_physical_mem_handle_t handle) {
-    return physicalMemHandleStateMap.find(handle) !=
-           physicalMemHandleStateMap.end();
-  }
-  bool isHandleValid(ze_fabric_vertex_handle_t handle) {
-    return fabricVertexHandleStateMap.find(handle) !=
-           fabricVertexHandleStateMap.end();
-  }
-  bool isHandleValid(ze_fabric_edge_handle_t handle) {
-    return fabricEdgeHandleStateMap.find(handle) !=
-           fabricEdgeHandleStateMap.end();
-  }
   bool isHandleValid(ze_ipc_mem_handle_t &handle) {
-    return ipcMemHandleStateMap.find(&handle) != ipcMemHandleStateMap.end();
+    return handles.contains(&handle, zel_handle_type_t::ipc_mem);
   }
   bool isHandleValid(ze_ipc_event_pool_handle_t &handle) {
-    return ipcEventPoolHandleStateMap.find(&handle) !=
-           ipcEventPoolHandleStateMap.end();
+    return handles.contains(&handle, zel_handle_type_t::ipc_event_pool);
   }
   bool isHandleValid(ze_external_memory_import_win32_handle_t &handle) {
-    return externalMemoryImportWin32HandleStateMap.find(&handle) !=
-           externalMemoryImportWin32HandleStateMap.end();
+    return handles.contains(&handle,
+                            zel_handle_type_t::external_memory_import_win32);
   }
   bool isHandleValid(ze_external_memory_export_win32_handle_t &handle) {
-    return externalMemoryExportWin32HandleStateMap.find(&handle) !=
-           externalMemoryExportWin32HandleStateMap.end();
-  }
-
-  bool isHandleValid(zet_metric_group_handle_t handle) {
-    return metricGroupHandleStateMap.find(handle) !=
-           metricGroupHandleStateMap.end();
-  }
-  bool isHandleValid(zet_metric_handle_t handle) {
-    return metricHandleStateMap.find(handle) != metricHandleStateMap.end();
-  }
-  bool isHandleValid(zet_metric_streamer_handle_t handle) {
-    return metricStreamerHandleStateMap.find(handle) !=
-           metricStreamerHandleStateMap.end();
-  }
-  bool isHandleValid(zet_metric_query_pool_handle_t handle) {
-    return metricQueryPoolHandleStateMap.find(handle) !=
-           metricQueryPoolHandleStateMap.end();
-  }
-  bool isHandleValid(zet_metric_query_handle_t handle) {
-    return metricQueryHandleStateMap.find(handle) !=
-           metricQueryHandleStateMap.end();
-  }
-  bool isHandleValid(zet_tracer_exp_handle_t handle) {
-    return tracerExpHandleStateMap.find(handle) !=
-           tracerExpHandleStateMap.end();
-  }
-  bool isHandleValid(zet_debug_session_handle_t handle) {
-    return debugSessionHandleStateMap.find(handle) !=
-           debugSessionHandleStateMap.end();
-  }
-
-  bool isHandleValid(zes_sched_handle_t handle) {
-    return schedHandleStateMap.find(handle) != schedHandleStateMap.end();
-  }
-  bool isHandleValid(zes_perf_handle_t handle) {
-    return perfHandleStateMap.find(handle) != perfHandleStateMap.end();
-  }
-  bool isHandleValid(zes_pwr_handle_t handle) {
-    return pwrHandleStateMap.find(handle) != pwrHandleStateMap.end();
-  }
-  bool isHandleValid(zes_freq_handle_t handle) {
-    return freqHandleStateMap.find(handle) != freqHandleStateMap.end();
-  }
-  bool isHandleValid(zes_engine_handle_t handle) {
-    return engineHandleStateMap.find(handle) != engineHandleStateMap.end();
-  }
-  bool isHandleValid(zes_standby_handle_t handle) {
-    return standbyHandleStateMap.find(handle) != standbyHandleStateMap.end();
-  }
-  bool isHandleValid(zes_firmware_handle_t handle) {
-    return firmwareHandleStateMap.find(handle) != firmwareHandleStateMap.end();
-  }
-  bool isHandleValid(zes_mem_handle_t handle) {
-    return memHandleStateMap.find(handle) != memHandleStateMap.end();
-  }
-  bool isHandleValid(zes_fabric_port_handle_t handle) {
-    return fabricPortHandleStateMap.find(handle) !=
-           fabricPortHandleStateMap.end();
-  }
-  bool isHandleValid(zes_temp_handle_t handle) {
-    return tempHandleStateMap.find(handle) != tempHandleStateMap.end();
-  }
-  bool isHandleValid(zes_psu_handle_t handle) {
-    return psuHandleStateMap.find(handle) != psuHandleStateMap.end();
-  }
-  bool isHandleValid(zes_fan_handle_t handle) {
-    return fanHandleStateMap.find(handle) != fanHandleStateMap.end();
-  }
-  bool isHandleValid(zes_led_handle_t handle) {
-    return ledHandleStateMap.find(handle) != ledHandleStateMap.end();
-  }
-  bool isHandleValid(zes_ras_handle_t handle) {
-    return rasHandleStateMap.find(handle) != rasHandleStateMap.end();
-  }
-  bool isHandleValid(zes_diag_handle_t handle) {
-    return diagHandleStateMap.find(handle) != diagHandleStateMap.end();
-  }
-  bool isHandleValid(zes_overclock_handle_t handle) {
-    return overclockHandleStateMap.find(handle) !=
-           overclockHandleStateMap.end();
-  }
-
-  bool isHandleValid(ze_rtas_parallel_operation_exp_handle_t handle) {
-    return rtasParallelOperationHandleStateMap.find(handle) !=
-           rtasParallelOperationHandleStateMap.end();
-  }
-
-  bool isHandleValid(ze_rtas_builder_exp_handle_t handle) {
-    return rtasBuilderHandleStateMap.find(handle) !=
-           rtasBuilderHandleStateMap.end();
+    return handles.contains(&handle,
+                            zel_handle_type_t::external_memory_export_win32);
   }
 
   bool isOpen(ze_command_list_handle_t handle) {
-    return commandListHandleStateMap[handle]->is_open;
+    uint8_t flags = 0;
+    handles.getFlags(handle, zel_handle_type_t::command_list, flags);
+    return (flags & ZEL_HANDLE_FLAG_OPEN) != 0;
   }
   void close(ze_command_list_handle_t handle) {
-    commandListHandleStateMap[handle]->is_open = false;
+    handles.setFlags(handle, zel_handle_type_t::command_list, 0);
   }
   void reset(ze_command_list_handle_t handle) {
-    commandListHandleStateMap[handle]->is_open = true;
+    handles.setFlags(handle, zel_handle_type_t::command_list,
+                     ZEL_HANDLE_FLAG_OPEN);
   }
 
   void printDependentMap() {
+    std::lock_guard<std::mutex> lock(dependentMutex);
 
     printf("\n--------------------------------------------\n");
     for (auto &handle : dependentMap) {
@@ -519,177 +206,77 @@ public:
 
   void addDependent(const void *handle, const void *dependent) {
     // No need to track driver dependents
-    for (auto &driverHandle : driverHandleStateMap){
-      if (handle == (void*)driverHandle.first){
-        return;
-      }
+    if (handles.contains(handle, zel_handle_type_t::driver)) {
+      return;
     }
 
-    if (dependentMap.count(handle) == 0) {
-      dependentMap[handle] = std::unordered_set<const void *>();
+    std::lock_guard<std::mutex> lock(dependentMutex);
+    if (!dependentMap[handle].insert(dependent).second) {
+      return;
     }
-    dependentMap[handle].insert(dependent);
+    parentMap[dependent].push_back(handle);
   }
 
+  // Called when dependent is destroyed: detaches it from the handles it
+  // depends on through the reverse index, without visiting other entries.
   void removeDependent(const void *dependent) {
-    for (auto &handle : dependentMap) {
-      handle.second.erase(dependent);
+    std::lock_guard<std::mutex> lock(dependentMutex);
+    auto it = parentMap.find(dependent);
+    if (it != parentMap.end()) {
+      for (auto handle : it->second) {
+        eraseDependent(handle, dependent);
+      }
+      parentMap.erase(it);
     }
+    dependentMap.erase(dependent);
   }
 
   void removeDependent(const void *handle, const void *dependent) {
-    if (dependentMap.count(handle) == 0) {
+    std::lock_guard<std::mutex> lock(dependentMutex);
+    if (!eraseDependent(handle, dependent)) {
+      return;
+    }
+    auto it = parentMap.find(dependent);
+    if (it == parentMap.end()) {
       return;
     }
-    dependentMap[handle].erase(dependent);
+    auto &parents = it->second;
+    parents.erase(std::find(parents.begin(), parents.end(), handle));
+    if (parents.empty()) {
+      parentMap.erase(it);
+    }
   }
 
   bool hasDependents(const void *handle) {
-    return dependentMap.count(handle) && !dependentMap[handle].empty();
+    std::lock_guard<std::mutex> lock(dependentMutex);
+    return dependentMap.find(handle) != dependentMap.end();
   }
 
 private:
-  std::unordered_map<void *, std::unique_ptr<zel_handle_state_t>>
-      defaultHandleStateMap;
-  std::unordered_map<ze_context_handle_t, std::unique_ptr<zel_handle_state_t>>
-      contextHandleStateMap;
-  std::unordered_map<ze_driver_handle_t, std::unique_ptr<zel_handle_state_t>>
-      driverHandleStateMap;
-  std::unordered_map<ze_device_handle_t, std::unique_ptr<zel_handle_state_t>>
-      deviceHandleStateMap;
-  std::unordered_map<ze_command_queue_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      commandQueueHandleStateMap;
-  std::unordered_map<ze_command_list_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      commandListHandleStateMap;
-  std::unordered_map<ze_fence_handle_t, std::unique_ptr<zel_handle_state_t>>
-      fenceHandleStateMap;
-  std::unordered_map<ze_event_pool_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      eventPoolHandleStateMap;
-  std::unordered_map<ze_event_handle_t, std::unique_ptr<zel_handle_state_t>>
-      eventHandleStateMap;
-  std::unordered_map<ze_image_handle_t, std::unique_ptr<zel_handle_state_t>>
-      imageHandleStateMap;
-  std::unordered_map<ze_module_handle_t, std::unique_ptr<zel_handle_state_t>>
-      moduleHandleStateMap;
-  std::unordered_map<ze_module_build_log_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      moduleBuildLogHandleStateMap;
-  std::unordered_map<ze_kernel_handle_t, std::unique_ptr<zel_handle_state_t>>
-      kernelHandleStateMap;
-  std::unordered_map<ze_sampler_handle_t, std::unique_ptr<zel_handle_state_t>>
-      samplerHandleStateMap;
-  std::unordered_map<ze_physical_mem_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      physicalMemHandleStateMap;
-
-  std::unordered_map<ze_fabric_vertex_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      fabricVertexHandleStateMap;
-  std::unordered_map<ze_fabric_edge_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      fabricEdgeHandleStateMap;
-
-  std::unordered_map<ze_ipc_event_pool_handle_t *,
-                     std::unique_ptr<zel_handle_state_t>>
-      ipcEventPoolHandleStateMap;
-  std::unordered_map<ze_ipc_mem_handle_t *, std::unique_ptr<zel_handle_state_t>>
-      ipcMemHandleStateMap;
-
-  std::unordered_map<ze_external_memory_import_win32_handle_t *,
-                     std::unique_ptr<zel_handle_state_t>>
-      externalMemoryImportWin32HandleStateMap;
-  std::unordered_map<ze_external_memory_export_win32_handle_t *,
-                     std::unique_ptr<zel_handle_state_t>>
-      externalMemoryExportWin32HandleStateMap;
-
-  // tools
-  std::unordered_map<zet_driver_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zetDriverHandleStateMap;
-  std::unordered_map<zet_device_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zetDeviceHandleStateMap;
-  std::unordered_map<zet_context_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zetContextHandleStateMap;
-  std::unordered_map<zet_command_list_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      zetCommandListHandleStateMap;
-  std::unordered_map<zet_module_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zetModuleHandleStateMap;
-  std::unordered_map<zet_kernel_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zetKernelHandleStateMap;
-  std::unordered_map<zet_metric_group_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      metricGroupHandleStateMap;
-  std::unordered_map<zet_metric_handle_t, std::unique_ptr<zel_handle_state_t>>
-      metricHandleStateMap;
-  std::unordered_map<zet_metric_streamer_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      metricStreamerHandleStateMap;
-  std::unordered_map<zet_metric_query_pool_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      metricQueryPoolHandleStateMap;
-  std::unordered_map<zet_metric_query_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      metricQueryHandleStateMap;
-  std::unordered_map<zet_tracer_exp_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      tracerExpHandleStateMap;
-  std::unordered_map<zet_debug_session_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      debugSessionHandleStateMap;
-
-  // sysman
-  std::unordered_map<zes_driver_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zesDriverHandleStateMap;
-  std::unordered_map<zes_device_handle_t, std::unique_ptr<zel_handle_state_t>>
-      zesDeviceHandleStateMap;
-  std::unordered_map<zes_sched_handle_t, std::unique_ptr<zel_handle_state_t>>
-      schedHandleStateMap;
-  std::unordered_map<zes_perf_handle_t, std::unique_ptr<zel_handle_state_t>>
-      perfHandleStateMap;
-  std::unordered_map<zes_pwr_handle_t, std::unique_ptr<zel_handle_state_t>>
-      pwrHandleStateMap;
-  std::unordered_map<zes_freq_handle_t, std::unique_ptr<zel_handle_state_t>>
-      freqHandleStateMap;
-  std::unordered_map<zes_engine_handle_t, std::unique_ptr<zel_handle_state_t>>
-      engineHandleStateMap;
-  std::unordered_map<zes_standby_handle_t, std::unique_ptr<zel_handle_state_t>>
-      standbyHandleStateMap;
-  std::unordered_map<zes_firmware_handle_t, std::unique_ptr<zel_handle_state_t>>
-      firmwareHandleStateMap;
-  std::unordered_map<zes_mem_handle_t, std::unique_ptr<zel_handle_state_t>>
-      memHandleStateMap;
-  std::unordered_map<zes_fabric_port_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      fabricPortHandleStateMap;
-  std::unordered_map<zes_temp_handle_t, std::unique_ptr<zel_handle_state_t>>
-      tempHandleStateMap;
-  std::unordered_map<zes_psu_handle_t, std::unique_ptr<zel_handle_state_t>>
-      psuHandleStateMap;
-  std::unordered_map<zes_fan_handle_t, std::unique_ptr<zel_handle_state_t>>
-      fanHandleStateMap;
-  std::unordered_map<zes_led_handle_t, std::unique_ptr<zel_handle_state_t>>
-      ledHandleStateMap;
-  std::unordered_map<zes_ras_handle_t, std::unique_ptr<zel_handle_state_t>>
-      rasHandleStateMap;
-  std::unordered_map<zes_diag_handle_t, std::unique_ptr<zel_handle_state_t>>
-      diagHandleStateMap;
-  std::unordered_map<zes_overclock_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      overclockHandleStateMap;
-  std::unordered_map<ze_rtas_parallel_operation_exp_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      rtasParallelOperationHandleStateMap;
-  std::unordered_map<ze_rtas_builder_exp_handle_t,
-                     std::unique_ptr<zel_handle_state_t>>
-      rtasBuilderHandleStateMap;
+  HandleTable handles;
+
+  // Drops dependent from the set of handle; empty sets are removed so that
+  // hasDependents is a single lookup. Requires dependentMutex.
+  bool eraseDependent(const void *handle, const void *dependent) {
+    auto it = dependentMap.find(handle);
+    if (it == dependentMap.end() || it->second.erase(dependent) == 0) {
+      return false;
+    }
+    if (it->second.empty()) {
+      dependentMap.erase(it);
+    }
+    return true;
+  }
 
+  // dependentMap holds the dependents of each handle and parentMap the
+  // reverse edges; a handle rarely depends on more than one other handle.
+  std::mutex dependentMutex;
   std::unordered_map<const void *, std::unordered_set<const void *>>
       dependentMap;
+  std::unordered_map<const void *, std::vector<const void *>> parentMap;
 
-  int untrackedHandles = 0;
+  std::atomic<int> untrackedHandles{0};
+  std::atomic<bool> adoptUntracked{false};
 
 }; // class HandleLifetimeValidation
 
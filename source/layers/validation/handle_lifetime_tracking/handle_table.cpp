@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "handle_table.h"
+
+namespace validation_layer {
+
+// The low bits of the hash select the shard, the remaining bits the slot.
+HandleTable::entry_t *HandleTable::find(shard_t &shard, uint64_t h,
+                                        const void *handle,
+                                        zel_handle_type_t type) {
+  auto capacity = shard.entries.size();
+  if (capacity == 0)
+    return nullptr;
+  auto mask = capacity - 1;
+  for (size_t i = (h >> 6) & mask;; i = (i + 1) & mask) {
+    auto &entry = shard.entries[i];
+    if (entry.slot == SLOT_EMPTY)
+      return nullptr;
+    if (entry.slot == SLOT_FULL && entry.handle == handle &&
+        entry.type == type)
+      return &entry;
+  }
+}
+
+void HandleTable::rehash(shard_t &shard, size_t capacity) {
+  std::vector<entry_t> previous(capacity, entry_t{});
+  previous.swap(shard.entries);
+  auto mask = capacity - 1;
+  for (auto &entry : previous) {
+    if (entry.slot != SLOT_FULL)
+      continue;
+    auto i = (hash(entry.handle, entry.type) >> 6) & mask;
+    while (shard.entries[i].slot != SLOT_EMPTY)
+      i = (i + 1) & mask;
+    shard.entries[i] = entry;
+  }
+  shard.deleted = 0;
+}
+
+bool HandleTable::insert(const void *handle, zel_handle_type_t type,
+                         uint8_t flags) {
+  auto h = hash(handle, type);
+  auto &shard = shardFor(h);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+
+  if (auto entry = find(shard, h, handle, type)) {
+    entry->flags = flags;
+    return false;
+  }
+
+  // Keep the load, including deleted slots, under 3/4 so probes stay short
+  // and always terminate on an empty slot.
+  auto capacity = shard.entries.size();
+  if ((shard.count + shard.deleted + 1) * 4 > capacity * 3) {
+    auto newCapacity = capacity ? capacity : initialCapacity;
+    while ((shard.count + 1) * 2 > newCapacity)
+      newCapacity *= 2;
+    rehash(shard, newCapacity);
+  }
+
+  auto mask = shard.entries.size() - 1;
+  auto i = (h >> 6) & mask;
+  while (shard.entries[i].slot == SLOT_FULL)
+    i = (i + 1) & mask;
+  if (shard.entries[i].slot == SLOT_DELETED)
+    shard.deleted--;
+  shard.entries[i] = entry_t{handle, type, flags, SLOT_FULL};
+  shard.count++;
+  return true;
+}
+
+bool HandleTable::erase(const void *handle, zel_handle_type_t type) {
+  auto h = hash(handle, type);
+  auto &shard = shardFor(h);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+
+  auto entry = find(shard, h, handle, type);
+  if (entry == nullptr)
+    return false;
+  entry->slot = SLOT_DELETED;
+  shard.count--;
+  shard.deleted++;
+  return true;
+}
+
+bool HandleTable::contains(const void *handle, zel_handle_type_t type) {
+  auto h = hash(handle, type);
+  auto &shard = shardFor(h);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  return find(shard, h, handle, type) != nullptr;
+}
+
+bool HandleTable::getFlags(const void *handle, zel_handle_type_t type,
+                           uint8_t &flags) {
+  auto h = hash(handle, type);
+  auto &shard = shardFor(h);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+
+  auto entry = find(shard, h, handle, type);
+  if (entry == nullptr)
+    return false;
+  flags = entry->flags;
+  return true;
+}
+
+bool HandleTable::setFlags(const void *handle, zel_handle_type_t type,
+                           uint8_t flags) {
+  auto h = hash(handle, type);
+  auto &shard = shardFor(h);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+
+  auto entry = find(shard, h, handle, type);
+  if (entry == nullptr)
+    return false;
+  entry->flags = flags;
+  return true;
+}
+
+size_t HandleTable::size() {
+  size_t total = 0;
+  for (auto &shard : shards) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    total += shard.count;
+  }
+  return total;
+}
+
+} // namespace validation_layer
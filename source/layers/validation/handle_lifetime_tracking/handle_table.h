@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace validation_layer {
+
+enum class zel_handle_type_t : uint8_t {
+  unknown = 0,
+  driver,
+  device,
+  context,
+  command_queue,
+  command_list,
+  fence,
+  event_pool,
+  event,
+  image,
+  module,
+  module_build_log,
+  kernel,
+  sampler,
+  physical_mem,
+  fabric_vertex,
+  fabric_edge,
+  ipc_event_pool,
+  ipc_mem,
+  external_memory_import_win32,
+  external_memory_export_win32,
+  metric_group,
+  metric,
+  metric_streamer,
+  metric_query_pool,
+  metric_query,
+  tracer_exp,
+  debug_session,
+  sched,
+  perf,
+  pwr,
+  freq,
+  engine,
+  standby,
+  firmware,
+  mem,
+  fabric_port,
+  temp,
+  psu,
+  fan,
+  led,
+  ras,
+  diag,
+  overclock,
+  rtas_parallel_operation,
+  rtas_builder,
+};
+
+// Per handle flags kept inline in the table entry.
+enum zel_handle_flags_t : uint8_t {
+  ZEL_HANDLE_FLAG_OPEN = 1, // command list accepts appends
+  ZEL_HANDLE_FLAG_RELEASED = 2, // destroyed while adopting untracked handles
+};
+
+// Thread-safe set of (handle, type) pairs with a few bits of state each.
+// Entries are spread over shards by hash; every shard is an open-addressing
+// table with linear probing guarded by its own lock, so concurrent threads
+// only contend when they touch the same shard.
+class HandleTable {
+public:
+  bool insert(const void *handle, zel_handle_type_t type, uint8_t flags = 0);
+  bool erase(const void *handle, zel_handle_type_t type);
+  bool contains(const void *handle, zel_handle_type_t type);
+  bool getFlags(const void *handle, zel_handle_type_t type, uint8_t &flags);
+  bool setFlags(const void *handle, zel_handle_type_t type, uint8_t flags);
+  size_t size();
+
+private:
+  static constexpr size_t shardCount = 64;
+  static constexpr size_t initialCapacity = 16;
+
+  enum : uint8_t { SLOT_EMPTY = 0, SLOT_FULL, SLOT_DELETED };
+
+  struct entry_t {
+    const void *handle;
+    zel_handle_type_t type;
+    uint8_t flags;
+    uint8_t slot;
+  };
+
+  struct alignas(64) shard_t {
+    std::mutex mutex;
+    std::vector<entry_t> entries;
+    size_t count = 0;
+    size_t deleted = 0;
+  };
+
+  static uint64_t hash(const void *handle, zel_handle_type_t type) {
+    uint64_t h = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(handle)) ^
+                 (static_cast<uint64_t>(type) * 0x9e3779b97f4a7c15ull);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    return h;
+  }
+
+  shard_t &shardFor(uint64_t h) { return shards[h & (shardCount - 1)]; }
+  static entry_t *find(shard_t &shard, uint64_t h, const void *handle,
+                       zel_handle_type_t type);
+  static void rehash(shard_t &shard, size_t capacity);
+
+  shard_t shards[shardCount];
+};
+
+} // namespace validation_layer
@@ -0,0 +1,173 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace validation_layer
+{
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Ordered set of non-overlapping address ranges, laid out as a two level
+    // B+-tree: sorted blocks of at most blockCapacity bases, and a sorted
+    // array of the first base of every block. A lookup is a binary search in
+    // the top array followed by one in a single block, so it touches a few
+    // contiguous cache lines instead of one node per level of a binary tree.
+    // Not thread-safe; the caller holds the lock.
+    template <typename T> class AllocationIndex {
+    public:
+        struct range_t {
+            uintptr_t base;
+            size_t size;
+            T value;
+        };
+
+        // Returns false if a range already starts at base.
+        bool insert(uintptr_t base, size_t size, const T &value)
+        {
+            if (blocks.empty()) {
+                blocks.emplace_back(new block_t);
+                firstBases.push_back(base);
+            }
+            auto b = blockFor(base);
+            if (blocks[b]->count == blockCapacity)
+                b = split(b, base);
+            auto &block = *blocks[b];
+            auto i = lowerBound(block.bases, block.count, base);
+            if (i < block.count && block.bases[i] == base)
+                return false;
+
+            std::copy_backward(block.bases + i, block.bases + block.count, block.bases + block.count + 1);
+            std::copy_backward(block.ranges + i, block.ranges + block.count, block.ranges + block.count + 1);
+            block.bases[i] = base;
+            block.ranges[i] = range_t{base, size, value};
+            block.count++;
+            firstBases[b] = block.bases[0];
+            count++;
+            return true;
+        }
+
+        bool erase(uintptr_t base)
+        {
+            auto range = find(base);
+            if (range == nullptr)
+                return false;
+            auto b = blockFor(base);
+            auto &block = *blocks[b];
+            auto i = lowerBound(block.bases, block.count, base);
+            std::copy(block.bases + i + 1, block.bases + block.count, block.bases + i);
+            std::copy(block.ranges + i + 1, block.ranges + block.count, block.ranges + i);
+            block.count--;
+            count--;
+            if (block.count == 0) {
+                blocks.erase(blocks.begin() + b);
+                firstBases.erase(firstBases.begin() + b);
+            } else {
+                firstBases[b] = block.bases[0];
+            }
+            return true;
+        }
+
+        // The range starting exactly at base.
+        range_t *find(uintptr_t base)
+        {
+            auto range = findContaining(base);
+            return (range && range->base == base) ? range : nullptr;
+        }
+
+        // The range starting at or below address, whether or not it reaches
+        // address; the caller compares against the size.
+        range_t *findContaining(uintptr_t address)
+        {
+            if (blocks.empty() || address < firstBases.front())
+                return nullptr;
+            auto &block = *blocks[blockFor(address)];
+            auto i = upperBound(block.bases, block.count, address);
+            return &block.ranges[i - 1];
+        }
+
+        size_t size() const { return count; }
+
+        template <typename F> void forEach(F f) const
+        {
+            for (auto &block : blocks)
+                for (size_t i = 0; i < block->count; ++i)
+                    f(block->ranges[i]);
+        }
+
+    private:
+        static constexpr size_t blockCapacity = 128;
+
+        struct block_t {
+            size_t count = 0;
+            uintptr_t bases[blockCapacity];
+            range_t ranges[blockCapacity];
+        };
+
+        // Branch-free binary searches: the comparison only selects the next
+        // position, so random lookups do not pay for mispredicted branches.
+        static size_t lowerBound(const uintptr_t *keys, size_t count, uintptr_t key)
+        {
+            if (count == 0)
+                return 0;
+            size_t first = 0;
+            while (count > 1) {
+                auto half = count / 2;
+                first = (keys[first + half - 1] < key) ? first + half : first;
+                count -= half;
+            }
+            return first + (keys[first] < key);
+        }
+
+        static size_t upperBound(const uintptr_t *keys, size_t count, uintptr_t key)
+        {
+            if (count == 0)
+                return 0;
+            size_t first = 0;
+            while (count > 1) {
+                auto half = count / 2;
+                first = (keys[first + half - 1] <= key) ? first + half : first;
+                count -= half;
+            }
+            return first + (keys[first] <= key);
+        }
+
+        // Last block whose first base is not above address, or the first
+        // block for addresses below every range.
+        size_t blockFor(uintptr_t address) const
+        {
+            auto b = upperBound(firstBases.data(), firstBases.size(), address);
+            return b ? b - 1 : 0;
+        }
+
+        // Moves the upper half of a full block into a new block and returns
+        // the block that base now belongs to.
+        size_t split(size_t b, uintptr_t base)
+        {
+            auto &block = *blocks[b];
+            auto half = block.count / 2;
+            std::unique_ptr<block_t> upper(new block_t);
+            upper->count = block.count - half;
+            std::copy(block.bases + half, block.bases + block.count, upper->bases);
+            std::copy(block.ranges + half, block.ranges + block.count, upper->ranges);
+            block.count = half;
+            firstBases.insert(firstBases.begin() + b + 1, upper->bases[0]);
+            blocks.insert(blocks.begin() + b + 1, std::move(upper));
+            return base < firstBases[b + 1] ? b : b + 1;
+        }
+
+        std::vector<uintptr_t> firstBases;
+        std::vector<std::unique_ptr<block_t>> blocks;
+        size_t count = 0;
+    };
+
+} // namespace validation_layer
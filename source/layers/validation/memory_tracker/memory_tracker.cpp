@@ -0,0 +1,185 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include "ze_validation_layer.h"
+#include "memory_tracker.h"
+#include <cstdio>
+
+namespace validation_layer
+{
+    namespace
+    {
+        const char *typeName(int type)
+        {
+            static const char *names[] = {"host", "device", "shared", "IPC"};
+            return names[type];
+        }
+    } // namespace
+
+    ///////////////////////////////////////////////////////////////////////////////
+    MemoryTracker::~MemoryTracker()
+    {
+        fprintf(stderr, "Memory tracker: peak of %zu allocations and %zu bytes, %zu allocations (%zu bytes) not freed\n",
+                peakCount, peakBytes, allocations.size(), liveBytes);
+
+        constexpr size_t maxReported = 16;
+        size_t reported = 0;
+        allocations.forEach([&](const AllocationIndex<allocation_t>::range_t &range) {
+            if (reported++ < maxReported)
+                fprintf(stderr, "    %s allocation %p of %zu bytes\n", typeName(static_cast<int>(range.value.type)),
+                        reinterpret_cast<void *>(range.base), range.size);
+        });
+        if (reported > maxReported)
+            fprintf(stderr, "    ...\n");
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void MemoryTracker::add(const void *ptr, size_t size, allocation_type_t type)
+    {
+        if (ptr == nullptr)
+            return;
+        std::lock_guard<std::shared_timed_mutex> lock(mutex);
+        if (!allocations.insert(reinterpret_cast<uintptr_t>(ptr), size, allocation_t{type, 1})) {
+            // The same allocation opened again through IPC.
+            allocations.find(reinterpret_cast<uintptr_t>(ptr))->value.references++;
+            return;
+        }
+        liveBytes += size;
+        if (liveBytes > peakBytes)
+            peakBytes = liveBytes;
+        if (allocations.size() > peakCount)
+            peakCount = allocations.size();
+    }
+
+    void MemoryTracker::remove(const void *ptr)
+    {
+        std::lock_guard<std::shared_timed_mutex> lock(mutex);
+        auto range = allocations.find(reinterpret_cast<uintptr_t>(ptr));
+        if (range == nullptr || --range->value.references > 0)
+            return;
+        liveBytes -= range->size;
+        allocations.erase(range->base);
+    }
+
+    // Only pointers returned by an allocation or IPC open may be released.
+    ze_result_t MemoryTracker::checkFree(const void *ptr, bool ipc)
+    {
+        std::shared_lock<std::shared_timed_mutex> lock(mutex);
+        auto range = allocations.find(reinterpret_cast<uintptr_t>(ptr));
+        if (range == nullptr)
+            return adoptUntracked ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        if ((range->value.type == allocation_type_t::ipc) != ipc)
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t MemoryTracker::checkRange(const void *ptr, size_t size)
+    {
+        auto address = reinterpret_cast<uintptr_t>(ptr);
+        std::shared_lock<std::shared_timed_mutex> lock(mutex);
+        auto range = allocations.findContaining(address);
+        if (range == nullptr)
+            return ZE_RESULT_SUCCESS;
+        auto offset = address - range->base;
+        if (offset >= range->size)
+            return ZE_RESULT_SUCCESS;
+        if (size > range->size - offset)
+            return ZE_RESULT_ERROR_INVALID_SIZE;
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ze_result_t MemoryTracker::zeMemFree( ze_context_handle_t hContext, void* ptr )
+    {
+        return checkFree(ptr, false);
+    }
+
+    ze_result_t MemoryTracker::zeMemFreeExt( ze_context_handle_t hContext, const ze_memory_free_ext_desc_t* pMemFreeDesc, void* ptr )
+    {
+        return checkFree(ptr, false);
+    }
+
+    ze_result_t MemoryTracker::zeMemCloseIpcHandle( ze_context_handle_t hContext, const void* ptr )
+    {
+        return checkFree(ptr, true);
+    }
+
+    ze_result_t MemoryTracker::zeCommandListAppendMemoryCopy( ze_command_list_handle_t hCommandList, void* dstptr, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents )
+    {
+        auto result = checkRange(dstptr, size);
+        if (result != ZE_RESULT_SUCCESS)
+            return result;
+        return checkRange(srcptr, size);
+    }
+
+    ze_result_t MemoryTracker::zeCommandListAppendMemoryFill( ze_command_list_handle_t hCommandList, void* ptr, const void* pattern, size_t pattern_size, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents )
+    {
+        return checkRange(ptr, size);
+    }
+
+    ze_result_t MemoryTracker::zeCommandListAppendMemoryCopyFromContext( ze_command_list_handle_t hCommandList, void* dstptr, ze_context_handle_t hContextSrc, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents )
+    {
+        auto result = checkRange(dstptr, size);
+        if (result != ZE_RESULT_SUCCESS)
+            return result;
+        return checkRange(srcptr, size);
+    }
+
+    ze_result_t MemoryTracker::zeCommandListAppendMemoryPrefetch( ze_command_list_handle_t hCommandList, const void* ptr, size_t size )
+    {
+        return checkRange(ptr, size);
+    }
+
+    ze_result_t MemoryTracker::zeCommandListAppendMemAdvise( ze_command_list_handle_t hCommandList, ze_device_handle_t hDevice, const void* ptr, size_t size, ze_memory_advice_t advice )
+    {
+        return checkRange(ptr, size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void MemoryTracker::zeMemAllocSharedEpilogue( ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr )
+    {
+        add(*pptr, size, allocation_type_t::shared);
+    }
+
+    void MemoryTracker::zeMemAllocDeviceEpilogue( ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr )
+    {
+        add(*pptr, size, allocation_type_t::device);
+    }
+
+    void MemoryTracker::zeMemAllocHostEpilogue( ze_context_handle_t hContext, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, void** pptr )
+    {
+        add(*pptr, size, allocation_type_t::host);
+    }
+
+    void MemoryTracker::zeMemFreeEpilogue( ze_context_handle_t hContext, void* ptr )
+    {
+        remove(ptr);
+    }
+
+    void MemoryTracker::zeMemFreeExtEpilogue( ze_context_handle_t hContext, const ze_memory_free_ext_desc_t* pMemFreeDesc, void* ptr )
+    {
+        remove(ptr);
+    }
+
+    // The size of an IPC mapping is not part of the call, so it is queried
+    // from the driver.
+    void MemoryTracker::zeMemOpenIpcHandleEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_ipc_mem_handle_t handle, ze_ipc_memory_flags_t flags, void** pptr )
+    {
+        void *base = nullptr;
+        size_t size = 0;
+        auto pfnGetAddressRange = context.zeDdiTable.Mem.pfnGetAddressRange;
+        if (pfnGetAddressRange == nullptr || pfnGetAddressRange(hContext, *pptr, &base, &size) != ZE_RESULT_SUCCESS)
+            size = 0;
+        add(*pptr, size, allocation_type_t::ipc);
+    }
+
+    void MemoryTracker::zeMemCloseIpcHandleEpilogue( ze_context_handle_t hContext, const void* ptr )
+    {
+        remove(ptr);
+    }
+
+} // namespace validation_layer
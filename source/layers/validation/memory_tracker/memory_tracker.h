@@ -0,0 +1,74 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#pragma once
+
+#include "ze_entry_points.h"
+#include "allocation_index.h"
+#include <atomic>
+#include <cstdint>
+#include <shared_mutex>
+
+namespace validation_layer
+{
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Tracks live USM allocations and IPC mappings as non-overlapping address
+    // intervals ordered by base address, so the allocation holding a pointer
+    // is found with an O(log n) search under a shared lock. Appends that
+    // name a range inside a tracked allocation are rejected when the range
+    // runs past its end; pointers outside every allocation are left to the
+    // driver, since system memory is valid for copies. Peak usage and the
+    // allocations still live are reported when the layer is unloaded.
+    class MemoryTracker : public ZEValidationEntryPoints {
+    public:
+        ~MemoryTracker();
+
+        // Used when tracking starts after allocations were made: freeing an
+        // untracked pointer is then accepted.
+        void adoptUntrackedAllocations() { adoptUntracked = true; }
+
+        ze_result_t zeMemFree( ze_context_handle_t hContext, void* ptr ) override;
+        ze_result_t zeMemFreeExt( ze_context_handle_t hContext, const ze_memory_free_ext_desc_t* pMemFreeDesc, void* ptr ) override;
+        ze_result_t zeMemCloseIpcHandle( ze_context_handle_t hContext, const void* ptr ) override;
+        ze_result_t zeCommandListAppendMemoryCopy( ze_command_list_handle_t hCommandList, void* dstptr, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override;
+        ze_result_t zeCommandListAppendMemoryFill( ze_command_list_handle_t hCommandList, void* ptr, const void* pattern, size_t pattern_size, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override;
+        ze_result_t zeCommandListAppendMemoryCopyFromContext( ze_command_list_handle_t hCommandList, void* dstptr, ze_context_handle_t hContextSrc, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents ) override;
+        ze_result_t zeCommandListAppendMemoryPrefetch( ze_command_list_handle_t hCommandList, const void* ptr, size_t size ) override;
+        ze_result_t zeCommandListAppendMemAdvise( ze_command_list_handle_t hCommandList, ze_device_handle_t hDevice, const void* ptr, size_t size, ze_memory_advice_t advice ) override;
+
+        // Called after the driver call succeeded.
+        void zeMemAllocSharedEpilogue( ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr );
+        void zeMemAllocDeviceEpilogue( ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr );
+        void zeMemAllocHostEpilogue( ze_context_handle_t hContext, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, void** pptr );
+        void zeMemFreeEpilogue( ze_context_handle_t hContext, void* ptr );
+        void zeMemFreeExtEpilogue( ze_context_handle_t hContext, const ze_memory_free_ext_desc_t* pMemFreeDesc, void* ptr );
+        void zeMemOpenIpcHandleEpilogue( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_ipc_mem_handle_t handle, ze_ipc_memory_flags_t flags, void** pptr );
+        void zeMemCloseIpcHandleEpilogue( ze_context_handle_t hContext, const void* ptr );
+
+    private:
+        enum class allocation_type_t : uint8_t { host, device, shared, ipc };
+
+        struct allocation_t {
+            allocation_type_t type;
+            uint32_t references;
+        };
+
+        void add(const void *ptr, size_t size, allocation_type_t type);
+        void remove(const void *ptr);
+        ze_result_t checkFree(const void *ptr, bool ipc);
+        ze_result_t checkRange(const void *ptr, size_t size);
+
+        std::shared_timed_mutex mutex;
+        AllocationIndex<allocation_t> allocations;
+        size_t liveBytes = 0;
+        size_t peakBytes = 0;
+        size_t peakCount = 0;
+        std::atomic<bool> adoptUntracked{false};
+    };
+
+} // namespace validation_layer
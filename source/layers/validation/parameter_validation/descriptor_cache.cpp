@@ -0,0 +1,66 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include "descriptor_cache.h"
+
+namespace validation_layer
+{
+    namespace
+    {
+        // Power of two; applications use a handful of distinct chains.
+        constexpr size_t cacheSlots = 256;
+
+        struct entry_t {
+            DescriptorCache::key_t key;
+            ze_result_t result;
+        };
+
+        // Zero initialized, so the thread_local needs no constructor. A null
+        // checker marks an empty slot.
+        struct thread_cache_t {
+            entry_t entries[cacheSlots];
+        };
+        thread_local thread_cache_t threadCache;
+
+        size_t slotFor(const DescriptorCache::key_t &key)
+        {
+            uint64_t hash = reinterpret_cast<uintptr_t>(key.checker) ^ (uint64_t(key.extra) << 32) ^ key.length;
+            for (uint32_t i = 0; i < key.length; ++i)
+                hash = (hash ^ key.stypes[i]) * 0x100000001b3ull;
+            hash ^= hash >> 29;
+            return static_cast<size_t>(hash & (cacheSlots - 1));
+        }
+
+        bool sameKey(const DescriptorCache::key_t &a, const DescriptorCache::key_t &b)
+        {
+            if (a.checker != b.checker || a.length != b.length || a.extra != b.extra)
+                return false;
+            for (uint32_t i = 0; i < a.length; ++i)
+                if (a.stypes[i] != b.stypes[i])
+                    return false;
+            return true;
+        }
+    } // namespace
+
+    ///////////////////////////////////////////////////////////////////////////////
+    bool DescriptorCache::lookup(const key_t &key, ze_result_t &result)
+    {
+        auto &entry = threadCache.entries[slotFor(key)];
+        if (entry.key.checker == nullptr || !sameKey(entry.key, key))
+            return false;
+        result = entry.result;
+        return true;
+    }
+
+    void DescriptorCache::store(const key_t &key, ze_result_t result)
+    {
+        auto &entry = threadCache.entries[slotFor(key)];
+        entry.key = key;
+        entry.result = result;
+    }
+
+} // namespace validation_layer
@@ -0,0 +1,55 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#pragma once
+
+#include "ze_api.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace validation_layer
+{
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Per thread cache of extension validation results. The result of the
+    // checks only depends on the descriptor type and on the stype of every
+    // structure in its pNext chain, plus the module format for module
+    // descriptors, so those values form the key; the contents are compared
+    // in full on a hit, and a hash collision only costs a miss. Longer
+    // chains than the key holds are validated without the cache.
+    class DescriptorCache {
+    public:
+        static constexpr size_t maxChainLength = 8;
+
+        struct key_t {
+            const void *checker;
+            uint32_t length;
+            uint32_t extra;
+            uint32_t stypes[maxChainLength];
+        };
+
+        // checker identifies the set of checks applied to the chain.
+        template <typename B>
+        static bool makeKey(const void *checker, const void *descriptor, uint32_t extra, key_t &key)
+        {
+            key.checker = checker;
+            key.extra = extra;
+            key.length = 0;
+            for (auto pBase = reinterpret_cast<const B *>(descriptor); pBase;
+                 pBase = reinterpret_cast<const B *>(pBase->pNext)) {
+                if (key.length == maxChainLength)
+                    return false;
+                key.stypes[key.length++] = static_cast<uint32_t>(pBase->stype);
+            }
+            return true;
+        }
+
+        static bool lookup(const key_t &key, ze_result_t &result);
+        static void store(const key_t &key, ze_result_t result);
+    };
+
+} // namespace validation_layer
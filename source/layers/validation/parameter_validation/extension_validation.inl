@@ -10,9 +10,9 @@
 #include <type_traits>
 
 template <typename S, typename B>
-inline ze_result_t validateStructureTypes(const void *descriptorPtr,
-                                   std::vector<S> &baseTypesVector,
-                                   std::vector<S> &extensionTypesVector) {
+inline ze_result_t validateStructureTypesUncached(const void *descriptorPtr,
+                                   const std::vector<S> &baseTypesVector,
+                                   const std::vector<S> &extensionTypesVector) {
 
     const B *pBase = reinterpret_cast<const B*> (descriptorPtr);
 
@@ -64,13 +64,48 @@ inline ze_result_t validateStructureTypes(const void *descriptorPtr,
      return ZE_RESULT_SUCCESS;
 }
 
+// The type vectors are static, so the address of the base types identifies
+// the descriptor in the cache key.
+template <typename S, typename B>
+inline ze_result_t validateStructureTypes(const void *descriptorPtr,
+                                   const std::vector<S> &baseTypesVector,
+                                   const std::vector<S> &extensionTypesVector) {
+
+    if (descriptorPtr == nullptr) {
+         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    // Module program extensions are only valid with SPIR-V modules.
+    uint32_t extra = 0;
+    if (std::is_same<S, ze_structure_type_t>::value) {
+        for (auto t : extensionTypesVector) {
+            if (ZE_STRUCTURE_TYPE_MODULE_PROGRAM_EXP_DESC == static_cast<ze_structure_type_t>(t)) {
+                extra = 1 + static_cast<uint32_t>(reinterpret_cast<const ze_module_desc_t *>(descriptorPtr)->format);
+                break;
+            }
+        }
+    }
+
+    DescriptorCache::key_t key;
+    if (!DescriptorCache::makeKey<B>(&baseTypesVector, descriptorPtr, extra, key)) {
+        return validateStructureTypesUncached<S, B>(descriptorPtr, baseTypesVector, extensionTypesVector);
+    }
+
+    ze_result_t result;
+    if (!DescriptorCache::lookup(key, result)) {
+        result = validateStructureTypesUncached<S, B>(descriptorPtr, baseTypesVector, extensionTypesVector);
+        DescriptorCache::store(key, result);
+    }
+    return result;
+}
+
 /* Begin ze_api cases */
 
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_device_p2p_properties_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_DEVICE_P2P_PROPERTIES};
-    std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_DEVICE_P2P_BANDWIDTH_EXP_PROPERTIES};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_DEVICE_P2P_PROPERTIES};
+    static const std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_DEVICE_P2P_BANDWIDTH_EXP_PROPERTIES};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t> (descriptor, baseTypes, types);
 }
@@ -78,8 +113,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_device_p2p_propert
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_pci_ext_properties_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_PCI_EXT_PROPERTIES};
-    std::vector<ze_structure_type_t> types = {};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_PCI_EXT_PROPERTIES};
+    static const std::vector<ze_structure_type_t> types = {};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -91,8 +126,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_device_memory_prop
        return ZE_RESULT_SUCCESS;
      }
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_DEVICE_MEMORY_PROPERTIES};
-    std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_DEVICE_MEMORY_EXT_PROPERTIES};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_DEVICE_MEMORY_PROPERTIES};
+    static const std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_DEVICE_MEMORY_EXT_PROPERTIES};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -100,8 +135,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_device_memory_prop
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_device_memory_access_properties_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_DEVICE_MEMORY_ACCESS_PROPERTIES};
-    std::vector<ze_structure_type_t> types = {};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_DEVICE_MEMORY_ACCESS_PROPERTIES};
+    static const std::vector<ze_structure_type_t> types = {};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -109,10 +144,10 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_device_memory_acce
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_kernel_properties_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_KERNEL_PROPERTIES};
-    std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_FLOAT_ATOMIC_EXT_PROPERTIES,
-                                              ZE_STRUCTURE_TYPE_SCHEDULING_HINT_EXP_PROPERTIES,
-                                              ZE_STRUCTURE_TYPE_DEVICE_RAYTRACING_EXT_PROPERTIES,
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_KERNEL_PROPERTIES};
+    static const std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_FLOAT_ATOMIC_EXT_PROPERTIES,
+                                                           ZE_STRUCTURE_TYPE_SCHEDULING_HINT_EXP_PROPERTIES,
+                                                           ZE_STRUCTURE_TYPE_DEVICE_RAYTRACING_EXT_PROPERTIES,
 					      ZE_STRUCTURE_TYPE_KERNEL_PREFERRED_GROUP_SIZE_PROPERTIES};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
@@ -121,12 +156,12 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_kernel_properties_
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_device_properties_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES,
-                                                  ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES_1_2};
-    std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_DEVICE_LUID_EXT_PROPERTIES,
-                                              ZE_STRUCTURE_TYPE_EU_COUNT_EXT,
-                                              ZE_STRUCTURE_TYPE_DEVICE_IP_VERSION_EXT,
-                                              ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_LIST_EXP_PROPERTIES};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES,
+                                                               ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES_1_2};
+    static const std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_DEVICE_LUID_EXT_PROPERTIES,
+                                                           ZE_STRUCTURE_TYPE_EU_COUNT_EXT,
+                                                           ZE_STRUCTURE_TYPE_DEVICE_IP_VERSION_EXT,
+                                                           ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_LIST_EXP_PROPERTIES};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -138,8 +173,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_device_cache_prope
         return ZE_RESULT_SUCCESS;
     }
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_DEVICE_CACHE_PROPERTIES};
-    std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_CACHE_RESERVATION_EXT_DESC};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_DEVICE_CACHE_PROPERTIES};
+    static const std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_CACHE_RESERVATION_EXT_DESC};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -147,8 +182,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_device_cache_prope
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_device_image_properties_t *descriptor) {
     
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_DEVICE_IMAGE_PROPERTIES};
-    std::vector<ze_structure_type_t> types = {};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_DEVICE_IMAGE_PROPERTIES};
+    static const std::vector<ze_structure_type_t> types = {};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -156,8 +191,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_device_image_prope
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_device_compute_properties_t *descriptor) {
     
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_DEVICE_COMPUTE_PROPERTIES};
-    std::vector<ze_structure_type_t> types = {};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_DEVICE_COMPUTE_PROPERTIES};
+    static const std::vector<ze_structure_type_t> types = {};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -165,11 +200,11 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_device_compute_pro
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_device_module_properties_t *descriptor) {
     
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_DEVICE_MODULE_PROPERTIES};
-    std::vector<ze_structure_type_t> types = {
-        ZE_STRUCTURE_TYPE_FLOAT_ATOMIC_EXT_PROPERTIES,
-        ZE_STRUCTURE_TYPE_SCHEDULING_HINT_EXP_PROPERTIES,
-        ZE_STRUCTURE_TYPE_DEVICE_RAYTRACING_EXT_PROPERTIES};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_DEVICE_MODULE_PROPERTIES};
+    static const std::vector<ze_structure_type_t> types = {
+                     ZE_STRUCTURE_TYPE_FLOAT_ATOMIC_EXT_PROPERTIES,
+                     ZE_STRUCTURE_TYPE_SCHEDULING_HINT_EXP_PROPERTIES,
+                     ZE_STRUCTURE_TYPE_DEVICE_RAYTRACING_EXT_PROPERTIES};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -181,9 +216,9 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_command_queue_grou
        return ZE_RESULT_SUCCESS;
      }
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_GROUP_PROPERTIES};
-    std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_GROUP_PROPERTIES,
-                                              ZE_STRUCTURE_TYPE_COPY_BANDWIDTH_EXP_PROPERTIES};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_GROUP_PROPERTIES};
+    static const std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_GROUP_PROPERTIES,
+                                                           ZE_STRUCTURE_TYPE_COPY_BANDWIDTH_EXP_PROPERTIES};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -191,8 +226,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_command_queue_grou
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_device_external_memory_properties_t *descriptor) {
     
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_DEVICE_EXTERNAL_MEMORY_PROPERTIES};
-    std::vector<ze_structure_type_t> types = {};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_DEVICE_EXTERNAL_MEMORY_PROPERTIES};
+    static const std::vector<ze_structure_type_t> types = {};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -200,8 +235,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_device_external_me
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_driver_properties_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_DRIVER_PROPERTIES};
-    std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_DRIVER_MEMORY_FREE_EXT_PROPERTIES};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_DRIVER_PROPERTIES};
+    static const std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_DRIVER_MEMORY_FREE_EXT_PROPERTIES};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -209,8 +244,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_driver_properties_
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_driver_ipc_properties_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_DRIVER_IPC_PROPERTIES};
-    std::vector<ze_structure_type_t> types = {};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_DRIVER_IPC_PROPERTIES};
+    static const std::vector<ze_structure_type_t> types = {};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -218,8 +253,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_driver_ipc_propert
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_image_properties_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_IMAGE_PROPERTIES};
-    std::vector<ze_structure_type_t> types = {};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_IMAGE_PROPERTIES};
+    static const std::vector<ze_structure_type_t> types = {};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -227,8 +262,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_image_properties_t
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_memory_allocation_properties_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_MEMORY_ALLOCATION_PROPERTIES};
-    std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_EXTERNAL_MEMORY_EXPORT_FD,
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_MEMORY_ALLOCATION_PROPERTIES};
+    static const std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_EXTERNAL_MEMORY_EXPORT_FD,
 					      ZE_STRUCTURE_TYPE_EXTERNAL_MEMORY_EXPORT_WIN32,
 					      ZE_STRUCTURE_TYPE_MEMORY_SUB_ALLOCATIONS_EXP_PROPERTIES};
 
@@ -238,8 +273,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_memory_allocation_
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_image_allocation_ext_properties_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_IMAGE_ALLOCATION_EXT_PROPERTIES};
-    std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_EXTERNAL_MEMORY_EXPORT_FD,
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_IMAGE_ALLOCATION_EXT_PROPERTIES};
+    static const std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_EXTERNAL_MEMORY_EXPORT_FD,
 					      ZE_STRUCTURE_TYPE_EXTERNAL_MEMORY_EXPORT_WIN32};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
@@ -248,8 +283,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_image_allocation_e
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_module_properties_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_MODULE_PROPERTIES};
-    std::vector<ze_structure_type_t> types = {};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_MODULE_PROPERTIES};
+    static const std::vector<ze_structure_type_t> types = {};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -257,8 +292,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_module_properties_
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_fabric_vertex_exp_properties_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_FABRIC_VERTEX_EXP_PROPERTIES};
-    std::vector<ze_structure_type_t> types = {};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_FABRIC_VERTEX_EXP_PROPERTIES};
+    static const std::vector<ze_structure_type_t> types = {};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -266,8 +301,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_fabric_vertex_exp_
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_fabric_edge_exp_properties_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_FABRIC_EDGE_EXP_PROPERTIES};
-    std::vector<ze_structure_type_t> types = {};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_FABRIC_EDGE_EXP_PROPERTIES};
+    static const std::vector<ze_structure_type_t> types = {};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -275,8 +310,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_fabric_edge_exp_pr
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_context_desc_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
-    std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_POWER_SAVING_HINT_EXP_DESC};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    static const std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_POWER_SAVING_HINT_EXP_DESC};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -284,8 +319,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_context_desc_t *de
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_command_queue_desc_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
-    std::vector<ze_structure_type_t> types = {};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+    static const std::vector<ze_structure_type_t> types = {};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -293,9 +328,9 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_command_queue_desc
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_command_list_desc_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
 //    std::vector<ze_structure_type_t> types = {ZEX_STRUCTURE_TYPE_MUTABLE_COMMAND_LIST_DESCRIPTOR};
-    std::vector<ze_structure_type_t> types = {};
+    static const std::vector<ze_structure_type_t> types = {};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -303,8 +338,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_command_list_desc_
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_event_pool_desc_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
-    std::vector<ze_structure_type_t> types = {};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+    static const std::vector<ze_structure_type_t> types = {};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -312,8 +347,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_event_pool_desc_t
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_event_desc_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_EVENT_DESC};
-    std::vector<ze_structure_type_t> types = {};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+    static const std::vector<ze_structure_type_t> types = {};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -321,8 +356,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_event_desc_t *desc
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_fence_desc_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_FENCE_DESC};
-    std::vector<ze_structure_type_t> types = {};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_FENCE_DESC};
+    static const std::vector<ze_structure_type_t> types = {};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -330,8 +365,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_fence_desc_t *desc
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_image_desc_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_IMAGE_DESC};
-    std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMPORT_FD,
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_IMAGE_DESC};
+    static const std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMPORT_FD,
 					      ZE_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMPORT_WIN32,
 					      ZE_STRUCTURE_TYPE_MEMORY_COMPRESSION_HINTS_EXT_DESC};
 
@@ -341,8 +376,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_image_desc_t *desc
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_device_mem_alloc_desc_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
-    std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_RELAXED_ALLOCATION_LIMITS_EXP_DESC,
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+    static const std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_RELAXED_ALLOCATION_LIMITS_EXP_DESC,
 					      ZE_STRUCTURE_TYPE_RAYTRACING_MEM_ALLOC_EXT_DESC,
 					      ZE_STRUCTURE_TYPE_EXTERNAL_MEMORY_EXPORT_DESC,
 					      ZE_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMPORT_FD,
@@ -355,8 +390,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_device_mem_alloc_d
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_host_mem_alloc_desc_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
-    std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_RELAXED_ALLOCATION_LIMITS_EXP_DESC,
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
+    static const std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_RELAXED_ALLOCATION_LIMITS_EXP_DESC,
 					      ZE_STRUCTURE_TYPE_EXTERNAL_MEMORY_EXPORT_DESC,
 					      ZE_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMPORT_FD,
 					      ZE_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMPORT_WIN32,
@@ -368,8 +403,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_host_mem_alloc_des
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(const ze_module_desc_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_MODULE_DESC};
-    std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_MODULE_PROGRAM_EXP_DESC};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_MODULE_DESC};
+    static const std::vector<ze_structure_type_t> types = {ZE_STRUCTURE_TYPE_MODULE_PROGRAM_EXP_DESC};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -377,8 +412,8 @@ inline ze_result_t ParameterValidation::validateExtensions(const ze_module_desc_
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_kernel_desc_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_KERNEL_DESC};
-    std::vector<ze_structure_type_t> types = {};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_KERNEL_DESC};
+    static const std::vector<ze_structure_type_t> types = {};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -386,8 +421,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_kernel_desc_t *des
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_sampler_desc_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_SAMPLER_DESC};
-    std::vector<ze_structure_type_t> types = {};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_SAMPLER_DESC};
+    static const std::vector<ze_structure_type_t> types = {};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -395,8 +430,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_sampler_desc_t *de
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_physical_mem_desc_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_PHYSICAL_MEM_DESC};
-    std::vector<ze_structure_type_t> types = {};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_PHYSICAL_MEM_DESC};
+    static const std::vector<ze_structure_type_t> types = {};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -404,8 +439,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_physical_mem_desc_
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_scheduling_hint_exp_desc_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_SCHEDULING_HINT_EXP_DESC};
-    std::vector<ze_structure_type_t> types = {};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_SCHEDULING_HINT_EXP_DESC};
+    static const std::vector<ze_structure_type_t> types = {};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -414,8 +449,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_scheduling_hint_ex
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_linkage_inspection_ext_desc_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_LINKAGE_INSPECTION_EXT_DESC};
-    std::vector<ze_structure_type_t> types = {};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_LINKAGE_INSPECTION_EXT_DESC};
+    static const std::vector<ze_structure_type_t> types = {};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -423,8 +458,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_linkage_inspection
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_memory_free_ext_desc_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_MEMORY_FREE_EXT_DESC};
-    std::vector<ze_structure_type_t> types = {};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_MEMORY_FREE_EXT_DESC};
+    static const std::vector<ze_structure_type_t> types = {};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -432,8 +467,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_memory_free_ext_de
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_image_memory_properties_exp_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_IMAGE_MEMORY_EXP_PROPERTIES};
-    std::vector<ze_structure_type_t> types = {};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_IMAGE_MEMORY_EXP_PROPERTIES};
+    static const std::vector<ze_structure_type_t> types = {};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -449,8 +484,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_driver_extension_p
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_image_view_planar_ext_desc_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_IMAGE_VIEW_PLANAR_EXT_DESC};
-    std::vector<ze_structure_type_t> types = {};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_IMAGE_VIEW_PLANAR_EXT_DESC};
+    static const std::vector<ze_structure_type_t> types = {};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -459,8 +494,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_image_view_planar_
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(ze_image_view_planar_exp_desc_t *descriptor) {
 
-    std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_IMAGE_VIEW_PLANAR_EXP_DESC};
-    std::vector<ze_structure_type_t> types = {};
+    static const std::vector<ze_structure_type_t> baseTypes = {ZE_STRUCTURE_TYPE_IMAGE_VIEW_PLANAR_EXP_DESC};
+    static const std::vector<ze_structure_type_t> types = {};
 
     return validateStructureTypes<ze_structure_type_t, ze_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -470,8 +505,8 @@ inline ze_result_t ParameterValidation::validateExtensions(ze_image_view_planar_
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zet_metric_group_properties_t *descriptor) {
 
-    std::vector<zet_structure_type_t> baseTypes = {ZET_STRUCTURE_TYPE_METRIC_GROUP_PROPERTIES};
-    std::vector<zet_structure_type_t> types = {ZET_STRUCTURE_TYPE_GLOBAL_METRICS_TIMESTAMPS_EXP_PROPERTIES};
+    static const std::vector<zet_structure_type_t> baseTypes = {ZET_STRUCTURE_TYPE_METRIC_GROUP_PROPERTIES};
+    static const std::vector<zet_structure_type_t> types = {ZET_STRUCTURE_TYPE_GLOBAL_METRICS_TIMESTAMPS_EXP_PROPERTIES};
 
     return validateStructureTypes<zet_structure_type_t, zet_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -479,8 +514,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zet_metric_group_prop
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zet_metric_properties_t *descriptor) {
 
-    std::vector<zet_structure_type_t> baseTypes = {ZET_STRUCTURE_TYPE_METRIC_PROPERTIES};
-    std::vector<zet_structure_type_t> types = {};
+    static const std::vector<zet_structure_type_t> baseTypes = {ZET_STRUCTURE_TYPE_METRIC_PROPERTIES};
+    static const std::vector<zet_structure_type_t> types = {};
 
     return validateStructureTypes<zet_structure_type_t, zet_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -488,8 +523,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zet_metric_properties
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zet_metric_streamer_desc_t *descriptor) {
 
-    std::vector<zet_structure_type_t> baseTypes = {ZET_STRUCTURE_TYPE_METRIC_STREAMER_DESC};
-    std::vector<zet_structure_type_t> types = {};
+    static const std::vector<zet_structure_type_t> baseTypes = {ZET_STRUCTURE_TYPE_METRIC_STREAMER_DESC};
+    static const std::vector<zet_structure_type_t> types = {};
 
     return validateStructureTypes<zet_structure_type_t, zet_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -497,8 +532,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zet_metric_streamer_d
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zet_metric_query_pool_desc_t *descriptor) {
 
-    std::vector<zet_structure_type_t> baseTypes = {ZET_STRUCTURE_TYPE_METRIC_QUERY_POOL_DESC};
-    std::vector<zet_structure_type_t> types = {};
+    static const std::vector<zet_structure_type_t> baseTypes = {ZET_STRUCTURE_TYPE_METRIC_QUERY_POOL_DESC};
+    static const std::vector<zet_structure_type_t> types = {};
 
     return validateStructureTypes<zet_structure_type_t, zet_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -506,8 +541,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zet_metric_query_pool
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zet_profile_properties_t *descriptor) {
 
-    std::vector<zet_structure_type_t> baseTypes = {ZET_STRUCTURE_TYPE_PROFILE_PROPERTIES};
-    std::vector<zet_structure_type_t> types = {};
+    static const std::vector<zet_structure_type_t> baseTypes = {ZET_STRUCTURE_TYPE_PROFILE_PROPERTIES};
+    static const std::vector<zet_structure_type_t> types = {};
 
     return validateStructureTypes<zet_structure_type_t, zet_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -515,8 +550,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zet_profile_propertie
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zet_device_debug_properties_t *descriptor) {
 
-    std::vector<zet_structure_type_t> baseTypes = {ZET_STRUCTURE_TYPE_DEVICE_DEBUG_PROPERTIES};
-    std::vector<zet_structure_type_t> types = {};
+    static const std::vector<zet_structure_type_t> baseTypes = {ZET_STRUCTURE_TYPE_DEVICE_DEBUG_PROPERTIES};
+    static const std::vector<zet_structure_type_t> types = {};
 
     return validateStructureTypes<zet_structure_type_t, zet_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -524,8 +559,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zet_device_debug_prop
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zet_debug_memory_space_desc_t *descriptor) {
 
-    std::vector<zet_structure_type_t> baseTypes = {ZET_STRUCTURE_TYPE_DEBUG_MEMORY_SPACE_DESC};
-    std::vector<zet_structure_type_t> types = {};
+    static const std::vector<zet_structure_type_t> baseTypes = {ZET_STRUCTURE_TYPE_DEBUG_MEMORY_SPACE_DESC};
+    static const std::vector<zet_structure_type_t> types = {};
 
     return validateStructureTypes<zet_structure_type_t, zet_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -537,8 +572,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zet_debug_regset_prop
        return ZE_RESULT_SUCCESS;
      }
 
-    std::vector<zet_structure_type_t> baseTypes = {ZET_STRUCTURE_TYPE_DEBUG_REGSET_PROPERTIES};
-    std::vector<zet_structure_type_t> types = {};
+    static const std::vector<zet_structure_type_t> baseTypes = {ZET_STRUCTURE_TYPE_DEBUG_REGSET_PROPERTIES};
+    static const std::vector<zet_structure_type_t> types = {};
 
     return validateStructureTypes<zet_structure_type_t, zet_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -546,8 +581,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zet_debug_regset_prop
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zet_tracer_exp_desc_t *descriptor) {
 
-    std::vector<zet_structure_type_t> baseTypes = {ZET_STRUCTURE_TYPE_TRACER_EXP_DESC};
-    std::vector<zet_structure_type_t> types = {};
+    static const std::vector<zet_structure_type_t> baseTypes = {ZET_STRUCTURE_TYPE_TRACER_EXP_DESC};
+    static const std::vector<zet_structure_type_t> types = {};
 
     return validateStructureTypes<zet_structure_type_t, zet_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -557,8 +592,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zet_tracer_exp_desc_t
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_device_properties_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_DEVICE_PROPERTIES};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_DEVICE_PROPERTIES};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -566,8 +601,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_device_properties
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_pci_properties_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_PCI_PROPERTIES};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_PCI_PROPERTIES};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -579,8 +614,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_pci_bar_propertie
        return ZE_RESULT_SUCCESS;
      }
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_PCI_BAR_PROPERTIES};
-    std::vector<zes_structure_type_t> types = {ZES_STRUCTURE_TYPE_PCI_BAR_PROPERTIES_1_2};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_PCI_BAR_PROPERTIES};
+    static const std::vector<zes_structure_type_t> types = {ZES_STRUCTURE_TYPE_PCI_BAR_PROPERTIES_1_2};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -588,8 +623,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_pci_bar_propertie
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_diag_properties_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_DIAG_PROPERTIES};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_DIAG_PROPERTIES};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -597,8 +632,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_diag_properties_t
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_engine_properties_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_ENGINE_PROPERTIES};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_ENGINE_PROPERTIES};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -606,8 +641,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_engine_properties
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_fabric_port_properties_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_FABRIC_PORT_PROPERTIES};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_FABRIC_PORT_PROPERTIES};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -615,8 +650,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_fabric_port_prope
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_fan_properties_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_FAN_PROPERTIES};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_FAN_PROPERTIES};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -624,8 +659,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_fan_properties_t
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_firmware_properties_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_FIRMWARE_PROPERTIES};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_FIRMWARE_PROPERTIES};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -633,8 +668,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_firmware_properti
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_freq_properties_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_FREQ_PROPERTIES};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_FREQ_PROPERTIES};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -642,8 +677,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_freq_properties_t
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_led_properties_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_LED_PROPERTIES};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_LED_PROPERTIES};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -651,8 +686,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_led_properties_t
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_mem_properties_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_MEM_PROPERTIES};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_MEM_PROPERTIES};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -660,8 +695,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_mem_properties_t
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_perf_properties_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_PERF_PROPERTIES};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_PERF_PROPERTIES};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -669,9 +704,9 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_perf_properties_t
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_power_properties_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_POWER_PROPERTIES};
-    std::vector<zes_structure_type_t> types = {ZES_STRUCTURE_TYPE_POWER_LIMIT_EXT_DESC,
-                                               ZES_STRUCTURE_TYPE_POWER_EXT_PROPERTIES};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_POWER_PROPERTIES};
+    static const std::vector<zes_structure_type_t> types = {ZES_STRUCTURE_TYPE_POWER_LIMIT_EXT_DESC,
+                                                            ZES_STRUCTURE_TYPE_POWER_EXT_PROPERTIES};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -679,8 +714,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_power_properties_
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_psu_properties_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_PSU_PROPERTIES};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_PSU_PROPERTIES};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -688,8 +723,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_psu_properties_t
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_ras_properties_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_RAS_PROPERTIES};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_RAS_PROPERTIES};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -697,8 +732,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_ras_properties_t
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_sched_properties_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_SCHED_PROPERTIES};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_SCHED_PROPERTIES};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -706,8 +741,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_sched_properties_
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_sched_timeout_properties_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_SCHED_TIMEOUT_PROPERTIES};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_SCHED_TIMEOUT_PROPERTIES};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -715,8 +750,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_sched_timeout_pro
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_sched_timeslice_properties_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_SCHED_TIMESLICE_PROPERTIES};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_SCHED_TIMESLICE_PROPERTIES};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -724,8 +759,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_sched_timeslice_p
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_standby_properties_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_STANDBY_PROPERTIES};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_STANDBY_PROPERTIES};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -733,8 +768,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_standby_propertie
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_temp_properties_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_TEMP_PROPERTIES};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_TEMP_PROPERTIES};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -742,8 +777,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_temp_properties_t
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_device_state_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_DEVICE_STATE};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_DEVICE_STATE};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -755,8 +790,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_process_state_t *
        return ZE_RESULT_SUCCESS;
      }
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_PROCESS_STATE};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_PROCESS_STATE};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -764,8 +799,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_process_state_t *
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_pci_state_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_PCI_STATE};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_PCI_STATE};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -773,8 +808,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_pci_state_t *desc
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_fabric_port_config_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_FABRIC_PORT_CONFIG};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_FABRIC_PORT_CONFIG};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -782,8 +817,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_fabric_port_confi
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_fabric_port_state_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_FABRIC_PORT_STATE};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_FABRIC_PORT_STATE};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -791,8 +826,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_fabric_port_state
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_fan_config_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_FAN_CONFIG};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_FAN_CONFIG};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -800,8 +835,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_fan_config_t *des
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_freq_state_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_FREQ_STATE};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_FREQ_STATE};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -809,8 +844,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_freq_state_t *des
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_oc_capabilities_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_OC_CAPABILITIES};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_OC_CAPABILITIES};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -818,8 +853,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_oc_capabilities_t
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_led_state_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_LED_STATE};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_LED_STATE};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -827,8 +862,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_led_state_t *desc
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_mem_state_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_MEM_STATE};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_MEM_STATE};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -836,8 +871,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_mem_state_t *desc
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_psu_state_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_PSU_STATE};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_PSU_STATE};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -846,8 +881,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_psu_state_t *desc
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_base_state_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_BASE_STATE};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_BASE_STATE};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -855,8 +890,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_base_state_t *des
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_ras_config_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_RAS_CONFIG};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_RAS_CONFIG};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -864,8 +899,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_ras_config_t *des
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_ras_state_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_RAS_STATE};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_RAS_STATE};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -873,8 +908,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_ras_state_t *desc
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_temp_config_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_TEMP_CONFIG};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_TEMP_CONFIG};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -882,8 +917,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_temp_config_t *de
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_device_ecc_desc_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_DEVICE_ECC_DESC};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_DEVICE_ECC_DESC};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -891,8 +926,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_device_ecc_desc_t
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_device_ecc_properties_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_DEVICE_ECC_PROPERTIES};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_DEVICE_ECC_PROPERTIES};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -904,8 +939,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_power_limit_ext_d
        return ZE_RESULT_SUCCESS;
      }
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_POWER_LIMIT_EXT_DESC};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_POWER_LIMIT_EXT_DESC};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
@@ -913,8 +948,8 @@ inline ze_result_t ParameterValidation::validateExtensions(zes_power_limit_ext_d
 template <>
 inline ze_result_t ParameterValidation::validateExtensions(zes_overclock_properties_t *descriptor) {
 
-    std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_OVERCLOCK_PROPERTIES};
-    std::vector<zes_structure_type_t> types = {};
+    static const std::vector<zes_structure_type_t> baseTypes = {ZES_STRUCTURE_TYPE_OVERCLOCK_PROPERTIES};
+    static const std::vector<zes_structure_type_t> types = {};
 
     return validateStructureTypes<zes_structure_type_t, zes_base_properties_t>(descriptor, baseTypes, types);
 }
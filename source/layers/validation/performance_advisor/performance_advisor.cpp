@@ -0,0 +1,361 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include "performance_advisor.h"
+#include "ze_util.h"
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace validation_layer
+{
+    namespace
+    {
+        // Patterns seen fewer times than this are not worth a report.
+        constexpr uint64_t reportThreshold = 8;
+
+        // Bounds the sizes remembered from frees that no allocation reused.
+        constexpr size_t freedSizesLimit = 1024;
+
+        // Submissions since the calling thread last waited on the host.
+        thread_local uint64_t pendingSubmissions = 0;
+
+        struct advice_t {
+            const char *api;
+            const char *pattern;
+            const char *fix;
+        };
+
+        // Indexed by finding_t.
+        const advice_t advice[] = {
+            {"zeCommandQueueSynchronize", "host waits right after a single submission",
+             "submit more command lists per zeCommandQueueExecuteCommandLists and wait once for the batch"},
+            {"zeCommandListHostSynchronize", "host waits right after a single append to an immediate command list",
+             "append the dependent work first and wait once, or chain the commands with events"},
+            {"zeEventHostSynchronize", "host waits on an event right after a single submission",
+             "let the next commands wait on the event on the device, and only wait on the host for results it reads"},
+            {"zeFenceHostSynchronize", "host waits on a fence right after a single submission",
+             "submit more command lists before waiting on the fence"},
+            {"zeCommandListAppendMemoryCopy", "copies smaller than the small copy limit",
+             "pack small buffers into one allocation and copy it at once, or use host or shared memory for small data"},
+            {"zeEventCreate", "events created after others were destroyed",
+             "keep the events and reuse them after zeEventHostReset"},
+            {"zeCommandListCreate", "command lists created after others were destroyed",
+             "keep the command lists and reuse them after zeCommandListReset"},
+            {"zeMemAllocHost", "host allocations of a size that was just freed",
+             "allocate once outside the loop, or sub-allocate from a pool"},
+            {"zeMemAllocDevice", "device allocations of a size that was just freed",
+             "allocate once outside the loop, or sub-allocate from a pool"},
+            {"zeMemAllocShared", "shared allocations of a size that was just freed",
+             "allocate once outside the loop, or sub-allocate from a pool"},
+            {"zeCommandListClose", "command lists recorded again with the same commands after zeCommandListReset",
+             "skip the reset and execute the closed command list again"},
+        };
+    } // namespace
+
+    ///////////////////////////////////////////////////////////////////////////////
+    PerformanceAdvisor::PerformanceAdvisor()
+    {
+        auto limit = getenv_string("ZE_PERFORMANCE_ADVISOR_SMALL_COPY");
+        if (!limit.empty())
+            smallCopyLimit = static_cast<size_t>(strtoull(limit.c_str(), nullptr, 10));
+
+        auto logFile = getenv_string("ZEL_LOADER_LOG_FILE");
+        auto logLevel = getenv_string("ZEL_LOADER_LOGGING_LEVEL");
+        logger = std::make_unique<loader::Logger>("ze_validation_layer", logFile.empty() ? LOADER_LOG_FILE_DEFAULT : logFile,
+                                                  logLevel.empty() ? "warn" : logLevel,
+                                                  getenv_tobool("ZEL_ENABLE_LOADER_LOGGING"));
+    }
+
+    PerformanceAdvisor::~PerformanceAdvisor()
+    {
+        report();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void PerformanceAdvisor::zeCommandQueueExecuteCommandLists( ze_command_queue_handle_t, uint32_t numCommandLists, ze_command_list_handle_t*, ze_fence_handle_t )
+    {
+        submitted(numCommandLists ? 1 : 0);
+    }
+
+    void PerformanceAdvisor::zeCommandQueueSynchronize( ze_command_queue_handle_t, uint64_t )
+    {
+        synchronized(syncAfterQueueSubmit);
+    }
+
+    void PerformanceAdvisor::zeCommandListHostSynchronize( ze_command_list_handle_t, uint64_t )
+    {
+        synchronized(syncAfterListSubmit);
+    }
+
+    void PerformanceAdvisor::zeEventHostSynchronize( ze_event_handle_t, uint64_t )
+    {
+        synchronized(syncOnEventAfterSubmit);
+    }
+
+    void PerformanceAdvisor::zeFenceHostSynchronize( ze_fence_handle_t, uint64_t )
+    {
+        synchronized(syncOnFenceAfterSubmit);
+    }
+
+    void PerformanceAdvisor::submitted(uint32_t count)
+    {
+        pendingSubmissions += count;
+        std::lock_guard<std::mutex> lock(mutex);
+        submissions += count;
+    }
+
+    void PerformanceAdvisor::synchronized(finding_t finding)
+    {
+        bool single = pendingSubmissions == 1;
+        pendingSubmissions = 0;
+        if (single) {
+            std::lock_guard<std::mutex> lock(mutex);
+            counts[finding]++;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void PerformanceAdvisor::zeCommandListCreate( ze_context_handle_t, ze_device_handle_t, const ze_command_list_desc_t*, ze_command_list_handle_t* phCommandList )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        commandLists[*phCommandList] = command_list_t();
+        if (destroyedCommandLists) {
+            destroyedCommandLists--;
+            counts[commandListChurn]++;
+        }
+    }
+
+    void PerformanceAdvisor::zeCommandListCreateImmediate( ze_context_handle_t, ze_device_handle_t, const ze_command_queue_desc_t*, ze_command_list_handle_t* phCommandList )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        command_list_t commandList;
+        commandList.immediate = true;
+        commandLists[*phCommandList] = commandList;
+        if (destroyedCommandLists) {
+            destroyedCommandLists--;
+            counts[commandListChurn]++;
+        }
+    }
+
+    void PerformanceAdvisor::zeCommandListDestroy( ze_command_list_handle_t hCommandList )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        commandLists.erase(hCommandList);
+        destroyedCommandLists++;
+    }
+
+    // A list closed with the same commands as when it was last closed,
+    // after a reset, was recorded again for nothing.
+    void PerformanceAdvisor::zeCommandListClose( ze_command_list_handle_t hCommandList )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto &commandList = commandLists[hCommandList];
+        if (commandList.reset && commandList.commands && commandList.commands == commandList.closedCommands &&
+            commandList.fingerprint == commandList.closedFingerprint)
+            counts[unchangedRecording]++;
+        commandList.closedCommands = commandList.commands;
+        commandList.closedFingerprint = commandList.fingerprint;
+        commandList.reset = false;
+    }
+
+    void PerformanceAdvisor::zeCommandListReset( ze_command_list_handle_t hCommandList )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto &commandList = commandLists[hCommandList];
+        commandList.reset = true;
+        commandList.lastWasSmallCopy = false;
+        commandList.commands = 0;
+        commandList.fingerprint = 0;
+    }
+
+    void PerformanceAdvisor::zeCommandListAppendMemoryCopy( ze_command_list_handle_t hCommandList, void* dstptr, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents )
+    {
+        append(hCommandList, fingerprint("zeCommandListAppendMemoryCopy", dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents),
+               size < smallCopyLimit);
+    }
+
+    // The pattern is copied during the call.
+    void PerformanceAdvisor::zeCommandListAppendMemoryFill( ze_command_list_handle_t hCommandList, void* ptr, const void* pattern, size_t pattern_size, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents )
+    {
+        auto value = fingerprint("zeCommandListAppendMemoryFill", ptr, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents);
+        append(hCommandList, pattern ? foldBytes(value, pattern, pattern_size) : value, false);
+    }
+
+    // The group counts are read from device memory when the kernels run.
+    void PerformanceAdvisor::zeCommandListAppendLaunchKernelIndirect( ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchArgumentsBuffer, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents )
+    {
+        commandListAppend("zeCommandListAppendLaunchKernelIndirect", hCommandList, hKernel,
+                          static_cast<const void *>(pLaunchArgumentsBuffer), hSignalEvent, numWaitEvents, phWaitEvents);
+    }
+
+    void PerformanceAdvisor::zeCommandListAppendLaunchMultipleKernelsIndirect( ze_command_list_handle_t hCommandList, uint32_t numKernels, ze_kernel_handle_t* phKernels, const uint32_t* pCountBuffer, const ze_group_count_t* pLaunchArgumentsBuffer, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents )
+    {
+        commandListAppend("zeCommandListAppendLaunchMultipleKernelsIndirect", hCommandList, numKernels, phKernels,
+                          static_cast<const void *>(pCountBuffer), static_cast<const void *>(pLaunchArgumentsBuffer),
+                          hSignalEvent, numWaitEvents, phWaitEvents);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void PerformanceAdvisor::add( fingerprint_t &fingerprint, ze_kernel_handle_t hKernel )
+    {
+        uint64_t changes = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = kernelChanges.find(hKernel);
+            if (it != kernelChanges.end())
+                changes = it->second;
+        }
+        fingerprint.value = fold(fold(fingerprint.value, hKernel), changes);
+    }
+
+    void PerformanceAdvisor::add( fingerprint_t &fingerprint, ze_kernel_handle_t *phKernels )
+    {
+        for (uint32_t i = 0; phKernels && i < fingerprint.count; ++i)
+            add(fingerprint, phKernels[i]);
+        fingerprint.value = fold(fingerprint.value, phKernels == nullptr);
+    }
+
+    void PerformanceAdvisor::kernelChanged( ze_kernel_handle_t hKernel )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        kernelChanges[hKernel]++;
+    }
+
+    void PerformanceAdvisor::zeKernelDestroy( ze_kernel_handle_t hKernel )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        kernelChanges.erase(hKernel);
+    }
+
+    void PerformanceAdvisor::append(ze_command_list_handle_t hCommandList, uint64_t fingerprint, bool isSmallCopy)
+    {
+        bool immediate;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto &commandList = commandLists[hCommandList];
+            commandList.commands++;
+            commandList.fingerprint = fold(commandList.fingerprint, fingerprint);
+            if (isSmallCopy) {
+                counts[smallCopy]++;
+                if (commandList.lastWasSmallCopy)
+                    smallCopiesInARow++;
+            }
+            commandList.lastWasSmallCopy = isSmallCopy;
+            immediate = commandList.immediate;
+        }
+        if (immediate)
+            submitted(1);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void PerformanceAdvisor::zeEventCreate( ze_event_pool_handle_t, const ze_event_desc_t*, ze_event_handle_t* )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (destroyedEvents) {
+            destroyedEvents--;
+            counts[eventChurn]++;
+        }
+    }
+
+    void PerformanceAdvisor::zeEventDestroy( ze_event_handle_t )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        destroyedEvents++;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void PerformanceAdvisor::zeMemAllocShared( ze_context_handle_t, const ze_device_mem_alloc_desc_t*, const ze_host_mem_alloc_desc_t*, size_t size, size_t, ze_device_handle_t, void** pptr )
+    {
+        allocated(allocation_type_t::shared, size, pptr);
+    }
+
+    void PerformanceAdvisor::zeMemAllocDevice( ze_context_handle_t, const ze_device_mem_alloc_desc_t*, size_t size, size_t, ze_device_handle_t, void** pptr )
+    {
+        allocated(allocation_type_t::device, size, pptr);
+    }
+
+    void PerformanceAdvisor::zeMemAllocHost( ze_context_handle_t, const ze_host_mem_alloc_desc_t*, size_t size, size_t, void** pptr )
+    {
+        allocated(allocation_type_t::host, size, pptr);
+    }
+
+    // An allocation of a size freed earlier, and not reused since, could
+    // have kept the freed memory.
+    void PerformanceAdvisor::allocated(allocation_type_t type, size_t size, void **pptr)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        allocations[*pptr] = std::make_pair(type, size);
+        auto &freed = freedSizes[static_cast<size_t>(type)];
+        auto it = freed.find(size);
+        if (it == freed.end())
+            return;
+        if (--it->second == 0)
+            freed.erase(it);
+        counts[hostAllocationChurn + static_cast<int>(type)]++;
+    }
+
+    void PerformanceAdvisor::zeMemFree( ze_context_handle_t, void* ptr )
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = allocations.find(ptr);
+        if (it == allocations.end())
+            return;
+        auto &freed = freedSizes[static_cast<size_t>(it->second.first)];
+        if (freed.size() < freedSizesLimit || freed.count(it->second.second))
+            freed[it->second.second]++;
+        allocations.erase(it);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void PerformanceAdvisor::report()
+    {
+        std::vector<finding_t> findings;
+        for (int finding = 0; finding < findingCount; ++finding) {
+            if (counts[finding] < reportThreshold)
+                continue;
+            // Waiting after a few of many submissions is not a pattern.
+            if (finding <= syncOnFenceAfterSubmit && counts[finding] * 2 < submissions)
+                continue;
+            findings.push_back(static_cast<finding_t>(finding));
+        }
+        std::stable_sort(findings.begin(), findings.end(),
+                         [this](finding_t a, finding_t b) { return counts[a] > counts[b]; });
+
+        std::vector<std::string> lines;
+        char line[512];
+        for (size_t rank = 0; rank < findings.size(); ++rank) {
+            auto finding = findings[rank];
+            if (finding == smallCopy)
+                snprintf(line, sizeof(line), "%zu. %s: %" PRIu64 " %s of %zu bytes, %" PRIu64 " of them right after another in the same command list",
+                         rank + 1, advice[finding].api, counts[finding], advice[finding].pattern, smallCopyLimit, smallCopiesInARow);
+            else if (finding <= syncOnFenceAfterSubmit)
+                snprintf(line, sizeof(line), "%zu. %s: %" PRIu64 " %s, out of %" PRIu64 " submissions",
+                         rank + 1, advice[finding].api, counts[finding], advice[finding].pattern, submissions);
+            else
+                snprintf(line, sizeof(line), "%zu. %s: %" PRIu64 " %s",
+                         rank + 1, advice[finding].api, counts[finding], advice[finding].pattern);
+            lines.push_back(line);
+            snprintf(line, sizeof(line), "   Suggestion: %s", advice[finding].fix);
+            lines.push_back(line);
+        }
+        if (lines.empty())
+            return;
+
+        lines.insert(lines.begin(), "Performance advisor report, most frequent first:");
+        for (auto &text : lines) {
+            if (logger->logging_enabled)
+                logger->log_warning(text);
+            else
+                fprintf(stderr, "%s\n", text.c_str());
+        }
+    }
+
+} // namespace validation_layer
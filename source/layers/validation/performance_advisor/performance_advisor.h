@@ -0,0 +1,191 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#pragma once
+
+#include "ze_api.h"
+#include "logging.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+
+namespace validation_layer
+{
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Watches successful calls for host side patterns that waste time rather
+    // than break the application: waiting on the host after every
+    // submission, copies too small to be worth a command, events, command
+    // lists and allocations destroyed and created again in a loop, and
+    // command lists recorded again with the same commands. Nothing is
+    // rejected; the patterns seen often enough are reported when the layer
+    // is unloaded, ranked by how many calls they cost, with a suggested fix.
+    class PerformanceAdvisor {
+    public:
+        PerformanceAdvisor();
+        ~PerformanceAdvisor();
+
+        // Called after the driver call succeeded.
+        void zeCommandQueueExecuteCommandLists( ze_command_queue_handle_t hCommandQueue, uint32_t numCommandLists, ze_command_list_handle_t* phCommandLists, ze_fence_handle_t hFence );
+        void zeCommandQueueSynchronize( ze_command_queue_handle_t hCommandQueue, uint64_t timeout );
+        void zeCommandListHostSynchronize( ze_command_list_handle_t hCommandList, uint64_t timeout );
+        void zeEventHostSynchronize( ze_event_handle_t hEvent, uint64_t timeout );
+        void zeFenceHostSynchronize( ze_fence_handle_t hFence, uint64_t timeout );
+        void zeCommandListCreate( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_list_desc_t* desc, ze_command_list_handle_t* phCommandList );
+        void zeCommandListCreateImmediate( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_queue_desc_t* altdesc, ze_command_list_handle_t* phCommandList );
+        void zeCommandListDestroy( ze_command_list_handle_t hCommandList );
+        void zeCommandListClose( ze_command_list_handle_t hCommandList );
+        void zeCommandListReset( ze_command_list_handle_t hCommandList );
+        void zeCommandListAppendMemoryCopy( ze_command_list_handle_t hCommandList, void* dstptr, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents );
+        void zeEventCreate( ze_event_pool_handle_t hEventPool, const ze_event_desc_t* desc, ze_event_handle_t* phEvent );
+        void zeEventDestroy( ze_event_handle_t hEvent );
+        void zeMemAllocShared( ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr );
+        void zeMemAllocDevice( ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr );
+        void zeMemAllocHost( ze_context_handle_t hContext, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, void** pptr );
+        void zeMemFree( ze_context_handle_t hContext, void* ptr );
+        void zeCommandListAppendMemoryFill( ze_command_list_handle_t hCommandList, void* ptr, const void* pattern, size_t pattern_size, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents );
+        void zeCommandListAppendLaunchKernelIndirect( ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchArgumentsBuffer, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents );
+        void zeCommandListAppendLaunchMultipleKernelsIndirect( ze_command_list_handle_t hCommandList, uint32_t numKernels, ze_kernel_handle_t* phKernels, const uint32_t* pCountBuffer, const ze_group_count_t* pLaunchArgumentsBuffer, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents );
+        void zeKernelDestroy( ze_kernel_handle_t hKernel );
+
+        // Any other append: the arguments are folded into the fingerprint
+        // of what the command list records.
+        template <typename... Args>
+        void commandListAppend( const char *api, ze_command_list_handle_t hCommandList, Args... args )
+        {
+            append(hCommandList, fingerprint(api, args...), false);
+        }
+
+        // Any call that sets arguments or other launch state of a kernel.
+        void kernelChanged( ze_kernel_handle_t hKernel );
+
+    private:
+        enum finding_t {
+            syncAfterQueueSubmit,
+            syncAfterListSubmit,
+            syncOnEventAfterSubmit,
+            syncOnFenceAfterSubmit,
+            smallCopy,
+            eventChurn,
+            commandListChurn,
+            hostAllocationChurn,
+            deviceAllocationChurn,
+            sharedAllocationChurn,
+            unchangedRecording,
+            findingCount
+        };
+
+        enum class allocation_type_t : uint8_t { host, device, shared };
+
+        struct command_list_t {
+            bool immediate = false;
+            bool reset = false;
+            bool lastWasSmallCopy = false;
+            uint32_t commands = 0;
+            uint64_t fingerprint = 0;
+            uint32_t closedCommands = 0;
+            uint64_t closedFingerprint = 0;
+        };
+
+        // Only the bits of the value are used; handles, pointers and the
+        // scalar arguments of the appends all fit in 64 bits.
+        template <typename T> static uint64_t fold(uint64_t fingerprint, T value)
+        {
+            static_assert(std::is_trivially_copyable<T>::value && sizeof(T) <= sizeof(uint64_t),
+                          "append arguments are scalars or pointers");
+            uint64_t bits = 0;
+            memcpy(&bits, &value, sizeof(T));
+            return (fingerprint ^ bits) * 0x100000001b3ull + 0x9e3779b97f4a7c15ull;
+        }
+
+        static uint64_t foldBytes(uint64_t fingerprint, const void *data, size_t size)
+        {
+            auto bytes = static_cast<const uint8_t *>(data);
+            for (size_t offset = 0; offset < size; offset += sizeof(uint64_t)) {
+                uint64_t bits = 0;
+                memcpy(&bits, bytes + offset, std::min(sizeof(uint64_t), size - offset));
+                fingerprint = fold(fingerprint, bits);
+            }
+            return fingerprint;
+        }
+
+        // The fingerprint of an append. The commands record what the
+        // arguments in host memory hold during the call, so the arrays
+        // that follow a count are folded by value for that count, and so
+        // are regions and group counts. Other pointers are device or shared
+        // memory the commands use and are folded by address. A kernel is
+        // folded with the number of times its state was set, as the
+        // arguments it is launched with are set on the kernel beforehand.
+        struct fingerprint_t {
+            uint64_t value;
+            uint32_t count;
+        };
+
+        template <typename... Args> uint64_t fingerprint(const char *api, Args... args)
+        {
+            fingerprint_t fingerprint = {reinterpret_cast<uintptr_t>(api), 0};
+            int unpack[] = {0, (add(fingerprint, args), 0)...};
+            (void)unpack;
+            return fingerprint.value;
+        }
+
+        template <typename T> static void add(fingerprint_t &fingerprint, T value)
+        {
+            fingerprint.value = fold(fingerprint.value, value);
+        }
+
+        template <typename T> static void addArray(fingerprint_t &fingerprint, const T *values)
+        {
+            fingerprint.value = values ? foldBytes(fingerprint.value, values, fingerprint.count * sizeof(T))
+                                       : fold(fingerprint.value, values);
+        }
+
+        template <typename T> static void addStruct(fingerprint_t &fingerprint, const T *value)
+        {
+            fingerprint.value = value ? foldBytes(fingerprint.value, value, sizeof(T)) : fold(fingerprint.value, value);
+        }
+
+        static void add(fingerprint_t &fingerprint, uint32_t count)
+        {
+            fingerprint.count = count;
+            fingerprint.value = fold(fingerprint.value, count);
+        }
+        static void add(fingerprint_t &fingerprint, ze_event_handle_t *phEvents) { addArray(fingerprint, phEvents); }
+        static void add(fingerprint_t &fingerprint, const size_t *sizes) { addArray(fingerprint, sizes); }
+        static void add(fingerprint_t &fingerprint, const void **pointers) { addArray(fingerprint, pointers); }
+        static void add(fingerprint_t &fingerprint, const ze_copy_region_t *region) { addStruct(fingerprint, region); }
+        static void add(fingerprint_t &fingerprint, const ze_image_region_t *region) { addStruct(fingerprint, region); }
+        static void add(fingerprint_t &fingerprint, const ze_group_count_t *groupCount) { addStruct(fingerprint, groupCount); }
+        void add(fingerprint_t &fingerprint, ze_kernel_handle_t hKernel);
+        void add(fingerprint_t &fingerprint, ze_kernel_handle_t *phKernels);
+
+        void append(ze_command_list_handle_t hCommandList, uint64_t fingerprint, bool isSmallCopy);
+        void submitted(uint32_t count);
+        void synchronized(finding_t finding);
+        void allocated(allocation_type_t type, size_t size, void **pptr);
+        void report();
+
+        std::mutex mutex;
+        uint64_t counts[findingCount] = {};
+        uint64_t submissions = 0;
+        uint64_t smallCopiesInARow = 0;
+        uint64_t destroyedEvents = 0;
+        uint64_t destroyedCommandLists = 0;
+        size_t smallCopyLimit = 4096;
+        std::unordered_map<ze_command_list_handle_t, command_list_t> commandLists;
+        // The number of calls that set the state of each kernel.
+        std::unordered_map<ze_kernel_handle_t, uint64_t> kernelChanges;
+        std::unordered_map<void *, std::pair<allocation_type_t, size_t>> allocations;
+        std::unordered_map<size_t, uint32_t> freedSizes[3];
+        std::unique_ptr<loader::Logger> logger;
+    };
+
+} // namespace validation_layer
@@ -0,0 +1,91 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include "validation_sampler.h"
+#include "ze_util.h"
+#include <chrono>
+#include <cstdlib>
+
+namespace validation_layer
+{
+    namespace
+    {
+        // Power of two above the number of APIs.
+        constexpr size_t apiSlots = 1024;
+
+        // Zero initialized, so the thread_local needs no constructor. APIs
+        // are keyed by the address of their name literal.
+        struct thread_state_t {
+            const char *apis[apiSlots];
+            uint64_t calls[apiSlots];
+            uint64_t random;
+        };
+        thread_local thread_state_t threadState;
+
+        uint64_t mix(uint64_t x)
+        {
+            x ^= x >> 30;
+            x *= 0xbf58476d1ce4e5b9ull;
+            x ^= x >> 27;
+            x *= 0x94d049bb133111ebull;
+            x ^= x >> 31;
+            return x;
+        }
+
+        uint64_t getenv_count(const char *name)
+        {
+            auto value = getenv_string(name);
+            if (value.empty())
+                return 0;
+            char *end = nullptr;
+            auto count = strtoull(value.c_str(), &end, 10);
+            return *end == '\0' ? count : 0;
+        }
+    } // namespace
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ValidationSampler::ValidationSampler()
+    {
+        firstCalls = getenv_count("ZE_VALIDATION_SAMPLE_FIRST");
+        callRate = getenv_count("ZE_VALIDATION_SAMPLE_RATE");
+        handleRate = getenv_count("ZE_VALIDATION_SAMPLE_HANDLES");
+        enabled = firstCalls || callRate || handleRate;
+        // A different subset of handles is chosen on every run.
+        seed = mix(static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count()));
+    }
+
+    bool ValidationSampler::select(const char *api, const void *handle)
+    {
+        if (handleRate) {
+            if (handle == nullptr || mix(reinterpret_cast<uintptr_t>(handle) ^ seed) % handleRate == 0)
+                return true;
+        }
+
+        auto &state = threadState;
+        if (firstCalls) {
+            auto i = mix(reinterpret_cast<uintptr_t>(api)) & (apiSlots - 1);
+            while (state.apis[i] != api && state.apis[i] != nullptr)
+                i = (i + 1) & (apiSlots - 1);
+            state.apis[i] = api;
+            if (state.calls[i] < firstCalls) {
+                state.calls[i]++;
+                return true;
+            }
+        }
+
+        if (callRate) {
+            if (state.random == 0)
+                state.random = mix(seed ^ reinterpret_cast<uintptr_t>(&state)) | 1;
+            state.random ^= state.random << 13;
+            state.random ^= state.random >> 7;
+            state.random ^= state.random << 17;
+            return state.random % callRate == 0;
+        }
+        return false;
+    }
+
+} // namespace validation_layer
@@ -0,0 +1,41 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace validation_layer
+{
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Chooses the calls that get parameter validation, so it can stay on in
+    // production at a fraction of its cost. A call is validated when any of
+    // the configured policies selects it:
+    //   - the first N calls of each API on the calling thread,
+    //   - a random 1 in N calls,
+    //   - every call on a random 1 in N subset of handles, keyed by the first
+    //     argument; calls that do not take a handle first are always chosen.
+    // Counters and random state are per thread, so the decision takes no
+    // atomics or locks. Without a policy every call is validated.
+    class ValidationSampler {
+    public:
+        ValidationSampler();
+
+        bool sample(const char *api, const void *handle) { return !enabled || select(api, handle); }
+
+    private:
+        bool select(const char *api, const void *handle);
+
+        bool enabled = false;
+        uint64_t firstCalls = 0;
+        uint64_t callRate = 0;
+        uint64_t handleRate = 0;
+        uint64_t seed = 0;
+    };
+
+} // namespace validation_layer
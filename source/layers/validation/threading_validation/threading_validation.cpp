@@ -0,0 +1,228 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#include "threading_validation.h"
+#include <cinttypes>
+#include <cstdio>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace validation_layer
+{
+    namespace
+    {
+        std::atomic<uint64_t> nextThreadTag{1};
+        thread_local uint64_t threadTag = 0;
+        thread_local uint64_t osThreadId = 0;
+
+        uint64_t getThreadTag()
+        {
+            if (threadTag == 0) {
+                threadTag = nextThreadTag++;
+#if defined(_WIN32)
+                osThreadId = GetCurrentThreadId();
+#else
+                osThreadId = static_cast<uint64_t>(syscall(SYS_gettid));
+#endif
+            }
+            return threadTag;
+        }
+
+        uint64_t hashHandle(uintptr_t handle)
+        {
+            uint64_t h = static_cast<uint64_t>(handle);
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdull;
+            h ^= h >> 33;
+            return h;
+        }
+    } // namespace
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ThreadingValidation::ThreadingValidation() : slots(new slot_t[tableSize]) {}
+
+    ThreadingValidation::~ThreadingValidation()
+    {
+        if (conflicts)
+            fprintf(stderr, "Threading validation detected %" PRIu64 " conflicting calls\n", conflicts.load());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Handles already in the table are found without a lock. The slot of a
+    // new handle is claimed under the table lock, and so are slots freed,
+    // so no slot changes while another thread claims one: a handle is
+    // added once, to the first tombstone or empty slot of its chain.
+    ThreadingValidation::slot_t *ThreadingValidation::find(const void *handle)
+    {
+        auto key = reinterpret_cast<uintptr_t>(handle);
+        auto slot = lookup(key);
+        if (slot != nullptr)
+            return slot;
+
+        std::lock_guard<std::mutex> lock(tableMutex);
+        auto mask = tableSize - 1;
+        slot_t *free = nullptr;
+        auto index = hashHandle(key) & mask;
+        for (size_t probe = 0; probe < tableSize; probe++, index = (index + 1) & mask) {
+            auto current = slots[index].handle.load(std::memory_order_relaxed);
+            if (current == key)
+                return &slots[index];
+            if ((current == 0 || current == tombstone) && free == nullptr)
+                free = &slots[index];
+            if (current == 0)
+                break;
+        }
+
+        if (free == nullptr) {
+            if (!overflowReported.exchange(true))
+                fprintf(stderr, "Threading validation table is full, new handles are not checked\n");
+            return nullptr;
+        }
+        free->handle.store(key, std::memory_order_release);
+        return free;
+    }
+
+    ThreadingValidation::slot_t *ThreadingValidation::lookup(uintptr_t key)
+    {
+        auto mask = tableSize - 1;
+        auto index = hashHandle(key) & mask;
+        for (size_t probe = 0; probe < tableSize; probe++, index = (index + 1) & mask) {
+            auto current = slots[index].handle.load(std::memory_order_acquire);
+            if (current == key)
+                return &slots[index];
+            if (current == 0)
+                break;
+        }
+        return nullptr;
+    }
+
+    // A tombstone followed by an empty slot ends every chain through it, so
+    // it is emptied, and so are the tombstones before it, which keeps
+    // lookups of new handles from probing through the whole table. This is
+    // done under the table lock: a slot claimed after the empty slot was
+    // read would otherwise be cut off from the start of its chain.
+    void ThreadingValidation::retire(slot_t *slot)
+    {
+        std::lock_guard<std::mutex> lock(tableMutex);
+        auto mask = tableSize - 1;
+        auto index = static_cast<size_t>(slot - slots.get());
+        slot->handle.store(tombstone, std::memory_order_release);
+        while (slots[(index + 1) & mask].handle.load(std::memory_order_relaxed) == 0 &&
+               slots[index].handle.load(std::memory_order_relaxed) == tombstone) {
+            slots[index].handle.store(0, std::memory_order_release);
+            index = (index - 1) & mask;
+        }
+    }
+
+    void ThreadingValidation::report(const void *handle, const char *type, const char *api, slot_t *slot, uint64_t owner)
+    {
+        conflicts++;
+        auto otherApi = slot->api.load(std::memory_order_relaxed);
+        auto otherThread = slot->threadId.load(std::memory_order_relaxed);
+        fprintf(stderr,
+                "Threading validation: %s on thread %" PRIu64 " uses %s %p while %s on thread %" PRIu64 "%s\n",
+                api, osThreadId, type, handle, otherApi ? otherApi : "another call", otherThread,
+                (owner & writerBit) ? " has exclusive access" : " is using it");
+    }
+
+    ThreadingValidation::slot_t *ThreadingValidation::acquireExclusive(const void *handle, const char *type,
+                                                                      const char *api, bool &nested)
+    {
+        nested = false;
+        if (handle == nullptr)
+            return nullptr;
+        auto tag = writerBit | getThreadTag();
+        auto slot = find(handle);
+        if (slot == nullptr)
+            return nullptr;
+
+        uint64_t expected = 0;
+        if (!slot->owner.compare_exchange_strong(expected, tag, std::memory_order_acquire)) {
+            // Calls made from within a call on the same thread (for example
+            // from a tracing callback) are not conflicts.
+            if (expected == tag) {
+                nested = true;
+                return slot;
+            }
+            report(handle, type, api, slot, expected);
+            return nullptr;
+        }
+        slot->threadId.store(osThreadId, std::memory_order_relaxed);
+        slot->api.store(api, std::memory_order_relaxed);
+        return slot;
+    }
+
+    ThreadingValidation::slot_t *ThreadingValidation::acquireShared(const void *handle, const char *type,
+                                                                   const char *api)
+    {
+        if (handle == nullptr)
+            return nullptr;
+        auto tag = writerBit | getThreadTag();
+        auto slot = find(handle);
+        if (slot == nullptr)
+            return nullptr;
+
+        auto current = slot->owner.load(std::memory_order_relaxed);
+        do {
+            if (current & writerBit) {
+                if (current != tag)
+                    report(handle, type, api, slot, current);
+                return nullptr;
+            }
+        } while (!slot->owner.compare_exchange_weak(current, current + 1, std::memory_order_acquire));
+        slot->threadId.store(osThreadId, std::memory_order_relaxed);
+        slot->api.store(api, std::memory_order_relaxed);
+        return slot;
+    }
+
+    void ThreadingValidation::releaseExclusive(slot_t *slot)
+    {
+        slot->owner.store(0, std::memory_order_release);
+    }
+
+    void ThreadingValidation::releaseShared(slot_t *slot)
+    {
+        slot->owner.fetch_sub(1, std::memory_order_release);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ThreadingGuard::~ThreadingGuard()
+    {
+        if (exclusiveSlot) {
+            validation->releaseExclusive(exclusiveSlot);
+            if (retired)
+                validation->retire(exclusiveSlot);
+        }
+        if (sharedSlot)
+            validation->releaseShared(sharedSlot);
+    }
+
+    // The guard has no validation object when the check was turned on at
+    // runtime after the call started.
+    void ThreadingGuard::exclusive(const void *handle, const char *type, const char *api)
+    {
+        if (validation == nullptr)
+            return;
+        bool nested = false;
+        auto slot = validation->acquireExclusive(handle, type, api, nested);
+        if (!nested)
+            exclusiveSlot = slot;
+    }
+
+    void ThreadingGuard::shared(ze_kernel_handle_t handle, const char *api)
+    {
+        if (validation == nullptr)
+            return;
+        sharedSlot = validation->acquireShared(handle, "kernel", api);
+    }
+
+} // namespace validation_layer
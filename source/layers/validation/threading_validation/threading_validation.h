@@ -0,0 +1,89 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#pragma once
+
+#include "ze_api.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+namespace validation_layer
+{
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Detects concurrent use of handles that the specification requires the
+    // application to synchronize (command lists and kernels). Every handle
+    // gets a slot in a fixed-size table holding an atomic owner tag: a
+    // writer bit plus the owning thread for exclusive use, or a count for
+    // shared use. Slots are looked up without a lock, and only adding or
+    // freeing one takes the table lock. Acquiring a handle is a single
+    // compare-exchange; a failed exchange means another thread is inside a
+    // call on the same handle and is reported to stderr. The call itself is
+    // not blocked.
+    class ThreadingValidation {
+    public:
+        struct slot_t {
+            std::atomic<uintptr_t> handle{0};
+            std::atomic<uint64_t> owner{0};
+            std::atomic<uint64_t> threadId{0};
+            std::atomic<const char *> api{nullptr};
+        };
+
+        ThreadingValidation();
+        ~ThreadingValidation();
+
+        // Returns nullptr on conflict (after reporting it), or when the
+        // table is full, in which case the handle is not checked.
+        slot_t *acquireExclusive(const void *handle, const char *type, const char *api, bool &nested);
+        slot_t *acquireShared(const void *handle, const char *type, const char *api);
+        void releaseExclusive(slot_t *slot);
+        void releaseShared(slot_t *slot);
+        // Frees the slot of a destroyed handle for other handles.
+        void retire(slot_t *slot);
+
+    private:
+        static constexpr size_t tableSize = 1 << 16;
+        static constexpr uint64_t writerBit = 1ull << 63;
+        // Marks a freed slot that lookups must probe past.
+        static constexpr uintptr_t tombstone = ~static_cast<uintptr_t>(0);
+
+        slot_t *find(const void *handle);
+        slot_t *lookup(uintptr_t key);
+        void report(const void *handle, const char *type, const char *api, slot_t *slot, uint64_t owner);
+
+        std::unique_ptr<slot_t[]> slots;
+        std::mutex tableMutex;
+        std::atomic<uint64_t> conflicts{0};
+        std::atomic<bool> overflowReported{false};
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Holds the handles of one API call for the duration of the call.
+    class ThreadingGuard {
+    public:
+        explicit ThreadingGuard(ThreadingValidation *validation) : validation(validation) {}
+        ~ThreadingGuard();
+
+        void exclusive(ze_command_list_handle_t handle, const char *api) { exclusive(handle, "command list", api); }
+        void exclusive(ze_kernel_handle_t handle, const char *api) { exclusive(handle, "kernel", api); }
+        void shared(ze_kernel_handle_t handle, const char *api);
+        // Frees the slot of the exclusive handle once the call returns,
+        // after the handle was destroyed.
+        void retire() { retired = true; }
+
+    private:
+        void exclusive(const void *handle, const char *type, const char *api);
+
+        ThreadingValidation *validation;
+        ThreadingValidation::slot_t *exclusiveSlot = nullptr;
+        ThreadingValidation::slot_t *sharedSlot = nullptr;
+        bool retired = false;
+    };
+
+} // namespace validation_layer
@@ -26,17 +26,14 @@ namespace validation_layer
         if( nullptr == pfnInit )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeInit", nullptr ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeInit( flags );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeInit( flags );
@@ -44,6 +41,13 @@ namespace validation_layer
         }
 
         auto result = pfnInit( flags );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeInit", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeInit( flags );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -66,17 +70,14 @@ namespace validation_layer
         if( nullptr == pfnGet )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDriverGet", nullptr ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDriverGet( pCount, phDrivers );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverGet( pCount, phDrivers );
@@ -85,6 +86,22 @@ namespace validation_layer
 
         auto result = pfnGet( pCount, phDrivers );
 
+        if( context.enableAsyncValidation ){
+            auto phDriversCopy = AsyncValidation::copy( phDrivers, ( result == ZE_RESULT_SUCCESS && nullptr != phDrivers ) ? *pCount : 0 );
+            context.asyncValidation->submit( "zeDriverGet", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDriverGet( pCount, phDrivers );
+                if( result == ZE_RESULT_SUCCESS ){
+                    for (size_t i = 0; i < phDriversCopy.size(); ++i){
+                        if (phDriversCopy[i]){
+                            context.handleLifetime->addHandle( phDriversCopy[i] );
+                            context.handleLifetime->addDependent( pCount, phDriversCopy[i] );
+                        }
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             for (size_t i = 0; ( nullptr != phDrivers) && (i < *pCount); ++i){
@@ -110,17 +127,14 @@ namespace validation_layer
         if( nullptr == pfnGetApiVersion )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDriverGetApiVersion", hDriver ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDriverGetApiVersion( hDriver, version );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverGetApiVersion( hDriver, version );
@@ -128,6 +142,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetApiVersion( hDriver, version );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeDriverGetApiVersion", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDriverGetApiVersion( hDriver, version );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -144,17 +165,14 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDriverGetProperties", hDriver ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDriverGetProperties( hDriver, pDriverProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverGetProperties( hDriver, pDriverProperties );
@@ -162,6 +180,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetProperties( hDriver, pDriverProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeDriverGetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDriverGetProperties( hDriver, pDriverProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -178,17 +203,14 @@ namespace validation_layer
         if( nullptr == pfnGetIpcProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDriverGetIpcProperties", hDriver ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDriverGetIpcProperties( hDriver, pIpcProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverGetIpcProperties( hDriver, pIpcProperties );
@@ -196,6 +218,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetIpcProperties( hDriver, pIpcProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeDriverGetIpcProperties", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDriverGetIpcProperties( hDriver, pIpcProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -221,17 +250,14 @@ namespace validation_layer
         if( nullptr == pfnGetExtensionProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDriverGetExtensionProperties", hDriver ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDriverGetExtensionProperties( hDriver, pCount, pExtensionProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverGetExtensionProperties( hDriver, pCount, pExtensionProperties );
@@ -239,6 +265,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetExtensionProperties( hDriver, pCount, pExtensionProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeDriverGetExtensionProperties", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDriverGetExtensionProperties( hDriver, pCount, pExtensionProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -256,17 +289,14 @@ namespace validation_layer
         if( nullptr == pfnGetExtensionFunctionAddress )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDriverGetExtensionFunctionAddress", hDriver ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDriverGetExtensionFunctionAddress( hDriver, name, ppFunctionAddress );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverGetExtensionFunctionAddress( hDriver, name, ppFunctionAddress );
@@ -274,6 +304,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetExtensionFunctionAddress( hDriver, name, ppFunctionAddress );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeDriverGetExtensionFunctionAddress", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDriverGetExtensionFunctionAddress( hDriver, name, ppFunctionAddress );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -291,17 +328,14 @@ namespace validation_layer
         if( nullptr == pfnGetLastErrorDescription )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDriverGetLastErrorDescription", hDriver ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDriverGetLastErrorDescription( hDriver, ppString );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverGetLastErrorDescription( hDriver, ppString );
@@ -309,6 +343,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetLastErrorDescription( hDriver, ppString );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeDriverGetLastErrorDescription", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDriverGetLastErrorDescription( hDriver, ppString );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -332,17 +373,14 @@ namespace validation_layer
         if( nullptr == pfnGet )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDeviceGet", hDriver ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDeviceGet( hDriver, pCount, phDevices );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGet( hDriver, pCount, phDevices );
@@ -351,6 +389,22 @@ namespace validation_layer
 
         auto result = pfnGet( hDriver, pCount, phDevices );
 
+        if( context.enableAsyncValidation ){
+            auto phDevicesCopy = AsyncValidation::copy( phDevices, ( result == ZE_RESULT_SUCCESS && nullptr != phDevices ) ? *pCount : 0 );
+            context.asyncValidation->submit( "zeDeviceGet", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDeviceGet( hDriver, pCount, phDevices );
+                if( result == ZE_RESULT_SUCCESS ){
+                    for (size_t i = 0; i < phDevicesCopy.size(); ++i){
+                        if (phDevicesCopy[i]){
+                            context.handleLifetime->addHandle( phDevicesCopy[i] );
+                            context.handleLifetime->addDependent( hDriver, phDevicesCopy[i] );
+                        }
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             for (size_t i = 0; ( nullptr != phDevices) && (i < *pCount); ++i){
@@ -376,17 +430,14 @@ namespace validation_layer
         if( nullptr == pfnGetRootDevice )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDeviceGetRootDevice", hDevice ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDeviceGetRootDevice( hDevice, phRootDevice );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetRootDevice( hDevice, phRootDevice );
@@ -394,6 +445,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetRootDevice( hDevice, phRootDevice );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeDeviceGetRootDevice", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDeviceGetRootDevice( hDevice, phRootDevice );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -417,17 +475,14 @@ namespace validation_layer
         if( nullptr == pfnGetSubDevices )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDeviceGetSubDevices", hDevice ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDeviceGetSubDevices( hDevice, pCount, phSubdevices );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetSubDevices( hDevice, pCount, phSubdevices );
@@ -436,6 +491,22 @@ namespace validation_layer
 
         auto result = pfnGetSubDevices( hDevice, pCount, phSubdevices );
 
+        if( context.enableAsyncValidation ){
+            auto phSubdevicesCopy = AsyncValidation::copy( phSubdevices, ( result == ZE_RESULT_SUCCESS && nullptr != phSubdevices ) ? *pCount : 0 );
+            context.asyncValidation->submit( "zeDeviceGetSubDevices", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDeviceGetSubDevices( hDevice, pCount, phSubdevices );
+                if( result == ZE_RESULT_SUCCESS ){
+                    for (size_t i = 0; i < phSubdevicesCopy.size(); ++i){
+                        if (phSubdevicesCopy[i]){
+                            context.handleLifetime->addHandle( phSubdevicesCopy[i] );
+                            context.handleLifetime->addDependent( hDevice, phSubdevicesCopy[i] );
+                        }
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             for (size_t i = 0; ( nullptr != phSubdevices) && (i < *pCount); ++i){
@@ -461,17 +532,14 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDeviceGetProperties", hDevice ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDeviceGetProperties( hDevice, pDeviceProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetProperties( hDevice, pDeviceProperties );
@@ -479,6 +547,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetProperties( hDevice, pDeviceProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeDeviceGetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDeviceGetProperties( hDevice, pDeviceProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -495,17 +570,14 @@ namespace validation_layer
         if( nullptr == pfnGetComputeProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDeviceGetComputeProperties", hDevice ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDeviceGetComputeProperties( hDevice, pComputeProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetComputeProperties( hDevice, pComputeProperties );
@@ -513,6 +585,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetComputeProperties( hDevice, pComputeProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeDeviceGetComputeProperties", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDeviceGetComputeProperties( hDevice, pComputeProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -529,17 +608,14 @@ namespace validation_layer
         if( nullptr == pfnGetModuleProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDeviceGetModuleProperties", hDevice ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDeviceGetModuleProperties( hDevice, pModuleProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetModuleProperties( hDevice, pModuleProperties );
@@ -547,6 +623,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetModuleProperties( hDevice, pModuleProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeDeviceGetModuleProperties", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDeviceGetModuleProperties( hDevice, pModuleProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -573,17 +656,14 @@ namespace validation_layer
         if( nullptr == pfnGetCommandQueueGroupProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDeviceGetCommandQueueGroupProperties", hDevice ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDeviceGetCommandQueueGroupProperties( hDevice, pCount, pCommandQueueGroupProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetCommandQueueGroupProperties( hDevice, pCount, pCommandQueueGroupProperties );
@@ -591,6 +671,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetCommandQueueGroupProperties( hDevice, pCount, pCommandQueueGroupProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeDeviceGetCommandQueueGroupProperties", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDeviceGetCommandQueueGroupProperties( hDevice, pCount, pCommandQueueGroupProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -616,17 +703,14 @@ namespace validation_layer
         if( nullptr == pfnGetMemoryProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDeviceGetMemoryProperties", hDevice ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDeviceGetMemoryProperties( hDevice, pCount, pMemProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetMemoryProperties( hDevice, pCount, pMemProperties );
@@ -634,6 +718,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetMemoryProperties( hDevice, pCount, pMemProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeDeviceGetMemoryProperties", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDeviceGetMemoryProperties( hDevice, pCount, pMemProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -650,17 +741,14 @@ namespace validation_layer
         if( nullptr == pfnGetMemoryAccessProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDeviceGetMemoryAccessProperties", hDevice ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDeviceGetMemoryAccessProperties( hDevice, pMemAccessProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetMemoryAccessProperties( hDevice, pMemAccessProperties );
@@ -668,6 +756,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetMemoryAccessProperties( hDevice, pMemAccessProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeDeviceGetMemoryAccessProperties", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDeviceGetMemoryAccessProperties( hDevice, pMemAccessProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -692,17 +787,14 @@ namespace validation_layer
         if( nullptr == pfnGetCacheProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDeviceGetCacheProperties", hDevice ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDeviceGetCacheProperties( hDevice, pCount, pCacheProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetCacheProperties( hDevice, pCount, pCacheProperties );
@@ -710,6 +802,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetCacheProperties( hDevice, pCount, pCacheProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeDeviceGetCacheProperties", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDeviceGetCacheProperties( hDevice, pCount, pCacheProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -726,17 +825,14 @@ namespace validation_layer
         if( nullptr == pfnGetImageProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDeviceGetImageProperties", hDevice ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDeviceGetImageProperties( hDevice, pImageProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetImageProperties( hDevice, pImageProperties );
@@ -744,6 +840,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetImageProperties( hDevice, pImageProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeDeviceGetImageProperties", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDeviceGetImageProperties( hDevice, pImageProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -760,17 +863,14 @@ namespace validation_layer
         if( nullptr == pfnGetExternalMemoryProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDeviceGetExternalMemoryProperties", hDevice ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDeviceGetExternalMemoryProperties( hDevice, pExternalMemoryProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetExternalMemoryProperties( hDevice, pExternalMemoryProperties );
@@ -778,6 +878,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetExternalMemoryProperties( hDevice, pExternalMemoryProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeDeviceGetExternalMemoryProperties", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDeviceGetExternalMemoryProperties( hDevice, pExternalMemoryProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -795,17 +902,14 @@ namespace validation_layer
         if( nullptr == pfnGetP2PProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDeviceGetP2PProperties", hDevice ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDeviceGetP2PProperties( hDevice, hPeerDevice, pP2PProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetP2PProperties( hDevice, hPeerDevice, pP2PProperties );
@@ -813,6 +917,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetP2PProperties( hDevice, hPeerDevice, pP2PProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeDeviceGetP2PProperties", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDeviceGetP2PProperties( hDevice, hPeerDevice, pP2PProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -830,17 +941,14 @@ namespace validation_layer
         if( nullptr == pfnCanAccessPeer )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDeviceCanAccessPeer", hDevice ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDeviceCanAccessPeer( hDevice, hPeerDevice, value );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceCanAccessPeer( hDevice, hPeerDevice, value );
@@ -848,6 +956,13 @@ namespace validation_layer
         }
 
         auto result = pfnCanAccessPeer( hDevice, hPeerDevice, value );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeDeviceCanAccessPeer", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDeviceCanAccessPeer( hDevice, hPeerDevice, value );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -863,17 +978,14 @@ namespace validation_layer
         if( nullptr == pfnGetStatus )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDeviceGetStatus", hDevice ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDeviceGetStatus( hDevice );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetStatus( hDevice );
@@ -881,6 +993,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetStatus( hDevice );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeDeviceGetStatus", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDeviceGetStatus( hDevice );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -900,17 +1019,14 @@ namespace validation_layer
         if( nullptr == pfnGetGlobalTimestamps )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDeviceGetGlobalTimestamps", hDevice ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDeviceGetGlobalTimestamps( hDevice, hostTimestamp, deviceTimestamp );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetGlobalTimestamps( hDevice, hostTimestamp, deviceTimestamp );
@@ -918,6 +1034,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetGlobalTimestamps( hDevice, hostTimestamp, deviceTimestamp );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeDeviceGetGlobalTimestamps", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDeviceGetGlobalTimestamps( hDevice, hostTimestamp, deviceTimestamp );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -935,17 +1058,14 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeContextCreate", hDriver ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeContextCreate( hDriver, desc, phContext );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeContextCreate( hDriver, desc, phContext );
@@ -954,6 +1074,20 @@ namespace validation_layer
 
         auto result = pfnCreate( hDriver, desc, phContext );
 
+        if( context.enableAsyncValidation ){
+            auto phContextValue = ( result == ZE_RESULT_SUCCESS && phContext ) ? *phContext : nullptr;
+            context.asyncValidation->submit( "zeContextCreate", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeContextCreate( hDriver, desc, phContext );
+                if( result == ZE_RESULT_SUCCESS ){
+                    if (phContextValue){
+                        context.handleLifetime->addHandle( phContextValue );
+                        context.handleLifetime->addDependent( hDriver, phContextValue );
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phContext){
@@ -989,17 +1123,14 @@ namespace validation_layer
         if( nullptr == pfnCreateEx )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeContextCreateEx", hDriver ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeContextCreateEx( hDriver, desc, numDevices, phDevices, phContext );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeContextCreateEx( hDriver, desc, numDevices, phDevices, phContext );
@@ -1008,6 +1139,21 @@ namespace validation_layer
 
         auto result = pfnCreateEx( hDriver, desc, numDevices, phDevices, phContext );
 
+        if( context.enableAsyncValidation ){
+            auto phDevicesCopy = AsyncValidation::copy( phDevices, numDevices );
+            auto phContextValue = ( result == ZE_RESULT_SUCCESS && phContext ) ? *phContext : nullptr;
+            context.asyncValidation->submit( "zeContextCreateEx", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeContextCreateEx( hDriver, desc, numDevices, phDevicesCopy.data(), phContext );
+                if( result == ZE_RESULT_SUCCESS ){
+                    if (phContextValue){
+                        context.handleLifetime->addHandle( phContextValue );
+                        context.handleLifetime->addDependent( hDriver, phContextValue );
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phContext){
@@ -1031,24 +1177,31 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeContextDestroy", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeContextDestroy( hContext );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeContextDestroy( hContext );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
+        // Released handles are ordered before the driver can hand them out again.
+        bool asyncEnabled = context.enableAsyncValidation;
+        auto asyncSequence = asyncEnabled ? context.asyncValidation->reserve() : 0;
         auto result = pfnDestroy( hContext );
+
+        if( asyncEnabled ){
+            context.asyncValidation->submit( asyncSequence, "zeContextDestroy", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeContextDestroy( hContext );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1064,17 +1217,14 @@ namespace validation_layer
         if( nullptr == pfnGetStatus )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeContextGetStatus", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeContextGetStatus( hContext );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeContextGetStatus( hContext );
@@ -1082,6 +1232,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetStatus( hContext );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeContextGetStatus", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeContextGetStatus( hContext );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1100,17 +1257,14 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandQueueCreate", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandQueueCreate( hContext, hDevice, desc, phCommandQueue );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandQueueCreate( hContext, hDevice, desc, phCommandQueue );
@@ -1119,6 +1273,24 @@ namespace validation_layer
 
         auto result = pfnCreate( hContext, hDevice, desc, phCommandQueue );
 
+        if( result == ZE_RESULT_SUCCESS && context.enableGenerationalHandles ){
+            if( phCommandQueue ) *phCommandQueue = context.generationalHandles->wrap( *phCommandQueue );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phCommandQueueValue = ( result == ZE_RESULT_SUCCESS && phCommandQueue ) ? *phCommandQueue : nullptr;
+            context.asyncValidation->submit( "zeCommandQueueCreate", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandQueueCreate( hContext, hDevice, desc, phCommandQueue );
+                if( result == ZE_RESULT_SUCCESS ){
+                    if (phCommandQueueValue){
+                        context.handleLifetime->addHandle( phCommandQueueValue );
+                        context.handleLifetime->addDependent( hContext, phCommandQueueValue );
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phCommandQueue){
@@ -1142,24 +1314,42 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandQueueDestroy", hCommandQueue ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandQueueDestroy( hCommandQueue );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandQueueDestroy( hCommandQueue );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnDestroy( hCommandQueue );
+        auto hCommandQueueLocal = hCommandQueue;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandQueueLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        // Released handles are ordered before the driver can hand them out again.
+        bool asyncEnabled = context.enableAsyncValidation;
+        auto asyncSequence = asyncEnabled ? context.asyncValidation->reserve() : 0;
+        auto result = pfnDestroy( hCommandQueueLocal );
+
+        if( result == ZE_RESULT_SUCCESS && context.enableGenerationalHandles ){
+            context.generationalHandles->release( hCommandQueue );
+        }
+
+        if( asyncEnabled ){
+            context.asyncValidation->submit( asyncSequence, "zeCommandQueueDestroy", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandQueueDestroy( hCommandQueue );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1179,24 +1369,46 @@ namespace validation_layer
         if( nullptr == pfnExecuteCommandLists )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandQueueExecuteCommandLists", hCommandQueue ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandQueueExecuteCommandLists( hCommandQueue, numCommandLists, phCommandLists, hFence );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandQueueExecuteCommandLists( hCommandQueue, numCommandLists, phCommandLists, hFence );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnExecuteCommandLists( hCommandQueue, numCommandLists, phCommandLists, hFence );
+        auto hCommandQueueLocal = hCommandQueue;
+        GenerationalHandleArray<ze_command_list_handle_t> phCommandListsLocal( phCommandLists );
+        auto hFenceLocal = hFence;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandQueueLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !phCommandListsLocal.translate( generations, numCommandLists ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hFenceLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnExecuteCommandLists( hCommandQueueLocal, numCommandLists, phCommandListsLocal.data(), hFenceLocal );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->zeCommandQueueExecuteCommandLists( hCommandQueue, numCommandLists, phCommandLists, hFence );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phCommandListsCopy = AsyncValidation::copy( phCommandLists, numCommandLists );
+            context.asyncValidation->submit( "zeCommandQueueExecuteCommandLists", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandQueueExecuteCommandLists( hCommandQueue, numCommandLists, phCommandListsCopy.data(), hFence );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1219,24 +1431,39 @@ namespace validation_layer
         if( nullptr == pfnSynchronize )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandQueueSynchronize", hCommandQueue ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandQueueSynchronize( hCommandQueue, timeout );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandQueueSynchronize( hCommandQueue, timeout );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnSynchronize( hCommandQueue, timeout );
+        auto hCommandQueueLocal = hCommandQueue;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandQueueLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnSynchronize( hCommandQueueLocal, timeout );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->zeCommandQueueSynchronize( hCommandQueue, timeout );
+        }
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeCommandQueueSynchronize", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandQueueSynchronize( hCommandQueue, timeout );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1253,24 +1480,35 @@ namespace validation_layer
         if( nullptr == pfnGetOrdinal )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandQueueGetOrdinal", hCommandQueue ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandQueueGetOrdinal( hCommandQueue, pOrdinal );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandQueueGetOrdinal( hCommandQueue, pOrdinal );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnGetOrdinal( hCommandQueue, pOrdinal );
+        auto hCommandQueueLocal = hCommandQueue;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandQueueLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnGetOrdinal( hCommandQueueLocal, pOrdinal );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeCommandQueueGetOrdinal", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandQueueGetOrdinal( hCommandQueue, pOrdinal );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1287,24 +1525,35 @@ namespace validation_layer
         if( nullptr == pfnGetIndex )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandQueueGetIndex", hCommandQueue ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandQueueGetIndex( hCommandQueue, pIndex );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandQueueGetIndex( hCommandQueue, pIndex );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnGetIndex( hCommandQueue, pIndex );
+        auto hCommandQueueLocal = hCommandQueue;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandQueueLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnGetIndex( hCommandQueueLocal, pIndex );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeCommandQueueGetIndex", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandQueueGetIndex( hCommandQueue, pIndex );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1323,17 +1572,14 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListCreate", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListCreate( hContext, hDevice, desc, phCommandList );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListCreate( hContext, hDevice, desc, phCommandList );
@@ -1342,6 +1588,28 @@ namespace validation_layer
 
         auto result = pfnCreate( hContext, hDevice, desc, phCommandList );
 
+        if( result == ZE_RESULT_SUCCESS && context.enableGenerationalHandles ){
+            if( phCommandList ) *phCommandList = context.generationalHandles->wrap( *phCommandList );
+        }
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->zeCommandListCreate( hContext, hDevice, desc, phCommandList );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phCommandListValue = ( result == ZE_RESULT_SUCCESS && phCommandList ) ? *phCommandList : nullptr;
+            context.asyncValidation->submit( "zeCommandListCreate", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListCreate( hContext, hDevice, desc, phCommandList );
+                if( result == ZE_RESULT_SUCCESS ){
+                    if (phCommandListValue){
+                        context.handleLifetime->addHandle( phCommandListValue );
+                        context.handleLifetime->addDependent( hContext, phCommandListValue );
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phCommandList){
@@ -1368,17 +1636,14 @@ namespace validation_layer
         if( nullptr == pfnCreateImmediate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListCreateImmediate", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListCreateImmediate( hContext, hDevice, altdesc, phCommandList );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListCreateImmediate( hContext, hDevice, altdesc, phCommandList );
@@ -1387,6 +1652,27 @@ namespace validation_layer
 
         auto result = pfnCreateImmediate( hContext, hDevice, altdesc, phCommandList );
 
+        if( result == ZE_RESULT_SUCCESS && context.enableGenerationalHandles ){
+            if( phCommandList ) *phCommandList = context.generationalHandles->wrap( *phCommandList );
+        }
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->zeCommandListCreateImmediate( hContext, hDevice, altdesc, phCommandList );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phCommandListValue = ( result == ZE_RESULT_SUCCESS && phCommandList ) ? *phCommandList : nullptr;
+            context.asyncValidation->submit( "zeCommandListCreateImmediate", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListCreateImmediate( hContext, hDevice, altdesc, phCommandList );
+                if( result == ZE_RESULT_SUCCESS ){
+                    if (phCommandListValue){
+                        context.handleLifetime->addHandle( phCommandListValue, false );
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phCommandList){
@@ -1408,15 +1694,17 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListDestroy", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListDestroy( hCommandList );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListDestroy" );
         }
 
         
@@ -1425,7 +1713,36 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnDestroy( hCommandList );
+        auto hCommandListLocal = hCommandList;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        // Released handles are ordered before the driver can hand them out again.
+        bool asyncEnabled = context.enableAsyncValidation;
+        auto asyncSequence = asyncEnabled ? context.asyncValidation->reserve() : 0;
+        auto result = pfnDestroy( hCommandListLocal );
+
+        if( result == ZE_RESULT_SUCCESS && context.enableGenerationalHandles ){
+            context.generationalHandles->release( hCommandList );
+        }
+
+        if( result == ZE_RESULT_SUCCESS ){
+            threadingGuard.retire();
+        }
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->zeCommandListDestroy( hCommandList );
+        }
+
+        if( asyncEnabled ){
+            context.asyncValidation->submit( asyncSequence, "zeCommandListDestroy", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListDestroy( hCommandList );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1441,15 +1758,17 @@ namespace validation_layer
         if( nullptr == pfnClose )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListClose", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListClose( hCommandList );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListClose" );
         }
 
         
@@ -1458,7 +1777,25 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnClose( hCommandList );
+        auto hCommandListLocal = hCommandList;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnClose( hCommandListLocal );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->zeCommandListClose( hCommandList );
+        }
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeCommandListClose", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListClose( hCommandList );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1474,15 +1811,17 @@ namespace validation_layer
         if( nullptr == pfnReset )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListReset", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListReset( hCommandList );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListReset" );
         }
 
         
@@ -1491,7 +1830,25 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnReset( hCommandList );
+        auto hCommandListLocal = hCommandList;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnReset( hCommandListLocal );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->zeCommandListReset( hCommandList );
+        }
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeCommandListReset", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListReset( hCommandList );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1514,15 +1871,17 @@ namespace validation_layer
         if( nullptr == pfnAppendWriteGlobalTimestamp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListAppendWriteGlobalTimestamp", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListAppendWriteGlobalTimestamp( hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListAppendWriteGlobalTimestamp" );
         }
 
         
@@ -1531,7 +1890,32 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendWriteGlobalTimestamp( hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents );
+        auto hCommandListLocal = hCommandList;
+        auto hSignalEventLocal = hSignalEvent;
+        GenerationalHandleArray<ze_event_handle_t> phWaitEventsLocal( phWaitEvents );
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hSignalEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !phWaitEventsLocal.translate( generations, numWaitEvents ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendWriteGlobalTimestamp( hCommandListLocal, dstptr, hSignalEventLocal, numWaitEvents, phWaitEventsLocal.data() );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->commandListAppend( "zeCommandListAppendWriteGlobalTimestamp", hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phWaitEventsCopy = AsyncValidation::copy( phWaitEvents, numWaitEvents );
+            context.asyncValidation->submit( "zeCommandListAppendWriteGlobalTimestamp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListAppendWriteGlobalTimestamp( hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEventsCopy.data() );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1554,24 +1938,39 @@ namespace validation_layer
         if( nullptr == pfnHostSynchronize )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListHostSynchronize", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListHostSynchronize( hCommandList, timeout );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListHostSynchronize( hCommandList, timeout );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnHostSynchronize( hCommandList, timeout );
+        auto hCommandListLocal = hCommandList;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnHostSynchronize( hCommandListLocal, timeout );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->zeCommandListHostSynchronize( hCommandList, timeout );
+        }
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeCommandListHostSynchronize", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListHostSynchronize( hCommandList, timeout );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1588,24 +1987,35 @@ namespace validation_layer
         if( nullptr == pfnGetDeviceHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListGetDeviceHandle", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListGetDeviceHandle( hCommandList, phDevice );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListGetDeviceHandle( hCommandList, phDevice );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnGetDeviceHandle( hCommandList, phDevice );
+        auto hCommandListLocal = hCommandList;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnGetDeviceHandle( hCommandListLocal, phDevice );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeCommandListGetDeviceHandle", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListGetDeviceHandle( hCommandList, phDevice );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1622,24 +2032,35 @@ namespace validation_layer
         if( nullptr == pfnGetContextHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListGetContextHandle", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListGetContextHandle( hCommandList, phContext );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListGetContextHandle( hCommandList, phContext );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnGetContextHandle( hCommandList, phContext );
+        auto hCommandListLocal = hCommandList;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnGetContextHandle( hCommandListLocal, phContext );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeCommandListGetContextHandle", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListGetContextHandle( hCommandList, phContext );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1656,24 +2077,35 @@ namespace validation_layer
         if( nullptr == pfnGetOrdinal )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListGetOrdinal", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListGetOrdinal( hCommandList, pOrdinal );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListGetOrdinal( hCommandList, pOrdinal );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnGetOrdinal( hCommandList, pOrdinal );
+        auto hCommandListLocal = hCommandList;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnGetOrdinal( hCommandListLocal, pOrdinal );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeCommandListGetOrdinal", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListGetOrdinal( hCommandList, pOrdinal );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1691,24 +2123,35 @@ namespace validation_layer
         if( nullptr == pfnImmediateGetIndex )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListImmediateGetIndex", hCommandListImmediate ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListImmediateGetIndex( hCommandListImmediate, pIndex );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListImmediateGetIndex( hCommandListImmediate, pIndex );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnImmediateGetIndex( hCommandListImmediate, pIndex );
+        auto hCommandListImmediateLocal = hCommandListImmediate;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListImmediateLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnImmediateGetIndex( hCommandListImmediateLocal, pIndex );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeCommandListImmediateGetIndex", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListImmediateGetIndex( hCommandListImmediate, pIndex );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1726,24 +2169,35 @@ namespace validation_layer
         if( nullptr == pfnIsImmediate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListIsImmediate", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListIsImmediate( hCommandList, pIsImmediate );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListIsImmediate( hCommandList, pIsImmediate );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnIsImmediate( hCommandList, pIsImmediate );
+        auto hCommandListLocal = hCommandList;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnIsImmediate( hCommandListLocal, pIsImmediate );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeCommandListIsImmediate", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListIsImmediate( hCommandList, pIsImmediate );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1764,15 +2218,17 @@ namespace validation_layer
         if( nullptr == pfnAppendBarrier )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListAppendBarrier", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListAppendBarrier( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListAppendBarrier" );
         }
 
         
@@ -1781,7 +2237,32 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendBarrier( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+        auto hCommandListLocal = hCommandList;
+        auto hSignalEventLocal = hSignalEvent;
+        GenerationalHandleArray<ze_event_handle_t> phWaitEventsLocal( phWaitEvents );
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hSignalEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !phWaitEventsLocal.translate( generations, numWaitEvents ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendBarrier( hCommandListLocal, hSignalEventLocal, numWaitEvents, phWaitEventsLocal.data() );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->commandListAppend( "zeCommandListAppendBarrier", hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phWaitEventsCopy = AsyncValidation::copy( phWaitEvents, numWaitEvents );
+            context.asyncValidation->submit( "zeCommandListAppendBarrier", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListAppendBarrier( hCommandList, hSignalEvent, numWaitEvents, phWaitEventsCopy.data() );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1805,15 +2286,17 @@ namespace validation_layer
         if( nullptr == pfnAppendMemoryRangesBarrier )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListAppendMemoryRangesBarrier", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListAppendMemoryRangesBarrier( hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListAppendMemoryRangesBarrier" );
         }
 
         
@@ -1822,7 +2305,32 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendMemoryRangesBarrier( hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents );
+        auto hCommandListLocal = hCommandList;
+        auto hSignalEventLocal = hSignalEvent;
+        GenerationalHandleArray<ze_event_handle_t> phWaitEventsLocal( phWaitEvents );
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hSignalEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !phWaitEventsLocal.translate( generations, numWaitEvents ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendMemoryRangesBarrier( hCommandListLocal, numRanges, pRangeSizes, pRanges, hSignalEventLocal, numWaitEvents, phWaitEventsLocal.data() );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->commandListAppend( "zeCommandListAppendMemoryRangesBarrier", hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phWaitEventsCopy = AsyncValidation::copy( phWaitEvents, numWaitEvents );
+            context.asyncValidation->submit( "zeCommandListAppendMemoryRangesBarrier", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListAppendMemoryRangesBarrier( hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEventsCopy.data() );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1839,17 +2347,14 @@ namespace validation_layer
         if( nullptr == pfnSystemBarrier )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeContextSystemBarrier", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeContextSystemBarrier( hContext, hDevice );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeContextSystemBarrier( hContext, hDevice );
@@ -1857,6 +2362,13 @@ namespace validation_layer
         }
 
         auto result = pfnSystemBarrier( hContext, hDevice );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeContextSystemBarrier", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeContextSystemBarrier( hContext, hDevice );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1880,15 +2392,17 @@ namespace validation_layer
         if( nullptr == pfnAppendMemoryCopy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListAppendMemoryCopy", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListAppendMemoryCopy( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListAppendMemoryCopy" );
         }
 
         
@@ -1897,7 +2411,37 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendMemoryCopy( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
+        if( context.enableMemoryTracker ){
+            auto result = context.memoryTracker->zeCommandListAppendMemoryCopy( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
+            if(result!=ZE_RESULT_SUCCESS) return result;
+        }
+
+        auto hCommandListLocal = hCommandList;
+        auto hSignalEventLocal = hSignalEvent;
+        GenerationalHandleArray<ze_event_handle_t> phWaitEventsLocal( phWaitEvents );
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hSignalEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !phWaitEventsLocal.translate( generations, numWaitEvents ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendMemoryCopy( hCommandListLocal, dstptr, srcptr, size, hSignalEventLocal, numWaitEvents, phWaitEventsLocal.data() );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->zeCommandListAppendMemoryCopy( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phWaitEventsCopy = AsyncValidation::copy( phWaitEvents, numWaitEvents );
+            context.asyncValidation->submit( "zeCommandListAppendMemoryCopy", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListAppendMemoryCopy( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEventsCopy.data() );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1922,15 +2466,17 @@ namespace validation_layer
         if( nullptr == pfnAppendMemoryFill )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListAppendMemoryFill", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListAppendMemoryFill( hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListAppendMemoryFill" );
         }
 
         
@@ -1939,7 +2485,37 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendMemoryFill( hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents );
+        if( context.enableMemoryTracker ){
+            auto result = context.memoryTracker->zeCommandListAppendMemoryFill( hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents );
+            if(result!=ZE_RESULT_SUCCESS) return result;
+        }
+
+        auto hCommandListLocal = hCommandList;
+        auto hSignalEventLocal = hSignalEvent;
+        GenerationalHandleArray<ze_event_handle_t> phWaitEventsLocal( phWaitEvents );
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hSignalEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !phWaitEventsLocal.translate( generations, numWaitEvents ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendMemoryFill( hCommandListLocal, ptr, pattern, pattern_size, size, hSignalEventLocal, numWaitEvents, phWaitEventsLocal.data() );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->zeCommandListAppendMemoryFill( hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phWaitEventsCopy = AsyncValidation::copy( phWaitEvents, numWaitEvents );
+            context.asyncValidation->submit( "zeCommandListAppendMemoryFill", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListAppendMemoryFill( hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEventsCopy.data() );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1972,15 +2548,17 @@ namespace validation_layer
         if( nullptr == pfnAppendMemoryCopyRegion )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListAppendMemoryCopyRegion", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListAppendMemoryCopyRegion( hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListAppendMemoryCopyRegion" );
         }
 
         
@@ -1989,7 +2567,32 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendMemoryCopyRegion( hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
+        auto hCommandListLocal = hCommandList;
+        auto hSignalEventLocal = hSignalEvent;
+        GenerationalHandleArray<ze_event_handle_t> phWaitEventsLocal( phWaitEvents );
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hSignalEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !phWaitEventsLocal.translate( generations, numWaitEvents ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendMemoryCopyRegion( hCommandListLocal, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEventLocal, numWaitEvents, phWaitEventsLocal.data() );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->commandListAppend( "zeCommandListAppendMemoryCopyRegion", hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phWaitEventsCopy = AsyncValidation::copy( phWaitEvents, numWaitEvents );
+            context.asyncValidation->submit( "zeCommandListAppendMemoryCopyRegion", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListAppendMemoryCopyRegion( hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEventsCopy.data() );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2014,15 +2617,17 @@ namespace validation_layer
         if( nullptr == pfnAppendMemoryCopyFromContext )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListAppendMemoryCopyFromContext", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListAppendMemoryCopyFromContext( hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListAppendMemoryCopyFromContext" );
         }
 
         
@@ -2031,7 +2636,37 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendMemoryCopyFromContext( hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
+        if( context.enableMemoryTracker ){
+            auto result = context.memoryTracker->zeCommandListAppendMemoryCopyFromContext( hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
+            if(result!=ZE_RESULT_SUCCESS) return result;
+        }
+
+        auto hCommandListLocal = hCommandList;
+        auto hSignalEventLocal = hSignalEvent;
+        GenerationalHandleArray<ze_event_handle_t> phWaitEventsLocal( phWaitEvents );
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hSignalEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !phWaitEventsLocal.translate( generations, numWaitEvents ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendMemoryCopyFromContext( hCommandListLocal, dstptr, hContextSrc, srcptr, size, hSignalEventLocal, numWaitEvents, phWaitEventsLocal.data() );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->commandListAppend( "zeCommandListAppendMemoryCopyFromContext", hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phWaitEventsCopy = AsyncValidation::copy( phWaitEvents, numWaitEvents );
+            context.asyncValidation->submit( "zeCommandListAppendMemoryCopyFromContext", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListAppendMemoryCopyFromContext( hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEventsCopy.data() );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2054,15 +2689,17 @@ namespace validation_layer
         if( nullptr == pfnAppendImageCopy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListAppendImageCopy", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListAppendImageCopy( hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListAppendImageCopy" );
         }
 
         
@@ -2071,7 +2708,32 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendImageCopy( hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents );
+        auto hCommandListLocal = hCommandList;
+        auto hSignalEventLocal = hSignalEvent;
+        GenerationalHandleArray<ze_event_handle_t> phWaitEventsLocal( phWaitEvents );
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hSignalEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !phWaitEventsLocal.translate( generations, numWaitEvents ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendImageCopy( hCommandListLocal, hDstImage, hSrcImage, hSignalEventLocal, numWaitEvents, phWaitEventsLocal.data() );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->commandListAppend( "zeCommandListAppendImageCopy", hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phWaitEventsCopy = AsyncValidation::copy( phWaitEvents, numWaitEvents );
+            context.asyncValidation->submit( "zeCommandListAppendImageCopy", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListAppendImageCopy( hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEventsCopy.data() );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2096,15 +2758,17 @@ namespace validation_layer
         if( nullptr == pfnAppendImageCopyRegion )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListAppendImageCopyRegion", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListAppendImageCopyRegion( hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListAppendImageCopyRegion" );
         }
 
         
@@ -2113,7 +2777,32 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendImageCopyRegion( hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
+        auto hCommandListLocal = hCommandList;
+        auto hSignalEventLocal = hSignalEvent;
+        GenerationalHandleArray<ze_event_handle_t> phWaitEventsLocal( phWaitEvents );
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hSignalEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !phWaitEventsLocal.translate( generations, numWaitEvents ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendImageCopyRegion( hCommandListLocal, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEventLocal, numWaitEvents, phWaitEventsLocal.data() );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->commandListAppend( "zeCommandListAppendImageCopyRegion", hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phWaitEventsCopy = AsyncValidation::copy( phWaitEvents, numWaitEvents );
+            context.asyncValidation->submit( "zeCommandListAppendImageCopyRegion", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListAppendImageCopyRegion( hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEventsCopy.data() );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2137,15 +2826,17 @@ namespace validation_layer
         if( nullptr == pfnAppendImageCopyToMemory )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListAppendImageCopyToMemory", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListAppendImageCopyToMemory( hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListAppendImageCopyToMemory" );
         }
 
         
@@ -2154,7 +2845,32 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendImageCopyToMemory( hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
+        auto hCommandListLocal = hCommandList;
+        auto hSignalEventLocal = hSignalEvent;
+        GenerationalHandleArray<ze_event_handle_t> phWaitEventsLocal( phWaitEvents );
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hSignalEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !phWaitEventsLocal.translate( generations, numWaitEvents ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendImageCopyToMemory( hCommandListLocal, dstptr, hSrcImage, pSrcRegion, hSignalEventLocal, numWaitEvents, phWaitEventsLocal.data() );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->commandListAppend( "zeCommandListAppendImageCopyToMemory", hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phWaitEventsCopy = AsyncValidation::copy( phWaitEvents, numWaitEvents );
+            context.asyncValidation->submit( "zeCommandListAppendImageCopyToMemory", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListAppendImageCopyToMemory( hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEventsCopy.data() );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2178,15 +2894,17 @@ namespace validation_layer
         if( nullptr == pfnAppendImageCopyFromMemory )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListAppendImageCopyFromMemory", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListAppendImageCopyFromMemory( hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListAppendImageCopyFromMemory" );
         }
 
         
@@ -2195,7 +2913,32 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendImageCopyFromMemory( hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents );
+        auto hCommandListLocal = hCommandList;
+        auto hSignalEventLocal = hSignalEvent;
+        GenerationalHandleArray<ze_event_handle_t> phWaitEventsLocal( phWaitEvents );
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hSignalEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !phWaitEventsLocal.translate( generations, numWaitEvents ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendImageCopyFromMemory( hCommandListLocal, hDstImage, srcptr, pDstRegion, hSignalEventLocal, numWaitEvents, phWaitEventsLocal.data() );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->commandListAppend( "zeCommandListAppendImageCopyFromMemory", hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phWaitEventsCopy = AsyncValidation::copy( phWaitEvents, numWaitEvents );
+            context.asyncValidation->submit( "zeCommandListAppendImageCopyFromMemory", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListAppendImageCopyFromMemory( hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEventsCopy.data() );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2213,15 +2956,17 @@ namespace validation_layer
         if( nullptr == pfnAppendMemoryPrefetch )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListAppendMemoryPrefetch", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListAppendMemoryPrefetch( hCommandList, ptr, size );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListAppendMemoryPrefetch" );
         }
 
         
@@ -2230,7 +2975,30 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendMemoryPrefetch( hCommandList, ptr, size );
+        if( context.enableMemoryTracker ){
+            auto result = context.memoryTracker->zeCommandListAppendMemoryPrefetch( hCommandList, ptr, size );
+            if(result!=ZE_RESULT_SUCCESS) return result;
+        }
+
+        auto hCommandListLocal = hCommandList;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendMemoryPrefetch( hCommandListLocal, ptr, size );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->commandListAppend( "zeCommandListAppendMemoryPrefetch", hCommandList, ptr, size );
+        }
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeCommandListAppendMemoryPrefetch", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListAppendMemoryPrefetch( hCommandList, ptr, size );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2250,15 +3018,17 @@ namespace validation_layer
         if( nullptr == pfnAppendMemAdvise )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListAppendMemAdvise", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListAppendMemAdvise( hCommandList, hDevice, ptr, size, advice );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListAppendMemAdvise" );
         }
 
         
@@ -2267,7 +3037,30 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendMemAdvise( hCommandList, hDevice, ptr, size, advice );
+        if( context.enableMemoryTracker ){
+            auto result = context.memoryTracker->zeCommandListAppendMemAdvise( hCommandList, hDevice, ptr, size, advice );
+            if(result!=ZE_RESULT_SUCCESS) return result;
+        }
+
+        auto hCommandListLocal = hCommandList;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendMemAdvise( hCommandListLocal, hDevice, ptr, size, advice );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->commandListAppend( "zeCommandListAppendMemAdvise", hCommandList, hDevice, ptr, size, advice );
+        }
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeCommandListAppendMemAdvise", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListAppendMemAdvise( hCommandList, hDevice, ptr, size, advice );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2291,17 +3084,14 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeEventPoolCreate", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeEventPoolCreate( hContext, desc, numDevices, phDevices, phEventPool );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventPoolCreate( hContext, desc, numDevices, phDevices, phEventPool );
@@ -2310,6 +3100,25 @@ namespace validation_layer
 
         auto result = pfnCreate( hContext, desc, numDevices, phDevices, phEventPool );
 
+        if( result == ZE_RESULT_SUCCESS && context.enableGenerationalHandles ){
+            if( phEventPool ) *phEventPool = context.generationalHandles->wrap( *phEventPool );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phDevicesCopy = AsyncValidation::copy( phDevices, numDevices );
+            auto phEventPoolValue = ( result == ZE_RESULT_SUCCESS && phEventPool ) ? *phEventPool : nullptr;
+            context.asyncValidation->submit( "zeEventPoolCreate", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeEventPoolCreate( hContext, desc, numDevices, phDevicesCopy.data(), phEventPool );
+                if( result == ZE_RESULT_SUCCESS ){
+                    if (phEventPoolValue){
+                        context.handleLifetime->addHandle( phEventPoolValue );
+                        context.handleLifetime->addDependent( hContext, phEventPoolValue );
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phEventPool){
@@ -2333,24 +3142,42 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeEventPoolDestroy", hEventPool ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeEventPoolDestroy( hEventPool );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventPoolDestroy( hEventPool );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnDestroy( hEventPool );
+        auto hEventPoolLocal = hEventPool;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hEventPoolLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        // Released handles are ordered before the driver can hand them out again.
+        bool asyncEnabled = context.enableAsyncValidation;
+        auto asyncSequence = asyncEnabled ? context.asyncValidation->reserve() : 0;
+        auto result = pfnDestroy( hEventPoolLocal );
+
+        if( result == ZE_RESULT_SUCCESS && context.enableGenerationalHandles ){
+            context.generationalHandles->release( hEventPool );
+        }
+
+        if( asyncEnabled ){
+            context.asyncValidation->submit( asyncSequence, "zeEventPoolDestroy", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeEventPoolDestroy( hEventPool );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2368,24 +3195,50 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeEventCreate", hEventPool ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeEventCreate( hEventPool, desc, phEvent );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventCreate( hEventPool, desc, phEvent );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnCreate( hEventPool, desc, phEvent );
+        auto hEventPoolLocal = hEventPool;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hEventPoolLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnCreate( hEventPoolLocal, desc, phEvent );
+
+        if( result == ZE_RESULT_SUCCESS && context.enableGenerationalHandles ){
+            if( phEvent ) *phEvent = context.generationalHandles->wrap( *phEvent );
+        }
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->zeEventCreate( hEventPool, desc, phEvent );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phEventValue = ( result == ZE_RESULT_SUCCESS && phEvent ) ? *phEvent : nullptr;
+            context.asyncValidation->submit( "zeEventCreate", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeEventCreate( hEventPool, desc, phEvent );
+                if( result == ZE_RESULT_SUCCESS ){
+                    if (phEventValue){
+                        context.handleLifetime->addHandle( phEventValue );
+                        context.handleLifetime->addDependent( hEventPool, phEventValue );
+                    }
+                }
+                return check;
+            } );
+        }
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
@@ -2410,24 +3263,46 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeEventDestroy", hEvent ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeEventDestroy( hEvent );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventDestroy( hEvent );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnDestroy( hEvent );
+        auto hEventLocal = hEvent;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        // Released handles are ordered before the driver can hand them out again.
+        bool asyncEnabled = context.enableAsyncValidation;
+        auto asyncSequence = asyncEnabled ? context.asyncValidation->reserve() : 0;
+        auto result = pfnDestroy( hEventLocal );
+
+        if( result == ZE_RESULT_SUCCESS && context.enableGenerationalHandles ){
+            context.generationalHandles->release( hEvent );
+        }
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->zeEventDestroy( hEvent );
+        }
+
+        if( asyncEnabled ){
+            context.asyncValidation->submit( asyncSequence, "zeEventDestroy", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeEventDestroy( hEvent );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2444,24 +3319,37 @@ namespace validation_layer
         if( nullptr == pfnGetIpcHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeEventPoolGetIpcHandle", hEventPool ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeEventPoolGetIpcHandle( hEventPool, phIpc );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventPoolGetIpcHandle( hEventPool, phIpc );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnGetIpcHandle( hEventPool, phIpc );
+        auto hEventPoolLocal = hEventPool;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hEventPoolLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnGetIpcHandle( hEventPoolLocal, phIpc );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeEventPoolGetIpcHandle", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeEventPoolGetIpcHandle( hEventPool, phIpc );
+                if( result == ZE_RESULT_SUCCESS ){
+                }
+                return check;
+            } );
+        }
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
@@ -2483,17 +3371,14 @@ namespace validation_layer
         if( nullptr == pfnPutIpcHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeEventPoolPutIpcHandle", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeEventPoolPutIpcHandle( hContext, hIpc );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventPoolPutIpcHandle( hContext, hIpc );
@@ -2501,6 +3386,13 @@ namespace validation_layer
         }
 
         auto result = pfnPutIpcHandle( hContext, hIpc );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeEventPoolPutIpcHandle", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeEventPoolPutIpcHandle( hContext, hIpc );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2519,17 +3411,14 @@ namespace validation_layer
         if( nullptr == pfnOpenIpcHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeEventPoolOpenIpcHandle", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeEventPoolOpenIpcHandle( hContext, hIpc, phEventPool );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventPoolOpenIpcHandle( hContext, hIpc, phEventPool );
@@ -2537,6 +3426,17 @@ namespace validation_layer
         }
 
         auto result = pfnOpenIpcHandle( hContext, hIpc, phEventPool );
+
+        if( result == ZE_RESULT_SUCCESS && context.enableGenerationalHandles ){
+            if( phEventPool ) *phEventPool = context.generationalHandles->wrap( *phEventPool );
+        }
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeEventPoolOpenIpcHandle", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeEventPoolOpenIpcHandle( hContext, hIpc, phEventPool );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2552,24 +3452,39 @@ namespace validation_layer
         if( nullptr == pfnCloseIpcHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeEventPoolCloseIpcHandle", hEventPool ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeEventPoolCloseIpcHandle( hEventPool );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventPoolCloseIpcHandle( hEventPool );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnCloseIpcHandle( hEventPool );
+        auto hEventPoolLocal = hEventPool;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hEventPoolLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnCloseIpcHandle( hEventPoolLocal );
+
+        if( result == ZE_RESULT_SUCCESS && context.enableGenerationalHandles ){
+            context.generationalHandles->release( hEventPool );
+        }
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeEventPoolCloseIpcHandle", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeEventPoolCloseIpcHandle( hEventPool );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2586,15 +3501,17 @@ namespace validation_layer
         if( nullptr == pfnAppendSignalEvent )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListAppendSignalEvent", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListAppendSignalEvent( hCommandList, hEvent );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListAppendSignalEvent" );
         }
 
         
@@ -2603,7 +3520,28 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendSignalEvent( hCommandList, hEvent );
+        auto hCommandListLocal = hCommandList;
+        auto hEventLocal = hEvent;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendSignalEvent( hCommandListLocal, hEventLocal );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->commandListAppend( "zeCommandListAppendSignalEvent", hCommandList, hEvent );
+        }
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeCommandListAppendSignalEvent", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListAppendSignalEvent( hCommandList, hEvent );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2622,15 +3560,17 @@ namespace validation_layer
         if( nullptr == pfnAppendWaitOnEvents )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListAppendWaitOnEvents", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListAppendWaitOnEvents( hCommandList, numEvents, phEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListAppendWaitOnEvents" );
         }
 
         
@@ -2639,7 +3579,29 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendWaitOnEvents( hCommandList, numEvents, phEvents );
+        auto hCommandListLocal = hCommandList;
+        GenerationalHandleArray<ze_event_handle_t> phEventsLocal( phEvents );
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !phEventsLocal.translate( generations, numEvents ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendWaitOnEvents( hCommandListLocal, numEvents, phEventsLocal.data() );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->commandListAppend( "zeCommandListAppendWaitOnEvents", hCommandList, numEvents, phEvents );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phEventsCopy = AsyncValidation::copy( phEvents, numEvents );
+            context.asyncValidation->submit( "zeCommandListAppendWaitOnEvents", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListAppendWaitOnEvents( hCommandList, numEvents, phEventsCopy.data() );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2655,24 +3617,35 @@ namespace validation_layer
         if( nullptr == pfnHostSignal )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeEventHostSignal", hEvent ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeEventHostSignal( hEvent );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventHostSignal( hEvent );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnHostSignal( hEvent );
+        auto hEventLocal = hEvent;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnHostSignal( hEventLocal );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeEventHostSignal", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeEventHostSignal( hEvent );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2695,24 +3668,39 @@ namespace validation_layer
         if( nullptr == pfnHostSynchronize )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeEventHostSynchronize", hEvent ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeEventHostSynchronize( hEvent, timeout );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventHostSynchronize( hEvent, timeout );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnHostSynchronize( hEvent, timeout );
+        auto hEventLocal = hEvent;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnHostSynchronize( hEventLocal, timeout );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->zeEventHostSynchronize( hEvent, timeout );
+        }
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeEventHostSynchronize", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeEventHostSynchronize( hEvent, timeout );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2728,24 +3716,35 @@ namespace validation_layer
         if( nullptr == pfnQueryStatus )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeEventQueryStatus", hEvent ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeEventQueryStatus( hEvent );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventQueryStatus( hEvent );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnQueryStatus( hEvent );
+        auto hEventLocal = hEvent;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnQueryStatus( hEventLocal );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeEventQueryStatus", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeEventQueryStatus( hEvent );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2762,15 +3761,17 @@ namespace validation_layer
         if( nullptr == pfnAppendEventReset )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListAppendEventReset", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListAppendEventReset( hCommandList, hEvent );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListAppendEventReset" );
         }
 
         
@@ -2779,7 +3780,28 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendEventReset( hCommandList, hEvent );
+        auto hCommandListLocal = hCommandList;
+        auto hEventLocal = hEvent;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendEventReset( hCommandListLocal, hEventLocal );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->commandListAppend( "zeCommandListAppendEventReset", hCommandList, hEvent );
+        }
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeCommandListAppendEventReset", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListAppendEventReset( hCommandList, hEvent );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2795,24 +3817,35 @@ namespace validation_layer
         if( nullptr == pfnHostReset )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeEventHostReset", hEvent ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeEventHostReset( hEvent );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventHostReset( hEvent );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnHostReset( hEvent );
+        auto hEventLocal = hEvent;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnHostReset( hEventLocal );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeEventHostReset", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeEventHostReset( hEvent );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2829,24 +3862,35 @@ namespace validation_layer
         if( nullptr == pfnQueryKernelTimestamp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeEventQueryKernelTimestamp", hEvent ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeEventQueryKernelTimestamp( hEvent, dstptr );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventQueryKernelTimestamp( hEvent, dstptr );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnQueryKernelTimestamp( hEvent, dstptr );
+        auto hEventLocal = hEvent;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnQueryKernelTimestamp( hEventLocal, dstptr );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeEventQueryKernelTimestamp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeEventQueryKernelTimestamp( hEvent, dstptr );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2874,15 +3918,17 @@ namespace validation_layer
         if( nullptr == pfnAppendQueryKernelTimestamps )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListAppendQueryKernelTimestamps", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListAppendQueryKernelTimestamps( hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListAppendQueryKernelTimestamps" );
         }
 
         
@@ -2891,7 +3937,36 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendQueryKernelTimestamps( hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents );
+        auto hCommandListLocal = hCommandList;
+        GenerationalHandleArray<ze_event_handle_t> phEventsLocal( phEvents );
+        auto hSignalEventLocal = hSignalEvent;
+        GenerationalHandleArray<ze_event_handle_t> phWaitEventsLocal( phWaitEvents );
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !phEventsLocal.translate( generations, numEvents ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hSignalEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !phWaitEventsLocal.translate( generations, numWaitEvents ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendQueryKernelTimestamps( hCommandListLocal, numEvents, phEventsLocal.data(), dstptr, pOffsets, hSignalEventLocal, numWaitEvents, phWaitEventsLocal.data() );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->commandListAppend( "zeCommandListAppendQueryKernelTimestamps", hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phEventsCopy = AsyncValidation::copy( phEvents, numEvents );
+            auto phWaitEventsCopy = AsyncValidation::copy( phWaitEvents, numWaitEvents );
+            context.asyncValidation->submit( "zeCommandListAppendQueryKernelTimestamps", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListAppendQueryKernelTimestamps( hCommandList, numEvents, phEventsCopy.data(), dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEventsCopy.data() );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2908,24 +3983,38 @@ namespace validation_layer
         if( nullptr == pfnGetEventPool )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeEventGetEventPool", hEvent ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeEventGetEventPool( hEvent, phEventPool );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventGetEventPool( hEvent, phEventPool );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnGetEventPool( hEvent, phEventPool );
+        auto hEventLocal = hEvent;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnGetEventPool( hEventLocal, phEventPool );
+
+        if( result == ZE_RESULT_SUCCESS && context.enableGenerationalHandles ){
+            if( phEventPool ) *phEventPool = context.generationalHandles->wrap( *phEventPool );
+        }
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeEventGetEventPool", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeEventGetEventPool( hEvent, phEventPool );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2944,24 +4033,35 @@ namespace validation_layer
         if( nullptr == pfnGetSignalScope )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeEventGetSignalScope", hEvent ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeEventGetSignalScope( hEvent, pSignalScope );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventGetSignalScope( hEvent, pSignalScope );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnGetSignalScope( hEvent, pSignalScope );
+        auto hEventLocal = hEvent;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnGetSignalScope( hEventLocal, pSignalScope );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeEventGetSignalScope", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeEventGetSignalScope( hEvent, pSignalScope );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2980,24 +4080,35 @@ namespace validation_layer
         if( nullptr == pfnGetWaitScope )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeEventGetWaitScope", hEvent ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeEventGetWaitScope( hEvent, pWaitScope );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventGetWaitScope( hEvent, pWaitScope );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnGetWaitScope( hEvent, pWaitScope );
+        auto hEventLocal = hEvent;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnGetWaitScope( hEventLocal, pWaitScope );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeEventGetWaitScope", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeEventGetWaitScope( hEvent, pWaitScope );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3014,24 +4125,35 @@ namespace validation_layer
         if( nullptr == pfnGetContextHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeEventPoolGetContextHandle", hEventPool ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeEventPoolGetContextHandle( hEventPool, phContext );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventPoolGetContextHandle( hEventPool, phContext );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnGetContextHandle( hEventPool, phContext );
+        auto hEventPoolLocal = hEventPool;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hEventPoolLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnGetContextHandle( hEventPoolLocal, phContext );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeEventPoolGetContextHandle", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeEventPoolGetContextHandle( hEventPool, phContext );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3049,24 +4171,35 @@ namespace validation_layer
         if( nullptr == pfnGetFlags )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeEventPoolGetFlags", hEventPool ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeEventPoolGetFlags( hEventPool, pFlags );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventPoolGetFlags( hEventPool, pFlags );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnGetFlags( hEventPool, pFlags );
+        auto hEventPoolLocal = hEventPool;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hEventPoolLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnGetFlags( hEventPoolLocal, pFlags );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeEventPoolGetFlags", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeEventPoolGetFlags( hEventPool, pFlags );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3084,24 +4217,46 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeFenceCreate", hCommandQueue ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeFenceCreate( hCommandQueue, desc, phFence );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeFenceCreate( hCommandQueue, desc, phFence );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnCreate( hCommandQueue, desc, phFence );
+        auto hCommandQueueLocal = hCommandQueue;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandQueueLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnCreate( hCommandQueueLocal, desc, phFence );
+
+        if( result == ZE_RESULT_SUCCESS && context.enableGenerationalHandles ){
+            if( phFence ) *phFence = context.generationalHandles->wrap( *phFence );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phFenceValue = ( result == ZE_RESULT_SUCCESS && phFence ) ? *phFence : nullptr;
+            context.asyncValidation->submit( "zeFenceCreate", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeFenceCreate( hCommandQueue, desc, phFence );
+                if( result == ZE_RESULT_SUCCESS ){
+                    if (phFenceValue){
+                        context.handleLifetime->addHandle( phFenceValue );
+                        context.handleLifetime->addDependent( hCommandQueue, phFenceValue );
+                    }
+                }
+                return check;
+            } );
+        }
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
@@ -3126,24 +4281,42 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeFenceDestroy", hFence ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeFenceDestroy( hFence );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeFenceDestroy( hFence );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnDestroy( hFence );
+        auto hFenceLocal = hFence;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hFenceLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        // Released handles are ordered before the driver can hand them out again.
+        bool asyncEnabled = context.enableAsyncValidation;
+        auto asyncSequence = asyncEnabled ? context.asyncValidation->reserve() : 0;
+        auto result = pfnDestroy( hFenceLocal );
+
+        if( result == ZE_RESULT_SUCCESS && context.enableGenerationalHandles ){
+            context.generationalHandles->release( hFence );
+        }
+
+        if( asyncEnabled ){
+            context.asyncValidation->submit( asyncSequence, "zeFenceDestroy", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeFenceDestroy( hFence );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3166,24 +4339,39 @@ namespace validation_layer
         if( nullptr == pfnHostSynchronize )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeFenceHostSynchronize", hFence ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeFenceHostSynchronize( hFence, timeout );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeFenceHostSynchronize( hFence, timeout );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnHostSynchronize( hFence, timeout );
+        auto hFenceLocal = hFence;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hFenceLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnHostSynchronize( hFenceLocal, timeout );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->zeFenceHostSynchronize( hFence, timeout );
+        }
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeFenceHostSynchronize", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeFenceHostSynchronize( hFence, timeout );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3199,24 +4387,35 @@ namespace validation_layer
         if( nullptr == pfnQueryStatus )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeFenceQueryStatus", hFence ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeFenceQueryStatus( hFence );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeFenceQueryStatus( hFence );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnQueryStatus( hFence );
+        auto hFenceLocal = hFence;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hFenceLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnQueryStatus( hFenceLocal );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeFenceQueryStatus", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeFenceQueryStatus( hFence );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3232,24 +4431,35 @@ namespace validation_layer
         if( nullptr == pfnReset )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeFenceReset", hFence ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeFenceReset( hFence );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeFenceReset( hFence );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnReset( hFence );
+        auto hFenceLocal = hFence;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hFenceLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnReset( hFenceLocal );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeFenceReset", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeFenceReset( hFence );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3267,17 +4477,14 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeImageGetProperties", hDevice ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeImageGetProperties( hDevice, desc, pImageProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeImageGetProperties( hDevice, desc, pImageProperties );
@@ -3285,6 +4492,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetProperties( hDevice, desc, pImageProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeImageGetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeImageGetProperties( hDevice, desc, pImageProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3303,17 +4517,14 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeImageCreate", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeImageCreate( hContext, hDevice, desc, phImage );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeImageCreate( hContext, hDevice, desc, phImage );
@@ -3322,6 +4533,20 @@ namespace validation_layer
 
         auto result = pfnCreate( hContext, hDevice, desc, phImage );
 
+        if( context.enableAsyncValidation ){
+            auto phImageValue = ( result == ZE_RESULT_SUCCESS && phImage ) ? *phImage : nullptr;
+            context.asyncValidation->submit( "zeImageCreate", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeImageCreate( hContext, hDevice, desc, phImage );
+                if( result == ZE_RESULT_SUCCESS ){
+                    if (phImageValue){
+                        context.handleLifetime->addHandle( phImageValue );
+                        context.handleLifetime->addDependent( hContext, phImageValue );
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phImage){
@@ -3345,24 +4570,31 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeImageDestroy", hImage ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeImageDestroy( hImage );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeImageDestroy( hImage );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
+        // Released handles are ordered before the driver can hand them out again.
+        bool asyncEnabled = context.enableAsyncValidation;
+        auto asyncSequence = asyncEnabled ? context.asyncValidation->reserve() : 0;
         auto result = pfnDestroy( hImage );
+
+        if( asyncEnabled ){
+            context.asyncValidation->submit( asyncSequence, "zeImageDestroy", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeImageDestroy( hImage );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3386,17 +4618,14 @@ namespace validation_layer
         if( nullptr == pfnAllocShared )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeMemAllocShared", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeMemAllocShared( hContext, device_desc, host_desc, size, alignment, hDevice, pptr );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemAllocShared( hContext, device_desc, host_desc, size, alignment, hDevice, pptr );
@@ -3404,6 +4633,21 @@ namespace validation_layer
         }
 
         auto result = pfnAllocShared( hContext, device_desc, host_desc, size, alignment, hDevice, pptr );
+
+        if( result == ZE_RESULT_SUCCESS && context.enableMemoryTracker ){
+            context.memoryTracker->zeMemAllocSharedEpilogue( hContext, device_desc, host_desc, size, alignment, hDevice, pptr );
+        }
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->zeMemAllocShared( hContext, device_desc, host_desc, size, alignment, hDevice, pptr );
+        }
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeMemAllocShared", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeMemAllocShared( hContext, device_desc, host_desc, size, alignment, hDevice, pptr );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3426,17 +4670,14 @@ namespace validation_layer
         if( nullptr == pfnAllocDevice )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeMemAllocDevice", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeMemAllocDevice( hContext, device_desc, size, alignment, hDevice, pptr );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemAllocDevice( hContext, device_desc, size, alignment, hDevice, pptr );
@@ -3444,6 +4685,21 @@ namespace validation_layer
         }
 
         auto result = pfnAllocDevice( hContext, device_desc, size, alignment, hDevice, pptr );
+
+        if( result == ZE_RESULT_SUCCESS && context.enableMemoryTracker ){
+            context.memoryTracker->zeMemAllocDeviceEpilogue( hContext, device_desc, size, alignment, hDevice, pptr );
+        }
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->zeMemAllocDevice( hContext, device_desc, size, alignment, hDevice, pptr );
+        }
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeMemAllocDevice", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeMemAllocDevice( hContext, device_desc, size, alignment, hDevice, pptr );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3465,17 +4721,14 @@ namespace validation_layer
         if( nullptr == pfnAllocHost )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeMemAllocHost", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeMemAllocHost( hContext, host_desc, size, alignment, pptr );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemAllocHost( hContext, host_desc, size, alignment, pptr );
@@ -3483,6 +4736,21 @@ namespace validation_layer
         }
 
         auto result = pfnAllocHost( hContext, host_desc, size, alignment, pptr );
+
+        if( result == ZE_RESULT_SUCCESS && context.enableMemoryTracker ){
+            context.memoryTracker->zeMemAllocHostEpilogue( hContext, host_desc, size, alignment, pptr );
+        }
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->zeMemAllocHost( hContext, host_desc, size, alignment, pptr );
+        }
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeMemAllocHost", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeMemAllocHost( hContext, host_desc, size, alignment, pptr );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3499,24 +4767,41 @@ namespace validation_layer
         if( nullptr == pfnFree )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeMemFree", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeMemFree( hContext, ptr );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemFree( hContext, ptr );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
+        if( context.enableMemoryTracker ){
+            auto result = context.memoryTracker->zeMemFree( hContext, ptr );
+            if(result!=ZE_RESULT_SUCCESS) return result;
+        }
+
         auto result = pfnFree( hContext, ptr );
+
+        if( result == ZE_RESULT_SUCCESS && context.enableMemoryTracker ){
+            context.memoryTracker->zeMemFreeEpilogue( hContext, ptr );
+        }
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->zeMemFree( hContext, ptr );
+        }
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeMemFree", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeMemFree( hContext, ptr );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3535,17 +4820,14 @@ namespace validation_layer
         if( nullptr == pfnGetAllocProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeMemGetAllocProperties", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeMemGetAllocProperties( hContext, ptr, pMemAllocProperties, phDevice );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemGetAllocProperties( hContext, ptr, pMemAllocProperties, phDevice );
@@ -3553,6 +4835,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetAllocProperties( hContext, ptr, pMemAllocProperties, phDevice );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeMemGetAllocProperties", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeMemGetAllocProperties( hContext, ptr, pMemAllocProperties, phDevice );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3571,17 +4860,14 @@ namespace validation_layer
         if( nullptr == pfnGetAddressRange )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeMemGetAddressRange", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeMemGetAddressRange( hContext, ptr, pBase, pSize );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemGetAddressRange( hContext, ptr, pBase, pSize );
@@ -3589,6 +4875,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetAddressRange( hContext, ptr, pBase, pSize );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeMemGetAddressRange", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeMemGetAddressRange( hContext, ptr, pBase, pSize );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3606,17 +4899,14 @@ namespace validation_layer
         if( nullptr == pfnGetIpcHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeMemGetIpcHandle", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeMemGetIpcHandle( hContext, ptr, pIpcHandle );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemGetIpcHandle( hContext, ptr, pIpcHandle );
@@ -3625,6 +4915,15 @@ namespace validation_layer
 
         auto result = pfnGetIpcHandle( hContext, ptr, pIpcHandle );
 
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeMemGetIpcHandle", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeMemGetIpcHandle( hContext, ptr, pIpcHandle );
+                if( result == ZE_RESULT_SUCCESS ){
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
         }
@@ -3645,17 +4944,14 @@ namespace validation_layer
         if( nullptr == pfnGetIpcHandleFromFileDescriptorExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeMemGetIpcHandleFromFileDescriptorExp", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeMemGetIpcHandleFromFileDescriptorExp( hContext, handle, pIpcHandle );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemGetIpcHandleFromFileDescriptorExp( hContext, handle, pIpcHandle );
@@ -3664,6 +4960,15 @@ namespace validation_layer
 
         auto result = pfnGetIpcHandleFromFileDescriptorExp( hContext, handle, pIpcHandle );
 
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeMemGetIpcHandleFromFileDescriptorExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeMemGetIpcHandleFromFileDescriptorExp( hContext, handle, pIpcHandle );
+                if( result == ZE_RESULT_SUCCESS ){
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
         }
@@ -3684,17 +4989,14 @@ namespace validation_layer
         if( nullptr == pfnGetFileDescriptorFromIpcHandleExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeMemGetFileDescriptorFromIpcHandleExp", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeMemGetFileDescriptorFromIpcHandleExp( hContext, ipcHandle, pHandle );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemGetFileDescriptorFromIpcHandleExp( hContext, ipcHandle, pHandle );
@@ -3703,6 +5005,15 @@ namespace validation_layer
 
         auto result = pfnGetFileDescriptorFromIpcHandleExp( hContext, ipcHandle, pHandle );
 
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeMemGetFileDescriptorFromIpcHandleExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeMemGetFileDescriptorFromIpcHandleExp( hContext, ipcHandle, pHandle );
+                if( result == ZE_RESULT_SUCCESS ){
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
         }
@@ -3722,17 +5033,14 @@ namespace validation_layer
         if( nullptr == pfnPutIpcHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeMemPutIpcHandle", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeMemPutIpcHandle( hContext, handle );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemPutIpcHandle( hContext, handle );
@@ -3740,6 +5048,13 @@ namespace validation_layer
         }
 
         auto result = pfnPutIpcHandle( hContext, handle );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeMemPutIpcHandle", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeMemPutIpcHandle( hContext, handle );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3760,17 +5075,14 @@ namespace validation_layer
         if( nullptr == pfnOpenIpcHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeMemOpenIpcHandle", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeMemOpenIpcHandle( hContext, hDevice, handle, flags, pptr );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemOpenIpcHandle( hContext, hDevice, handle, flags, pptr );
@@ -3778,6 +5090,17 @@ namespace validation_layer
         }
 
         auto result = pfnOpenIpcHandle( hContext, hDevice, handle, flags, pptr );
+
+        if( result == ZE_RESULT_SUCCESS && context.enableMemoryTracker ){
+            context.memoryTracker->zeMemOpenIpcHandleEpilogue( hContext, hDevice, handle, flags, pptr );
+        }
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeMemOpenIpcHandle", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeMemOpenIpcHandle( hContext, hDevice, handle, flags, pptr );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3794,24 +5117,37 @@ namespace validation_layer
         if( nullptr == pfnCloseIpcHandle )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeMemCloseIpcHandle", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeMemCloseIpcHandle( hContext, ptr );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemCloseIpcHandle( hContext, ptr );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
+        if( context.enableMemoryTracker ){
+            auto result = context.memoryTracker->zeMemCloseIpcHandle( hContext, ptr );
+            if(result!=ZE_RESULT_SUCCESS) return result;
+        }
+
         auto result = pfnCloseIpcHandle( hContext, ptr );
+
+        if( result == ZE_RESULT_SUCCESS && context.enableMemoryTracker ){
+            context.memoryTracker->zeMemCloseIpcHandleEpilogue( hContext, ptr );
+        }
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeMemCloseIpcHandle", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeMemCloseIpcHandle( hContext, ptr );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3832,17 +5168,14 @@ namespace validation_layer
         if( nullptr == pfnSetAtomicAccessAttributeExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeMemSetAtomicAccessAttributeExp", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeMemSetAtomicAccessAttributeExp( hContext, hDevice, ptr, size, attr );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
-
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemSetAtomicAccessAttributeExp( hContext, hDevice, ptr, size, attr );
@@ -3850,6 +5183,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetAtomicAccessAttributeExp( hContext, hDevice, ptr, size, attr );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeMemSetAtomicAccessAttributeExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeMemSetAtomicAccessAttributeExp( hContext, hDevice, ptr, size, attr );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3869,17 +5209,14 @@ namespace validation_layer
         if( nullptr == pfnGetAtomicAccessAttributeExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeMemGetAtomicAccessAttributeExp", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeMemGetAtomicAccessAttributeExp( hContext, hDevice, ptr, size, pAttr );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemGetAtomicAccessAttributeExp( hContext, hDevice, ptr, size, pAttr );
@@ -3888,6 +5225,15 @@ namespace validation_layer
 
         auto result = pfnGetAtomicAccessAttributeExp( hContext, hDevice, ptr, size, pAttr );
 
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeMemGetAtomicAccessAttributeExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeMemGetAtomicAccessAttributeExp( hContext, hDevice, ptr, size, pAttr );
+                if( result == ZE_RESULT_SUCCESS ){
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
         }
@@ -3910,17 +5256,14 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeModuleCreate", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeModuleCreate( hContext, hDevice, desc, phModule, phBuildLog );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleCreate( hContext, hDevice, desc, phModule, phBuildLog );
@@ -3929,6 +5272,29 @@ namespace validation_layer
 
         auto result = pfnCreate( hContext, hDevice, desc, phModule, phBuildLog );
 
+        if( result == ZE_RESULT_SUCCESS && context.enableGenerationalHandles ){
+            if( phModule ) *phModule = context.generationalHandles->wrap( *phModule );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phModuleValue = ( result == ZE_RESULT_SUCCESS && phModule ) ? *phModule : nullptr;
+            auto phBuildLogValue = ( result == ZE_RESULT_SUCCESS && phBuildLog ) ? *phBuildLog : nullptr;
+            context.asyncValidation->submit( "zeModuleCreate", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeModuleCreate( hContext, hDevice, desc, phModule, phBuildLog );
+                if( result == ZE_RESULT_SUCCESS ){
+                    if (phModuleValue){
+                        context.handleLifetime->addHandle( phModuleValue );
+                        context.handleLifetime->addDependent( hContext, phModuleValue );
+                    }
+                    if (phBuildLogValue){
+                        context.handleLifetime->addHandle( phBuildLogValue );
+                        context.handleLifetime->addDependent( hContext, phBuildLogValue );
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phModule){
@@ -3957,24 +5323,42 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeModuleDestroy", hModule ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeModuleDestroy( hModule );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleDestroy( hModule );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnDestroy( hModule );
+        auto hModuleLocal = hModule;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hModuleLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        // Released handles are ordered before the driver can hand them out again.
+        bool asyncEnabled = context.enableAsyncValidation;
+        auto asyncSequence = asyncEnabled ? context.asyncValidation->reserve() : 0;
+        auto result = pfnDestroy( hModuleLocal );
+
+        if( result == ZE_RESULT_SUCCESS && context.enableGenerationalHandles ){
+            context.generationalHandles->release( hModule );
+        }
+
+        if( asyncEnabled ){
+            context.asyncValidation->submit( asyncSequence, "zeModuleDestroy", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeModuleDestroy( hModule );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3993,24 +5377,36 @@ namespace validation_layer
         if( nullptr == pfnDynamicLink )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeModuleDynamicLink", nullptr ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeModuleDynamicLink( numModules, phModules, phLinkLog );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleDynamicLink( numModules, phModules, phLinkLog );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnDynamicLink( numModules, phModules, phLinkLog );
+        GenerationalHandleArray<ze_module_handle_t> phModulesLocal( phModules );
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !phModulesLocal.translate( generations, numModules ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnDynamicLink( numModules, phModulesLocal.data(), phLinkLog );
+
+        if( context.enableAsyncValidation ){
+            auto phModulesCopy = AsyncValidation::copy( phModules, numModules );
+            context.asyncValidation->submit( "zeModuleDynamicLink", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeModuleDynamicLink( numModules, phModulesCopy.data(), phLinkLog );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4026,24 +5422,31 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeModuleBuildLogDestroy", hModuleBuildLog ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeModuleBuildLogDestroy( hModuleBuildLog );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleBuildLogDestroy( hModuleBuildLog );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
+        // Released handles are ordered before the driver can hand them out again.
+        bool asyncEnabled = context.enableAsyncValidation;
+        auto asyncSequence = asyncEnabled ? context.asyncValidation->reserve() : 0;
         auto result = pfnDestroy( hModuleBuildLog );
+
+        if( asyncEnabled ){
+            context.asyncValidation->submit( asyncSequence, "zeModuleBuildLogDestroy", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeModuleBuildLogDestroy( hModuleBuildLog );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4061,17 +5464,14 @@ namespace validation_layer
         if( nullptr == pfnGetString )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeModuleBuildLogGetString", hModuleBuildLog ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeModuleBuildLogGetString( hModuleBuildLog, pSize, pBuildLog );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleBuildLogGetString( hModuleBuildLog, pSize, pBuildLog );
@@ -4079,6 +5479,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetString( hModuleBuildLog, pSize, pBuildLog );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeModuleBuildLogGetString", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeModuleBuildLogGetString( hModuleBuildLog, pSize, pBuildLog );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4096,24 +5503,35 @@ namespace validation_layer
         if( nullptr == pfnGetNativeBinary )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeModuleGetNativeBinary", hModule ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeModuleGetNativeBinary( hModule, pSize, pModuleNativeBinary );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleGetNativeBinary( hModule, pSize, pModuleNativeBinary );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnGetNativeBinary( hModule, pSize, pModuleNativeBinary );
+        auto hModuleLocal = hModule;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hModuleLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnGetNativeBinary( hModuleLocal, pSize, pModuleNativeBinary );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeModuleGetNativeBinary", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeModuleGetNativeBinary( hModule, pSize, pModuleNativeBinary );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4132,24 +5550,35 @@ namespace validation_layer
         if( nullptr == pfnGetGlobalPointer )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeModuleGetGlobalPointer", hModule ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeModuleGetGlobalPointer( hModule, pGlobalName, pSize, pptr );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleGetGlobalPointer( hModule, pGlobalName, pSize, pptr );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnGetGlobalPointer( hModule, pGlobalName, pSize, pptr );
+        auto hModuleLocal = hModule;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hModuleLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnGetGlobalPointer( hModuleLocal, pGlobalName, pSize, pptr );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeModuleGetGlobalPointer", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeModuleGetGlobalPointer( hModule, pGlobalName, pSize, pptr );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4173,24 +5602,35 @@ namespace validation_layer
         if( nullptr == pfnGetKernelNames )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeModuleGetKernelNames", hModule ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeModuleGetKernelNames( hModule, pCount, pNames );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleGetKernelNames( hModule, pCount, pNames );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnGetKernelNames( hModule, pCount, pNames );
+        auto hModuleLocal = hModule;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hModuleLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnGetKernelNames( hModuleLocal, pCount, pNames );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeModuleGetKernelNames", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeModuleGetKernelNames( hModule, pCount, pNames );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4207,24 +5647,35 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeModuleGetProperties", hModule ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeModuleGetProperties( hModule, pModuleProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleGetProperties( hModule, pModuleProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnGetProperties( hModule, pModuleProperties );
+        auto hModuleLocal = hModule;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hModuleLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnGetProperties( hModuleLocal, pModuleProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeModuleGetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeModuleGetProperties( hModule, pModuleProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4242,24 +5693,46 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeKernelCreate", hModule ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeKernelCreate( hModule, desc, phKernel );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeKernelCreate( hModule, desc, phKernel );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnCreate( hModule, desc, phKernel );
+        auto hModuleLocal = hModule;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hModuleLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnCreate( hModuleLocal, desc, phKernel );
+
+        if( result == ZE_RESULT_SUCCESS && context.enableGenerationalHandles ){
+            if( phKernel ) *phKernel = context.generationalHandles->wrap( *phKernel );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phKernelValue = ( result == ZE_RESULT_SUCCESS && phKernel ) ? *phKernel : nullptr;
+            context.asyncValidation->submit( "zeKernelCreate", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeKernelCreate( hModule, desc, phKernel );
+                if( result == ZE_RESULT_SUCCESS ){
+                    if (phKernelValue){
+                        context.handleLifetime->addHandle( phKernelValue );
+                        context.handleLifetime->addDependent( hModule, phKernelValue );
+                    }
+                }
+                return check;
+            } );
+        }
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
@@ -4284,15 +5757,17 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeKernelDestroy", hKernel ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeKernelDestroy( hKernel );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hKernel, "zeKernelDestroy" );
         }
 
         
@@ -4301,7 +5776,36 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnDestroy( hKernel );
+        auto hKernelLocal = hKernel;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hKernelLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        // Released handles are ordered before the driver can hand them out again.
+        bool asyncEnabled = context.enableAsyncValidation;
+        auto asyncSequence = asyncEnabled ? context.asyncValidation->reserve() : 0;
+        auto result = pfnDestroy( hKernelLocal );
+
+        if( result == ZE_RESULT_SUCCESS && context.enableGenerationalHandles ){
+            context.generationalHandles->release( hKernel );
+        }
+
+        if( result == ZE_RESULT_SUCCESS ){
+            threadingGuard.retire();
+        }
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->zeKernelDestroy( hKernel );
+        }
+
+        if( asyncEnabled ){
+            context.asyncValidation->submit( asyncSequence, "zeKernelDestroy", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeKernelDestroy( hKernel );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4319,24 +5823,35 @@ namespace validation_layer
         if( nullptr == pfnGetFunctionPointer )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeModuleGetFunctionPointer", hModule ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeModuleGetFunctionPointer( hModule, pFunctionName, pfnFunction );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleGetFunctionPointer( hModule, pFunctionName, pfnFunction );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnGetFunctionPointer( hModule, pFunctionName, pfnFunction );
+        auto hModuleLocal = hModule;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hModuleLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnGetFunctionPointer( hModuleLocal, pFunctionName, pfnFunction );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeModuleGetFunctionPointer", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeModuleGetFunctionPointer( hModule, pFunctionName, pfnFunction );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4355,15 +5870,17 @@ namespace validation_layer
         if( nullptr == pfnSetGroupSize )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeKernelSetGroupSize", hKernel ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeKernelSetGroupSize( hKernel, groupSizeX, groupSizeY, groupSizeZ );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hKernel, "zeKernelSetGroupSize" );
         }
 
         
@@ -4372,7 +5889,25 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnSetGroupSize( hKernel, groupSizeX, groupSizeY, groupSizeZ );
+        auto hKernelLocal = hKernel;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hKernelLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnSetGroupSize( hKernelLocal, groupSizeX, groupSizeY, groupSizeZ );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->kernelChanged( hKernel );
+        }
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeKernelSetGroupSize", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeKernelSetGroupSize( hKernel, groupSizeX, groupSizeY, groupSizeZ );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4394,24 +5929,35 @@ namespace validation_layer
         if( nullptr == pfnSuggestGroupSize )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeKernelSuggestGroupSize", hKernel ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeKernelSuggestGroupSize( hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeKernelSuggestGroupSize( hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnSuggestGroupSize( hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ );
+        auto hKernelLocal = hKernel;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hKernelLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnSuggestGroupSize( hKernelLocal, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeKernelSuggestGroupSize", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeKernelSuggestGroupSize( hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4428,24 +5974,35 @@ namespace validation_layer
         if( nullptr == pfnSuggestMaxCooperativeGroupCount )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeKernelSuggestMaxCooperativeGroupCount", hKernel ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeKernelSuggestMaxCooperativeGroupCount( hKernel, totalGroupCount );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeKernelSuggestMaxCooperativeGroupCount( hKernel, totalGroupCount );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnSuggestMaxCooperativeGroupCount( hKernel, totalGroupCount );
+        auto hKernelLocal = hKernel;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hKernelLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnSuggestMaxCooperativeGroupCount( hKernelLocal, totalGroupCount );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeKernelSuggestMaxCooperativeGroupCount", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeKernelSuggestMaxCooperativeGroupCount( hKernel, totalGroupCount );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4465,15 +6022,17 @@ namespace validation_layer
         if( nullptr == pfnSetArgumentValue )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeKernelSetArgumentValue", hKernel ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeKernelSetArgumentValue( hKernel, argIndex, argSize, pArgValue );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hKernel, "zeKernelSetArgumentValue" );
         }
 
         
@@ -4482,7 +6041,25 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnSetArgumentValue( hKernel, argIndex, argSize, pArgValue );
+        auto hKernelLocal = hKernel;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hKernelLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnSetArgumentValue( hKernelLocal, argIndex, argSize, pArgValue );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->kernelChanged( hKernel );
+        }
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeKernelSetArgumentValue", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeKernelSetArgumentValue( hKernel, argIndex, argSize, pArgValue );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4499,15 +6076,17 @@ namespace validation_layer
         if( nullptr == pfnSetIndirectAccess )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeKernelSetIndirectAccess", hKernel ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeKernelSetIndirectAccess( hKernel, flags );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hKernel, "zeKernelSetIndirectAccess" );
         }
 
         
@@ -4516,7 +6095,25 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnSetIndirectAccess( hKernel, flags );
+        auto hKernelLocal = hKernel;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hKernelLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnSetIndirectAccess( hKernelLocal, flags );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->kernelChanged( hKernel );
+        }
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeKernelSetIndirectAccess", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeKernelSetIndirectAccess( hKernel, flags );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4533,15 +6130,17 @@ namespace validation_layer
         if( nullptr == pfnGetIndirectAccess )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeKernelGetIndirectAccess", hKernel ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeKernelGetIndirectAccess( hKernel, pFlags );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hKernel, "zeKernelGetIndirectAccess" );
         }
 
         
@@ -4550,7 +6149,21 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnGetIndirectAccess( hKernel, pFlags );
+        auto hKernelLocal = hKernel;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hKernelLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnGetIndirectAccess( hKernelLocal, pFlags );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeKernelGetIndirectAccess", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeKernelGetIndirectAccess( hKernel, pFlags );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4575,15 +6188,17 @@ namespace validation_layer
         if( nullptr == pfnGetSourceAttributes )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeKernelGetSourceAttributes", hKernel ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeKernelGetSourceAttributes( hKernel, pSize, pString );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hKernel, "zeKernelGetSourceAttributes" );
         }
 
         
@@ -4592,7 +6207,21 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnGetSourceAttributes( hKernel, pSize, pString );
+        auto hKernelLocal = hKernel;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hKernelLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnGetSourceAttributes( hKernelLocal, pSize, pString );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeKernelGetSourceAttributes", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeKernelGetSourceAttributes( hKernel, pSize, pString );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4610,15 +6239,17 @@ namespace validation_layer
         if( nullptr == pfnSetCacheConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeKernelSetCacheConfig", hKernel ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeKernelSetCacheConfig( hKernel, flags );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hKernel, "zeKernelSetCacheConfig" );
         }
 
         
@@ -4627,7 +6258,25 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnSetCacheConfig( hKernel, flags );
+        auto hKernelLocal = hKernel;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hKernelLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnSetCacheConfig( hKernelLocal, flags );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->kernelChanged( hKernel );
+        }
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeKernelSetCacheConfig", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeKernelSetCacheConfig( hKernel, flags );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4644,24 +6293,35 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeKernelGetProperties", hKernel ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeKernelGetProperties( hKernel, pKernelProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeKernelGetProperties( hKernel, pKernelProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnGetProperties( hKernel, pKernelProperties );
+        auto hKernelLocal = hKernel;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hKernelLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnGetProperties( hKernelLocal, pKernelProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeKernelGetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeKernelGetProperties( hKernel, pKernelProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4680,24 +6340,35 @@ namespace validation_layer
         if( nullptr == pfnGetName )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeKernelGetName", hKernel ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeKernelGetName( hKernel, pSize, pName );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeKernelGetName( hKernel, pSize, pName );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnGetName( hKernel, pSize, pName );
+        auto hKernelLocal = hKernel;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hKernelLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnGetName( hKernelLocal, pSize, pName );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeKernelGetName", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeKernelGetName( hKernel, pSize, pName );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4720,15 +6391,18 @@ namespace validation_layer
         if( nullptr == pfnAppendLaunchKernel )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListAppendLaunchKernel", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListAppendLaunchKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListAppendLaunchKernel" );
+            threadingGuard.shared( hKernel, "zeCommandListAppendLaunchKernel" );
         }
 
         
@@ -4737,7 +6411,35 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendLaunchKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
+        auto hCommandListLocal = hCommandList;
+        auto hKernelLocal = hKernel;
+        auto hSignalEventLocal = hSignalEvent;
+        GenerationalHandleArray<ze_event_handle_t> phWaitEventsLocal( phWaitEvents );
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hKernelLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hSignalEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !phWaitEventsLocal.translate( generations, numWaitEvents ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendLaunchKernel( hCommandListLocal, hKernelLocal, pLaunchFuncArgs, hSignalEventLocal, numWaitEvents, phWaitEventsLocal.data() );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->commandListAppend( "zeCommandListAppendLaunchKernel", hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phWaitEventsCopy = AsyncValidation::copy( phWaitEvents, numWaitEvents );
+            context.asyncValidation->submit( "zeCommandListAppendLaunchKernel", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListAppendLaunchKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEventsCopy.data() );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4760,15 +6462,18 @@ namespace validation_layer
         if( nullptr == pfnAppendLaunchCooperativeKernel )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListAppendLaunchCooperativeKernel", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListAppendLaunchCooperativeKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListAppendLaunchCooperativeKernel" );
+            threadingGuard.shared( hKernel, "zeCommandListAppendLaunchCooperativeKernel" );
         }
 
         
@@ -4777,7 +6482,35 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendLaunchCooperativeKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
+        auto hCommandListLocal = hCommandList;
+        auto hKernelLocal = hKernel;
+        auto hSignalEventLocal = hSignalEvent;
+        GenerationalHandleArray<ze_event_handle_t> phWaitEventsLocal( phWaitEvents );
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hKernelLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hSignalEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !phWaitEventsLocal.translate( generations, numWaitEvents ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendLaunchCooperativeKernel( hCommandListLocal, hKernelLocal, pLaunchFuncArgs, hSignalEventLocal, numWaitEvents, phWaitEventsLocal.data() );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->commandListAppend( "zeCommandListAppendLaunchCooperativeKernel", hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phWaitEventsCopy = AsyncValidation::copy( phWaitEvents, numWaitEvents );
+            context.asyncValidation->submit( "zeCommandListAppendLaunchCooperativeKernel", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListAppendLaunchCooperativeKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEventsCopy.data() );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4801,15 +6534,18 @@ namespace validation_layer
         if( nullptr == pfnAppendLaunchKernelIndirect )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListAppendLaunchKernelIndirect", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListAppendLaunchKernelIndirect( hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListAppendLaunchKernelIndirect" );
+            threadingGuard.shared( hKernel, "zeCommandListAppendLaunchKernelIndirect" );
         }
 
         
@@ -4818,7 +6554,35 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendLaunchKernelIndirect( hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
+        auto hCommandListLocal = hCommandList;
+        auto hKernelLocal = hKernel;
+        auto hSignalEventLocal = hSignalEvent;
+        GenerationalHandleArray<ze_event_handle_t> phWaitEventsLocal( phWaitEvents );
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hKernelLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hSignalEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !phWaitEventsLocal.translate( generations, numWaitEvents ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendLaunchKernelIndirect( hCommandListLocal, hKernelLocal, pLaunchArgumentsBuffer, hSignalEventLocal, numWaitEvents, phWaitEventsLocal.data() );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->zeCommandListAppendLaunchKernelIndirect( hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phWaitEventsCopy = AsyncValidation::copy( phWaitEvents, numWaitEvents );
+            context.asyncValidation->submit( "zeCommandListAppendLaunchKernelIndirect", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListAppendLaunchKernelIndirect( hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEventsCopy.data() );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4846,15 +6610,17 @@ namespace validation_layer
         if( nullptr == pfnAppendLaunchMultipleKernelsIndirect )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListAppendLaunchMultipleKernelsIndirect", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListAppendLaunchMultipleKernelsIndirect( hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListAppendLaunchMultipleKernelsIndirect" );
         }
 
         
@@ -4863,7 +6629,36 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendLaunchMultipleKernelsIndirect( hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
+        auto hCommandListLocal = hCommandList;
+        GenerationalHandleArray<ze_kernel_handle_t> phKernelsLocal( phKernels );
+        auto hSignalEventLocal = hSignalEvent;
+        GenerationalHandleArray<ze_event_handle_t> phWaitEventsLocal( phWaitEvents );
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !phKernelsLocal.translate( generations, numKernels ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hSignalEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !phWaitEventsLocal.translate( generations, numWaitEvents ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendLaunchMultipleKernelsIndirect( hCommandListLocal, numKernels, phKernelsLocal.data(), pCountBuffer, pLaunchArgumentsBuffer, hSignalEventLocal, numWaitEvents, phWaitEventsLocal.data() );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->zeCommandListAppendLaunchMultipleKernelsIndirect( hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phKernelsCopy = AsyncValidation::copy( phKernels, numKernels );
+            auto phWaitEventsCopy = AsyncValidation::copy( phWaitEvents, numWaitEvents );
+            context.asyncValidation->submit( "zeCommandListAppendLaunchMultipleKernelsIndirect", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListAppendLaunchMultipleKernelsIndirect( hCommandList, numKernels, phKernelsCopy.data(), pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEventsCopy.data() );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4882,17 +6677,14 @@ namespace validation_layer
         if( nullptr == pfnMakeMemoryResident )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeContextMakeMemoryResident", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeContextMakeMemoryResident( hContext, hDevice, ptr, size );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeContextMakeMemoryResident( hContext, hDevice, ptr, size );
@@ -4900,6 +6692,13 @@ namespace validation_layer
         }
 
         auto result = pfnMakeMemoryResident( hContext, hDevice, ptr, size );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeContextMakeMemoryResident", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeContextMakeMemoryResident( hContext, hDevice, ptr, size );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4918,17 +6717,14 @@ namespace validation_layer
         if( nullptr == pfnEvictMemory )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeContextEvictMemory", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeContextEvictMemory( hContext, hDevice, ptr, size );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeContextEvictMemory( hContext, hDevice, ptr, size );
@@ -4936,6 +6732,13 @@ namespace validation_layer
         }
 
         auto result = pfnEvictMemory( hContext, hDevice, ptr, size );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeContextEvictMemory", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeContextEvictMemory( hContext, hDevice, ptr, size );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4953,17 +6756,14 @@ namespace validation_layer
         if( nullptr == pfnMakeImageResident )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeContextMakeImageResident", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeContextMakeImageResident( hContext, hDevice, hImage );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeContextMakeImageResident( hContext, hDevice, hImage );
@@ -4971,6 +6771,13 @@ namespace validation_layer
         }
 
         auto result = pfnMakeImageResident( hContext, hDevice, hImage );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeContextMakeImageResident", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeContextMakeImageResident( hContext, hDevice, hImage );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4988,17 +6795,14 @@ namespace validation_layer
         if( nullptr == pfnEvictImage )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeContextEvictImage", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeContextEvictImage( hContext, hDevice, hImage );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeContextEvictImage( hContext, hDevice, hImage );
@@ -5006,6 +6810,13 @@ namespace validation_layer
         }
 
         auto result = pfnEvictImage( hContext, hDevice, hImage );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeContextEvictImage", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeContextEvictImage( hContext, hDevice, hImage );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -5024,17 +6835,14 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeSamplerCreate", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeSamplerCreate( hContext, hDevice, desc, phSampler );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeSamplerCreate( hContext, hDevice, desc, phSampler );
@@ -5043,6 +6851,20 @@ namespace validation_layer
 
         auto result = pfnCreate( hContext, hDevice, desc, phSampler );
 
+        if( context.enableAsyncValidation ){
+            auto phSamplerValue = ( result == ZE_RESULT_SUCCESS && phSampler ) ? *phSampler : nullptr;
+            context.asyncValidation->submit( "zeSamplerCreate", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeSamplerCreate( hContext, hDevice, desc, phSampler );
+                if( result == ZE_RESULT_SUCCESS ){
+                    if (phSamplerValue){
+                        context.handleLifetime->addHandle( phSamplerValue );
+                        context.handleLifetime->addDependent( hContext, phSamplerValue );
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phSampler){
@@ -5066,24 +6888,31 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeSamplerDestroy", hSampler ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeSamplerDestroy( hSampler );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeSamplerDestroy( hSampler );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
+        // Released handles are ordered before the driver can hand them out again.
+        bool asyncEnabled = context.enableAsyncValidation;
+        auto asyncSequence = asyncEnabled ? context.asyncValidation->reserve() : 0;
         auto result = pfnDestroy( hSampler );
+
+        if( asyncEnabled ){
+            context.asyncValidation->submit( asyncSequence, "zeSamplerDestroy", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeSamplerDestroy( hSampler );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -5103,17 +6932,14 @@ namespace validation_layer
         if( nullptr == pfnReserve )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeVirtualMemReserve", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeVirtualMemReserve( hContext, pStart, size, pptr );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeVirtualMemReserve( hContext, pStart, size, pptr );
@@ -5121,6 +6947,13 @@ namespace validation_layer
         }
 
         auto result = pfnReserve( hContext, pStart, size, pptr );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeVirtualMemReserve", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeVirtualMemReserve( hContext, pStart, size, pptr );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -5138,17 +6971,14 @@ namespace validation_layer
         if( nullptr == pfnFree )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeVirtualMemFree", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeVirtualMemFree( hContext, ptr, size );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeVirtualMemFree( hContext, ptr, size );
@@ -5156,6 +6986,13 @@ namespace validation_layer
         }
 
         auto result = pfnFree( hContext, ptr, size );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeVirtualMemFree", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeVirtualMemFree( hContext, ptr, size );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -5175,17 +7012,14 @@ namespace validation_layer
         if( nullptr == pfnQueryPageSize )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeVirtualMemQueryPageSize", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeVirtualMemQueryPageSize( hContext, hDevice, size, pagesize );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeVirtualMemQueryPageSize( hContext, hDevice, size, pagesize );
@@ -5193,6 +7027,13 @@ namespace validation_layer
         }
 
         auto result = pfnQueryPageSize( hContext, hDevice, size, pagesize );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeVirtualMemQueryPageSize", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeVirtualMemQueryPageSize( hContext, hDevice, size, pagesize );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -5211,17 +7052,14 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zePhysicalMemCreate", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zePhysicalMemCreate( hContext, hDevice, desc, phPhysicalMemory );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zePhysicalMemCreate( hContext, hDevice, desc, phPhysicalMemory );
@@ -5230,6 +7068,20 @@ namespace validation_layer
 
         auto result = pfnCreate( hContext, hDevice, desc, phPhysicalMemory );
 
+        if( context.enableAsyncValidation ){
+            auto phPhysicalMemoryValue = ( result == ZE_RESULT_SUCCESS && phPhysicalMemory ) ? *phPhysicalMemory : nullptr;
+            context.asyncValidation->submit( "zePhysicalMemCreate", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zePhysicalMemCreate( hContext, hDevice, desc, phPhysicalMemory );
+                if( result == ZE_RESULT_SUCCESS ){
+                    if (phPhysicalMemoryValue){
+                        context.handleLifetime->addHandle( phPhysicalMemoryValue );
+                        context.handleLifetime->addDependent( hContext, phPhysicalMemoryValue );
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phPhysicalMemory){
@@ -5254,24 +7106,31 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zePhysicalMemDestroy", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zePhysicalMemDestroy( hContext, hPhysicalMemory );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zePhysicalMemDestroy( hContext, hPhysicalMemory );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
+        // Released handles are ordered before the driver can hand them out again.
+        bool asyncEnabled = context.enableAsyncValidation;
+        auto asyncSequence = asyncEnabled ? context.asyncValidation->reserve() : 0;
         auto result = pfnDestroy( hContext, hPhysicalMemory );
+
+        if( asyncEnabled ){
+            context.asyncValidation->submit( asyncSequence, "zePhysicalMemDestroy", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zePhysicalMemDestroy( hContext, hPhysicalMemory );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -5295,17 +7154,14 @@ namespace validation_layer
         if( nullptr == pfnMap )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeVirtualMemMap", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeVirtualMemMap( hContext, ptr, size, hPhysicalMemory, offset, access );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeVirtualMemMap( hContext, ptr, size, hPhysicalMemory, offset, access );
@@ -5313,6 +7169,13 @@ namespace validation_layer
         }
 
         auto result = pfnMap( hContext, ptr, size, hPhysicalMemory, offset, access );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeVirtualMemMap", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeVirtualMemMap( hContext, ptr, size, hPhysicalMemory, offset, access );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -5330,17 +7193,14 @@ namespace validation_layer
         if( nullptr == pfnUnmap )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeVirtualMemUnmap", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeVirtualMemUnmap( hContext, ptr, size );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeVirtualMemUnmap( hContext, ptr, size );
@@ -5348,6 +7208,13 @@ namespace validation_layer
         }
 
         auto result = pfnUnmap( hContext, ptr, size );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeVirtualMemUnmap", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeVirtualMemUnmap( hContext, ptr, size );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -5367,17 +7234,14 @@ namespace validation_layer
         if( nullptr == pfnSetAccessAttribute )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeVirtualMemSetAccessAttribute", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeVirtualMemSetAccessAttribute( hContext, ptr, size, access );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeVirtualMemSetAccessAttribute( hContext, ptr, size, access );
@@ -5385,6 +7249,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetAccessAttribute( hContext, ptr, size, access );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeVirtualMemSetAccessAttribute", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeVirtualMemSetAccessAttribute( hContext, ptr, size, access );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -5405,17 +7276,14 @@ namespace validation_layer
         if( nullptr == pfnGetAccessAttribute )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeVirtualMemGetAccessAttribute", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeVirtualMemGetAccessAttribute( hContext, ptr, size, access, outSize );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeVirtualMemGetAccessAttribute( hContext, ptr, size, access, outSize );
@@ -5423,6 +7291,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetAccessAttribute( hContext, ptr, size, access, outSize );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeVirtualMemGetAccessAttribute", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeVirtualMemGetAccessAttribute( hContext, ptr, size, access, outSize );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -5441,15 +7316,17 @@ namespace validation_layer
         if( nullptr == pfnSetGlobalOffsetExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeKernelSetGlobalOffsetExp", hKernel ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeKernelSetGlobalOffsetExp( hKernel, offsetX, offsetY, offsetZ );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hKernel, "zeKernelSetGlobalOffsetExp" );
         }
 
         
@@ -5458,7 +7335,25 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnSetGlobalOffsetExp( hKernel, offsetX, offsetY, offsetZ );
+        auto hKernelLocal = hKernel;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hKernelLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnSetGlobalOffsetExp( hKernelLocal, offsetX, offsetY, offsetZ );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->kernelChanged( hKernel );
+        }
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeKernelSetGlobalOffsetExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeKernelSetGlobalOffsetExp( hKernel, offsetX, offsetY, offsetZ );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -5479,17 +7374,14 @@ namespace validation_layer
         if( nullptr == pfnReserveCacheExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDeviceReserveCacheExt", hDevice ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDeviceReserveCacheExt( hDevice, cacheLevel, cacheReservationSize );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceReserveCacheExt( hDevice, cacheLevel, cacheReservationSize );
@@ -5497,6 +7389,13 @@ namespace validation_layer
         }
 
         auto result = pfnReserveCacheExt( hDevice, cacheLevel, cacheReservationSize );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeDeviceReserveCacheExt", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDeviceReserveCacheExt( hDevice, cacheLevel, cacheReservationSize );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -5515,17 +7414,14 @@ namespace validation_layer
         if( nullptr == pfnSetCacheAdviceExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDeviceSetCacheAdviceExt", hDevice ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDeviceSetCacheAdviceExt( hDevice, ptr, regionSize, cacheRegion );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceSetCacheAdviceExt( hDevice, ptr, regionSize, cacheRegion );
@@ -5533,6 +7429,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetCacheAdviceExt( hDevice, ptr, regionSize, cacheRegion );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeDeviceSetCacheAdviceExt", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDeviceSetCacheAdviceExt( hDevice, ptr, regionSize, cacheRegion );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -5557,24 +7460,35 @@ namespace validation_layer
         if( nullptr == pfnQueryTimestampsExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeEventQueryTimestampsExp", hEvent ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeEventQueryTimestampsExp( hEvent, hDevice, pCount, pTimestamps );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventQueryTimestampsExp( hEvent, hDevice, pCount, pTimestamps );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnQueryTimestampsExp( hEvent, hDevice, pCount, pTimestamps );
+        auto hEventLocal = hEvent;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnQueryTimestampsExp( hEventLocal, hDevice, pCount, pTimestamps );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeEventQueryTimestampsExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeEventQueryTimestampsExp( hEvent, hDevice, pCount, pTimestamps );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -5591,17 +7505,14 @@ namespace validation_layer
         if( nullptr == pfnGetMemoryPropertiesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeImageGetMemoryPropertiesExp", hImage ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeImageGetMemoryPropertiesExp( hImage, pMemoryProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeImageGetMemoryPropertiesExp( hImage, pMemoryProperties );
@@ -5610,6 +7521,15 @@ namespace validation_layer
 
         auto result = pfnGetMemoryPropertiesExp( hImage, pMemoryProperties );
 
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeImageGetMemoryPropertiesExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeImageGetMemoryPropertiesExp( hImage, pMemoryProperties );
+                if( result == ZE_RESULT_SUCCESS ){
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
         }
@@ -5632,17 +7552,14 @@ namespace validation_layer
         if( nullptr == pfnViewCreateExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeImageViewCreateExt", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeImageViewCreateExt( hContext, hDevice, desc, hImage, phImageView );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeImageViewCreateExt( hContext, hDevice, desc, hImage, phImageView );
@@ -5651,6 +7568,20 @@ namespace validation_layer
 
         auto result = pfnViewCreateExt( hContext, hDevice, desc, hImage, phImageView );
 
+        if( context.enableAsyncValidation ){
+            auto phImageViewValue = ( result == ZE_RESULT_SUCCESS && phImageView ) ? *phImageView : nullptr;
+            context.asyncValidation->submit( "zeImageViewCreateExt", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeImageViewCreateExt( hContext, hDevice, desc, hImage, phImageView );
+                if( result == ZE_RESULT_SUCCESS ){
+                    if (phImageViewValue){
+                        context.handleLifetime->addHandle( phImageViewValue );
+                        context.handleLifetime->addDependent( hContext, phImageViewValue );
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phImageView){
@@ -5678,17 +7609,14 @@ namespace validation_layer
         if( nullptr == pfnViewCreateExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeImageViewCreateExp", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeImageViewCreateExp( hContext, hDevice, desc, hImage, phImageView );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeImageViewCreateExp( hContext, hDevice, desc, hImage, phImageView );
@@ -5697,6 +7625,20 @@ namespace validation_layer
 
         auto result = pfnViewCreateExp( hContext, hDevice, desc, hImage, phImageView );
 
+        if( context.enableAsyncValidation ){
+            auto phImageViewValue = ( result == ZE_RESULT_SUCCESS && phImageView ) ? *phImageView : nullptr;
+            context.asyncValidation->submit( "zeImageViewCreateExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeImageViewCreateExp( hContext, hDevice, desc, hImage, phImageView );
+                if( result == ZE_RESULT_SUCCESS ){
+                    if (phImageViewValue){
+                        context.handleLifetime->addHandle( phImageViewValue );
+                        context.handleLifetime->addDependent( hContext, phImageViewValue );
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phImageView){
@@ -5721,15 +7663,17 @@ namespace validation_layer
         if( nullptr == pfnSchedulingHintExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeKernelSchedulingHintExp", hKernel ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeKernelSchedulingHintExp( hKernel, pHint );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hKernel, "zeKernelSchedulingHintExp" );
         }
 
         
@@ -5738,7 +7682,25 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnSchedulingHintExp( hKernel, pHint );
+        auto hKernelLocal = hKernel;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hKernelLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnSchedulingHintExp( hKernelLocal, pHint );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->kernelChanged( hKernel );
+        }
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeKernelSchedulingHintExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeKernelSchedulingHintExp( hKernel, pHint );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -5755,17 +7717,14 @@ namespace validation_layer
         if( nullptr == pfnPciGetPropertiesExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDevicePciGetPropertiesExt", hDevice ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDevicePciGetPropertiesExt( hDevice, pPciProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDevicePciGetPropertiesExt( hDevice, pPciProperties );
@@ -5773,6 +7732,13 @@ namespace validation_layer
         }
 
         auto result = pfnPciGetPropertiesExt( hDevice, pPciProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeDevicePciGetPropertiesExt", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDevicePciGetPropertiesExt( hDevice, pPciProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -5800,15 +7766,17 @@ namespace validation_layer
         if( nullptr == pfnAppendImageCopyToMemoryExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListAppendImageCopyToMemoryExt", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListAppendImageCopyToMemoryExt( hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListAppendImageCopyToMemoryExt" );
         }
 
         
@@ -5817,7 +7785,32 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendImageCopyToMemoryExt( hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
+        auto hCommandListLocal = hCommandList;
+        auto hSignalEventLocal = hSignalEvent;
+        GenerationalHandleArray<ze_event_handle_t> phWaitEventsLocal( phWaitEvents );
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hSignalEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !phWaitEventsLocal.translate( generations, numWaitEvents ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendImageCopyToMemoryExt( hCommandListLocal, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEventLocal, numWaitEvents, phWaitEventsLocal.data() );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->commandListAppend( "zeCommandListAppendImageCopyToMemoryExt", hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phWaitEventsCopy = AsyncValidation::copy( phWaitEvents, numWaitEvents );
+            context.asyncValidation->submit( "zeCommandListAppendImageCopyToMemoryExt", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListAppendImageCopyToMemoryExt( hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEventsCopy.data() );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -5845,15 +7838,17 @@ namespace validation_layer
         if( nullptr == pfnAppendImageCopyFromMemoryExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListAppendImageCopyFromMemoryExt", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListAppendImageCopyFromMemoryExt( hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListAppendImageCopyFromMemoryExt" );
         }
 
         
@@ -5862,7 +7857,32 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendImageCopyFromMemoryExt( hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
+        auto hCommandListLocal = hCommandList;
+        auto hSignalEventLocal = hSignalEvent;
+        GenerationalHandleArray<ze_event_handle_t> phWaitEventsLocal( phWaitEvents );
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hSignalEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !phWaitEventsLocal.translate( generations, numWaitEvents ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendImageCopyFromMemoryExt( hCommandListLocal, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEventLocal, numWaitEvents, phWaitEventsLocal.data() );
+
+        if( result == ZE_RESULT_SUCCESS && context.enablePerformanceAdvisor ){
+            context.performanceAdvisor->commandListAppend( "zeCommandListAppendImageCopyFromMemoryExt", hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phWaitEventsCopy = AsyncValidation::copy( phWaitEvents, numWaitEvents );
+            context.asyncValidation->submit( "zeCommandListAppendImageCopyFromMemoryExt", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListAppendImageCopyFromMemoryExt( hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEventsCopy.data() );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -5880,17 +7900,14 @@ namespace validation_layer
         if( nullptr == pfnGetAllocPropertiesExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeImageGetAllocPropertiesExt", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeImageGetAllocPropertiesExt( hContext, hImage, pImageAllocProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeImageGetAllocPropertiesExt( hContext, hImage, pImageAllocProperties );
@@ -5898,6 +7915,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetAllocPropertiesExt( hContext, hImage, pImageAllocProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeImageGetAllocPropertiesExt", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeImageGetAllocPropertiesExt( hContext, hImage, pImageAllocProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -5918,24 +7942,36 @@ namespace validation_layer
         if( nullptr == pfnInspectLinkageExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeModuleInspectLinkageExt", nullptr ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeModuleInspectLinkageExt( pInspectDesc, numModules, phModules, phLog );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeModuleInspectLinkageExt( pInspectDesc, numModules, phModules, phLog );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnInspectLinkageExt( pInspectDesc, numModules, phModules, phLog );
+        GenerationalHandleArray<ze_module_handle_t> phModulesLocal( phModules );
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !phModulesLocal.translate( generations, numModules ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnInspectLinkageExt( pInspectDesc, numModules, phModulesLocal.data(), phLog );
+
+        if( context.enableAsyncValidation ){
+            auto phModulesCopy = AsyncValidation::copy( phModules, numModules );
+            context.asyncValidation->submit( "zeModuleInspectLinkageExt", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeModuleInspectLinkageExt( pInspectDesc, numModules, phModulesCopy.data(), phLog );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -5953,24 +7989,37 @@ namespace validation_layer
         if( nullptr == pfnFreeExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeMemFreeExt", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeMemFreeExt( hContext, pMemFreeDesc, ptr );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemFreeExt( hContext, pMemFreeDesc, ptr );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
+        if( context.enableMemoryTracker ){
+            auto result = context.memoryTracker->zeMemFreeExt( hContext, pMemFreeDesc, ptr );
+            if(result!=ZE_RESULT_SUCCESS) return result;
+        }
+
         auto result = pfnFreeExt( hContext, pMemFreeDesc, ptr );
+
+        if( result == ZE_RESULT_SUCCESS && context.enableMemoryTracker ){
+            context.memoryTracker->zeMemFreeExtEpilogue( hContext, pMemFreeDesc, ptr );
+        }
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeMemFreeExt", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeMemFreeExt( hContext, pMemFreeDesc, ptr );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -5995,17 +8044,14 @@ namespace validation_layer
         if( nullptr == pfnGetExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeFabricVertexGetExp", hDriver ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeFabricVertexGetExp( hDriver, pCount, phVertices );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeFabricVertexGetExp( hDriver, pCount, phVertices );
@@ -6014,6 +8060,22 @@ namespace validation_layer
 
         auto result = pfnGetExp( hDriver, pCount, phVertices );
 
+        if( context.enableAsyncValidation ){
+            auto phVerticesCopy = AsyncValidation::copy( phVertices, ( result == ZE_RESULT_SUCCESS && nullptr != phVertices ) ? *pCount : 0 );
+            context.asyncValidation->submit( "zeFabricVertexGetExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeFabricVertexGetExp( hDriver, pCount, phVertices );
+                if( result == ZE_RESULT_SUCCESS ){
+                    for (size_t i = 0; i < phVerticesCopy.size(); ++i){
+                        if (phVerticesCopy[i]){
+                            context.handleLifetime->addHandle( phVerticesCopy[i] );
+                            context.handleLifetime->addDependent( hDriver, phVerticesCopy[i] );
+                        }
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             for (size_t i = 0; ( nullptr != phVertices) && (i < *pCount); ++i){
@@ -6047,17 +8109,14 @@ namespace validation_layer
         if( nullptr == pfnGetSubVerticesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeFabricVertexGetSubVerticesExp", hVertex ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeFabricVertexGetSubVerticesExp( hVertex, pCount, phSubvertices );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeFabricVertexGetSubVerticesExp( hVertex, pCount, phSubvertices );
@@ -6066,6 +8125,22 @@ namespace validation_layer
 
         auto result = pfnGetSubVerticesExp( hVertex, pCount, phSubvertices );
 
+        if( context.enableAsyncValidation ){
+            auto phSubverticesCopy = AsyncValidation::copy( phSubvertices, ( result == ZE_RESULT_SUCCESS && nullptr != phSubvertices ) ? *pCount : 0 );
+            context.asyncValidation->submit( "zeFabricVertexGetSubVerticesExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeFabricVertexGetSubVerticesExp( hVertex, pCount, phSubvertices );
+                if( result == ZE_RESULT_SUCCESS ){
+                    for (size_t i = 0; i < phSubverticesCopy.size(); ++i){
+                        if (phSubverticesCopy[i]){
+                            context.handleLifetime->addHandle( phSubverticesCopy[i] );
+                            context.handleLifetime->addDependent( hVertex, phSubverticesCopy[i] );
+                        }
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             for (size_t i = 0; ( nullptr != phSubvertices) && (i < *pCount); ++i){
@@ -6091,17 +8166,14 @@ namespace validation_layer
         if( nullptr == pfnGetPropertiesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeFabricVertexGetPropertiesExp", hVertex ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeFabricVertexGetPropertiesExp( hVertex, pVertexProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeFabricVertexGetPropertiesExp( hVertex, pVertexProperties );
@@ -6110,6 +8182,15 @@ namespace validation_layer
 
         auto result = pfnGetPropertiesExp( hVertex, pVertexProperties );
 
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeFabricVertexGetPropertiesExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeFabricVertexGetPropertiesExp( hVertex, pVertexProperties );
+                if( result == ZE_RESULT_SUCCESS ){
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
         }
@@ -6129,17 +8210,14 @@ namespace validation_layer
         if( nullptr == pfnGetDeviceExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeFabricVertexGetDeviceExp", hVertex ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeFabricVertexGetDeviceExp( hVertex, phDevice );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeFabricVertexGetDeviceExp( hVertex, phDevice );
@@ -6148,6 +8226,20 @@ namespace validation_layer
 
         auto result = pfnGetDeviceExp( hVertex, phDevice );
 
+        if( context.enableAsyncValidation ){
+            auto phDeviceValue = ( result == ZE_RESULT_SUCCESS && phDevice ) ? *phDevice : nullptr;
+            context.asyncValidation->submit( "zeFabricVertexGetDeviceExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeFabricVertexGetDeviceExp( hVertex, phDevice );
+                if( result == ZE_RESULT_SUCCESS ){
+                    if (phDeviceValue){
+                        context.handleLifetime->addHandle( phDeviceValue );
+                        context.handleLifetime->addDependent( hVertex, phDeviceValue );
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phDevice){
@@ -6172,17 +8264,14 @@ namespace validation_layer
         if( nullptr == pfnGetFabricVertexExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDeviceGetFabricVertexExp", hDevice ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDeviceGetFabricVertexExp( hDevice, phVertex );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDeviceGetFabricVertexExp( hDevice, phVertex );
@@ -6191,6 +8280,20 @@ namespace validation_layer
 
         auto result = pfnGetFabricVertexExp( hDevice, phVertex );
 
+        if( context.enableAsyncValidation ){
+            auto phVertexValue = ( result == ZE_RESULT_SUCCESS && phVertex ) ? *phVertex : nullptr;
+            context.asyncValidation->submit( "zeDeviceGetFabricVertexExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDeviceGetFabricVertexExp( hDevice, phVertex );
+                if( result == ZE_RESULT_SUCCESS ){
+                    if (phVertexValue){
+                        context.handleLifetime->addHandle( phVertexValue );
+                        context.handleLifetime->addDependent( hDevice, phVertexValue );
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phVertex){
@@ -6224,17 +8327,14 @@ namespace validation_layer
         if( nullptr == pfnGetExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeFabricEdgeGetExp", hVertexA ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeFabricEdgeGetExp( hVertexA, hVertexB, pCount, phEdges );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeFabricEdgeGetExp( hVertexA, hVertexB, pCount, phEdges );
@@ -6243,6 +8343,22 @@ namespace validation_layer
 
         auto result = pfnGetExp( hVertexA, hVertexB, pCount, phEdges );
 
+        if( context.enableAsyncValidation ){
+            auto phEdgesCopy = AsyncValidation::copy( phEdges, ( result == ZE_RESULT_SUCCESS && nullptr != phEdges ) ? *pCount : 0 );
+            context.asyncValidation->submit( "zeFabricEdgeGetExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeFabricEdgeGetExp( hVertexA, hVertexB, pCount, phEdges );
+                if( result == ZE_RESULT_SUCCESS ){
+                    for (size_t i = 0; i < phEdgesCopy.size(); ++i){
+                        if (phEdgesCopy[i]){
+                            context.handleLifetime->addHandle( phEdgesCopy[i] );
+                            context.handleLifetime->addDependent( hVertexA, phEdgesCopy[i] );
+                        }
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             for (size_t i = 0; ( nullptr != phEdges) && (i < *pCount); ++i){
@@ -6269,17 +8385,14 @@ namespace validation_layer
         if( nullptr == pfnGetVerticesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeFabricEdgeGetVerticesExp", hEdge ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeFabricEdgeGetVerticesExp( hEdge, phVertexA, phVertexB );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeFabricEdgeGetVerticesExp( hEdge, phVertexA, phVertexB );
@@ -6288,6 +8401,25 @@ namespace validation_layer
 
         auto result = pfnGetVerticesExp( hEdge, phVertexA, phVertexB );
 
+        if( context.enableAsyncValidation ){
+            auto phVertexAValue = ( result == ZE_RESULT_SUCCESS && phVertexA ) ? *phVertexA : nullptr;
+            auto phVertexBValue = ( result == ZE_RESULT_SUCCESS && phVertexB ) ? *phVertexB : nullptr;
+            context.asyncValidation->submit( "zeFabricEdgeGetVerticesExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeFabricEdgeGetVerticesExp( hEdge, phVertexA, phVertexB );
+                if( result == ZE_RESULT_SUCCESS ){
+                    if (phVertexAValue){
+                        context.handleLifetime->addHandle( phVertexAValue );
+                        context.handleLifetime->addDependent( hEdge, phVertexAValue );
+                    }
+                    if (phVertexBValue){
+                        context.handleLifetime->addHandle( phVertexBValue );
+                        context.handleLifetime->addDependent( hEdge, phVertexBValue );
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phVertexA){
@@ -6317,17 +8449,14 @@ namespace validation_layer
         if( nullptr == pfnGetPropertiesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeFabricEdgeGetPropertiesExp", hEdge ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeFabricEdgeGetPropertiesExp( hEdge, pEdgeProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeFabricEdgeGetPropertiesExp( hEdge, pEdgeProperties );
@@ -6336,6 +8465,15 @@ namespace validation_layer
 
         auto result = pfnGetPropertiesExp( hEdge, pEdgeProperties );
 
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeFabricEdgeGetPropertiesExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeFabricEdgeGetPropertiesExp( hEdge, pEdgeProperties );
+                if( result == ZE_RESULT_SUCCESS ){
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
         }
@@ -6370,24 +8508,35 @@ namespace validation_layer
         if( nullptr == pfnQueryKernelTimestampsExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeEventQueryKernelTimestampsExt", hEvent ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeEventQueryKernelTimestampsExt( hEvent, hDevice, pCount, pResults );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeEventQueryKernelTimestampsExt( hEvent, hDevice, pCount, pResults );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnQueryKernelTimestampsExt( hEvent, hDevice, pCount, pResults );
+        auto hEventLocal = hEvent;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnQueryKernelTimestampsExt( hEventLocal, hDevice, pCount, pResults );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeEventQueryKernelTimestampsExt", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeEventQueryKernelTimestampsExt( hEvent, hDevice, pCount, pResults );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -6405,17 +8554,14 @@ namespace validation_layer
         if( nullptr == pfnCreateExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeRTASBuilderCreateExp", hDriver ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeRTASBuilderCreateExp( hDriver, pDescriptor, phBuilder );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASBuilderCreateExp( hDriver, pDescriptor, phBuilder );
@@ -6424,6 +8570,20 @@ namespace validation_layer
 
         auto result = pfnCreateExp( hDriver, pDescriptor, phBuilder );
 
+        if( context.enableAsyncValidation ){
+            auto phBuilderValue = ( result == ZE_RESULT_SUCCESS && phBuilder ) ? *phBuilder : nullptr;
+            context.asyncValidation->submit( "zeRTASBuilderCreateExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeRTASBuilderCreateExp( hDriver, pDescriptor, phBuilder );
+                if( result == ZE_RESULT_SUCCESS ){
+                    if (phBuilderValue){
+                        context.handleLifetime->addHandle( phBuilderValue );
+                        context.handleLifetime->addDependent( hDriver, phBuilderValue );
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phBuilder){
@@ -6449,17 +8609,14 @@ namespace validation_layer
         if( nullptr == pfnGetBuildPropertiesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeRTASBuilderGetBuildPropertiesExp", hBuilder ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeRTASBuilderGetBuildPropertiesExp( hBuilder, pBuildOpDescriptor, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASBuilderGetBuildPropertiesExp( hBuilder, pBuildOpDescriptor, pProperties );
@@ -6468,6 +8625,15 @@ namespace validation_layer
 
         auto result = pfnGetBuildPropertiesExp( hBuilder, pBuildOpDescriptor, pProperties );
 
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeRTASBuilderGetBuildPropertiesExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeRTASBuilderGetBuildPropertiesExp( hBuilder, pBuildOpDescriptor, pProperties );
+                if( result == ZE_RESULT_SUCCESS ){
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
         }
@@ -6488,17 +8654,14 @@ namespace validation_layer
         if( nullptr == pfnRTASFormatCompatibilityCheckExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeDriverRTASFormatCompatibilityCheckExp", hDriver ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeDriverRTASFormatCompatibilityCheckExp( hDriver, rtasFormatA, rtasFormatB );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeDriverRTASFormatCompatibilityCheckExp( hDriver, rtasFormatA, rtasFormatB );
@@ -6506,6 +8669,13 @@ namespace validation_layer
         }
 
         auto result = pfnRTASFormatCompatibilityCheckExp( hDriver, rtasFormatA, rtasFormatB );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeDriverRTASFormatCompatibilityCheckExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeDriverRTASFormatCompatibilityCheckExp( hDriver, rtasFormatA, rtasFormatB );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -6533,17 +8703,14 @@ namespace validation_layer
         if( nullptr == pfnBuildExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeRTASBuilderBuildExp", hBuilder ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeRTASBuilderBuildExp( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASBuilderBuildExp( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes );
@@ -6551,6 +8718,13 @@ namespace validation_layer
         }
 
         auto result = pfnBuildExp( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeRTASBuilderBuildExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeRTASBuilderBuildExp( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -6566,17 +8740,14 @@ namespace validation_layer
         if( nullptr == pfnDestroyExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeRTASBuilderDestroyExp", hBuilder ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeRTASBuilderDestroyExp( hBuilder );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASBuilderDestroyExp( hBuilder );
@@ -6584,6 +8755,13 @@ namespace validation_layer
         }
 
         auto result = pfnDestroyExp( hBuilder );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeRTASBuilderDestroyExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeRTASBuilderDestroyExp( hBuilder );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -6600,17 +8778,14 @@ namespace validation_layer
         if( nullptr == pfnCreateExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeRTASParallelOperationCreateExp", hDriver ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeRTASParallelOperationCreateExp( hDriver, phParallelOperation );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASParallelOperationCreateExp( hDriver, phParallelOperation );
@@ -6619,6 +8794,20 @@ namespace validation_layer
 
         auto result = pfnCreateExp( hDriver, phParallelOperation );
 
+        if( context.enableAsyncValidation ){
+            auto phParallelOperationValue = ( result == ZE_RESULT_SUCCESS && phParallelOperation ) ? *phParallelOperation : nullptr;
+            context.asyncValidation->submit( "zeRTASParallelOperationCreateExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeRTASParallelOperationCreateExp( hDriver, phParallelOperation );
+                if( result == ZE_RESULT_SUCCESS ){
+                    if (phParallelOperationValue){
+                        context.handleLifetime->addHandle( phParallelOperationValue );
+                        context.handleLifetime->addDependent( hDriver, phParallelOperationValue );
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phParallelOperation){
@@ -6643,17 +8832,14 @@ namespace validation_layer
         if( nullptr == pfnGetPropertiesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeRTASParallelOperationGetPropertiesExp", hParallelOperation ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeRTASParallelOperationGetPropertiesExp( hParallelOperation, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASParallelOperationGetPropertiesExp( hParallelOperation, pProperties );
@@ -6662,6 +8848,15 @@ namespace validation_layer
 
         auto result = pfnGetPropertiesExp( hParallelOperation, pProperties );
 
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeRTASParallelOperationGetPropertiesExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeRTASParallelOperationGetPropertiesExp( hParallelOperation, pProperties );
+                if( result == ZE_RESULT_SUCCESS ){
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
         }
@@ -6680,17 +8875,14 @@ namespace validation_layer
         if( nullptr == pfnJoinExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeRTASParallelOperationJoinExp", hParallelOperation ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeRTASParallelOperationJoinExp( hParallelOperation );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASParallelOperationJoinExp( hParallelOperation );
@@ -6698,6 +8890,13 @@ namespace validation_layer
         }
 
         auto result = pfnJoinExp( hParallelOperation );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeRTASParallelOperationJoinExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeRTASParallelOperationJoinExp( hParallelOperation );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -6713,17 +8912,14 @@ namespace validation_layer
         if( nullptr == pfnDestroyExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeRTASParallelOperationDestroyExp", hParallelOperation ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeRTASParallelOperationDestroyExp( hParallelOperation );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeRTASParallelOperationDestroyExp( hParallelOperation );
@@ -6731,6 +8927,13 @@ namespace validation_layer
         }
 
         auto result = pfnDestroyExp( hParallelOperation );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeRTASParallelOperationDestroyExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeRTASParallelOperationDestroyExp( hParallelOperation );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -6751,17 +8954,14 @@ namespace validation_layer
         if( nullptr == pfnGetPitchFor2dImage )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeMemGetPitchFor2dImage", hContext ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeMemGetPitchFor2dImage( hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeMemGetPitchFor2dImage( hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch );
@@ -6769,6 +8969,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetPitchFor2dImage( hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeMemGetPitchFor2dImage", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeMemGetPitchFor2dImage( hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -6785,17 +8992,14 @@ namespace validation_layer
         if( nullptr == pfnGetDeviceOffsetExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeImageGetDeviceOffsetExp", hImage ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeImageGetDeviceOffsetExp( hImage, pDeviceOffset );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeImageGetDeviceOffsetExp( hImage, pDeviceOffset );
@@ -6804,6 +9008,15 @@ namespace validation_layer
 
         auto result = pfnGetDeviceOffsetExp( hImage, pDeviceOffset );
 
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeImageGetDeviceOffsetExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeImageGetDeviceOffsetExp( hImage, pDeviceOffset );
+                if( result == ZE_RESULT_SUCCESS ){
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
         }
@@ -6823,24 +9036,46 @@ namespace validation_layer
         if( nullptr == pfnCreateCloneExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListCreateCloneExp", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListCreateCloneExp( hCommandList, phClonedCommandList );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListCreateCloneExp( hCommandList, phClonedCommandList );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnCreateCloneExp( hCommandList, phClonedCommandList );
+        auto hCommandListLocal = hCommandList;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnCreateCloneExp( hCommandListLocal, phClonedCommandList );
+
+        if( result == ZE_RESULT_SUCCESS && context.enableGenerationalHandles ){
+            if( phClonedCommandList ) *phClonedCommandList = context.generationalHandles->wrap( *phClonedCommandList );
+        }
+
+        if( context.enableAsyncValidation ){
+            auto phClonedCommandListValue = ( result == ZE_RESULT_SUCCESS && phClonedCommandList ) ? *phClonedCommandList : nullptr;
+            context.asyncValidation->submit( "zeCommandListCreateCloneExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListCreateCloneExp( hCommandList, phClonedCommandList );
+                if( result == ZE_RESULT_SUCCESS ){
+                    if (phClonedCommandListValue){
+                        context.handleLifetime->addHandle( phClonedCommandListValue );
+                        context.handleLifetime->addDependent( hCommandList, phClonedCommandListValue );
+                    }
+                }
+                return check;
+            } );
+        }
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
@@ -6876,24 +9111,46 @@ namespace validation_layer
         if( nullptr == pfnImmediateAppendCommandListsExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListImmediateAppendCommandListsExp", hCommandListImmediate ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListImmediateAppendCommandListsExp( hCommandListImmediate, numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zeHandleLifetime.zeCommandListImmediateAppendCommandListsExp( hCommandListImmediate, numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnImmediateAppendCommandListsExp( hCommandListImmediate, numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents );
+        auto hCommandListImmediateLocal = hCommandListImmediate;
+        GenerationalHandleArray<ze_command_list_handle_t> phCommandListsLocal( phCommandLists );
+        auto hSignalEventLocal = hSignalEvent;
+        GenerationalHandleArray<ze_event_handle_t> phWaitEventsLocal( phWaitEvents );
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListImmediateLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !phCommandListsLocal.translate( generations, numCommandLists ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hSignalEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !phWaitEventsLocal.translate( generations, numWaitEvents ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnImmediateAppendCommandListsExp( hCommandListImmediateLocal, numCommandLists, phCommandListsLocal.data(), hSignalEventLocal, numWaitEvents, phWaitEventsLocal.data() );
+
+        if( context.enableAsyncValidation ){
+            auto phCommandListsCopy = AsyncValidation::copy( phCommandLists, numCommandLists );
+            auto phWaitEventsCopy = AsyncValidation::copy( phWaitEvents, numWaitEvents );
+            context.asyncValidation->submit( "zeCommandListImmediateAppendCommandListsExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListImmediateAppendCommandListsExp( hCommandListImmediate, numCommandLists, phCommandListsCopy.data(), hSignalEvent, numWaitEvents, phWaitEventsCopy.data() );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -6911,15 +9168,17 @@ namespace validation_layer
         if( nullptr == pfnGetNextCommandIdExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListGetNextCommandIdExp", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListGetNextCommandIdExp( hCommandList, desc, pCommandId );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListGetNextCommandIdExp" );
         }
 
         
@@ -6928,7 +9187,23 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnGetNextCommandIdExp( hCommandList, desc, pCommandId );
+        auto hCommandListLocal = hCommandList;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnGetNextCommandIdExp( hCommandListLocal, desc, pCommandId );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeCommandListGetNextCommandIdExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListGetNextCommandIdExp( hCommandList, desc, pCommandId );
+                if( result == ZE_RESULT_SUCCESS ){
+                }
+                return check;
+            } );
+        }
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
@@ -6950,15 +9225,17 @@ namespace validation_layer
         if( nullptr == pfnUpdateMutableCommandsExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListUpdateMutableCommandsExp", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListUpdateMutableCommandsExp( hCommandList, desc );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListUpdateMutableCommandsExp" );
         }
 
         
@@ -6967,7 +9244,21 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnUpdateMutableCommandsExp( hCommandList, desc );
+        auto hCommandListLocal = hCommandList;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnUpdateMutableCommandsExp( hCommandListLocal, desc );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeCommandListUpdateMutableCommandsExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListUpdateMutableCommandsExp( hCommandList, desc );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -6985,15 +9276,17 @@ namespace validation_layer
         if( nullptr == pfnUpdateMutableCommandSignalEventExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListUpdateMutableCommandSignalEventExp", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListUpdateMutableCommandSignalEventExp( hCommandList, commandId, hSignalEvent );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListUpdateMutableCommandSignalEventExp" );
         }
 
         
@@ -7002,7 +9295,24 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnUpdateMutableCommandSignalEventExp( hCommandList, commandId, hSignalEvent );
+        auto hCommandListLocal = hCommandList;
+        auto hSignalEventLocal = hSignalEvent;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hSignalEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnUpdateMutableCommandSignalEventExp( hCommandListLocal, commandId, hSignalEventLocal );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zeCommandListUpdateMutableCommandSignalEventExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListUpdateMutableCommandSignalEventExp( hCommandList, commandId, hSignalEvent );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -7022,15 +9332,17 @@ namespace validation_layer
         if( nullptr == pfnUpdateMutableCommandWaitEventsExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zeCommandListUpdateMutableCommandWaitEventsExp", hCommandList ) )
         {
             auto result = context.paramValidation->zeParamValidation.zeCommandListUpdateMutableCommandWaitEventsExp( hCommandList, commandId, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zeCommandListUpdateMutableCommandWaitEventsExp" );
         }
 
         
@@ -7039,7 +9351,25 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnUpdateMutableCommandWaitEventsExp( hCommandList, commandId, numWaitEvents, phWaitEvents );
+        auto hCommandListLocal = hCommandList;
+        GenerationalHandleArray<ze_event_handle_t> phWaitEventsLocal( phWaitEvents );
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !phWaitEventsLocal.translate( generations, numWaitEvents ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnUpdateMutableCommandWaitEventsExp( hCommandListLocal, commandId, numWaitEvents, phWaitEventsLocal.data() );
+
+        if( context.enableAsyncValidation ){
+            auto phWaitEventsCopy = AsyncValidation::copy( phWaitEvents, numWaitEvents );
+            context.asyncValidation->submit( "zeCommandListUpdateMutableCommandWaitEventsExp", [=]() mutable {
+                auto check = context.handleLifetime->zeHandleLifetime.zeCommandListUpdateMutableCommandWaitEventsExp( hCommandList, commandId, numWaitEvents, phWaitEventsCopy.data() );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -10,6 +10,7 @@
 #include "ze_validation_layer.h"
 #include "param_validation.h"
 #include <memory>
+#include <vector>
 
 namespace validation_layer
 {
@@ -18,6 +19,12 @@ namespace validation_layer
     ///////////////////////////////////////////////////////////////////////////////
     context_t::context_t()
     {
+        // The layer is always loaded, but the environment only selects checks
+        // when it is enabled at init; otherwise it waits for
+        // zelEnableValidationLayer.
+        if (!getenv_tobool( "ZE_ENABLE_VALIDATION_LAYER" ))
+            return;
+
         enableParameterValidation = getenv_tobool( "ZE_ENABLE_PARAMETER_VALIDATION" );
         if(enableParameterValidation) {
             paramValidation = std::make_unique<ParameterValidation>();
@@ -26,13 +33,122 @@ namespace validation_layer
         if (enableHandleLifetime) {
             handleLifetime = std::make_unique<HandleLifetimeValidation>();
         }
+        enableMemoryTracker = getenv_tobool( "ZE_ENABLE_MEMORY_TRACKER" );
+        if (enableMemoryTracker) {
+            memoryTracker = std::make_unique<MemoryTracker>();
+        }
         enableThreadingValidation = getenv_tobool( "ZE_ENABLE_THREADING_VALIDATION" );
+        if (enableThreadingValidation) {
+            threadingValidation = std::make_unique<ThreadingValidation>();
+        }
+        enableGenerationalHandles = getenv_tobool( "ZE_ENABLE_GENERATIONAL_HANDLES" );
+        if (enableGenerationalHandles && !GenerationalHandleTable::isSupported()) {
+            fprintf(stderr, "ZE_ENABLE_GENERATIONAL_HANDLES requires a 64-bit build and is ignored\n");
+            enableGenerationalHandles = false;
+        }
+        if (enableGenerationalHandles) {
+            generationalHandles = std::make_unique<GenerationalHandleTable>();
+        }
+        // Async validation moves the handle lifetime checks to a background
+        // thread; the inline checks are turned off and the tracker is kept.
+        enableAsyncValidation = getenv_tobool( "ZE_ENABLE_ASYNC_VALIDATION" ) && enableHandleLifetime;
+        if (enableAsyncValidation) {
+            enableHandleLifetime = false;
+            asyncValidation = std::make_unique<AsyncValidation>();
+        }
+        enablePerformanceAdvisor = getenv_tobool( "ZE_ENABLE_PERFORMANCE_ADVISOR" );
+        if (enablePerformanceAdvisor) {
+            performanceAdvisor = std::make_unique<PerformanceAdvisor>();
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////////////
     context_t::~context_t()
     {
     }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Checks turned on after init have not seen the handles and allocations
+    // created before, so those are adopted on first use instead of rejected.
+    // The objects are never freed at runtime, since calls in flight may still
+    // use them after their check is turned off.
+    void context_t::setChecks(zel_validation_check_flags_t checks)
+    {
+        std::lock_guard<std::mutex> lock(checksMutex);
+
+        bool parameter = (checks & ZEL_VALIDATION_CHECK_FLAG_PARAMETER) != 0;
+        if (parameter && !paramValidation) {
+            paramValidation = std::make_unique<ParameterValidation>();
+        }
+        enableParameterValidation = parameter;
+
+        // With async validation the handle lifetime checks run on its thread.
+        auto &enableLifetime = asyncValidation ? enableAsyncValidation : enableHandleLifetime;
+        bool lifetime = (checks & ZEL_VALIDATION_CHECK_FLAG_HANDLE_LIFETIME) != 0;
+        if (lifetime && !enableLifetime) {
+            if (!handleLifetime) {
+                handleLifetime = std::make_unique<HandleLifetimeValidation>();
+            }
+            handleLifetime->adoptUntrackedHandles();
+            addEnumeratedHandles();
+        }
+        enableLifetime = lifetime;
+
+        bool memory = (checks & ZEL_VALIDATION_CHECK_FLAG_MEMORY_TRACKER) != 0;
+        if (memory && !enableMemoryTracker) {
+            if (!memoryTracker) {
+                memoryTracker = std::make_unique<MemoryTracker>();
+            }
+            memoryTracker->adoptUntrackedAllocations();
+        }
+        enableMemoryTracker = memory;
+
+        bool threading = (checks & ZEL_VALIDATION_CHECK_FLAG_THREADING) != 0;
+        if (threading && !threadingValidation) {
+            threadingValidation = std::make_unique<ThreadingValidation>();
+        }
+        enableThreadingValidation = threading;
+    }
+
+    // Drivers, devices and sub-devices are the handles that can be
+    // enumerated, so they are known before the application uses them.
+    void context_t::addEnumeratedHandles()
+    {
+        auto pfnDriverGet = zeDdiTable.Driver.pfnGet;
+        auto pfnDeviceGet = zeDdiTable.Device.pfnGet;
+        auto pfnGetSubDevices = zeDdiTable.Device.pfnGetSubDevices;
+        if (nullptr == pfnDriverGet || nullptr == pfnDeviceGet || nullptr == pfnGetSubDevices)
+            return;
+
+        uint32_t driverCount = 0;
+        if (pfnDriverGet(&driverCount, nullptr) != ZE_RESULT_SUCCESS)
+            return;
+        std::vector<ze_driver_handle_t> drivers(driverCount);
+        if (pfnDriverGet(&driverCount, drivers.data()) != ZE_RESULT_SUCCESS)
+            return;
+
+        for (auto driver : drivers) {
+            handleLifetime->addHandle(driver);
+            uint32_t deviceCount = 0;
+            if (pfnDeviceGet(driver, &deviceCount, nullptr) != ZE_RESULT_SUCCESS)
+                continue;
+            std::vector<ze_device_handle_t> devices(deviceCount);
+            if (pfnDeviceGet(driver, &deviceCount, devices.data()) != ZE_RESULT_SUCCESS)
+                continue;
+            devices.resize(deviceCount);
+            while (!devices.empty()) {
+                auto device = devices.back();
+                devices.pop_back();
+                handleLifetime->addHandle(device);
+                uint32_t subDeviceCount = 0;
+                if (pfnGetSubDevices(device, &subDeviceCount, nullptr) != ZE_RESULT_SUCCESS || subDeviceCount == 0)
+                    continue;
+                std::vector<ze_device_handle_t> subDevices(subDeviceCount);
+                if (pfnGetSubDevices(device, &subDeviceCount, subDevices.data()) == ZE_RESULT_SUCCESS)
+                    devices.insert(devices.end(), subDevices.begin(), subDevices.begin() + subDeviceCount);
+            }
+        }
+    }
 } // namespace validation_layer
 
 
@@ -40,6 +156,13 @@ namespace validation_layer
 extern "C" {
 #endif
 
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelValidationLayerSetChecks(zel_validation_check_flags_t checks)
+{
+    validation_layer::context.setChecks(checks);
+    return ZE_RESULT_SUCCESS;
+}
+
 ZE_DLLEXPORT ze_result_t ZE_APICALL
 zelLoaderGetVersion(zel_component_version_t *version)
 {
@@ -14,8 +14,16 @@
 #include "ze_util.h"
 #include "loader/ze_loader.h"
 #include "param_validation.h"
+#include "validation_sampler.h"
 #include "handle_lifetime.h"
+#include "memory_tracker.h"
+#include "threading_validation.h"
+#include "generational_handles.h"
+#include "async_validation.h"
+#include "performance_advisor.h"
+#include <atomic>
 #include <memory>
+#include <mutex>
 
 #define VALIDATION_COMP_NAME "validation layer"
 
@@ -27,19 +35,37 @@ namespace validation_layer
     public:
         ze_api_version_t version = ZE_API_VERSION_CURRENT;
 
-        bool enableParameterValidation = false;
-        bool enableHandleLifetime = false;
-        bool enableThreadingValidation = false;
+        // The checks can be changed at runtime with zelEnableValidationLayer.
+        std::atomic<bool> enableParameterValidation{false};
+        std::atomic<bool> enableHandleLifetime{false};
+        std::atomic<bool> enableMemoryTracker{false};
+        std::atomic<bool> enableThreadingValidation{false};
+        bool enableGenerationalHandles = false;
+        std::atomic<bool> enableAsyncValidation{false};
+        bool enablePerformanceAdvisor = false;
 
         ze_dditable_t   zeDdiTable = {};
         zet_dditable_t  zetDdiTable = {};
         zes_dditable_t  zesDdiTable = {};
 
         std::unique_ptr<ParameterValidation> paramValidation;
+        ValidationSampler sampler;
         std::unique_ptr<HandleLifetimeValidation> handleLifetime;
+        std::unique_ptr<MemoryTracker> memoryTracker;
+        std::unique_ptr<ThreadingValidation> threadingValidation;
+        std::unique_ptr<GenerationalHandleTable> generationalHandles;
+        std::unique_ptr<AsyncValidation> asyncValidation;
+        std::unique_ptr<PerformanceAdvisor> performanceAdvisor;
 
         context_t();
         ~context_t();
+
+        void setChecks(zel_validation_check_flags_t checks);
+
+    private:
+        void addEnumeratedHandles();
+
+        std::mutex checksMutex;
     };
 
     extern context_t context;
@@ -26,17 +26,14 @@ namespace validation_layer
         if( nullptr == pfnInit )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesInit", nullptr ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesInit( flags );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesInit( flags );
@@ -44,6 +41,13 @@ namespace validation_layer
         }
 
         auto result = pfnInit( flags );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesInit", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesInit( flags );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -67,17 +71,14 @@ namespace validation_layer
         if( nullptr == pfnGet )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDriverGet", nullptr ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDriverGet( pCount, phDrivers );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDriverGet( pCount, phDrivers );
@@ -86,6 +87,22 @@ namespace validation_layer
 
         auto result = pfnGet( pCount, phDrivers );
 
+        if( context.enableAsyncValidation ){
+            auto phDriversCopy = AsyncValidation::copy( phDrivers, ( result == ZE_RESULT_SUCCESS && nullptr != phDrivers ) ? *pCount : 0 );
+            context.asyncValidation->submit( "zesDriverGet", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDriverGet( pCount, phDrivers );
+                if( result == ZE_RESULT_SUCCESS ){
+                    for (size_t i = 0; i < phDriversCopy.size(); ++i){
+                        if (phDriversCopy[i]){
+                            context.handleLifetime->addHandle( phDriversCopy[i] );
+                            context.handleLifetime->addDependent( pCount, phDriversCopy[i] );
+                        }
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             for (size_t i = 0; ( nullptr != phDrivers) && (i < *pCount); ++i){
@@ -120,17 +137,14 @@ namespace validation_layer
         if( nullptr == pfnGetExtensionProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDriverGetExtensionProperties", hDriver ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDriverGetExtensionProperties( hDriver, pCount, pExtensionProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDriverGetExtensionProperties( hDriver, pCount, pExtensionProperties );
@@ -138,6 +152,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetExtensionProperties( hDriver, pCount, pExtensionProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDriverGetExtensionProperties", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDriverGetExtensionProperties( hDriver, pCount, pExtensionProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -155,17 +176,14 @@ namespace validation_layer
         if( nullptr == pfnGetExtensionFunctionAddress )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDriverGetExtensionFunctionAddress", hDriver ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDriverGetExtensionFunctionAddress( hDriver, name, ppFunctionAddress );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDriverGetExtensionFunctionAddress( hDriver, name, ppFunctionAddress );
@@ -173,6 +191,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetExtensionFunctionAddress( hDriver, name, ppFunctionAddress );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDriverGetExtensionFunctionAddress", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDriverGetExtensionFunctionAddress( hDriver, name, ppFunctionAddress );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -197,17 +222,14 @@ namespace validation_layer
         if( nullptr == pfnGet )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceGet", hDriver ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceGet( hDriver, pCount, phDevices );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGet( hDriver, pCount, phDevices );
@@ -216,6 +238,22 @@ namespace validation_layer
 
         auto result = pfnGet( hDriver, pCount, phDevices );
 
+        if( context.enableAsyncValidation ){
+            auto phDevicesCopy = AsyncValidation::copy( phDevices, ( result == ZE_RESULT_SUCCESS && nullptr != phDevices ) ? *pCount : 0 );
+            context.asyncValidation->submit( "zesDeviceGet", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceGet( hDriver, pCount, phDevices );
+                if( result == ZE_RESULT_SUCCESS ){
+                    for (size_t i = 0; i < phDevicesCopy.size(); ++i){
+                        if (phDevicesCopy[i]){
+                            context.handleLifetime->addHandle( phDevicesCopy[i] );
+                            context.handleLifetime->addDependent( hDriver, phDevicesCopy[i] );
+                        }
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             for (size_t i = 0; ( nullptr != phDevices) && (i < *pCount); ++i){
@@ -241,17 +279,14 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceGetProperties", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceGetProperties( hDevice, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetProperties( hDevice, pProperties );
@@ -259,6 +294,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetProperties( hDevice, pProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceGetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceGetProperties( hDevice, pProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -275,17 +317,14 @@ namespace validation_layer
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceGetState", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceGetState( hDevice, pState );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetState( hDevice, pState );
@@ -293,6 +332,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetState( hDevice, pState );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceGetState", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceGetState( hDevice, pState );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -310,17 +356,14 @@ namespace validation_layer
         if( nullptr == pfnReset )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceReset", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceReset( hDevice, force );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceReset( hDevice, force );
@@ -328,6 +371,13 @@ namespace validation_layer
         }
 
         auto result = pfnReset( hDevice, force );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceReset", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceReset( hDevice, force );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -344,17 +394,14 @@ namespace validation_layer
         if( nullptr == pfnResetExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceResetExt", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceResetExt( hDevice, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceResetExt( hDevice, pProperties );
@@ -362,6 +409,13 @@ namespace validation_layer
         }
 
         auto result = pfnResetExt( hDevice, pProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceResetExt", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceResetExt( hDevice, pProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -387,17 +441,14 @@ namespace validation_layer
         if( nullptr == pfnProcessesGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceProcessesGetState", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceProcessesGetState( hDevice, pCount, pProcesses );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceProcessesGetState( hDevice, pCount, pProcesses );
@@ -405,6 +456,13 @@ namespace validation_layer
         }
 
         auto result = pfnProcessesGetState( hDevice, pCount, pProcesses );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceProcessesGetState", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceProcessesGetState( hDevice, pCount, pProcesses );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -421,17 +479,14 @@ namespace validation_layer
         if( nullptr == pfnPciGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDevicePciGetProperties", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDevicePciGetProperties( hDevice, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDevicePciGetProperties( hDevice, pProperties );
@@ -439,6 +494,13 @@ namespace validation_layer
         }
 
         auto result = pfnPciGetProperties( hDevice, pProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDevicePciGetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDevicePciGetProperties( hDevice, pProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -455,17 +517,14 @@ namespace validation_layer
         if( nullptr == pfnPciGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDevicePciGetState", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDevicePciGetState( hDevice, pState );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDevicePciGetState( hDevice, pState );
@@ -473,6 +532,13 @@ namespace validation_layer
         }
 
         auto result = pfnPciGetState( hDevice, pState );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDevicePciGetState", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDevicePciGetState( hDevice, pState );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -497,17 +563,14 @@ namespace validation_layer
         if( nullptr == pfnPciGetBars )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDevicePciGetBars", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDevicePciGetBars( hDevice, pCount, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDevicePciGetBars( hDevice, pCount, pProperties );
@@ -515,6 +578,13 @@ namespace validation_layer
         }
 
         auto result = pfnPciGetBars( hDevice, pCount, pProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDevicePciGetBars", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDevicePciGetBars( hDevice, pCount, pProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -531,17 +601,14 @@ namespace validation_layer
         if( nullptr == pfnPciGetStats )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDevicePciGetStats", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDevicePciGetStats( hDevice, pStats );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDevicePciGetStats( hDevice, pStats );
@@ -549,6 +616,13 @@ namespace validation_layer
         }
 
         auto result = pfnPciGetStats( hDevice, pStats );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDevicePciGetStats", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDevicePciGetStats( hDevice, pStats );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -564,17 +638,14 @@ namespace validation_layer
         if( nullptr == pfnSetOverclockWaiver )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceSetOverclockWaiver", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceSetOverclockWaiver( hDevice );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceSetOverclockWaiver( hDevice );
@@ -582,6 +653,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetOverclockWaiver( hDevice );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceSetOverclockWaiver", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceSetOverclockWaiver( hDevice );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -600,17 +678,14 @@ namespace validation_layer
         if( nullptr == pfnGetOverclockDomains )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceGetOverclockDomains", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceGetOverclockDomains( hDevice, pOverclockDomains );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetOverclockDomains( hDevice, pOverclockDomains );
@@ -618,6 +693,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetOverclockDomains( hDevice, pOverclockDomains );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceGetOverclockDomains", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceGetOverclockDomains( hDevice, pOverclockDomains );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -637,17 +719,14 @@ namespace validation_layer
         if( nullptr == pfnGetOverclockControls )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceGetOverclockControls", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceGetOverclockControls( hDevice, domainType, pAvailableControls );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetOverclockControls( hDevice, domainType, pAvailableControls );
@@ -655,6 +734,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetOverclockControls( hDevice, domainType, pAvailableControls );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceGetOverclockControls", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceGetOverclockControls( hDevice, domainType, pAvailableControls );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -672,17 +758,14 @@ namespace validation_layer
         if( nullptr == pfnResetOverclockSettings )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceResetOverclockSettings", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceResetOverclockSettings( hDevice, onShippedState );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceResetOverclockSettings( hDevice, onShippedState );
@@ -690,6 +773,13 @@ namespace validation_layer
         }
 
         auto result = pfnResetOverclockSettings( hDevice, onShippedState );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceResetOverclockSettings", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceResetOverclockSettings( hDevice, onShippedState );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -711,17 +801,14 @@ namespace validation_layer
         if( nullptr == pfnReadOverclockState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceReadOverclockState", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceReadOverclockState( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceReadOverclockState( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset );
@@ -729,6 +816,13 @@ namespace validation_layer
         }
 
         auto result = pfnReadOverclockState( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceReadOverclockState", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceReadOverclockState( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -755,17 +849,14 @@ namespace validation_layer
         if( nullptr == pfnEnumOverclockDomains )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceEnumOverclockDomains", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceEnumOverclockDomains( hDevice, pCount, phDomainHandle );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumOverclockDomains( hDevice, pCount, phDomainHandle );
@@ -773,6 +864,13 @@ namespace validation_layer
         }
 
         auto result = pfnEnumOverclockDomains( hDevice, pCount, phDomainHandle );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceEnumOverclockDomains", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceEnumOverclockDomains( hDevice, pCount, phDomainHandle );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -789,17 +887,14 @@ namespace validation_layer
         if( nullptr == pfnGetDomainProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesOverclockGetDomainProperties", hDomainHandle ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesOverclockGetDomainProperties( hDomainHandle, pDomainProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetDomainProperties( hDomainHandle, pDomainProperties );
@@ -807,6 +902,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetDomainProperties( hDomainHandle, pDomainProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesOverclockGetDomainProperties", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesOverclockGetDomainProperties( hDomainHandle, pDomainProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -823,17 +925,14 @@ namespace validation_layer
         if( nullptr == pfnGetDomainVFProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesOverclockGetDomainVFProperties", hDomainHandle ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesOverclockGetDomainVFProperties( hDomainHandle, pVFProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetDomainVFProperties( hDomainHandle, pVFProperties );
@@ -841,6 +940,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetDomainVFProperties( hDomainHandle, pVFProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesOverclockGetDomainVFProperties", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesOverclockGetDomainVFProperties( hDomainHandle, pVFProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -858,17 +964,14 @@ namespace validation_layer
         if( nullptr == pfnGetDomainControlProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesOverclockGetDomainControlProperties", hDomainHandle ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesOverclockGetDomainControlProperties( hDomainHandle, DomainControl, pControlProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetDomainControlProperties( hDomainHandle, DomainControl, pControlProperties );
@@ -876,6 +979,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetDomainControlProperties( hDomainHandle, DomainControl, pControlProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesOverclockGetDomainControlProperties", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesOverclockGetDomainControlProperties( hDomainHandle, DomainControl, pControlProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -893,17 +1003,14 @@ namespace validation_layer
         if( nullptr == pfnGetControlCurrentValue )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesOverclockGetControlCurrentValue", hDomainHandle ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesOverclockGetControlCurrentValue( hDomainHandle, DomainControl, pValue );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetControlCurrentValue( hDomainHandle, DomainControl, pValue );
@@ -911,6 +1018,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetControlCurrentValue( hDomainHandle, DomainControl, pValue );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesOverclockGetControlCurrentValue", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesOverclockGetControlCurrentValue( hDomainHandle, DomainControl, pValue );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -929,17 +1043,14 @@ namespace validation_layer
         if( nullptr == pfnGetControlPendingValue )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesOverclockGetControlPendingValue", hDomainHandle ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesOverclockGetControlPendingValue( hDomainHandle, DomainControl, pValue );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetControlPendingValue( hDomainHandle, DomainControl, pValue );
@@ -947,6 +1058,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetControlPendingValue( hDomainHandle, DomainControl, pValue );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesOverclockGetControlPendingValue", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesOverclockGetControlPendingValue( hDomainHandle, DomainControl, pValue );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -966,17 +1084,14 @@ namespace validation_layer
         if( nullptr == pfnSetControlUserValue )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesOverclockSetControlUserValue", hDomainHandle ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesOverclockSetControlUserValue( hDomainHandle, DomainControl, pValue, pPendingAction );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockSetControlUserValue( hDomainHandle, DomainControl, pValue, pPendingAction );
@@ -984,6 +1099,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetControlUserValue( hDomainHandle, DomainControl, pValue, pPendingAction );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesOverclockSetControlUserValue", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesOverclockSetControlUserValue( hDomainHandle, DomainControl, pValue, pPendingAction );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1002,17 +1124,14 @@ namespace validation_layer
         if( nullptr == pfnGetControlState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesOverclockGetControlState", hDomainHandle ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesOverclockGetControlState( hDomainHandle, DomainControl, pControlState, pPendingAction );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetControlState( hDomainHandle, DomainControl, pControlState, pPendingAction );
@@ -1020,6 +1139,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetControlState( hDomainHandle, DomainControl, pControlState, pPendingAction );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesOverclockGetControlState", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesOverclockGetControlState( hDomainHandle, DomainControl, pControlState, pPendingAction );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1040,17 +1166,14 @@ namespace validation_layer
         if( nullptr == pfnGetVFPointValues )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesOverclockGetVFPointValues", hDomainHandle ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesOverclockGetVFPointValues( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockGetVFPointValues( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue );
@@ -1058,6 +1181,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetVFPointValues( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesOverclockGetVFPointValues", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesOverclockGetVFPointValues( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1077,17 +1207,14 @@ namespace validation_layer
         if( nullptr == pfnSetVFPointValues )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesOverclockSetVFPointValues", hDomainHandle ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesOverclockSetVFPointValues( hDomainHandle, VFType, PointIndex, PointValue );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesOverclockSetVFPointValues( hDomainHandle, VFType, PointIndex, PointValue );
@@ -1095,6 +1222,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetVFPointValues( hDomainHandle, VFType, PointIndex, PointValue );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesOverclockSetVFPointValues", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesOverclockSetVFPointValues( hDomainHandle, VFType, PointIndex, PointValue );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1121,17 +1255,14 @@ namespace validation_layer
         if( nullptr == pfnEnumDiagnosticTestSuites )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceEnumDiagnosticTestSuites", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceEnumDiagnosticTestSuites( hDevice, pCount, phDiagnostics );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumDiagnosticTestSuites( hDevice, pCount, phDiagnostics );
@@ -1139,6 +1270,13 @@ namespace validation_layer
         }
 
         auto result = pfnEnumDiagnosticTestSuites( hDevice, pCount, phDiagnostics );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceEnumDiagnosticTestSuites", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceEnumDiagnosticTestSuites( hDevice, pCount, phDiagnostics );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1156,17 +1294,14 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDiagnosticsGetProperties", hDiagnostics ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDiagnosticsGetProperties( hDiagnostics, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDiagnosticsGetProperties( hDiagnostics, pProperties );
@@ -1174,6 +1309,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetProperties( hDiagnostics, pProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDiagnosticsGetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDiagnosticsGetProperties( hDiagnostics, pProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1198,17 +1340,14 @@ namespace validation_layer
         if( nullptr == pfnGetTests )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDiagnosticsGetTests", hDiagnostics ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDiagnosticsGetTests( hDiagnostics, pCount, pTests );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDiagnosticsGetTests( hDiagnostics, pCount, pTests );
@@ -1216,6 +1355,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetTests( hDiagnostics, pCount, pTests );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDiagnosticsGetTests", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDiagnosticsGetTests( hDiagnostics, pCount, pTests );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1236,17 +1382,14 @@ namespace validation_layer
         if( nullptr == pfnRunTests )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDiagnosticsRunTests", hDiagnostics ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDiagnosticsRunTests( hDiagnostics, startIndex, endIndex, pResult );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDiagnosticsRunTests( hDiagnostics, startIndex, endIndex, pResult );
@@ -1254,6 +1397,13 @@ namespace validation_layer
         }
 
         auto result = pfnRunTests( hDiagnostics, startIndex, endIndex, pResult );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDiagnosticsRunTests", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDiagnosticsRunTests( hDiagnostics, startIndex, endIndex, pResult );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1270,17 +1420,14 @@ namespace validation_layer
         if( nullptr == pfnEccAvailable )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceEccAvailable", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceEccAvailable( hDevice, pAvailable );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEccAvailable( hDevice, pAvailable );
@@ -1288,6 +1435,13 @@ namespace validation_layer
         }
 
         auto result = pfnEccAvailable( hDevice, pAvailable );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceEccAvailable", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceEccAvailable( hDevice, pAvailable );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1304,17 +1458,14 @@ namespace validation_layer
         if( nullptr == pfnEccConfigurable )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceEccConfigurable", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceEccConfigurable( hDevice, pConfigurable );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEccConfigurable( hDevice, pConfigurable );
@@ -1322,6 +1473,13 @@ namespace validation_layer
         }
 
         auto result = pfnEccConfigurable( hDevice, pConfigurable );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceEccConfigurable", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceEccConfigurable( hDevice, pConfigurable );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1338,17 +1496,14 @@ namespace validation_layer
         if( nullptr == pfnGetEccState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceGetEccState", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceGetEccState( hDevice, pState );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetEccState( hDevice, pState );
@@ -1356,6 +1511,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetEccState( hDevice, pState );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceGetEccState", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceGetEccState( hDevice, pState );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1373,17 +1535,14 @@ namespace validation_layer
         if( nullptr == pfnSetEccState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceSetEccState", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceSetEccState( hDevice, newState, pState );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceSetEccState( hDevice, newState, pState );
@@ -1391,6 +1550,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetEccState( hDevice, newState, pState );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceSetEccState", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceSetEccState( hDevice, newState, pState );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1417,17 +1583,14 @@ namespace validation_layer
         if( nullptr == pfnEnumEngineGroups )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceEnumEngineGroups", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceEnumEngineGroups( hDevice, pCount, phEngine );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumEngineGroups( hDevice, pCount, phEngine );
@@ -1435,6 +1598,13 @@ namespace validation_layer
         }
 
         auto result = pfnEnumEngineGroups( hDevice, pCount, phEngine );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceEnumEngineGroups", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceEnumEngineGroups( hDevice, pCount, phEngine );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1451,17 +1621,14 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesEngineGetProperties", hEngine ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesEngineGetProperties( hEngine, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesEngineGetProperties( hEngine, pProperties );
@@ -1469,6 +1636,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetProperties( hEngine, pProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesEngineGetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesEngineGetProperties( hEngine, pProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1486,17 +1660,14 @@ namespace validation_layer
         if( nullptr == pfnGetActivity )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesEngineGetActivity", hEngine ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesEngineGetActivity( hEngine, pStats );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesEngineGetActivity( hEngine, pStats );
@@ -1504,6 +1675,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetActivity( hEngine, pStats );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesEngineGetActivity", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesEngineGetActivity( hEngine, pStats );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1520,17 +1698,14 @@ namespace validation_layer
         if( nullptr == pfnEventRegister )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceEventRegister", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceEventRegister( hDevice, events );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEventRegister( hDevice, events );
@@ -1538,6 +1713,13 @@ namespace validation_layer
         }
 
         auto result = pfnEventRegister( hDevice, events );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceEventRegister", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceEventRegister( hDevice, events );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1570,17 +1752,14 @@ namespace validation_layer
         if( nullptr == pfnEventListen )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDriverEventListen", hDriver ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDriverEventListen( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDriverEventListen( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
@@ -1588,6 +1767,14 @@ namespace validation_layer
         }
 
         auto result = pfnEventListen( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
+
+        if( context.enableAsyncValidation ){
+            auto phDevicesCopy = AsyncValidation::copy( phDevices, count );
+            context.asyncValidation->submit( "zesDriverEventListen", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDriverEventListen( hDriver, timeout, count, phDevicesCopy.data(), pNumDeviceEvents, pEvents );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1620,17 +1807,14 @@ namespace validation_layer
         if( nullptr == pfnEventListenEx )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDriverEventListenEx", hDriver ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDriverEventListenEx( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDriverEventListenEx( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
@@ -1638,6 +1822,14 @@ namespace validation_layer
         }
 
         auto result = pfnEventListenEx( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
+
+        if( context.enableAsyncValidation ){
+            auto phDevicesCopy = AsyncValidation::copy( phDevices, count );
+            context.asyncValidation->submit( "zesDriverEventListenEx", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDriverEventListenEx( hDriver, timeout, count, phDevicesCopy.data(), pNumDeviceEvents, pEvents );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1664,17 +1856,14 @@ namespace validation_layer
         if( nullptr == pfnEnumFabricPorts )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceEnumFabricPorts", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceEnumFabricPorts( hDevice, pCount, phPort );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumFabricPorts( hDevice, pCount, phPort );
@@ -1682,6 +1871,13 @@ namespace validation_layer
         }
 
         auto result = pfnEnumFabricPorts( hDevice, pCount, phPort );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceEnumFabricPorts", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceEnumFabricPorts( hDevice, pCount, phPort );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1698,17 +1894,14 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFabricPortGetProperties", hPort ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFabricPortGetProperties( hPort, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetProperties( hPort, pProperties );
@@ -1716,6 +1909,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetProperties( hPort, pProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFabricPortGetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFabricPortGetProperties( hPort, pProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1733,17 +1933,14 @@ namespace validation_layer
         if( nullptr == pfnGetLinkType )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFabricPortGetLinkType", hPort ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFabricPortGetLinkType( hPort, pLinkType );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetLinkType( hPort, pLinkType );
@@ -1751,6 +1948,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetLinkType( hPort, pLinkType );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFabricPortGetLinkType", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFabricPortGetLinkType( hPort, pLinkType );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1767,17 +1971,14 @@ namespace validation_layer
         if( nullptr == pfnGetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFabricPortGetConfig", hPort ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFabricPortGetConfig( hPort, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetConfig( hPort, pConfig );
@@ -1785,6 +1986,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetConfig( hPort, pConfig );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFabricPortGetConfig", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFabricPortGetConfig( hPort, pConfig );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1801,17 +2009,14 @@ namespace validation_layer
         if( nullptr == pfnSetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFabricPortSetConfig", hPort ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFabricPortSetConfig( hPort, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortSetConfig( hPort, pConfig );
@@ -1819,6 +2024,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetConfig( hPort, pConfig );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFabricPortSetConfig", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFabricPortSetConfig( hPort, pConfig );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1835,17 +2047,14 @@ namespace validation_layer
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFabricPortGetState", hPort ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFabricPortGetState( hPort, pState );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetState( hPort, pState );
@@ -1853,6 +2062,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetState( hPort, pState );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFabricPortGetState", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFabricPortGetState( hPort, pState );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1869,17 +2085,14 @@ namespace validation_layer
         if( nullptr == pfnGetThroughput )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFabricPortGetThroughput", hPort ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFabricPortGetThroughput( hPort, pThroughput );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetThroughput( hPort, pThroughput );
@@ -1887,6 +2100,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetThroughput( hPort, pThroughput );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFabricPortGetThroughput", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFabricPortGetThroughput( hPort, pThroughput );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1903,17 +2123,14 @@ namespace validation_layer
         if( nullptr == pfnGetFabricErrorCounters )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFabricPortGetFabricErrorCounters", hPort ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFabricPortGetFabricErrorCounters( hPort, pErrors );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetFabricErrorCounters( hPort, pErrors );
@@ -1921,6 +2138,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetFabricErrorCounters( hPort, pErrors );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFabricPortGetFabricErrorCounters", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFabricPortGetFabricErrorCounters( hPort, pErrors );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1941,17 +2165,14 @@ namespace validation_layer
         if( nullptr == pfnGetMultiPortThroughput )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFabricPortGetMultiPortThroughput", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFabricPortGetMultiPortThroughput( hDevice, numPorts, phPort, pThroughput );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFabricPortGetMultiPortThroughput( hDevice, numPorts, phPort, pThroughput );
@@ -1959,6 +2180,14 @@ namespace validation_layer
         }
 
         auto result = pfnGetMultiPortThroughput( hDevice, numPorts, phPort, pThroughput );
+
+        if( context.enableAsyncValidation ){
+            auto phPortCopy = AsyncValidation::copy( phPort, numPorts );
+            context.asyncValidation->submit( "zesFabricPortGetMultiPortThroughput", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFabricPortGetMultiPortThroughput( hDevice, numPorts, phPortCopy.data(), pThroughput );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1985,17 +2214,14 @@ namespace validation_layer
         if( nullptr == pfnEnumFans )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceEnumFans", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceEnumFans( hDevice, pCount, phFan );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumFans( hDevice, pCount, phFan );
@@ -2003,6 +2229,13 @@ namespace validation_layer
         }
 
         auto result = pfnEnumFans( hDevice, pCount, phFan );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceEnumFans", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceEnumFans( hDevice, pCount, phFan );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2019,17 +2252,14 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFanGetProperties", hFan ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFanGetProperties( hFan, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFanGetProperties( hFan, pProperties );
@@ -2037,6 +2267,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetProperties( hFan, pProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFanGetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFanGetProperties( hFan, pProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2053,17 +2290,14 @@ namespace validation_layer
         if( nullptr == pfnGetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFanGetConfig", hFan ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFanGetConfig( hFan, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFanGetConfig( hFan, pConfig );
@@ -2071,6 +2305,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetConfig( hFan, pConfig );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFanGetConfig", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFanGetConfig( hFan, pConfig );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2086,17 +2327,14 @@ namespace validation_layer
         if( nullptr == pfnSetDefaultMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFanSetDefaultMode", hFan ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFanSetDefaultMode( hFan );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFanSetDefaultMode( hFan );
@@ -2104,6 +2342,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetDefaultMode( hFan );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFanSetDefaultMode", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFanSetDefaultMode( hFan );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2120,17 +2365,14 @@ namespace validation_layer
         if( nullptr == pfnSetFixedSpeedMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFanSetFixedSpeedMode", hFan ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFanSetFixedSpeedMode( hFan, speed );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFanSetFixedSpeedMode( hFan, speed );
@@ -2138,6 +2380,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetFixedSpeedMode( hFan, speed );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFanSetFixedSpeedMode", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFanSetFixedSpeedMode( hFan, speed );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2154,17 +2403,14 @@ namespace validation_layer
         if( nullptr == pfnSetSpeedTableMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFanSetSpeedTableMode", hFan ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFanSetSpeedTableMode( hFan, speedTable );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFanSetSpeedTableMode( hFan, speedTable );
@@ -2172,6 +2418,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetSpeedTableMode( hFan, speedTable );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFanSetSpeedTableMode", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFanSetSpeedTableMode( hFan, speedTable );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2191,17 +2444,14 @@ namespace validation_layer
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFanGetState", hFan ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFanGetState( hFan, units, pSpeed );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFanGetState( hFan, units, pSpeed );
@@ -2209,6 +2459,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetState( hFan, units, pSpeed );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFanGetState", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFanGetState( hFan, units, pSpeed );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2235,17 +2492,14 @@ namespace validation_layer
         if( nullptr == pfnEnumFirmwares )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceEnumFirmwares", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceEnumFirmwares( hDevice, pCount, phFirmware );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumFirmwares( hDevice, pCount, phFirmware );
@@ -2253,6 +2507,13 @@ namespace validation_layer
         }
 
         auto result = pfnEnumFirmwares( hDevice, pCount, phFirmware );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceEnumFirmwares", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceEnumFirmwares( hDevice, pCount, phFirmware );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2270,17 +2531,14 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFirmwareGetProperties", hFirmware ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFirmwareGetProperties( hFirmware, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFirmwareGetProperties( hFirmware, pProperties );
@@ -2288,6 +2546,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetProperties( hFirmware, pProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFirmwareGetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFirmwareGetProperties( hFirmware, pProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2305,17 +2570,14 @@ namespace validation_layer
         if( nullptr == pfnFlash )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFirmwareFlash", hFirmware ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFirmwareFlash( hFirmware, pImage, size );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFirmwareFlash( hFirmware, pImage, size );
@@ -2323,6 +2585,13 @@ namespace validation_layer
         }
 
         auto result = pfnFlash( hFirmware, pImage, size );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFirmwareFlash", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFirmwareFlash( hFirmware, pImage, size );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2339,17 +2608,14 @@ namespace validation_layer
         if( nullptr == pfnGetFlashProgress )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFirmwareGetFlashProgress", hFirmware ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFirmwareGetFlashProgress( hFirmware, pCompletionPercent );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFirmwareGetFlashProgress( hFirmware, pCompletionPercent );
@@ -2357,6 +2623,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetFlashProgress( hFirmware, pCompletionPercent );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFirmwareGetFlashProgress", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFirmwareGetFlashProgress( hFirmware, pCompletionPercent );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2374,17 +2647,14 @@ namespace validation_layer
         if( nullptr == pfnGetConsoleLogs )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFirmwareGetConsoleLogs", hFirmware ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFirmwareGetConsoleLogs( hFirmware, pSize, pFirmwareLog );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFirmwareGetConsoleLogs( hFirmware, pSize, pFirmwareLog );
@@ -2392,6 +2662,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetConsoleLogs( hFirmware, pSize, pFirmwareLog );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFirmwareGetConsoleLogs", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFirmwareGetConsoleLogs( hFirmware, pSize, pFirmwareLog );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2418,17 +2695,14 @@ namespace validation_layer
         if( nullptr == pfnEnumFrequencyDomains )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceEnumFrequencyDomains", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceEnumFrequencyDomains( hDevice, pCount, phFrequency );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumFrequencyDomains( hDevice, pCount, phFrequency );
@@ -2436,6 +2710,13 @@ namespace validation_layer
         }
 
         auto result = pfnEnumFrequencyDomains( hDevice, pCount, phFrequency );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceEnumFrequencyDomains", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceEnumFrequencyDomains( hDevice, pCount, phFrequency );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2452,17 +2733,14 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFrequencyGetProperties", hFrequency ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFrequencyGetProperties( hFrequency, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyGetProperties( hFrequency, pProperties );
@@ -2470,6 +2748,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetProperties( hFrequency, pProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFrequencyGetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFrequencyGetProperties( hFrequency, pProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2494,17 +2779,14 @@ namespace validation_layer
         if( nullptr == pfnGetAvailableClocks )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFrequencyGetAvailableClocks", hFrequency ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFrequencyGetAvailableClocks( hFrequency, pCount, phFrequency );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyGetAvailableClocks( hFrequency, pCount, phFrequency );
@@ -2512,6 +2794,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetAvailableClocks( hFrequency, pCount, phFrequency );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFrequencyGetAvailableClocks", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFrequencyGetAvailableClocks( hFrequency, pCount, phFrequency );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2529,17 +2818,14 @@ namespace validation_layer
         if( nullptr == pfnGetRange )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFrequencyGetRange", hFrequency ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFrequencyGetRange( hFrequency, pLimits );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyGetRange( hFrequency, pLimits );
@@ -2547,6 +2833,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetRange( hFrequency, pLimits );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFrequencyGetRange", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFrequencyGetRange( hFrequency, pLimits );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2564,17 +2857,14 @@ namespace validation_layer
         if( nullptr == pfnSetRange )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFrequencySetRange", hFrequency ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFrequencySetRange( hFrequency, pLimits );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencySetRange( hFrequency, pLimits );
@@ -2582,6 +2872,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetRange( hFrequency, pLimits );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFrequencySetRange", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFrequencySetRange( hFrequency, pLimits );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2598,17 +2895,14 @@ namespace validation_layer
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFrequencyGetState", hFrequency ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFrequencyGetState( hFrequency, pState );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyGetState( hFrequency, pState );
@@ -2616,6 +2910,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetState( hFrequency, pState );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFrequencyGetState", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFrequencyGetState( hFrequency, pState );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2633,17 +2934,14 @@ namespace validation_layer
         if( nullptr == pfnGetThrottleTime )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFrequencyGetThrottleTime", hFrequency ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFrequencyGetThrottleTime( hFrequency, pThrottleTime );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyGetThrottleTime( hFrequency, pThrottleTime );
@@ -2651,6 +2949,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetThrottleTime( hFrequency, pThrottleTime );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFrequencyGetThrottleTime", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFrequencyGetThrottleTime( hFrequency, pThrottleTime );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2667,17 +2972,14 @@ namespace validation_layer
         if( nullptr == pfnOcGetCapabilities )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFrequencyOcGetCapabilities", hFrequency ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFrequencyOcGetCapabilities( hFrequency, pOcCapabilities );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetCapabilities( hFrequency, pOcCapabilities );
@@ -2685,6 +2987,13 @@ namespace validation_layer
         }
 
         auto result = pfnOcGetCapabilities( hFrequency, pOcCapabilities );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFrequencyOcGetCapabilities", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetCapabilities( hFrequency, pOcCapabilities );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2704,17 +3013,14 @@ namespace validation_layer
         if( nullptr == pfnOcGetFrequencyTarget )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFrequencyOcGetFrequencyTarget", hFrequency ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFrequencyOcGetFrequencyTarget( hFrequency, pCurrentOcFrequency );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetFrequencyTarget( hFrequency, pCurrentOcFrequency );
@@ -2722,6 +3028,13 @@ namespace validation_layer
         }
 
         auto result = pfnOcGetFrequencyTarget( hFrequency, pCurrentOcFrequency );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFrequencyOcGetFrequencyTarget", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetFrequencyTarget( hFrequency, pCurrentOcFrequency );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2741,17 +3054,14 @@ namespace validation_layer
         if( nullptr == pfnOcSetFrequencyTarget )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFrequencyOcSetFrequencyTarget", hFrequency ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFrequencyOcSetFrequencyTarget( hFrequency, CurrentOcFrequency );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcSetFrequencyTarget( hFrequency, CurrentOcFrequency );
@@ -2759,6 +3069,13 @@ namespace validation_layer
         }
 
         auto result = pfnOcSetFrequencyTarget( hFrequency, CurrentOcFrequency );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFrequencyOcSetFrequencyTarget", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFrequencyOcSetFrequencyTarget( hFrequency, CurrentOcFrequency );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2780,17 +3097,14 @@ namespace validation_layer
         if( nullptr == pfnOcGetVoltageTarget )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFrequencyOcGetVoltageTarget", hFrequency ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFrequencyOcGetVoltageTarget( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetVoltageTarget( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset );
@@ -2798,6 +3112,13 @@ namespace validation_layer
         }
 
         auto result = pfnOcGetVoltageTarget( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFrequencyOcGetVoltageTarget", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetVoltageTarget( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2819,17 +3140,14 @@ namespace validation_layer
         if( nullptr == pfnOcSetVoltageTarget )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFrequencyOcSetVoltageTarget", hFrequency ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFrequencyOcSetVoltageTarget( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcSetVoltageTarget( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset );
@@ -2837,6 +3155,13 @@ namespace validation_layer
         }
 
         auto result = pfnOcSetVoltageTarget( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFrequencyOcSetVoltageTarget", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFrequencyOcSetVoltageTarget( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2853,17 +3178,14 @@ namespace validation_layer
         if( nullptr == pfnOcSetMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFrequencyOcSetMode", hFrequency ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFrequencyOcSetMode( hFrequency, CurrentOcMode );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcSetMode( hFrequency, CurrentOcMode );
@@ -2871,6 +3193,13 @@ namespace validation_layer
         }
 
         auto result = pfnOcSetMode( hFrequency, CurrentOcMode );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFrequencyOcSetMode", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFrequencyOcSetMode( hFrequency, CurrentOcMode );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2887,17 +3216,14 @@ namespace validation_layer
         if( nullptr == pfnOcGetMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFrequencyOcGetMode", hFrequency ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFrequencyOcGetMode( hFrequency, pCurrentOcMode );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetMode( hFrequency, pCurrentOcMode );
@@ -2905,6 +3231,13 @@ namespace validation_layer
         }
 
         auto result = pfnOcGetMode( hFrequency, pCurrentOcMode );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFrequencyOcGetMode", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetMode( hFrequency, pCurrentOcMode );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2922,17 +3255,14 @@ namespace validation_layer
         if( nullptr == pfnOcGetIccMax )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFrequencyOcGetIccMax", hFrequency ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFrequencyOcGetIccMax( hFrequency, pOcIccMax );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetIccMax( hFrequency, pOcIccMax );
@@ -2940,6 +3270,13 @@ namespace validation_layer
         }
 
         auto result = pfnOcGetIccMax( hFrequency, pOcIccMax );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFrequencyOcGetIccMax", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetIccMax( hFrequency, pOcIccMax );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2956,17 +3293,14 @@ namespace validation_layer
         if( nullptr == pfnOcSetIccMax )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFrequencyOcSetIccMax", hFrequency ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFrequencyOcSetIccMax( hFrequency, ocIccMax );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcSetIccMax( hFrequency, ocIccMax );
@@ -2974,6 +3308,13 @@ namespace validation_layer
         }
 
         auto result = pfnOcSetIccMax( hFrequency, ocIccMax );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFrequencyOcSetIccMax", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFrequencyOcSetIccMax( hFrequency, ocIccMax );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2991,17 +3332,14 @@ namespace validation_layer
         if( nullptr == pfnOcGetTjMax )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFrequencyOcGetTjMax", hFrequency ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFrequencyOcGetTjMax( hFrequency, pOcTjMax );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetTjMax( hFrequency, pOcTjMax );
@@ -3009,6 +3347,13 @@ namespace validation_layer
         }
 
         auto result = pfnOcGetTjMax( hFrequency, pOcTjMax );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFrequencyOcGetTjMax", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFrequencyOcGetTjMax( hFrequency, pOcTjMax );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3025,17 +3370,14 @@ namespace validation_layer
         if( nullptr == pfnOcSetTjMax )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFrequencyOcSetTjMax", hFrequency ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFrequencyOcSetTjMax( hFrequency, ocTjMax );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFrequencyOcSetTjMax( hFrequency, ocTjMax );
@@ -3043,6 +3385,13 @@ namespace validation_layer
         }
 
         auto result = pfnOcSetTjMax( hFrequency, ocTjMax );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFrequencyOcSetTjMax", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFrequencyOcSetTjMax( hFrequency, ocTjMax );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3069,17 +3418,14 @@ namespace validation_layer
         if( nullptr == pfnEnumLeds )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceEnumLeds", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceEnumLeds( hDevice, pCount, phLed );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumLeds( hDevice, pCount, phLed );
@@ -3087,6 +3433,13 @@ namespace validation_layer
         }
 
         auto result = pfnEnumLeds( hDevice, pCount, phLed );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceEnumLeds", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceEnumLeds( hDevice, pCount, phLed );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3103,17 +3456,14 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesLedGetProperties", hLed ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesLedGetProperties( hLed, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesLedGetProperties( hLed, pProperties );
@@ -3121,6 +3471,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetProperties( hLed, pProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesLedGetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesLedGetProperties( hLed, pProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3137,17 +3494,14 @@ namespace validation_layer
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesLedGetState", hLed ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesLedGetState( hLed, pState );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesLedGetState( hLed, pState );
@@ -3155,6 +3509,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetState( hLed, pState );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesLedGetState", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesLedGetState( hLed, pState );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3171,17 +3532,14 @@ namespace validation_layer
         if( nullptr == pfnSetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesLedSetState", hLed ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesLedSetState( hLed, enable );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesLedSetState( hLed, enable );
@@ -3189,6 +3547,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetState( hLed, enable );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesLedSetState", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesLedSetState( hLed, enable );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3205,17 +3570,14 @@ namespace validation_layer
         if( nullptr == pfnSetColor )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesLedSetColor", hLed ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesLedSetColor( hLed, pColor );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesLedSetColor( hLed, pColor );
@@ -3223,6 +3585,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetColor( hLed, pColor );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesLedSetColor", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesLedSetColor( hLed, pColor );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3249,17 +3618,14 @@ namespace validation_layer
         if( nullptr == pfnEnumMemoryModules )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceEnumMemoryModules", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceEnumMemoryModules( hDevice, pCount, phMemory );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumMemoryModules( hDevice, pCount, phMemory );
@@ -3267,6 +3633,13 @@ namespace validation_layer
         }
 
         auto result = pfnEnumMemoryModules( hDevice, pCount, phMemory );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceEnumMemoryModules", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceEnumMemoryModules( hDevice, pCount, phMemory );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3283,17 +3656,14 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesMemoryGetProperties", hMemory ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesMemoryGetProperties( hMemory, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesMemoryGetProperties( hMemory, pProperties );
@@ -3301,6 +3671,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetProperties( hMemory, pProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesMemoryGetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesMemoryGetProperties( hMemory, pProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3317,17 +3694,14 @@ namespace validation_layer
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesMemoryGetState", hMemory ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesMemoryGetState( hMemory, pState );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesMemoryGetState( hMemory, pState );
@@ -3335,6 +3709,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetState( hMemory, pState );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesMemoryGetState", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesMemoryGetState( hMemory, pState );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3352,17 +3733,14 @@ namespace validation_layer
         if( nullptr == pfnGetBandwidth )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesMemoryGetBandwidth", hMemory ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesMemoryGetBandwidth( hMemory, pBandwidth );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesMemoryGetBandwidth( hMemory, pBandwidth );
@@ -3370,6 +3748,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetBandwidth( hMemory, pBandwidth );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesMemoryGetBandwidth", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesMemoryGetBandwidth( hMemory, pBandwidth );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3396,17 +3781,14 @@ namespace validation_layer
         if( nullptr == pfnEnumPerformanceFactorDomains )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceEnumPerformanceFactorDomains", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceEnumPerformanceFactorDomains( hDevice, pCount, phPerf );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumPerformanceFactorDomains( hDevice, pCount, phPerf );
@@ -3414,6 +3796,13 @@ namespace validation_layer
         }
 
         auto result = pfnEnumPerformanceFactorDomains( hDevice, pCount, phPerf );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceEnumPerformanceFactorDomains", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceEnumPerformanceFactorDomains( hDevice, pCount, phPerf );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3431,17 +3820,14 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesPerformanceFactorGetProperties", hPerf ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesPerformanceFactorGetProperties( hPerf, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPerformanceFactorGetProperties( hPerf, pProperties );
@@ -3449,6 +3835,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetProperties( hPerf, pProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesPerformanceFactorGetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesPerformanceFactorGetProperties( hPerf, pProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3466,17 +3859,14 @@ namespace validation_layer
         if( nullptr == pfnGetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesPerformanceFactorGetConfig", hPerf ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesPerformanceFactorGetConfig( hPerf, pFactor );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPerformanceFactorGetConfig( hPerf, pFactor );
@@ -3484,6 +3874,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetConfig( hPerf, pFactor );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesPerformanceFactorGetConfig", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesPerformanceFactorGetConfig( hPerf, pFactor );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3500,17 +3897,14 @@ namespace validation_layer
         if( nullptr == pfnSetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesPerformanceFactorSetConfig", hPerf ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesPerformanceFactorSetConfig( hPerf, factor );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPerformanceFactorSetConfig( hPerf, factor );
@@ -3518,6 +3912,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetConfig( hPerf, factor );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesPerformanceFactorSetConfig", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesPerformanceFactorSetConfig( hPerf, factor );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3544,17 +3945,14 @@ namespace validation_layer
         if( nullptr == pfnEnumPowerDomains )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceEnumPowerDomains", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceEnumPowerDomains( hDevice, pCount, phPower );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumPowerDomains( hDevice, pCount, phPower );
@@ -3562,6 +3960,13 @@ namespace validation_layer
         }
 
         auto result = pfnEnumPowerDomains( hDevice, pCount, phPower );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceEnumPowerDomains", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceEnumPowerDomains( hDevice, pCount, phPower );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3578,17 +3983,14 @@ namespace validation_layer
         if( nullptr == pfnGetCardPowerDomain )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceGetCardPowerDomain", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceGetCardPowerDomain( hDevice, phPower );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetCardPowerDomain( hDevice, phPower );
@@ -3596,6 +3998,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetCardPowerDomain( hDevice, phPower );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceGetCardPowerDomain", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceGetCardPowerDomain( hDevice, phPower );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3612,17 +4021,14 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesPowerGetProperties", hPower ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesPowerGetProperties( hPower, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerGetProperties( hPower, pProperties );
@@ -3630,6 +4036,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetProperties( hPower, pProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesPowerGetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesPowerGetProperties( hPower, pProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3647,17 +4060,14 @@ namespace validation_layer
         if( nullptr == pfnGetEnergyCounter )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesPowerGetEnergyCounter", hPower ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesPowerGetEnergyCounter( hPower, pEnergy );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerGetEnergyCounter( hPower, pEnergy );
@@ -3665,6 +4075,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetEnergyCounter( hPower, pEnergy );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesPowerGetEnergyCounter", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesPowerGetEnergyCounter( hPower, pEnergy );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3686,17 +4103,14 @@ namespace validation_layer
         if( nullptr == pfnGetLimits )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesPowerGetLimits", hPower ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesPowerGetLimits( hPower, pSustained, pBurst, pPeak );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerGetLimits( hPower, pSustained, pBurst, pPeak );
@@ -3704,6 +4118,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetLimits( hPower, pSustained, pBurst, pPeak );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesPowerGetLimits", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesPowerGetLimits( hPower, pSustained, pBurst, pPeak );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3725,17 +4146,14 @@ namespace validation_layer
         if( nullptr == pfnSetLimits )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesPowerSetLimits", hPower ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesPowerSetLimits( hPower, pSustained, pBurst, pPeak );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerSetLimits( hPower, pSustained, pBurst, pPeak );
@@ -3743,6 +4161,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetLimits( hPower, pSustained, pBurst, pPeak );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesPowerSetLimits", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesPowerSetLimits( hPower, pSustained, pBurst, pPeak );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3760,17 +4185,14 @@ namespace validation_layer
         if( nullptr == pfnGetEnergyThreshold )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesPowerGetEnergyThreshold", hPower ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesPowerGetEnergyThreshold( hPower, pThreshold );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerGetEnergyThreshold( hPower, pThreshold );
@@ -3778,6 +4200,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetEnergyThreshold( hPower, pThreshold );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesPowerGetEnergyThreshold", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesPowerGetEnergyThreshold( hPower, pThreshold );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3794,17 +4223,14 @@ namespace validation_layer
         if( nullptr == pfnSetEnergyThreshold )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesPowerSetEnergyThreshold", hPower ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesPowerSetEnergyThreshold( hPower, threshold );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerSetEnergyThreshold( hPower, threshold );
@@ -3812,6 +4238,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetEnergyThreshold( hPower, threshold );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesPowerSetEnergyThreshold", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesPowerSetEnergyThreshold( hPower, threshold );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3838,17 +4271,14 @@ namespace validation_layer
         if( nullptr == pfnEnumPsus )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceEnumPsus", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceEnumPsus( hDevice, pCount, phPsu );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumPsus( hDevice, pCount, phPsu );
@@ -3856,6 +4286,13 @@ namespace validation_layer
         }
 
         auto result = pfnEnumPsus( hDevice, pCount, phPsu );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceEnumPsus", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceEnumPsus( hDevice, pCount, phPsu );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3872,17 +4309,14 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesPsuGetProperties", hPsu ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesPsuGetProperties( hPsu, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPsuGetProperties( hPsu, pProperties );
@@ -3890,6 +4324,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetProperties( hPsu, pProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesPsuGetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesPsuGetProperties( hPsu, pProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3906,17 +4347,14 @@ namespace validation_layer
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesPsuGetState", hPsu ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesPsuGetState( hPsu, pState );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPsuGetState( hPsu, pState );
@@ -3924,6 +4362,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetState( hPsu, pState );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesPsuGetState", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesPsuGetState( hPsu, pState );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3950,17 +4395,14 @@ namespace validation_layer
         if( nullptr == pfnEnumRasErrorSets )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceEnumRasErrorSets", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceEnumRasErrorSets( hDevice, pCount, phRas );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumRasErrorSets( hDevice, pCount, phRas );
@@ -3968,6 +4410,13 @@ namespace validation_layer
         }
 
         auto result = pfnEnumRasErrorSets( hDevice, pCount, phRas );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceEnumRasErrorSets", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceEnumRasErrorSets( hDevice, pCount, phRas );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -3984,17 +4433,14 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesRasGetProperties", hRas ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesRasGetProperties( hRas, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesRasGetProperties( hRas, pProperties );
@@ -4002,6 +4448,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetProperties( hRas, pProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesRasGetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesRasGetProperties( hRas, pProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4019,17 +4472,14 @@ namespace validation_layer
         if( nullptr == pfnGetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesRasGetConfig", hRas ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesRasGetConfig( hRas, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesRasGetConfig( hRas, pConfig );
@@ -4037,6 +4487,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetConfig( hRas, pConfig );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesRasGetConfig", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesRasGetConfig( hRas, pConfig );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4053,17 +4510,14 @@ namespace validation_layer
         if( nullptr == pfnSetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesRasSetConfig", hRas ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesRasSetConfig( hRas, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesRasSetConfig( hRas, pConfig );
@@ -4071,6 +4525,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetConfig( hRas, pConfig );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesRasSetConfig", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesRasSetConfig( hRas, pConfig );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4088,17 +4549,14 @@ namespace validation_layer
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesRasGetState", hRas ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesRasGetState( hRas, clear, pState );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesRasGetState( hRas, clear, pState );
@@ -4106,6 +4564,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetState( hRas, clear, pState );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesRasGetState", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesRasGetState( hRas, clear, pState );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4132,17 +4597,14 @@ namespace validation_layer
         if( nullptr == pfnEnumSchedulers )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceEnumSchedulers", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceEnumSchedulers( hDevice, pCount, phScheduler );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumSchedulers( hDevice, pCount, phScheduler );
@@ -4150,6 +4612,13 @@ namespace validation_layer
         }
 
         auto result = pfnEnumSchedulers( hDevice, pCount, phScheduler );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceEnumSchedulers", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceEnumSchedulers( hDevice, pCount, phScheduler );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4166,17 +4635,14 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesSchedulerGetProperties", hScheduler ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesSchedulerGetProperties( hScheduler, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerGetProperties( hScheduler, pProperties );
@@ -4184,6 +4650,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetProperties( hScheduler, pProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesSchedulerGetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesSchedulerGetProperties( hScheduler, pProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4200,17 +4673,14 @@ namespace validation_layer
         if( nullptr == pfnGetCurrentMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesSchedulerGetCurrentMode", hScheduler ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesSchedulerGetCurrentMode( hScheduler, pMode );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerGetCurrentMode( hScheduler, pMode );
@@ -4218,6 +4688,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetCurrentMode( hScheduler, pMode );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesSchedulerGetCurrentMode", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesSchedulerGetCurrentMode( hScheduler, pMode );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4236,17 +4713,14 @@ namespace validation_layer
         if( nullptr == pfnGetTimeoutModeProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesSchedulerGetTimeoutModeProperties", hScheduler ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesSchedulerGetTimeoutModeProperties( hScheduler, getDefaults, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerGetTimeoutModeProperties( hScheduler, getDefaults, pConfig );
@@ -4254,6 +4728,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetTimeoutModeProperties( hScheduler, getDefaults, pConfig );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesSchedulerGetTimeoutModeProperties", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesSchedulerGetTimeoutModeProperties( hScheduler, getDefaults, pConfig );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4272,17 +4753,14 @@ namespace validation_layer
         if( nullptr == pfnGetTimesliceModeProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesSchedulerGetTimesliceModeProperties", hScheduler ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesSchedulerGetTimesliceModeProperties( hScheduler, getDefaults, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerGetTimesliceModeProperties( hScheduler, getDefaults, pConfig );
@@ -4290,6 +4768,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetTimesliceModeProperties( hScheduler, getDefaults, pConfig );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesSchedulerGetTimesliceModeProperties", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesSchedulerGetTimesliceModeProperties( hScheduler, getDefaults, pConfig );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4308,17 +4793,14 @@ namespace validation_layer
         if( nullptr == pfnSetTimeoutMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesSchedulerSetTimeoutMode", hScheduler ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesSchedulerSetTimeoutMode( hScheduler, pProperties, pNeedReload );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerSetTimeoutMode( hScheduler, pProperties, pNeedReload );
@@ -4326,6 +4808,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetTimeoutMode( hScheduler, pProperties, pNeedReload );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesSchedulerSetTimeoutMode", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesSchedulerSetTimeoutMode( hScheduler, pProperties, pNeedReload );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4344,17 +4833,14 @@ namespace validation_layer
         if( nullptr == pfnSetTimesliceMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesSchedulerSetTimesliceMode", hScheduler ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesSchedulerSetTimesliceMode( hScheduler, pProperties, pNeedReload );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerSetTimesliceMode( hScheduler, pProperties, pNeedReload );
@@ -4362,6 +4848,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetTimesliceMode( hScheduler, pProperties, pNeedReload );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesSchedulerSetTimesliceMode", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesSchedulerSetTimesliceMode( hScheduler, pProperties, pNeedReload );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4379,17 +4872,14 @@ namespace validation_layer
         if( nullptr == pfnSetExclusiveMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesSchedulerSetExclusiveMode", hScheduler ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesSchedulerSetExclusiveMode( hScheduler, pNeedReload );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerSetExclusiveMode( hScheduler, pNeedReload );
@@ -4397,6 +4887,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetExclusiveMode( hScheduler, pNeedReload );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesSchedulerSetExclusiveMode", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesSchedulerSetExclusiveMode( hScheduler, pNeedReload );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4414,17 +4911,14 @@ namespace validation_layer
         if( nullptr == pfnSetComputeUnitDebugMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesSchedulerSetComputeUnitDebugMode", hScheduler ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesSchedulerSetComputeUnitDebugMode( hScheduler, pNeedReload );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesSchedulerSetComputeUnitDebugMode( hScheduler, pNeedReload );
@@ -4432,6 +4926,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetComputeUnitDebugMode( hScheduler, pNeedReload );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesSchedulerSetComputeUnitDebugMode", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesSchedulerSetComputeUnitDebugMode( hScheduler, pNeedReload );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4458,17 +4959,14 @@ namespace validation_layer
         if( nullptr == pfnEnumStandbyDomains )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceEnumStandbyDomains", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceEnumStandbyDomains( hDevice, pCount, phStandby );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumStandbyDomains( hDevice, pCount, phStandby );
@@ -4476,6 +4974,13 @@ namespace validation_layer
         }
 
         auto result = pfnEnumStandbyDomains( hDevice, pCount, phStandby );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceEnumStandbyDomains", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceEnumStandbyDomains( hDevice, pCount, phStandby );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4492,17 +4997,14 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesStandbyGetProperties", hStandby ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesStandbyGetProperties( hStandby, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesStandbyGetProperties( hStandby, pProperties );
@@ -4510,6 +5012,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetProperties( hStandby, pProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesStandbyGetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesStandbyGetProperties( hStandby, pProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4526,17 +5035,14 @@ namespace validation_layer
         if( nullptr == pfnGetMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesStandbyGetMode", hStandby ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesStandbyGetMode( hStandby, pMode );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesStandbyGetMode( hStandby, pMode );
@@ -4544,6 +5050,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetMode( hStandby, pMode );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesStandbyGetMode", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesStandbyGetMode( hStandby, pMode );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4560,17 +5073,14 @@ namespace validation_layer
         if( nullptr == pfnSetMode )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesStandbySetMode", hStandby ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesStandbySetMode( hStandby, mode );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesStandbySetMode( hStandby, mode );
@@ -4578,6 +5088,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetMode( hStandby, mode );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesStandbySetMode", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesStandbySetMode( hStandby, mode );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4604,17 +5121,14 @@ namespace validation_layer
         if( nullptr == pfnEnumTemperatureSensors )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceEnumTemperatureSensors", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceEnumTemperatureSensors( hDevice, pCount, phTemperature );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumTemperatureSensors( hDevice, pCount, phTemperature );
@@ -4622,6 +5136,13 @@ namespace validation_layer
         }
 
         auto result = pfnEnumTemperatureSensors( hDevice, pCount, phTemperature );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceEnumTemperatureSensors", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceEnumTemperatureSensors( hDevice, pCount, phTemperature );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4638,17 +5159,14 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesTemperatureGetProperties", hTemperature ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesTemperatureGetProperties( hTemperature, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesTemperatureGetProperties( hTemperature, pProperties );
@@ -4656,6 +5174,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetProperties( hTemperature, pProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesTemperatureGetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesTemperatureGetProperties( hTemperature, pProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4672,17 +5197,14 @@ namespace validation_layer
         if( nullptr == pfnGetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesTemperatureGetConfig", hTemperature ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesTemperatureGetConfig( hTemperature, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesTemperatureGetConfig( hTemperature, pConfig );
@@ -4690,6 +5212,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetConfig( hTemperature, pConfig );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesTemperatureGetConfig", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesTemperatureGetConfig( hTemperature, pConfig );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4706,17 +5235,14 @@ namespace validation_layer
         if( nullptr == pfnSetConfig )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesTemperatureSetConfig", hTemperature ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesTemperatureSetConfig( hTemperature, pConfig );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesTemperatureSetConfig( hTemperature, pConfig );
@@ -4724,6 +5250,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetConfig( hTemperature, pConfig );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesTemperatureSetConfig", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesTemperatureSetConfig( hTemperature, pConfig );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4741,17 +5274,14 @@ namespace validation_layer
         if( nullptr == pfnGetState )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesTemperatureGetState", hTemperature ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesTemperatureGetState( hTemperature, pTemperature );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesTemperatureGetState( hTemperature, pTemperature );
@@ -4759,6 +5289,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetState( hTemperature, pTemperature );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesTemperatureGetState", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesTemperatureGetState( hTemperature, pTemperature );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4783,17 +5320,14 @@ namespace validation_layer
         if( nullptr == pfnGetLimitsExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesPowerGetLimitsExt", hPower ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesPowerGetLimitsExt( hPower, pCount, pSustained );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerGetLimitsExt( hPower, pCount, pSustained );
@@ -4801,6 +5335,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetLimitsExt( hPower, pCount, pSustained );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesPowerGetLimitsExt", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesPowerGetLimitsExt( hPower, pCount, pSustained );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4818,17 +5359,14 @@ namespace validation_layer
         if( nullptr == pfnSetLimitsExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesPowerSetLimitsExt", hPower ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesPowerSetLimitsExt( hPower, pCount, pSustained );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesPowerSetLimitsExt( hPower, pCount, pSustained );
@@ -4836,6 +5374,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetLimitsExt( hPower, pCount, pSustained );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesPowerSetLimitsExt", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesPowerSetLimitsExt( hPower, pCount, pSustained );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4865,17 +5410,14 @@ namespace validation_layer
         if( nullptr == pfnGetActivityExt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesEngineGetActivityExt", hEngine ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesEngineGetActivityExt( hEngine, pCount, pStats );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesEngineGetActivityExt( hEngine, pCount, pStats );
@@ -4883,6 +5425,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetActivityExt( hEngine, pCount, pStats );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesEngineGetActivityExt", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesEngineGetActivityExt( hEngine, pCount, pStats );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4907,17 +5456,14 @@ namespace validation_layer
         if( nullptr == pfnGetStateExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesRasGetStateExp", hRas ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesRasGetStateExp( hRas, pCount, pState );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesRasGetStateExp( hRas, pCount, pState );
@@ -4926,6 +5472,15 @@ namespace validation_layer
 
         auto result = pfnGetStateExp( hRas, pCount, pState );
 
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesRasGetStateExp", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesRasGetStateExp( hRas, pCount, pState );
+                if( result == ZE_RESULT_SUCCESS ){
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
         }
@@ -4945,17 +5500,14 @@ namespace validation_layer
         if( nullptr == pfnClearStateExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesRasClearStateExp", hRas ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesRasClearStateExp( hRas, category );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesRasClearStateExp( hRas, category );
@@ -4963,6 +5515,13 @@ namespace validation_layer
         }
 
         auto result = pfnClearStateExp( hRas, category );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesRasClearStateExp", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesRasClearStateExp( hRas, category );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -4980,17 +5539,14 @@ namespace validation_layer
         if( nullptr == pfnGetSecurityVersionExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFirmwareGetSecurityVersionExp", hFirmware ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFirmwareGetSecurityVersionExp( hFirmware, pVersion );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFirmwareGetSecurityVersionExp( hFirmware, pVersion );
@@ -5001,6 +5557,12 @@ namespace validation_layer
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
+        }
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFirmwareGetSecurityVersionExp", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFirmwareGetSecurityVersionExp( hFirmware, pVersion );
+                return check;
+            } );
         }
         return result;
     }
@@ -5017,17 +5579,14 @@ namespace validation_layer
         if( nullptr == pfnSetSecurityVersionExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesFirmwareSetSecurityVersionExp", hFirmware ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesFirmwareSetSecurityVersionExp( hFirmware );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesFirmwareSetSecurityVersionExp( hFirmware );
@@ -5035,6 +5594,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetSecurityVersionExp( hFirmware );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesFirmwareSetSecurityVersionExp", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesFirmwareSetSecurityVersionExp( hFirmware );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -5059,17 +5625,14 @@ namespace validation_layer
         if( nullptr == pfnGetSubDevicePropertiesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceGetSubDevicePropertiesExp", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceGetSubDevicePropertiesExp( hDevice, pCount, pSubdeviceProps );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceGetSubDevicePropertiesExp( hDevice, pCount, pSubdeviceProps );
@@ -5080,6 +5643,12 @@ namespace validation_layer
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
+        }
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceGetSubDevicePropertiesExp", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceGetSubDevicePropertiesExp( hDevice, pCount, pSubdeviceProps );
+                return check;
+            } );
         }
         return result;
     }
@@ -5101,17 +5670,14 @@ namespace validation_layer
         if( nullptr == pfnGetDeviceByUuidExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDriverGetDeviceByUuidExp", hDriver ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDriverGetDeviceByUuidExp( hDriver, uuid, phDevice, onSubdevice, subdeviceId );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDriverGetDeviceByUuidExp( hDriver, uuid, phDevice, onSubdevice, subdeviceId );
@@ -5128,6 +5694,12 @@ namespace validation_layer
 
             }
         }
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDriverGetDeviceByUuidExp", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDriverGetDeviceByUuidExp( hDriver, uuid, phDevice, onSubdevice, subdeviceId );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -5154,17 +5726,14 @@ namespace validation_layer
         if( nullptr == pfnEnumActiveVFExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesDeviceEnumActiveVFExp", hDevice ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesDeviceEnumActiveVFExp( hDevice, pCount, phVFhandle );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesDeviceEnumActiveVFExp( hDevice, pCount, phVFhandle );
@@ -5172,6 +5741,13 @@ namespace validation_layer
         }
 
         auto result = pfnEnumActiveVFExp( hDevice, pCount, phVFhandle );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesDeviceEnumActiveVFExp", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesDeviceEnumActiveVFExp( hDevice, pCount, phVFhandle );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -5188,17 +5764,14 @@ namespace validation_layer
         if( nullptr == pfnGetVFPropertiesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesVFManagementGetVFPropertiesExp", hVFhandle ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesVFManagementGetVFPropertiesExp( hVFhandle, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFPropertiesExp( hVFhandle, pProperties );
@@ -5209,6 +5782,12 @@ namespace validation_layer
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
+        }
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesVFManagementGetVFPropertiesExp", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFPropertiesExp( hVFhandle, pProperties );
+                return check;
+            } );
         }
         return result;
     }
@@ -5238,17 +5817,14 @@ namespace validation_layer
         if( nullptr == pfnGetVFMemoryUtilizationExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesVFManagementGetVFMemoryUtilizationExp", hVFhandle ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesVFManagementGetVFMemoryUtilizationExp( hVFhandle, pCount, pMemUtil );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFMemoryUtilizationExp( hVFhandle, pCount, pMemUtil );
@@ -5259,6 +5835,12 @@ namespace validation_layer
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
+        }
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesVFManagementGetVFMemoryUtilizationExp", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFMemoryUtilizationExp( hVFhandle, pCount, pMemUtil );
+                return check;
+            } );
         }
         return result;
     }
@@ -5288,17 +5870,14 @@ namespace validation_layer
         if( nullptr == pfnGetVFEngineUtilizationExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesVFManagementGetVFEngineUtilizationExp", hVFhandle ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesVFManagementGetVFEngineUtilizationExp( hVFhandle, pCount, pEngineUtil );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFEngineUtilizationExp( hVFhandle, pCount, pEngineUtil );
@@ -5309,6 +5888,12 @@ namespace validation_layer
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
+        }
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesVFManagementGetVFEngineUtilizationExp", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesVFManagementGetVFEngineUtilizationExp( hVFhandle, pCount, pEngineUtil );
+                return check;
+            } );
         }
         return result;
     }
@@ -5328,17 +5913,14 @@ namespace validation_layer
         if( nullptr == pfnSetVFTelemetryModeExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesVFManagementSetVFTelemetryModeExp", hVFhandle ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesVFManagementSetVFTelemetryModeExp( hVFhandle, flags, enable );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementSetVFTelemetryModeExp( hVFhandle, flags, enable );
@@ -5346,6 +5928,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetVFTelemetryModeExp( hVFhandle, flags, enable );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesVFManagementSetVFTelemetryModeExp", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesVFManagementSetVFTelemetryModeExp( hVFhandle, flags, enable );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -5364,17 +5953,14 @@ namespace validation_layer
         if( nullptr == pfnSetVFTelemetrySamplingIntervalExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zesVFManagementSetVFTelemetrySamplingIntervalExp", hVFhandle ) )
         {
             auto result = context.paramValidation->zesParamValidation.zesVFManagementSetVFTelemetrySamplingIntervalExp( hVFhandle, flag, samplingInterval );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zesHandleLifetime.zesVFManagementSetVFTelemetrySamplingIntervalExp( hVFhandle, flag, samplingInterval );
@@ -5382,6 +5968,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetVFTelemetrySamplingIntervalExp( hVFhandle, flag, samplingInterval );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zesVFManagementSetVFTelemetrySamplingIntervalExp", [=]() mutable {
+                auto check = context.handleLifetime->zesHandleLifetime.zesVFManagementSetVFTelemetrySamplingIntervalExp( hVFhandle, flag, samplingInterval );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -28,24 +28,35 @@ namespace validation_layer
         if( nullptr == pfnGetDebugInfo )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetModuleGetDebugInfo", hModule ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetModuleGetDebugInfo( hModule, format, pSize, pDebugInfo );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetModuleGetDebugInfo( hModule, format, pSize, pDebugInfo );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnGetDebugInfo( hModule, format, pSize, pDebugInfo );
+        auto hModuleLocal = hModule;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hModuleLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnGetDebugInfo( hModuleLocal, format, pSize, pDebugInfo );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetModuleGetDebugInfo", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetModuleGetDebugInfo( hModule, format, pSize, pDebugInfo );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -62,17 +73,14 @@ namespace validation_layer
         if( nullptr == pfnGetDebugProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetDeviceGetDebugProperties", hDevice ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetDeviceGetDebugProperties( hDevice, pDebugProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDeviceGetDebugProperties( hDevice, pDebugProperties );
@@ -80,6 +88,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetDebugProperties( hDevice, pDebugProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetDeviceGetDebugProperties", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetDeviceGetDebugProperties( hDevice, pDebugProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -97,17 +112,14 @@ namespace validation_layer
         if( nullptr == pfnAttach )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetDebugAttach", hDevice ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetDebugAttach( hDevice, config, phDebug );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugAttach( hDevice, config, phDebug );
@@ -115,6 +127,13 @@ namespace validation_layer
         }
 
         auto result = pfnAttach( hDevice, config, phDebug );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetDebugAttach", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetDebugAttach( hDevice, config, phDebug );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -130,17 +149,14 @@ namespace validation_layer
         if( nullptr == pfnDetach )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetDebugDetach", hDebug ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetDebugDetach( hDebug );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugDetach( hDebug );
@@ -148,6 +164,13 @@ namespace validation_layer
         }
 
         auto result = pfnDetach( hDebug );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetDebugDetach", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetDebugDetach( hDebug );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -171,17 +194,14 @@ namespace validation_layer
         if( nullptr == pfnReadEvent )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetDebugReadEvent", hDebug ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetDebugReadEvent( hDebug, timeout, event );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugReadEvent( hDebug, timeout, event );
@@ -189,6 +209,13 @@ namespace validation_layer
         }
 
         auto result = pfnReadEvent( hDebug, timeout, event );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetDebugReadEvent", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetDebugReadEvent( hDebug, timeout, event );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -205,17 +232,14 @@ namespace validation_layer
         if( nullptr == pfnAcknowledgeEvent )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetDebugAcknowledgeEvent", hDebug ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetDebugAcknowledgeEvent( hDebug, event );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugAcknowledgeEvent( hDebug, event );
@@ -223,6 +247,13 @@ namespace validation_layer
         }
 
         auto result = pfnAcknowledgeEvent( hDebug, event );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetDebugAcknowledgeEvent", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetDebugAcknowledgeEvent( hDebug, event );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -239,17 +270,14 @@ namespace validation_layer
         if( nullptr == pfnInterrupt )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetDebugInterrupt", hDebug ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetDebugInterrupt( hDebug, thread );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugInterrupt( hDebug, thread );
@@ -257,6 +285,13 @@ namespace validation_layer
         }
 
         auto result = pfnInterrupt( hDebug, thread );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetDebugInterrupt", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetDebugInterrupt( hDebug, thread );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -273,17 +308,14 @@ namespace validation_layer
         if( nullptr == pfnResume )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetDebugResume", hDebug ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetDebugResume( hDebug, thread );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugResume( hDebug, thread );
@@ -291,6 +323,13 @@ namespace validation_layer
         }
 
         auto result = pfnResume( hDebug, thread );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetDebugResume", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetDebugResume( hDebug, thread );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -310,17 +349,14 @@ namespace validation_layer
         if( nullptr == pfnReadMemory )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetDebugReadMemory", hDebug ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetDebugReadMemory( hDebug, thread, desc, size, buffer );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugReadMemory( hDebug, thread, desc, size, buffer );
@@ -328,6 +364,13 @@ namespace validation_layer
         }
 
         auto result = pfnReadMemory( hDebug, thread, desc, size, buffer );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetDebugReadMemory", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetDebugReadMemory( hDebug, thread, desc, size, buffer );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -347,17 +390,14 @@ namespace validation_layer
         if( nullptr == pfnWriteMemory )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetDebugWriteMemory", hDebug ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetDebugWriteMemory( hDebug, thread, desc, size, buffer );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugWriteMemory( hDebug, thread, desc, size, buffer );
@@ -365,6 +405,13 @@ namespace validation_layer
         }
 
         auto result = pfnWriteMemory( hDebug, thread, desc, size, buffer );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetDebugWriteMemory", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetDebugWriteMemory( hDebug, thread, desc, size, buffer );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -390,17 +437,14 @@ namespace validation_layer
         if( nullptr == pfnGetRegisterSetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetDebugGetRegisterSetProperties", hDevice ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetDebugGetRegisterSetProperties( hDevice, pCount, pRegisterSetProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugGetRegisterSetProperties( hDevice, pCount, pRegisterSetProperties );
@@ -408,6 +452,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetRegisterSetProperties( hDevice, pCount, pRegisterSetProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetDebugGetRegisterSetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetDebugGetRegisterSetProperties( hDevice, pCount, pRegisterSetProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -434,17 +485,14 @@ namespace validation_layer
         if( nullptr == pfnGetThreadRegisterSetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetDebugGetThreadRegisterSetProperties", hDebug ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetDebugGetThreadRegisterSetProperties( hDebug, thread, pCount, pRegisterSetProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugGetThreadRegisterSetProperties( hDebug, thread, pCount, pRegisterSetProperties );
@@ -452,6 +500,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetThreadRegisterSetProperties( hDebug, thread, pCount, pRegisterSetProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetDebugGetThreadRegisterSetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetDebugGetThreadRegisterSetProperties( hDebug, thread, pCount, pRegisterSetProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -476,17 +531,14 @@ namespace validation_layer
         if( nullptr == pfnReadRegisters )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetDebugReadRegisters", hDebug ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetDebugReadRegisters( hDebug, thread, type, start, count, pRegisterValues );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugReadRegisters( hDebug, thread, type, start, count, pRegisterValues );
@@ -494,6 +546,13 @@ namespace validation_layer
         }
 
         auto result = pfnReadRegisters( hDebug, thread, type, start, count, pRegisterValues );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetDebugReadRegisters", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetDebugReadRegisters( hDebug, thread, type, start, count, pRegisterValues );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -518,17 +577,14 @@ namespace validation_layer
         if( nullptr == pfnWriteRegisters )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetDebugWriteRegisters", hDebug ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetDebugWriteRegisters( hDebug, thread, type, start, count, pRegisterValues );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetDebugWriteRegisters( hDebug, thread, type, start, count, pRegisterValues );
@@ -536,6 +592,13 @@ namespace validation_layer
         }
 
         auto result = pfnWriteRegisters( hDebug, thread, type, start, count, pRegisterValues );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetDebugWriteRegisters", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetDebugWriteRegisters( hDebug, thread, type, start, count, pRegisterValues );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -560,17 +623,14 @@ namespace validation_layer
         if( nullptr == pfnGet )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricGroupGet", hDevice ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricGroupGet( hDevice, pCount, phMetricGroups );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupGet( hDevice, pCount, phMetricGroups );
@@ -579,6 +639,22 @@ namespace validation_layer
 
         auto result = pfnGet( hDevice, pCount, phMetricGroups );
 
+        if( context.enableAsyncValidation ){
+            auto phMetricGroupsCopy = AsyncValidation::copy( phMetricGroups, ( result == ZE_RESULT_SUCCESS && nullptr != phMetricGroups ) ? *pCount : 0 );
+            context.asyncValidation->submit( "zetMetricGroupGet", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricGroupGet( hDevice, pCount, phMetricGroups );
+                if( result == ZE_RESULT_SUCCESS ){
+                    for (size_t i = 0; i < phMetricGroupsCopy.size(); ++i){
+                        if (phMetricGroupsCopy[i]){
+                            context.handleLifetime->addHandle( phMetricGroupsCopy[i] );
+                            context.handleLifetime->addDependent( hDevice, phMetricGroupsCopy[i] );
+                        }
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             for (size_t i = 0; ( nullptr != phMetricGroups) && (i < *pCount); ++i){
@@ -604,17 +680,14 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricGroupGetProperties", hMetricGroup ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricGroupGetProperties( hMetricGroup, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupGetProperties( hMetricGroup, pProperties );
@@ -622,6 +695,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetProperties( hMetricGroup, pProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetMetricGroupGetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricGroupGetProperties( hMetricGroup, pProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -649,17 +729,14 @@ namespace validation_layer
         if( nullptr == pfnCalculateMetricValues )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricGroupCalculateMetricValues", hMetricGroup ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricGroupCalculateMetricValues( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupCalculateMetricValues( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues );
@@ -667,6 +744,13 @@ namespace validation_layer
         }
 
         auto result = pfnCalculateMetricValues( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetMetricGroupCalculateMetricValues", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricGroupCalculateMetricValues( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -690,17 +774,14 @@ namespace validation_layer
         if( nullptr == pfnGet )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricGet", hMetricGroup ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricGet( hMetricGroup, pCount, phMetrics );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGet( hMetricGroup, pCount, phMetrics );
@@ -709,6 +790,22 @@ namespace validation_layer
 
         auto result = pfnGet( hMetricGroup, pCount, phMetrics );
 
+        if( context.enableAsyncValidation ){
+            auto phMetricsCopy = AsyncValidation::copy( phMetrics, ( result == ZE_RESULT_SUCCESS && nullptr != phMetrics ) ? *pCount : 0 );
+            context.asyncValidation->submit( "zetMetricGet", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricGet( hMetricGroup, pCount, phMetrics );
+                if( result == ZE_RESULT_SUCCESS ){
+                    for (size_t i = 0; i < phMetricsCopy.size(); ++i){
+                        if (phMetricsCopy[i]){
+                            context.handleLifetime->addHandle( phMetricsCopy[i] );
+                            context.handleLifetime->addDependent( hMetricGroup, phMetricsCopy[i] );
+                        }
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             for (size_t i = 0; ( nullptr != phMetrics) && (i < *pCount); ++i){
@@ -734,17 +831,14 @@ namespace validation_layer
         if( nullptr == pfnGetProperties )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricGetProperties", hMetric ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricGetProperties( hMetric, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGetProperties( hMetric, pProperties );
@@ -752,6 +846,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetProperties( hMetric, pProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetMetricGetProperties", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricGetProperties( hMetric, pProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -774,17 +875,14 @@ namespace validation_layer
         if( nullptr == pfnActivateMetricGroups )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetContextActivateMetricGroups", hContext ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetContextActivateMetricGroups( hContext, hDevice, count, phMetricGroups );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetContextActivateMetricGroups( hContext, hDevice, count, phMetricGroups );
@@ -792,6 +890,14 @@ namespace validation_layer
         }
 
         auto result = pfnActivateMetricGroups( hContext, hDevice, count, phMetricGroups );
+
+        if( context.enableAsyncValidation ){
+            auto phMetricGroupsCopy = AsyncValidation::copy( phMetricGroups, count );
+            context.asyncValidation->submit( "zetContextActivateMetricGroups", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetContextActivateMetricGroups( hContext, hDevice, count, phMetricGroupsCopy.data() );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -812,24 +918,35 @@ namespace validation_layer
         if( nullptr == pfnOpen )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricStreamerOpen", hContext ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricStreamerOpen( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricStreamerOpen( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnOpen( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer );
+        auto hNotificationEventLocal = hNotificationEvent;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hNotificationEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnOpen( hContext, hDevice, hMetricGroup, desc, hNotificationEventLocal, phMetricStreamer );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetMetricStreamerOpen", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricStreamerOpen( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -847,15 +964,17 @@ namespace validation_layer
         if( nullptr == pfnAppendMetricStreamerMarker )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetCommandListAppendMetricStreamerMarker", hCommandList ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetCommandListAppendMetricStreamerMarker( hCommandList, hMetricStreamer, value );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zetCommandListAppendMetricStreamerMarker" );
         }
 
         
@@ -864,7 +983,21 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendMetricStreamerMarker( hCommandList, hMetricStreamer, value );
+        auto hCommandListLocal = hCommandList;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendMetricStreamerMarker( hCommandListLocal, hMetricStreamer, value );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetCommandListAppendMetricStreamerMarker", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetCommandListAppendMetricStreamerMarker( hCommandList, hMetricStreamer, value );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -880,17 +1013,14 @@ namespace validation_layer
         if( nullptr == pfnClose )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricStreamerClose", hMetricStreamer ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricStreamerClose( hMetricStreamer );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricStreamerClose( hMetricStreamer );
@@ -898,6 +1028,13 @@ namespace validation_layer
         }
 
         auto result = pfnClose( hMetricStreamer );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetMetricStreamerClose", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricStreamerClose( hMetricStreamer );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -924,17 +1061,14 @@ namespace validation_layer
         if( nullptr == pfnReadData )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricStreamerReadData", hMetricStreamer ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricStreamerReadData( hMetricStreamer, maxReportCount, pRawDataSize, pRawData );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricStreamerReadData( hMetricStreamer, maxReportCount, pRawDataSize, pRawData );
@@ -942,6 +1076,13 @@ namespace validation_layer
         }
 
         auto result = pfnReadData( hMetricStreamer, maxReportCount, pRawDataSize, pRawData );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetMetricStreamerReadData", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricStreamerReadData( hMetricStreamer, maxReportCount, pRawDataSize, pRawData );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -961,17 +1102,14 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricQueryPoolCreate", hContext ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricQueryPoolCreate( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricQueryPoolCreate( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool );
@@ -980,6 +1118,20 @@ namespace validation_layer
 
         auto result = pfnCreate( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool );
 
+        if( context.enableAsyncValidation ){
+            auto phMetricQueryPoolValue = ( result == ZE_RESULT_SUCCESS && phMetricQueryPool ) ? *phMetricQueryPool : nullptr;
+            context.asyncValidation->submit( "zetMetricQueryPoolCreate", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricQueryPoolCreate( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool );
+                if( result == ZE_RESULT_SUCCESS ){
+                    if (phMetricQueryPoolValue){
+                        context.handleLifetime->addHandle( phMetricQueryPoolValue );
+                        context.handleLifetime->addDependent( hContext, phMetricQueryPoolValue );
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phMetricQueryPool){
@@ -1003,24 +1155,31 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricQueryPoolDestroy", hMetricQueryPool ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricQueryPoolDestroy( hMetricQueryPool );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricQueryPoolDestroy( hMetricQueryPool );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
+        // Released handles are ordered before the driver can hand them out again.
+        bool asyncEnabled = context.enableAsyncValidation;
+        auto asyncSequence = asyncEnabled ? context.asyncValidation->reserve() : 0;
         auto result = pfnDestroy( hMetricQueryPool );
+
+        if( asyncEnabled ){
+            context.asyncValidation->submit( asyncSequence, "zetMetricQueryPoolDestroy", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricQueryPoolDestroy( hMetricQueryPool );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1038,17 +1197,14 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricQueryCreate", hMetricQueryPool ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricQueryCreate( hMetricQueryPool, index, phMetricQuery );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricQueryCreate( hMetricQueryPool, index, phMetricQuery );
@@ -1057,6 +1213,20 @@ namespace validation_layer
 
         auto result = pfnCreate( hMetricQueryPool, index, phMetricQuery );
 
+        if( context.enableAsyncValidation ){
+            auto phMetricQueryValue = ( result == ZE_RESULT_SUCCESS && phMetricQuery ) ? *phMetricQuery : nullptr;
+            context.asyncValidation->submit( "zetMetricQueryCreate", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricQueryCreate( hMetricQueryPool, index, phMetricQuery );
+                if( result == ZE_RESULT_SUCCESS ){
+                    if (phMetricQueryValue){
+                        context.handleLifetime->addHandle( phMetricQueryValue );
+                        context.handleLifetime->addDependent( hMetricQueryPool, phMetricQueryValue );
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phMetricQuery){
@@ -1080,24 +1250,31 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricQueryDestroy", hMetricQuery ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricQueryDestroy( hMetricQuery );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricQueryDestroy( hMetricQuery );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
+        // Released handles are ordered before the driver can hand them out again.
+        bool asyncEnabled = context.enableAsyncValidation;
+        auto asyncSequence = asyncEnabled ? context.asyncValidation->reserve() : 0;
         auto result = pfnDestroy( hMetricQuery );
+
+        if( asyncEnabled ){
+            context.asyncValidation->submit( asyncSequence, "zetMetricQueryDestroy", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricQueryDestroy( hMetricQuery );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1113,17 +1290,14 @@ namespace validation_layer
         if( nullptr == pfnReset )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricQueryReset", hMetricQuery ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricQueryReset( hMetricQuery );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricQueryReset( hMetricQuery );
@@ -1131,6 +1305,13 @@ namespace validation_layer
         }
 
         auto result = pfnReset( hMetricQuery );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetMetricQueryReset", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricQueryReset( hMetricQuery );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1147,15 +1328,17 @@ namespace validation_layer
         if( nullptr == pfnAppendMetricQueryBegin )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetCommandListAppendMetricQueryBegin", hCommandList ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetCommandListAppendMetricQueryBegin( hCommandList, hMetricQuery );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zetCommandListAppendMetricQueryBegin" );
         }
 
         
@@ -1164,7 +1347,21 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendMetricQueryBegin( hCommandList, hMetricQuery );
+        auto hCommandListLocal = hCommandList;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendMetricQueryBegin( hCommandListLocal, hMetricQuery );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetCommandListAppendMetricQueryBegin", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetCommandListAppendMetricQueryBegin( hCommandList, hMetricQuery );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1184,15 +1381,17 @@ namespace validation_layer
         if( nullptr == pfnAppendMetricQueryEnd )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetCommandListAppendMetricQueryEnd", hCommandList ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetCommandListAppendMetricQueryEnd( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zetCommandListAppendMetricQueryEnd" );
         }
 
         
@@ -1201,7 +1400,24 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendMetricQueryEnd( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents );
+        auto hCommandListLocal = hCommandList;
+        auto hSignalEventLocal = hSignalEvent;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+            if( !generations.translate( hSignalEventLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendMetricQueryEnd( hCommandListLocal, hMetricQuery, hSignalEventLocal, numWaitEvents, phWaitEvents );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetCommandListAppendMetricQueryEnd", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetCommandListAppendMetricQueryEnd( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1217,15 +1433,17 @@ namespace validation_layer
         if( nullptr == pfnAppendMetricMemoryBarrier )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetCommandListAppendMetricMemoryBarrier", hCommandList ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetCommandListAppendMetricMemoryBarrier( hCommandList );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
+        
+        ThreadingGuard threadingGuard( context.threadingValidation.get() );
+        if( context.enableThreadingValidation ){
+            threadingGuard.exclusive( hCommandList, "zetCommandListAppendMetricMemoryBarrier" );
         }
 
         
@@ -1234,7 +1452,21 @@ namespace validation_layer
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnAppendMetricMemoryBarrier( hCommandList );
+        auto hCommandListLocal = hCommandList;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hCommandListLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnAppendMetricMemoryBarrier( hCommandListLocal );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetCommandListAppendMetricMemoryBarrier", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetCommandListAppendMetricMemoryBarrier( hCommandList );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1259,17 +1491,14 @@ namespace validation_layer
         if( nullptr == pfnGetData )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricQueryGetData", hMetricQuery ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricQueryGetData( hMetricQuery, pRawDataSize, pRawData );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricQueryGetData( hMetricQuery, pRawDataSize, pRawData );
@@ -1277,6 +1506,13 @@ namespace validation_layer
         }
 
         auto result = pfnGetData( hMetricQuery, pRawDataSize, pRawData );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetMetricQueryGetData", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricQueryGetData( hMetricQuery, pRawDataSize, pRawData );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1293,24 +1529,35 @@ namespace validation_layer
         if( nullptr == pfnGetProfileInfo )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetKernelGetProfileInfo", hKernel ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetKernelGetProfileInfo( hKernel, pProfileProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetKernelGetProfileInfo( hKernel, pProfileProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
-        auto result = pfnGetProfileInfo( hKernel, pProfileProperties );
+        auto hKernelLocal = hKernel;
+        if( context.enableGenerationalHandles ){
+            auto &generations = *context.generationalHandles;
+            if( !generations.translate( hKernelLocal ) )
+                return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        auto result = pfnGetProfileInfo( hKernelLocal, pProfileProperties );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetKernelGetProfileInfo", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetKernelGetProfileInfo( hKernel, pProfileProperties );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1328,17 +1575,14 @@ namespace validation_layer
         if( nullptr == pfnCreate )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetTracerExpCreate", hContext ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetTracerExpCreate( hContext, desc, phTracer );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetTracerExpCreate( hContext, desc, phTracer );
@@ -1347,6 +1591,20 @@ namespace validation_layer
 
         auto result = pfnCreate( hContext, desc, phTracer );
 
+        if( context.enableAsyncValidation ){
+            auto phTracerValue = ( result == ZE_RESULT_SUCCESS && phTracer ) ? *phTracer : nullptr;
+            context.asyncValidation->submit( "zetTracerExpCreate", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetTracerExpCreate( hContext, desc, phTracer );
+                if( result == ZE_RESULT_SUCCESS ){
+                    if (phTracerValue){
+                        context.handleLifetime->addHandle( phTracerValue );
+                        context.handleLifetime->addDependent( hContext, phTracerValue );
+                    }
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
             if (phTracer){
@@ -1370,24 +1628,31 @@ namespace validation_layer
         if( nullptr == pfnDestroy )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetTracerExpDestroy", hTracer ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetTracerExpDestroy( hTracer );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetTracerExpDestroy( hTracer );
             if(result!=ZE_RESULT_SUCCESS) return result;    
         }
 
+        // Released handles are ordered before the driver can hand them out again.
+        bool asyncEnabled = context.enableAsyncValidation;
+        auto asyncSequence = asyncEnabled ? context.asyncValidation->reserve() : 0;
         auto result = pfnDestroy( hTracer );
+
+        if( asyncEnabled ){
+            context.asyncValidation->submit( asyncSequence, "zetTracerExpDestroy", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetTracerExpDestroy( hTracer );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1404,17 +1669,14 @@ namespace validation_layer
         if( nullptr == pfnSetPrologues )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetTracerExpSetPrologues", hTracer ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetTracerExpSetPrologues( hTracer, pCoreCbs );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetTracerExpSetPrologues( hTracer, pCoreCbs );
@@ -1422,6 +1684,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetPrologues( hTracer, pCoreCbs );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetTracerExpSetPrologues", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetTracerExpSetPrologues( hTracer, pCoreCbs );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1438,17 +1707,14 @@ namespace validation_layer
         if( nullptr == pfnSetEpilogues )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetTracerExpSetEpilogues", hTracer ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetTracerExpSetEpilogues( hTracer, pCoreCbs );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetTracerExpSetEpilogues( hTracer, pCoreCbs );
@@ -1456,6 +1722,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetEpilogues( hTracer, pCoreCbs );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetTracerExpSetEpilogues", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetTracerExpSetEpilogues( hTracer, pCoreCbs );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1472,17 +1745,14 @@ namespace validation_layer
         if( nullptr == pfnSetEnabled )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetTracerExpSetEnabled", hTracer ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetTracerExpSetEnabled( hTracer, enable );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetTracerExpSetEnabled( hTracer, enable );
@@ -1490,6 +1760,13 @@ namespace validation_layer
         }
 
         auto result = pfnSetEnabled( hTracer, enable );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetTracerExpSetEnabled", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetTracerExpSetEnabled( hTracer, enable );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1527,17 +1804,14 @@ namespace validation_layer
         if( nullptr == pfnCalculateMultipleMetricValuesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricGroupCalculateMultipleMetricValuesExp", hMetricGroup ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricGroupCalculateMultipleMetricValuesExp( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupCalculateMultipleMetricValuesExp( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
@@ -1545,6 +1819,13 @@ namespace validation_layer
         }
 
         auto result = pfnCalculateMultipleMetricValuesExp( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetMetricGroupCalculateMultipleMetricValuesExp", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricGroupCalculateMultipleMetricValuesExp( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1563,17 +1844,14 @@ namespace validation_layer
         if( nullptr == pfnGetGlobalTimestampsExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricGroupGetGlobalTimestampsExp", hMetricGroup ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricGroupGetGlobalTimestampsExp( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupGetGlobalTimestampsExp( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp );
@@ -1582,6 +1860,15 @@ namespace validation_layer
 
         auto result = pfnGetGlobalTimestampsExp( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp );
 
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetMetricGroupGetGlobalTimestampsExp", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricGroupGetGlobalTimestampsExp( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp );
+                if( result == ZE_RESULT_SUCCESS ){
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
         }
@@ -1608,17 +1895,14 @@ namespace validation_layer
         if( nullptr == pfnGetExportDataExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricGroupGetExportDataExp", hMetricGroup ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricGroupGetExportDataExp( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupGetExportDataExp( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData );
@@ -1627,6 +1911,15 @@ namespace validation_layer
 
         auto result = pfnGetExportDataExp( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData );
 
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetMetricGroupGetExportDataExp", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricGroupGetExportDataExp( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData );
+                if( result == ZE_RESULT_SUCCESS ){
+                }
+                return check;
+            } );
+        }
+
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
         }
@@ -1668,17 +1961,14 @@ namespace validation_layer
         if( nullptr == pfnCalculateMetricExportDataExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricGroupCalculateMetricExportDataExp", hDriver ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricGroupCalculateMetricExportDataExp( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupCalculateMetricExportDataExp( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
@@ -1686,6 +1976,13 @@ namespace validation_layer
         }
 
         auto result = pfnCalculateMetricExportDataExp( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetMetricGroupCalculateMetricExportDataExp", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricGroupCalculateMetricExportDataExp( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1710,17 +2007,14 @@ namespace validation_layer
         if( nullptr == pfnGetExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricProgrammableGetExp", hDevice ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricProgrammableGetExp( hDevice, pCount, phMetricProgrammables );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricProgrammableGetExp( hDevice, pCount, phMetricProgrammables );
@@ -1738,6 +2032,12 @@ namespace validation_layer
                 }
             }
         }
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetMetricProgrammableGetExp", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricProgrammableGetExp( hDevice, pCount, phMetricProgrammables );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1754,17 +2054,14 @@ namespace validation_layer
         if( nullptr == pfnGetPropertiesExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricProgrammableGetPropertiesExp", hMetricProgrammable ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricProgrammableGetPropertiesExp( hMetricProgrammable, pProperties );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricProgrammableGetPropertiesExp( hMetricProgrammable, pProperties );
@@ -1775,6 +2072,12 @@ namespace validation_layer
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
+        }
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetMetricProgrammableGetPropertiesExp", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricProgrammableGetPropertiesExp( hMetricProgrammable, pProperties );
+                return check;
+            } );
         }
         return result;
     }
@@ -1799,17 +2102,14 @@ namespace validation_layer
         if( nullptr == pfnGetParamInfoExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricProgrammableGetParamInfoExp", hMetricProgrammable ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricProgrammableGetParamInfoExp( hMetricProgrammable, pParameterCount, pParameterInfo );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricProgrammableGetParamInfoExp( hMetricProgrammable, pParameterCount, pParameterInfo );
@@ -1820,6 +2120,12 @@ namespace validation_layer
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
+        }
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetMetricProgrammableGetParamInfoExp", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricProgrammableGetParamInfoExp( hMetricProgrammable, pParameterCount, pParameterInfo );
+                return check;
+            } );
         }
         return result;
     }
@@ -1845,17 +2151,14 @@ namespace validation_layer
         if( nullptr == pfnGetParamValueInfoExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricProgrammableGetParamValueInfoExp", hMetricProgrammable ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricProgrammableGetParamValueInfoExp( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricProgrammableGetParamValueInfoExp( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo );
@@ -1866,6 +2169,12 @@ namespace validation_layer
 
         if( result == ZE_RESULT_SUCCESS && context.enableHandleLifetime ){
             
+        }
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetMetricProgrammableGetParamValueInfoExp", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricProgrammableGetParamValueInfoExp( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo );
+                return check;
+            } );
         }
         return result;
     }
@@ -1898,17 +2207,14 @@ namespace validation_layer
         if( nullptr == pfnCreateFromProgrammableExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricCreateFromProgrammableExp", hMetricProgrammable ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricCreateFromProgrammableExp( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricCreateFromProgrammableExp( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles );
@@ -1926,6 +2232,12 @@ namespace validation_layer
                 }
             }
         }
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetMetricCreateFromProgrammableExp", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricCreateFromProgrammableExp( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1948,17 +2260,14 @@ namespace validation_layer
         if( nullptr == pfnCreateExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricGroupCreateExp", hDevice ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricGroupCreateExp( hDevice, pName, pDescription, samplingType, phMetricGroup );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupCreateExp( hDevice, pName, pDescription, samplingType, phMetricGroup );
@@ -1975,6 +2284,12 @@ namespace validation_layer
 
             }
         }
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetMetricGroupCreateExp", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricGroupCreateExp( hDevice, pName, pDescription, samplingType, phMetricGroup );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -1998,17 +2313,14 @@ namespace validation_layer
         if( nullptr == pfnAddMetricExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricGroupAddMetricExp", hMetricGroup ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricGroupAddMetricExp( hMetricGroup, hMetric, pErrorStringSize, pErrorString );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupAddMetricExp( hMetricGroup, hMetric, pErrorStringSize, pErrorString );
@@ -2016,6 +2328,13 @@ namespace validation_layer
         }
 
         auto result = pfnAddMetricExp( hMetricGroup, hMetric, pErrorStringSize, pErrorString );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetMetricGroupAddMetricExp", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricGroupAddMetricExp( hMetricGroup, hMetric, pErrorStringSize, pErrorString );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2032,17 +2351,14 @@ namespace validation_layer
         if( nullptr == pfnRemoveMetricExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricGroupRemoveMetricExp", hMetricGroup ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricGroupRemoveMetricExp( hMetricGroup, hMetric );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupRemoveMetricExp( hMetricGroup, hMetric );
@@ -2050,6 +2366,13 @@ namespace validation_layer
         }
 
         auto result = pfnRemoveMetricExp( hMetricGroup, hMetric );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetMetricGroupRemoveMetricExp", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricGroupRemoveMetricExp( hMetricGroup, hMetric );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2065,17 +2388,14 @@ namespace validation_layer
         if( nullptr == pfnCloseExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricGroupCloseExp", hMetricGroup ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricGroupCloseExp( hMetricGroup );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupCloseExp( hMetricGroup );
@@ -2083,6 +2403,13 @@ namespace validation_layer
         }
 
         auto result = pfnCloseExp( hMetricGroup );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetMetricGroupCloseExp", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricGroupCloseExp( hMetricGroup );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2098,17 +2425,14 @@ namespace validation_layer
         if( nullptr == pfnDestroyExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricGroupDestroyExp", hMetricGroup ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricGroupDestroyExp( hMetricGroup );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricGroupDestroyExp( hMetricGroup );
@@ -2116,6 +2440,13 @@ namespace validation_layer
         }
 
         auto result = pfnDestroyExp( hMetricGroup );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetMetricGroupDestroyExp", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricGroupDestroyExp( hMetricGroup );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -2131,17 +2462,14 @@ namespace validation_layer
         if( nullptr == pfnDestroyExp )
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
-        if( context.enableParameterValidation )
+        if( context.enableParameterValidation && context.sampler.sample( "zetMetricDestroyExp", hMetric ) )
         {
             auto result = context.paramValidation->zetParamValidation.zetMetricDestroyExp( hMetric );
             if(result!=ZE_RESULT_SUCCESS) return result;
         }
 
 
-        if( context.enableThreadingValidation ){ 
-            //Unimplemented
-        }
-
+        
         
         if(context.enableHandleLifetime ){
             auto result = context.handleLifetime->zetHandleLifetime.zetMetricDestroyExp( hMetric );
@@ -2149,6 +2477,13 @@ namespace validation_layer
         }
 
         auto result = pfnDestroyExp( hMetric );
+
+        if( context.enableAsyncValidation ){
+            context.asyncValidation->submit( "zetMetricDestroyExp", [=]() mutable {
+                auto check = context.handleLifetime->zetHandleLifetime.zetMetricDestroyExp( hMetric );
+                return check;
+            } );
+        }
         return result;
     }
 
@@ -99,6 +99,11 @@ namespace ze_lib
             result = zelLoaderTracingLayerInit(this->pTracingZeDdiTable, this->pTracingZetDdiTable, this->pTracingZesDdiTable);
         }
 
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            result = zelLoaderValidationLayerInit(this->pValidationZeDdiTable, this->pValidationZetDdiTable, this->pValidationZesDdiTable);
+        }
+
         if( ZE_RESULT_SUCCESS == result && !sysmanOnly)
         {
             //Check which drivers support the ze_driver_flag_t specified
@@ -114,6 +119,23 @@ namespace ze_lib
         return result;
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    ze_result_t setValidationChecks(zel_validation_check_flags_t checks)
+    {
+#ifdef DYNAMIC_LOAD_LOADER
+        if(nullptr == context->loader)
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        typedef ze_result_t (ZE_APICALL *zelLoaderValidationLayerSetChecks_t)(zel_validation_check_flags_t checks);
+        auto setChecks = reinterpret_cast<zelLoaderValidationLayerSetChecks_t>(
+                GET_FUNCTION_PTR(context->loader, "zelLoaderValidationLayerSetChecks") );
+        if(nullptr == setChecks)
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        return setChecks(checks);
+#else
+        return zelLoaderValidationLayerSetChecks(checks);
+#endif
+    }
+
 } // namespace ze_lib
 
 extern "C" {
@@ -172,11 +194,49 @@ ze_result_t ZE_APICALL
 zelDisableTracingLayer()
 {
     if (ze_lib::context->tracingLayerEnableCounter.fetch_sub(1) <= 1) {
+        if (ze_lib::context->validationLayerEnabled) {
+            ze_lib::context->zeDdiTable.exchange(ze_lib::context->pValidationZeDdiTable);
+            ze_lib::context->zetDdiTable.exchange(ze_lib::context->pValidationZetDdiTable);
+            ze_lib::context->zesDdiTable.exchange(ze_lib::context->pValidationZesDdiTable);
+        } else {
+            ze_lib::context->zeDdiTable.exchange(&ze_lib::context->initialzeDdiTable);
+            ze_lib::context->zetDdiTable.exchange(&ze_lib::context->initialzetDdiTable);
+            ze_lib::context->zesDdiTable.exchange(&ze_lib::context->initialzesDdiTable);
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+// The validation layer tables are only set when the layer is not already in
+// every call path; otherwise only the checks are changed. The tracing layer
+// tables call into the validation layer, so while tracing is enabled at
+// runtime they stay in place, and the validation tables are restored once it
+// is disabled.
+ze_result_t ZE_APICALL
+zelEnableValidationLayer(zel_validation_check_flags_t checks)
+{
+    auto result = ze_lib::setValidationChecks(checks);
+    if (result != ZE_RESULT_SUCCESS)
+        return result;
+    if (nullptr == ze_lib::context->pValidationZeDdiTable)
+        return ZE_RESULT_SUCCESS;
+    if (!ze_lib::context->validationLayerEnabled.exchange(true) && ze_lib::context->tracingLayerEnableCounter == 0) {
+        ze_lib::context->zeDdiTable.exchange(ze_lib::context->pValidationZeDdiTable);
+        ze_lib::context->zetDdiTable.exchange(ze_lib::context->pValidationZetDdiTable);
+        ze_lib::context->zesDdiTable.exchange(ze_lib::context->pValidationZesDdiTable);
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL
+zelDisableValidationLayer()
+{
+    if (ze_lib::context->validationLayerEnabled.exchange(false) && ze_lib::context->tracingLayerEnableCounter == 0) {
         ze_lib::context->zeDdiTable.exchange(&ze_lib::context->initialzeDdiTable);
         ze_lib::context->zetDdiTable.exchange(&ze_lib::context->initialzetDdiTable);
         ze_lib::context->zesDdiTable.exchange(&ze_lib::context->initialzesDdiTable);
     }
-    return ZE_RESULT_SUCCESS;
+    return ze_lib::setValidationChecks(0);
 }
 
 } //extern "c"
\ No newline at end of file
@@ -16,6 +16,7 @@
 #include "zes_ddi.h"
 #include "layers/zel_tracing_api.h"
 #include "layers/zel_tracing_ddi.h"
+#include "loader/ze_loader.h"
 #include "ze_util.h"
 #include <vector>
 #include <mutex>
@@ -57,6 +58,10 @@ namespace ze_lib
         zet_dditable_t initialzetDdiTable;
         zes_dditable_t initialzesDdiTable;
         std::atomic_uint32_t tracingLayerEnableCounter{0};
+        std::atomic<ze_dditable_t *> pValidationZeDdiTable = {nullptr};
+        std::atomic<zet_dditable_t *> pValidationZetDdiTable = {nullptr};
+        std::atomic<zes_dditable_t *> pValidationZesDdiTable = {nullptr};
+        std::atomic<bool> validationLayerEnabled{false};
 
         HMODULE tracing_lib = nullptr;
         bool isInitialized = false;
@@ -66,4 +71,6 @@ namespace ze_lib
     extern context_t *context;
     extern bool destruction;
 
+    ze_result_t setValidationChecks(zel_validation_check_flags_t checks);
+
 } // namespace ze_lib
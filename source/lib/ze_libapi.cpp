@@ -10,6 +10,7 @@
  *
  */
 #include "ze_lib.h"
+#include "ze_probes.h"
 
 extern "C" {
 
@@ -63,7 +64,9 @@ zeInit(
                 return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
         }
 
+        ZE_PROBE_ENTRY(lib, "zeInit");
         result = pfnInit( flags );
+        ZE_PROBE_EXIT(lib, "zeInit", result);
         return result;
     });
 
@@ -126,7 +129,10 @@ zeDriverGet(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGet( pCount, phDrivers );
+    ZE_PROBE_ENTRY(lib, "zeDriverGet");
+    auto result = pfnGet( pCount, phDrivers );
+    ZE_PROBE_EXIT(lib, "zeDriverGet", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -164,7 +170,10 @@ zeDriverGetApiVersion(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetApiVersion( hDriver, version );
+    ZE_PROBE_ENTRY(lib, "zeDriverGetApiVersion");
+    auto result = pfnGetApiVersion( hDriver, version );
+    ZE_PROBE_EXIT(lib, "zeDriverGetApiVersion", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -206,7 +215,10 @@ zeDriverGetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetProperties( hDriver, pDriverProperties );
+    ZE_PROBE_ENTRY(lib, "zeDriverGetProperties");
+    auto result = pfnGetProperties( hDriver, pDriverProperties );
+    ZE_PROBE_EXIT(lib, "zeDriverGetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -244,7 +256,10 @@ zeDriverGetIpcProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetIpcProperties( hDriver, pIpcProperties );
+    ZE_PROBE_ENTRY(lib, "zeDriverGetIpcProperties");
+    auto result = pfnGetIpcProperties( hDriver, pIpcProperties );
+    ZE_PROBE_EXIT(lib, "zeDriverGetIpcProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -295,7 +310,10 @@ zeDriverGetExtensionProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetExtensionProperties( hDriver, pCount, pExtensionProperties );
+    ZE_PROBE_ENTRY(lib, "zeDriverGetExtensionProperties");
+    auto result = pfnGetExtensionProperties( hDriver, pCount, pExtensionProperties );
+    ZE_PROBE_EXIT(lib, "zeDriverGetExtensionProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -336,7 +354,10 @@ zeDriverGetExtensionFunctionAddress(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetExtensionFunctionAddress( hDriver, name, ppFunctionAddress );
+    ZE_PROBE_ENTRY(lib, "zeDriverGetExtensionFunctionAddress");
+    auto result = pfnGetExtensionFunctionAddress( hDriver, name, ppFunctionAddress );
+    ZE_PROBE_EXIT(lib, "zeDriverGetExtensionFunctionAddress", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -381,7 +402,10 @@ zeDriverGetLastErrorDescription(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetLastErrorDescription( hDriver, ppString );
+    ZE_PROBE_ENTRY(lib, "zeDriverGetLastErrorDescription");
+    auto result = pfnGetLastErrorDescription( hDriver, ppString );
+    ZE_PROBE_EXIT(lib, "zeDriverGetLastErrorDescription", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -431,7 +455,10 @@ zeDeviceGet(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGet( hDriver, pCount, phDevices );
+    ZE_PROBE_ENTRY(lib, "zeDeviceGet");
+    auto result = pfnGet( hDriver, pCount, phDevices );
+    ZE_PROBE_EXIT(lib, "zeDeviceGet", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -477,7 +504,10 @@ zeDeviceGetRootDevice(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetRootDevice( hDevice, phRootDevice );
+    ZE_PROBE_ENTRY(lib, "zeDeviceGetRootDevice");
+    auto result = pfnGetRootDevice( hDevice, phRootDevice );
+    ZE_PROBE_EXIT(lib, "zeDeviceGetRootDevice", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -532,7 +562,10 @@ zeDeviceGetSubDevices(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetSubDevices( hDevice, pCount, phSubdevices );
+    ZE_PROBE_ENTRY(lib, "zeDeviceGetSubDevices");
+    auto result = pfnGetSubDevices( hDevice, pCount, phSubdevices );
+    ZE_PROBE_EXIT(lib, "zeDeviceGetSubDevices", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -574,7 +607,10 @@ zeDeviceGetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetProperties( hDevice, pDeviceProperties );
+    ZE_PROBE_ENTRY(lib, "zeDeviceGetProperties");
+    auto result = pfnGetProperties( hDevice, pDeviceProperties );
+    ZE_PROBE_EXIT(lib, "zeDeviceGetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -616,7 +652,10 @@ zeDeviceGetComputeProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetComputeProperties( hDevice, pComputeProperties );
+    ZE_PROBE_ENTRY(lib, "zeDeviceGetComputeProperties");
+    auto result = pfnGetComputeProperties( hDevice, pComputeProperties );
+    ZE_PROBE_EXIT(lib, "zeDeviceGetComputeProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -654,7 +693,10 @@ zeDeviceGetModuleProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetModuleProperties( hDevice, pModuleProperties );
+    ZE_PROBE_ENTRY(lib, "zeDeviceGetModuleProperties");
+    auto result = pfnGetModuleProperties( hDevice, pModuleProperties );
+    ZE_PROBE_EXIT(lib, "zeDeviceGetModuleProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -712,7 +754,10 @@ zeDeviceGetCommandQueueGroupProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetCommandQueueGroupProperties( hDevice, pCount, pCommandQueueGroupProperties );
+    ZE_PROBE_ENTRY(lib, "zeDeviceGetCommandQueueGroupProperties");
+    auto result = pfnGetCommandQueueGroupProperties( hDevice, pCount, pCommandQueueGroupProperties );
+    ZE_PROBE_EXIT(lib, "zeDeviceGetCommandQueueGroupProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -769,7 +814,10 @@ zeDeviceGetMemoryProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetMemoryProperties( hDevice, pCount, pMemProperties );
+    ZE_PROBE_ENTRY(lib, "zeDeviceGetMemoryProperties");
+    auto result = pfnGetMemoryProperties( hDevice, pCount, pMemProperties );
+    ZE_PROBE_EXIT(lib, "zeDeviceGetMemoryProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -811,7 +859,10 @@ zeDeviceGetMemoryAccessProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetMemoryAccessProperties( hDevice, pMemAccessProperties );
+    ZE_PROBE_ENTRY(lib, "zeDeviceGetMemoryAccessProperties");
+    auto result = pfnGetMemoryAccessProperties( hDevice, pMemAccessProperties );
+    ZE_PROBE_EXIT(lib, "zeDeviceGetMemoryAccessProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -861,7 +912,10 @@ zeDeviceGetCacheProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetCacheProperties( hDevice, pCount, pCacheProperties );
+    ZE_PROBE_ENTRY(lib, "zeDeviceGetCacheProperties");
+    auto result = pfnGetCacheProperties( hDevice, pCount, pCacheProperties );
+    ZE_PROBE_EXIT(lib, "zeDeviceGetCacheProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -900,7 +954,10 @@ zeDeviceGetImageProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetImageProperties( hDevice, pImageProperties );
+    ZE_PROBE_ENTRY(lib, "zeDeviceGetImageProperties");
+    auto result = pfnGetImageProperties( hDevice, pImageProperties );
+    ZE_PROBE_EXIT(lib, "zeDeviceGetImageProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -938,7 +995,10 @@ zeDeviceGetExternalMemoryProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetExternalMemoryProperties( hDevice, pExternalMemoryProperties );
+    ZE_PROBE_ENTRY(lib, "zeDeviceGetExternalMemoryProperties");
+    auto result = pfnGetExternalMemoryProperties( hDevice, pExternalMemoryProperties );
+    ZE_PROBE_EXIT(lib, "zeDeviceGetExternalMemoryProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -979,7 +1039,10 @@ zeDeviceGetP2PProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetP2PProperties( hDevice, hPeerDevice, pP2PProperties );
+    ZE_PROBE_ENTRY(lib, "zeDeviceGetP2PProperties");
+    auto result = pfnGetP2PProperties( hDevice, hPeerDevice, pP2PProperties );
+    ZE_PROBE_EXIT(lib, "zeDeviceGetP2PProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1033,7 +1096,10 @@ zeDeviceCanAccessPeer(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCanAccessPeer( hDevice, hPeerDevice, value );
+    ZE_PROBE_ENTRY(lib, "zeDeviceCanAccessPeer");
+    auto result = pfnCanAccessPeer( hDevice, hPeerDevice, value );
+    ZE_PROBE_EXIT(lib, "zeDeviceCanAccessPeer", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1075,7 +1141,10 @@ zeDeviceGetStatus(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetStatus( hDevice );
+    ZE_PROBE_ENTRY(lib, "zeDeviceGetStatus");
+    auto result = pfnGetStatus( hDevice );
+    ZE_PROBE_EXIT(lib, "zeDeviceGetStatus", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1118,7 +1187,10 @@ zeDeviceGetGlobalTimestamps(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetGlobalTimestamps( hDevice, hostTimestamp, deviceTimestamp );
+    ZE_PROBE_ENTRY(lib, "zeDeviceGetGlobalTimestamps");
+    auto result = pfnGetGlobalTimestamps( hDevice, hostTimestamp, deviceTimestamp );
+    ZE_PROBE_EXIT(lib, "zeDeviceGetGlobalTimestamps", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1162,7 +1234,10 @@ zeContextCreate(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCreate( hDriver, desc, phContext );
+    ZE_PROBE_ENTRY(lib, "zeContextCreate");
+    auto result = pfnCreate( hDriver, desc, phContext );
+    ZE_PROBE_EXIT(lib, "zeContextCreate", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1218,7 +1293,10 @@ zeContextCreateEx(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCreateEx( hDriver, desc, numDevices, phDevices, phContext );
+    ZE_PROBE_ENTRY(lib, "zeContextCreateEx");
+    auto result = pfnCreateEx( hDriver, desc, numDevices, phDevices, phContext );
+    ZE_PROBE_EXIT(lib, "zeContextCreateEx", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1259,7 +1337,10 @@ zeContextDestroy(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnDestroy( hContext );
+    ZE_PROBE_ENTRY(lib, "zeContextDestroy");
+    auto result = pfnDestroy( hContext );
+    ZE_PROBE_EXIT(lib, "zeContextDestroy", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1299,7 +1380,10 @@ zeContextGetStatus(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetStatus( hContext );
+    ZE_PROBE_ENTRY(lib, "zeContextGetStatus");
+    auto result = pfnGetStatus( hContext );
+    ZE_PROBE_EXIT(lib, "zeContextGetStatus", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1353,7 +1437,10 @@ zeCommandQueueCreate(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCreate( hContext, hDevice, desc, phCommandQueue );
+    ZE_PROBE_ENTRY(lib, "zeCommandQueueCreate");
+    auto result = pfnCreate( hContext, hDevice, desc, phCommandQueue );
+    ZE_PROBE_EXIT(lib, "zeCommandQueueCreate", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1400,7 +1487,10 @@ zeCommandQueueDestroy(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnDestroy( hCommandQueue );
+    ZE_PROBE_ENTRY(lib, "zeCommandQueueDestroy");
+    auto result = pfnDestroy( hCommandQueue );
+    ZE_PROBE_EXIT(lib, "zeCommandQueueDestroy", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1464,7 +1554,10 @@ zeCommandQueueExecuteCommandLists(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnExecuteCommandLists( hCommandQueue, numCommandLists, phCommandLists, hFence );
+    ZE_PROBE_ENTRY(lib, "zeCommandQueueExecuteCommandLists");
+    auto result = pfnExecuteCommandLists( hCommandQueue, numCommandLists, phCommandLists, hFence );
+    ZE_PROBE_EXIT(lib, "zeCommandQueueExecuteCommandLists", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1508,7 +1601,10 @@ zeCommandQueueSynchronize(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSynchronize( hCommandQueue, timeout );
+    ZE_PROBE_ENTRY(lib, "zeCommandQueueSynchronize");
+    auto result = pfnSynchronize( hCommandQueue, timeout );
+    ZE_PROBE_EXIT(lib, "zeCommandQueueSynchronize", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1546,7 +1642,10 @@ zeCommandQueueGetOrdinal(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetOrdinal( hCommandQueue, pOrdinal );
+    ZE_PROBE_ENTRY(lib, "zeCommandQueueGetOrdinal");
+    auto result = pfnGetOrdinal( hCommandQueue, pOrdinal );
+    ZE_PROBE_EXIT(lib, "zeCommandQueueGetOrdinal", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1584,7 +1683,10 @@ zeCommandQueueGetIndex(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetIndex( hCommandQueue, pIndex );
+    ZE_PROBE_ENTRY(lib, "zeCommandQueueGetIndex");
+    auto result = pfnGetIndex( hCommandQueue, pIndex );
+    ZE_PROBE_EXIT(lib, "zeCommandQueueGetIndex", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1633,7 +1735,10 @@ zeCommandListCreate(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCreate( hContext, hDevice, desc, phCommandList );
+    ZE_PROBE_ENTRY(lib, "zeCommandListCreate");
+    auto result = pfnCreate( hContext, hDevice, desc, phCommandList );
+    ZE_PROBE_EXIT(lib, "zeCommandListCreate", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1690,7 +1795,10 @@ zeCommandListCreateImmediate(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCreateImmediate( hContext, hDevice, altdesc, phCommandList );
+    ZE_PROBE_ENTRY(lib, "zeCommandListCreateImmediate");
+    auto result = pfnCreateImmediate( hContext, hDevice, altdesc, phCommandList );
+    ZE_PROBE_EXIT(lib, "zeCommandListCreateImmediate", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1731,7 +1839,10 @@ zeCommandListDestroy(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnDestroy( hCommandList );
+    ZE_PROBE_ENTRY(lib, "zeCommandListDestroy");
+    auto result = pfnDestroy( hCommandList );
+    ZE_PROBE_EXIT(lib, "zeCommandListDestroy", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1767,7 +1878,10 @@ zeCommandListClose(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnClose( hCommandList );
+    ZE_PROBE_ENTRY(lib, "zeCommandListClose");
+    auto result = pfnClose( hCommandList );
+    ZE_PROBE_EXIT(lib, "zeCommandListClose", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1806,7 +1920,10 @@ zeCommandListReset(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnReset( hCommandList );
+    ZE_PROBE_ENTRY(lib, "zeCommandListReset");
+    auto result = pfnReset( hCommandList );
+    ZE_PROBE_EXIT(lib, "zeCommandListReset", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1865,7 +1982,10 @@ zeCommandListAppendWriteGlobalTimestamp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendWriteGlobalTimestamp( hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_ENTRY(lib, "zeCommandListAppendWriteGlobalTimestamp");
+    auto result = pfnAppendWriteGlobalTimestamp( hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_EXIT(lib, "zeCommandListAppendWriteGlobalTimestamp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1918,7 +2038,10 @@ zeCommandListHostSynchronize(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnHostSynchronize( hCommandList, timeout );
+    ZE_PROBE_ENTRY(lib, "zeCommandListHostSynchronize");
+    auto result = pfnHostSynchronize( hCommandList, timeout );
+    ZE_PROBE_EXIT(lib, "zeCommandListHostSynchronize", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1956,7 +2079,10 @@ zeCommandListGetDeviceHandle(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetDeviceHandle( hCommandList, phDevice );
+    ZE_PROBE_ENTRY(lib, "zeCommandListGetDeviceHandle");
+    auto result = pfnGetDeviceHandle( hCommandList, phDevice );
+    ZE_PROBE_EXIT(lib, "zeCommandListGetDeviceHandle", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1994,7 +2120,10 @@ zeCommandListGetContextHandle(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetContextHandle( hCommandList, phContext );
+    ZE_PROBE_ENTRY(lib, "zeCommandListGetContextHandle");
+    auto result = pfnGetContextHandle( hCommandList, phContext );
+    ZE_PROBE_EXIT(lib, "zeCommandListGetContextHandle", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2033,7 +2162,10 @@ zeCommandListGetOrdinal(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetOrdinal( hCommandList, pOrdinal );
+    ZE_PROBE_ENTRY(lib, "zeCommandListGetOrdinal");
+    auto result = pfnGetOrdinal( hCommandList, pOrdinal );
+    ZE_PROBE_EXIT(lib, "zeCommandListGetOrdinal", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2077,7 +2209,10 @@ zeCommandListImmediateGetIndex(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnImmediateGetIndex( hCommandListImmediate, pIndex );
+    ZE_PROBE_ENTRY(lib, "zeCommandListImmediateGetIndex");
+    auto result = pfnImmediateGetIndex( hCommandListImmediate, pIndex );
+    ZE_PROBE_EXIT(lib, "zeCommandListImmediateGetIndex", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2116,7 +2251,10 @@ zeCommandListIsImmediate(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnIsImmediate( hCommandList, pIsImmediate );
+    ZE_PROBE_ENTRY(lib, "zeCommandListIsImmediate");
+    auto result = pfnIsImmediate( hCommandList, pIsImmediate );
+    ZE_PROBE_EXIT(lib, "zeCommandListIsImmediate", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2174,7 +2312,10 @@ zeCommandListAppendBarrier(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendBarrier( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_ENTRY(lib, "zeCommandListAppendBarrier");
+    auto result = pfnAppendBarrier( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_EXIT(lib, "zeCommandListAppendBarrier", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2232,7 +2373,10 @@ zeCommandListAppendMemoryRangesBarrier(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendMemoryRangesBarrier( hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_ENTRY(lib, "zeCommandListAppendMemoryRangesBarrier");
+    auto result = pfnAppendMemoryRangesBarrier( hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_EXIT(lib, "zeCommandListAppendMemoryRangesBarrier", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2275,7 +2419,10 @@ zeContextSystemBarrier(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSystemBarrier( hContext, hDevice );
+    ZE_PROBE_ENTRY(lib, "zeContextSystemBarrier");
+    auto result = pfnSystemBarrier( hContext, hDevice );
+    ZE_PROBE_EXIT(lib, "zeContextSystemBarrier", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2341,7 +2488,10 @@ zeCommandListAppendMemoryCopy(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendMemoryCopy( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_ENTRY(lib, "zeCommandListAppendMemoryCopy");
+    auto result = pfnAppendMemoryCopy( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_EXIT(lib, "zeCommandListAppendMemoryCopy", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2411,7 +2561,10 @@ zeCommandListAppendMemoryFill(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendMemoryFill( hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_ENTRY(lib, "zeCommandListAppendMemoryFill");
+    auto result = pfnAppendMemoryFill( hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_EXIT(lib, "zeCommandListAppendMemoryFill", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2486,7 +2639,10 @@ zeCommandListAppendMemoryCopyRegion(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendMemoryCopyRegion( hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_ENTRY(lib, "zeCommandListAppendMemoryCopyRegion");
+    auto result = pfnAppendMemoryCopyRegion( hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_EXIT(lib, "zeCommandListAppendMemoryCopyRegion", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2548,7 +2704,10 @@ zeCommandListAppendMemoryCopyFromContext(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendMemoryCopyFromContext( hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_ENTRY(lib, "zeCommandListAppendMemoryCopyFromContext");
+    auto result = pfnAppendMemoryCopyFromContext( hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_EXIT(lib, "zeCommandListAppendMemoryCopyFromContext", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2606,7 +2765,10 @@ zeCommandListAppendImageCopy(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendImageCopy( hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_ENTRY(lib, "zeCommandListAppendImageCopy");
+    auto result = pfnAppendImageCopy( hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_EXIT(lib, "zeCommandListAppendImageCopy", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2666,7 +2828,10 @@ zeCommandListAppendImageCopyRegion(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendImageCopyRegion( hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_ENTRY(lib, "zeCommandListAppendImageCopyRegion");
+    auto result = pfnAppendImageCopyRegion( hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_EXIT(lib, "zeCommandListAppendImageCopyRegion", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2731,7 +2896,10 @@ zeCommandListAppendImageCopyToMemory(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendImageCopyToMemory( hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_ENTRY(lib, "zeCommandListAppendImageCopyToMemory");
+    auto result = pfnAppendImageCopyToMemory( hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_EXIT(lib, "zeCommandListAppendImageCopyToMemory", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2796,7 +2964,10 @@ zeCommandListAppendImageCopyFromMemory(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendImageCopyFromMemory( hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_ENTRY(lib, "zeCommandListAppendImageCopyFromMemory");
+    auto result = pfnAppendImageCopyFromMemory( hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_EXIT(lib, "zeCommandListAppendImageCopyFromMemory", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2857,7 +3028,10 @@ zeCommandListAppendMemoryPrefetch(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendMemoryPrefetch( hCommandList, ptr, size );
+    ZE_PROBE_ENTRY(lib, "zeCommandListAppendMemoryPrefetch");
+    auto result = pfnAppendMemoryPrefetch( hCommandList, ptr, size );
+    ZE_PROBE_EXIT(lib, "zeCommandListAppendMemoryPrefetch", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2918,7 +3092,10 @@ zeCommandListAppendMemAdvise(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendMemAdvise( hCommandList, hDevice, ptr, size, advice );
+    ZE_PROBE_ENTRY(lib, "zeCommandListAppendMemAdvise");
+    auto result = pfnAppendMemAdvise( hCommandList, hDevice, ptr, size, advice );
+    ZE_PROBE_EXIT(lib, "zeCommandListAppendMemAdvise", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2971,7 +3148,10 @@ zeEventPoolCreate(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCreate( hContext, desc, numDevices, phDevices, phEventPool );
+    ZE_PROBE_ENTRY(lib, "zeEventPoolCreate");
+    auto result = pfnCreate( hContext, desc, numDevices, phDevices, phEventPool );
+    ZE_PROBE_EXIT(lib, "zeEventPoolCreate", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3014,7 +3194,10 @@ zeEventPoolDestroy(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnDestroy( hEventPool );
+    ZE_PROBE_ENTRY(lib, "zeEventPoolDestroy");
+    auto result = pfnDestroy( hEventPool );
+    ZE_PROBE_EXIT(lib, "zeEventPoolDestroy", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3067,7 +3250,10 @@ zeEventCreate(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCreate( hEventPool, desc, phEvent );
+    ZE_PROBE_ENTRY(lib, "zeEventCreate");
+    auto result = pfnCreate( hEventPool, desc, phEvent );
+    ZE_PROBE_EXIT(lib, "zeEventCreate", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3113,7 +3299,10 @@ zeEventDestroy(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnDestroy( hEvent );
+    ZE_PROBE_ENTRY(lib, "zeEventDestroy");
+    auto result = pfnDestroy( hEvent );
+    ZE_PROBE_EXIT(lib, "zeEventDestroy", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3153,7 +3342,10 @@ zeEventPoolGetIpcHandle(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetIpcHandle( hEventPool, phIpc );
+    ZE_PROBE_ENTRY(lib, "zeEventPoolGetIpcHandle");
+    auto result = pfnGetIpcHandle( hEventPool, phIpc );
+    ZE_PROBE_EXIT(lib, "zeEventPoolGetIpcHandle", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3199,7 +3391,10 @@ zeEventPoolPutIpcHandle(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnPutIpcHandle( hContext, hIpc );
+    ZE_PROBE_ENTRY(lib, "zeEventPoolPutIpcHandle");
+    auto result = pfnPutIpcHandle( hContext, hIpc );
+    ZE_PROBE_EXIT(lib, "zeEventPoolPutIpcHandle", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3255,7 +3450,10 @@ zeEventPoolOpenIpcHandle(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnOpenIpcHandle( hContext, hIpc, phEventPool );
+    ZE_PROBE_ENTRY(lib, "zeEventPoolOpenIpcHandle");
+    auto result = pfnOpenIpcHandle( hContext, hIpc, phEventPool );
+    ZE_PROBE_EXIT(lib, "zeEventPoolOpenIpcHandle", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3292,7 +3490,10 @@ zeEventPoolCloseIpcHandle(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCloseIpcHandle( hEventPool );
+    ZE_PROBE_ENTRY(lib, "zeEventPoolCloseIpcHandle");
+    auto result = pfnCloseIpcHandle( hEventPool );
+    ZE_PROBE_EXIT(lib, "zeEventPoolCloseIpcHandle", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3345,7 +3546,10 @@ zeCommandListAppendSignalEvent(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendSignalEvent( hCommandList, hEvent );
+    ZE_PROBE_ENTRY(lib, "zeCommandListAppendSignalEvent");
+    auto result = pfnAppendSignalEvent( hCommandList, hEvent );
+    ZE_PROBE_EXIT(lib, "zeCommandListAppendSignalEvent", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3391,7 +3595,10 @@ zeCommandListAppendWaitOnEvents(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendWaitOnEvents( hCommandList, numEvents, phEvents );
+    ZE_PROBE_ENTRY(lib, "zeCommandListAppendWaitOnEvents");
+    auto result = pfnAppendWaitOnEvents( hCommandList, numEvents, phEvents );
+    ZE_PROBE_EXIT(lib, "zeCommandListAppendWaitOnEvents", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3436,7 +3643,10 @@ zeEventHostSignal(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnHostSignal( hEvent );
+    ZE_PROBE_ENTRY(lib, "zeEventHostSignal");
+    auto result = pfnHostSignal( hEvent );
+    ZE_PROBE_EXIT(lib, "zeEventHostSignal", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3485,7 +3695,10 @@ zeEventHostSynchronize(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnHostSynchronize( hEvent, timeout );
+    ZE_PROBE_ENTRY(lib, "zeEventHostSynchronize");
+    auto result = pfnHostSynchronize( hEvent, timeout );
+    ZE_PROBE_EXIT(lib, "zeEventHostSynchronize", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3528,7 +3741,10 @@ zeEventQueryStatus(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnQueryStatus( hEvent );
+    ZE_PROBE_ENTRY(lib, "zeEventQueryStatus");
+    auto result = pfnQueryStatus( hEvent );
+    ZE_PROBE_EXIT(lib, "zeEventQueryStatus", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3576,7 +3792,10 @@ zeCommandListAppendEventReset(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendEventReset( hCommandList, hEvent );
+    ZE_PROBE_ENTRY(lib, "zeCommandListAppendEventReset");
+    auto result = pfnAppendEventReset( hCommandList, hEvent );
+    ZE_PROBE_EXIT(lib, "zeCommandListAppendEventReset", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3616,7 +3835,10 @@ zeEventHostReset(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnHostReset( hEvent );
+    ZE_PROBE_ENTRY(lib, "zeEventHostReset");
+    auto result = pfnHostReset( hEvent );
+    ZE_PROBE_EXIT(lib, "zeEventHostReset", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3662,7 +3884,10 @@ zeEventQueryKernelTimestamp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnQueryKernelTimestamp( hEvent, dstptr );
+    ZE_PROBE_ENTRY(lib, "zeEventQueryKernelTimestamp");
+    auto result = pfnQueryKernelTimestamp( hEvent, dstptr );
+    ZE_PROBE_EXIT(lib, "zeEventQueryKernelTimestamp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3729,7 +3954,10 @@ zeCommandListAppendQueryKernelTimestamps(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendQueryKernelTimestamps( hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_ENTRY(lib, "zeCommandListAppendQueryKernelTimestamps");
+    auto result = pfnAppendQueryKernelTimestamps( hCommandList, numEvents, phEvents, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_EXIT(lib, "zeCommandListAppendQueryKernelTimestamps", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3767,7 +3995,10 @@ zeEventGetEventPool(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetEventPool( hEvent, phEventPool );
+    ZE_PROBE_ENTRY(lib, "zeEventGetEventPool");
+    auto result = pfnGetEventPool( hEvent, phEventPool );
+    ZE_PROBE_EXIT(lib, "zeEventGetEventPool", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3807,7 +4038,10 @@ zeEventGetSignalScope(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetSignalScope( hEvent, pSignalScope );
+    ZE_PROBE_ENTRY(lib, "zeEventGetSignalScope");
+    auto result = pfnGetSignalScope( hEvent, pSignalScope );
+    ZE_PROBE_EXIT(lib, "zeEventGetSignalScope", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3847,7 +4081,10 @@ zeEventGetWaitScope(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetWaitScope( hEvent, pWaitScope );
+    ZE_PROBE_ENTRY(lib, "zeEventGetWaitScope");
+    auto result = pfnGetWaitScope( hEvent, pWaitScope );
+    ZE_PROBE_EXIT(lib, "zeEventGetWaitScope", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3885,7 +4122,10 @@ zeEventPoolGetContextHandle(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetContextHandle( hEventPool, phContext );
+    ZE_PROBE_ENTRY(lib, "zeEventPoolGetContextHandle");
+    auto result = pfnGetContextHandle( hEventPool, phContext );
+    ZE_PROBE_EXIT(lib, "zeEventPoolGetContextHandle", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3924,7 +4164,10 @@ zeEventPoolGetFlags(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetFlags( hEventPool, pFlags );
+    ZE_PROBE_ENTRY(lib, "zeEventPoolGetFlags");
+    auto result = pfnGetFlags( hEventPool, pFlags );
+    ZE_PROBE_EXIT(lib, "zeEventPoolGetFlags", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3974,7 +4217,10 @@ zeFenceCreate(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCreate( hCommandQueue, desc, phFence );
+    ZE_PROBE_ENTRY(lib, "zeFenceCreate");
+    auto result = pfnCreate( hCommandQueue, desc, phFence );
+    ZE_PROBE_EXIT(lib, "zeFenceCreate", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4019,7 +4265,10 @@ zeFenceDestroy(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnDestroy( hFence );
+    ZE_PROBE_ENTRY(lib, "zeFenceDestroy");
+    auto result = pfnDestroy( hFence );
+    ZE_PROBE_EXIT(lib, "zeFenceDestroy", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4068,7 +4317,10 @@ zeFenceHostSynchronize(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnHostSynchronize( hFence, timeout );
+    ZE_PROBE_ENTRY(lib, "zeFenceHostSynchronize");
+    auto result = pfnHostSynchronize( hFence, timeout );
+    ZE_PROBE_EXIT(lib, "zeFenceHostSynchronize", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4110,7 +4362,10 @@ zeFenceQueryStatus(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnQueryStatus( hFence );
+    ZE_PROBE_ENTRY(lib, "zeFenceQueryStatus");
+    auto result = pfnQueryStatus( hFence );
+    ZE_PROBE_EXIT(lib, "zeFenceQueryStatus", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4149,7 +4404,10 @@ zeFenceReset(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnReset( hFence );
+    ZE_PROBE_ENTRY(lib, "zeFenceReset");
+    auto result = pfnReset( hFence );
+    ZE_PROBE_EXIT(lib, "zeFenceReset", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4192,7 +4450,10 @@ zeImageGetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetProperties( hDevice, desc, pImageProperties );
+    ZE_PROBE_ENTRY(lib, "zeImageGetProperties");
+    auto result = pfnGetProperties( hDevice, desc, pImageProperties );
+    ZE_PROBE_EXIT(lib, "zeImageGetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4244,7 +4505,10 @@ zeImageCreate(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCreate( hContext, hDevice, desc, phImage );
+    ZE_PROBE_ENTRY(lib, "zeImageCreate");
+    auto result = pfnCreate( hContext, hDevice, desc, phImage );
+    ZE_PROBE_EXIT(lib, "zeImageCreate", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4285,7 +4549,10 @@ zeImageDestroy(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnDestroy( hImage );
+    ZE_PROBE_ENTRY(lib, "zeImageDestroy");
+    auto result = pfnDestroy( hImage );
+    ZE_PROBE_EXIT(lib, "zeImageDestroy", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4355,7 +4622,10 @@ zeMemAllocShared(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAllocShared( hContext, device_desc, host_desc, size, alignment, hDevice, pptr );
+    ZE_PROBE_ENTRY(lib, "zeMemAllocShared");
+    auto result = pfnAllocShared( hContext, device_desc, host_desc, size, alignment, hDevice, pptr );
+    ZE_PROBE_EXIT(lib, "zeMemAllocShared", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4413,7 +4683,10 @@ zeMemAllocDevice(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAllocDevice( hContext, device_desc, size, alignment, hDevice, pptr );
+    ZE_PROBE_ENTRY(lib, "zeMemAllocDevice");
+    auto result = pfnAllocDevice( hContext, device_desc, size, alignment, hDevice, pptr );
+    ZE_PROBE_EXIT(lib, "zeMemAllocDevice", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4471,7 +4744,10 @@ zeMemAllocHost(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAllocHost( hContext, host_desc, size, alignment, pptr );
+    ZE_PROBE_ENTRY(lib, "zeMemAllocHost");
+    auto result = pfnAllocHost( hContext, host_desc, size, alignment, pptr );
+    ZE_PROBE_EXIT(lib, "zeMemAllocHost", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4515,7 +4791,10 @@ zeMemFree(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnFree( hContext, ptr );
+    ZE_PROBE_ENTRY(lib, "zeMemFree");
+    auto result = pfnFree( hContext, ptr );
+    ZE_PROBE_EXIT(lib, "zeMemFree", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4560,7 +4839,10 @@ zeMemGetAllocProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetAllocProperties( hContext, ptr, pMemAllocProperties, phDevice );
+    ZE_PROBE_ENTRY(lib, "zeMemGetAllocProperties");
+    auto result = pfnGetAllocProperties( hContext, ptr, pMemAllocProperties, phDevice );
+    ZE_PROBE_EXIT(lib, "zeMemGetAllocProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4599,7 +4881,10 @@ zeMemGetAddressRange(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetAddressRange( hContext, ptr, pBase, pSize );
+    ZE_PROBE_ENTRY(lib, "zeMemGetAddressRange");
+    auto result = pfnGetAddressRange( hContext, ptr, pBase, pSize );
+    ZE_PROBE_EXIT(lib, "zeMemGetAddressRange", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4644,7 +4929,10 @@ zeMemGetIpcHandle(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetIpcHandle( hContext, ptr, pIpcHandle );
+    ZE_PROBE_ENTRY(lib, "zeMemGetIpcHandle");
+    auto result = pfnGetIpcHandle( hContext, ptr, pIpcHandle );
+    ZE_PROBE_EXIT(lib, "zeMemGetIpcHandle", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4687,7 +4975,10 @@ zeMemGetIpcHandleFromFileDescriptorExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetIpcHandleFromFileDescriptorExp( hContext, handle, pIpcHandle );
+    ZE_PROBE_ENTRY(lib, "zeMemGetIpcHandleFromFileDescriptorExp");
+    auto result = pfnGetIpcHandleFromFileDescriptorExp( hContext, handle, pIpcHandle );
+    ZE_PROBE_EXIT(lib, "zeMemGetIpcHandleFromFileDescriptorExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4728,7 +5019,10 @@ zeMemGetFileDescriptorFromIpcHandleExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetFileDescriptorFromIpcHandleExp( hContext, ipcHandle, pHandle );
+    ZE_PROBE_ENTRY(lib, "zeMemGetFileDescriptorFromIpcHandleExp");
+    auto result = pfnGetFileDescriptorFromIpcHandleExp( hContext, ipcHandle, pHandle );
+    ZE_PROBE_EXIT(lib, "zeMemGetFileDescriptorFromIpcHandleExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4773,7 +5067,10 @@ zeMemPutIpcHandle(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnPutIpcHandle( hContext, handle );
+    ZE_PROBE_ENTRY(lib, "zeMemPutIpcHandle");
+    auto result = pfnPutIpcHandle( hContext, handle );
+    ZE_PROBE_EXIT(lib, "zeMemPutIpcHandle", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4825,7 +5122,10 @@ zeMemOpenIpcHandle(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnOpenIpcHandle( hContext, hDevice, handle, flags, pptr );
+    ZE_PROBE_ENTRY(lib, "zeMemOpenIpcHandle");
+    auto result = pfnOpenIpcHandle( hContext, hDevice, handle, flags, pptr );
+    ZE_PROBE_EXIT(lib, "zeMemOpenIpcHandle", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4866,7 +5166,10 @@ zeMemCloseIpcHandle(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCloseIpcHandle( hContext, ptr );
+    ZE_PROBE_ENTRY(lib, "zeMemCloseIpcHandle");
+    auto result = pfnCloseIpcHandle( hContext, ptr );
+    ZE_PROBE_EXIT(lib, "zeMemCloseIpcHandle", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4927,7 +5230,10 @@ zeMemSetAtomicAccessAttributeExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetAtomicAccessAttributeExp( hContext, hDevice, ptr, size, attr );
+    ZE_PROBE_ENTRY(lib, "zeMemSetAtomicAccessAttributeExp");
+    auto result = pfnSetAtomicAccessAttributeExp( hContext, hDevice, ptr, size, attr );
+    ZE_PROBE_EXIT(lib, "zeMemSetAtomicAccessAttributeExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4972,7 +5278,10 @@ zeMemGetAtomicAccessAttributeExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetAtomicAccessAttributeExp( hContext, hDevice, ptr, size, pAttr );
+    ZE_PROBE_ENTRY(lib, "zeMemGetAtomicAccessAttributeExp");
+    auto result = pfnGetAtomicAccessAttributeExp( hContext, hDevice, ptr, size, pAttr );
+    ZE_PROBE_EXIT(lib, "zeMemGetAtomicAccessAttributeExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5031,7 +5340,10 @@ zeModuleCreate(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCreate( hContext, hDevice, desc, phModule, phBuildLog );
+    ZE_PROBE_ENTRY(lib, "zeModuleCreate");
+    auto result = pfnCreate( hContext, hDevice, desc, phModule, phBuildLog );
+    ZE_PROBE_EXIT(lib, "zeModuleCreate", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5074,7 +5386,10 @@ zeModuleDestroy(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnDestroy( hModule );
+    ZE_PROBE_ENTRY(lib, "zeModuleDestroy");
+    auto result = pfnDestroy( hModule );
+    ZE_PROBE_EXIT(lib, "zeModuleDestroy", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5139,7 +5454,10 @@ zeModuleDynamicLink(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnDynamicLink( numModules, phModules, phLinkLog );
+    ZE_PROBE_ENTRY(lib, "zeModuleDynamicLink");
+    auto result = pfnDynamicLink( numModules, phModules, phLinkLog );
+    ZE_PROBE_EXIT(lib, "zeModuleDynamicLink", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5180,7 +5498,10 @@ zeModuleBuildLogDestroy(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnDestroy( hModuleBuildLog );
+    ZE_PROBE_ENTRY(lib, "zeModuleBuildLogDestroy");
+    auto result = pfnDestroy( hModuleBuildLog );
+    ZE_PROBE_EXIT(lib, "zeModuleBuildLogDestroy", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5221,7 +5542,10 @@ zeModuleBuildLogGetString(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetString( hModuleBuildLog, pSize, pBuildLog );
+    ZE_PROBE_ENTRY(lib, "zeModuleBuildLogGetString");
+    auto result = pfnGetString( hModuleBuildLog, pSize, pBuildLog );
+    ZE_PROBE_EXIT(lib, "zeModuleBuildLogGetString", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5268,7 +5592,10 @@ zeModuleGetNativeBinary(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetNativeBinary( hModule, pSize, pModuleNativeBinary );
+    ZE_PROBE_ENTRY(lib, "zeModuleGetNativeBinary");
+    auto result = pfnGetNativeBinary( hModule, pSize, pModuleNativeBinary );
+    ZE_PROBE_EXIT(lib, "zeModuleGetNativeBinary", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5313,7 +5640,10 @@ zeModuleGetGlobalPointer(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetGlobalPointer( hModule, pGlobalName, pSize, pptr );
+    ZE_PROBE_ENTRY(lib, "zeModuleGetGlobalPointer");
+    auto result = pfnGetGlobalPointer( hModule, pGlobalName, pSize, pptr );
+    ZE_PROBE_EXIT(lib, "zeModuleGetGlobalPointer", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5358,7 +5688,10 @@ zeModuleGetKernelNames(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetKernelNames( hModule, pCount, pNames );
+    ZE_PROBE_ENTRY(lib, "zeModuleGetKernelNames");
+    auto result = pfnGetKernelNames( hModule, pCount, pNames );
+    ZE_PROBE_EXIT(lib, "zeModuleGetKernelNames", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5396,7 +5729,10 @@ zeModuleGetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetProperties( hModule, pModuleProperties );
+    ZE_PROBE_ENTRY(lib, "zeModuleGetProperties");
+    auto result = pfnGetProperties( hModule, pModuleProperties );
+    ZE_PROBE_EXIT(lib, "zeModuleGetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5443,7 +5779,10 @@ zeKernelCreate(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCreate( hModule, desc, phKernel );
+    ZE_PROBE_ENTRY(lib, "zeKernelCreate");
+    auto result = pfnCreate( hModule, desc, phKernel );
+    ZE_PROBE_EXIT(lib, "zeKernelCreate", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5484,7 +5823,10 @@ zeKernelDestroy(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnDestroy( hKernel );
+    ZE_PROBE_ENTRY(lib, "zeKernelDestroy");
+    auto result = pfnDestroy( hKernel );
+    ZE_PROBE_EXIT(lib, "zeKernelDestroy", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5530,7 +5872,10 @@ zeModuleGetFunctionPointer(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetFunctionPointer( hModule, pFunctionName, pfnFunction );
+    ZE_PROBE_ENTRY(lib, "zeModuleGetFunctionPointer");
+    auto result = pfnGetFunctionPointer( hModule, pFunctionName, pfnFunction );
+    ZE_PROBE_EXIT(lib, "zeModuleGetFunctionPointer", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5572,7 +5917,10 @@ zeKernelSetGroupSize(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetGroupSize( hKernel, groupSizeX, groupSizeY, groupSizeZ );
+    ZE_PROBE_ENTRY(lib, "zeKernelSetGroupSize");
+    auto result = pfnSetGroupSize( hKernel, groupSizeX, groupSizeY, groupSizeZ );
+    ZE_PROBE_EXIT(lib, "zeKernelSetGroupSize", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5621,7 +5969,10 @@ zeKernelSuggestGroupSize(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSuggestGroupSize( hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ );
+    ZE_PROBE_ENTRY(lib, "zeKernelSuggestGroupSize");
+    auto result = pfnSuggestGroupSize( hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ );
+    ZE_PROBE_EXIT(lib, "zeKernelSuggestGroupSize", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5659,7 +6010,10 @@ zeKernelSuggestMaxCooperativeGroupCount(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSuggestMaxCooperativeGroupCount( hKernel, totalGroupCount );
+    ZE_PROBE_ENTRY(lib, "zeKernelSuggestMaxCooperativeGroupCount");
+    auto result = pfnSuggestMaxCooperativeGroupCount( hKernel, totalGroupCount );
+    ZE_PROBE_EXIT(lib, "zeKernelSuggestMaxCooperativeGroupCount", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5703,7 +6057,10 @@ zeKernelSetArgumentValue(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetArgumentValue( hKernel, argIndex, argSize, pArgValue );
+    ZE_PROBE_ENTRY(lib, "zeKernelSetArgumentValue");
+    auto result = pfnSetArgumentValue( hKernel, argIndex, argSize, pArgValue );
+    ZE_PROBE_EXIT(lib, "zeKernelSetArgumentValue", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5745,7 +6102,10 @@ zeKernelSetIndirectAccess(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetIndirectAccess( hKernel, flags );
+    ZE_PROBE_ENTRY(lib, "zeKernelSetIndirectAccess");
+    auto result = pfnSetIndirectAccess( hKernel, flags );
+    ZE_PROBE_EXIT(lib, "zeKernelSetIndirectAccess", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5784,7 +6144,10 @@ zeKernelGetIndirectAccess(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetIndirectAccess( hKernel, pFlags );
+    ZE_PROBE_ENTRY(lib, "zeKernelGetIndirectAccess");
+    auto result = pfnGetIndirectAccess( hKernel, pFlags );
+    ZE_PROBE_EXIT(lib, "zeKernelGetIndirectAccess", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5832,7 +6195,10 @@ zeKernelGetSourceAttributes(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetSourceAttributes( hKernel, pSize, pString );
+    ZE_PROBE_ENTRY(lib, "zeKernelGetSourceAttributes");
+    auto result = pfnGetSourceAttributes( hKernel, pSize, pString );
+    ZE_PROBE_EXIT(lib, "zeKernelGetSourceAttributes", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5875,7 +6241,10 @@ zeKernelSetCacheConfig(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetCacheConfig( hKernel, flags );
+    ZE_PROBE_ENTRY(lib, "zeKernelSetCacheConfig");
+    auto result = pfnSetCacheConfig( hKernel, flags );
+    ZE_PROBE_EXIT(lib, "zeKernelSetCacheConfig", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5913,7 +6282,10 @@ zeKernelGetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetProperties( hKernel, pKernelProperties );
+    ZE_PROBE_ENTRY(lib, "zeKernelGetProperties");
+    auto result = pfnGetProperties( hKernel, pKernelProperties );
+    ZE_PROBE_EXIT(lib, "zeKernelGetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5956,7 +6328,10 @@ zeKernelGetName(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetName( hKernel, pSize, pName );
+    ZE_PROBE_ENTRY(lib, "zeKernelGetName");
+    auto result = pfnGetName( hKernel, pSize, pName );
+    ZE_PROBE_EXIT(lib, "zeKernelGetName", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6011,7 +6386,10 @@ zeCommandListAppendLaunchKernel(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendLaunchKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_ENTRY(lib, "zeCommandListAppendLaunchKernel");
+    auto result = pfnAppendLaunchKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_EXIT(lib, "zeCommandListAppendLaunchKernel", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6070,7 +6448,10 @@ zeCommandListAppendLaunchCooperativeKernel(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendLaunchCooperativeKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_ENTRY(lib, "zeCommandListAppendLaunchCooperativeKernel");
+    auto result = pfnAppendLaunchCooperativeKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_EXIT(lib, "zeCommandListAppendLaunchCooperativeKernel", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6131,7 +6512,10 @@ zeCommandListAppendLaunchKernelIndirect(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendLaunchKernelIndirect( hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_ENTRY(lib, "zeCommandListAppendLaunchKernelIndirect");
+    auto result = pfnAppendLaunchKernelIndirect( hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_EXIT(lib, "zeCommandListAppendLaunchKernelIndirect", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6199,7 +6583,10 @@ zeCommandListAppendLaunchMultipleKernelsIndirect(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendLaunchMultipleKernelsIndirect( hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_ENTRY(lib, "zeCommandListAppendLaunchMultipleKernelsIndirect");
+    auto result = pfnAppendLaunchMultipleKernelsIndirect( hCommandList, numKernels, phKernels, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_EXIT(lib, "zeCommandListAppendLaunchMultipleKernelsIndirect", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6244,7 +6631,10 @@ zeContextMakeMemoryResident(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnMakeMemoryResident( hContext, hDevice, ptr, size );
+    ZE_PROBE_ENTRY(lib, "zeContextMakeMemoryResident");
+    auto result = pfnMakeMemoryResident( hContext, hDevice, ptr, size );
+    ZE_PROBE_EXIT(lib, "zeContextMakeMemoryResident", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6289,7 +6679,10 @@ zeContextEvictMemory(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEvictMemory( hContext, hDevice, ptr, size );
+    ZE_PROBE_ENTRY(lib, "zeContextEvictMemory");
+    auto result = pfnEvictMemory( hContext, hDevice, ptr, size );
+    ZE_PROBE_EXIT(lib, "zeContextEvictMemory", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6330,7 +6723,10 @@ zeContextMakeImageResident(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnMakeImageResident( hContext, hDevice, hImage );
+    ZE_PROBE_ENTRY(lib, "zeContextMakeImageResident");
+    auto result = pfnMakeImageResident( hContext, hDevice, hImage );
+    ZE_PROBE_EXIT(lib, "zeContextMakeImageResident", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6373,7 +6769,10 @@ zeContextEvictImage(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEvictImage( hContext, hDevice, hImage );
+    ZE_PROBE_ENTRY(lib, "zeContextEvictImage");
+    auto result = pfnEvictImage( hContext, hDevice, hImage );
+    ZE_PROBE_EXIT(lib, "zeContextEvictImage", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6420,7 +6819,10 @@ zeSamplerCreate(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCreate( hContext, hDevice, desc, phSampler );
+    ZE_PROBE_ENTRY(lib, "zeSamplerCreate");
+    auto result = pfnCreate( hContext, hDevice, desc, phSampler );
+    ZE_PROBE_EXIT(lib, "zeSamplerCreate", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6461,7 +6863,10 @@ zeSamplerDestroy(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnDestroy( hSampler );
+    ZE_PROBE_ENTRY(lib, "zeSamplerDestroy");
+    auto result = pfnDestroy( hSampler );
+    ZE_PROBE_EXIT(lib, "zeSamplerDestroy", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6513,7 +6918,10 @@ zeVirtualMemReserve(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnReserve( hContext, pStart, size, pptr );
+    ZE_PROBE_ENTRY(lib, "zeVirtualMemReserve");
+    auto result = pfnReserve( hContext, pStart, size, pptr );
+    ZE_PROBE_EXIT(lib, "zeVirtualMemReserve", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6558,7 +6966,10 @@ zeVirtualMemFree(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnFree( hContext, ptr, size );
+    ZE_PROBE_ENTRY(lib, "zeVirtualMemFree");
+    auto result = pfnFree( hContext, ptr, size );
+    ZE_PROBE_EXIT(lib, "zeVirtualMemFree", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6603,7 +7014,10 @@ zeVirtualMemQueryPageSize(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnQueryPageSize( hContext, hDevice, size, pagesize );
+    ZE_PROBE_ENTRY(lib, "zeVirtualMemQueryPageSize");
+    auto result = pfnQueryPageSize( hContext, hDevice, size, pagesize );
+    ZE_PROBE_EXIT(lib, "zeVirtualMemQueryPageSize", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6653,7 +7067,10 @@ zePhysicalMemCreate(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCreate( hContext, hDevice, desc, phPhysicalMemory );
+    ZE_PROBE_ENTRY(lib, "zePhysicalMemCreate");
+    auto result = pfnCreate( hContext, hDevice, desc, phPhysicalMemory );
+    ZE_PROBE_EXIT(lib, "zePhysicalMemCreate", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6694,7 +7111,10 @@ zePhysicalMemDestroy(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnDestroy( hContext, hPhysicalMemory );
+    ZE_PROBE_ENTRY(lib, "zePhysicalMemDestroy");
+    auto result = pfnDestroy( hContext, hPhysicalMemory );
+    ZE_PROBE_EXIT(lib, "zePhysicalMemDestroy", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6754,7 +7174,10 @@ zeVirtualMemMap(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnMap( hContext, ptr, size, hPhysicalMemory, offset, access );
+    ZE_PROBE_ENTRY(lib, "zeVirtualMemMap");
+    auto result = pfnMap( hContext, ptr, size, hPhysicalMemory, offset, access );
+    ZE_PROBE_EXIT(lib, "zeVirtualMemMap", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6801,7 +7224,10 @@ zeVirtualMemUnmap(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnUnmap( hContext, ptr, size );
+    ZE_PROBE_ENTRY(lib, "zeVirtualMemUnmap");
+    auto result = pfnUnmap( hContext, ptr, size );
+    ZE_PROBE_EXIT(lib, "zeVirtualMemUnmap", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6850,7 +7276,10 @@ zeVirtualMemSetAccessAttribute(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetAccessAttribute( hContext, ptr, size, access );
+    ZE_PROBE_ENTRY(lib, "zeVirtualMemSetAccessAttribute");
+    auto result = pfnSetAccessAttribute( hContext, ptr, size, access );
+    ZE_PROBE_EXIT(lib, "zeVirtualMemSetAccessAttribute", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6902,7 +7331,10 @@ zeVirtualMemGetAccessAttribute(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetAccessAttribute( hContext, ptr, size, access, outSize );
+    ZE_PROBE_ENTRY(lib, "zeVirtualMemGetAccessAttribute");
+    auto result = pfnGetAccessAttribute( hContext, ptr, size, access, outSize );
+    ZE_PROBE_EXIT(lib, "zeVirtualMemGetAccessAttribute", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6943,7 +7375,10 @@ zeKernelSetGlobalOffsetExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetGlobalOffsetExp( hKernel, offsetX, offsetY, offsetZ );
+    ZE_PROBE_ENTRY(lib, "zeKernelSetGlobalOffsetExp");
+    auto result = pfnSetGlobalOffsetExp( hKernel, offsetX, offsetY, offsetZ );
+    ZE_PROBE_EXIT(lib, "zeKernelSetGlobalOffsetExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6987,7 +7422,10 @@ zeDeviceReserveCacheExt(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnReserveCacheExt( hDevice, cacheLevel, cacheReservationSize );
+    ZE_PROBE_ENTRY(lib, "zeDeviceReserveCacheExt");
+    auto result = pfnReserveCacheExt( hDevice, cacheLevel, cacheReservationSize );
+    ZE_PROBE_EXIT(lib, "zeDeviceReserveCacheExt", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7029,7 +7467,10 @@ zeDeviceSetCacheAdviceExt(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetCacheAdviceExt( hDevice, ptr, regionSize, cacheRegion );
+    ZE_PROBE_ENTRY(lib, "zeDeviceSetCacheAdviceExt");
+    auto result = pfnSetCacheAdviceExt( hDevice, ptr, regionSize, cacheRegion );
+    ZE_PROBE_EXIT(lib, "zeDeviceSetCacheAdviceExt", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7088,7 +7529,10 @@ zeEventQueryTimestampsExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnQueryTimestampsExp( hEvent, hDevice, pCount, pTimestamps );
+    ZE_PROBE_ENTRY(lib, "zeEventQueryTimestampsExp");
+    auto result = pfnQueryTimestampsExp( hEvent, hDevice, pCount, pTimestamps );
+    ZE_PROBE_EXIT(lib, "zeEventQueryTimestampsExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7132,7 +7576,10 @@ zeImageGetMemoryPropertiesExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetMemoryPropertiesExp( hImage, pMemoryProperties );
+    ZE_PROBE_ENTRY(lib, "zeImageGetMemoryPropertiesExp");
+    auto result = pfnGetMemoryPropertiesExp( hImage, pMemoryProperties );
+    ZE_PROBE_EXIT(lib, "zeImageGetMemoryPropertiesExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7193,7 +7640,10 @@ zeImageViewCreateExt(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnViewCreateExt( hContext, hDevice, desc, hImage, phImageView );
+    ZE_PROBE_ENTRY(lib, "zeImageViewCreateExt");
+    auto result = pfnViewCreateExt( hContext, hDevice, desc, hImage, phImageView );
+    ZE_PROBE_EXIT(lib, "zeImageViewCreateExt", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7257,7 +7707,10 @@ zeImageViewCreateExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnViewCreateExp( hContext, hDevice, desc, hImage, phImageView );
+    ZE_PROBE_ENTRY(lib, "zeImageViewCreateExp");
+    auto result = pfnViewCreateExp( hContext, hDevice, desc, hImage, phImageView );
+    ZE_PROBE_EXIT(lib, "zeImageViewCreateExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7304,7 +7757,10 @@ zeKernelSchedulingHintExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSchedulingHintExp( hKernel, pHint );
+    ZE_PROBE_ENTRY(lib, "zeKernelSchedulingHintExp");
+    auto result = pfnSchedulingHintExp( hKernel, pHint );
+    ZE_PROBE_EXIT(lib, "zeKernelSchedulingHintExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7346,7 +7802,10 @@ zeDevicePciGetPropertiesExt(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnPciGetPropertiesExt( hDevice, pPciProperties );
+    ZE_PROBE_ENTRY(lib, "zeDevicePciGetPropertiesExt");
+    auto result = pfnPciGetPropertiesExt( hDevice, pPciProperties );
+    ZE_PROBE_EXIT(lib, "zeDevicePciGetPropertiesExt", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7425,7 +7884,10 @@ zeCommandListAppendImageCopyToMemoryExt(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendImageCopyToMemoryExt( hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_ENTRY(lib, "zeCommandListAppendImageCopyToMemoryExt");
+    auto result = pfnAppendImageCopyToMemoryExt( hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_EXIT(lib, "zeCommandListAppendImageCopyToMemoryExt", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7504,7 +7966,10 @@ zeCommandListAppendImageCopyFromMemoryExt(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendImageCopyFromMemoryExt( hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_ENTRY(lib, "zeCommandListAppendImageCopyFromMemoryExt");
+    auto result = pfnAppendImageCopyFromMemoryExt( hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_EXIT(lib, "zeCommandListAppendImageCopyFromMemoryExt", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7543,7 +8008,10 @@ zeImageGetAllocPropertiesExt(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetAllocPropertiesExt( hContext, hImage, pImageAllocProperties );
+    ZE_PROBE_ENTRY(lib, "zeImageGetAllocPropertiesExt");
+    auto result = pfnGetAllocPropertiesExt( hContext, hImage, pImageAllocProperties );
+    ZE_PROBE_EXIT(lib, "zeImageGetAllocPropertiesExt", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7591,7 +8059,10 @@ zeModuleInspectLinkageExt(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnInspectLinkageExt( pInspectDesc, numModules, phModules, phLog );
+    ZE_PROBE_ENTRY(lib, "zeModuleInspectLinkageExt");
+    auto result = pfnInspectLinkageExt( pInspectDesc, numModules, phModules, phLog );
+    ZE_PROBE_EXIT(lib, "zeModuleInspectLinkageExt", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7636,7 +8107,10 @@ zeMemFreeExt(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnFreeExt( hContext, pMemFreeDesc, ptr );
+    ZE_PROBE_ENTRY(lib, "zeMemFreeExt");
+    auto result = pfnFreeExt( hContext, pMemFreeDesc, ptr );
+    ZE_PROBE_EXIT(lib, "zeMemFreeExt", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7684,7 +8158,10 @@ zeFabricVertexGetExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetExp( hDriver, pCount, phVertices );
+    ZE_PROBE_ENTRY(lib, "zeFabricVertexGetExp");
+    auto result = pfnGetExp( hDriver, pCount, phVertices );
+    ZE_PROBE_EXIT(lib, "zeFabricVertexGetExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7734,7 +8211,10 @@ zeFabricVertexGetSubVerticesExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetSubVerticesExp( hVertex, pCount, phSubvertices );
+    ZE_PROBE_ENTRY(lib, "zeFabricVertexGetSubVerticesExp");
+    auto result = pfnGetSubVerticesExp( hVertex, pCount, phSubvertices );
+    ZE_PROBE_EXIT(lib, "zeFabricVertexGetSubVerticesExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7772,7 +8252,10 @@ zeFabricVertexGetPropertiesExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetPropertiesExp( hVertex, pVertexProperties );
+    ZE_PROBE_ENTRY(lib, "zeFabricVertexGetPropertiesExp");
+    auto result = pfnGetPropertiesExp( hVertex, pVertexProperties );
+    ZE_PROBE_EXIT(lib, "zeFabricVertexGetPropertiesExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7814,7 +8297,10 @@ zeFabricVertexGetDeviceExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetDeviceExp( hVertex, phDevice );
+    ZE_PROBE_ENTRY(lib, "zeFabricVertexGetDeviceExp");
+    auto result = pfnGetDeviceExp( hVertex, phDevice );
+    ZE_PROBE_EXIT(lib, "zeFabricVertexGetDeviceExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7854,7 +8340,10 @@ zeDeviceGetFabricVertexExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetFabricVertexExp( hDevice, phVertex );
+    ZE_PROBE_ENTRY(lib, "zeDeviceGetFabricVertexExp");
+    auto result = pfnGetFabricVertexExp( hDevice, phVertex );
+    ZE_PROBE_EXIT(lib, "zeDeviceGetFabricVertexExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7904,7 +8393,10 @@ zeFabricEdgeGetExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetExp( hVertexA, hVertexB, pCount, phEdges );
+    ZE_PROBE_ENTRY(lib, "zeFabricEdgeGetExp");
+    auto result = pfnGetExp( hVertexA, hVertexB, pCount, phEdges );
+    ZE_PROBE_EXIT(lib, "zeFabricEdgeGetExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7946,7 +8438,10 @@ zeFabricEdgeGetVerticesExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetVerticesExp( hEdge, phVertexA, phVertexB );
+    ZE_PROBE_ENTRY(lib, "zeFabricEdgeGetVerticesExp");
+    auto result = pfnGetVerticesExp( hEdge, phVertexA, phVertexB );
+    ZE_PROBE_EXIT(lib, "zeFabricEdgeGetVerticesExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -7984,7 +8479,10 @@ zeFabricEdgeGetPropertiesExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetPropertiesExp( hEdge, pEdgeProperties );
+    ZE_PROBE_ENTRY(lib, "zeFabricEdgeGetPropertiesExp");
+    auto result = pfnGetPropertiesExp( hEdge, pEdgeProperties );
+    ZE_PROBE_EXIT(lib, "zeFabricEdgeGetPropertiesExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8056,7 +8554,10 @@ zeEventQueryKernelTimestampsExt(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnQueryKernelTimestampsExt( hEvent, hDevice, pCount, pResults );
+    ZE_PROBE_ENTRY(lib, "zeEventQueryKernelTimestampsExt");
+    auto result = pfnQueryKernelTimestampsExt( hEvent, hDevice, pCount, pResults );
+    ZE_PROBE_EXIT(lib, "zeEventQueryKernelTimestampsExt", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8100,7 +8601,10 @@ zeRTASBuilderCreateExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCreateExp( hDriver, pDescriptor, phBuilder );
+    ZE_PROBE_ENTRY(lib, "zeRTASBuilderCreateExp");
+    auto result = pfnCreateExp( hDriver, pDescriptor, phBuilder );
+    ZE_PROBE_EXIT(lib, "zeRTASBuilderCreateExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8144,7 +8648,10 @@ zeRTASBuilderGetBuildPropertiesExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetBuildPropertiesExp( hBuilder, pBuildOpDescriptor, pProperties );
+    ZE_PROBE_ENTRY(lib, "zeRTASBuilderGetBuildPropertiesExp");
+    auto result = pfnGetBuildPropertiesExp( hBuilder, pBuildOpDescriptor, pProperties );
+    ZE_PROBE_EXIT(lib, "zeRTASBuilderGetBuildPropertiesExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8188,7 +8695,10 @@ zeDriverRTASFormatCompatibilityCheckExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnRTASFormatCompatibilityCheckExp( hDriver, rtasFormatA, rtasFormatB );
+    ZE_PROBE_ENTRY(lib, "zeDriverRTASFormatCompatibilityCheckExp");
+    auto result = pfnRTASFormatCompatibilityCheckExp( hDriver, rtasFormatA, rtasFormatB );
+    ZE_PROBE_EXIT(lib, "zeDriverRTASFormatCompatibilityCheckExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8292,7 +8802,10 @@ zeRTASBuilderBuildExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnBuildExp( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes );
+    ZE_PROBE_ENTRY(lib, "zeRTASBuilderBuildExp");
+    auto result = pfnBuildExp( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes );
+    ZE_PROBE_EXIT(lib, "zeRTASBuilderBuildExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8331,7 +8844,10 @@ zeRTASBuilderDestroyExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnDestroyExp( hBuilder );
+    ZE_PROBE_ENTRY(lib, "zeRTASBuilderDestroyExp");
+    auto result = pfnDestroyExp( hBuilder );
+    ZE_PROBE_EXIT(lib, "zeRTASBuilderDestroyExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8372,7 +8888,10 @@ zeRTASParallelOperationCreateExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCreateExp( hDriver, phParallelOperation );
+    ZE_PROBE_ENTRY(lib, "zeRTASParallelOperationCreateExp");
+    auto result = pfnCreateExp( hDriver, phParallelOperation );
+    ZE_PROBE_EXIT(lib, "zeRTASParallelOperationCreateExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8416,7 +8935,10 @@ zeRTASParallelOperationGetPropertiesExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetPropertiesExp( hParallelOperation, pProperties );
+    ZE_PROBE_ENTRY(lib, "zeRTASParallelOperationGetPropertiesExp");
+    auto result = pfnGetPropertiesExp( hParallelOperation, pProperties );
+    ZE_PROBE_EXIT(lib, "zeRTASParallelOperationGetPropertiesExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8451,7 +8973,10 @@ zeRTASParallelOperationJoinExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnJoinExp( hParallelOperation );
+    ZE_PROBE_ENTRY(lib, "zeRTASParallelOperationJoinExp");
+    auto result = pfnJoinExp( hParallelOperation );
+    ZE_PROBE_EXIT(lib, "zeRTASParallelOperationJoinExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8491,7 +9016,10 @@ zeRTASParallelOperationDestroyExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnDestroyExp( hParallelOperation );
+    ZE_PROBE_ENTRY(lib, "zeRTASParallelOperationDestroyExp");
+    auto result = pfnDestroyExp( hParallelOperation );
+    ZE_PROBE_EXIT(lib, "zeRTASParallelOperationDestroyExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8537,7 +9065,10 @@ zeMemGetPitchFor2dImage(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetPitchFor2dImage( hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch );
+    ZE_PROBE_ENTRY(lib, "zeMemGetPitchFor2dImage");
+    auto result = pfnGetPitchFor2dImage( hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch );
+    ZE_PROBE_EXIT(lib, "zeMemGetPitchFor2dImage", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8578,7 +9109,10 @@ zeImageGetDeviceOffsetExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetDeviceOffsetExp( hImage, pDeviceOffset );
+    ZE_PROBE_ENTRY(lib, "zeImageGetDeviceOffsetExp");
+    auto result = pfnGetDeviceOffsetExp( hImage, pDeviceOffset );
+    ZE_PROBE_EXIT(lib, "zeImageGetDeviceOffsetExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8627,7 +9161,10 @@ zeCommandListCreateCloneExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCreateCloneExp( hCommandList, phClonedCommandList );
+    ZE_PROBE_ENTRY(lib, "zeCommandListCreateCloneExp");
+    auto result = pfnCreateCloneExp( hCommandList, phClonedCommandList );
+    ZE_PROBE_EXIT(lib, "zeCommandListCreateCloneExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8680,7 +9217,10 @@ zeCommandListImmediateAppendCommandListsExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnImmediateAppendCommandListsExp( hCommandListImmediate, numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_ENTRY(lib, "zeCommandListImmediateAppendCommandListsExp");
+    auto result = pfnImmediateAppendCommandListsExp( hCommandListImmediate, numCommandLists, phCommandLists, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_EXIT(lib, "zeCommandListImmediateAppendCommandListsExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8726,7 +9266,10 @@ zeCommandListGetNextCommandIdExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetNextCommandIdExp( hCommandList, desc, pCommandId );
+    ZE_PROBE_ENTRY(lib, "zeCommandListGetNextCommandIdExp");
+    auto result = pfnGetNextCommandIdExp( hCommandList, desc, pCommandId );
+    ZE_PROBE_EXIT(lib, "zeCommandListGetNextCommandIdExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8771,7 +9314,10 @@ zeCommandListUpdateMutableCommandsExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnUpdateMutableCommandsExp( hCommandList, desc );
+    ZE_PROBE_ENTRY(lib, "zeCommandListUpdateMutableCommandsExp");
+    auto result = pfnUpdateMutableCommandsExp( hCommandList, desc );
+    ZE_PROBE_EXIT(lib, "zeCommandListUpdateMutableCommandsExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8819,7 +9365,10 @@ zeCommandListUpdateMutableCommandSignalEventExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnUpdateMutableCommandSignalEventExp( hCommandList, commandId, hSignalEvent );
+    ZE_PROBE_ENTRY(lib, "zeCommandListUpdateMutableCommandSignalEventExp");
+    auto result = pfnUpdateMutableCommandSignalEventExp( hCommandList, commandId, hSignalEvent );
+    ZE_PROBE_EXIT(lib, "zeCommandListUpdateMutableCommandSignalEventExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -8874,7 +9423,10 @@ zeCommandListUpdateMutableCommandWaitEventsExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnUpdateMutableCommandWaitEventsExp( hCommandList, commandId, numWaitEvents, phWaitEvents );
+    ZE_PROBE_ENTRY(lib, "zeCommandListUpdateMutableCommandWaitEventsExp");
+    auto result = pfnUpdateMutableCommandWaitEventsExp( hCommandList, commandId, numWaitEvents, phWaitEvents );
+    ZE_PROBE_EXIT(lib, "zeCommandListUpdateMutableCommandWaitEventsExp", result);
+    return result;
 }
 
 } // extern "C"
@@ -10,6 +10,7 @@
  *
  */
 #include "ze_lib.h"
+#include "ze_probes.h"
 
 extern "C" {
 
@@ -121,7 +122,10 @@ zesDriverGet(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGet( pCount, phDrivers );
+    ZE_PROBE_ENTRY(lib, "zesDriverGet");
+    auto result = pfnGet( pCount, phDrivers );
+    ZE_PROBE_EXIT(lib, "zesDriverGet", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -168,7 +172,10 @@ zesDriverGetExtensionProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetExtensionProperties( hDriver, pCount, pExtensionProperties );
+    ZE_PROBE_ENTRY(lib, "zesDriverGetExtensionProperties");
+    auto result = pfnGetExtensionProperties( hDriver, pCount, pExtensionProperties );
+    ZE_PROBE_EXIT(lib, "zesDriverGetExtensionProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -209,7 +216,10 @@ zesDriverGetExtensionFunctionAddress(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetExtensionFunctionAddress( hDriver, name, ppFunctionAddress );
+    ZE_PROBE_ENTRY(lib, "zesDriverGetExtensionFunctionAddress");
+    auto result = pfnGetExtensionFunctionAddress( hDriver, name, ppFunctionAddress );
+    ZE_PROBE_EXIT(lib, "zesDriverGetExtensionFunctionAddress", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -260,7 +270,10 @@ zesDeviceGet(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGet( hDriver, pCount, phDevices );
+    ZE_PROBE_ENTRY(lib, "zesDeviceGet");
+    auto result = pfnGet( hDriver, pCount, phDevices );
+    ZE_PROBE_EXIT(lib, "zesDeviceGet", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -298,7 +311,10 @@ zesDeviceGetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetProperties( hDevice, pProperties );
+    ZE_PROBE_ENTRY(lib, "zesDeviceGetProperties");
+    auto result = pfnGetProperties( hDevice, pProperties );
+    ZE_PROBE_EXIT(lib, "zesDeviceGetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -337,7 +353,10 @@ zesDeviceGetState(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetState( hDevice, pState );
+    ZE_PROBE_ENTRY(lib, "zesDeviceGetState");
+    auto result = pfnGetState( hDevice, pState );
+    ZE_PROBE_EXIT(lib, "zesDeviceGetState", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -387,7 +406,10 @@ zesDeviceReset(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnReset( hDevice, force );
+    ZE_PROBE_ENTRY(lib, "zesDeviceReset");
+    auto result = pfnReset( hDevice, force );
+    ZE_PROBE_EXIT(lib, "zesDeviceReset", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -438,7 +460,10 @@ zesDeviceResetExt(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnResetExt( hDevice, pProperties );
+    ZE_PROBE_ENTRY(lib, "zesDeviceResetExt");
+    auto result = pfnResetExt( hDevice, pProperties );
+    ZE_PROBE_EXIT(lib, "zesDeviceResetExt", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -494,7 +519,10 @@ zesDeviceProcessesGetState(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnProcessesGetState( hDevice, pCount, pProcesses );
+    ZE_PROBE_ENTRY(lib, "zesDeviceProcessesGetState");
+    auto result = pfnProcessesGetState( hDevice, pCount, pProcesses );
+    ZE_PROBE_EXIT(lib, "zesDeviceProcessesGetState", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -532,7 +560,10 @@ zesDevicePciGetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnPciGetProperties( hDevice, pProperties );
+    ZE_PROBE_ENTRY(lib, "zesDevicePciGetProperties");
+    auto result = pfnPciGetProperties( hDevice, pProperties );
+    ZE_PROBE_EXIT(lib, "zesDevicePciGetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -570,7 +601,10 @@ zesDevicePciGetState(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnPciGetState( hDevice, pState );
+    ZE_PROBE_ENTRY(lib, "zesDevicePciGetState");
+    auto result = pfnPciGetState( hDevice, pState );
+    ZE_PROBE_EXIT(lib, "zesDevicePciGetState", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -616,7 +650,10 @@ zesDevicePciGetBars(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnPciGetBars( hDevice, pCount, pProperties );
+    ZE_PROBE_ENTRY(lib, "zesDevicePciGetBars");
+    auto result = pfnPciGetBars( hDevice, pCount, pProperties );
+    ZE_PROBE_EXIT(lib, "zesDevicePciGetBars", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -656,7 +693,10 @@ zesDevicePciGetStats(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnPciGetStats( hDevice, pStats );
+    ZE_PROBE_ENTRY(lib, "zesDevicePciGetStats");
+    auto result = pfnPciGetStats( hDevice, pStats );
+    ZE_PROBE_EXIT(lib, "zesDevicePciGetStats", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -694,7 +734,10 @@ zesDeviceSetOverclockWaiver(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetOverclockWaiver( hDevice );
+    ZE_PROBE_ENTRY(lib, "zesDeviceSetOverclockWaiver");
+    auto result = pfnSetOverclockWaiver( hDevice );
+    ZE_PROBE_EXIT(lib, "zesDeviceSetOverclockWaiver", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -736,7 +779,10 @@ zesDeviceGetOverclockDomains(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetOverclockDomains( hDevice, pOverclockDomains );
+    ZE_PROBE_ENTRY(lib, "zesDeviceGetOverclockDomains");
+    auto result = pfnGetOverclockDomains( hDevice, pOverclockDomains );
+    ZE_PROBE_EXIT(lib, "zesDeviceGetOverclockDomains", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -782,7 +828,10 @@ zesDeviceGetOverclockControls(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetOverclockControls( hDevice, domainType, pAvailableControls );
+    ZE_PROBE_ENTRY(lib, "zesDeviceGetOverclockControls");
+    auto result = pfnGetOverclockControls( hDevice, domainType, pAvailableControls );
+    ZE_PROBE_EXIT(lib, "zesDeviceGetOverclockControls", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -822,7 +871,10 @@ zesDeviceResetOverclockSettings(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnResetOverclockSettings( hDevice, onShippedState );
+    ZE_PROBE_ENTRY(lib, "zesDeviceResetOverclockSettings");
+    auto result = pfnResetOverclockSettings( hDevice, onShippedState );
+    ZE_PROBE_EXIT(lib, "zesDeviceResetOverclockSettings", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -871,7 +923,10 @@ zesDeviceReadOverclockState(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnReadOverclockState( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset );
+    ZE_PROBE_ENTRY(lib, "zesDeviceReadOverclockState");
+    auto result = pfnReadOverclockState( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset );
+    ZE_PROBE_EXIT(lib, "zesDeviceReadOverclockState", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -919,7 +974,10 @@ zesDeviceEnumOverclockDomains(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEnumOverclockDomains( hDevice, pCount, phDomainHandle );
+    ZE_PROBE_ENTRY(lib, "zesDeviceEnumOverclockDomains");
+    auto result = pfnEnumOverclockDomains( hDevice, pCount, phDomainHandle );
+    ZE_PROBE_EXIT(lib, "zesDeviceEnumOverclockDomains", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -959,7 +1017,10 @@ zesOverclockGetDomainProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetDomainProperties( hDomainHandle, pDomainProperties );
+    ZE_PROBE_ENTRY(lib, "zesOverclockGetDomainProperties");
+    auto result = pfnGetDomainProperties( hDomainHandle, pDomainProperties );
+    ZE_PROBE_EXIT(lib, "zesOverclockGetDomainProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -999,7 +1060,10 @@ zesOverclockGetDomainVFProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetDomainVFProperties( hDomainHandle, pVFProperties );
+    ZE_PROBE_ENTRY(lib, "zesOverclockGetDomainVFProperties");
+    auto result = pfnGetDomainVFProperties( hDomainHandle, pVFProperties );
+    ZE_PROBE_EXIT(lib, "zesOverclockGetDomainVFProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1042,7 +1106,10 @@ zesOverclockGetDomainControlProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetDomainControlProperties( hDomainHandle, DomainControl, pControlProperties );
+    ZE_PROBE_ENTRY(lib, "zesOverclockGetDomainControlProperties");
+    auto result = pfnGetDomainControlProperties( hDomainHandle, DomainControl, pControlProperties );
+    ZE_PROBE_EXIT(lib, "zesOverclockGetDomainControlProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1085,7 +1152,10 @@ zesOverclockGetControlCurrentValue(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetControlCurrentValue( hDomainHandle, DomainControl, pValue );
+    ZE_PROBE_ENTRY(lib, "zesOverclockGetControlCurrentValue");
+    auto result = pfnGetControlCurrentValue( hDomainHandle, DomainControl, pValue );
+    ZE_PROBE_EXIT(lib, "zesOverclockGetControlCurrentValue", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1129,7 +1199,10 @@ zesOverclockGetControlPendingValue(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetControlPendingValue( hDomainHandle, DomainControl, pValue );
+    ZE_PROBE_ENTRY(lib, "zesOverclockGetControlPendingValue");
+    auto result = pfnGetControlPendingValue( hDomainHandle, DomainControl, pValue );
+    ZE_PROBE_EXIT(lib, "zesOverclockGetControlPendingValue", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1174,7 +1247,10 @@ zesOverclockSetControlUserValue(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetControlUserValue( hDomainHandle, DomainControl, pValue, pPendingAction );
+    ZE_PROBE_ENTRY(lib, "zesOverclockSetControlUserValue");
+    auto result = pfnSetControlUserValue( hDomainHandle, DomainControl, pValue, pPendingAction );
+    ZE_PROBE_EXIT(lib, "zesOverclockSetControlUserValue", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1219,7 +1295,10 @@ zesOverclockGetControlState(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetControlState( hDomainHandle, DomainControl, pControlState, pPendingAction );
+    ZE_PROBE_ENTRY(lib, "zesOverclockGetControlState");
+    auto result = pfnGetControlState( hDomainHandle, DomainControl, pControlState, pPendingAction );
+    ZE_PROBE_EXIT(lib, "zesOverclockGetControlState", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1267,7 +1346,10 @@ zesOverclockGetVFPointValues(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetVFPointValues( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue );
+    ZE_PROBE_ENTRY(lib, "zesOverclockGetVFPointValues");
+    auto result = pfnGetVFPointValues( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue );
+    ZE_PROBE_EXIT(lib, "zesOverclockGetVFPointValues", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1310,7 +1392,10 @@ zesOverclockSetVFPointValues(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetVFPointValues( hDomainHandle, VFType, PointIndex, PointValue );
+    ZE_PROBE_ENTRY(lib, "zesOverclockSetVFPointValues");
+    auto result = pfnSetVFPointValues( hDomainHandle, VFType, PointIndex, PointValue );
+    ZE_PROBE_EXIT(lib, "zesOverclockSetVFPointValues", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1358,7 +1443,10 @@ zesDeviceEnumDiagnosticTestSuites(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEnumDiagnosticTestSuites( hDevice, pCount, phDiagnostics );
+    ZE_PROBE_ENTRY(lib, "zesDeviceEnumDiagnosticTestSuites");
+    auto result = pfnEnumDiagnosticTestSuites( hDevice, pCount, phDiagnostics );
+    ZE_PROBE_EXIT(lib, "zesDeviceEnumDiagnosticTestSuites", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1397,7 +1485,10 @@ zesDiagnosticsGetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetProperties( hDiagnostics, pProperties );
+    ZE_PROBE_ENTRY(lib, "zesDiagnosticsGetProperties");
+    auto result = pfnGetProperties( hDiagnostics, pProperties );
+    ZE_PROBE_EXIT(lib, "zesDiagnosticsGetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1447,7 +1538,10 @@ zesDiagnosticsGetTests(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetTests( hDiagnostics, pCount, pTests );
+    ZE_PROBE_ENTRY(lib, "zesDiagnosticsGetTests");
+    auto result = pfnGetTests( hDiagnostics, pCount, pTests );
+    ZE_PROBE_EXIT(lib, "zesDiagnosticsGetTests", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1500,7 +1594,10 @@ zesDiagnosticsRunTests(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnRunTests( hDiagnostics, startIndex, endIndex, pResult );
+    ZE_PROBE_ENTRY(lib, "zesDiagnosticsRunTests");
+    auto result = pfnRunTests( hDiagnostics, startIndex, endIndex, pResult );
+    ZE_PROBE_EXIT(lib, "zesDiagnosticsRunTests", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1538,7 +1635,10 @@ zesDeviceEccAvailable(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEccAvailable( hDevice, pAvailable );
+    ZE_PROBE_ENTRY(lib, "zesDeviceEccAvailable");
+    auto result = pfnEccAvailable( hDevice, pAvailable );
+    ZE_PROBE_EXIT(lib, "zesDeviceEccAvailable", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1576,7 +1676,10 @@ zesDeviceEccConfigurable(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEccConfigurable( hDevice, pConfigurable );
+    ZE_PROBE_ENTRY(lib, "zesDeviceEccConfigurable");
+    auto result = pfnEccConfigurable( hDevice, pConfigurable );
+    ZE_PROBE_EXIT(lib, "zesDeviceEccConfigurable", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1614,7 +1717,10 @@ zesDeviceGetEccState(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetEccState( hDevice, pState );
+    ZE_PROBE_ENTRY(lib, "zesDeviceGetEccState");
+    auto result = pfnGetEccState( hDevice, pState );
+    ZE_PROBE_EXIT(lib, "zesDeviceGetEccState", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1660,7 +1766,10 @@ zesDeviceSetEccState(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetEccState( hDevice, newState, pState );
+    ZE_PROBE_ENTRY(lib, "zesDeviceSetEccState");
+    auto result = pfnSetEccState( hDevice, newState, pState );
+    ZE_PROBE_EXIT(lib, "zesDeviceSetEccState", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1708,7 +1817,10 @@ zesDeviceEnumEngineGroups(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEnumEngineGroups( hDevice, pCount, phEngine );
+    ZE_PROBE_ENTRY(lib, "zesDeviceEnumEngineGroups");
+    auto result = pfnEnumEngineGroups( hDevice, pCount, phEngine );
+    ZE_PROBE_EXIT(lib, "zesDeviceEnumEngineGroups", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1746,7 +1858,10 @@ zesEngineGetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetProperties( hEngine, pProperties );
+    ZE_PROBE_ENTRY(lib, "zesEngineGetProperties");
+    auto result = pfnGetProperties( hEngine, pProperties );
+    ZE_PROBE_EXIT(lib, "zesEngineGetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1787,7 +1902,10 @@ zesEngineGetActivity(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetActivity( hEngine, pStats );
+    ZE_PROBE_ENTRY(lib, "zesEngineGetActivity");
+    auto result = pfnGetActivity( hEngine, pStats );
+    ZE_PROBE_EXIT(lib, "zesEngineGetActivity", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1825,7 +1943,10 @@ zesDeviceEventRegister(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEventRegister( hDevice, events );
+    ZE_PROBE_ENTRY(lib, "zesDeviceEventRegister");
+    auto result = pfnEventRegister( hDevice, events );
+    ZE_PROBE_EXIT(lib, "zesDeviceEventRegister", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1885,7 +2006,10 @@ zesDriverEventListen(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEventListen( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
+    ZE_PROBE_ENTRY(lib, "zesDriverEventListen");
+    auto result = pfnEventListen( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
+    ZE_PROBE_EXIT(lib, "zesDriverEventListen", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1945,7 +2069,10 @@ zesDriverEventListenEx(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEventListenEx( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
+    ZE_PROBE_ENTRY(lib, "zesDriverEventListenEx");
+    auto result = pfnEventListenEx( hDriver, timeout, count, phDevices, pNumDeviceEvents, pEvents );
+    ZE_PROBE_EXIT(lib, "zesDriverEventListenEx", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1993,7 +2120,10 @@ zesDeviceEnumFabricPorts(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEnumFabricPorts( hDevice, pCount, phPort );
+    ZE_PROBE_ENTRY(lib, "zesDeviceEnumFabricPorts");
+    auto result = pfnEnumFabricPorts( hDevice, pCount, phPort );
+    ZE_PROBE_EXIT(lib, "zesDeviceEnumFabricPorts", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2031,7 +2161,10 @@ zesFabricPortGetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetProperties( hPort, pProperties );
+    ZE_PROBE_ENTRY(lib, "zesFabricPortGetProperties");
+    auto result = pfnGetProperties( hPort, pProperties );
+    ZE_PROBE_EXIT(lib, "zesFabricPortGetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2070,7 +2203,10 @@ zesFabricPortGetLinkType(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetLinkType( hPort, pLinkType );
+    ZE_PROBE_ENTRY(lib, "zesFabricPortGetLinkType");
+    auto result = pfnGetLinkType( hPort, pLinkType );
+    ZE_PROBE_EXIT(lib, "zesFabricPortGetLinkType", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2108,7 +2244,10 @@ zesFabricPortGetConfig(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetConfig( hPort, pConfig );
+    ZE_PROBE_ENTRY(lib, "zesFabricPortGetConfig");
+    auto result = pfnGetConfig( hPort, pConfig );
+    ZE_PROBE_EXIT(lib, "zesFabricPortGetConfig", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2148,7 +2287,10 @@ zesFabricPortSetConfig(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetConfig( hPort, pConfig );
+    ZE_PROBE_ENTRY(lib, "zesFabricPortSetConfig");
+    auto result = pfnSetConfig( hPort, pConfig );
+    ZE_PROBE_EXIT(lib, "zesFabricPortSetConfig", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2187,7 +2329,10 @@ zesFabricPortGetState(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetState( hPort, pState );
+    ZE_PROBE_ENTRY(lib, "zesFabricPortGetState");
+    auto result = pfnGetState( hPort, pState );
+    ZE_PROBE_EXIT(lib, "zesFabricPortGetState", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2227,7 +2372,10 @@ zesFabricPortGetThroughput(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetThroughput( hPort, pThroughput );
+    ZE_PROBE_ENTRY(lib, "zesFabricPortGetThroughput");
+    auto result = pfnGetThroughput( hPort, pThroughput );
+    ZE_PROBE_EXIT(lib, "zesFabricPortGetThroughput", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2270,7 +2418,10 @@ zesFabricPortGetFabricErrorCounters(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetFabricErrorCounters( hPort, pErrors );
+    ZE_PROBE_ENTRY(lib, "zesFabricPortGetFabricErrorCounters");
+    auto result = pfnGetFabricErrorCounters( hPort, pErrors );
+    ZE_PROBE_EXIT(lib, "zesFabricPortGetFabricErrorCounters", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2313,7 +2464,10 @@ zesFabricPortGetMultiPortThroughput(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetMultiPortThroughput( hDevice, numPorts, phPort, pThroughput );
+    ZE_PROBE_ENTRY(lib, "zesFabricPortGetMultiPortThroughput");
+    auto result = pfnGetMultiPortThroughput( hDevice, numPorts, phPort, pThroughput );
+    ZE_PROBE_EXIT(lib, "zesFabricPortGetMultiPortThroughput", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2361,7 +2515,10 @@ zesDeviceEnumFans(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEnumFans( hDevice, pCount, phFan );
+    ZE_PROBE_ENTRY(lib, "zesDeviceEnumFans");
+    auto result = pfnEnumFans( hDevice, pCount, phFan );
+    ZE_PROBE_EXIT(lib, "zesDeviceEnumFans", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2399,7 +2556,10 @@ zesFanGetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetProperties( hFan, pProperties );
+    ZE_PROBE_ENTRY(lib, "zesFanGetProperties");
+    auto result = pfnGetProperties( hFan, pProperties );
+    ZE_PROBE_EXIT(lib, "zesFanGetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2438,7 +2598,10 @@ zesFanGetConfig(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetConfig( hFan, pConfig );
+    ZE_PROBE_ENTRY(lib, "zesFanGetConfig");
+    auto result = pfnGetConfig( hFan, pConfig );
+    ZE_PROBE_EXIT(lib, "zesFanGetConfig", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2476,7 +2639,10 @@ zesFanSetDefaultMode(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetDefaultMode( hFan );
+    ZE_PROBE_ENTRY(lib, "zesFanSetDefaultMode");
+    auto result = pfnSetDefaultMode( hFan );
+    ZE_PROBE_EXIT(lib, "zesFanSetDefaultMode", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2519,7 +2685,10 @@ zesFanSetFixedSpeedMode(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetFixedSpeedMode( hFan, speed );
+    ZE_PROBE_ENTRY(lib, "zesFanSetFixedSpeedMode");
+    auto result = pfnSetFixedSpeedMode( hFan, speed );
+    ZE_PROBE_EXIT(lib, "zesFanSetFixedSpeedMode", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2564,7 +2733,10 @@ zesFanSetSpeedTableMode(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetSpeedTableMode( hFan, speedTable );
+    ZE_PROBE_ENTRY(lib, "zesFanSetSpeedTableMode");
+    auto result = pfnSetSpeedTableMode( hFan, speedTable );
+    ZE_PROBE_EXIT(lib, "zesFanSetSpeedTableMode", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2609,7 +2781,10 @@ zesFanGetState(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetState( hFan, units, pSpeed );
+    ZE_PROBE_ENTRY(lib, "zesFanGetState");
+    auto result = pfnGetState( hFan, units, pSpeed );
+    ZE_PROBE_EXIT(lib, "zesFanGetState", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2657,7 +2832,10 @@ zesDeviceEnumFirmwares(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEnumFirmwares( hDevice, pCount, phFirmware );
+    ZE_PROBE_ENTRY(lib, "zesDeviceEnumFirmwares");
+    auto result = pfnEnumFirmwares( hDevice, pCount, phFirmware );
+    ZE_PROBE_EXIT(lib, "zesDeviceEnumFirmwares", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2696,7 +2874,10 @@ zesFirmwareGetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetProperties( hFirmware, pProperties );
+    ZE_PROBE_ENTRY(lib, "zesFirmwareGetProperties");
+    auto result = pfnGetProperties( hFirmware, pProperties );
+    ZE_PROBE_EXIT(lib, "zesFirmwareGetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2741,7 +2922,10 @@ zesFirmwareFlash(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnFlash( hFirmware, pImage, size );
+    ZE_PROBE_ENTRY(lib, "zesFirmwareFlash");
+    auto result = pfnFlash( hFirmware, pImage, size );
+    ZE_PROBE_EXIT(lib, "zesFirmwareFlash", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2779,7 +2963,10 @@ zesFirmwareGetFlashProgress(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetFlashProgress( hFirmware, pCompletionPercent );
+    ZE_PROBE_ENTRY(lib, "zesFirmwareGetFlashProgress");
+    auto result = pfnGetFlashProgress( hFirmware, pCompletionPercent );
+    ZE_PROBE_EXIT(lib, "zesFirmwareGetFlashProgress", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2821,7 +3008,10 @@ zesFirmwareGetConsoleLogs(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetConsoleLogs( hFirmware, pSize, pFirmwareLog );
+    ZE_PROBE_ENTRY(lib, "zesFirmwareGetConsoleLogs");
+    auto result = pfnGetConsoleLogs( hFirmware, pSize, pFirmwareLog );
+    ZE_PROBE_EXIT(lib, "zesFirmwareGetConsoleLogs", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2869,7 +3059,10 @@ zesDeviceEnumFrequencyDomains(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEnumFrequencyDomains( hDevice, pCount, phFrequency );
+    ZE_PROBE_ENTRY(lib, "zesDeviceEnumFrequencyDomains");
+    auto result = pfnEnumFrequencyDomains( hDevice, pCount, phFrequency );
+    ZE_PROBE_EXIT(lib, "zesDeviceEnumFrequencyDomains", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2907,7 +3100,10 @@ zesFrequencyGetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetProperties( hFrequency, pProperties );
+    ZE_PROBE_ENTRY(lib, "zesFrequencyGetProperties");
+    auto result = pfnGetProperties( hFrequency, pProperties );
+    ZE_PROBE_EXIT(lib, "zesFrequencyGetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2956,7 +3152,10 @@ zesFrequencyGetAvailableClocks(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetAvailableClocks( hFrequency, pCount, phFrequency );
+    ZE_PROBE_ENTRY(lib, "zesFrequencyGetAvailableClocks");
+    auto result = pfnGetAvailableClocks( hFrequency, pCount, phFrequency );
+    ZE_PROBE_EXIT(lib, "zesFrequencyGetAvailableClocks", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2995,7 +3194,10 @@ zesFrequencyGetRange(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetRange( hFrequency, pLimits );
+    ZE_PROBE_ENTRY(lib, "zesFrequencyGetRange");
+    auto result = pfnGetRange( hFrequency, pLimits );
+    ZE_PROBE_EXIT(lib, "zesFrequencyGetRange", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3039,7 +3241,10 @@ zesFrequencySetRange(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetRange( hFrequency, pLimits );
+    ZE_PROBE_ENTRY(lib, "zesFrequencySetRange");
+    auto result = pfnSetRange( hFrequency, pLimits );
+    ZE_PROBE_EXIT(lib, "zesFrequencySetRange", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3078,7 +3283,10 @@ zesFrequencyGetState(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetState( hFrequency, pState );
+    ZE_PROBE_ENTRY(lib, "zesFrequencyGetState");
+    auto result = pfnGetState( hFrequency, pState );
+    ZE_PROBE_EXIT(lib, "zesFrequencyGetState", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3117,7 +3325,10 @@ zesFrequencyGetThrottleTime(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetThrottleTime( hFrequency, pThrottleTime );
+    ZE_PROBE_ENTRY(lib, "zesFrequencyGetThrottleTime");
+    auto result = pfnGetThrottleTime( hFrequency, pThrottleTime );
+    ZE_PROBE_EXIT(lib, "zesFrequencyGetThrottleTime", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3156,7 +3367,10 @@ zesFrequencyOcGetCapabilities(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnOcGetCapabilities( hFrequency, pOcCapabilities );
+    ZE_PROBE_ENTRY(lib, "zesFrequencyOcGetCapabilities");
+    auto result = pfnOcGetCapabilities( hFrequency, pOcCapabilities );
+    ZE_PROBE_EXIT(lib, "zesFrequencyOcGetCapabilities", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3207,7 +3421,10 @@ zesFrequencyOcGetFrequencyTarget(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnOcGetFrequencyTarget( hFrequency, pCurrentOcFrequency );
+    ZE_PROBE_ENTRY(lib, "zesFrequencyOcGetFrequencyTarget");
+    auto result = pfnOcGetFrequencyTarget( hFrequency, pCurrentOcFrequency );
+    ZE_PROBE_EXIT(lib, "zesFrequencyOcGetFrequencyTarget", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3256,7 +3473,10 @@ zesFrequencyOcSetFrequencyTarget(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnOcSetFrequencyTarget( hFrequency, CurrentOcFrequency );
+    ZE_PROBE_ENTRY(lib, "zesFrequencyOcSetFrequencyTarget");
+    auto result = pfnOcSetFrequencyTarget( hFrequency, CurrentOcFrequency );
+    ZE_PROBE_EXIT(lib, "zesFrequencyOcSetFrequencyTarget", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3309,7 +3529,10 @@ zesFrequencyOcGetVoltageTarget(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnOcGetVoltageTarget( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset );
+    ZE_PROBE_ENTRY(lib, "zesFrequencyOcGetVoltageTarget");
+    auto result = pfnOcGetVoltageTarget( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset );
+    ZE_PROBE_EXIT(lib, "zesFrequencyOcGetVoltageTarget", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3359,7 +3582,10 @@ zesFrequencyOcSetVoltageTarget(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnOcSetVoltageTarget( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset );
+    ZE_PROBE_ENTRY(lib, "zesFrequencyOcSetVoltageTarget");
+    auto result = pfnOcSetVoltageTarget( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset );
+    ZE_PROBE_EXIT(lib, "zesFrequencyOcSetVoltageTarget", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3406,7 +3632,10 @@ zesFrequencyOcSetMode(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnOcSetMode( hFrequency, CurrentOcMode );
+    ZE_PROBE_ENTRY(lib, "zesFrequencyOcSetMode");
+    auto result = pfnOcSetMode( hFrequency, CurrentOcMode );
+    ZE_PROBE_EXIT(lib, "zesFrequencyOcSetMode", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3453,7 +3682,10 @@ zesFrequencyOcGetMode(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnOcGetMode( hFrequency, pCurrentOcMode );
+    ZE_PROBE_ENTRY(lib, "zesFrequencyOcGetMode");
+    auto result = pfnOcGetMode( hFrequency, pCurrentOcMode );
+    ZE_PROBE_EXIT(lib, "zesFrequencyOcGetMode", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3496,7 +3728,10 @@ zesFrequencyOcGetIccMax(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnOcGetIccMax( hFrequency, pOcIccMax );
+    ZE_PROBE_ENTRY(lib, "zesFrequencyOcGetIccMax");
+    auto result = pfnOcGetIccMax( hFrequency, pOcIccMax );
+    ZE_PROBE_EXIT(lib, "zesFrequencyOcGetIccMax", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3543,7 +3778,10 @@ zesFrequencyOcSetIccMax(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnOcSetIccMax( hFrequency, ocIccMax );
+    ZE_PROBE_ENTRY(lib, "zesFrequencyOcSetIccMax");
+    auto result = pfnOcSetIccMax( hFrequency, ocIccMax );
+    ZE_PROBE_EXIT(lib, "zesFrequencyOcSetIccMax", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3585,7 +3823,10 @@ zesFrequencyOcGetTjMax(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnOcGetTjMax( hFrequency, pOcTjMax );
+    ZE_PROBE_ENTRY(lib, "zesFrequencyOcGetTjMax");
+    auto result = pfnOcGetTjMax( hFrequency, pOcTjMax );
+    ZE_PROBE_EXIT(lib, "zesFrequencyOcGetTjMax", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3632,7 +3873,10 @@ zesFrequencyOcSetTjMax(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnOcSetTjMax( hFrequency, ocTjMax );
+    ZE_PROBE_ENTRY(lib, "zesFrequencyOcSetTjMax");
+    auto result = pfnOcSetTjMax( hFrequency, ocTjMax );
+    ZE_PROBE_EXIT(lib, "zesFrequencyOcSetTjMax", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3680,7 +3924,10 @@ zesDeviceEnumLeds(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEnumLeds( hDevice, pCount, phLed );
+    ZE_PROBE_ENTRY(lib, "zesDeviceEnumLeds");
+    auto result = pfnEnumLeds( hDevice, pCount, phLed );
+    ZE_PROBE_EXIT(lib, "zesDeviceEnumLeds", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3718,7 +3965,10 @@ zesLedGetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetProperties( hLed, pProperties );
+    ZE_PROBE_ENTRY(lib, "zesLedGetProperties");
+    auto result = pfnGetProperties( hLed, pProperties );
+    ZE_PROBE_EXIT(lib, "zesLedGetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3756,7 +4006,10 @@ zesLedGetState(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetState( hLed, pState );
+    ZE_PROBE_ENTRY(lib, "zesLedGetState");
+    auto result = pfnGetState( hLed, pState );
+    ZE_PROBE_EXIT(lib, "zesLedGetState", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3794,7 +4047,10 @@ zesLedSetState(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetState( hLed, enable );
+    ZE_PROBE_ENTRY(lib, "zesLedSetState");
+    auto result = pfnSetState( hLed, enable );
+    ZE_PROBE_EXIT(lib, "zesLedSetState", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3836,7 +4092,10 @@ zesLedSetColor(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetColor( hLed, pColor );
+    ZE_PROBE_ENTRY(lib, "zesLedSetColor");
+    auto result = pfnSetColor( hLed, pColor );
+    ZE_PROBE_EXIT(lib, "zesLedSetColor", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3884,7 +4143,10 @@ zesDeviceEnumMemoryModules(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEnumMemoryModules( hDevice, pCount, phMemory );
+    ZE_PROBE_ENTRY(lib, "zesDeviceEnumMemoryModules");
+    auto result = pfnEnumMemoryModules( hDevice, pCount, phMemory );
+    ZE_PROBE_EXIT(lib, "zesDeviceEnumMemoryModules", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3922,7 +4184,10 @@ zesMemoryGetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetProperties( hMemory, pProperties );
+    ZE_PROBE_ENTRY(lib, "zesMemoryGetProperties");
+    auto result = pfnGetProperties( hMemory, pProperties );
+    ZE_PROBE_EXIT(lib, "zesMemoryGetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -3960,7 +4225,10 @@ zesMemoryGetState(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetState( hMemory, pState );
+    ZE_PROBE_ENTRY(lib, "zesMemoryGetState");
+    auto result = pfnGetState( hMemory, pState );
+    ZE_PROBE_EXIT(lib, "zesMemoryGetState", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4001,7 +4269,10 @@ zesMemoryGetBandwidth(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetBandwidth( hMemory, pBandwidth );
+    ZE_PROBE_ENTRY(lib, "zesMemoryGetBandwidth");
+    auto result = pfnGetBandwidth( hMemory, pBandwidth );
+    ZE_PROBE_EXIT(lib, "zesMemoryGetBandwidth", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4051,7 +4322,10 @@ zesDeviceEnumPerformanceFactorDomains(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEnumPerformanceFactorDomains( hDevice, pCount, phPerf );
+    ZE_PROBE_ENTRY(lib, "zesDeviceEnumPerformanceFactorDomains");
+    auto result = pfnEnumPerformanceFactorDomains( hDevice, pCount, phPerf );
+    ZE_PROBE_EXIT(lib, "zesDeviceEnumPerformanceFactorDomains", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4090,7 +4364,10 @@ zesPerformanceFactorGetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetProperties( hPerf, pProperties );
+    ZE_PROBE_ENTRY(lib, "zesPerformanceFactorGetProperties");
+    auto result = pfnGetProperties( hPerf, pProperties );
+    ZE_PROBE_EXIT(lib, "zesPerformanceFactorGetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4129,7 +4406,10 @@ zesPerformanceFactorGetConfig(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetConfig( hPerf, pFactor );
+    ZE_PROBE_ENTRY(lib, "zesPerformanceFactorGetConfig");
+    auto result = pfnGetConfig( hPerf, pFactor );
+    ZE_PROBE_EXIT(lib, "zesPerformanceFactorGetConfig", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4170,7 +4450,10 @@ zesPerformanceFactorSetConfig(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetConfig( hPerf, factor );
+    ZE_PROBE_ENTRY(lib, "zesPerformanceFactorSetConfig");
+    auto result = pfnSetConfig( hPerf, factor );
+    ZE_PROBE_EXIT(lib, "zesPerformanceFactorSetConfig", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4218,7 +4501,10 @@ zesDeviceEnumPowerDomains(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEnumPowerDomains( hDevice, pCount, phPower );
+    ZE_PROBE_ENTRY(lib, "zesDeviceEnumPowerDomains");
+    auto result = pfnEnumPowerDomains( hDevice, pCount, phPower );
+    ZE_PROBE_EXIT(lib, "zesDeviceEnumPowerDomains", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4259,7 +4545,10 @@ zesDeviceGetCardPowerDomain(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetCardPowerDomain( hDevice, phPower );
+    ZE_PROBE_ENTRY(lib, "zesDeviceGetCardPowerDomain");
+    auto result = pfnGetCardPowerDomain( hDevice, phPower );
+    ZE_PROBE_EXIT(lib, "zesDeviceGetCardPowerDomain", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4297,7 +4586,10 @@ zesPowerGetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetProperties( hPower, pProperties );
+    ZE_PROBE_ENTRY(lib, "zesPowerGetProperties");
+    auto result = pfnGetProperties( hPower, pProperties );
+    ZE_PROBE_EXIT(lib, "zesPowerGetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4336,7 +4628,10 @@ zesPowerGetEnergyCounter(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetEnergyCounter( hPower, pEnergy );
+    ZE_PROBE_ENTRY(lib, "zesPowerGetEnergyCounter");
+    auto result = pfnGetEnergyCounter( hPower, pEnergy );
+    ZE_PROBE_EXIT(lib, "zesPowerGetEnergyCounter", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4378,7 +4673,10 @@ zesPowerGetLimits(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetLimits( hPower, pSustained, pBurst, pPeak );
+    ZE_PROBE_ENTRY(lib, "zesPowerGetLimits");
+    auto result = pfnGetLimits( hPower, pSustained, pBurst, pPeak );
+    ZE_PROBE_EXIT(lib, "zesPowerGetLimits", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4424,7 +4722,10 @@ zesPowerSetLimits(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetLimits( hPower, pSustained, pBurst, pPeak );
+    ZE_PROBE_ENTRY(lib, "zesPowerSetLimits");
+    auto result = pfnSetLimits( hPower, pSustained, pBurst, pPeak );
+    ZE_PROBE_EXIT(lib, "zesPowerSetLimits", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4467,7 +4768,10 @@ zesPowerGetEnergyThreshold(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetEnergyThreshold( hPower, pThreshold );
+    ZE_PROBE_ENTRY(lib, "zesPowerGetEnergyThreshold");
+    auto result = pfnGetEnergyThreshold( hPower, pThreshold );
+    ZE_PROBE_EXIT(lib, "zesPowerGetEnergyThreshold", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4523,7 +4827,10 @@ zesPowerSetEnergyThreshold(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetEnergyThreshold( hPower, threshold );
+    ZE_PROBE_ENTRY(lib, "zesPowerSetEnergyThreshold");
+    auto result = pfnSetEnergyThreshold( hPower, threshold );
+    ZE_PROBE_EXIT(lib, "zesPowerSetEnergyThreshold", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4571,7 +4878,10 @@ zesDeviceEnumPsus(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEnumPsus( hDevice, pCount, phPsu );
+    ZE_PROBE_ENTRY(lib, "zesDeviceEnumPsus");
+    auto result = pfnEnumPsus( hDevice, pCount, phPsu );
+    ZE_PROBE_EXIT(lib, "zesDeviceEnumPsus", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4609,7 +4919,10 @@ zesPsuGetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetProperties( hPsu, pProperties );
+    ZE_PROBE_ENTRY(lib, "zesPsuGetProperties");
+    auto result = pfnGetProperties( hPsu, pProperties );
+    ZE_PROBE_EXIT(lib, "zesPsuGetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4647,7 +4960,10 @@ zesPsuGetState(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetState( hPsu, pState );
+    ZE_PROBE_ENTRY(lib, "zesPsuGetState");
+    auto result = pfnGetState( hPsu, pState );
+    ZE_PROBE_EXIT(lib, "zesPsuGetState", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4705,7 +5021,10 @@ zesDeviceEnumRasErrorSets(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEnumRasErrorSets( hDevice, pCount, phRas );
+    ZE_PROBE_ENTRY(lib, "zesDeviceEnumRasErrorSets");
+    auto result = pfnEnumRasErrorSets( hDevice, pCount, phRas );
+    ZE_PROBE_EXIT(lib, "zesDeviceEnumRasErrorSets", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4745,7 +5064,10 @@ zesRasGetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetProperties( hRas, pProperties );
+    ZE_PROBE_ENTRY(lib, "zesRasGetProperties");
+    auto result = pfnGetProperties( hRas, pProperties );
+    ZE_PROBE_EXIT(lib, "zesRasGetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4793,7 +5115,10 @@ zesRasGetConfig(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetConfig( hRas, pConfig );
+    ZE_PROBE_ENTRY(lib, "zesRasGetConfig");
+    auto result = pfnGetConfig( hRas, pConfig );
+    ZE_PROBE_EXIT(lib, "zesRasGetConfig", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4846,7 +5171,10 @@ zesRasSetConfig(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetConfig( hRas, pConfig );
+    ZE_PROBE_ENTRY(lib, "zesRasSetConfig");
+    auto result = pfnSetConfig( hRas, pConfig );
+    ZE_PROBE_EXIT(lib, "zesRasSetConfig", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4890,7 +5218,10 @@ zesRasGetState(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetState( hRas, clear, pState );
+    ZE_PROBE_ENTRY(lib, "zesRasGetState");
+    auto result = pfnGetState( hRas, clear, pState );
+    ZE_PROBE_EXIT(lib, "zesRasGetState", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4944,7 +5275,10 @@ zesDeviceEnumSchedulers(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEnumSchedulers( hDevice, pCount, phScheduler );
+    ZE_PROBE_ENTRY(lib, "zesDeviceEnumSchedulers");
+    auto result = pfnEnumSchedulers( hDevice, pCount, phScheduler );
+    ZE_PROBE_EXIT(lib, "zesDeviceEnumSchedulers", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4982,7 +5316,10 @@ zesSchedulerGetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetProperties( hScheduler, pProperties );
+    ZE_PROBE_ENTRY(lib, "zesSchedulerGetProperties");
+    auto result = pfnGetProperties( hScheduler, pProperties );
+    ZE_PROBE_EXIT(lib, "zesSchedulerGetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5022,7 +5359,10 @@ zesSchedulerGetCurrentMode(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetCurrentMode( hScheduler, pMode );
+    ZE_PROBE_ENTRY(lib, "zesSchedulerGetCurrentMode");
+    auto result = pfnGetCurrentMode( hScheduler, pMode );
+    ZE_PROBE_EXIT(lib, "zesSchedulerGetCurrentMode", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5064,7 +5404,10 @@ zesSchedulerGetTimeoutModeProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetTimeoutModeProperties( hScheduler, getDefaults, pConfig );
+    ZE_PROBE_ENTRY(lib, "zesSchedulerGetTimeoutModeProperties");
+    auto result = pfnGetTimeoutModeProperties( hScheduler, getDefaults, pConfig );
+    ZE_PROBE_EXIT(lib, "zesSchedulerGetTimeoutModeProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5106,7 +5449,10 @@ zesSchedulerGetTimesliceModeProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetTimesliceModeProperties( hScheduler, getDefaults, pConfig );
+    ZE_PROBE_ENTRY(lib, "zesSchedulerGetTimesliceModeProperties");
+    auto result = pfnGetTimesliceModeProperties( hScheduler, getDefaults, pConfig );
+    ZE_PROBE_EXIT(lib, "zesSchedulerGetTimesliceModeProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5156,7 +5502,10 @@ zesSchedulerSetTimeoutMode(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetTimeoutMode( hScheduler, pProperties, pNeedReload );
+    ZE_PROBE_ENTRY(lib, "zesSchedulerSetTimeoutMode");
+    auto result = pfnSetTimeoutMode( hScheduler, pProperties, pNeedReload );
+    ZE_PROBE_EXIT(lib, "zesSchedulerSetTimeoutMode", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5205,7 +5554,10 @@ zesSchedulerSetTimesliceMode(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetTimesliceMode( hScheduler, pProperties, pNeedReload );
+    ZE_PROBE_ENTRY(lib, "zesSchedulerSetTimesliceMode");
+    auto result = pfnSetTimesliceMode( hScheduler, pProperties, pNeedReload );
+    ZE_PROBE_EXIT(lib, "zesSchedulerSetTimesliceMode", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5252,7 +5604,10 @@ zesSchedulerSetExclusiveMode(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetExclusiveMode( hScheduler, pNeedReload );
+    ZE_PROBE_ENTRY(lib, "zesSchedulerSetExclusiveMode");
+    auto result = pfnSetExclusiveMode( hScheduler, pNeedReload );
+    ZE_PROBE_EXIT(lib, "zesSchedulerSetExclusiveMode", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5301,7 +5656,10 @@ zesSchedulerSetComputeUnitDebugMode(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetComputeUnitDebugMode( hScheduler, pNeedReload );
+    ZE_PROBE_ENTRY(lib, "zesSchedulerSetComputeUnitDebugMode");
+    auto result = pfnSetComputeUnitDebugMode( hScheduler, pNeedReload );
+    ZE_PROBE_EXIT(lib, "zesSchedulerSetComputeUnitDebugMode", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5349,7 +5707,10 @@ zesDeviceEnumStandbyDomains(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEnumStandbyDomains( hDevice, pCount, phStandby );
+    ZE_PROBE_ENTRY(lib, "zesDeviceEnumStandbyDomains");
+    auto result = pfnEnumStandbyDomains( hDevice, pCount, phStandby );
+    ZE_PROBE_EXIT(lib, "zesDeviceEnumStandbyDomains", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5387,7 +5748,10 @@ zesStandbyGetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetProperties( hStandby, pProperties );
+    ZE_PROBE_ENTRY(lib, "zesStandbyGetProperties");
+    auto result = pfnGetProperties( hStandby, pProperties );
+    ZE_PROBE_EXIT(lib, "zesStandbyGetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5425,7 +5789,10 @@ zesStandbyGetMode(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetMode( hStandby, pMode );
+    ZE_PROBE_ENTRY(lib, "zesStandbyGetMode");
+    auto result = pfnGetMode( hStandby, pMode );
+    ZE_PROBE_EXIT(lib, "zesStandbyGetMode", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5465,7 +5832,10 @@ zesStandbySetMode(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetMode( hStandby, mode );
+    ZE_PROBE_ENTRY(lib, "zesStandbySetMode");
+    auto result = pfnSetMode( hStandby, mode );
+    ZE_PROBE_EXIT(lib, "zesStandbySetMode", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5513,7 +5883,10 @@ zesDeviceEnumTemperatureSensors(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEnumTemperatureSensors( hDevice, pCount, phTemperature );
+    ZE_PROBE_ENTRY(lib, "zesDeviceEnumTemperatureSensors");
+    auto result = pfnEnumTemperatureSensors( hDevice, pCount, phTemperature );
+    ZE_PROBE_EXIT(lib, "zesDeviceEnumTemperatureSensors", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5551,7 +5924,10 @@ zesTemperatureGetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetProperties( hTemperature, pProperties );
+    ZE_PROBE_ENTRY(lib, "zesTemperatureGetProperties");
+    auto result = pfnGetProperties( hTemperature, pProperties );
+    ZE_PROBE_EXIT(lib, "zesTemperatureGetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5595,7 +5971,10 @@ zesTemperatureGetConfig(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetConfig( hTemperature, pConfig );
+    ZE_PROBE_ENTRY(lib, "zesTemperatureGetConfig");
+    auto result = pfnGetConfig( hTemperature, pConfig );
+    ZE_PROBE_EXIT(lib, "zesTemperatureGetConfig", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5656,7 +6035,10 @@ zesTemperatureSetConfig(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetConfig( hTemperature, pConfig );
+    ZE_PROBE_ENTRY(lib, "zesTemperatureSetConfig");
+    auto result = pfnSetConfig( hTemperature, pConfig );
+    ZE_PROBE_EXIT(lib, "zesTemperatureSetConfig", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5695,7 +6077,10 @@ zesTemperatureGetState(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetState( hTemperature, pTemperature );
+    ZE_PROBE_ENTRY(lib, "zesTemperatureGetState");
+    auto result = pfnGetState( hTemperature, pTemperature );
+    ZE_PROBE_EXIT(lib, "zesTemperatureGetState", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5743,7 +6128,10 @@ zesPowerGetLimitsExt(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetLimitsExt( hPower, pCount, pSustained );
+    ZE_PROBE_ENTRY(lib, "zesPowerGetLimitsExt");
+    auto result = pfnGetLimitsExt( hPower, pCount, pSustained );
+    ZE_PROBE_EXIT(lib, "zesPowerGetLimitsExt", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5794,7 +6182,10 @@ zesPowerSetLimitsExt(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetLimitsExt( hPower, pCount, pSustained );
+    ZE_PROBE_ENTRY(lib, "zesPowerSetLimitsExt");
+    auto result = pfnSetLimitsExt( hPower, pCount, pSustained );
+    ZE_PROBE_EXIT(lib, "zesPowerSetLimitsExt", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5847,7 +6238,10 @@ zesEngineGetActivityExt(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetActivityExt( hEngine, pCount, pStats );
+    ZE_PROBE_ENTRY(lib, "zesEngineGetActivityExt");
+    auto result = pfnGetActivityExt( hEngine, pCount, pStats );
+    ZE_PROBE_EXIT(lib, "zesEngineGetActivityExt", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5895,7 +6289,10 @@ zesRasGetStateExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetStateExp( hRas, pCount, pState );
+    ZE_PROBE_ENTRY(lib, "zesRasGetStateExp");
+    auto result = pfnGetStateExp( hRas, pCount, pState );
+    ZE_PROBE_EXIT(lib, "zesRasGetStateExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5940,7 +6337,10 @@ zesRasClearStateExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnClearStateExp( hRas, category );
+    ZE_PROBE_ENTRY(lib, "zesRasClearStateExp");
+    auto result = pfnClearStateExp( hRas, category );
+    ZE_PROBE_EXIT(lib, "zesRasClearStateExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -5983,7 +6383,10 @@ zesFirmwareGetSecurityVersionExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetSecurityVersionExp( hFirmware, pVersion );
+    ZE_PROBE_ENTRY(lib, "zesFirmwareGetSecurityVersionExp");
+    auto result = pfnGetSecurityVersionExp( hFirmware, pVersion );
+    ZE_PROBE_EXIT(lib, "zesFirmwareGetSecurityVersionExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6018,7 +6421,10 @@ zesFirmwareSetSecurityVersionExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetSecurityVersionExp( hFirmware );
+    ZE_PROBE_ENTRY(lib, "zesFirmwareSetSecurityVersionExp");
+    auto result = pfnSetSecurityVersionExp( hFirmware );
+    ZE_PROBE_EXIT(lib, "zesFirmwareSetSecurityVersionExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6064,7 +6470,10 @@ zesDeviceGetSubDevicePropertiesExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetSubDevicePropertiesExp( hDevice, pCount, pSubdeviceProps );
+    ZE_PROBE_ENTRY(lib, "zesDeviceGetSubDevicePropertiesExp");
+    auto result = pfnGetSubDevicePropertiesExp( hDevice, pCount, pSubdeviceProps );
+    ZE_PROBE_EXIT(lib, "zesDeviceGetSubDevicePropertiesExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6109,7 +6518,10 @@ zesDriverGetDeviceByUuidExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetDeviceByUuidExp( hDriver, uuid, phDevice, onSubdevice, subdeviceId );
+    ZE_PROBE_ENTRY(lib, "zesDriverGetDeviceByUuidExp");
+    auto result = pfnGetDeviceByUuidExp( hDriver, uuid, phDevice, onSubdevice, subdeviceId );
+    ZE_PROBE_EXIT(lib, "zesDriverGetDeviceByUuidExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6157,7 +6569,10 @@ zesDeviceEnumActiveVFExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnEnumActiveVFExp( hDevice, pCount, phVFhandle );
+    ZE_PROBE_ENTRY(lib, "zesDeviceEnumActiveVFExp");
+    auto result = pfnEnumActiveVFExp( hDevice, pCount, phVFhandle );
+    ZE_PROBE_EXIT(lib, "zesDeviceEnumActiveVFExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6195,7 +6610,10 @@ zesVFManagementGetVFPropertiesExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetVFPropertiesExp( hVFhandle, pProperties );
+    ZE_PROBE_ENTRY(lib, "zesVFManagementGetVFPropertiesExp");
+    auto result = pfnGetVFPropertiesExp( hVFhandle, pProperties );
+    ZE_PROBE_EXIT(lib, "zesVFManagementGetVFPropertiesExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6246,7 +6664,10 @@ zesVFManagementGetVFMemoryUtilizationExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetVFMemoryUtilizationExp( hVFhandle, pCount, pMemUtil );
+    ZE_PROBE_ENTRY(lib, "zesVFManagementGetVFMemoryUtilizationExp");
+    auto result = pfnGetVFMemoryUtilizationExp( hVFhandle, pCount, pMemUtil );
+    ZE_PROBE_EXIT(lib, "zesVFManagementGetVFMemoryUtilizationExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6297,7 +6718,10 @@ zesVFManagementGetVFEngineUtilizationExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetVFEngineUtilizationExp( hVFhandle, pCount, pEngineUtil );
+    ZE_PROBE_ENTRY(lib, "zesVFManagementGetVFEngineUtilizationExp");
+    auto result = pfnGetVFEngineUtilizationExp( hVFhandle, pCount, pEngineUtil );
+    ZE_PROBE_EXIT(lib, "zesVFManagementGetVFEngineUtilizationExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6338,7 +6762,10 @@ zesVFManagementSetVFTelemetryModeExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetVFTelemetryModeExp( hVFhandle, flags, enable );
+    ZE_PROBE_ENTRY(lib, "zesVFManagementSetVFTelemetryModeExp");
+    auto result = pfnSetVFTelemetryModeExp( hVFhandle, flags, enable );
+    ZE_PROBE_EXIT(lib, "zesVFManagementSetVFTelemetryModeExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -6379,7 +6806,10 @@ zesVFManagementSetVFTelemetrySamplingIntervalExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetVFTelemetrySamplingIntervalExp( hVFhandle, flag, samplingInterval );
+    ZE_PROBE_ENTRY(lib, "zesVFManagementSetVFTelemetrySamplingIntervalExp");
+    auto result = pfnSetVFTelemetrySamplingIntervalExp( hVFhandle, flag, samplingInterval );
+    ZE_PROBE_EXIT(lib, "zesVFManagementSetVFTelemetrySamplingIntervalExp", result);
+    return result;
 }
 
 } // extern "C"
@@ -10,6 +10,7 @@
  *
  */
 #include "ze_lib.h"
+#include "ze_probes.h"
 
 extern "C" {
 
@@ -56,7 +57,10 @@ zetModuleGetDebugInfo(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetDebugInfo( hModule, format, pSize, pDebugInfo );
+    ZE_PROBE_ENTRY(lib, "zetModuleGetDebugInfo");
+    auto result = pfnGetDebugInfo( hModule, format, pSize, pDebugInfo );
+    ZE_PROBE_EXIT(lib, "zetModuleGetDebugInfo", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -90,7 +94,10 @@ zetDeviceGetDebugProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetDebugProperties( hDevice, pDebugProperties );
+    ZE_PROBE_ENTRY(lib, "zetDeviceGetDebugProperties");
+    auto result = pfnGetDebugProperties( hDevice, pDebugProperties );
+    ZE_PROBE_EXIT(lib, "zetDeviceGetDebugProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -136,7 +143,10 @@ zetDebugAttach(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAttach( hDevice, config, phDebug );
+    ZE_PROBE_ENTRY(lib, "zetDebugAttach");
+    auto result = pfnAttach( hDevice, config, phDebug );
+    ZE_PROBE_EXIT(lib, "zetDebugAttach", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -167,7 +177,10 @@ zetDebugDetach(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnDetach( hDebug );
+    ZE_PROBE_ENTRY(lib, "zetDebugDetach");
+    auto result = pfnDetach( hDebug );
+    ZE_PROBE_EXIT(lib, "zetDebugDetach", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -210,7 +223,10 @@ zetDebugReadEvent(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnReadEvent( hDebug, timeout, event );
+    ZE_PROBE_ENTRY(lib, "zetDebugReadEvent");
+    auto result = pfnReadEvent( hDebug, timeout, event );
+    ZE_PROBE_EXIT(lib, "zetDebugReadEvent", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -244,7 +260,10 @@ zetDebugAcknowledgeEvent(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAcknowledgeEvent( hDebug, event );
+    ZE_PROBE_ENTRY(lib, "zetDebugAcknowledgeEvent");
+    auto result = pfnAcknowledgeEvent( hDebug, event );
+    ZE_PROBE_EXIT(lib, "zetDebugAcknowledgeEvent", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -278,7 +297,10 @@ zetDebugInterrupt(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnInterrupt( hDebug, thread );
+    ZE_PROBE_ENTRY(lib, "zetDebugInterrupt");
+    auto result = pfnInterrupt( hDebug, thread );
+    ZE_PROBE_EXIT(lib, "zetDebugInterrupt", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -312,7 +334,10 @@ zetDebugResume(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnResume( hDebug, thread );
+    ZE_PROBE_ENTRY(lib, "zetDebugResume");
+    auto result = pfnResume( hDebug, thread );
+    ZE_PROBE_EXIT(lib, "zetDebugResume", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -359,7 +384,10 @@ zetDebugReadMemory(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnReadMemory( hDebug, thread, desc, size, buffer );
+    ZE_PROBE_ENTRY(lib, "zetDebugReadMemory");
+    auto result = pfnReadMemory( hDebug, thread, desc, size, buffer );
+    ZE_PROBE_EXIT(lib, "zetDebugReadMemory", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -406,7 +434,10 @@ zetDebugWriteMemory(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnWriteMemory( hDebug, thread, desc, size, buffer );
+    ZE_PROBE_ENTRY(lib, "zetDebugWriteMemory");
+    auto result = pfnWriteMemory( hDebug, thread, desc, size, buffer );
+    ZE_PROBE_EXIT(lib, "zetDebugWriteMemory", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -449,7 +480,10 @@ zetDebugGetRegisterSetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetRegisterSetProperties( hDevice, pCount, pRegisterSetProperties );
+    ZE_PROBE_ENTRY(lib, "zetDebugGetRegisterSetProperties");
+    auto result = pfnGetRegisterSetProperties( hDevice, pCount, pRegisterSetProperties );
+    ZE_PROBE_EXIT(lib, "zetDebugGetRegisterSetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -497,7 +531,10 @@ zetDebugGetThreadRegisterSetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetThreadRegisterSetProperties( hDebug, thread, pCount, pRegisterSetProperties );
+    ZE_PROBE_ENTRY(lib, "zetDebugGetThreadRegisterSetProperties");
+    auto result = pfnGetThreadRegisterSetProperties( hDebug, thread, pCount, pRegisterSetProperties );
+    ZE_PROBE_EXIT(lib, "zetDebugGetThreadRegisterSetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -539,7 +576,10 @@ zetDebugReadRegisters(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnReadRegisters( hDebug, thread, type, start, count, pRegisterValues );
+    ZE_PROBE_ENTRY(lib, "zetDebugReadRegisters");
+    auto result = pfnReadRegisters( hDebug, thread, type, start, count, pRegisterValues );
+    ZE_PROBE_EXIT(lib, "zetDebugReadRegisters", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -581,7 +621,10 @@ zetDebugWriteRegisters(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnWriteRegisters( hDebug, thread, type, start, count, pRegisterValues );
+    ZE_PROBE_ENTRY(lib, "zetDebugWriteRegisters");
+    auto result = pfnWriteRegisters( hDebug, thread, type, start, count, pRegisterValues );
+    ZE_PROBE_EXIT(lib, "zetDebugWriteRegisters", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -626,7 +669,10 @@ zetMetricGroupGet(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGet( hDevice, pCount, phMetricGroups );
+    ZE_PROBE_ENTRY(lib, "zetMetricGroupGet");
+    auto result = pfnGet( hDevice, pCount, phMetricGroups );
+    ZE_PROBE_EXIT(lib, "zetMetricGroupGet", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -663,7 +709,10 @@ zetMetricGroupGetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetProperties( hMetricGroup, pProperties );
+    ZE_PROBE_ENTRY(lib, "zetMetricGroupGetProperties");
+    auto result = pfnGetProperties( hMetricGroup, pProperties );
+    ZE_PROBE_EXIT(lib, "zetMetricGroupGetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -714,7 +763,10 @@ zetMetricGroupCalculateMetricValues(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCalculateMetricValues( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues );
+    ZE_PROBE_ENTRY(lib, "zetMetricGroupCalculateMetricValues");
+    auto result = pfnCalculateMetricValues( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues );
+    ZE_PROBE_EXIT(lib, "zetMetricGroupCalculateMetricValues", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -758,7 +810,10 @@ zetMetricGet(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGet( hMetricGroup, pCount, phMetrics );
+    ZE_PROBE_ENTRY(lib, "zetMetricGet");
+    auto result = pfnGet( hMetricGroup, pCount, phMetrics );
+    ZE_PROBE_EXIT(lib, "zetMetricGet", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -795,7 +850,10 @@ zetMetricGetProperties(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetProperties( hMetric, pProperties );
+    ZE_PROBE_ENTRY(lib, "zetMetricGetProperties");
+    auto result = pfnGetProperties( hMetric, pProperties );
+    ZE_PROBE_EXIT(lib, "zetMetricGetProperties", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -850,7 +908,10 @@ zetContextActivateMetricGroups(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnActivateMetricGroups( hContext, hDevice, count, phMetricGroups );
+    ZE_PROBE_ENTRY(lib, "zetContextActivateMetricGroups");
+    auto result = pfnActivateMetricGroups( hContext, hDevice, count, phMetricGroups );
+    ZE_PROBE_EXIT(lib, "zetContextActivateMetricGroups", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -902,7 +963,10 @@ zetMetricStreamerOpen(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnOpen( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer );
+    ZE_PROBE_ENTRY(lib, "zetMetricStreamerOpen");
+    auto result = pfnOpen( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer );
+    ZE_PROBE_EXIT(lib, "zetMetricStreamerOpen", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -946,7 +1010,10 @@ zetCommandListAppendMetricStreamerMarker(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendMetricStreamerMarker( hCommandList, hMetricStreamer, value );
+    ZE_PROBE_ENTRY(lib, "zetCommandListAppendMetricStreamerMarker");
+    auto result = pfnAppendMetricStreamerMarker( hCommandList, hMetricStreamer, value );
+    ZE_PROBE_EXIT(lib, "zetCommandListAppendMetricStreamerMarker", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -981,7 +1048,10 @@ zetMetricStreamerClose(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnClose( hMetricStreamer );
+    ZE_PROBE_ENTRY(lib, "zetMetricStreamerClose");
+    auto result = pfnClose( hMetricStreamer );
+    ZE_PROBE_EXIT(lib, "zetMetricStreamerClose", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1030,7 +1100,10 @@ zetMetricStreamerReadData(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnReadData( hMetricStreamer, maxReportCount, pRawDataSize, pRawData );
+    ZE_PROBE_ENTRY(lib, "zetMetricStreamerReadData");
+    auto result = pfnReadData( hMetricStreamer, maxReportCount, pRawDataSize, pRawData );
+    ZE_PROBE_EXIT(lib, "zetMetricStreamerReadData", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1076,7 +1149,10 @@ zetMetricQueryPoolCreate(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCreate( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool );
+    ZE_PROBE_ENTRY(lib, "zetMetricQueryPoolCreate");
+    auto result = pfnCreate( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool );
+    ZE_PROBE_EXIT(lib, "zetMetricQueryPoolCreate", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1117,7 +1193,10 @@ zetMetricQueryPoolDestroy(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnDestroy( hMetricQueryPool );
+    ZE_PROBE_ENTRY(lib, "zetMetricQueryPoolDestroy");
+    auto result = pfnDestroy( hMetricQueryPool );
+    ZE_PROBE_EXIT(lib, "zetMetricQueryPoolDestroy", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1156,7 +1235,10 @@ zetMetricQueryCreate(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCreate( hMetricQueryPool, index, phMetricQuery );
+    ZE_PROBE_ENTRY(lib, "zetMetricQueryCreate");
+    auto result = pfnCreate( hMetricQueryPool, index, phMetricQuery );
+    ZE_PROBE_EXIT(lib, "zetMetricQueryCreate", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1195,7 +1277,10 @@ zetMetricQueryDestroy(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnDestroy( hMetricQuery );
+    ZE_PROBE_ENTRY(lib, "zetMetricQueryDestroy");
+    auto result = pfnDestroy( hMetricQuery );
+    ZE_PROBE_EXIT(lib, "zetMetricQueryDestroy", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1232,7 +1317,10 @@ zetMetricQueryReset(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnReset( hMetricQuery );
+    ZE_PROBE_ENTRY(lib, "zetMetricQueryReset");
+    auto result = pfnReset( hMetricQuery );
+    ZE_PROBE_EXIT(lib, "zetMetricQueryReset", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1275,7 +1363,10 @@ zetCommandListAppendMetricQueryBegin(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendMetricQueryBegin( hCommandList, hMetricQuery );
+    ZE_PROBE_ENTRY(lib, "zetCommandListAppendMetricQueryBegin");
+    auto result = pfnAppendMetricQueryBegin( hCommandList, hMetricQuery );
+    ZE_PROBE_EXIT(lib, "zetCommandListAppendMetricQueryBegin", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1332,7 +1423,10 @@ zetCommandListAppendMetricQueryEnd(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendMetricQueryEnd( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_ENTRY(lib, "zetCommandListAppendMetricQueryEnd");
+    auto result = pfnAppendMetricQueryEnd( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents );
+    ZE_PROBE_EXIT(lib, "zetCommandListAppendMetricQueryEnd", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1367,7 +1461,10 @@ zetCommandListAppendMetricMemoryBarrier(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAppendMetricMemoryBarrier( hCommandList );
+    ZE_PROBE_ENTRY(lib, "zetCommandListAppendMetricMemoryBarrier");
+    auto result = pfnAppendMetricMemoryBarrier( hCommandList );
+    ZE_PROBE_EXIT(lib, "zetCommandListAppendMetricMemoryBarrier", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1412,7 +1509,10 @@ zetMetricQueryGetData(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetData( hMetricQuery, pRawDataSize, pRawData );
+    ZE_PROBE_ENTRY(lib, "zetMetricQueryGetData");
+    auto result = pfnGetData( hMetricQuery, pRawDataSize, pRawData );
+    ZE_PROBE_EXIT(lib, "zetMetricQueryGetData", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1454,7 +1554,10 @@ zetKernelGetProfileInfo(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetProfileInfo( hKernel, pProfileProperties );
+    ZE_PROBE_ENTRY(lib, "zetKernelGetProfileInfo");
+    auto result = pfnGetProfileInfo( hKernel, pProfileProperties );
+    ZE_PROBE_EXIT(lib, "zetKernelGetProfileInfo", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1498,7 +1601,10 @@ zetTracerExpCreate(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCreate( hContext, desc, phTracer );
+    ZE_PROBE_ENTRY(lib, "zetTracerExpCreate");
+    auto result = pfnCreate( hContext, desc, phTracer );
+    ZE_PROBE_EXIT(lib, "zetTracerExpCreate", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1538,7 +1644,10 @@ zetTracerExpDestroy(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnDestroy( hTracer );
+    ZE_PROBE_ENTRY(lib, "zetTracerExpDestroy");
+    auto result = pfnDestroy( hTracer );
+    ZE_PROBE_EXIT(lib, "zetTracerExpDestroy", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1581,7 +1690,10 @@ zetTracerExpSetPrologues(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetPrologues( hTracer, pCoreCbs );
+    ZE_PROBE_ENTRY(lib, "zetTracerExpSetPrologues");
+    auto result = pfnSetPrologues( hTracer, pCoreCbs );
+    ZE_PROBE_EXIT(lib, "zetTracerExpSetPrologues", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1624,7 +1736,10 @@ zetTracerExpSetEpilogues(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetEpilogues( hTracer, pCoreCbs );
+    ZE_PROBE_ENTRY(lib, "zetTracerExpSetEpilogues");
+    auto result = pfnSetEpilogues( hTracer, pCoreCbs );
+    ZE_PROBE_EXIT(lib, "zetTracerExpSetEpilogues", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1660,7 +1775,10 @@ zetTracerExpSetEnabled(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnSetEnabled( hTracer, enable );
+    ZE_PROBE_ENTRY(lib, "zetTracerExpSetEnabled");
+    auto result = pfnSetEnabled( hTracer, enable );
+    ZE_PROBE_EXIT(lib, "zetTracerExpSetEnabled", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1730,7 +1848,10 @@ zetMetricGroupCalculateMultipleMetricValuesExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCalculateMultipleMetricValuesExp( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
+    ZE_PROBE_ENTRY(lib, "zetMetricGroupCalculateMultipleMetricValuesExp");
+    auto result = pfnCalculateMultipleMetricValuesExp( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
+    ZE_PROBE_EXIT(lib, "zetMetricGroupCalculateMultipleMetricValuesExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1773,7 +1894,10 @@ zetMetricGroupGetGlobalTimestampsExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetGlobalTimestampsExp( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp );
+    ZE_PROBE_ENTRY(lib, "zetMetricGroupGetGlobalTimestampsExp");
+    auto result = pfnGetGlobalTimestampsExp( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp );
+    ZE_PROBE_EXIT(lib, "zetMetricGroupGetGlobalTimestampsExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1824,7 +1948,10 @@ zetMetricGroupGetExportDataExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetExportDataExp( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData );
+    ZE_PROBE_ENTRY(lib, "zetMetricGroupGetExportDataExp");
+    auto result = pfnGetExportDataExp( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData );
+    ZE_PROBE_EXIT(lib, "zetMetricGroupGetExportDataExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1895,7 +2022,10 @@ zetMetricGroupCalculateMetricExportDataExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCalculateMetricExportDataExp( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
+    ZE_PROBE_ENTRY(lib, "zetMetricGroupCalculateMetricExportDataExp");
+    auto result = pfnCalculateMetricExportDataExp( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
+    ZE_PROBE_EXIT(lib, "zetMetricGroupCalculateMetricExportDataExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1942,7 +2072,10 @@ zetMetricProgrammableGetExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetExp( hDevice, pCount, phMetricProgrammables );
+    ZE_PROBE_ENTRY(lib, "zetMetricProgrammableGetExp");
+    auto result = pfnGetExp( hDevice, pCount, phMetricProgrammables );
+    ZE_PROBE_EXIT(lib, "zetMetricProgrammableGetExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1979,7 +2112,10 @@ zetMetricProgrammableGetPropertiesExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetPropertiesExp( hMetricProgrammable, pProperties );
+    ZE_PROBE_ENTRY(lib, "zetMetricProgrammableGetPropertiesExp");
+    auto result = pfnGetPropertiesExp( hMetricProgrammable, pProperties );
+    ZE_PROBE_EXIT(lib, "zetMetricProgrammableGetPropertiesExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2025,7 +2161,10 @@ zetMetricProgrammableGetParamInfoExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetParamInfoExp( hMetricProgrammable, pParameterCount, pParameterInfo );
+    ZE_PROBE_ENTRY(lib, "zetMetricProgrammableGetParamInfoExp");
+    auto result = pfnGetParamInfoExp( hMetricProgrammable, pParameterCount, pParameterInfo );
+    ZE_PROBE_EXIT(lib, "zetMetricProgrammableGetParamInfoExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2073,7 +2212,10 @@ zetMetricProgrammableGetParamValueInfoExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnGetParamValueInfoExp( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo );
+    ZE_PROBE_ENTRY(lib, "zetMetricProgrammableGetParamValueInfoExp");
+    auto result = pfnGetParamValueInfoExp( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo );
+    ZE_PROBE_EXIT(lib, "zetMetricProgrammableGetParamValueInfoExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2137,7 +2279,10 @@ zetMetricCreateFromProgrammableExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCreateFromProgrammableExp( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles );
+    ZE_PROBE_ENTRY(lib, "zetMetricCreateFromProgrammableExp");
+    auto result = pfnCreateFromProgrammableExp( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles );
+    ZE_PROBE_EXIT(lib, "zetMetricCreateFromProgrammableExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2185,7 +2330,10 @@ zetMetricGroupCreateExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCreateExp( hDevice, pName, pDescription, samplingType, phMetricGroup );
+    ZE_PROBE_ENTRY(lib, "zetMetricGroupCreateExp");
+    auto result = pfnCreateExp( hDevice, pName, pDescription, samplingType, phMetricGroup );
+    ZE_PROBE_EXIT(lib, "zetMetricGroupCreateExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2241,7 +2389,10 @@ zetMetricGroupAddMetricExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnAddMetricExp( hMetricGroup, hMetric, pErrorStringSize, pErrorString );
+    ZE_PROBE_ENTRY(lib, "zetMetricGroupAddMetricExp");
+    auto result = pfnAddMetricExp( hMetricGroup, hMetric, pErrorStringSize, pErrorString );
+    ZE_PROBE_EXIT(lib, "zetMetricGroupAddMetricExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2283,7 +2434,10 @@ zetMetricGroupRemoveMetricExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnRemoveMetricExp( hMetricGroup, hMetric );
+    ZE_PROBE_ENTRY(lib, "zetMetricGroupRemoveMetricExp");
+    auto result = pfnRemoveMetricExp( hMetricGroup, hMetric );
+    ZE_PROBE_EXIT(lib, "zetMetricGroupRemoveMetricExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2333,7 +2487,10 @@ zetMetricGroupCloseExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnCloseExp( hMetricGroup );
+    ZE_PROBE_ENTRY(lib, "zetMetricGroupCloseExp");
+    auto result = pfnCloseExp( hMetricGroup );
+    ZE_PROBE_EXIT(lib, "zetMetricGroupCloseExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2375,7 +2532,10 @@ zetMetricGroupDestroyExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnDestroyExp( hMetricGroup );
+    ZE_PROBE_ENTRY(lib, "zetMetricGroupDestroyExp");
+    auto result = pfnDestroyExp( hMetricGroup );
+    ZE_PROBE_EXIT(lib, "zetMetricGroupDestroyExp", result);
+    return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2414,7 +2574,10 @@ zetMetricDestroyExp(
             return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    return pfnDestroyExp( hMetric );
+    ZE_PROBE_ENTRY(lib, "zetMetricDestroyExp");
+    auto result = pfnDestroyExp( hMetric );
+    ZE_PROBE_EXIT(lib, "zetMetricDestroyExp", result);
+    return result;
 }
 
 } // extern "C"
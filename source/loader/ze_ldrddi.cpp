@@ -8,6 +8,7 @@
  *
  */
 #include "ze_loader_internal.h"
+#include "ze_probes.h"
 
 namespace loader
 {
@@ -44,6 +45,7 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
 
+        ZE_PROBE_ENTRY(loader, "zeInit");
         bool atLeastOneDriverValid = false;
         for( auto& drv : context->drivers )
         {
@@ -56,6 +58,7 @@ namespace loader
 
         if(!atLeastOneDriverValid)
             result=ZE_RESULT_ERROR_UNINITIALIZED;
+        ZE_PROBE_EXIT(loader, "zeInit", result);
 
         return result;
     }
@@ -76,6 +79,7 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
 
+        ZE_PROBE_ENTRY(loader, "zeDriverGet");
         uint32_t total_driver_handle_count = 0;
 
         for( auto& drv : context->drivers )
@@ -118,6 +122,7 @@ namespace loader
 
         if( ZE_RESULT_SUCCESS == result )
             *pCount = total_driver_handle_count;
+        ZE_PROBE_EXIT(loader, "zeDriverGet", result);
 
         return result;
     }
@@ -142,7 +147,9 @@ namespace loader
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeDriverGetApiVersion");
         result = pfnGetApiVersion( hDriver, version );
+        ZE_PROBE_EXIT(loader, "zeDriverGetApiVersion", result);
 
         return result;
     }
@@ -167,7 +174,12 @@ namespace loader
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
         // forward to device-driver
-        result = pfnGetProperties( hDriver, pDriverProperties );
+        ZE_PROBE_ENTRY(loader, "zeDriverGetProperties");
+        if( context->propertyCacheEnabled )
+            result = property_cache.get( pfnGetProperties, hDriver, pDriverProperties );
+        else
+            result = pfnGetProperties( hDriver, pDriverProperties );
+        ZE_PROBE_EXIT(loader, "zeDriverGetProperties", result);
 
         return result;
     }
@@ -192,7 +204,9 @@ namespace loader
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeDriverGetIpcProperties");
         result = pfnGetIpcProperties( hDriver, pIpcProperties );
+        ZE_PROBE_EXIT(loader, "zeDriverGetIpcProperties", result);
 
         return result;
     }
@@ -226,7 +240,9 @@ namespace loader
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeDriverGetExtensionProperties");
         result = pfnGetExtensionProperties( hDriver, pCount, pExtensionProperties );
+        ZE_PROBE_EXIT(loader, "zeDriverGetExtensionProperties", result);
 
         return result;
     }
@@ -252,7 +268,9 @@ namespace loader
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeDriverGetExtensionFunctionAddress");
         result = pfnGetExtensionFunctionAddress( hDriver, name, ppFunctionAddress );
+        ZE_PROBE_EXIT(loader, "zeDriverGetExtensionFunctionAddress", result);
 
         return result;
     }
@@ -278,7 +296,9 @@ namespace loader
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeDriverGetLastErrorDescription");
         result = pfnGetLastErrorDescription( hDriver, ppString );
+        ZE_PROBE_EXIT(loader, "zeDriverGetLastErrorDescription", result);
 
         return result;
     }
@@ -310,7 +330,9 @@ namespace loader
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeDeviceGet");
         result = pfnGet( hDriver, pCount, phDevices );
+        ZE_PROBE_EXIT(loader, "zeDeviceGet", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -350,7 +372,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeDeviceGetRootDevice");
         result = pfnGetRootDevice( hDevice, phRootDevice );
+        ZE_PROBE_EXIT(loader, "zeDeviceGetRootDevice", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -396,7 +420,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeDeviceGetSubDevices");
         result = pfnGetSubDevices( hDevice, pCount, phSubdevices );
+        ZE_PROBE_EXIT(loader, "zeDeviceGetSubDevices", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -436,7 +462,12 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
-        result = pfnGetProperties( hDevice, pDeviceProperties );
+        ZE_PROBE_ENTRY(loader, "zeDeviceGetProperties");
+        if( context->propertyCacheEnabled )
+            result = property_cache.get( pfnGetProperties, hDevice, pDeviceProperties );
+        else
+            result = pfnGetProperties( hDevice, pDeviceProperties );
+        ZE_PROBE_EXIT(loader, "zeDeviceGetProperties", result);
 
         return result;
     }
@@ -461,7 +492,12 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
-        result = pfnGetComputeProperties( hDevice, pComputeProperties );
+        ZE_PROBE_ENTRY(loader, "zeDeviceGetComputeProperties");
+        if( context->propertyCacheEnabled )
+            result = property_cache.get( pfnGetComputeProperties, hDevice, pComputeProperties );
+        else
+            result = pfnGetComputeProperties( hDevice, pComputeProperties );
+        ZE_PROBE_EXIT(loader, "zeDeviceGetComputeProperties", result);
 
         return result;
     }
@@ -486,7 +522,12 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
-        result = pfnGetModuleProperties( hDevice, pModuleProperties );
+        ZE_PROBE_ENTRY(loader, "zeDeviceGetModuleProperties");
+        if( context->propertyCacheEnabled )
+            result = property_cache.get( pfnGetModuleProperties, hDevice, pModuleProperties );
+        else
+            result = pfnGetModuleProperties( hDevice, pModuleProperties );
+        ZE_PROBE_EXIT(loader, "zeDeviceGetModuleProperties", result);
 
         return result;
     }
@@ -521,7 +562,12 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
-        result = pfnGetCommandQueueGroupProperties( hDevice, pCount, pCommandQueueGroupProperties );
+        ZE_PROBE_ENTRY(loader, "zeDeviceGetCommandQueueGroupProperties");
+        if( context->propertyCacheEnabled )
+            result = property_cache.getArray( pfnGetCommandQueueGroupProperties, hDevice, pCount, pCommandQueueGroupProperties );
+        else
+            result = pfnGetCommandQueueGroupProperties( hDevice, pCount, pCommandQueueGroupProperties );
+        ZE_PROBE_EXIT(loader, "zeDeviceGetCommandQueueGroupProperties", result);
 
         return result;
     }
@@ -555,7 +601,12 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
-        result = pfnGetMemoryProperties( hDevice, pCount, pMemProperties );
+        ZE_PROBE_ENTRY(loader, "zeDeviceGetMemoryProperties");
+        if( context->propertyCacheEnabled )
+            result = property_cache.getArray( pfnGetMemoryProperties, hDevice, pCount, pMemProperties );
+        else
+            result = pfnGetMemoryProperties( hDevice, pCount, pMemProperties );
+        ZE_PROBE_EXIT(loader, "zeDeviceGetMemoryProperties", result);
 
         return result;
     }
@@ -580,7 +631,12 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
-        result = pfnGetMemoryAccessProperties( hDevice, pMemAccessProperties );
+        ZE_PROBE_ENTRY(loader, "zeDeviceGetMemoryAccessProperties");
+        if( context->propertyCacheEnabled )
+            result = property_cache.get( pfnGetMemoryAccessProperties, hDevice, pMemAccessProperties );
+        else
+            result = pfnGetMemoryAccessProperties( hDevice, pMemAccessProperties );
+        ZE_PROBE_EXIT(loader, "zeDeviceGetMemoryAccessProperties", result);
 
         return result;
     }
@@ -613,7 +669,12 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
-        result = pfnGetCacheProperties( hDevice, pCount, pCacheProperties );
+        ZE_PROBE_ENTRY(loader, "zeDeviceGetCacheProperties");
+        if( context->propertyCacheEnabled )
+            result = property_cache.getArray( pfnGetCacheProperties, hDevice, pCount, pCacheProperties );
+        else
+            result = pfnGetCacheProperties( hDevice, pCount, pCacheProperties );
+        ZE_PROBE_EXIT(loader, "zeDeviceGetCacheProperties", result);
 
         return result;
     }
@@ -638,7 +699,12 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
-        result = pfnGetImageProperties( hDevice, pImageProperties );
+        ZE_PROBE_ENTRY(loader, "zeDeviceGetImageProperties");
+        if( context->propertyCacheEnabled )
+            result = property_cache.get( pfnGetImageProperties, hDevice, pImageProperties );
+        else
+            result = pfnGetImageProperties( hDevice, pImageProperties );
+        ZE_PROBE_EXIT(loader, "zeDeviceGetImageProperties", result);
 
         return result;
     }
@@ -663,7 +729,12 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
-        result = pfnGetExternalMemoryProperties( hDevice, pExternalMemoryProperties );
+        ZE_PROBE_ENTRY(loader, "zeDeviceGetExternalMemoryProperties");
+        if( context->propertyCacheEnabled )
+            result = property_cache.get( pfnGetExternalMemoryProperties, hDevice, pExternalMemoryProperties );
+        else
+            result = pfnGetExternalMemoryProperties( hDevice, pExternalMemoryProperties );
+        ZE_PROBE_EXIT(loader, "zeDeviceGetExternalMemoryProperties", result);
 
         return result;
     }
@@ -692,7 +763,9 @@ namespace loader
         hPeerDevice = reinterpret_cast<ze_device_object_t*>( hPeerDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeDeviceGetP2PProperties");
         result = pfnGetP2PProperties( hDevice, hPeerDevice, pP2PProperties );
+        ZE_PROBE_EXIT(loader, "zeDeviceGetP2PProperties", result);
 
         return result;
     }
@@ -721,7 +794,9 @@ namespace loader
         hPeerDevice = reinterpret_cast<ze_device_object_t*>( hPeerDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeDeviceCanAccessPeer");
         result = pfnCanAccessPeer( hDevice, hPeerDevice, value );
+        ZE_PROBE_EXIT(loader, "zeDeviceCanAccessPeer", result);
 
         return result;
     }
@@ -745,7 +820,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeDeviceGetStatus");
         result = pfnGetStatus( hDevice );
+        ZE_PROBE_EXIT(loader, "zeDeviceGetStatus", result);
 
         return result;
     }
@@ -773,7 +850,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeDeviceGetGlobalTimestamps");
         result = pfnGetGlobalTimestamps( hDevice, hostTimestamp, deviceTimestamp );
+        ZE_PROBE_EXIT(loader, "zeDeviceGetGlobalTimestamps", result);
 
         return result;
     }
@@ -799,7 +878,9 @@ namespace loader
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeContextCreate");
         result = pfnCreate( hDriver, desc, phContext );
+        ZE_PROBE_EXIT(loader, "zeContextCreate", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -854,7 +935,9 @@ namespace loader
             phDevicesLocal[ i ] = reinterpret_cast<ze_device_object_t*>( phDevices[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeContextCreateEx");
         result = pfnCreateEx( hDriver, desc, numDevices, phDevicesLocal, phContext );
+        ZE_PROBE_EXIT(loader, "zeContextCreateEx", result);
         delete []phDevicesLocal;
 
         if( ZE_RESULT_SUCCESS != result )
@@ -893,7 +976,9 @@ namespace loader
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeContextDestroy");
         result = pfnDestroy( hContext );
+        ZE_PROBE_EXIT(loader, "zeContextDestroy", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -923,7 +1008,9 @@ namespace loader
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeContextGetStatus");
         result = pfnGetStatus( hContext );
+        ZE_PROBE_EXIT(loader, "zeContextGetStatus", result);
 
         return result;
     }
@@ -953,7 +1040,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandQueueCreate");
         result = pfnCreate( hContext, hDevice, desc, phCommandQueue );
+        ZE_PROBE_EXIT(loader, "zeCommandQueueCreate", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -991,7 +1080,9 @@ namespace loader
         hCommandQueue = reinterpret_cast<ze_command_queue_object_t*>( hCommandQueue )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandQueueDestroy");
         result = pfnDestroy( hCommandQueue );
+        ZE_PROBE_EXIT(loader, "zeCommandQueueDestroy", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -1033,7 +1124,9 @@ namespace loader
         hFence = ( hFence ) ? reinterpret_cast<ze_fence_object_t*>( hFence )->handle : nullptr;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandQueueExecuteCommandLists");
         result = pfnExecuteCommandLists( hCommandQueue, numCommandLists, phCommandListsLocal, hFence );
+        ZE_PROBE_EXIT(loader, "zeCommandQueueExecuteCommandLists", result);
         delete []phCommandListsLocal;
 
         return result;
@@ -1065,7 +1158,9 @@ namespace loader
         hCommandQueue = reinterpret_cast<ze_command_queue_object_t*>( hCommandQueue )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandQueueSynchronize");
         result = pfnSynchronize( hCommandQueue, timeout );
+        ZE_PROBE_EXIT(loader, "zeCommandQueueSynchronize", result);
 
         return result;
     }
@@ -1090,7 +1185,9 @@ namespace loader
         hCommandQueue = reinterpret_cast<ze_command_queue_object_t*>( hCommandQueue )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandQueueGetOrdinal");
         result = pfnGetOrdinal( hCommandQueue, pOrdinal );
+        ZE_PROBE_EXIT(loader, "zeCommandQueueGetOrdinal", result);
 
         return result;
     }
@@ -1115,7 +1212,9 @@ namespace loader
         hCommandQueue = reinterpret_cast<ze_command_queue_object_t*>( hCommandQueue )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandQueueGetIndex");
         result = pfnGetIndex( hCommandQueue, pIndex );
+        ZE_PROBE_EXIT(loader, "zeCommandQueueGetIndex", result);
 
         return result;
     }
@@ -1145,7 +1244,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListCreate");
         result = pfnCreate( hContext, hDevice, desc, phCommandList );
+        ZE_PROBE_EXIT(loader, "zeCommandListCreate", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -1189,7 +1290,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListCreateImmediate");
         result = pfnCreateImmediate( hContext, hDevice, altdesc, phCommandList );
+        ZE_PROBE_EXIT(loader, "zeCommandListCreateImmediate", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -1227,7 +1330,9 @@ namespace loader
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListDestroy");
         result = pfnDestroy( hCommandList );
+        ZE_PROBE_EXIT(loader, "zeCommandListDestroy", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -1257,7 +1362,9 @@ namespace loader
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListClose");
         result = pfnClose( hCommandList );
+        ZE_PROBE_EXIT(loader, "zeCommandListClose", result);
 
         return result;
     }
@@ -1281,7 +1388,9 @@ namespace loader
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListReset");
         result = pfnReset( hCommandList );
+        ZE_PROBE_EXIT(loader, "zeCommandListReset", result);
 
         return result;
     }
@@ -1320,7 +1429,9 @@ namespace loader
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListAppendWriteGlobalTimestamp");
         result = pfnAppendWriteGlobalTimestamp( hCommandList, dstptr, hSignalEvent, numWaitEvents, phWaitEventsLocal );
+        ZE_PROBE_EXIT(loader, "zeCommandListAppendWriteGlobalTimestamp", result);
         delete []phWaitEventsLocal;
 
         return result;
@@ -1352,7 +1463,9 @@ namespace loader
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListHostSynchronize");
         result = pfnHostSynchronize( hCommandList, timeout );
+        ZE_PROBE_EXIT(loader, "zeCommandListHostSynchronize", result);
 
         return result;
     }
@@ -1377,7 +1490,9 @@ namespace loader
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListGetDeviceHandle");
         result = pfnGetDeviceHandle( hCommandList, phDevice );
+        ZE_PROBE_EXIT(loader, "zeCommandListGetDeviceHandle", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -1416,7 +1531,9 @@ namespace loader
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListGetContextHandle");
         result = pfnGetContextHandle( hCommandList, phContext );
+        ZE_PROBE_EXIT(loader, "zeCommandListGetContextHandle", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -1455,7 +1572,9 @@ namespace loader
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListGetOrdinal");
         result = pfnGetOrdinal( hCommandList, pOrdinal );
+        ZE_PROBE_EXIT(loader, "zeCommandListGetOrdinal", result);
 
         return result;
     }
@@ -1481,7 +1600,9 @@ namespace loader
         hCommandListImmediate = reinterpret_cast<ze_command_list_object_t*>( hCommandListImmediate )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListImmediateGetIndex");
         result = pfnImmediateGetIndex( hCommandListImmediate, pIndex );
+        ZE_PROBE_EXIT(loader, "zeCommandListImmediateGetIndex", result);
 
         return result;
     }
@@ -1507,7 +1628,9 @@ namespace loader
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListIsImmediate");
         result = pfnIsImmediate( hCommandList, pIsImmediate );
+        ZE_PROBE_EXIT(loader, "zeCommandListIsImmediate", result);
 
         return result;
     }
@@ -1544,7 +1667,9 @@ namespace loader
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListAppendBarrier");
         result = pfnAppendBarrier( hCommandList, hSignalEvent, numWaitEvents, phWaitEventsLocal );
+        ZE_PROBE_EXIT(loader, "zeCommandListAppendBarrier", result);
         delete []phWaitEventsLocal;
 
         return result;
@@ -1585,7 +1710,9 @@ namespace loader
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListAppendMemoryRangesBarrier");
         result = pfnAppendMemoryRangesBarrier( hCommandList, numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEventsLocal );
+        ZE_PROBE_EXIT(loader, "zeCommandListAppendMemoryRangesBarrier", result);
         delete []phWaitEventsLocal;
 
         return result;
@@ -1614,7 +1741,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeContextSystemBarrier");
         result = pfnSystemBarrier( hContext, hDevice );
+        ZE_PROBE_EXIT(loader, "zeContextSystemBarrier", result);
 
         return result;
     }
@@ -1654,7 +1783,9 @@ namespace loader
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListAppendMemoryCopy");
         result = pfnAppendMemoryCopy( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEventsLocal );
+        ZE_PROBE_EXIT(loader, "zeCommandListAppendMemoryCopy", result);
         delete []phWaitEventsLocal;
 
         return result;
@@ -1696,7 +1827,9 @@ namespace loader
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListAppendMemoryFill");
         result = pfnAppendMemoryFill( hCommandList, ptr, pattern, pattern_size, size, hSignalEvent, numWaitEvents, phWaitEventsLocal );
+        ZE_PROBE_EXIT(loader, "zeCommandListAppendMemoryFill", result);
         delete []phWaitEventsLocal;
 
         return result;
@@ -1746,7 +1879,9 @@ namespace loader
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListAppendMemoryCopyRegion");
         result = pfnAppendMemoryCopyRegion( hCommandList, dstptr, dstRegion, dstPitch, dstSlicePitch, srcptr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEventsLocal );
+        ZE_PROBE_EXIT(loader, "zeCommandListAppendMemoryCopyRegion", result);
         delete []phWaitEventsLocal;
 
         return result;
@@ -1791,7 +1926,9 @@ namespace loader
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListAppendMemoryCopyFromContext");
         result = pfnAppendMemoryCopyFromContext( hCommandList, dstptr, hContextSrc, srcptr, size, hSignalEvent, numWaitEvents, phWaitEventsLocal );
+        ZE_PROBE_EXIT(loader, "zeCommandListAppendMemoryCopyFromContext", result);
         delete []phWaitEventsLocal;
 
         return result;
@@ -1837,7 +1974,9 @@ namespace loader
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListAppendImageCopy");
         result = pfnAppendImageCopy( hCommandList, hDstImage, hSrcImage, hSignalEvent, numWaitEvents, phWaitEventsLocal );
+        ZE_PROBE_EXIT(loader, "zeCommandListAppendImageCopy", result);
         delete []phWaitEventsLocal;
 
         return result;
@@ -1885,7 +2024,9 @@ namespace loader
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListAppendImageCopyRegion");
         result = pfnAppendImageCopyRegion( hCommandList, hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEventsLocal );
+        ZE_PROBE_EXIT(loader, "zeCommandListAppendImageCopyRegion", result);
         delete []phWaitEventsLocal;
 
         return result;
@@ -1929,7 +2070,9 @@ namespace loader
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListAppendImageCopyToMemory");
         result = pfnAppendImageCopyToMemory( hCommandList, dstptr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEventsLocal );
+        ZE_PROBE_EXIT(loader, "zeCommandListAppendImageCopyToMemory", result);
         delete []phWaitEventsLocal;
 
         return result;
@@ -1973,7 +2116,9 @@ namespace loader
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListAppendImageCopyFromMemory");
         result = pfnAppendImageCopyFromMemory( hCommandList, hDstImage, srcptr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEventsLocal );
+        ZE_PROBE_EXIT(loader, "zeCommandListAppendImageCopyFromMemory", result);
         delete []phWaitEventsLocal;
 
         return result;
@@ -2000,7 +2145,9 @@ namespace loader
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListAppendMemoryPrefetch");
         result = pfnAppendMemoryPrefetch( hCommandList, ptr, size );
+        ZE_PROBE_EXIT(loader, "zeCommandListAppendMemoryPrefetch", result);
 
         return result;
     }
@@ -2031,7 +2178,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListAppendMemAdvise");
         result = pfnAppendMemAdvise( hCommandList, hDevice, ptr, size, advice );
+        ZE_PROBE_EXIT(loader, "zeCommandListAppendMemAdvise", result);
 
         return result;
     }
@@ -2068,7 +2217,9 @@ namespace loader
             phDevicesLocal[ i ] = reinterpret_cast<ze_device_object_t*>( phDevices[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeEventPoolCreate");
         result = pfnCreate( hContext, desc, numDevices, phDevicesLocal, phEventPool );
+        ZE_PROBE_EXIT(loader, "zeEventPoolCreate", result);
         delete []phDevicesLocal;
 
         if( ZE_RESULT_SUCCESS != result )
@@ -2107,7 +2258,9 @@ namespace loader
         hEventPool = reinterpret_cast<ze_event_pool_object_t*>( hEventPool )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeEventPoolDestroy");
         result = pfnDestroy( hEventPool );
+        ZE_PROBE_EXIT(loader, "zeEventPoolDestroy", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -2139,7 +2292,9 @@ namespace loader
         hEventPool = reinterpret_cast<ze_event_pool_object_t*>( hEventPool )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeEventCreate");
         result = pfnCreate( hEventPool, desc, phEvent );
+        ZE_PROBE_EXIT(loader, "zeEventCreate", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -2177,7 +2332,9 @@ namespace loader
         hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeEventDestroy");
         result = pfnDestroy( hEvent );
+        ZE_PROBE_EXIT(loader, "zeEventDestroy", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -2208,7 +2365,9 @@ namespace loader
         hEventPool = reinterpret_cast<ze_event_pool_object_t*>( hEventPool )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeEventPoolGetIpcHandle");
         result = pfnGetIpcHandle( hEventPool, phIpc );
+        ZE_PROBE_EXIT(loader, "zeEventPoolGetIpcHandle", result);
 
         return result;
     }
@@ -2234,7 +2393,9 @@ namespace loader
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeEventPoolPutIpcHandle");
         result = pfnPutIpcHandle( hContext, hIpc );
+        ZE_PROBE_EXIT(loader, "zeEventPoolPutIpcHandle", result);
 
         return result;
     }
@@ -2261,7 +2422,9 @@ namespace loader
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeEventPoolOpenIpcHandle");
         result = pfnOpenIpcHandle( hContext, hIpc, phEventPool );
+        ZE_PROBE_EXIT(loader, "zeEventPoolOpenIpcHandle", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -2299,7 +2462,9 @@ namespace loader
         hEventPool = reinterpret_cast<ze_event_pool_object_t*>( hEventPool )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeEventPoolCloseIpcHandle");
         result = pfnCloseIpcHandle( hEventPool );
+        ZE_PROBE_EXIT(loader, "zeEventPoolCloseIpcHandle", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -2333,7 +2498,9 @@ namespace loader
         hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListAppendSignalEvent");
         result = pfnAppendSignalEvent( hCommandList, hEvent );
+        ZE_PROBE_EXIT(loader, "zeCommandListAppendSignalEvent", result);
 
         return result;
     }
@@ -2365,7 +2532,9 @@ namespace loader
             phEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phEvents[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListAppendWaitOnEvents");
         result = pfnAppendWaitOnEvents( hCommandList, numEvents, phEventsLocal );
+        ZE_PROBE_EXIT(loader, "zeCommandListAppendWaitOnEvents", result);
         delete []phEventsLocal;
 
         return result;
@@ -2390,7 +2559,9 @@ namespace loader
         hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeEventHostSignal");
         result = pfnHostSignal( hEvent );
+        ZE_PROBE_EXIT(loader, "zeEventHostSignal", result);
 
         return result;
     }
@@ -2421,7 +2592,9 @@ namespace loader
         hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeEventHostSynchronize");
         result = pfnHostSynchronize( hEvent, timeout );
+        ZE_PROBE_EXIT(loader, "zeEventHostSynchronize", result);
 
         return result;
     }
@@ -2445,7 +2618,9 @@ namespace loader
         hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeEventQueryStatus");
         result = pfnQueryStatus( hEvent );
+        ZE_PROBE_EXIT(loader, "zeEventQueryStatus", result);
 
         return result;
     }
@@ -2473,7 +2648,9 @@ namespace loader
         hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListAppendEventReset");
         result = pfnAppendEventReset( hCommandList, hEvent );
+        ZE_PROBE_EXIT(loader, "zeCommandListAppendEventReset", result);
 
         return result;
     }
@@ -2497,7 +2674,9 @@ namespace loader
         hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeEventHostReset");
         result = pfnHostReset( hEvent );
+        ZE_PROBE_EXIT(loader, "zeEventHostReset", result);
 
         return result;
     }
@@ -2522,7 +2701,9 @@ namespace loader
         hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeEventQueryKernelTimestamp");
         result = pfnQueryKernelTimestamp( hEvent, dstptr );
+        ZE_PROBE_EXIT(loader, "zeEventQueryKernelTimestamp", result);
 
         return result;
     }
@@ -2571,7 +2752,9 @@ namespace loader
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListAppendQueryKernelTimestamps");
         result = pfnAppendQueryKernelTimestamps( hCommandList, numEvents, phEventsLocal, dstptr, pOffsets, hSignalEvent, numWaitEvents, phWaitEventsLocal );
+        ZE_PROBE_EXIT(loader, "zeCommandListAppendQueryKernelTimestamps", result);
         delete []phEventsLocal;
         delete []phWaitEventsLocal;
 
@@ -2598,7 +2781,9 @@ namespace loader
         hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeEventGetEventPool");
         result = pfnGetEventPool( hEvent, phEventPool );
+        ZE_PROBE_EXIT(loader, "zeEventGetEventPool", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -2639,7 +2824,9 @@ namespace loader
         hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeEventGetSignalScope");
         result = pfnGetSignalScope( hEvent, pSignalScope );
+        ZE_PROBE_EXIT(loader, "zeEventGetSignalScope", result);
 
         return result;
     }
@@ -2666,7 +2853,9 @@ namespace loader
         hEvent = reinterpret_cast<ze_event_object_t*>( hEvent )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeEventGetWaitScope");
         result = pfnGetWaitScope( hEvent, pWaitScope );
+        ZE_PROBE_EXIT(loader, "zeEventGetWaitScope", result);
 
         return result;
     }
@@ -2691,7 +2880,9 @@ namespace loader
         hEventPool = reinterpret_cast<ze_event_pool_object_t*>( hEventPool )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeEventPoolGetContextHandle");
         result = pfnGetContextHandle( hEventPool, phContext );
+        ZE_PROBE_EXIT(loader, "zeEventPoolGetContextHandle", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -2731,7 +2922,9 @@ namespace loader
         hEventPool = reinterpret_cast<ze_event_pool_object_t*>( hEventPool )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeEventPoolGetFlags");
         result = pfnGetFlags( hEventPool, pFlags );
+        ZE_PROBE_EXIT(loader, "zeEventPoolGetFlags", result);
 
         return result;
     }
@@ -2757,7 +2950,9 @@ namespace loader
         hCommandQueue = reinterpret_cast<ze_command_queue_object_t*>( hCommandQueue )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeFenceCreate");
         result = pfnCreate( hCommandQueue, desc, phFence );
+        ZE_PROBE_EXIT(loader, "zeFenceCreate", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -2795,7 +2990,9 @@ namespace loader
         hFence = reinterpret_cast<ze_fence_object_t*>( hFence )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeFenceDestroy");
         result = pfnDestroy( hFence );
+        ZE_PROBE_EXIT(loader, "zeFenceDestroy", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -2832,7 +3029,9 @@ namespace loader
         hFence = reinterpret_cast<ze_fence_object_t*>( hFence )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeFenceHostSynchronize");
         result = pfnHostSynchronize( hFence, timeout );
+        ZE_PROBE_EXIT(loader, "zeFenceHostSynchronize", result);
 
         return result;
     }
@@ -2856,7 +3055,9 @@ namespace loader
         hFence = reinterpret_cast<ze_fence_object_t*>( hFence )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeFenceQueryStatus");
         result = pfnQueryStatus( hFence );
+        ZE_PROBE_EXIT(loader, "zeFenceQueryStatus", result);
 
         return result;
     }
@@ -2880,7 +3081,9 @@ namespace loader
         hFence = reinterpret_cast<ze_fence_object_t*>( hFence )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeFenceReset");
         result = pfnReset( hFence );
+        ZE_PROBE_EXIT(loader, "zeFenceReset", result);
 
         return result;
     }
@@ -2906,7 +3109,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeImageGetProperties");
         result = pfnGetProperties( hDevice, desc, pImageProperties );
+        ZE_PROBE_EXIT(loader, "zeImageGetProperties", result);
 
         return result;
     }
@@ -2936,7 +3141,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeImageCreate");
         result = pfnCreate( hContext, hDevice, desc, phImage );
+        ZE_PROBE_EXIT(loader, "zeImageCreate", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -2979,7 +3186,9 @@ namespace loader
         hImage = reinterpret_cast<ze_image_object_t*>( hImage )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeImageDestroy");
         result = pfnDestroy( hImage );
+        ZE_PROBE_EXIT(loader, "zeImageDestroy", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -3020,7 +3229,9 @@ namespace loader
         hDevice = ( hDevice ) ? reinterpret_cast<ze_device_object_t*>( hDevice )->handle : nullptr;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeMemAllocShared");
         result = pfnAllocShared( hContext, device_desc, host_desc, size, alignment, hDevice, pptr );
+        ZE_PROBE_EXIT(loader, "zeMemAllocShared", result);
 
         return result;
     }
@@ -3054,7 +3265,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeMemAllocDevice");
         result = pfnAllocDevice( hContext, device_desc, size, alignment, hDevice, pptr );
+        ZE_PROBE_EXIT(loader, "zeMemAllocDevice", result);
 
         return result;
     }
@@ -3084,7 +3297,9 @@ namespace loader
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeMemAllocHost");
         result = pfnAllocHost( hContext, host_desc, size, alignment, pptr );
+        ZE_PROBE_EXIT(loader, "zeMemAllocHost", result);
 
         return result;
     }
@@ -3109,7 +3324,9 @@ namespace loader
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeMemFree");
         result = pfnFree( hContext, ptr );
+        ZE_PROBE_EXIT(loader, "zeMemFree", result);
 
         return result;
     }
@@ -3136,7 +3353,9 @@ namespace loader
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeMemGetAllocProperties");
         result = pfnGetAllocProperties( hContext, ptr, pMemAllocProperties, phDevice );
+        ZE_PROBE_EXIT(loader, "zeMemGetAllocProperties", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -3178,7 +3397,9 @@ namespace loader
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeMemGetAddressRange");
         result = pfnGetAddressRange( hContext, ptr, pBase, pSize );
+        ZE_PROBE_EXIT(loader, "zeMemGetAddressRange", result);
 
         return result;
     }
@@ -3204,7 +3425,9 @@ namespace loader
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeMemGetIpcHandle");
         result = pfnGetIpcHandle( hContext, ptr, pIpcHandle );
+        ZE_PROBE_EXIT(loader, "zeMemGetIpcHandle", result);
 
         return result;
     }
@@ -3230,7 +3453,9 @@ namespace loader
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeMemGetIpcHandleFromFileDescriptorExp");
         result = pfnGetIpcHandleFromFileDescriptorExp( hContext, handle, pIpcHandle );
+        ZE_PROBE_EXIT(loader, "zeMemGetIpcHandleFromFileDescriptorExp", result);
 
         return result;
     }
@@ -3256,7 +3481,9 @@ namespace loader
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeMemGetFileDescriptorFromIpcHandleExp");
         result = pfnGetFileDescriptorFromIpcHandleExp( hContext, ipcHandle, pHandle );
+        ZE_PROBE_EXIT(loader, "zeMemGetFileDescriptorFromIpcHandleExp", result);
 
         return result;
     }
@@ -3281,7 +3508,9 @@ namespace loader
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeMemPutIpcHandle");
         result = pfnPutIpcHandle( hContext, handle );
+        ZE_PROBE_EXIT(loader, "zeMemPutIpcHandle", result);
 
         return result;
     }
@@ -3313,7 +3542,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeMemOpenIpcHandle");
         result = pfnOpenIpcHandle( hContext, hDevice, handle, flags, pptr );
+        ZE_PROBE_EXIT(loader, "zeMemOpenIpcHandle", result);
 
         return result;
     }
@@ -3338,7 +3569,9 @@ namespace loader
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeMemCloseIpcHandle");
         result = pfnCloseIpcHandle( hContext, ptr );
+        ZE_PROBE_EXIT(loader, "zeMemCloseIpcHandle", result);
 
         return result;
     }
@@ -3370,7 +3603,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeMemSetAtomicAccessAttributeExp");
         result = pfnSetAtomicAccessAttributeExp( hContext, hDevice, ptr, size, attr );
+        ZE_PROBE_EXIT(loader, "zeMemSetAtomicAccessAttributeExp", result);
 
         return result;
     }
@@ -3401,7 +3636,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeMemGetAtomicAccessAttributeExp");
         result = pfnGetAtomicAccessAttributeExp( hContext, hDevice, ptr, size, pAttr );
+        ZE_PROBE_EXIT(loader, "zeMemGetAtomicAccessAttributeExp", result);
 
         return result;
     }
@@ -3432,7 +3669,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeModuleCreate");
         result = pfnCreate( hContext, hDevice, desc, phModule, phBuildLog );
+        ZE_PROBE_EXIT(loader, "zeModuleCreate", result);
 
         try
         {
@@ -3482,7 +3721,9 @@ namespace loader
         hModule = reinterpret_cast<ze_module_object_t*>( hModule )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeModuleDestroy");
         result = pfnDestroy( hModule );
+        ZE_PROBE_EXIT(loader, "zeModuleDestroy", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -3517,7 +3758,9 @@ namespace loader
             phModulesLocal[ i ] = reinterpret_cast<ze_module_object_t*>( phModules[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeModuleDynamicLink");
         result = pfnDynamicLink( numModules, phModulesLocal, phLinkLog );
+        ZE_PROBE_EXIT(loader, "zeModuleDynamicLink", result);
         delete []phModulesLocal;
 
         try
@@ -3557,7 +3800,9 @@ namespace loader
         hModuleBuildLog = reinterpret_cast<ze_module_build_log_object_t*>( hModuleBuildLog )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeModuleBuildLogDestroy");
         result = pfnDestroy( hModuleBuildLog );
+        ZE_PROBE_EXIT(loader, "zeModuleBuildLogDestroy", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -3589,7 +3834,9 @@ namespace loader
         hModuleBuildLog = reinterpret_cast<ze_module_build_log_object_t*>( hModuleBuildLog )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeModuleBuildLogGetString");
         result = pfnGetString( hModuleBuildLog, pSize, pBuildLog );
+        ZE_PROBE_EXIT(loader, "zeModuleBuildLogGetString", result);
 
         return result;
     }
@@ -3615,7 +3862,9 @@ namespace loader
         hModule = reinterpret_cast<ze_module_object_t*>( hModule )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeModuleGetNativeBinary");
         result = pfnGetNativeBinary( hModule, pSize, pModuleNativeBinary );
+        ZE_PROBE_EXIT(loader, "zeModuleGetNativeBinary", result);
 
         return result;
     }
@@ -3642,7 +3891,9 @@ namespace loader
         hModule = reinterpret_cast<ze_module_object_t*>( hModule )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeModuleGetGlobalPointer");
         result = pfnGetGlobalPointer( hModule, pGlobalName, pSize, pptr );
+        ZE_PROBE_EXIT(loader, "zeModuleGetGlobalPointer", result);
 
         return result;
     }
@@ -3674,7 +3925,9 @@ namespace loader
         hModule = reinterpret_cast<ze_module_object_t*>( hModule )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeModuleGetKernelNames");
         result = pfnGetKernelNames( hModule, pCount, pNames );
+        ZE_PROBE_EXIT(loader, "zeModuleGetKernelNames", result);
 
         return result;
     }
@@ -3699,7 +3952,9 @@ namespace loader
         hModule = reinterpret_cast<ze_module_object_t*>( hModule )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeModuleGetProperties");
         result = pfnGetProperties( hModule, pModuleProperties );
+        ZE_PROBE_EXIT(loader, "zeModuleGetProperties", result);
 
         return result;
     }
@@ -3725,7 +3980,9 @@ namespace loader
         hModule = reinterpret_cast<ze_module_object_t*>( hModule )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeKernelCreate");
         result = pfnCreate( hModule, desc, phKernel );
+        ZE_PROBE_EXIT(loader, "zeKernelCreate", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -3763,7 +4020,9 @@ namespace loader
         hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeKernelDestroy");
         result = pfnDestroy( hKernel );
+        ZE_PROBE_EXIT(loader, "zeKernelDestroy", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -3795,7 +4054,9 @@ namespace loader
         hModule = reinterpret_cast<ze_module_object_t*>( hModule )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeModuleGetFunctionPointer");
         result = pfnGetFunctionPointer( hModule, pFunctionName, pfnFunction );
+        ZE_PROBE_EXIT(loader, "zeModuleGetFunctionPointer", result);
 
         return result;
     }
@@ -3822,7 +4083,9 @@ namespace loader
         hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeKernelSetGroupSize");
         result = pfnSetGroupSize( hKernel, groupSizeX, groupSizeY, groupSizeZ );
+        ZE_PROBE_EXIT(loader, "zeKernelSetGroupSize", result);
 
         return result;
     }
@@ -3852,7 +4115,9 @@ namespace loader
         hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeKernelSuggestGroupSize");
         result = pfnSuggestGroupSize( hKernel, globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ );
+        ZE_PROBE_EXIT(loader, "zeKernelSuggestGroupSize", result);
 
         return result;
     }
@@ -3877,7 +4142,9 @@ namespace loader
         hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeKernelSuggestMaxCooperativeGroupCount");
         result = pfnSuggestMaxCooperativeGroupCount( hKernel, totalGroupCount );
+        ZE_PROBE_EXIT(loader, "zeKernelSuggestMaxCooperativeGroupCount", result);
 
         return result;
     }
@@ -3917,7 +4184,9 @@ namespace loader
             }
         }
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeKernelSetArgumentValue");
         result = pfnSetArgumentValue( hKernel, argIndex, argSize, const_cast<const void *>(internalArgValue) );
+        ZE_PROBE_EXIT(loader, "zeKernelSetArgumentValue", result);
 
         return result;
     }
@@ -3942,7 +4211,9 @@ namespace loader
         hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeKernelSetIndirectAccess");
         result = pfnSetIndirectAccess( hKernel, flags );
+        ZE_PROBE_EXIT(loader, "zeKernelSetIndirectAccess", result);
 
         return result;
     }
@@ -3967,7 +4238,9 @@ namespace loader
         hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeKernelGetIndirectAccess");
         result = pfnGetIndirectAccess( hKernel, pFlags );
+        ZE_PROBE_EXIT(loader, "zeKernelGetIndirectAccess", result);
 
         return result;
     }
@@ -4000,7 +4273,9 @@ namespace loader
         hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeKernelGetSourceAttributes");
         result = pfnGetSourceAttributes( hKernel, pSize, pString );
+        ZE_PROBE_EXIT(loader, "zeKernelGetSourceAttributes", result);
 
         return result;
     }
@@ -4026,7 +4301,9 @@ namespace loader
         hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeKernelSetCacheConfig");
         result = pfnSetCacheConfig( hKernel, flags );
+        ZE_PROBE_EXIT(loader, "zeKernelSetCacheConfig", result);
 
         return result;
     }
@@ -4051,7 +4328,9 @@ namespace loader
         hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeKernelGetProperties");
         result = pfnGetProperties( hKernel, pKernelProperties );
+        ZE_PROBE_EXIT(loader, "zeKernelGetProperties", result);
 
         return result;
     }
@@ -4078,7 +4357,9 @@ namespace loader
         hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeKernelGetName");
         result = pfnGetName( hKernel, pSize, pName );
+        ZE_PROBE_EXIT(loader, "zeKernelGetName", result);
 
         return result;
     }
@@ -4120,7 +4401,9 @@ namespace loader
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListAppendLaunchKernel");
         result = pfnAppendLaunchKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEventsLocal );
+        ZE_PROBE_EXIT(loader, "zeCommandListAppendLaunchKernel", result);
         delete []phWaitEventsLocal;
 
         return result;
@@ -4163,7 +4446,9 @@ namespace loader
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListAppendLaunchCooperativeKernel");
         result = pfnAppendLaunchCooperativeKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEventsLocal );
+        ZE_PROBE_EXIT(loader, "zeCommandListAppendLaunchCooperativeKernel", result);
         delete []phWaitEventsLocal;
 
         return result;
@@ -4207,7 +4492,9 @@ namespace loader
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListAppendLaunchKernelIndirect");
         result = pfnAppendLaunchKernelIndirect( hCommandList, hKernel, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEventsLocal );
+        ZE_PROBE_EXIT(loader, "zeCommandListAppendLaunchKernelIndirect", result);
         delete []phWaitEventsLocal;
 
         return result;
@@ -4257,7 +4544,9 @@ namespace loader
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListAppendLaunchMultipleKernelsIndirect");
         result = pfnAppendLaunchMultipleKernelsIndirect( hCommandList, numKernels, phKernelsLocal, pCountBuffer, pLaunchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEventsLocal );
+        ZE_PROBE_EXIT(loader, "zeCommandListAppendLaunchMultipleKernelsIndirect", result);
         delete []phKernelsLocal;
         delete []phWaitEventsLocal;
 
@@ -4289,7 +4578,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeContextMakeMemoryResident");
         result = pfnMakeMemoryResident( hContext, hDevice, ptr, size );
+        ZE_PROBE_EXIT(loader, "zeContextMakeMemoryResident", result);
 
         return result;
     }
@@ -4319,7 +4610,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeContextEvictMemory");
         result = pfnEvictMemory( hContext, hDevice, ptr, size );
+        ZE_PROBE_EXIT(loader, "zeContextEvictMemory", result);
 
         return result;
     }
@@ -4351,7 +4644,9 @@ namespace loader
         hImage = reinterpret_cast<ze_image_object_t*>( hImage )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeContextMakeImageResident");
         result = pfnMakeImageResident( hContext, hDevice, hImage );
+        ZE_PROBE_EXIT(loader, "zeContextMakeImageResident", result);
 
         return result;
     }
@@ -4383,7 +4678,9 @@ namespace loader
         hImage = reinterpret_cast<ze_image_object_t*>( hImage )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeContextEvictImage");
         result = pfnEvictImage( hContext, hDevice, hImage );
+        ZE_PROBE_EXIT(loader, "zeContextEvictImage", result);
 
         return result;
     }
@@ -4413,7 +4710,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeSamplerCreate");
         result = pfnCreate( hContext, hDevice, desc, phSampler );
+        ZE_PROBE_EXIT(loader, "zeSamplerCreate", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -4456,7 +4755,9 @@ namespace loader
         hSampler = reinterpret_cast<ze_sampler_object_t*>( hSampler )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeSamplerDestroy");
         result = pfnDestroy( hSampler );
+        ZE_PROBE_EXIT(loader, "zeSamplerDestroy", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -4490,7 +4791,9 @@ namespace loader
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeVirtualMemReserve");
         result = pfnReserve( hContext, pStart, size, pptr );
+        ZE_PROBE_EXIT(loader, "zeVirtualMemReserve", result);
 
         return result;
     }
@@ -4516,7 +4819,9 @@ namespace loader
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeVirtualMemFree");
         result = pfnFree( hContext, ptr, size );
+        ZE_PROBE_EXIT(loader, "zeVirtualMemFree", result);
 
         return result;
     }
@@ -4547,7 +4852,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeVirtualMemQueryPageSize");
         result = pfnQueryPageSize( hContext, hDevice, size, pagesize );
+        ZE_PROBE_EXIT(loader, "zeVirtualMemQueryPageSize", result);
 
         return result;
     }
@@ -4577,7 +4884,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zePhysicalMemCreate");
         result = pfnCreate( hContext, hDevice, desc, phPhysicalMemory );
+        ZE_PROBE_EXIT(loader, "zePhysicalMemCreate", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -4619,7 +4928,9 @@ namespace loader
         hPhysicalMemory = reinterpret_cast<ze_physical_mem_object_t*>( hPhysicalMemory )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zePhysicalMemDestroy");
         result = pfnDestroy( hContext, hPhysicalMemory );
+        ZE_PROBE_EXIT(loader, "zePhysicalMemDestroy", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -4660,7 +4971,9 @@ namespace loader
         hPhysicalMemory = reinterpret_cast<ze_physical_mem_object_t*>( hPhysicalMemory )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeVirtualMemMap");
         result = pfnMap( hContext, ptr, size, hPhysicalMemory, offset, access );
+        ZE_PROBE_EXIT(loader, "zeVirtualMemMap", result);
 
         return result;
     }
@@ -4686,7 +4999,9 @@ namespace loader
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeVirtualMemUnmap");
         result = pfnUnmap( hContext, ptr, size );
+        ZE_PROBE_EXIT(loader, "zeVirtualMemUnmap", result);
 
         return result;
     }
@@ -4714,7 +5029,9 @@ namespace loader
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeVirtualMemSetAccessAttribute");
         result = pfnSetAccessAttribute( hContext, ptr, size, access );
+        ZE_PROBE_EXIT(loader, "zeVirtualMemSetAccessAttribute", result);
 
         return result;
     }
@@ -4743,7 +5060,9 @@ namespace loader
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeVirtualMemGetAccessAttribute");
         result = pfnGetAccessAttribute( hContext, ptr, size, access, outSize );
+        ZE_PROBE_EXIT(loader, "zeVirtualMemGetAccessAttribute", result);
 
         return result;
     }
@@ -4770,7 +5089,9 @@ namespace loader
         hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeKernelSetGlobalOffsetExp");
         result = pfnSetGlobalOffsetExp( hKernel, offsetX, offsetY, offsetZ );
+        ZE_PROBE_EXIT(loader, "zeKernelSetGlobalOffsetExp", result);
 
         return result;
     }
@@ -4799,7 +5120,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeDeviceReserveCacheExt");
         result = pfnReserveCacheExt( hDevice, cacheLevel, cacheReservationSize );
+        ZE_PROBE_EXIT(loader, "zeDeviceReserveCacheExt", result);
 
         return result;
     }
@@ -4826,7 +5149,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeDeviceSetCacheAdviceExt");
         result = pfnSetCacheAdviceExt( hDevice, ptr, regionSize, cacheRegion );
+        ZE_PROBE_EXIT(loader, "zeDeviceSetCacheAdviceExt", result);
 
         return result;
     }
@@ -4862,7 +5187,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeEventQueryTimestampsExp");
         result = pfnQueryTimestampsExp( hEvent, hDevice, pCount, pTimestamps );
+        ZE_PROBE_EXIT(loader, "zeEventQueryTimestampsExp", result);
 
         return result;
     }
@@ -4887,7 +5214,9 @@ namespace loader
         hImage = reinterpret_cast<ze_image_object_t*>( hImage )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeImageGetMemoryPropertiesExp");
         result = pfnGetMemoryPropertiesExp( hImage, pMemoryProperties );
+        ZE_PROBE_EXIT(loader, "zeImageGetMemoryPropertiesExp", result);
 
         return result;
     }
@@ -4921,7 +5250,9 @@ namespace loader
         hImage = reinterpret_cast<ze_image_object_t*>( hImage )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeImageViewCreateExt");
         result = pfnViewCreateExt( hContext, hDevice, desc, hImage, phImageView );
+        ZE_PROBE_EXIT(loader, "zeImageViewCreateExt", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -4969,7 +5300,9 @@ namespace loader
         hImage = reinterpret_cast<ze_image_object_t*>( hImage )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeImageViewCreateExp");
         result = pfnViewCreateExp( hContext, hDevice, desc, hImage, phImageView );
+        ZE_PROBE_EXIT(loader, "zeImageViewCreateExp", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -5011,7 +5344,9 @@ namespace loader
         hKernel = reinterpret_cast<ze_kernel_object_t*>( hKernel )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeKernelSchedulingHintExp");
         result = pfnSchedulingHintExp( hKernel, pHint );
+        ZE_PROBE_EXIT(loader, "zeKernelSchedulingHintExp", result);
 
         return result;
     }
@@ -5036,7 +5371,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeDevicePciGetPropertiesExt");
         result = pfnPciGetPropertiesExt( hDevice, pPciProperties );
+        ZE_PROBE_EXIT(loader, "zeDevicePciGetPropertiesExt", result);
 
         return result;
     }
@@ -5083,7 +5420,9 @@ namespace loader
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListAppendImageCopyToMemoryExt");
         result = pfnAppendImageCopyToMemoryExt( hCommandList, dstptr, hSrcImage, pSrcRegion, destRowPitch, destSlicePitch, hSignalEvent, numWaitEvents, phWaitEventsLocal );
+        ZE_PROBE_EXIT(loader, "zeCommandListAppendImageCopyToMemoryExt", result);
         delete []phWaitEventsLocal;
 
         return result;
@@ -5131,7 +5470,9 @@ namespace loader
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListAppendImageCopyFromMemoryExt");
         result = pfnAppendImageCopyFromMemoryExt( hCommandList, hDstImage, srcptr, pDstRegion, srcRowPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEventsLocal );
+        ZE_PROBE_EXIT(loader, "zeCommandListAppendImageCopyFromMemoryExt", result);
         delete []phWaitEventsLocal;
 
         return result;
@@ -5161,7 +5502,9 @@ namespace loader
         hImage = reinterpret_cast<ze_image_object_t*>( hImage )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeImageGetAllocPropertiesExt");
         result = pfnGetAllocPropertiesExt( hContext, hImage, pImageAllocProperties );
+        ZE_PROBE_EXIT(loader, "zeImageGetAllocPropertiesExt", result);
 
         return result;
     }
@@ -5192,7 +5535,9 @@ namespace loader
             phModulesLocal[ i ] = reinterpret_cast<ze_module_object_t*>( phModules[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeModuleInspectLinkageExt");
         result = pfnInspectLinkageExt( pInspectDesc, numModules, phModulesLocal, phLog );
+        ZE_PROBE_EXIT(loader, "zeModuleInspectLinkageExt", result);
         delete []phModulesLocal;
 
         if( ZE_RESULT_SUCCESS != result )
@@ -5233,7 +5578,9 @@ namespace loader
         hContext = reinterpret_cast<ze_context_object_t*>( hContext )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeMemFreeExt");
         result = pfnFreeExt( hContext, pMemFreeDesc, ptr );
+        ZE_PROBE_EXIT(loader, "zeMemFreeExt", result);
 
         return result;
     }
@@ -5266,7 +5613,9 @@ namespace loader
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeFabricVertexGetExp");
         result = pfnGetExp( hDriver, pCount, phVertices );
+        ZE_PROBE_EXIT(loader, "zeFabricVertexGetExp", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -5314,7 +5663,9 @@ namespace loader
         hVertex = reinterpret_cast<ze_fabric_vertex_object_t*>( hVertex )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeFabricVertexGetSubVerticesExp");
         result = pfnGetSubVerticesExp( hVertex, pCount, phSubvertices );
+        ZE_PROBE_EXIT(loader, "zeFabricVertexGetSubVerticesExp", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -5354,7 +5705,9 @@ namespace loader
         hVertex = reinterpret_cast<ze_fabric_vertex_object_t*>( hVertex )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeFabricVertexGetPropertiesExp");
         result = pfnGetPropertiesExp( hVertex, pVertexProperties );
+        ZE_PROBE_EXIT(loader, "zeFabricVertexGetPropertiesExp", result);
 
         return result;
     }
@@ -5379,7 +5732,9 @@ namespace loader
         hVertex = reinterpret_cast<ze_fabric_vertex_object_t*>( hVertex )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeFabricVertexGetDeviceExp");
         result = pfnGetDeviceExp( hVertex, phDevice );
+        ZE_PROBE_EXIT(loader, "zeFabricVertexGetDeviceExp", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -5418,7 +5773,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeDeviceGetFabricVertexExp");
         result = pfnGetFabricVertexExp( hDevice, phVertex );
+        ZE_PROBE_EXIT(loader, "zeDeviceGetFabricVertexExp", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -5469,7 +5826,9 @@ namespace loader
         hVertexB = reinterpret_cast<ze_fabric_vertex_object_t*>( hVertexB )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeFabricEdgeGetExp");
         result = pfnGetExp( hVertexA, hVertexB, pCount, phEdges );
+        ZE_PROBE_EXIT(loader, "zeFabricEdgeGetExp", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -5510,7 +5869,9 @@ namespace loader
         hEdge = reinterpret_cast<ze_fabric_edge_object_t*>( hEdge )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeFabricEdgeGetVerticesExp");
         result = pfnGetVerticesExp( hEdge, phVertexA, phVertexB );
+        ZE_PROBE_EXIT(loader, "zeFabricEdgeGetVerticesExp", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -5560,7 +5921,9 @@ namespace loader
         hEdge = reinterpret_cast<ze_fabric_edge_object_t*>( hEdge )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeFabricEdgeGetPropertiesExp");
         result = pfnGetPropertiesExp( hEdge, pEdgeProperties );
+        ZE_PROBE_EXIT(loader, "zeFabricEdgeGetPropertiesExp", result);
 
         return result;
     }
@@ -5603,7 +5966,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeEventQueryKernelTimestampsExt");
         result = pfnQueryKernelTimestampsExt( hEvent, hDevice, pCount, pResults );
+        ZE_PROBE_EXIT(loader, "zeEventQueryKernelTimestampsExt", result);
 
         return result;
     }
@@ -5629,7 +5994,9 @@ namespace loader
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeRTASBuilderCreateExp");
         result = pfnCreateExp( hDriver, pDescriptor, phBuilder );
+        ZE_PROBE_EXIT(loader, "zeRTASBuilderCreateExp", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -5669,7 +6036,9 @@ namespace loader
         hBuilder = reinterpret_cast<ze_rtas_builder_exp_object_t*>( hBuilder )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeRTASBuilderGetBuildPropertiesExp");
         result = pfnGetBuildPropertiesExp( hBuilder, pBuildOpDescriptor, pProperties );
+        ZE_PROBE_EXIT(loader, "zeRTASBuilderGetBuildPropertiesExp", result);
 
         return result;
     }
@@ -5695,7 +6064,9 @@ namespace loader
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeDriverRTASFormatCompatibilityCheckExp");
         result = pfnRTASFormatCompatibilityCheckExp( hDriver, rtasFormatA, rtasFormatB );
+        ZE_PROBE_EXIT(loader, "zeDriverRTASFormatCompatibilityCheckExp", result);
 
         return result;
     }
@@ -5734,7 +6105,9 @@ namespace loader
         hParallelOperation = ( hParallelOperation ) ? reinterpret_cast<ze_rtas_parallel_operation_exp_object_t*>( hParallelOperation )->handle : nullptr;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeRTASBuilderBuildExp");
         result = pfnBuildExp( hBuilder, pBuildOpDescriptor, pScratchBuffer, scratchBufferSizeBytes, pRtasBuffer, rtasBufferSizeBytes, hParallelOperation, pBuildUserPtr, pBounds, pRtasBufferSizeBytes );
+        ZE_PROBE_EXIT(loader, "zeRTASBuilderBuildExp", result);
 
         return result;
     }
@@ -5758,7 +6131,9 @@ namespace loader
         hBuilder = reinterpret_cast<ze_rtas_builder_exp_object_t*>( hBuilder )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeRTASBuilderDestroyExp");
         result = pfnDestroyExp( hBuilder );
+        ZE_PROBE_EXIT(loader, "zeRTASBuilderDestroyExp", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -5789,7 +6164,9 @@ namespace loader
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeRTASParallelOperationCreateExp");
         result = pfnCreateExp( hDriver, phParallelOperation );
+        ZE_PROBE_EXIT(loader, "zeRTASParallelOperationCreateExp", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -5828,7 +6205,9 @@ namespace loader
         hParallelOperation = reinterpret_cast<ze_rtas_parallel_operation_exp_object_t*>( hParallelOperation )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeRTASParallelOperationGetPropertiesExp");
         result = pfnGetPropertiesExp( hParallelOperation, pProperties );
+        ZE_PROBE_EXIT(loader, "zeRTASParallelOperationGetPropertiesExp", result);
 
         return result;
     }
@@ -5852,7 +6231,9 @@ namespace loader
         hParallelOperation = reinterpret_cast<ze_rtas_parallel_operation_exp_object_t*>( hParallelOperation )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeRTASParallelOperationJoinExp");
         result = pfnJoinExp( hParallelOperation );
+        ZE_PROBE_EXIT(loader, "zeRTASParallelOperationJoinExp", result);
 
         return result;
     }
@@ -5876,7 +6257,9 @@ namespace loader
         hParallelOperation = reinterpret_cast<ze_rtas_parallel_operation_exp_object_t*>( hParallelOperation )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeRTASParallelOperationDestroyExp");
         result = pfnDestroyExp( hParallelOperation );
+        ZE_PROBE_EXIT(loader, "zeRTASParallelOperationDestroyExp", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -5914,7 +6297,9 @@ namespace loader
         hDevice = reinterpret_cast<ze_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeMemGetPitchFor2dImage");
         result = pfnGetPitchFor2dImage( hContext, hDevice, imageWidth, imageHeight, elementSizeInBytes, rowPitch );
+        ZE_PROBE_EXIT(loader, "zeMemGetPitchFor2dImage", result);
 
         return result;
     }
@@ -5939,7 +6324,9 @@ namespace loader
         hImage = reinterpret_cast<ze_image_object_t*>( hImage )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeImageGetDeviceOffsetExp");
         result = pfnGetDeviceOffsetExp( hImage, pDeviceOffset );
+        ZE_PROBE_EXIT(loader, "zeImageGetDeviceOffsetExp", result);
 
         return result;
     }
@@ -5964,7 +6351,9 @@ namespace loader
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListCreateCloneExp");
         result = pfnCreateCloneExp( hCommandList, phClonedCommandList );
+        ZE_PROBE_EXIT(loader, "zeCommandListCreateCloneExp", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -6026,7 +6415,9 @@ namespace loader
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListImmediateAppendCommandListsExp");
         result = pfnImmediateAppendCommandListsExp( hCommandListImmediate, numCommandLists, phCommandListsLocal, hSignalEvent, numWaitEvents, phWaitEventsLocal );
+        ZE_PROBE_EXIT(loader, "zeCommandListImmediateAppendCommandListsExp", result);
         delete []phCommandListsLocal;
         delete []phWaitEventsLocal;
 
@@ -6054,7 +6445,9 @@ namespace loader
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListGetNextCommandIdExp");
         result = pfnGetNextCommandIdExp( hCommandList, desc, pCommandId );
+        ZE_PROBE_EXIT(loader, "zeCommandListGetNextCommandIdExp", result);
 
         return result;
     }
@@ -6080,7 +6473,9 @@ namespace loader
         hCommandList = reinterpret_cast<ze_command_list_object_t*>( hCommandList )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListUpdateMutableCommandsExp");
         result = pfnUpdateMutableCommandsExp( hCommandList, desc );
+        ZE_PROBE_EXIT(loader, "zeCommandListUpdateMutableCommandsExp", result);
 
         return result;
     }
@@ -6109,7 +6504,9 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListUpdateMutableCommandSignalEventExp");
         result = pfnUpdateMutableCommandSignalEventExp( hCommandList, commandId, hSignalEvent );
+        ZE_PROBE_EXIT(loader, "zeCommandListUpdateMutableCommandSignalEventExp", result);
 
         return result;
     }
@@ -6142,7 +6539,9 @@ namespace loader
             phWaitEventsLocal[ i ] = reinterpret_cast<ze_event_object_t*>( phWaitEvents[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zeCommandListUpdateMutableCommandWaitEventsExp");
         result = pfnUpdateMutableCommandWaitEventsExp( hCommandList, commandId, numWaitEvents, phWaitEventsLocal );
+        ZE_PROBE_EXIT(loader, "zeCommandListUpdateMutableCommandWaitEventsExp", result);
         delete []phWaitEventsLocal;
 
         return result;
@@ -6216,17 +6615,39 @@ zeGetGlobalProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetGlobalProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetGlobalProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetGlobalProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetGlobalProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_global_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_global_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.Global = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetGlobalProcAddrTable_t>(
@@ -6234,11 +6655,14 @@ zeGetGlobalProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_global_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_global_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.Global;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_global_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.Global = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_global_dditable_t));
         }
     }
 
@@ -6301,17 +6725,39 @@ zeGetRTASBuilderExpProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetRTASBuilderExpProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetRTASBuilderExpProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetRTASBuilderExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetRTASBuilderExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_rtas_builder_exp_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_rtas_builder_exp_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.RTASBuilderExp = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetRTASBuilderExpProcAddrTable_t>(
@@ -6319,11 +6765,14 @@ zeGetRTASBuilderExpProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_rtas_builder_exp_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_rtas_builder_exp_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.RTASBuilderExp;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_rtas_builder_exp_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.RTASBuilderExp = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_rtas_builder_exp_dditable_t));
         }
     }
 
@@ -6386,17 +6835,39 @@ zeGetRTASParallelOperationExpProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetRTASParallelOperationExpProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetRTASParallelOperationExpProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetRTASParallelOperationExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetRTASParallelOperationExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_rtas_parallel_operation_exp_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_rtas_parallel_operation_exp_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.RTASParallelOperationExp = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetRTASParallelOperationExpProcAddrTable_t>(
@@ -6404,11 +6875,14 @@ zeGetRTASParallelOperationExpProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_rtas_parallel_operation_exp_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_rtas_parallel_operation_exp_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.RTASParallelOperationExp;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_rtas_parallel_operation_exp_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.RTASParallelOperationExp = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_rtas_parallel_operation_exp_dditable_t));
         }
     }
 
@@ -6483,17 +6957,39 @@ zeGetDriverProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetDriverProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetDriverProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetDriverProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetDriverProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_driver_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_driver_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.Driver = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetDriverProcAddrTable_t>(
@@ -6501,11 +6997,14 @@ zeGetDriverProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_driver_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_driver_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.Driver;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_driver_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.Driver = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_driver_dditable_t));
         }
     }
 
@@ -6565,17 +7064,39 @@ zeGetDriverExpProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetDriverExpProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetDriverExpProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetDriverExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetDriverExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_driver_exp_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_driver_exp_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.DriverExp = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetDriverExpProcAddrTable_t>(
@@ -6583,11 +7104,14 @@ zeGetDriverExpProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_driver_exp_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_driver_exp_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.DriverExp;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_driver_exp_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.DriverExp = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_driver_exp_dditable_t));
         }
     }
 
@@ -6674,17 +7198,39 @@ zeGetDeviceProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetDeviceProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetDeviceProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetDeviceProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetDeviceProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_device_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_device_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.Device = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetDeviceProcAddrTable_t>(
@@ -6692,11 +7238,14 @@ zeGetDeviceProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_device_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_device_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.Device;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_device_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.Device = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_device_dditable_t));
         }
     }
 
@@ -6756,17 +7305,39 @@ zeGetDeviceExpProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetDeviceExpProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetDeviceExpProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetDeviceExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetDeviceExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_device_exp_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_device_exp_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.DeviceExp = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetDeviceExpProcAddrTable_t>(
@@ -6774,11 +7345,14 @@ zeGetDeviceExpProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_device_exp_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_device_exp_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.DeviceExp;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_device_exp_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.DeviceExp = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_device_exp_dditable_t));
         }
     }
 
@@ -6855,17 +7429,39 @@ zeGetContextProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetContextProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetContextProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetContextProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetContextProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_context_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_context_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.Context = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetContextProcAddrTable_t>(
@@ -6873,11 +7469,14 @@ zeGetContextProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_context_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_context_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.Context;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_context_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.Context = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_context_dditable_t));
         }
     }
 
@@ -6951,17 +7550,39 @@ zeGetCommandQueueProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetCommandQueueProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetCommandQueueProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetCommandQueueProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetCommandQueueProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_command_queue_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_command_queue_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.CommandQueue = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetCommandQueueProcAddrTable_t>(
@@ -6969,11 +7590,14 @@ zeGetCommandQueueProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_command_queue_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_command_queue_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.CommandQueue;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_command_queue_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.CommandQueue = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_command_queue_dditable_t));
         }
     }
 
@@ -7075,17 +7699,39 @@ zeGetCommandListProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetCommandListProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetCommandListProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetCommandListProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetCommandListProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_command_list_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_command_list_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.CommandList = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetCommandListProcAddrTable_t>(
@@ -7093,11 +7739,14 @@ zeGetCommandListProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_command_list_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_command_list_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.CommandList;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_command_list_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.CommandList = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_command_list_dditable_t));
         }
     }
 
@@ -7162,17 +7811,39 @@ zeGetCommandListExpProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetCommandListExpProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetCommandListExpProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetCommandListExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetCommandListExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_command_list_exp_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_command_list_exp_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.CommandListExp = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetCommandListExpProcAddrTable_t>(
@@ -7180,11 +7851,14 @@ zeGetCommandListExpProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_command_list_exp_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_command_list_exp_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.CommandListExp;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_command_list_exp_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.CommandListExp = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_command_list_exp_dditable_t));
         }
     }
 
@@ -7263,17 +7937,39 @@ zeGetEventProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetEventProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetEventProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetEventProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetEventProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_event_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_event_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.Event = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetEventProcAddrTable_t>(
@@ -7281,11 +7977,14 @@ zeGetEventProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_event_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_event_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.Event;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_event_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.Event = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_event_dditable_t));
         }
     }
 
@@ -7345,17 +8044,39 @@ zeGetEventExpProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetEventExpProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetEventExpProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetEventExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetEventExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_event_exp_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_event_exp_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.EventExp = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetEventExpProcAddrTable_t>(
@@ -7363,11 +8084,14 @@ zeGetEventExpProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_event_exp_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_event_exp_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.EventExp;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_event_exp_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.EventExp = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_event_exp_dditable_t));
         }
     }
 
@@ -7443,17 +8167,39 @@ zeGetEventPoolProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetEventPoolProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetEventPoolProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetEventPoolProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetEventPoolProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_event_pool_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_event_pool_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.EventPool = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetEventPoolProcAddrTable_t>(
@@ -7461,11 +8207,14 @@ zeGetEventPoolProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_event_pool_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_event_pool_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.EventPool;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_event_pool_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.EventPool = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_event_pool_dditable_t));
         }
     }
 
@@ -7538,17 +8287,39 @@ zeGetFenceProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetFenceProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetFenceProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetFenceProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetFenceProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_fence_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_fence_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.Fence = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetFenceProcAddrTable_t>(
@@ -7556,11 +8327,14 @@ zeGetFenceProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_fence_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_fence_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.Fence;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_fence_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.Fence = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_fence_dditable_t));
         }
     }
 
@@ -7633,17 +8407,39 @@ zeGetImageProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetImageProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetImageProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetImageProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetImageProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_image_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_image_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.Image = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetImageProcAddrTable_t>(
@@ -7651,11 +8447,14 @@ zeGetImageProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_image_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_image_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.Image;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_image_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.Image = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_image_dditable_t));
         }
     }
 
@@ -7717,17 +8516,39 @@ zeGetImageExpProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetImageExpProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetImageExpProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetImageExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetImageExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_image_exp_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_image_exp_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.ImageExp = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetImageExpProcAddrTable_t>(
@@ -7735,11 +8556,14 @@ zeGetImageExpProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_image_exp_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_image_exp_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.ImageExp;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_image_exp_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.ImageExp = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_image_exp_dditable_t));
         }
     }
 
@@ -7819,17 +8643,39 @@ zeGetKernelProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetKernelProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetKernelProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetKernelProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetKernelProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_kernel_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_kernel_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.Kernel = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetKernelProcAddrTable_t>(
@@ -7837,11 +8683,14 @@ zeGetKernelProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_kernel_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_kernel_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.Kernel;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_kernel_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.Kernel = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_kernel_dditable_t));
         }
     }
 
@@ -7902,17 +8751,39 @@ zeGetKernelExpProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetKernelExpProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetKernelExpProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetKernelExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetKernelExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_kernel_exp_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_kernel_exp_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.KernelExp = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetKernelExpProcAddrTable_t>(
@@ -7920,11 +8791,14 @@ zeGetKernelExpProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_kernel_exp_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_kernel_exp_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.KernelExp;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_kernel_exp_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.KernelExp = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_kernel_exp_dditable_t));
         }
     }
 
@@ -8004,17 +8878,39 @@ zeGetMemProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetMemProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetMemProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetMemProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetMemProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_mem_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_mem_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.Mem = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetMemProcAddrTable_t>(
@@ -8022,11 +8918,14 @@ zeGetMemProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_mem_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_mem_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.Mem;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_mem_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.Mem = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_mem_dditable_t));
         }
     }
 
@@ -8089,17 +8988,39 @@ zeGetMemExpProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetMemExpProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetMemExpProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetMemExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetMemExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_mem_exp_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_mem_exp_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.MemExp = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetMemExpProcAddrTable_t>(
@@ -8107,11 +9028,14 @@ zeGetMemExpProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_mem_exp_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_mem_exp_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.MemExp;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_mem_exp_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.MemExp = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_mem_exp_dditable_t));
         }
     }
 
@@ -8188,17 +9112,39 @@ zeGetModuleProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetModuleProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetModuleProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetModuleProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetModuleProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_module_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_module_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.Module = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetModuleProcAddrTable_t>(
@@ -8206,11 +9152,14 @@ zeGetModuleProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_module_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_module_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.Module;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_module_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.Module = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_module_dditable_t));
         }
     }
 
@@ -8280,17 +9229,39 @@ zeGetModuleBuildLogProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetModuleBuildLogProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetModuleBuildLogProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetModuleBuildLogProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetModuleBuildLogProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_module_build_log_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_module_build_log_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.ModuleBuildLog = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetModuleBuildLogProcAddrTable_t>(
@@ -8298,11 +9269,14 @@ zeGetModuleBuildLogProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_module_build_log_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_module_build_log_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.ModuleBuildLog;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_module_build_log_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.ModuleBuildLog = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_module_build_log_dditable_t));
         }
     }
 
@@ -8372,17 +9346,39 @@ zeGetPhysicalMemProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetPhysicalMemProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetPhysicalMemProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetPhysicalMemProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetPhysicalMemProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_physical_mem_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_physical_mem_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.PhysicalMem = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetPhysicalMemProcAddrTable_t>(
@@ -8390,11 +9386,14 @@ zeGetPhysicalMemProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_physical_mem_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_physical_mem_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.PhysicalMem;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_physical_mem_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.PhysicalMem = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_physical_mem_dditable_t));
         }
     }
 
@@ -8464,17 +9463,39 @@ zeGetSamplerProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetSamplerProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetSamplerProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetSamplerProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetSamplerProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_sampler_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_sampler_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.Sampler = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetSamplerProcAddrTable_t>(
@@ -8482,11 +9503,14 @@ zeGetSamplerProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_sampler_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_sampler_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.Sampler;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_sampler_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.Sampler = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_sampler_dditable_t));
         }
     }
 
@@ -8561,17 +9585,39 @@ zeGetVirtualMemProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetVirtualMemProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetVirtualMemProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetVirtualMemProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetVirtualMemProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_virtual_mem_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_virtual_mem_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.VirtualMem = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetVirtualMemProcAddrTable_t>(
@@ -8579,11 +9625,14 @@ zeGetVirtualMemProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_virtual_mem_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_virtual_mem_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.VirtualMem;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_virtual_mem_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.VirtualMem = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_virtual_mem_dditable_t));
         }
     }
 
@@ -8645,17 +9694,39 @@ zeGetFabricEdgeExpProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetFabricEdgeExpProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetFabricEdgeExpProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetFabricEdgeExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetFabricEdgeExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_fabric_edge_exp_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_fabric_edge_exp_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.FabricEdgeExp = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetFabricEdgeExpProcAddrTable_t>(
@@ -8663,11 +9734,14 @@ zeGetFabricEdgeExpProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_fabric_edge_exp_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_fabric_edge_exp_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.FabricEdgeExp;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_fabric_edge_exp_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.FabricEdgeExp = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_fabric_edge_exp_dditable_t));
         }
     }
 
@@ -8730,17 +9804,39 @@ zeGetFabricVertexExpProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<ze_pfnGetFabricVertexExpProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zeGetFabricVertexExpProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetFabricVertexExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zeGetFabricVertexExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            ze_fabric_vertex_exp_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(ze_fabric_vertex_exp_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.ze.FabricVertexExp = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
     }
 
-    // If the API tracing layer is enabled, then intercept the loader's DDIs
+    // If the API tracing layer is enabled, then intercept the loader's DDIs.
+    // The layer keeps a single table to call into, so a validation layer that
+    // can be enabled at runtime is always below it, with its checks off until
+    // it is enabled.
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->tracingLayer ))
     {
         auto getTable = reinterpret_cast<ze_pfnGetFabricVertexExpProcAddrTable_t>(
@@ -8748,11 +9844,14 @@ zeGetFabricVertexExpProcAddrTable(
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
         ze_fabric_vertex_exp_dditable_t dditable;
-        memcpy(&dditable, pDdiTable, sizeof(ze_fabric_vertex_exp_dditable_t));
+        if ( validationAtRuntime )
+            dditable = loader::context->validation_dditable.ze.FabricVertexExp;
+        else
+            memcpy(&dditable, pDdiTable, sizeof(ze_fabric_vertex_exp_dditable_t));
         result = getTable( version, &dditable );
         loader::context->tracing_dditable.ze.FabricVertexExp = dditable;
         if ( loader::context->tracingLayerEnabled ) {
-            result = getTable( version, pDdiTable );
+            memcpy(pDdiTable, &dditable, sizeof(ze_fabric_vertex_exp_dditable_t));
         }
     }
 
@@ -14,6 +14,7 @@ namespace loader
 {
     ///////////////////////////////////////////////////////////////////////////////
     context_t *context;
+    property_cache_t property_cache;
 
     void context_t::debug_trace_message(std::string message, std::string result) {
         if (zel_logger->log_to_console){
@@ -194,7 +195,7 @@ namespace loader
             return ZE_RESULT_ERROR_UNINITIALIZED;
         }
 
-        if(nullptr != validationLayer) {
+        if(nullptr != validationLayer && validationLayerEnabled) {
             getTable = reinterpret_cast<ze_pfnGetGlobalProcAddrTable_t>(
                 GET_FUNCTION_PTR(validationLayer, "zeGetGlobalProcAddrTable") );
             if(!getTable) {
@@ -336,26 +337,33 @@ namespace loader
         loaderLibraryPath = readLevelZeroLoaderLibraryPath();
 #endif
         typedef ze_result_t (ZE_APICALL *getVersion_t)(zel_component_version_t *version);
+        // With ZEL_ENABLE_RUNTIME_VALIDATION_LAYER the validation layer is
+        // loaded without being enabled, so it can be swapped in at runtime
+        // with zelEnableValidationLayer.
         if( getenv_tobool( "ZE_ENABLE_VALIDATION_LAYER" ) )
         {
             zel_logger->log_info("Validation Layer Enabled");
+            validationLayerEnabled = true;
+        }
+        if( validationLayerEnabled || getenv_tobool( "ZEL_ENABLE_RUNTIME_VALIDATION_LAYER" ) )
+        {
             std::string validationLayerLibraryPath = create_library_path(MAKE_LAYER_NAME( "ze_validation_layer" ), loaderLibraryPath.c_str());
             validationLayer = LOAD_DRIVER_LIBRARY( validationLayerLibraryPath.c_str() );
-            if(validationLayer)
-            {
-                auto getVersion = reinterpret_cast<getVersion_t>(
-                    GET_FUNCTION_PTR(validationLayer, "zelLoaderGetVersion"));
-                zel_component_version_t compVersion;
-                if(getVersion && ZE_RESULT_SUCCESS == getVersion(&compVersion))
-                {   
-                    compVersions.push_back(compVersion);
-                }
-            } else if (debugTraceEnabled) {
-                GET_LIBRARY_ERROR(loadLibraryErrorValue);
-                std::string errorMessage = "Load Library of " + std::string(MAKE_LAYER_NAME( "ze_validation_layer" )) + " failed with ";
-                debug_trace_message(errorMessage, loadLibraryErrorValue);
-                loadLibraryErrorValue.clear();
+        }
+        if(validationLayer && validationLayerEnabled)
+        {
+            auto getVersion = reinterpret_cast<getVersion_t>(
+                GET_FUNCTION_PTR(validationLayer, "zelLoaderGetVersion"));
+            zel_component_version_t compVersion;
+            if(getVersion && ZE_RESULT_SUCCESS == getVersion(&compVersion))
+            {   
+                compVersions.push_back(compVersion);
             }
+        } else if (!validationLayer && validationLayerEnabled && debugTraceEnabled) {
+            GET_LIBRARY_ERROR(loadLibraryErrorValue);
+            std::string errorMessage = "Load Library of " + std::string(MAKE_LAYER_NAME( "ze_validation_layer" )) + " failed with ";
+            debug_trace_message(errorMessage, loadLibraryErrorValue);
+            loadLibraryErrorValue.clear();
         }
 
         if (getenv_tobool( "ZE_ENABLE_TRACING_LAYER" )) {
@@ -380,13 +388,42 @@ namespace loader
             loadLibraryErrorValue.clear();
         }
 
+        if( getenv_tobool( "ZE_ENABLE_OPTIMIZATION_LAYER" ) )
+        {
+            zel_logger->log_info("Optimization Layer Enabled");
+            std::string optimizationLayerLibraryPath = create_library_path(MAKE_LAYER_NAME( "ze_optimization_layer" ), loaderLibraryPath.c_str());
+            optimizationLayer = LOAD_DRIVER_LIBRARY( optimizationLayerLibraryPath.c_str() );
+            if(optimizationLayer)
+            {
+                auto getVersion = reinterpret_cast<getVersion_t>(
+                    GET_FUNCTION_PTR(optimizationLayer, "zelLoaderGetVersion"));
+                zel_component_version_t compVersion;
+                if(getVersion && ZE_RESULT_SUCCESS == getVersion(&compVersion))
+                {
+                    compVersions.push_back(compVersion);
+                }
+            } else if (debugTraceEnabled) {
+                GET_LIBRARY_ERROR(loadLibraryErrorValue);
+                std::string errorMessage = "Load Library of " + std::string(MAKE_LAYER_NAME( "ze_optimization_layer" )) + " failed with ";
+                debug_trace_message(errorMessage, loadLibraryErrorValue);
+                loadLibraryErrorValue.clear();
+            }
+        }
+
         if( getenv_tobool( "ZET_ENABLE_API_TRACING_EXP" ) ) {
             auto depr_msg = "ZET_ENABLE_API_TRACING_EXP is deprecated. Use ZE_ENABLE_TRACING_LAYER instead";
             zel_logger->log_warning(depr_msg);
             std::cout << depr_msg << std::endl;
         }
 
+        // The property cache lives in the loader intercepts, so it turns
+        // them on also with a single driver.
+        propertyCacheEnabled = getenv_tobool( "ZE_ENABLE_LOADER_PROPERTY_CACHE" );
         forceIntercept = getenv_tobool( "ZE_ENABLE_LOADER_INTERCEPT" );
+        if( propertyCacheEnabled && !forceIntercept ) {
+            zel_logger->log_info("ZE_ENABLE_LOADER_PROPERTY_CACHE enables the loader intercepts");
+            forceIntercept = true;
+        }
 
         if(forceIntercept || drivers.size() > 1){
              intercept_enabled = true;
@@ -403,6 +440,20 @@ namespace loader
     context_t::~context_t()
     {
         std::string freeLibraryErrorValue;
+        // Layers are freed from the top of the stack down, as a layer may
+        // call into the layers below it while it is unloaded.
+        if (tracingLayer) {
+            auto free_result = FREE_DRIVER_LIBRARY( tracingLayer );
+            auto failure = FREE_DRIVER_LIBRARY_FAILURE_CHECK(free_result);
+            if (debugTraceEnabled && failure) {
+                GET_LIBRARY_ERROR(freeLibraryErrorValue);
+                if (!freeLibraryErrorValue.empty()) {
+                    std::string errorMessage = "Free Library Failed for ze_tracing_layer with ";
+                    debug_trace_message(errorMessage, freeLibraryErrorValue);
+                    freeLibraryErrorValue.clear();
+                }
+            }
+        }
         if (validationLayer) {
             auto free_result = FREE_DRIVER_LIBRARY( validationLayer );
             auto failure = FREE_DRIVER_LIBRARY_FAILURE_CHECK(free_result);
@@ -415,13 +466,13 @@ namespace loader
                 }
             }
         }
-        if (tracingLayer) {
-            auto free_result = FREE_DRIVER_LIBRARY( tracingLayer );
+        if (optimizationLayer) {
+            auto free_result = FREE_DRIVER_LIBRARY( optimizationLayer );
             auto failure = FREE_DRIVER_LIBRARY_FAILURE_CHECK(free_result);
             if (debugTraceEnabled && failure) {
                 GET_LIBRARY_ERROR(freeLibraryErrorValue);
                 if (!freeLibraryErrorValue.empty()) {
-                    std::string errorMessage = "Free Library Failed for ze_tracing_layer with ";
+                    std::string errorMessage = "Free Library Failed for ze_optimization_layer with ";
                     debug_trace_message(errorMessage, freeLibraryErrorValue);
                     freeLibraryErrorValue.clear();
                 }
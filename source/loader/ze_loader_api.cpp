@@ -60,6 +60,37 @@ zelLoaderTracingLayerInit(std::atomic<ze_dditable_t *> &zeDdiTable, std::atomic<
     return ZE_RESULT_SUCCESS;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Internal function for Setting the ddi tables for the Validation Layer.
+///
+/// The tables are left unset when the layer is not available, or when it is
+/// already part of every call path: it was enabled at init, or the tracing
+/// layer was, which calls into the validation layer.
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelLoaderValidationLayerInit(std::atomic<ze_dditable_t *> &zeDdiTable, std::atomic<zet_dditable_t *> &zetDdiTable, std::atomic<zes_dditable_t *> &zesDdiTable) {
+    if (nullptr == loader::context->validationLayer || loader::context->validationLayerEnabled || loader::context->tracingLayerEnabled)
+        return ZE_RESULT_SUCCESS;
+    zeDdiTable.store(&loader::context->validation_dditable.ze);
+    zetDdiTable.store(&loader::context->validation_dditable.zet);
+    zesDdiTable.store(&loader::context->validation_dditable.zes);
+    return ZE_RESULT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Internal function for selecting the checks of the Validation Layer.
+///
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelLoaderValidationLayerSetChecks(zel_validation_check_flags_t checks) {
+    if (nullptr == loader::context->validationLayer)
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    typedef ze_result_t (ZE_APICALL *setChecks_t)(zel_validation_check_flags_t checks);
+    auto setChecks = reinterpret_cast<setChecks_t>(
+        GET_FUNCTION_PTR(loader::context->validationLayer, "zelValidationLayerSetChecks") );
+    if (nullptr == setChecks)
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    return setChecks(checks);
+}
+
 ZE_DLLEXPORT ze_result_t ZE_APICALL
 zelLoaderGetVersionsInternal(
    size_t *num_elems,                     //Pointer to num versions to get.  
@@ -43,6 +43,21 @@ ZE_DLLEXPORT ze_result_t ZE_APICALL
 zelLoaderTracingLayerInit(std::atomic<ze_dditable_t *> &zeDdiTable, std::atomic<zet_dditable_t *> &zetDdiTable, std::atomic<zes_dditable_t *> &zesDdiTable);
 
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Internal function for Setting the ddi tables for the Validation Layer.
+///
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelLoaderValidationLayerInit(std::atomic<ze_dditable_t *> &zeDdiTable, std::atomic<zet_dditable_t *> &zetDdiTable, std::atomic<zes_dditable_t *> &zesDdiTable);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Internal function for selecting the checks of the Validation Layer.
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_UNSUPPORTED_FEATURE if the validation layer is not available
+ZE_DLLEXPORT ze_result_t ZE_APICALL
+zelLoaderValidationLayerSetChecks(zel_validation_check_flags_t checks);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Exported function for getting tracing lib handle
 ///
@@ -17,6 +17,7 @@
 #include "ze_util.h"
 #include "ze_object.h"
 
+#include "ze_property_cache.h"
 #include "ze_ldrddi.h"
 #include "zet_ldrddi.h"
 #include "zes_ldrddi.h"
@@ -47,6 +48,7 @@ namespace loader
 
         HMODULE validationLayer = nullptr;
         HMODULE tracingLayer = nullptr;
+        HMODULE optimizationLayer = nullptr;
         bool driverEnvironmentQueried = false;
 
         bool forceIntercept = false;
@@ -60,9 +62,12 @@ namespace loader
         void add_loader_version();
         ~context_t();
         bool intercept_enabled = false;
+        bool propertyCacheEnabled = false;
         bool debugTraceEnabled = false;
         bool tracingLayerEnabled = false;
         dditable_t tracing_dditable = {};
+        bool validationLayerEnabled = false;
+        dditable_t validation_dditable = {};
         std::shared_ptr<Logger> zel_logger;
     };
 
@@ -0,0 +1,179 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file ze_property_cache.h
+ *
+ */
+#pragma once
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "ze_api.h"
+#include "zes_api.h"
+
+namespace loader
+{
+    //////////////////////////////////////////////////////////////////////////
+    /// Properties are only answered from the cache for queries without
+    /// extension structures, and are keyed by the structure types the
+    /// caller passed, which select the version of the structure.
+    template<typename T>
+    inline bool isCacheable( const T &properties ) { return nullptr == properties.pNext; }
+    template<typename T>
+    inline uint64_t cacheKey( const T &properties ) { return properties.stype; }
+
+    inline bool isCacheable( const zes_device_properties_t &properties )
+    {
+        return nullptr == properties.pNext && nullptr == properties.core.pNext;
+    }
+    inline uint64_t cacheKey( const zes_device_properties_t &properties )
+    {
+        return ( uint64_t( properties.core.stype ) << 32 ) | properties.stype;
+    }
+
+    /// Key of the number of entries of an array, whatever their type.
+    constexpr uint64_t countOnly = ~uint64_t( 0 );
+
+    //////////////////////////////////////////////////////////////////////////
+    /// Remembers the results of property queries the specification defines
+    /// as constant for the lifetime of the driver, by driver function,
+    /// driver handle and structure types. Queries with extension structures
+    /// are always forwarded to the driver.
+    class __zedlllocal property_cache_t
+    {
+    public:
+        template<typename pfn_t, typename handle_t, typename T>
+        ze_result_t get( pfn_t pfn, handle_t handle, T* pProperties )
+        {
+            if( nullptr == pProperties || !isCacheable( *pProperties ) )
+                return pfn( handle, pProperties );
+
+            key_t key{ reinterpret_cast<const void*>( pfn ), handle, cacheKey( *pProperties ) };
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                auto entry = entries.find( key );
+                if( entry != entries.end() )
+                {
+                    memcpy( pProperties, entry->second.data(), sizeof( T ) );
+                    return ZE_RESULT_SUCCESS;
+                }
+            }
+
+            auto result = pfn( handle, pProperties );
+            if( ZE_RESULT_SUCCESS == result )
+            {
+                auto bytes = reinterpret_cast<const uint8_t*>( pProperties );
+                std::lock_guard<std::mutex> lock( mutex );
+                entries.emplace( key, std::vector<uint8_t>( bytes, bytes + sizeof( T ) ) );
+            }
+            return result;
+        }
+
+        template<typename pfn_t, typename handle_t, typename T>
+        ze_result_t getArray( pfn_t pfn, handle_t handle, uint32_t* pCount, T* pProperties )
+        {
+            if( nullptr == pCount )
+                return pfn( handle, pCount, pProperties );
+
+            key_t countKey{ reinterpret_cast<const void*>( pfn ), handle, countOnly };
+            if( nullptr == pProperties || 0 == *pCount )
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                auto entry = entries.find( countKey );
+                if( entry != entries.end() )
+                {
+                    *pCount = static_cast<uint32_t>( entry->second.size() / sizeof( T ) );
+                    return ZE_RESULT_SUCCESS;
+                }
+            }
+            else
+            {
+                for( uint32_t i = 0; i < *pCount; ++i )
+                    if( !isCacheable( pProperties[ i ] ) || cacheKey( pProperties[ i ] ) != cacheKey( pProperties[ 0 ] ) )
+                        return pfn( handle, pCount, pProperties );
+            }
+
+            // The whole array is cached, whatever part of it was asked for.
+            uint64_t type = ( pProperties && *pCount ) ? cacheKey( pProperties[ 0 ] ) : countOnly;
+            key_t key{ reinterpret_cast<const void*>( pfn ), handle, type };
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                auto entry = entries.find( key );
+                if( entry != entries.end() )
+                    return copyArray( entry->second, pCount, pProperties );
+            }
+
+            std::vector<uint8_t> bytes;
+            {
+                uint32_t count = 0;
+                auto result = pfn( handle, &count, nullptr );
+                if( ZE_RESULT_SUCCESS != result )
+                    return result;
+                std::vector<T> properties( count, T{} );
+                if( count && countOnly != type )
+                {
+                    for( auto& property : properties )
+                        memcpy( &property, &pProperties[ 0 ], sizeof( ze_base_properties_t ) );
+                    result = pfn( handle, &count, properties.data() );
+                    if( ZE_RESULT_SUCCESS != result )
+                        return result;
+                }
+                auto begin = reinterpret_cast<const uint8_t*>( properties.data() );
+                bytes.assign( begin, begin + count * sizeof( T ) );
+
+                std::lock_guard<std::mutex> lock( mutex );
+                entries.emplace( countKey, bytes );
+                entries.emplace( key, bytes );
+            }
+            return copyArray( bytes, pCount, pProperties );
+        }
+
+    private:
+        struct key_t
+        {
+            const void* pfn;
+            const void* handle;
+            uint64_t type;
+
+            bool operator==( const key_t &other ) const
+            {
+                return pfn == other.pfn && handle == other.handle && type == other.type;
+            }
+        };
+
+        struct key_hash_t
+        {
+            size_t operator()( const key_t &key ) const
+            {
+                auto hash = reinterpret_cast<uintptr_t>( key.handle ) * 0x9e3779b97f4a7c15ull;
+                hash ^= reinterpret_cast<uintptr_t>( key.pfn ) + ( hash >> 29 );
+                return static_cast<size_t>( hash ^ ( key.type * 0xff51afd7ed558ccdull ) );
+            }
+        };
+
+        template<typename T>
+        static ze_result_t copyArray( const std::vector<uint8_t> &bytes, uint32_t* pCount, T* pProperties )
+        {
+            auto count = static_cast<uint32_t>( bytes.size() / sizeof( T ) );
+            if( nullptr == pProperties || 0 == *pCount )
+            {
+                *pCount = count;
+                return ZE_RESULT_SUCCESS;
+            }
+            *pCount = std::min( *pCount, count );
+            memcpy( pProperties, bytes.data(), *pCount * sizeof( T ) );
+            return ZE_RESULT_SUCCESS;
+        }
+
+        std::mutex mutex;
+        std::unordered_map<key_t, std::vector<uint8_t>, key_hash_t> entries;
+    };
+
+    extern property_cache_t property_cache;
+}
@@ -8,6 +8,7 @@
  *
  */
 #include "ze_loader_internal.h"
+#include "ze_probes.h"
 
 namespace loader
 {
@@ -42,6 +43,7 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
 
+        ZE_PROBE_ENTRY(loader, "zesInit");
         bool atLeastOneDriverValid = false;
         for( auto& drv : context->drivers )
         {
@@ -54,6 +56,7 @@ namespace loader
 
         if(!atLeastOneDriverValid)
             result=ZE_RESULT_ERROR_UNINITIALIZED;
+        ZE_PROBE_EXIT(loader, "zesInit", result);
 
         return result;
     }
@@ -75,6 +78,7 @@ namespace loader
     {
         ze_result_t result = ZE_RESULT_SUCCESS;
 
+        ZE_PROBE_ENTRY(loader, "zesDriverGet");
         uint32_t total_driver_handle_count = 0;
 
         for( auto& drv : context->drivers )
@@ -117,6 +121,7 @@ namespace loader
 
         if( ZE_RESULT_SUCCESS == result )
             *pCount = total_driver_handle_count;
+        ZE_PROBE_EXIT(loader, "zesDriverGet", result);
 
         return result;
     }
@@ -150,7 +155,9 @@ namespace loader
         hDriver = reinterpret_cast<zes_driver_object_t*>( hDriver )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDriverGetExtensionProperties");
         result = pfnGetExtensionProperties( hDriver, pCount, pExtensionProperties );
+        ZE_PROBE_EXIT(loader, "zesDriverGetExtensionProperties", result);
 
         return result;
     }
@@ -176,7 +183,9 @@ namespace loader
         hDriver = reinterpret_cast<zes_driver_object_t*>( hDriver )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDriverGetExtensionFunctionAddress");
         result = pfnGetExtensionFunctionAddress( hDriver, name, ppFunctionAddress );
+        ZE_PROBE_EXIT(loader, "zesDriverGetExtensionFunctionAddress", result);
 
         return result;
     }
@@ -209,7 +218,9 @@ namespace loader
         hDriver = reinterpret_cast<zes_driver_object_t*>( hDriver )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceGet");
         result = pfnGet( hDriver, pCount, phDevices );
+        ZE_PROBE_EXIT(loader, "zesDeviceGet", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -249,7 +260,12 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
-        result = pfnGetProperties( hDevice, pProperties );
+        ZE_PROBE_ENTRY(loader, "zesDeviceGetProperties");
+        if( context->propertyCacheEnabled )
+            result = property_cache.get( pfnGetProperties, hDevice, pProperties );
+        else
+            result = pfnGetProperties( hDevice, pProperties );
+        ZE_PROBE_EXIT(loader, "zesDeviceGetProperties", result);
 
         return result;
     }
@@ -274,7 +290,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceGetState");
         result = pfnGetState( hDevice, pState );
+        ZE_PROBE_EXIT(loader, "zesDeviceGetState", result);
 
         return result;
     }
@@ -300,7 +318,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceReset");
         result = pfnReset( hDevice, force );
+        ZE_PROBE_EXIT(loader, "zesDeviceReset", result);
 
         return result;
     }
@@ -325,7 +345,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceResetExt");
         result = pfnResetExt( hDevice, pProperties );
+        ZE_PROBE_EXIT(loader, "zesDeviceResetExt", result);
 
         return result;
     }
@@ -359,7 +381,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceProcessesGetState");
         result = pfnProcessesGetState( hDevice, pCount, pProcesses );
+        ZE_PROBE_EXIT(loader, "zesDeviceProcessesGetState", result);
 
         return result;
     }
@@ -384,7 +408,12 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
-        result = pfnPciGetProperties( hDevice, pProperties );
+        ZE_PROBE_ENTRY(loader, "zesDevicePciGetProperties");
+        if( context->propertyCacheEnabled )
+            result = property_cache.get( pfnPciGetProperties, hDevice, pProperties );
+        else
+            result = pfnPciGetProperties( hDevice, pProperties );
+        ZE_PROBE_EXIT(loader, "zesDevicePciGetProperties", result);
 
         return result;
     }
@@ -409,7 +438,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDevicePciGetState");
         result = pfnPciGetState( hDevice, pState );
+        ZE_PROBE_EXIT(loader, "zesDevicePciGetState", result);
 
         return result;
     }
@@ -442,7 +473,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDevicePciGetBars");
         result = pfnPciGetBars( hDevice, pCount, pProperties );
+        ZE_PROBE_EXIT(loader, "zesDevicePciGetBars", result);
 
         return result;
     }
@@ -467,7 +500,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDevicePciGetStats");
         result = pfnPciGetStats( hDevice, pStats );
+        ZE_PROBE_EXIT(loader, "zesDevicePciGetStats", result);
 
         return result;
     }
@@ -491,7 +526,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceSetOverclockWaiver");
         result = pfnSetOverclockWaiver( hDevice );
+        ZE_PROBE_EXIT(loader, "zesDeviceSetOverclockWaiver", result);
 
         return result;
     }
@@ -518,7 +555,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceGetOverclockDomains");
         result = pfnGetOverclockDomains( hDevice, pOverclockDomains );
+        ZE_PROBE_EXIT(loader, "zesDeviceGetOverclockDomains", result);
 
         return result;
     }
@@ -546,7 +585,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceGetOverclockControls");
         result = pfnGetOverclockControls( hDevice, domainType, pAvailableControls );
+        ZE_PROBE_EXIT(loader, "zesDeviceGetOverclockControls", result);
 
         return result;
     }
@@ -572,7 +613,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceResetOverclockSettings");
         result = pfnResetOverclockSettings( hDevice, onShippedState );
+        ZE_PROBE_EXIT(loader, "zesDeviceResetOverclockSettings", result);
 
         return result;
     }
@@ -602,7 +645,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceReadOverclockState");
         result = pfnReadOverclockState( hDevice, pOverclockMode, pWaiverSetting, pOverclockState, pPendingAction, pPendingReset );
+        ZE_PROBE_EXIT(loader, "zesDeviceReadOverclockState", result);
 
         return result;
     }
@@ -637,7 +682,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceEnumOverclockDomains");
         result = pfnEnumOverclockDomains( hDevice, pCount, phDomainHandle );
+        ZE_PROBE_EXIT(loader, "zesDeviceEnumOverclockDomains", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -677,7 +724,9 @@ namespace loader
         hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesOverclockGetDomainProperties");
         result = pfnGetDomainProperties( hDomainHandle, pDomainProperties );
+        ZE_PROBE_EXIT(loader, "zesOverclockGetDomainProperties", result);
 
         return result;
     }
@@ -702,7 +751,9 @@ namespace loader
         hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesOverclockGetDomainVFProperties");
         result = pfnGetDomainVFProperties( hDomainHandle, pVFProperties );
+        ZE_PROBE_EXIT(loader, "zesOverclockGetDomainVFProperties", result);
 
         return result;
     }
@@ -728,7 +779,9 @@ namespace loader
         hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesOverclockGetDomainControlProperties");
         result = pfnGetDomainControlProperties( hDomainHandle, DomainControl, pControlProperties );
+        ZE_PROBE_EXIT(loader, "zesOverclockGetDomainControlProperties", result);
 
         return result;
     }
@@ -754,7 +807,9 @@ namespace loader
         hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesOverclockGetControlCurrentValue");
         result = pfnGetControlCurrentValue( hDomainHandle, DomainControl, pValue );
+        ZE_PROBE_EXIT(loader, "zesOverclockGetControlCurrentValue", result);
 
         return result;
     }
@@ -781,7 +836,9 @@ namespace loader
         hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesOverclockGetControlPendingValue");
         result = pfnGetControlPendingValue( hDomainHandle, DomainControl, pValue );
+        ZE_PROBE_EXIT(loader, "zesOverclockGetControlPendingValue", result);
 
         return result;
     }
@@ -809,7 +866,9 @@ namespace loader
         hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesOverclockSetControlUserValue");
         result = pfnSetControlUserValue( hDomainHandle, DomainControl, pValue, pPendingAction );
+        ZE_PROBE_EXIT(loader, "zesOverclockSetControlUserValue", result);
 
         return result;
     }
@@ -836,7 +895,9 @@ namespace loader
         hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesOverclockGetControlState");
         result = pfnGetControlState( hDomainHandle, DomainControl, pControlState, pPendingAction );
+        ZE_PROBE_EXIT(loader, "zesOverclockGetControlState", result);
 
         return result;
     }
@@ -865,7 +926,9 @@ namespace loader
         hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesOverclockGetVFPointValues");
         result = pfnGetVFPointValues( hDomainHandle, VFType, VFArrayType, PointIndex, PointValue );
+        ZE_PROBE_EXIT(loader, "zesOverclockGetVFPointValues", result);
 
         return result;
     }
@@ -893,7 +956,9 @@ namespace loader
         hDomainHandle = reinterpret_cast<zes_overclock_object_t*>( hDomainHandle )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesOverclockSetVFPointValues");
         result = pfnSetVFPointValues( hDomainHandle, VFType, PointIndex, PointValue );
+        ZE_PROBE_EXIT(loader, "zesOverclockSetVFPointValues", result);
 
         return result;
     }
@@ -928,7 +993,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceEnumDiagnosticTestSuites");
         result = pfnEnumDiagnosticTestSuites( hDevice, pCount, phDiagnostics );
+        ZE_PROBE_EXIT(loader, "zesDeviceEnumDiagnosticTestSuites", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -969,7 +1036,9 @@ namespace loader
         hDiagnostics = reinterpret_cast<zes_diag_object_t*>( hDiagnostics )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDiagnosticsGetProperties");
         result = pfnGetProperties( hDiagnostics, pProperties );
+        ZE_PROBE_EXIT(loader, "zesDiagnosticsGetProperties", result);
 
         return result;
     }
@@ -1002,7 +1071,9 @@ namespace loader
         hDiagnostics = reinterpret_cast<zes_diag_object_t*>( hDiagnostics )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDiagnosticsGetTests");
         result = pfnGetTests( hDiagnostics, pCount, pTests );
+        ZE_PROBE_EXIT(loader, "zesDiagnosticsGetTests", result);
 
         return result;
     }
@@ -1031,7 +1102,9 @@ namespace loader
         hDiagnostics = reinterpret_cast<zes_diag_object_t*>( hDiagnostics )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDiagnosticsRunTests");
         result = pfnRunTests( hDiagnostics, startIndex, endIndex, pResult );
+        ZE_PROBE_EXIT(loader, "zesDiagnosticsRunTests", result);
 
         return result;
     }
@@ -1056,7 +1129,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceEccAvailable");
         result = pfnEccAvailable( hDevice, pAvailable );
+        ZE_PROBE_EXIT(loader, "zesDeviceEccAvailable", result);
 
         return result;
     }
@@ -1081,7 +1156,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceEccConfigurable");
         result = pfnEccConfigurable( hDevice, pConfigurable );
+        ZE_PROBE_EXIT(loader, "zesDeviceEccConfigurable", result);
 
         return result;
     }
@@ -1106,7 +1183,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceGetEccState");
         result = pfnGetEccState( hDevice, pState );
+        ZE_PROBE_EXIT(loader, "zesDeviceGetEccState", result);
 
         return result;
     }
@@ -1132,7 +1211,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceSetEccState");
         result = pfnSetEccState( hDevice, newState, pState );
+        ZE_PROBE_EXIT(loader, "zesDeviceSetEccState", result);
 
         return result;
     }
@@ -1167,7 +1248,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceEnumEngineGroups");
         result = pfnEnumEngineGroups( hDevice, pCount, phEngine );
+        ZE_PROBE_EXIT(loader, "zesDeviceEnumEngineGroups", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -1207,7 +1290,12 @@ namespace loader
         hEngine = reinterpret_cast<zes_engine_object_t*>( hEngine )->handle;
 
         // forward to device-driver
-        result = pfnGetProperties( hEngine, pProperties );
+        ZE_PROBE_ENTRY(loader, "zesEngineGetProperties");
+        if( context->propertyCacheEnabled )
+            result = property_cache.get( pfnGetProperties, hEngine, pProperties );
+        else
+            result = pfnGetProperties( hEngine, pProperties );
+        ZE_PROBE_EXIT(loader, "zesEngineGetProperties", result);
 
         return result;
     }
@@ -1233,7 +1321,9 @@ namespace loader
         hEngine = reinterpret_cast<zes_engine_object_t*>( hEngine )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesEngineGetActivity");
         result = pfnGetActivity( hEngine, pStats );
+        ZE_PROBE_EXIT(loader, "zesEngineGetActivity", result);
 
         return result;
     }
@@ -1258,7 +1348,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceEventRegister");
         result = pfnEventRegister( hDevice, events );
+        ZE_PROBE_EXIT(loader, "zesDeviceEventRegister", result);
 
         return result;
     }
@@ -1304,7 +1396,9 @@ namespace loader
             phDevicesLocal[ i ] = reinterpret_cast<zes_device_object_t*>( phDevices[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDriverEventListen");
         result = pfnEventListen( hDriver, timeout, count, phDevicesLocal, pNumDeviceEvents, pEvents );
+        ZE_PROBE_EXIT(loader, "zesDriverEventListen", result);
         delete []phDevicesLocal;
 
         return result;
@@ -1351,7 +1445,9 @@ namespace loader
             phDevicesLocal[ i ] = reinterpret_cast<zes_device_object_t*>( phDevices[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDriverEventListenEx");
         result = pfnEventListenEx( hDriver, timeout, count, phDevicesLocal, pNumDeviceEvents, pEvents );
+        ZE_PROBE_EXIT(loader, "zesDriverEventListenEx", result);
         delete []phDevicesLocal;
 
         return result;
@@ -1387,7 +1483,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceEnumFabricPorts");
         result = pfnEnumFabricPorts( hDevice, pCount, phPort );
+        ZE_PROBE_EXIT(loader, "zesDeviceEnumFabricPorts", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -1427,7 +1525,9 @@ namespace loader
         hPort = reinterpret_cast<zes_fabric_port_object_t*>( hPort )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFabricPortGetProperties");
         result = pfnGetProperties( hPort, pProperties );
+        ZE_PROBE_EXIT(loader, "zesFabricPortGetProperties", result);
 
         return result;
     }
@@ -1453,7 +1553,9 @@ namespace loader
         hPort = reinterpret_cast<zes_fabric_port_object_t*>( hPort )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFabricPortGetLinkType");
         result = pfnGetLinkType( hPort, pLinkType );
+        ZE_PROBE_EXIT(loader, "zesFabricPortGetLinkType", result);
 
         return result;
     }
@@ -1478,7 +1580,9 @@ namespace loader
         hPort = reinterpret_cast<zes_fabric_port_object_t*>( hPort )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFabricPortGetConfig");
         result = pfnGetConfig( hPort, pConfig );
+        ZE_PROBE_EXIT(loader, "zesFabricPortGetConfig", result);
 
         return result;
     }
@@ -1503,7 +1607,9 @@ namespace loader
         hPort = reinterpret_cast<zes_fabric_port_object_t*>( hPort )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFabricPortSetConfig");
         result = pfnSetConfig( hPort, pConfig );
+        ZE_PROBE_EXIT(loader, "zesFabricPortSetConfig", result);
 
         return result;
     }
@@ -1528,7 +1634,9 @@ namespace loader
         hPort = reinterpret_cast<zes_fabric_port_object_t*>( hPort )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFabricPortGetState");
         result = pfnGetState( hPort, pState );
+        ZE_PROBE_EXIT(loader, "zesFabricPortGetState", result);
 
         return result;
     }
@@ -1553,7 +1661,9 @@ namespace loader
         hPort = reinterpret_cast<zes_fabric_port_object_t*>( hPort )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFabricPortGetThroughput");
         result = pfnGetThroughput( hPort, pThroughput );
+        ZE_PROBE_EXIT(loader, "zesFabricPortGetThroughput", result);
 
         return result;
     }
@@ -1578,7 +1688,9 @@ namespace loader
         hPort = reinterpret_cast<zes_fabric_port_object_t*>( hPort )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFabricPortGetFabricErrorCounters");
         result = pfnGetFabricErrorCounters( hPort, pErrors );
+        ZE_PROBE_EXIT(loader, "zesFabricPortGetFabricErrorCounters", result);
 
         return result;
     }
@@ -1612,7 +1724,9 @@ namespace loader
             phPortLocal[ i ] = reinterpret_cast<zes_fabric_port_object_t*>( phPort[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFabricPortGetMultiPortThroughput");
         result = pfnGetMultiPortThroughput( hDevice, numPorts, phPortLocal, pThroughput );
+        ZE_PROBE_EXIT(loader, "zesFabricPortGetMultiPortThroughput", result);
         delete []phPortLocal;
 
         return result;
@@ -1648,7 +1762,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceEnumFans");
         result = pfnEnumFans( hDevice, pCount, phFan );
+        ZE_PROBE_EXIT(loader, "zesDeviceEnumFans", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -1688,7 +1804,9 @@ namespace loader
         hFan = reinterpret_cast<zes_fan_object_t*>( hFan )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFanGetProperties");
         result = pfnGetProperties( hFan, pProperties );
+        ZE_PROBE_EXIT(loader, "zesFanGetProperties", result);
 
         return result;
     }
@@ -1713,7 +1831,9 @@ namespace loader
         hFan = reinterpret_cast<zes_fan_object_t*>( hFan )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFanGetConfig");
         result = pfnGetConfig( hFan, pConfig );
+        ZE_PROBE_EXIT(loader, "zesFanGetConfig", result);
 
         return result;
     }
@@ -1737,7 +1857,9 @@ namespace loader
         hFan = reinterpret_cast<zes_fan_object_t*>( hFan )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFanSetDefaultMode");
         result = pfnSetDefaultMode( hFan );
+        ZE_PROBE_EXIT(loader, "zesFanSetDefaultMode", result);
 
         return result;
     }
@@ -1762,7 +1884,9 @@ namespace loader
         hFan = reinterpret_cast<zes_fan_object_t*>( hFan )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFanSetFixedSpeedMode");
         result = pfnSetFixedSpeedMode( hFan, speed );
+        ZE_PROBE_EXIT(loader, "zesFanSetFixedSpeedMode", result);
 
         return result;
     }
@@ -1787,7 +1911,9 @@ namespace loader
         hFan = reinterpret_cast<zes_fan_object_t*>( hFan )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFanSetSpeedTableMode");
         result = pfnSetSpeedTableMode( hFan, speedTable );
+        ZE_PROBE_EXIT(loader, "zesFanSetSpeedTableMode", result);
 
         return result;
     }
@@ -1815,7 +1941,9 @@ namespace loader
         hFan = reinterpret_cast<zes_fan_object_t*>( hFan )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFanGetState");
         result = pfnGetState( hFan, units, pSpeed );
+        ZE_PROBE_EXIT(loader, "zesFanGetState", result);
 
         return result;
     }
@@ -1850,7 +1978,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceEnumFirmwares");
         result = pfnEnumFirmwares( hDevice, pCount, phFirmware );
+        ZE_PROBE_EXIT(loader, "zesDeviceEnumFirmwares", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -1891,7 +2021,9 @@ namespace loader
         hFirmware = reinterpret_cast<zes_firmware_object_t*>( hFirmware )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFirmwareGetProperties");
         result = pfnGetProperties( hFirmware, pProperties );
+        ZE_PROBE_EXIT(loader, "zesFirmwareGetProperties", result);
 
         return result;
     }
@@ -1917,7 +2049,9 @@ namespace loader
         hFirmware = reinterpret_cast<zes_firmware_object_t*>( hFirmware )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFirmwareFlash");
         result = pfnFlash( hFirmware, pImage, size );
+        ZE_PROBE_EXIT(loader, "zesFirmwareFlash", result);
 
         return result;
     }
@@ -1942,7 +2076,9 @@ namespace loader
         hFirmware = reinterpret_cast<zes_firmware_object_t*>( hFirmware )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFirmwareGetFlashProgress");
         result = pfnGetFlashProgress( hFirmware, pCompletionPercent );
+        ZE_PROBE_EXIT(loader, "zesFirmwareGetFlashProgress", result);
 
         return result;
     }
@@ -1968,7 +2104,9 @@ namespace loader
         hFirmware = reinterpret_cast<zes_firmware_object_t*>( hFirmware )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFirmwareGetConsoleLogs");
         result = pfnGetConsoleLogs( hFirmware, pSize, pFirmwareLog );
+        ZE_PROBE_EXIT(loader, "zesFirmwareGetConsoleLogs", result);
 
         return result;
     }
@@ -2003,7 +2141,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceEnumFrequencyDomains");
         result = pfnEnumFrequencyDomains( hDevice, pCount, phFrequency );
+        ZE_PROBE_EXIT(loader, "zesDeviceEnumFrequencyDomains", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -2043,7 +2183,12 @@ namespace loader
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
         // forward to device-driver
-        result = pfnGetProperties( hFrequency, pProperties );
+        ZE_PROBE_ENTRY(loader, "zesFrequencyGetProperties");
+        if( context->propertyCacheEnabled )
+            result = property_cache.get( pfnGetProperties, hFrequency, pProperties );
+        else
+            result = pfnGetProperties( hFrequency, pProperties );
+        ZE_PROBE_EXIT(loader, "zesFrequencyGetProperties", result);
 
         return result;
     }
@@ -2076,7 +2221,9 @@ namespace loader
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFrequencyGetAvailableClocks");
         result = pfnGetAvailableClocks( hFrequency, pCount, phFrequency );
+        ZE_PROBE_EXIT(loader, "zesFrequencyGetAvailableClocks", result);
 
         return result;
     }
@@ -2102,7 +2249,9 @@ namespace loader
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFrequencyGetRange");
         result = pfnGetRange( hFrequency, pLimits );
+        ZE_PROBE_EXIT(loader, "zesFrequencyGetRange", result);
 
         return result;
     }
@@ -2128,7 +2277,9 @@ namespace loader
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFrequencySetRange");
         result = pfnSetRange( hFrequency, pLimits );
+        ZE_PROBE_EXIT(loader, "zesFrequencySetRange", result);
 
         return result;
     }
@@ -2153,7 +2304,9 @@ namespace loader
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFrequencyGetState");
         result = pfnGetState( hFrequency, pState );
+        ZE_PROBE_EXIT(loader, "zesFrequencyGetState", result);
 
         return result;
     }
@@ -2179,7 +2332,9 @@ namespace loader
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFrequencyGetThrottleTime");
         result = pfnGetThrottleTime( hFrequency, pThrottleTime );
+        ZE_PROBE_EXIT(loader, "zesFrequencyGetThrottleTime", result);
 
         return result;
     }
@@ -2204,7 +2359,9 @@ namespace loader
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFrequencyOcGetCapabilities");
         result = pfnOcGetCapabilities( hFrequency, pOcCapabilities );
+        ZE_PROBE_EXIT(loader, "zesFrequencyOcGetCapabilities", result);
 
         return result;
     }
@@ -2232,7 +2389,9 @@ namespace loader
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFrequencyOcGetFrequencyTarget");
         result = pfnOcGetFrequencyTarget( hFrequency, pCurrentOcFrequency );
+        ZE_PROBE_EXIT(loader, "zesFrequencyOcGetFrequencyTarget", result);
 
         return result;
     }
@@ -2260,7 +2419,9 @@ namespace loader
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFrequencyOcSetFrequencyTarget");
         result = pfnOcSetFrequencyTarget( hFrequency, CurrentOcFrequency );
+        ZE_PROBE_EXIT(loader, "zesFrequencyOcSetFrequencyTarget", result);
 
         return result;
     }
@@ -2290,7 +2451,9 @@ namespace loader
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFrequencyOcGetVoltageTarget");
         result = pfnOcGetVoltageTarget( hFrequency, pCurrentVoltageTarget, pCurrentVoltageOffset );
+        ZE_PROBE_EXIT(loader, "zesFrequencyOcGetVoltageTarget", result);
 
         return result;
     }
@@ -2320,7 +2483,9 @@ namespace loader
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFrequencyOcSetVoltageTarget");
         result = pfnOcSetVoltageTarget( hFrequency, CurrentVoltageTarget, CurrentVoltageOffset );
+        ZE_PROBE_EXIT(loader, "zesFrequencyOcSetVoltageTarget", result);
 
         return result;
     }
@@ -2345,7 +2510,9 @@ namespace loader
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFrequencyOcSetMode");
         result = pfnOcSetMode( hFrequency, CurrentOcMode );
+        ZE_PROBE_EXIT(loader, "zesFrequencyOcSetMode", result);
 
         return result;
     }
@@ -2370,7 +2537,9 @@ namespace loader
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFrequencyOcGetMode");
         result = pfnOcGetMode( hFrequency, pCurrentOcMode );
+        ZE_PROBE_EXIT(loader, "zesFrequencyOcGetMode", result);
 
         return result;
     }
@@ -2396,7 +2565,9 @@ namespace loader
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFrequencyOcGetIccMax");
         result = pfnOcGetIccMax( hFrequency, pOcIccMax );
+        ZE_PROBE_EXIT(loader, "zesFrequencyOcGetIccMax", result);
 
         return result;
     }
@@ -2421,7 +2592,9 @@ namespace loader
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFrequencyOcSetIccMax");
         result = pfnOcSetIccMax( hFrequency, ocIccMax );
+        ZE_PROBE_EXIT(loader, "zesFrequencyOcSetIccMax", result);
 
         return result;
     }
@@ -2447,7 +2620,9 @@ namespace loader
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFrequencyOcGetTjMax");
         result = pfnOcGetTjMax( hFrequency, pOcTjMax );
+        ZE_PROBE_EXIT(loader, "zesFrequencyOcGetTjMax", result);
 
         return result;
     }
@@ -2472,7 +2647,9 @@ namespace loader
         hFrequency = reinterpret_cast<zes_freq_object_t*>( hFrequency )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFrequencyOcSetTjMax");
         result = pfnOcSetTjMax( hFrequency, ocTjMax );
+        ZE_PROBE_EXIT(loader, "zesFrequencyOcSetTjMax", result);
 
         return result;
     }
@@ -2507,7 +2684,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceEnumLeds");
         result = pfnEnumLeds( hDevice, pCount, phLed );
+        ZE_PROBE_EXIT(loader, "zesDeviceEnumLeds", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -2547,7 +2726,9 @@ namespace loader
         hLed = reinterpret_cast<zes_led_object_t*>( hLed )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesLedGetProperties");
         result = pfnGetProperties( hLed, pProperties );
+        ZE_PROBE_EXIT(loader, "zesLedGetProperties", result);
 
         return result;
     }
@@ -2572,7 +2753,9 @@ namespace loader
         hLed = reinterpret_cast<zes_led_object_t*>( hLed )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesLedGetState");
         result = pfnGetState( hLed, pState );
+        ZE_PROBE_EXIT(loader, "zesLedGetState", result);
 
         return result;
     }
@@ -2597,7 +2780,9 @@ namespace loader
         hLed = reinterpret_cast<zes_led_object_t*>( hLed )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesLedSetState");
         result = pfnSetState( hLed, enable );
+        ZE_PROBE_EXIT(loader, "zesLedSetState", result);
 
         return result;
     }
@@ -2622,7 +2807,9 @@ namespace loader
         hLed = reinterpret_cast<zes_led_object_t*>( hLed )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesLedSetColor");
         result = pfnSetColor( hLed, pColor );
+        ZE_PROBE_EXIT(loader, "zesLedSetColor", result);
 
         return result;
     }
@@ -2657,7 +2844,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceEnumMemoryModules");
         result = pfnEnumMemoryModules( hDevice, pCount, phMemory );
+        ZE_PROBE_EXIT(loader, "zesDeviceEnumMemoryModules", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -2697,7 +2886,12 @@ namespace loader
         hMemory = reinterpret_cast<zes_mem_object_t*>( hMemory )->handle;
 
         // forward to device-driver
-        result = pfnGetProperties( hMemory, pProperties );
+        ZE_PROBE_ENTRY(loader, "zesMemoryGetProperties");
+        if( context->propertyCacheEnabled )
+            result = property_cache.get( pfnGetProperties, hMemory, pProperties );
+        else
+            result = pfnGetProperties( hMemory, pProperties );
+        ZE_PROBE_EXIT(loader, "zesMemoryGetProperties", result);
 
         return result;
     }
@@ -2722,7 +2916,9 @@ namespace loader
         hMemory = reinterpret_cast<zes_mem_object_t*>( hMemory )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesMemoryGetState");
         result = pfnGetState( hMemory, pState );
+        ZE_PROBE_EXIT(loader, "zesMemoryGetState", result);
 
         return result;
     }
@@ -2748,7 +2944,9 @@ namespace loader
         hMemory = reinterpret_cast<zes_mem_object_t*>( hMemory )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesMemoryGetBandwidth");
         result = pfnGetBandwidth( hMemory, pBandwidth );
+        ZE_PROBE_EXIT(loader, "zesMemoryGetBandwidth", result);
 
         return result;
     }
@@ -2783,7 +2981,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceEnumPerformanceFactorDomains");
         result = pfnEnumPerformanceFactorDomains( hDevice, pCount, phPerf );
+        ZE_PROBE_EXIT(loader, "zesDeviceEnumPerformanceFactorDomains", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -2824,7 +3024,9 @@ namespace loader
         hPerf = reinterpret_cast<zes_perf_object_t*>( hPerf )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesPerformanceFactorGetProperties");
         result = pfnGetProperties( hPerf, pProperties );
+        ZE_PROBE_EXIT(loader, "zesPerformanceFactorGetProperties", result);
 
         return result;
     }
@@ -2850,7 +3052,9 @@ namespace loader
         hPerf = reinterpret_cast<zes_perf_object_t*>( hPerf )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesPerformanceFactorGetConfig");
         result = pfnGetConfig( hPerf, pFactor );
+        ZE_PROBE_EXIT(loader, "zesPerformanceFactorGetConfig", result);
 
         return result;
     }
@@ -2875,7 +3079,9 @@ namespace loader
         hPerf = reinterpret_cast<zes_perf_object_t*>( hPerf )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesPerformanceFactorSetConfig");
         result = pfnSetConfig( hPerf, factor );
+        ZE_PROBE_EXIT(loader, "zesPerformanceFactorSetConfig", result);
 
         return result;
     }
@@ -2910,7 +3116,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceEnumPowerDomains");
         result = pfnEnumPowerDomains( hDevice, pCount, phPower );
+        ZE_PROBE_EXIT(loader, "zesDeviceEnumPowerDomains", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -2950,7 +3158,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceGetCardPowerDomain");
         result = pfnGetCardPowerDomain( hDevice, phPower );
+        ZE_PROBE_EXIT(loader, "zesDeviceGetCardPowerDomain", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -2989,7 +3199,12 @@ namespace loader
         hPower = reinterpret_cast<zes_pwr_object_t*>( hPower )->handle;
 
         // forward to device-driver
-        result = pfnGetProperties( hPower, pProperties );
+        ZE_PROBE_ENTRY(loader, "zesPowerGetProperties");
+        if( context->propertyCacheEnabled )
+            result = property_cache.get( pfnGetProperties, hPower, pProperties );
+        else
+            result = pfnGetProperties( hPower, pProperties );
+        ZE_PROBE_EXIT(loader, "zesPowerGetProperties", result);
 
         return result;
     }
@@ -3015,7 +3230,9 @@ namespace loader
         hPower = reinterpret_cast<zes_pwr_object_t*>( hPower )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesPowerGetEnergyCounter");
         result = pfnGetEnergyCounter( hPower, pEnergy );
+        ZE_PROBE_EXIT(loader, "zesPowerGetEnergyCounter", result);
 
         return result;
     }
@@ -3045,7 +3262,9 @@ namespace loader
         hPower = reinterpret_cast<zes_pwr_object_t*>( hPower )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesPowerGetLimits");
         result = pfnGetLimits( hPower, pSustained, pBurst, pPeak );
+        ZE_PROBE_EXIT(loader, "zesPowerGetLimits", result);
 
         return result;
     }
@@ -3075,7 +3294,9 @@ namespace loader
         hPower = reinterpret_cast<zes_pwr_object_t*>( hPower )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesPowerSetLimits");
         result = pfnSetLimits( hPower, pSustained, pBurst, pPeak );
+        ZE_PROBE_EXIT(loader, "zesPowerSetLimits", result);
 
         return result;
     }
@@ -3101,7 +3322,9 @@ namespace loader
         hPower = reinterpret_cast<zes_pwr_object_t*>( hPower )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesPowerGetEnergyThreshold");
         result = pfnGetEnergyThreshold( hPower, pThreshold );
+        ZE_PROBE_EXIT(loader, "zesPowerGetEnergyThreshold", result);
 
         return result;
     }
@@ -3126,7 +3349,9 @@ namespace loader
         hPower = reinterpret_cast<zes_pwr_object_t*>( hPower )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesPowerSetEnergyThreshold");
         result = pfnSetEnergyThreshold( hPower, threshold );
+        ZE_PROBE_EXIT(loader, "zesPowerSetEnergyThreshold", result);
 
         return result;
     }
@@ -3161,7 +3386,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceEnumPsus");
         result = pfnEnumPsus( hDevice, pCount, phPsu );
+        ZE_PROBE_EXIT(loader, "zesDeviceEnumPsus", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -3201,7 +3428,9 @@ namespace loader
         hPsu = reinterpret_cast<zes_psu_object_t*>( hPsu )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesPsuGetProperties");
         result = pfnGetProperties( hPsu, pProperties );
+        ZE_PROBE_EXIT(loader, "zesPsuGetProperties", result);
 
         return result;
     }
@@ -3226,7 +3455,9 @@ namespace loader
         hPsu = reinterpret_cast<zes_psu_object_t*>( hPsu )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesPsuGetState");
         result = pfnGetState( hPsu, pState );
+        ZE_PROBE_EXIT(loader, "zesPsuGetState", result);
 
         return result;
     }
@@ -3261,7 +3492,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceEnumRasErrorSets");
         result = pfnEnumRasErrorSets( hDevice, pCount, phRas );
+        ZE_PROBE_EXIT(loader, "zesDeviceEnumRasErrorSets", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -3301,7 +3534,9 @@ namespace loader
         hRas = reinterpret_cast<zes_ras_object_t*>( hRas )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesRasGetProperties");
         result = pfnGetProperties( hRas, pProperties );
+        ZE_PROBE_EXIT(loader, "zesRasGetProperties", result);
 
         return result;
     }
@@ -3327,7 +3562,9 @@ namespace loader
         hRas = reinterpret_cast<zes_ras_object_t*>( hRas )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesRasGetConfig");
         result = pfnGetConfig( hRas, pConfig );
+        ZE_PROBE_EXIT(loader, "zesRasGetConfig", result);
 
         return result;
     }
@@ -3352,7 +3589,9 @@ namespace loader
         hRas = reinterpret_cast<zes_ras_object_t*>( hRas )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesRasSetConfig");
         result = pfnSetConfig( hRas, pConfig );
+        ZE_PROBE_EXIT(loader, "zesRasSetConfig", result);
 
         return result;
     }
@@ -3378,7 +3617,9 @@ namespace loader
         hRas = reinterpret_cast<zes_ras_object_t*>( hRas )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesRasGetState");
         result = pfnGetState( hRas, clear, pState );
+        ZE_PROBE_EXIT(loader, "zesRasGetState", result);
 
         return result;
     }
@@ -3413,7 +3654,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceEnumSchedulers");
         result = pfnEnumSchedulers( hDevice, pCount, phScheduler );
+        ZE_PROBE_EXIT(loader, "zesDeviceEnumSchedulers", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -3453,7 +3696,9 @@ namespace loader
         hScheduler = reinterpret_cast<zes_sched_object_t*>( hScheduler )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesSchedulerGetProperties");
         result = pfnGetProperties( hScheduler, pProperties );
+        ZE_PROBE_EXIT(loader, "zesSchedulerGetProperties", result);
 
         return result;
     }
@@ -3478,7 +3723,9 @@ namespace loader
         hScheduler = reinterpret_cast<zes_sched_object_t*>( hScheduler )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesSchedulerGetCurrentMode");
         result = pfnGetCurrentMode( hScheduler, pMode );
+        ZE_PROBE_EXIT(loader, "zesSchedulerGetCurrentMode", result);
 
         return result;
     }
@@ -3505,7 +3752,9 @@ namespace loader
         hScheduler = reinterpret_cast<zes_sched_object_t*>( hScheduler )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesSchedulerGetTimeoutModeProperties");
         result = pfnGetTimeoutModeProperties( hScheduler, getDefaults, pConfig );
+        ZE_PROBE_EXIT(loader, "zesSchedulerGetTimeoutModeProperties", result);
 
         return result;
     }
@@ -3532,7 +3781,9 @@ namespace loader
         hScheduler = reinterpret_cast<zes_sched_object_t*>( hScheduler )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesSchedulerGetTimesliceModeProperties");
         result = pfnGetTimesliceModeProperties( hScheduler, getDefaults, pConfig );
+        ZE_PROBE_EXIT(loader, "zesSchedulerGetTimesliceModeProperties", result);
 
         return result;
     }
@@ -3559,7 +3810,9 @@ namespace loader
         hScheduler = reinterpret_cast<zes_sched_object_t*>( hScheduler )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesSchedulerSetTimeoutMode");
         result = pfnSetTimeoutMode( hScheduler, pProperties, pNeedReload );
+        ZE_PROBE_EXIT(loader, "zesSchedulerSetTimeoutMode", result);
 
         return result;
     }
@@ -3586,7 +3839,9 @@ namespace loader
         hScheduler = reinterpret_cast<zes_sched_object_t*>( hScheduler )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesSchedulerSetTimesliceMode");
         result = pfnSetTimesliceMode( hScheduler, pProperties, pNeedReload );
+        ZE_PROBE_EXIT(loader, "zesSchedulerSetTimesliceMode", result);
 
         return result;
     }
@@ -3612,7 +3867,9 @@ namespace loader
         hScheduler = reinterpret_cast<zes_sched_object_t*>( hScheduler )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesSchedulerSetExclusiveMode");
         result = pfnSetExclusiveMode( hScheduler, pNeedReload );
+        ZE_PROBE_EXIT(loader, "zesSchedulerSetExclusiveMode", result);
 
         return result;
     }
@@ -3638,7 +3895,9 @@ namespace loader
         hScheduler = reinterpret_cast<zes_sched_object_t*>( hScheduler )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesSchedulerSetComputeUnitDebugMode");
         result = pfnSetComputeUnitDebugMode( hScheduler, pNeedReload );
+        ZE_PROBE_EXIT(loader, "zesSchedulerSetComputeUnitDebugMode", result);
 
         return result;
     }
@@ -3673,7 +3932,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceEnumStandbyDomains");
         result = pfnEnumStandbyDomains( hDevice, pCount, phStandby );
+        ZE_PROBE_EXIT(loader, "zesDeviceEnumStandbyDomains", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -3713,7 +3974,9 @@ namespace loader
         hStandby = reinterpret_cast<zes_standby_object_t*>( hStandby )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesStandbyGetProperties");
         result = pfnGetProperties( hStandby, pProperties );
+        ZE_PROBE_EXIT(loader, "zesStandbyGetProperties", result);
 
         return result;
     }
@@ -3738,7 +4001,9 @@ namespace loader
         hStandby = reinterpret_cast<zes_standby_object_t*>( hStandby )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesStandbyGetMode");
         result = pfnGetMode( hStandby, pMode );
+        ZE_PROBE_EXIT(loader, "zesStandbyGetMode", result);
 
         return result;
     }
@@ -3763,7 +4028,9 @@ namespace loader
         hStandby = reinterpret_cast<zes_standby_object_t*>( hStandby )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesStandbySetMode");
         result = pfnSetMode( hStandby, mode );
+        ZE_PROBE_EXIT(loader, "zesStandbySetMode", result);
 
         return result;
     }
@@ -3798,7 +4065,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceEnumTemperatureSensors");
         result = pfnEnumTemperatureSensors( hDevice, pCount, phTemperature );
+        ZE_PROBE_EXIT(loader, "zesDeviceEnumTemperatureSensors", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -3838,7 +4107,12 @@ namespace loader
         hTemperature = reinterpret_cast<zes_temp_object_t*>( hTemperature )->handle;
 
         // forward to device-driver
-        result = pfnGetProperties( hTemperature, pProperties );
+        ZE_PROBE_ENTRY(loader, "zesTemperatureGetProperties");
+        if( context->propertyCacheEnabled )
+            result = property_cache.get( pfnGetProperties, hTemperature, pProperties );
+        else
+            result = pfnGetProperties( hTemperature, pProperties );
+        ZE_PROBE_EXIT(loader, "zesTemperatureGetProperties", result);
 
         return result;
     }
@@ -3863,7 +4137,9 @@ namespace loader
         hTemperature = reinterpret_cast<zes_temp_object_t*>( hTemperature )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesTemperatureGetConfig");
         result = pfnGetConfig( hTemperature, pConfig );
+        ZE_PROBE_EXIT(loader, "zesTemperatureGetConfig", result);
 
         return result;
     }
@@ -3888,7 +4164,9 @@ namespace loader
         hTemperature = reinterpret_cast<zes_temp_object_t*>( hTemperature )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesTemperatureSetConfig");
         result = pfnSetConfig( hTemperature, pConfig );
+        ZE_PROBE_EXIT(loader, "zesTemperatureSetConfig", result);
 
         return result;
     }
@@ -3914,7 +4192,9 @@ namespace loader
         hTemperature = reinterpret_cast<zes_temp_object_t*>( hTemperature )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesTemperatureGetState");
         result = pfnGetState( hTemperature, pTemperature );
+        ZE_PROBE_EXIT(loader, "zesTemperatureGetState", result);
 
         return result;
     }
@@ -3947,7 +4227,9 @@ namespace loader
         hPower = reinterpret_cast<zes_pwr_object_t*>( hPower )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesPowerGetLimitsExt");
         result = pfnGetLimitsExt( hPower, pCount, pSustained );
+        ZE_PROBE_EXIT(loader, "zesPowerGetLimitsExt", result);
 
         return result;
     }
@@ -3973,7 +4255,9 @@ namespace loader
         hPower = reinterpret_cast<zes_pwr_object_t*>( hPower )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesPowerSetLimitsExt");
         result = pfnSetLimitsExt( hPower, pCount, pSustained );
+        ZE_PROBE_EXIT(loader, "zesPowerSetLimitsExt", result);
 
         return result;
     }
@@ -4011,7 +4295,9 @@ namespace loader
         hEngine = reinterpret_cast<zes_engine_object_t*>( hEngine )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesEngineGetActivityExt");
         result = pfnGetActivityExt( hEngine, pCount, pStats );
+        ZE_PROBE_EXIT(loader, "zesEngineGetActivityExt", result);
 
         return result;
     }
@@ -4044,7 +4330,9 @@ namespace loader
         hRas = reinterpret_cast<zes_ras_object_t*>( hRas )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesRasGetStateExp");
         result = pfnGetStateExp( hRas, pCount, pState );
+        ZE_PROBE_EXIT(loader, "zesRasGetStateExp", result);
 
         return result;
     }
@@ -4069,7 +4357,9 @@ namespace loader
         hRas = reinterpret_cast<zes_ras_object_t*>( hRas )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesRasClearStateExp");
         result = pfnClearStateExp( hRas, category );
+        ZE_PROBE_EXIT(loader, "zesRasClearStateExp", result);
 
         return result;
     }
@@ -4095,7 +4385,9 @@ namespace loader
         hFirmware = reinterpret_cast<zes_firmware_object_t*>( hFirmware )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFirmwareGetSecurityVersionExp");
         result = pfnGetSecurityVersionExp( hFirmware, pVersion );
+        ZE_PROBE_EXIT(loader, "zesFirmwareGetSecurityVersionExp", result);
 
         return result;
     }
@@ -4119,7 +4411,9 @@ namespace loader
         hFirmware = reinterpret_cast<zes_firmware_object_t*>( hFirmware )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesFirmwareSetSecurityVersionExp");
         result = pfnSetSecurityVersionExp( hFirmware );
+        ZE_PROBE_EXIT(loader, "zesFirmwareSetSecurityVersionExp", result);
 
         return result;
     }
@@ -4152,7 +4446,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceGetSubDevicePropertiesExp");
         result = pfnGetSubDevicePropertiesExp( hDevice, pCount, pSubdeviceProps );
+        ZE_PROBE_EXIT(loader, "zesDeviceGetSubDevicePropertiesExp", result);
 
         return result;
     }
@@ -4181,7 +4477,9 @@ namespace loader
         hDriver = reinterpret_cast<zes_driver_object_t*>( hDriver )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDriverGetDeviceByUuidExp");
         result = pfnGetDeviceByUuidExp( hDriver, uuid, phDevice, onSubdevice, subdeviceId );
+        ZE_PROBE_EXIT(loader, "zesDriverGetDeviceByUuidExp", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -4230,7 +4528,9 @@ namespace loader
         hDevice = reinterpret_cast<zes_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesDeviceEnumActiveVFExp");
         result = pfnEnumActiveVFExp( hDevice, pCount, phVFhandle );
+        ZE_PROBE_EXIT(loader, "zesDeviceEnumActiveVFExp", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -4270,7 +4570,9 @@ namespace loader
         hVFhandle = reinterpret_cast<zes_vf_object_t*>( hVFhandle )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesVFManagementGetVFPropertiesExp");
         result = pfnGetVFPropertiesExp( hVFhandle, pProperties );
+        ZE_PROBE_EXIT(loader, "zesVFManagementGetVFPropertiesExp", result);
 
         return result;
     }
@@ -4307,7 +4609,9 @@ namespace loader
         hVFhandle = reinterpret_cast<zes_vf_object_t*>( hVFhandle )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesVFManagementGetVFMemoryUtilizationExp");
         result = pfnGetVFMemoryUtilizationExp( hVFhandle, pCount, pMemUtil );
+        ZE_PROBE_EXIT(loader, "zesVFManagementGetVFMemoryUtilizationExp", result);
 
         return result;
     }
@@ -4344,7 +4648,9 @@ namespace loader
         hVFhandle = reinterpret_cast<zes_vf_object_t*>( hVFhandle )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesVFManagementGetVFEngineUtilizationExp");
         result = pfnGetVFEngineUtilizationExp( hVFhandle, pCount, pEngineUtil );
+        ZE_PROBE_EXIT(loader, "zesVFManagementGetVFEngineUtilizationExp", result);
 
         return result;
     }
@@ -4371,7 +4677,9 @@ namespace loader
         hVFhandle = reinterpret_cast<zes_vf_object_t*>( hVFhandle )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesVFManagementSetVFTelemetryModeExp");
         result = pfnSetVFTelemetryModeExp( hVFhandle, flags, enable );
+        ZE_PROBE_EXIT(loader, "zesVFManagementSetVFTelemetryModeExp", result);
 
         return result;
     }
@@ -4398,7 +4706,9 @@ namespace loader
         hVFhandle = reinterpret_cast<zes_vf_object_t*>( hVFhandle )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zesVFManagementSetVFTelemetrySamplingIntervalExp");
         result = pfnSetVFTelemetrySamplingIntervalExp( hVFhandle, flag, samplingInterval );
+        ZE_PROBE_EXIT(loader, "zesVFManagementSetVFTelemetrySamplingIntervalExp", result);
 
         return result;
     }
@@ -4475,14 +4785,34 @@ zesGetGlobalProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zes_pfnGetGlobalProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zesGetGlobalProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zes_global_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zes_global_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zes.Global = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zes.Global = loader::context->validation_dditable.zes.Global;
+        else
+            loader::context->tracing_dditable.zes.Global = *pDdiTable;
     }
 
     return result;
@@ -4586,14 +4916,34 @@ zesGetDeviceProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zes_pfnGetDeviceProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zesGetDeviceProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zes_device_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zes_device_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zes.Device = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zes.Device = loader::context->validation_dditable.zes.Device;
+        else
+            loader::context->tracing_dditable.zes.Device = *pDdiTable;
     }
 
     return result;
@@ -4653,14 +5003,34 @@ zesGetDeviceExpProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zes_pfnGetDeviceExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zesGetDeviceExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zes_device_exp_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zes_device_exp_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zes.DeviceExp = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zes.DeviceExp = loader::context->validation_dditable.zes.DeviceExp;
+        else
+            loader::context->tracing_dditable.zes.DeviceExp = *pDdiTable;
     }
 
     return result;
@@ -4732,14 +5102,34 @@ zesGetDriverProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zes_pfnGetDriverProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zesGetDriverProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zes_driver_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zes_driver_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zes.Driver = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zes.Driver = loader::context->validation_dditable.zes.Driver;
+        else
+            loader::context->tracing_dditable.zes.Driver = *pDdiTable;
     }
 
     return result;
@@ -4798,14 +5188,34 @@ zesGetDriverExpProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zes_pfnGetDriverExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zesGetDriverExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zes_driver_exp_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zes_driver_exp_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zes.DriverExp = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zes.DriverExp = loader::context->validation_dditable.zes.DriverExp;
+        else
+            loader::context->tracing_dditable.zes.DriverExp = *pDdiTable;
     }
 
     return result;
@@ -4875,14 +5285,34 @@ zesGetDiagnosticsProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zes_pfnGetDiagnosticsProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zesGetDiagnosticsProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zes_diagnostics_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zes_diagnostics_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zes.Diagnostics = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zes.Diagnostics = loader::context->validation_dditable.zes.Diagnostics;
+        else
+            loader::context->tracing_dditable.zes.Diagnostics = *pDdiTable;
     }
 
     return result;
@@ -4952,14 +5382,34 @@ zesGetEngineProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zes_pfnGetEngineProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zesGetEngineProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zes_engine_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zes_engine_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zes.Engine = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zes.Engine = loader::context->validation_dditable.zes.Engine;
+        else
+            loader::context->tracing_dditable.zes.Engine = *pDdiTable;
     }
 
     return result;
@@ -5034,14 +5484,34 @@ zesGetFabricPortProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zes_pfnGetFabricPortProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zesGetFabricPortProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zes_fabric_port_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zes_fabric_port_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zes.FabricPort = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zes.FabricPort = loader::context->validation_dditable.zes.FabricPort;
+        else
+            loader::context->tracing_dditable.zes.FabricPort = *pDdiTable;
     }
 
     return result;
@@ -5114,14 +5584,34 @@ zesGetFanProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zes_pfnGetFanProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zesGetFanProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zes_fan_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zes_fan_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zes.Fan = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zes.Fan = loader::context->validation_dditable.zes.Fan;
+        else
+            loader::context->tracing_dditable.zes.Fan = *pDdiTable;
     }
 
     return result;
@@ -5192,14 +5682,34 @@ zesGetFirmwareProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zes_pfnGetFirmwareProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zesGetFirmwareProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zes_firmware_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zes_firmware_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zes.Firmware = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zes.Firmware = loader::context->validation_dditable.zes.Firmware;
+        else
+            loader::context->tracing_dditable.zes.Firmware = *pDdiTable;
     }
 
     return result;
@@ -5259,14 +5769,34 @@ zesGetFirmwareExpProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zes_pfnGetFirmwareExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zesGetFirmwareExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zes_firmware_exp_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zes_firmware_exp_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zes.FirmwareExp = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zes.FirmwareExp = loader::context->validation_dditable.zes.FirmwareExp;
+        else
+            loader::context->tracing_dditable.zes.FirmwareExp = *pDdiTable;
     }
 
     return result;
@@ -5350,14 +5880,34 @@ zesGetFrequencyProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zes_pfnGetFrequencyProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zesGetFrequencyProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zes_frequency_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zes_frequency_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zes.Frequency = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zes.Frequency = loader::context->validation_dditable.zes.Frequency;
+        else
+            loader::context->tracing_dditable.zes.Frequency = *pDdiTable;
     }
 
     return result;
@@ -5428,14 +5978,34 @@ zesGetLedProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zes_pfnGetLedProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zesGetLedProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zes_led_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zes_led_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zes.Led = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zes.Led = loader::context->validation_dditable.zes.Led;
+        else
+            loader::context->tracing_dditable.zes.Led = *pDdiTable;
     }
 
     return result;
@@ -5505,14 +6075,34 @@ zesGetMemoryProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zes_pfnGetMemoryProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zesGetMemoryProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zes_memory_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zes_memory_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zes.Memory = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zes.Memory = loader::context->validation_dditable.zes.Memory;
+        else
+            loader::context->tracing_dditable.zes.Memory = *pDdiTable;
     }
 
     return result;
@@ -5592,14 +6182,34 @@ zesGetOverclockProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zes_pfnGetOverclockProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zesGetOverclockProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zes_overclock_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zes_overclock_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zes.Overclock = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zes.Overclock = loader::context->validation_dditable.zes.Overclock;
+        else
+            loader::context->tracing_dditable.zes.Overclock = *pDdiTable;
     }
 
     return result;
@@ -5669,14 +6279,34 @@ zesGetPerformanceFactorProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zes_pfnGetPerformanceFactorProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zesGetPerformanceFactorProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zes_performance_factor_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zes_performance_factor_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zes.PerformanceFactor = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zes.PerformanceFactor = loader::context->validation_dditable.zes.PerformanceFactor;
+        else
+            loader::context->tracing_dditable.zes.PerformanceFactor = *pDdiTable;
     }
 
     return result;
@@ -5751,14 +6381,34 @@ zesGetPowerProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zes_pfnGetPowerProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zesGetPowerProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zes_power_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zes_power_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zes.Power = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zes.Power = loader::context->validation_dditable.zes.Power;
+        else
+            loader::context->tracing_dditable.zes.Power = *pDdiTable;
     }
 
     return result;
@@ -5827,14 +6477,34 @@ zesGetPsuProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zes_pfnGetPsuProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zesGetPsuProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zes_psu_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zes_psu_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zes.Psu = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zes.Psu = loader::context->validation_dditable.zes.Psu;
+        else
+            loader::context->tracing_dditable.zes.Psu = *pDdiTable;
     }
 
     return result;
@@ -5905,14 +6575,34 @@ zesGetRasProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zes_pfnGetRasProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zesGetRasProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zes_ras_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zes_ras_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zes.Ras = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zes.Ras = loader::context->validation_dditable.zes.Ras;
+        else
+            loader::context->tracing_dditable.zes.Ras = *pDdiTable;
     }
 
     return result;
@@ -5972,14 +6662,34 @@ zesGetRasExpProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zes_pfnGetRasExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zesGetRasExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zes_ras_exp_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zes_ras_exp_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zes.RasExp = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zes.RasExp = loader::context->validation_dditable.zes.RasExp;
+        else
+            loader::context->tracing_dditable.zes.RasExp = *pDdiTable;
     }
 
     return result;
@@ -6054,14 +6764,34 @@ zesGetSchedulerProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zes_pfnGetSchedulerProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zesGetSchedulerProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zes_scheduler_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zes_scheduler_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zes.Scheduler = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zes.Scheduler = loader::context->validation_dditable.zes.Scheduler;
+        else
+            loader::context->tracing_dditable.zes.Scheduler = *pDdiTable;
     }
 
     return result;
@@ -6131,14 +6861,34 @@ zesGetStandbyProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zes_pfnGetStandbyProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zesGetStandbyProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zes_standby_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zes_standby_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zes.Standby = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zes.Standby = loader::context->validation_dditable.zes.Standby;
+        else
+            loader::context->tracing_dditable.zes.Standby = *pDdiTable;
     }
 
     return result;
@@ -6209,14 +6959,34 @@ zesGetTemperatureProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zes_pfnGetTemperatureProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zesGetTemperatureProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zes_temperature_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zes_temperature_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zes.Temperature = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zes.Temperature = loader::context->validation_dditable.zes.Temperature;
+        else
+            loader::context->tracing_dditable.zes.Temperature = *pDdiTable;
     }
 
     return result;
@@ -6279,14 +7049,34 @@ zesGetVFManagementExpProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zes_pfnGetVFManagementExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zesGetVFManagementExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zes_vf_management_exp_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zes_vf_management_exp_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zes.VFManagementExp = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zes.VFManagementExp = loader::context->validation_dditable.zes.VFManagementExp;
+        else
+            loader::context->tracing_dditable.zes.VFManagementExp = *pDdiTable;
     }
 
     return result;
@@ -8,6 +8,7 @@
  *
  */
 #include "ze_loader_internal.h"
+#include "ze_probes.h"
 
 namespace loader
 {
@@ -49,7 +50,9 @@ namespace loader
         hModule = reinterpret_cast<zet_module_object_t*>( hModule )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetModuleGetDebugInfo");
         result = pfnGetDebugInfo( hModule, format, pSize, pDebugInfo );
+        ZE_PROBE_EXIT(loader, "zetModuleGetDebugInfo", result);
 
         return result;
     }
@@ -74,7 +77,9 @@ namespace loader
         hDevice = reinterpret_cast<zet_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetDeviceGetDebugProperties");
         result = pfnGetDebugProperties( hDevice, pDebugProperties );
+        ZE_PROBE_EXIT(loader, "zetDeviceGetDebugProperties", result);
 
         return result;
     }
@@ -100,7 +105,9 @@ namespace loader
         hDevice = reinterpret_cast<zet_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetDebugAttach");
         result = pfnAttach( hDevice, config, phDebug );
+        ZE_PROBE_EXIT(loader, "zetDebugAttach", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -138,7 +145,9 @@ namespace loader
         hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetDebugDetach");
         result = pfnDetach( hDebug );
+        ZE_PROBE_EXIT(loader, "zetDebugDetach", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -176,7 +185,9 @@ namespace loader
         hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetDebugReadEvent");
         result = pfnReadEvent( hDebug, timeout, event );
+        ZE_PROBE_EXIT(loader, "zetDebugReadEvent", result);
 
         return result;
     }
@@ -201,7 +212,9 @@ namespace loader
         hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetDebugAcknowledgeEvent");
         result = pfnAcknowledgeEvent( hDebug, event );
+        ZE_PROBE_EXIT(loader, "zetDebugAcknowledgeEvent", result);
 
         return result;
     }
@@ -226,7 +239,9 @@ namespace loader
         hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetDebugInterrupt");
         result = pfnInterrupt( hDebug, thread );
+        ZE_PROBE_EXIT(loader, "zetDebugInterrupt", result);
 
         return result;
     }
@@ -251,7 +266,9 @@ namespace loader
         hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetDebugResume");
         result = pfnResume( hDebug, thread );
+        ZE_PROBE_EXIT(loader, "zetDebugResume", result);
 
         return result;
     }
@@ -279,7 +296,9 @@ namespace loader
         hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetDebugReadMemory");
         result = pfnReadMemory( hDebug, thread, desc, size, buffer );
+        ZE_PROBE_EXIT(loader, "zetDebugReadMemory", result);
 
         return result;
     }
@@ -307,7 +326,9 @@ namespace loader
         hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetDebugWriteMemory");
         result = pfnWriteMemory( hDebug, thread, desc, size, buffer );
+        ZE_PROBE_EXIT(loader, "zetDebugWriteMemory", result);
 
         return result;
     }
@@ -341,7 +362,9 @@ namespace loader
         hDevice = reinterpret_cast<zet_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetDebugGetRegisterSetProperties");
         result = pfnGetRegisterSetProperties( hDevice, pCount, pRegisterSetProperties );
+        ZE_PROBE_EXIT(loader, "zetDebugGetRegisterSetProperties", result);
 
         return result;
     }
@@ -376,7 +399,9 @@ namespace loader
         hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetDebugGetThreadRegisterSetProperties");
         result = pfnGetThreadRegisterSetProperties( hDebug, thread, pCount, pRegisterSetProperties );
+        ZE_PROBE_EXIT(loader, "zetDebugGetThreadRegisterSetProperties", result);
 
         return result;
     }
@@ -409,7 +434,9 @@ namespace loader
         hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetDebugReadRegisters");
         result = pfnReadRegisters( hDebug, thread, type, start, count, pRegisterValues );
+        ZE_PROBE_EXIT(loader, "zetDebugReadRegisters", result);
 
         return result;
     }
@@ -442,7 +469,9 @@ namespace loader
         hDebug = reinterpret_cast<zet_debug_session_object_t*>( hDebug )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetDebugWriteRegisters");
         result = pfnWriteRegisters( hDebug, thread, type, start, count, pRegisterValues );
+        ZE_PROBE_EXIT(loader, "zetDebugWriteRegisters", result);
 
         return result;
     }
@@ -475,7 +504,9 @@ namespace loader
         hDevice = reinterpret_cast<zet_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricGroupGet");
         result = pfnGet( hDevice, pCount, phMetricGroups );
+        ZE_PROBE_EXIT(loader, "zetMetricGroupGet", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -515,7 +546,9 @@ namespace loader
         hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricGroupGetProperties");
         result = pfnGetProperties( hMetricGroup, pProperties );
+        ZE_PROBE_EXIT(loader, "zetMetricGroupGetProperties", result);
 
         return result;
     }
@@ -551,7 +584,9 @@ namespace loader
         hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricGroupCalculateMetricValues");
         result = pfnCalculateMetricValues( hMetricGroup, type, rawDataSize, pRawData, pMetricValueCount, pMetricValues );
+        ZE_PROBE_EXIT(loader, "zetMetricGroupCalculateMetricValues", result);
 
         return result;
     }
@@ -583,7 +618,9 @@ namespace loader
         hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricGet");
         result = pfnGet( hMetricGroup, pCount, phMetrics );
+        ZE_PROBE_EXIT(loader, "zetMetricGet", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -623,7 +660,9 @@ namespace loader
         hMetric = reinterpret_cast<zet_metric_object_t*>( hMetric )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricGetProperties");
         result = pfnGetProperties( hMetric, pProperties );
+        ZE_PROBE_EXIT(loader, "zetMetricGetProperties", result);
 
         return result;
     }
@@ -662,7 +701,9 @@ namespace loader
             phMetricGroupsLocal[ i ] = reinterpret_cast<zet_metric_group_object_t*>( phMetricGroups[ i ] )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetContextActivateMetricGroups");
         result = pfnActivateMetricGroups( hContext, hDevice, count, phMetricGroupsLocal );
+        ZE_PROBE_EXIT(loader, "zetContextActivateMetricGroups", result);
         delete []phMetricGroupsLocal;
 
         return result;
@@ -701,7 +742,9 @@ namespace loader
         hNotificationEvent = ( hNotificationEvent ) ? reinterpret_cast<ze_event_object_t*>( hNotificationEvent )->handle : nullptr;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricStreamerOpen");
         result = pfnOpen( hContext, hDevice, hMetricGroup, desc, hNotificationEvent, phMetricStreamer );
+        ZE_PROBE_EXIT(loader, "zetMetricStreamerOpen", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -744,7 +787,9 @@ namespace loader
         hMetricStreamer = reinterpret_cast<zet_metric_streamer_object_t*>( hMetricStreamer )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetCommandListAppendMetricStreamerMarker");
         result = pfnAppendMetricStreamerMarker( hCommandList, hMetricStreamer, value );
+        ZE_PROBE_EXIT(loader, "zetCommandListAppendMetricStreamerMarker", result);
 
         return result;
     }
@@ -768,7 +813,9 @@ namespace loader
         hMetricStreamer = reinterpret_cast<zet_metric_streamer_object_t*>( hMetricStreamer )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricStreamerClose");
         result = pfnClose( hMetricStreamer );
+        ZE_PROBE_EXIT(loader, "zetMetricStreamerClose", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -809,7 +856,9 @@ namespace loader
         hMetricStreamer = reinterpret_cast<zet_metric_streamer_object_t*>( hMetricStreamer )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricStreamerReadData");
         result = pfnReadData( hMetricStreamer, maxReportCount, pRawDataSize, pRawData );
+        ZE_PROBE_EXIT(loader, "zetMetricStreamerReadData", result);
 
         return result;
     }
@@ -843,7 +892,9 @@ namespace loader
         hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricQueryPoolCreate");
         result = pfnCreate( hContext, hDevice, hMetricGroup, desc, phMetricQueryPool );
+        ZE_PROBE_EXIT(loader, "zetMetricQueryPoolCreate", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -881,7 +932,9 @@ namespace loader
         hMetricQueryPool = reinterpret_cast<zet_metric_query_pool_object_t*>( hMetricQueryPool )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricQueryPoolDestroy");
         result = pfnDestroy( hMetricQueryPool );
+        ZE_PROBE_EXIT(loader, "zetMetricQueryPoolDestroy", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -913,7 +966,9 @@ namespace loader
         hMetricQueryPool = reinterpret_cast<zet_metric_query_pool_object_t*>( hMetricQueryPool )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricQueryCreate");
         result = pfnCreate( hMetricQueryPool, index, phMetricQuery );
+        ZE_PROBE_EXIT(loader, "zetMetricQueryCreate", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -951,7 +1006,9 @@ namespace loader
         hMetricQuery = reinterpret_cast<zet_metric_query_object_t*>( hMetricQuery )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricQueryDestroy");
         result = pfnDestroy( hMetricQuery );
+        ZE_PROBE_EXIT(loader, "zetMetricQueryDestroy", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -981,7 +1038,9 @@ namespace loader
         hMetricQuery = reinterpret_cast<zet_metric_query_object_t*>( hMetricQuery )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricQueryReset");
         result = pfnReset( hMetricQuery );
+        ZE_PROBE_EXIT(loader, "zetMetricQueryReset", result);
 
         return result;
     }
@@ -1009,7 +1068,9 @@ namespace loader
         hMetricQuery = reinterpret_cast<zet_metric_query_object_t*>( hMetricQuery )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetCommandListAppendMetricQueryBegin");
         result = pfnAppendMetricQueryBegin( hCommandList, hMetricQuery );
+        ZE_PROBE_EXIT(loader, "zetCommandListAppendMetricQueryBegin", result);
 
         return result;
     }
@@ -1043,7 +1104,9 @@ namespace loader
         hSignalEvent = ( hSignalEvent ) ? reinterpret_cast<ze_event_object_t*>( hSignalEvent )->handle : nullptr;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetCommandListAppendMetricQueryEnd");
         result = pfnAppendMetricQueryEnd( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents );
+        ZE_PROBE_EXIT(loader, "zetCommandListAppendMetricQueryEnd", result);
 
         return result;
     }
@@ -1067,7 +1130,9 @@ namespace loader
         hCommandList = reinterpret_cast<zet_command_list_object_t*>( hCommandList )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetCommandListAppendMetricMemoryBarrier");
         result = pfnAppendMetricMemoryBarrier( hCommandList );
+        ZE_PROBE_EXIT(loader, "zetCommandListAppendMetricMemoryBarrier", result);
 
         return result;
     }
@@ -1100,7 +1165,9 @@ namespace loader
         hMetricQuery = reinterpret_cast<zet_metric_query_object_t*>( hMetricQuery )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricQueryGetData");
         result = pfnGetData( hMetricQuery, pRawDataSize, pRawData );
+        ZE_PROBE_EXIT(loader, "zetMetricQueryGetData", result);
 
         return result;
     }
@@ -1125,7 +1192,9 @@ namespace loader
         hKernel = reinterpret_cast<zet_kernel_object_t*>( hKernel )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetKernelGetProfileInfo");
         result = pfnGetProfileInfo( hKernel, pProfileProperties );
+        ZE_PROBE_EXIT(loader, "zetKernelGetProfileInfo", result);
 
         return result;
     }
@@ -1151,7 +1220,9 @@ namespace loader
         hContext = reinterpret_cast<zet_context_object_t*>( hContext )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetTracerExpCreate");
         result = pfnCreate( hContext, desc, phTracer );
+        ZE_PROBE_EXIT(loader, "zetTracerExpCreate", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -1189,7 +1260,9 @@ namespace loader
         hTracer = reinterpret_cast<zet_tracer_exp_object_t*>( hTracer )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetTracerExpDestroy");
         result = pfnDestroy( hTracer );
+        ZE_PROBE_EXIT(loader, "zetTracerExpDestroy", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -1220,7 +1293,9 @@ namespace loader
         hTracer = reinterpret_cast<zet_tracer_exp_object_t*>( hTracer )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetTracerExpSetPrologues");
         result = pfnSetPrologues( hTracer, pCoreCbs );
+        ZE_PROBE_EXIT(loader, "zetTracerExpSetPrologues", result);
 
         return result;
     }
@@ -1245,7 +1320,9 @@ namespace loader
         hTracer = reinterpret_cast<zet_tracer_exp_object_t*>( hTracer )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetTracerExpSetEpilogues");
         result = pfnSetEpilogues( hTracer, pCoreCbs );
+        ZE_PROBE_EXIT(loader, "zetTracerExpSetEpilogues", result);
 
         return result;
     }
@@ -1270,7 +1347,9 @@ namespace loader
         hTracer = reinterpret_cast<zet_tracer_exp_object_t*>( hTracer )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetTracerExpSetEnabled");
         result = pfnSetEnabled( hTracer, enable );
+        ZE_PROBE_EXIT(loader, "zetTracerExpSetEnabled", result);
 
         return result;
     }
@@ -1316,7 +1395,9 @@ namespace loader
         hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricGroupCalculateMultipleMetricValuesExp");
         result = pfnCalculateMultipleMetricValuesExp( hMetricGroup, type, rawDataSize, pRawData, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
+        ZE_PROBE_EXIT(loader, "zetMetricGroupCalculateMultipleMetricValuesExp", result);
 
         return result;
     }
@@ -1343,7 +1424,9 @@ namespace loader
         hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricGroupGetGlobalTimestampsExp");
         result = pfnGetGlobalTimestampsExp( hMetricGroup, synchronizedWithHost, globalTimestamp, metricTimestamp );
+        ZE_PROBE_EXIT(loader, "zetMetricGroupGetGlobalTimestampsExp", result);
 
         return result;
     }
@@ -1375,7 +1458,9 @@ namespace loader
         hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricGroupGetExportDataExp");
         result = pfnGetExportDataExp( hMetricGroup, pRawData, rawDataSize, pExportDataSize, pExportData );
+        ZE_PROBE_EXIT(loader, "zetMetricGroupGetExportDataExp", result);
 
         return result;
     }
@@ -1422,7 +1507,9 @@ namespace loader
         hDriver = reinterpret_cast<ze_driver_object_t*>( hDriver )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricGroupCalculateMetricExportDataExp");
         result = pfnCalculateMetricExportDataExp( hDriver, type, exportDataSize, pExportData, pCalculateDescriptor, pSetCount, pTotalMetricValueCount, pMetricCounts, pMetricValues );
+        ZE_PROBE_EXIT(loader, "zetMetricGroupCalculateMetricExportDataExp", result);
 
         return result;
     }
@@ -1455,7 +1542,9 @@ namespace loader
         hDevice = reinterpret_cast<zet_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricProgrammableGetExp");
         result = pfnGetExp( hDevice, pCount, phMetricProgrammables );
+        ZE_PROBE_EXIT(loader, "zetMetricProgrammableGetExp", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -1495,7 +1584,9 @@ namespace loader
         hMetricProgrammable = reinterpret_cast<zet_metric_programmable_exp_object_t*>( hMetricProgrammable )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricProgrammableGetPropertiesExp");
         result = pfnGetPropertiesExp( hMetricProgrammable, pProperties );
+        ZE_PROBE_EXIT(loader, "zetMetricProgrammableGetPropertiesExp", result);
 
         return result;
     }
@@ -1527,7 +1618,9 @@ namespace loader
         hMetricProgrammable = reinterpret_cast<zet_metric_programmable_exp_object_t*>( hMetricProgrammable )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricProgrammableGetParamInfoExp");
         result = pfnGetParamInfoExp( hMetricProgrammable, pParameterCount, pParameterInfo );
+        ZE_PROBE_EXIT(loader, "zetMetricProgrammableGetParamInfoExp", result);
 
         return result;
     }
@@ -1560,7 +1653,9 @@ namespace loader
         hMetricProgrammable = reinterpret_cast<zet_metric_programmable_exp_object_t*>( hMetricProgrammable )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricProgrammableGetParamValueInfoExp");
         result = pfnGetParamValueInfoExp( hMetricProgrammable, parameterOrdinal, pValueInfoCount, pValueInfo );
+        ZE_PROBE_EXIT(loader, "zetMetricProgrammableGetParamValueInfoExp", result);
 
         return result;
     }
@@ -1600,7 +1695,9 @@ namespace loader
         hMetricProgrammable = reinterpret_cast<zet_metric_programmable_exp_object_t*>( hMetricProgrammable )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricCreateFromProgrammableExp");
         result = pfnCreateFromProgrammableExp( hMetricProgrammable, pParameterValues, parameterCount, pName, pDescription, pMetricHandleCount, phMetricHandles );
+        ZE_PROBE_EXIT(loader, "zetMetricCreateFromProgrammableExp", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -1646,7 +1743,9 @@ namespace loader
         hDevice = reinterpret_cast<zet_device_object_t*>( hDevice )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricGroupCreateExp");
         result = pfnCreateExp( hDevice, pName, pDescription, samplingType, phMetricGroup );
+        ZE_PROBE_EXIT(loader, "zetMetricGroupCreateExp", result);
 
         if( ZE_RESULT_SUCCESS != result )
             return result;
@@ -1695,7 +1794,9 @@ namespace loader
         hMetric = reinterpret_cast<zet_metric_object_t*>( hMetric )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricGroupAddMetricExp");
         result = pfnAddMetricExp( hMetricGroup, hMetric, pErrorStringSize, pErrorString );
+        ZE_PROBE_EXIT(loader, "zetMetricGroupAddMetricExp", result);
 
         return result;
     }
@@ -1723,7 +1824,9 @@ namespace loader
         hMetric = reinterpret_cast<zet_metric_object_t*>( hMetric )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricGroupRemoveMetricExp");
         result = pfnRemoveMetricExp( hMetricGroup, hMetric );
+        ZE_PROBE_EXIT(loader, "zetMetricGroupRemoveMetricExp", result);
 
         return result;
     }
@@ -1747,7 +1850,9 @@ namespace loader
         hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricGroupCloseExp");
         result = pfnCloseExp( hMetricGroup );
+        ZE_PROBE_EXIT(loader, "zetMetricGroupCloseExp", result);
 
         return result;
     }
@@ -1771,7 +1876,9 @@ namespace loader
         hMetricGroup = reinterpret_cast<zet_metric_group_object_t*>( hMetricGroup )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricGroupDestroyExp");
         result = pfnDestroyExp( hMetricGroup );
+        ZE_PROBE_EXIT(loader, "zetMetricGroupDestroyExp", result);
 
         return result;
     }
@@ -1795,7 +1902,9 @@ namespace loader
         hMetric = reinterpret_cast<zet_metric_object_t*>( hMetric )->handle;
 
         // forward to device-driver
+        ZE_PROBE_ENTRY(loader, "zetMetricDestroyExp");
         result = pfnDestroyExp( hMetric );
+        ZE_PROBE_EXIT(loader, "zetMetricDestroyExp", result);
 
         return result;
     }
@@ -1862,14 +1971,44 @@ zetGetMetricProgrammableExpProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetMetricProgrammableExpProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zetGetMetricProgrammableExpProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zet_pfnGetMetricProgrammableExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zetGetMetricProgrammableExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zet_metric_programmable_exp_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zet_metric_programmable_exp_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zet.MetricProgrammableExp = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zet.MetricProgrammableExp = loader::context->validation_dditable.zet.MetricProgrammableExp;
+        else
+            loader::context->tracing_dditable.zet.MetricProgrammableExp = *pDdiTable;
     }
 
     return result;
@@ -1937,14 +2076,44 @@ zetGetDeviceProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetDeviceProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zetGetDeviceProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zet_pfnGetDeviceProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zetGetDeviceProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zet_device_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zet_device_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zet.Device = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zet.Device = loader::context->validation_dditable.zet.Device;
+        else
+            loader::context->tracing_dditable.zet.Device = *pDdiTable;
     }
 
     return result;
@@ -2012,14 +2181,44 @@ zetGetContextProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetContextProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zetGetContextProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zet_pfnGetContextProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zetGetContextProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zet_context_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zet_context_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zet.Context = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zet.Context = loader::context->validation_dditable.zet.Context;
+        else
+            loader::context->tracing_dditable.zet.Context = *pDdiTable;
     }
 
     return result;
@@ -2090,14 +2289,44 @@ zetGetCommandListProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetCommandListProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zetGetCommandListProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zet_pfnGetCommandListProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zetGetCommandListProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zet_command_list_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zet_command_list_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zet.CommandList = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zet.CommandList = loader::context->validation_dditable.zet.CommandList;
+        else
+            loader::context->tracing_dditable.zet.CommandList = *pDdiTable;
     }
 
     return result;
@@ -2165,14 +2394,44 @@ zetGetKernelProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetKernelProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zetGetKernelProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zet_pfnGetKernelProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zetGetKernelProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zet_kernel_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zet_kernel_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zet.Kernel = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zet.Kernel = loader::context->validation_dditable.zet.Kernel;
+        else
+            loader::context->tracing_dditable.zet.Kernel = *pDdiTable;
     }
 
     return result;
@@ -2240,14 +2499,44 @@ zetGetModuleProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetModuleProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zetGetModuleProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zet_pfnGetModuleProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zetGetModuleProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zet_module_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zet_module_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zet.Module = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zet.Module = loader::context->validation_dditable.zet.Module;
+        else
+            loader::context->tracing_dditable.zet.Module = *pDdiTable;
     }
 
     return result;
@@ -2326,14 +2615,44 @@ zetGetDebugProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetDebugProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zetGetDebugProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zet_pfnGetDebugProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zetGetDebugProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zet_debug_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zet_debug_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zet.Debug = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zet.Debug = loader::context->validation_dditable.zet.Debug;
+        else
+            loader::context->tracing_dditable.zet.Debug = *pDdiTable;
     }
 
     return result;
@@ -2402,14 +2721,44 @@ zetGetMetricProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetMetricProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zetGetMetricProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zet_pfnGetMetricProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zetGetMetricProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zet_metric_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zet_metric_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zet.Metric = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zet.Metric = loader::context->validation_dditable.zet.Metric;
+        else
+            loader::context->tracing_dditable.zet.Metric = *pDdiTable;
     }
 
     return result;
@@ -2469,14 +2818,44 @@ zetGetMetricExpProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetMetricExpProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zetGetMetricExpProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zet_pfnGetMetricExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zetGetMetricExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zet_metric_exp_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zet_metric_exp_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zet.MetricExp = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zet.MetricExp = loader::context->validation_dditable.zet.MetricExp;
+        else
+            loader::context->tracing_dditable.zet.MetricExp = *pDdiTable;
     }
 
     return result;
@@ -2546,14 +2925,44 @@ zetGetMetricGroupProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetMetricGroupProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zetGetMetricGroupProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zet_pfnGetMetricGroupProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zetGetMetricGroupProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zet_metric_group_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zet_metric_group_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zet.MetricGroup = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zet.MetricGroup = loader::context->validation_dditable.zet.MetricGroup;
+        else
+            loader::context->tracing_dditable.zet.MetricGroup = *pDdiTable;
     }
 
     return result;
@@ -2620,14 +3029,44 @@ zetGetMetricGroupExpProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetMetricGroupExpProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zetGetMetricGroupExpProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zet_pfnGetMetricGroupExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zetGetMetricGroupExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zet_metric_group_exp_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zet_metric_group_exp_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zet.MetricGroupExp = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zet.MetricGroupExp = loader::context->validation_dditable.zet.MetricGroupExp;
+        else
+            loader::context->tracing_dditable.zet.MetricGroupExp = *pDdiTable;
     }
 
     return result;
@@ -2698,14 +3137,44 @@ zetGetMetricQueryProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetMetricQueryProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zetGetMetricQueryProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zet_pfnGetMetricQueryProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zetGetMetricQueryProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zet_metric_query_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zet_metric_query_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zet.MetricQuery = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zet.MetricQuery = loader::context->validation_dditable.zet.MetricQuery;
+        else
+            loader::context->tracing_dditable.zet.MetricQuery = *pDdiTable;
     }
 
     return result;
@@ -2774,14 +3243,44 @@ zetGetMetricQueryPoolProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetMetricQueryPoolProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zetGetMetricQueryPoolProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zet_pfnGetMetricQueryPoolProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zetGetMetricQueryPoolProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zet_metric_query_pool_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zet_metric_query_pool_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zet.MetricQueryPool = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zet.MetricQueryPool = loader::context->validation_dditable.zet.MetricQueryPool;
+        else
+            loader::context->tracing_dditable.zet.MetricQueryPool = *pDdiTable;
     }
 
     return result;
@@ -2851,14 +3350,44 @@ zetGetMetricStreamerProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetMetricStreamerProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zetGetMetricStreamerProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zet_pfnGetMetricStreamerProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zetGetMetricStreamerProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zet_metric_streamer_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zet_metric_streamer_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zet.MetricStreamer = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zet.MetricStreamer = loader::context->validation_dditable.zet.MetricStreamer;
+        else
+            loader::context->tracing_dditable.zet.MetricStreamer = *pDdiTable;
     }
 
     return result;
@@ -2930,14 +3459,44 @@ zetGetTracerExpProcAddrTable(
         }
     }
 
-    // If the validation layer is enabled, then intercept the loader's DDIs
+    // If the optimization layer is enabled, then intercept the driver's or
+    // loader's DDIs; it only exports the tables it has optimizations for
+    if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->optimizationLayer ))
+    {
+        auto getTable = reinterpret_cast<zet_pfnGetTracerExpProcAddrTable_t>(
+            GET_FUNCTION_PTR(loader::context->optimizationLayer, "zetGetTracerExpProcAddrTable") );
+        if(getTable)
+            result = getTable( version, pDdiTable );
+    }
+
+    // If the validation layer is enabled, then intercept the loader's DDIs;
+    // if it is only loaded, build the table zelEnableValidationLayer swaps in
+    bool validationAtRuntime = ( nullptr != loader::context->validationLayer ) && !loader::context->validationLayerEnabled;
     if(( ZE_RESULT_SUCCESS == result ) && ( nullptr != loader::context->validationLayer ))
     {
         auto getTable = reinterpret_cast<zet_pfnGetTracerExpProcAddrTable_t>(
             GET_FUNCTION_PTR(loader::context->validationLayer, "zetGetTracerExpProcAddrTable") );
         if(!getTable)
             return ZE_RESULT_ERROR_UNINITIALIZED;
-        result = getTable( version, pDdiTable );
+        if ( validationAtRuntime ) {
+            zet_tracer_exp_dditable_t dditable;
+            memcpy(&dditable, pDdiTable, sizeof(zet_tracer_exp_dditable_t));
+            result = getTable( version, &dditable );
+            loader::context->validation_dditable.zet.TracerExp = dditable;
+        } else {
+            result = getTable( version, pDdiTable );
+        }
+    }
+
+    // There is no tracing layer for these DDIs, so the table swapped in by
+    // zelEnableTracingLayer only keeps a validation layer that can be enabled
+    // at runtime in the call path
+    if( ZE_RESULT_SUCCESS == result )
+    {
+        if ( validationAtRuntime )
+            loader::context->tracing_dditable.zet.TracerExp = loader::context->validation_dditable.zet.TracerExp;
+        else
+            loader::context->tracing_dditable.zet.TracerExp = *pDdiTable;
     }
 
     return result;
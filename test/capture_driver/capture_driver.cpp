@@ -0,0 +1,1050 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// A driver for the tests that passes every call on to the null driver and
+// records the calls that reach it, so a test can check what a layer sent
+// below itself. The loader loads it through ZE_ENABLE_ALT_DRIVERS; tests
+// read the record with the helpers of capture_driver.h.
+//
+// Each recorded call is one line with the name of the function and its
+// arguments. Handles are named after their kind and the order they were
+// created in, such as list0 or event1, and pointers into allocations as
+// the allocation and an offset, such as alloc0+64. Unlike the null driver,
+// the capture driver knows the range of each allocation.
+
+#include "ze_ddi.h"
+#include "zet_ddi.h"
+#include "zes_ddi.h"
+#include "ze_util.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace capture_driver
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    struct allocation_t {
+        size_t size;
+        std::string name;
+    };
+
+    class context_t
+    {
+    public:
+        ze_dditable_t   zeDdiTable = {};
+        zet_dditable_t  zetDdiTable = {};
+
+        HMODULE nullDriver = nullptr;
+
+        std::mutex mutex;
+        std::string log;
+
+        context_t() {
+            nullDriver = LOAD_DRIVER_LIBRARY( MAKE_LIBRARY_NAME( "ze_null", L0_LOADER_VERSION ) );
+        }
+
+        // Prints what the layers released at exit, after the test could
+        // take it, for the registration of the test to match.
+        ~context_t() {
+            if( !log.empty() )
+                fprintf( stderr, "Calls recorded after the test:\n%s", log.c_str() );
+        }
+
+        // A held call stays in the driver until it is released, so a test
+        // can make another thread's call overlap it.
+        void record( const std::string &call ) {
+            std::unique_lock<std::mutex> lock( mutex );
+            log += call;
+            log += '\n';
+            if( hold.empty() || call.compare( 0, hold.size(), hold ) != 0 )
+                return;
+            hold.clear();
+            holding = true;
+            held.notify_all();
+            held.wait( lock, [this] { return !holding; } );
+        }
+
+        // Holds the next call whose record starts with the text.
+        void holdCall( const char *call ) {
+            std::lock_guard<std::mutex> lock( mutex );
+            hold = call;
+        }
+
+        void waitHeld() {
+            std::unique_lock<std::mutex> lock( mutex );
+            held.wait( lock, [this] { return holding; } );
+        }
+
+        void release() {
+            std::lock_guard<std::mutex> lock( mutex );
+            holding = false;
+            held.notify_all();
+        }
+
+        // Names a handle once the null driver created it.
+        std::string name( const char *kind, const void *handle ) {
+            std::lock_guard<std::mutex> lock( mutex );
+            auto &name = names[handle];
+            name = kind + std::to_string( counts[kind]++ );
+            return name;
+        }
+
+        std::string lookup( const void *handle ) {
+            if( nullptr == handle )
+                return "null";
+            std::lock_guard<std::mutex> lock( mutex );
+            auto name = names.find( handle );
+            if( name != names.end() )
+                return name->second;
+            char text[32];
+            snprintf( text, sizeof( text ), "%p", handle );
+            return text;
+        }
+
+        std::string list( uint32_t count, ze_event_handle_t *phEvents ) {
+            std::string text = "[";
+            for( uint32_t i = 0; phEvents && i < count; ++i ) {
+                if( i )
+                    text += ",";
+                text += lookup( phEvents[i] );
+            }
+            return text + "]";
+        }
+
+        // Allocations are placed one after the other in an arena, so a test
+        // can have allocations whose ranges touch; the arena is not reused.
+        ze_result_t allocate( size_t size, size_t alignment, void **pptr, const char *kind = "alloc" ) {
+            if( nullptr == pptr )
+                return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+            std::unique_lock<std::mutex> lock( mutex );
+            alignment = alignment > 64 ? alignment : 64;
+            auto offset = ( used + alignment - 1 ) / alignment * alignment;
+            if( size == 0 || offset + size > sizeof( arena ) )
+                return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+            used = offset + size;
+            *pptr = arena + offset;
+            lock.unlock();
+
+            auto name = this->name( kind, *pptr );
+            lock.lock();
+            allocations[reinterpret_cast<uintptr_t>( *pptr )] = { size, name };
+            return ZE_RESULT_SUCCESS;
+        }
+
+        void free( void *ptr ) {
+            std::lock_guard<std::mutex> lock( mutex );
+            allocations.erase( reinterpret_cast<uintptr_t>( ptr ) );
+        }
+
+        // The allocation holding an address, as its base and size.
+        bool range( const void *ptr, uintptr_t &base, size_t &size ) {
+            std::lock_guard<std::mutex> lock( mutex );
+            auto address = reinterpret_cast<uintptr_t>( ptr );
+            auto allocation = allocations.upper_bound( address );
+            if( allocation == allocations.begin() )
+                return false;
+            --allocation;
+            if( address >= allocation->first + allocation->second.size )
+                return false;
+            base = allocation->first;
+            size = allocation->second.size;
+            return true;
+        }
+
+        std::string pointer( const void *ptr ) {
+            uintptr_t base = 0;
+            size_t size = 0;
+            if( !range( ptr, base, size ) )
+                return lookup( ptr );
+            return lookup( reinterpret_cast<void *>( base ) ) + "+" +
+                std::to_string( reinterpret_cast<uintptr_t>( ptr ) - base );
+        }
+
+        // A kernel argument: pointers and handles by name, other values as
+        // their bytes.
+        std::string argument( size_t size, const void *pValue ) {
+            if( nullptr == pValue )
+                return "null";
+            if( size == sizeof( void * ) )
+                return pointer( *static_cast<void *const *>( pValue ) );
+            std::string text = "0x";
+            auto bytes = static_cast<const uint8_t *>( pValue );
+            for( size_t i = size; i > 0; --i ) {
+                char byte[3];
+                snprintf( byte, sizeof( byte ), "%02x", bytes[i - 1] );
+                text += byte;
+            }
+            return text;
+        }
+
+        // Exported IPC handles carry their name, such as ipc0, so the
+        // process opening them can be told which one it got.
+        template <typename handle_t>
+        std::string exportHandle( handle_t *pIpcHandle ) {
+            std::unique_lock<std::mutex> lock( mutex );
+            auto name = "ipc" + std::to_string( counts["ipc"]++ );
+            lock.unlock();
+            memset( pIpcHandle->data, 0, sizeof( pIpcHandle->data ) );
+            memcpy( pIpcHandle->data, name.c_str(), std::min( name.size(), sizeof( pIpcHandle->data ) - 1 ) );
+            return name;
+        }
+
+        template <typename handle_t>
+        static std::string handleName( const handle_t &handle ) {
+            return std::string( handle.data, strnlen( handle.data, sizeof( handle.data ) ) );
+        }
+
+        void setOwner( const void *handle, ze_context_handle_t hContext ) {
+            std::lock_guard<std::mutex> lock( mutex );
+            owners[handle] = hContext;
+        }
+
+        ze_context_handle_t owner( const void *handle ) {
+            std::lock_guard<std::mutex> lock( mutex );
+            auto owner = owners.find( handle );
+            return owner != owners.end() ? owner->second : nullptr;
+        }
+
+        std::string take() {
+            std::lock_guard<std::mutex> lock( mutex );
+            std::string taken;
+            taken.swap( log );
+            return taken;
+        }
+
+    private:
+        std::map<const void *, std::string> names;
+        std::map<std::string, uint32_t> counts;
+        std::map<uintptr_t, allocation_t> allocations;
+        std::map<const void *, ze_context_handle_t> owners;
+        std::condition_variable held;
+        std::string hold;
+        bool holding = false;
+        alignas( 4096 ) char arena[64 * 1024 * 1024];
+        size_t used = 0;
+    };
+
+    context_t context;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ze_result_t ZE_APICALL
+    zeContextCreate( ze_driver_handle_t hDriver, const ze_context_desc_t* desc, ze_context_handle_t* phContext )
+    {
+        auto result = context.zeDdiTable.Context.pfnCreate( hDriver, desc, phContext );
+        if( ZE_RESULT_SUCCESS == result )
+            context.name( "context", *phContext );
+        return result;
+    }
+
+    ze_result_t ZE_APICALL
+    zeContextDestroy( ze_context_handle_t hContext )
+    {
+        context.record( "zeContextDestroy(" + context.lookup( hContext ) + ")" );
+        return context.zeDdiTable.Context.pfnDestroy( hContext );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Property queries record whether extension structures were chained.
+    ze_result_t ZE_APICALL
+    zeDeviceGetProperties( ze_device_handle_t hDevice, ze_device_properties_t* pDeviceProperties )
+    {
+        context.record( std::string( "zeDeviceGetProperties(" ) +
+            ( pDeviceProperties && pDeviceProperties->pNext ? "pNext" : "" ) + ")" );
+        return context.zeDdiTable.Device.pfnGetProperties( hDevice, pDeviceProperties );
+    }
+
+    // The device has three queue groups, with one to three queues, so
+    // tests can tell which part of the array was read.
+    ze_result_t ZE_APICALL
+    zeDeviceGetCommandQueueGroupProperties( ze_device_handle_t hDevice, uint32_t* pCount, ze_command_queue_group_properties_t* pCommandQueueGroupProperties )
+    {
+        if( nullptr == pCount )
+            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        context.record( "zeDeviceGetCommandQueueGroupProperties(" + std::to_string( *pCount ) + ", " +
+            ( pCommandQueueGroupProperties ? "properties" : "null" ) +
+            ( pCommandQueueGroupProperties && *pCount && pCommandQueueGroupProperties->pNext ? ", pNext" : "" ) + ")" );
+
+        const uint32_t groups = 3;
+        if( nullptr == pCommandQueueGroupProperties || 0 == *pCount || *pCount > groups )
+            *pCount = groups;
+        for( uint32_t i = 0; pCommandQueueGroupProperties && i < *pCount; ++i ) {
+            pCommandQueueGroupProperties[i].flags = i ? ZE_COMMAND_QUEUE_GROUP_PROPERTY_FLAG_COPY : ZE_COMMAND_QUEUE_GROUP_PROPERTY_FLAG_COMPUTE;
+            pCommandQueueGroupProperties[i].maxMemoryFillPatternSize = 4;
+            pCommandQueueGroupProperties[i].numQueues = i + 1;
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ze_result_t ZE_APICALL
+    zeCommandListCreate( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_list_desc_t* desc, ze_command_list_handle_t* phCommandList )
+    {
+        auto result = context.zeDdiTable.CommandList.pfnCreate( hContext, hDevice, desc, phCommandList );
+        if( ZE_RESULT_SUCCESS == result )
+            context.record( "zeCommandListCreate() = " + context.name( "list", *phCommandList ) );
+        return result;
+    }
+
+    ze_result_t ZE_APICALL
+    zeCommandListCreateImmediate( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_queue_desc_t* altdesc, ze_command_list_handle_t* phCommandList )
+    {
+        auto result = context.zeDdiTable.CommandList.pfnCreateImmediate( hContext, hDevice, altdesc, phCommandList );
+        if( ZE_RESULT_SUCCESS == result )
+            context.record( "zeCommandListCreateImmediate() = " + context.name( "list", *phCommandList ) );
+        return result;
+    }
+
+    ze_result_t ZE_APICALL
+    zeCommandListDestroy( ze_command_list_handle_t hCommandList )
+    {
+        context.record( "zeCommandListDestroy(" + context.lookup( hCommandList ) + ")" );
+        return context.zeDdiTable.CommandList.pfnDestroy( hCommandList );
+    }
+
+    ze_result_t ZE_APICALL
+    zeCommandListClose( ze_command_list_handle_t hCommandList )
+    {
+        context.record( "zeCommandListClose(" + context.lookup( hCommandList ) + ")" );
+        return context.zeDdiTable.CommandList.pfnClose( hCommandList );
+    }
+
+    ze_result_t ZE_APICALL
+    zeCommandListReset( ze_command_list_handle_t hCommandList )
+    {
+        context.record( "zeCommandListReset(" + context.lookup( hCommandList ) + ")" );
+        return context.zeDdiTable.CommandList.pfnReset( hCommandList );
+    }
+
+    ze_result_t ZE_APICALL
+    zeCommandListAppendBarrier( ze_command_list_handle_t hCommandList, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents )
+    {
+        context.record( "zeCommandListAppendBarrier(" + context.lookup( hCommandList ) + ", " +
+            context.lookup( hSignalEvent ) + ", " + context.list( numWaitEvents, phWaitEvents ) + ")" );
+        return context.zeDdiTable.CommandList.pfnAppendBarrier( hCommandList, hSignalEvent, numWaitEvents, phWaitEvents );
+    }
+
+    ze_result_t ZE_APICALL
+    zeCommandListAppendMemoryCopy( ze_command_list_handle_t hCommandList, void* dstptr, const void* srcptr, size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents )
+    {
+        context.record( "zeCommandListAppendMemoryCopy(" + context.lookup( hCommandList ) + ", " +
+            context.pointer( dstptr ) + ", " + context.pointer( srcptr ) + ", " + std::to_string( size ) + ", " +
+            context.lookup( hSignalEvent ) + ", " + context.list( numWaitEvents, phWaitEvents ) + ")" );
+        return context.zeDdiTable.CommandList.pfnAppendMemoryCopy( hCommandList, dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents );
+    }
+
+    ze_result_t ZE_APICALL
+    zeCommandListAppendSignalEvent( ze_command_list_handle_t hCommandList, ze_event_handle_t hEvent )
+    {
+        context.record( "zeCommandListAppendSignalEvent(" + context.lookup( hCommandList ) + ", " + context.lookup( hEvent ) + ")" );
+        return context.zeDdiTable.CommandList.pfnAppendSignalEvent( hCommandList, hEvent );
+    }
+
+    ze_result_t ZE_APICALL
+    zeCommandListAppendWaitOnEvents( ze_command_list_handle_t hCommandList, uint32_t numEvents, ze_event_handle_t* phEvents )
+    {
+        context.record( "zeCommandListAppendWaitOnEvents(" + context.lookup( hCommandList ) + ", " +
+            context.list( numEvents, phEvents ) + ")" );
+        return context.zeDdiTable.CommandList.pfnAppendWaitOnEvents( hCommandList, numEvents, phEvents );
+    }
+
+    ze_result_t ZE_APICALL
+    zeCommandListAppendEventReset( ze_command_list_handle_t hCommandList, ze_event_handle_t hEvent )
+    {
+        context.record( "zeCommandListAppendEventReset(" + context.lookup( hCommandList ) + ", " + context.lookup( hEvent ) + ")" );
+        return context.zeDdiTable.CommandList.pfnAppendEventReset( hCommandList, hEvent );
+    }
+
+    ze_result_t ZE_APICALL
+    zeCommandListAppendLaunchKernel( ze_command_list_handle_t hCommandList, ze_kernel_handle_t hKernel, const ze_group_count_t* pLaunchFuncArgs, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents )
+    {
+        context.record( "zeCommandListAppendLaunchKernel(" + context.lookup( hCommandList ) + ", " +
+            context.lookup( hKernel ) + ", " + context.lookup( hSignalEvent ) + ", " +
+            context.list( numWaitEvents, phWaitEvents ) + ")" );
+        return context.zeDdiTable.CommandList.pfnAppendLaunchKernel( hCommandList, hKernel, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ze_result_t ZE_APICALL
+    zeCommandQueueCreate( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_command_queue_desc_t* desc, ze_command_queue_handle_t* phCommandQueue )
+    {
+        auto result = context.zeDdiTable.CommandQueue.pfnCreate( hContext, hDevice, desc, phCommandQueue );
+        if( ZE_RESULT_SUCCESS == result )
+            context.record( "zeCommandQueueCreate() = " + context.name( "queue", *phCommandQueue ) );
+        return result;
+    }
+
+    ze_result_t ZE_APICALL
+    zeCommandQueueDestroy( ze_command_queue_handle_t hCommandQueue )
+    {
+        context.record( "zeCommandQueueDestroy(" + context.lookup( hCommandQueue ) + ")" );
+        return context.zeDdiTable.CommandQueue.pfnDestroy( hCommandQueue );
+    }
+
+    ze_result_t ZE_APICALL
+    zeFenceCreate( ze_command_queue_handle_t hCommandQueue, const ze_fence_desc_t* desc, ze_fence_handle_t* phFence )
+    {
+        auto result = context.zeDdiTable.Fence.pfnCreate( hCommandQueue, desc, phFence );
+        if( ZE_RESULT_SUCCESS == result )
+            context.record( "zeFenceCreate(" + context.lookup( hCommandQueue ) + ") = " + context.name( "fence", *phFence ) );
+        return result;
+    }
+
+    ze_result_t ZE_APICALL
+    zeFenceDestroy( ze_fence_handle_t hFence )
+    {
+        context.record( "zeFenceDestroy(" + context.lookup( hFence ) + ")" );
+        return context.zeDdiTable.Fence.pfnDestroy( hFence );
+    }
+
+    ze_result_t ZE_APICALL
+    zeFenceReset( ze_fence_handle_t hFence )
+    {
+        context.record( "zeFenceReset(" + context.lookup( hFence ) + ")" );
+        return context.zeDdiTable.Fence.pfnReset( hFence );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ze_result_t ZE_APICALL
+    zeEventPoolCreate( ze_context_handle_t hContext, const ze_event_pool_desc_t* desc, uint32_t numDevices, ze_device_handle_t* phDevices, ze_event_pool_handle_t* phEventPool )
+    {
+        auto result = context.zeDdiTable.EventPool.pfnCreate( hContext, desc, numDevices, phDevices, phEventPool );
+        if( ZE_RESULT_SUCCESS == result )
+        {
+            context.setOwner( *phEventPool, hContext );
+            context.record( "zeEventPoolCreate() = " + context.name( "pool", *phEventPool ) );
+        }
+        return result;
+    }
+
+    ze_result_t ZE_APICALL
+    zeEventPoolDestroy( ze_event_pool_handle_t hEventPool )
+    {
+        context.record( "zeEventPoolDestroy(" + context.lookup( hEventPool ) + ")" );
+        return context.zeDdiTable.EventPool.pfnDestroy( hEventPool );
+    }
+
+    // The null driver does not know the context of a pool.
+    ze_result_t ZE_APICALL
+    zeEventPoolGetContextHandle( ze_event_pool_handle_t hEventPool, ze_context_handle_t* phContext )
+    {
+        if( nullptr == phContext )
+            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        *phContext = context.owner( hEventPool );
+        return *phContext ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    ze_result_t ZE_APICALL
+    zeEventPoolGetIpcHandle( ze_event_pool_handle_t hEventPool, ze_ipc_event_pool_handle_t* phIpc )
+    {
+        if( nullptr == phIpc )
+            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        context.record( "zeEventPoolGetIpcHandle(" + context.lookup( hEventPool ) + ") = " + context.exportHandle( phIpc ) );
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZE_APICALL
+    zeEventPoolPutIpcHandle( ze_context_handle_t hContext, ze_ipc_event_pool_handle_t hIpc )
+    {
+        context.record( "zeEventPoolPutIpcHandle(" + context.handleName( hIpc ) + ")" );
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZE_APICALL
+    zeEventPoolOpenIpcHandle( ze_context_handle_t hContext, ze_ipc_event_pool_handle_t hIpc, ze_event_pool_handle_t* phEventPool )
+    {
+        auto result = context.zeDdiTable.EventPool.pfnOpenIpcHandle( hContext, hIpc, phEventPool );
+        if( ZE_RESULT_SUCCESS == result )
+            context.record( "zeEventPoolOpenIpcHandle(" + context.handleName( hIpc ) + ") = " + context.name( "pool", *phEventPool ) );
+        return result;
+    }
+
+    ze_result_t ZE_APICALL
+    zeEventPoolCloseIpcHandle( ze_event_pool_handle_t hEventPool )
+    {
+        context.record( "zeEventPoolCloseIpcHandle(" + context.lookup( hEventPool ) + ")" );
+        return context.zeDdiTable.EventPool.pfnCloseIpcHandle( hEventPool );
+    }
+
+    ze_result_t ZE_APICALL
+    zeEventCreate( ze_event_pool_handle_t hEventPool, const ze_event_desc_t* desc, ze_event_handle_t* phEvent )
+    {
+        auto result = context.zeDdiTable.Event.pfnCreate( hEventPool, desc, phEvent );
+        if( ZE_RESULT_SUCCESS == result )
+            context.record( "zeEventCreate(" + context.lookup( hEventPool ) + ") = " + context.name( "event", *phEvent ) );
+        return result;
+    }
+
+    ze_result_t ZE_APICALL
+    zeEventDestroy( ze_event_handle_t hEvent )
+    {
+        context.record( "zeEventDestroy(" + context.lookup( hEvent ) + ")" );
+        return context.zeDdiTable.Event.pfnDestroy( hEvent );
+    }
+
+    ze_result_t ZE_APICALL
+    zeEventHostReset( ze_event_handle_t hEvent )
+    {
+        context.record( "zeEventHostReset(" + context.lookup( hEvent ) + ")" );
+        return context.zeDdiTable.Event.pfnHostReset( hEvent );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ze_result_t ZE_APICALL
+    zeMemAllocShared( ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr )
+    {
+        auto result = context.allocate( size, alignment, pptr );
+        if( ZE_RESULT_SUCCESS == result )
+            context.record( "zeMemAllocShared(" + std::to_string( size ) + ") = " + context.lookup( *pptr ) );
+        return result;
+    }
+
+    ze_result_t ZE_APICALL
+    zeMemAllocDevice( ze_context_handle_t hContext, const ze_device_mem_alloc_desc_t* device_desc, size_t size, size_t alignment, ze_device_handle_t hDevice, void** pptr )
+    {
+        auto result = context.allocate( size, alignment, pptr );
+        if( ZE_RESULT_SUCCESS == result )
+            context.record( "zeMemAllocDevice(" + std::to_string( size ) + ") = " + context.lookup( *pptr ) );
+        return result;
+    }
+
+    ze_result_t ZE_APICALL
+    zeMemAllocHost( ze_context_handle_t hContext, const ze_host_mem_alloc_desc_t* host_desc, size_t size, size_t alignment, void** pptr )
+    {
+        auto result = context.allocate( size, alignment, pptr );
+        if( ZE_RESULT_SUCCESS == result )
+            context.record( "zeMemAllocHost(" + std::to_string( size ) + ") = " + context.lookup( *pptr ) );
+        return result;
+    }
+
+    ze_result_t ZE_APICALL
+    zeMemFree( ze_context_handle_t hContext, void* ptr )
+    {
+        context.record( "zeMemFree(" + context.pointer( ptr ) + ")" );
+        context.free( ptr );
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZE_APICALL
+    zeMemGetAddressRange( ze_context_handle_t hContext, const void* ptr, void** pBase, size_t* pSize )
+    {
+        uintptr_t base = 0;
+        size_t size = 0;
+        if( !context.range( ptr, base, size ) )
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        if( pBase )
+            *pBase = reinterpret_cast<void *>( base );
+        if( pSize )
+            *pSize = size;
+        return ZE_RESULT_SUCCESS;
+    }
+
+    // Allocations opened from IPC handles are placed in the arena as well.
+    ze_result_t ZE_APICALL
+    zeMemGetIpcHandle( ze_context_handle_t hContext, const void* ptr, ze_ipc_mem_handle_t* pIpcHandle )
+    {
+        if( nullptr == pIpcHandle )
+            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        context.record( "zeMemGetIpcHandle(" + context.pointer( ptr ) + ") = " + context.exportHandle( pIpcHandle ) );
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZE_APICALL
+    zeMemPutIpcHandle( ze_context_handle_t hContext, ze_ipc_mem_handle_t handle )
+    {
+        context.record( "zeMemPutIpcHandle(" + context.handleName( handle ) + ")" );
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZE_APICALL
+    zeMemOpenIpcHandle( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_ipc_mem_handle_t handle, ze_ipc_memory_flags_t flags, void** pptr )
+    {
+        auto result = context.allocate( 64, 0, pptr, "opened" );
+        if( ZE_RESULT_SUCCESS == result )
+            context.record( "zeMemOpenIpcHandle(" + context.handleName( handle ) + ") = " + context.lookup( *pptr ) );
+        return result;
+    }
+
+    ze_result_t ZE_APICALL
+    zeMemCloseIpcHandle( ze_context_handle_t hContext, const void* ptr )
+    {
+        context.record( "zeMemCloseIpcHandle(" + context.pointer( ptr ) + ")" );
+        context.free( const_cast<void *>( ptr ) );
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Reservations are placed in the arena as well, so pointers into them
+    // are named as offsets; only a pointer a test maps is written to.
+    ze_result_t ZE_APICALL
+    zeVirtualMemReserve( ze_context_handle_t hContext, const void* pStart, size_t size, void** pptr )
+    {
+        auto result = context.allocate( size, 4096, pptr, "virtual" );
+        if( ZE_RESULT_SUCCESS == result )
+            context.record( "zeVirtualMemReserve(" + std::to_string( size ) + ") = " + context.lookup( *pptr ) );
+        return result;
+    }
+
+    ze_result_t ZE_APICALL
+    zeVirtualMemFree( ze_context_handle_t hContext, const void* ptr, size_t size )
+    {
+        context.record( "zeVirtualMemFree(" + context.pointer( ptr ) + ", " + std::to_string( size ) + ")" );
+        context.free( const_cast<void *>( ptr ) );
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZE_APICALL
+    zeVirtualMemMap( ze_context_handle_t hContext, const void* ptr, size_t size, ze_physical_mem_handle_t hPhysicalMemory, size_t offset, ze_memory_access_attribute_t access )
+    {
+        context.record( "zeVirtualMemMap(" + context.pointer( ptr ) + ", " + std::to_string( size ) + ", " +
+            context.lookup( hPhysicalMemory ) + ")" );
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZE_APICALL
+    zeVirtualMemUnmap( ze_context_handle_t hContext, const void* ptr, size_t size )
+    {
+        context.record( "zeVirtualMemUnmap(" + context.pointer( ptr ) + ", " + std::to_string( size ) + ")" );
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZE_APICALL
+    zePhysicalMemCreate( ze_context_handle_t hContext, ze_device_handle_t hDevice, ze_physical_mem_desc_t* desc, ze_physical_mem_handle_t* phPhysicalMemory )
+    {
+        auto result = context.zeDdiTable.PhysicalMem.pfnCreate( hContext, hDevice, desc, phPhysicalMemory );
+        if( ZE_RESULT_SUCCESS == result )
+            context.record( "zePhysicalMemCreate() = " + context.name( "physical", *phPhysicalMemory ) );
+        return result;
+    }
+
+    ze_result_t ZE_APICALL
+    zePhysicalMemDestroy( ze_context_handle_t hContext, ze_physical_mem_handle_t hPhysicalMemory )
+    {
+        context.record( "zePhysicalMemDestroy(" + context.lookup( hPhysicalMemory ) + ")" );
+        return context.zeDdiTable.PhysicalMem.pfnDestroy( hContext, hPhysicalMemory );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ze_result_t ZE_APICALL
+    zeModuleCreate( ze_context_handle_t hContext, ze_device_handle_t hDevice, const ze_module_desc_t* desc, ze_module_handle_t* phModule, ze_module_build_log_handle_t* phBuildLog )
+    {
+        std::string input = "spirv";
+        if( desc && ZE_MODULE_FORMAT_NATIVE == desc->format )
+            input = "native " + std::string( reinterpret_cast<const char *>( desc->pInputModule ), desc->inputSize );
+        auto result = context.zeDdiTable.Module.pfnCreate( hContext, hDevice, desc, phModule, phBuildLog );
+        if( ZE_RESULT_SUCCESS == result )
+            context.record( "zeModuleCreate(" + input + ") = " + context.name( "module", *phModule ) );
+        return result;
+    }
+
+    // The native binary of a module is its name, so a module created from
+    // it records which module it was taken from.
+    ze_result_t ZE_APICALL
+    zeModuleGetNativeBinary( ze_module_handle_t hModule, size_t* pSize, uint8_t* pModuleNativeBinary )
+    {
+        if( nullptr == pSize )
+            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        context.record( "zeModuleGetNativeBinary(" + context.lookup( hModule ) + ")" );
+        auto binary = context.lookup( hModule );
+        if( pModuleNativeBinary )
+            memcpy( pModuleNativeBinary, binary.data(), std::min( *pSize, binary.size() ) );
+        *pSize = binary.size();
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZE_APICALL
+    zeModuleDestroy( ze_module_handle_t hModule )
+    {
+        context.record( "zeModuleDestroy(" + context.lookup( hModule ) + ")" );
+        return context.zeDdiTable.Module.pfnDestroy( hModule );
+    }
+
+    // Every module has the kernels copy and fill.
+    ze_result_t ZE_APICALL
+    zeModuleGetKernelNames( ze_module_handle_t hModule, uint32_t* pCount, const char** pNames )
+    {
+        if( nullptr == pCount )
+            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        context.record( "zeModuleGetKernelNames(" + context.lookup( hModule ) + ", " + std::to_string( *pCount ) + ", " +
+            ( pNames ? "names" : "null" ) + ")" );
+        static const char *names[] = { "copy", "fill" };
+        const uint32_t count = 2;
+        if( nullptr == pNames || 0 == *pCount || *pCount > count )
+            *pCount = count;
+        for( uint32_t i = 0; pNames && i < *pCount; ++i )
+            pNames[i] = names[i];
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZE_APICALL
+    zeKernelCreate( ze_module_handle_t hModule, const ze_kernel_desc_t* desc, ze_kernel_handle_t* phKernel )
+    {
+        auto result = context.zeDdiTable.Kernel.pfnCreate( hModule, desc, phKernel );
+        if( ZE_RESULT_SUCCESS == result )
+            context.record( "zeKernelCreate(" + context.lookup( hModule ) + ", " +
+                std::string( desc && desc->pKernelName ? desc->pKernelName : "" ) + ") = " +
+                context.name( "kernel", *phKernel ) );
+        return result;
+    }
+
+    ze_result_t ZE_APICALL
+    zeKernelDestroy( ze_kernel_handle_t hKernel )
+    {
+        context.record( "zeKernelDestroy(" + context.lookup( hKernel ) + ")" );
+        return context.zeDdiTable.Kernel.pfnDestroy( hKernel );
+    }
+
+    ze_result_t ZE_APICALL
+    zeKernelGetProperties( ze_kernel_handle_t hKernel, ze_kernel_properties_t* pKernelProperties )
+    {
+        context.record( "zeKernelGetProperties(" + context.lookup( hKernel ) +
+            ( pKernelProperties && pKernelProperties->pNext ? ", pNext" : "" ) + ")" );
+        if( nullptr == pKernelProperties )
+            return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+        pKernelProperties->numKernelArgs = 2;
+        pKernelProperties->maxSubgroupSize = 32;
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZE_APICALL
+    zeKernelGetName( ze_kernel_handle_t hKernel, size_t* pSize, char* pName )
+    {
+        context.record( "zeKernelGetName(" + context.lookup( hKernel ) + ")" );
+        return context.zeDdiTable.Kernel.pfnGetName( hKernel, pSize, pName );
+    }
+
+    ze_result_t ZE_APICALL
+    zeKernelSetArgumentValue( ze_kernel_handle_t hKernel, uint32_t argIndex, size_t argSize, const void* pArgValue )
+    {
+        context.record( "zeKernelSetArgumentValue(" + context.lookup( hKernel ) + ", " + std::to_string( argIndex ) + ", " +
+            std::to_string( argSize ) + ", " + context.argument( argSize, pArgValue ) + ")" );
+        return context.zeDdiTable.Kernel.pfnSetArgumentValue( hKernel, argIndex, argSize, pArgValue );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    ze_result_t ZE_APICALL
+    zetCommandListAppendMetricStreamerMarker( zet_command_list_handle_t hCommandList, zet_metric_streamer_handle_t hMetricStreamer, uint32_t value )
+    {
+        context.record( "zetCommandListAppendMetricStreamerMarker(" + context.lookup( hCommandList ) + ")" );
+        return context.zetDdiTable.CommandList.pfnAppendMetricStreamerMarker( hCommandList, hMetricStreamer, value );
+    }
+
+    ze_result_t ZE_APICALL
+    zetCommandListAppendMetricQueryBegin( zet_command_list_handle_t hCommandList, zet_metric_query_handle_t hMetricQuery )
+    {
+        context.record( "zetCommandListAppendMetricQueryBegin(" + context.lookup( hCommandList ) + ")" );
+        return context.zetDdiTable.CommandList.pfnAppendMetricQueryBegin( hCommandList, hMetricQuery );
+    }
+
+    ze_result_t ZE_APICALL
+    zetCommandListAppendMetricQueryEnd( zet_command_list_handle_t hCommandList, zet_metric_query_handle_t hMetricQuery, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t* phWaitEvents )
+    {
+        context.record( "zetCommandListAppendMetricQueryEnd(" + context.lookup( hCommandList ) + ", " +
+            context.lookup( hSignalEvent ) + ", " + context.list( numWaitEvents, phWaitEvents ) + ")" );
+        return context.zetDdiTable.CommandList.pfnAppendMetricQueryEnd( hCommandList, hMetricQuery, hSignalEvent, numWaitEvents, phWaitEvents );
+    }
+
+    ze_result_t ZE_APICALL
+    zetCommandListAppendMetricMemoryBarrier( zet_command_list_handle_t hCommandList )
+    {
+        context.record( "zetCommandListAppendMetricMemoryBarrier(" + context.lookup( hCommandList ) + ")" );
+        return context.zetDdiTable.CommandList.pfnAppendMetricMemoryBarrier( hCommandList );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // The function of the driver's only extension, which appends a marker
+    // to a command list.
+    ze_result_t ZE_APICALL
+    zexCaptureAppendMarker( ze_command_list_handle_t hCommandList )
+    {
+        context.record( "zexCaptureAppendMarker(" + context.lookup( hCommandList ) + ")" );
+        return ZE_RESULT_SUCCESS;
+    }
+
+    ze_result_t ZE_APICALL
+    zeDriverGetExtensionFunctionAddress( ze_driver_handle_t hDriver, const char* name, void** ppFunctionAddress )
+    {
+        if( name && std::string( name ) == "zexCaptureAppendMarker" ) {
+            *ppFunctionAddress = reinterpret_cast<void *>( zexCaptureAppendMarker );
+            return ZE_RESULT_SUCCESS;
+        }
+        return context.zeDdiTable.Driver.pfnGetExtensionFunctionAddress( hDriver, name, ppFunctionAddress );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Replaces the entries of a table the null driver filled with the
+    // functions recording them; most tables are passed on untouched.
+    template <typename table_t>
+    void capture( table_t * ) {}
+
+    void capture( ze_context_dditable_t *pDdiTable )
+    {
+        context.zeDdiTable.Context = *pDdiTable;
+        pDdiTable->pfnCreate = zeContextCreate;
+        pDdiTable->pfnDestroy = zeContextDestroy;
+    }
+
+    void capture( ze_driver_dditable_t *pDdiTable )
+    {
+        context.zeDdiTable.Driver = *pDdiTable;
+        pDdiTable->pfnGetExtensionFunctionAddress = zeDriverGetExtensionFunctionAddress;
+    }
+
+    void capture( ze_device_dditable_t *pDdiTable )
+    {
+        context.zeDdiTable.Device = *pDdiTable;
+        pDdiTable->pfnGetProperties = zeDeviceGetProperties;
+        pDdiTable->pfnGetCommandQueueGroupProperties = zeDeviceGetCommandQueueGroupProperties;
+    }
+
+    void capture( ze_command_list_dditable_t *pDdiTable )
+    {
+        context.zeDdiTable.CommandList = *pDdiTable;
+        pDdiTable->pfnCreate = zeCommandListCreate;
+        pDdiTable->pfnCreateImmediate = zeCommandListCreateImmediate;
+        pDdiTable->pfnDestroy = zeCommandListDestroy;
+        pDdiTable->pfnClose = zeCommandListClose;
+        pDdiTable->pfnReset = zeCommandListReset;
+        pDdiTable->pfnAppendBarrier = zeCommandListAppendBarrier;
+        pDdiTable->pfnAppendMemoryCopy = zeCommandListAppendMemoryCopy;
+        pDdiTable->pfnAppendSignalEvent = zeCommandListAppendSignalEvent;
+        pDdiTable->pfnAppendWaitOnEvents = zeCommandListAppendWaitOnEvents;
+        pDdiTable->pfnAppendEventReset = zeCommandListAppendEventReset;
+        pDdiTable->pfnAppendLaunchKernel = zeCommandListAppendLaunchKernel;
+    }
+
+    void capture( ze_command_queue_dditable_t *pDdiTable )
+    {
+        context.zeDdiTable.CommandQueue = *pDdiTable;
+        pDdiTable->pfnCreate = zeCommandQueueCreate;
+        pDdiTable->pfnDestroy = zeCommandQueueDestroy;
+    }
+
+    void capture( ze_fence_dditable_t *pDdiTable )
+    {
+        context.zeDdiTable.Fence = *pDdiTable;
+        pDdiTable->pfnCreate = zeFenceCreate;
+        pDdiTable->pfnDestroy = zeFenceDestroy;
+        pDdiTable->pfnReset = zeFenceReset;
+    }
+
+    void capture( ze_event_pool_dditable_t *pDdiTable )
+    {
+        context.zeDdiTable.EventPool = *pDdiTable;
+        pDdiTable->pfnCreate = zeEventPoolCreate;
+        pDdiTable->pfnDestroy = zeEventPoolDestroy;
+        pDdiTable->pfnGetContextHandle = zeEventPoolGetContextHandle;
+        pDdiTable->pfnGetIpcHandle = zeEventPoolGetIpcHandle;
+        pDdiTable->pfnPutIpcHandle = zeEventPoolPutIpcHandle;
+        pDdiTable->pfnOpenIpcHandle = zeEventPoolOpenIpcHandle;
+        pDdiTable->pfnCloseIpcHandle = zeEventPoolCloseIpcHandle;
+    }
+
+    void capture( ze_event_dditable_t *pDdiTable )
+    {
+        context.zeDdiTable.Event = *pDdiTable;
+        pDdiTable->pfnCreate = zeEventCreate;
+        pDdiTable->pfnDestroy = zeEventDestroy;
+        pDdiTable->pfnHostReset = zeEventHostReset;
+    }
+
+    void capture( ze_mem_dditable_t *pDdiTable )
+    {
+        context.zeDdiTable.Mem = *pDdiTable;
+        pDdiTable->pfnAllocShared = zeMemAllocShared;
+        pDdiTable->pfnAllocDevice = zeMemAllocDevice;
+        pDdiTable->pfnAllocHost = zeMemAllocHost;
+        pDdiTable->pfnFree = zeMemFree;
+        pDdiTable->pfnGetAddressRange = zeMemGetAddressRange;
+        pDdiTable->pfnGetIpcHandle = zeMemGetIpcHandle;
+        pDdiTable->pfnPutIpcHandle = zeMemPutIpcHandle;
+        pDdiTable->pfnOpenIpcHandle = zeMemOpenIpcHandle;
+        pDdiTable->pfnCloseIpcHandle = zeMemCloseIpcHandle;
+    }
+
+    void capture( ze_virtual_mem_dditable_t *pDdiTable )
+    {
+        context.zeDdiTable.VirtualMem = *pDdiTable;
+        pDdiTable->pfnReserve = zeVirtualMemReserve;
+        pDdiTable->pfnFree = zeVirtualMemFree;
+        pDdiTable->pfnMap = zeVirtualMemMap;
+        pDdiTable->pfnUnmap = zeVirtualMemUnmap;
+    }
+
+    void capture( ze_physical_mem_dditable_t *pDdiTable )
+    {
+        context.zeDdiTable.PhysicalMem = *pDdiTable;
+        pDdiTable->pfnCreate = zePhysicalMemCreate;
+        pDdiTable->pfnDestroy = zePhysicalMemDestroy;
+    }
+
+    void capture( ze_module_dditable_t *pDdiTable )
+    {
+        context.zeDdiTable.Module = *pDdiTable;
+        pDdiTable->pfnCreate = zeModuleCreate;
+        pDdiTable->pfnDestroy = zeModuleDestroy;
+        pDdiTable->pfnGetNativeBinary = zeModuleGetNativeBinary;
+        pDdiTable->pfnGetKernelNames = zeModuleGetKernelNames;
+    }
+
+    void capture( ze_kernel_dditable_t *pDdiTable )
+    {
+        context.zeDdiTable.Kernel = *pDdiTable;
+        pDdiTable->pfnCreate = zeKernelCreate;
+        pDdiTable->pfnDestroy = zeKernelDestroy;
+        pDdiTable->pfnSetArgumentValue = zeKernelSetArgumentValue;
+        pDdiTable->pfnGetProperties = zeKernelGetProperties;
+        pDdiTable->pfnGetName = zeKernelGetName;
+    }
+
+    void capture( zet_command_list_dditable_t *pDdiTable )
+    {
+        context.zetDdiTable.CommandList = *pDdiTable;
+        pDdiTable->pfnAppendMetricStreamerMarker = zetCommandListAppendMetricStreamerMarker;
+        pDdiTable->pfnAppendMetricQueryBegin = zetCommandListAppendMetricQueryBegin;
+        pDdiTable->pfnAppendMetricQueryEnd = zetCommandListAppendMetricQueryEnd;
+        pDdiTable->pfnAppendMetricMemoryBarrier = zetCommandListAppendMetricMemoryBarrier;
+    }
+
+    template <typename table_t>
+    ze_result_t getTable( const char *name, ze_api_version_t version, table_t *pDdiTable )
+    {
+        if( nullptr == context.nullDriver )
+            return ZE_RESULT_ERROR_UNINITIALIZED;
+        auto getTable = reinterpret_cast<ze_result_t (ZE_APICALL *)( ze_api_version_t, table_t * )>(
+            GET_FUNCTION_PTR( context.nullDriver, name ) );
+        if( nullptr == getTable )
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        auto result = getTable( version, pDdiTable );
+        if( ZE_RESULT_SUCCESS == result )
+            capture( pDdiTable );
+        return result;
+    }
+
+} // namespace capture_driver
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#define CAPTURE_DRIVER_GET_TABLE( NAME, TABLE_T )                               \
+    ZE_DLLEXPORT ze_result_t ZE_APICALL                                         \
+    NAME( ze_api_version_t version, TABLE_T *pDdiTable )                        \
+    {                                                                           \
+        return capture_driver::getTable( #NAME, version, pDdiTable );           \
+    }
+
+CAPTURE_DRIVER_GET_TABLE( zeGetGlobalProcAddrTable, ze_global_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetRTASBuilderExpProcAddrTable, ze_rtas_builder_exp_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetRTASParallelOperationExpProcAddrTable, ze_rtas_parallel_operation_exp_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetDriverProcAddrTable, ze_driver_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetDriverExpProcAddrTable, ze_driver_exp_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetDeviceProcAddrTable, ze_device_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetDeviceExpProcAddrTable, ze_device_exp_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetContextProcAddrTable, ze_context_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetCommandQueueProcAddrTable, ze_command_queue_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetCommandListProcAddrTable, ze_command_list_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetCommandListExpProcAddrTable, ze_command_list_exp_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetEventProcAddrTable, ze_event_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetEventExpProcAddrTable, ze_event_exp_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetEventPoolProcAddrTable, ze_event_pool_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetFenceProcAddrTable, ze_fence_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetImageProcAddrTable, ze_image_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetImageExpProcAddrTable, ze_image_exp_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetKernelProcAddrTable, ze_kernel_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetKernelExpProcAddrTable, ze_kernel_exp_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetMemProcAddrTable, ze_mem_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetMemExpProcAddrTable, ze_mem_exp_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetModuleProcAddrTable, ze_module_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetModuleBuildLogProcAddrTable, ze_module_build_log_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetPhysicalMemProcAddrTable, ze_physical_mem_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetSamplerProcAddrTable, ze_sampler_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetVirtualMemProcAddrTable, ze_virtual_mem_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetFabricEdgeExpProcAddrTable, ze_fabric_edge_exp_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zeGetFabricVertexExpProcAddrTable, ze_fabric_vertex_exp_dditable_t )
+
+CAPTURE_DRIVER_GET_TABLE( zetGetMetricProgrammableExpProcAddrTable, zet_metric_programmable_exp_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zetGetDeviceProcAddrTable, zet_device_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zetGetContextProcAddrTable, zet_context_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zetGetCommandListProcAddrTable, zet_command_list_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zetGetKernelProcAddrTable, zet_kernel_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zetGetModuleProcAddrTable, zet_module_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zetGetDebugProcAddrTable, zet_debug_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zetGetMetricProcAddrTable, zet_metric_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zetGetMetricExpProcAddrTable, zet_metric_exp_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zetGetMetricGroupProcAddrTable, zet_metric_group_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zetGetMetricGroupExpProcAddrTable, zet_metric_group_exp_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zetGetMetricQueryProcAddrTable, zet_metric_query_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zetGetMetricQueryPoolProcAddrTable, zet_metric_query_pool_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zetGetMetricStreamerProcAddrTable, zet_metric_streamer_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zetGetTracerExpProcAddrTable, zet_tracer_exp_dditable_t )
+
+CAPTURE_DRIVER_GET_TABLE( zesGetGlobalProcAddrTable, zes_global_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zesGetDeviceProcAddrTable, zes_device_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zesGetDeviceExpProcAddrTable, zes_device_exp_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zesGetDriverProcAddrTable, zes_driver_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zesGetDriverExpProcAddrTable, zes_driver_exp_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zesGetDiagnosticsProcAddrTable, zes_diagnostics_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zesGetEngineProcAddrTable, zes_engine_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zesGetFabricPortProcAddrTable, zes_fabric_port_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zesGetFanProcAddrTable, zes_fan_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zesGetFirmwareProcAddrTable, zes_firmware_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zesGetFirmwareExpProcAddrTable, zes_firmware_exp_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zesGetFrequencyProcAddrTable, zes_frequency_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zesGetLedProcAddrTable, zes_led_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zesGetMemoryProcAddrTable, zes_memory_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zesGetOverclockProcAddrTable, zes_overclock_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zesGetPerformanceFactorProcAddrTable, zes_performance_factor_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zesGetPowerProcAddrTable, zes_power_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zesGetPsuProcAddrTable, zes_psu_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zesGetRasProcAddrTable, zes_ras_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zesGetRasExpProcAddrTable, zes_ras_exp_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zesGetSchedulerProcAddrTable, zes_scheduler_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zesGetStandbyProcAddrTable, zes_standby_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zesGetTemperatureProcAddrTable, zes_temperature_dditable_t )
+CAPTURE_DRIVER_GET_TABLE( zesGetVFManagementExpProcAddrTable, zes_vf_management_exp_dditable_t )
+
+///////////////////////////////////////////////////////////////////////////////
+// Returns the calls recorded since the last time, one per line; the text
+// stays valid until the next call.
+ZE_DLLEXPORT const char *
+captureDriverTakeLog()
+{
+    static std::string taken;
+    taken = capture_driver::context.take();
+    return taken.c_str();
+}
+
+// Holds the next call starting with the text in the driver, until it is
+// released; waiting returns once a call is held.
+ZE_DLLEXPORT void
+captureDriverHoldCall( const char *call )
+{
+    capture_driver::context.holdCall( call );
+}
+
+ZE_DLLEXPORT void
+captureDriverWaitHeld()
+{
+    capture_driver::context.waitHeld();
+}
+
+ZE_DLLEXPORT void
+captureDriverRelease()
+{
+    capture_driver::context.release();
+}
+
+#if defined(__cplusplus)
+};
+#endif
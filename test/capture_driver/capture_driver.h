@@ -0,0 +1,89 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+#pragma once
+
+// Helpers for the tests that run against the capture driver: the calls
+// that reached the driver are read from the library the loader loaded.
+
+#include "ze_util.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace capture_driver
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // Calls a function of the library the loader loaded.
+    template <typename result_t, typename... args_t>
+    inline result_t call( const char *name, args_t... args )
+    {
+        auto path = getenv( "ZE_ENABLE_ALT_DRIVERS" );
+        auto handle = path ? LOAD_DRIVER_LIBRARY( path ) : nullptr;
+        auto function = handle ? reinterpret_cast<result_t (*)( args_t... )>( GET_FUNCTION_PTR( handle, name ) ) : nullptr;
+        if( nullptr == function ) {
+            fprintf( stderr, "capture driver not loaded\n" );
+            exit( 1 );
+        }
+        // The loader keeps the library loaded.
+        FREE_DRIVER_LIBRARY( handle );
+        return function( args... );
+    }
+
+    // Returns the calls the driver recorded since the last time, one per
+    // entry.
+    inline std::vector<std::string> takeCalls()
+    {
+        std::vector<std::string> calls;
+        std::string log = call<const char *>( "captureDriverTakeLog" );
+        size_t begin = 0;
+        for( auto end = log.find( '\n' ); end != std::string::npos; end = log.find( '\n', begin ) ) {
+            calls.push_back( log.substr( begin, end - begin ) );
+            begin = end + 1;
+        }
+        return calls;
+    }
+
+    // Holds the next call whose record starts with the text in the driver;
+    // waitHeld() returns once such a call is held, and release() lets it
+    // return.
+    inline void holdCall( const char *call )
+    {
+        capture_driver::call<void>( "captureDriverHoldCall", call );
+    }
+
+    inline void waitHeld()
+    {
+        call<void>( "captureDriverWaitHeld" );
+    }
+
+    inline void release()
+    {
+        call<void>( "captureDriverRelease" );
+    }
+
+    // Checks that the calls recorded since the last time are the expected
+    // ones, and prints both otherwise.
+    inline bool expectCalls( const char *what, const std::vector<std::string> &expected )
+    {
+        auto calls = takeCalls();
+        if( calls == expected )
+            return true;
+
+        fprintf( stderr, "%s: unexpected calls to the driver\n", what );
+        fprintf( stderr, "expected:\n" );
+        for( auto &call : expected )
+            fprintf( stderr, "    %s\n", call.c_str() );
+        fprintf( stderr, "got:\n" );
+        for( auto &call : calls )
+            fprintf( stderr, "    %s\n", call.c_str() );
+        return false;
+    }
+
+} // namespace capture_driver
@@ -0,0 +1,19 @@
+# Copyright (C) 2024 Intel Corporation
+# SPDX-License-Identifier: MIT
+
+# Runs TEST_COMMAND and fails unless it returns 0 and, when TEST_OUTPUT is
+# set, its output matches it; the optimization layer prints its report to
+# stderr when unloaded, after the test itself returned.
+execute_process(
+    COMMAND ${TEST_COMMAND}
+    RESULT_VARIABLE result
+    OUTPUT_VARIABLE output
+    ERROR_VARIABLE output
+)
+message("${output}")
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${TEST_COMMAND} returned ${result}")
+endif()
+if(DEFINED TEST_OUTPUT AND NOT output MATCHES "${TEST_OUTPUT}")
+    message(FATAL_ERROR "output does not match \"${TEST_OUTPUT}\"")
+endif()
@@ -0,0 +1,385 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Checks the barriers and wait lists the barrier pruning of the
+// optimization layer sends to the capture driver, one scenario per run:
+//   back_to_back   barriers without events directly following a barrier,
+//                  and barriers after a metric command or with waits
+//   in_order       waits repeated on an in-order command list
+//   out_of_order   waits repeated on a command list before and after a
+//                  barrier
+//   resets         waits repeated around host and in-list event resets
+//   re_signal      waits repeated on a counter-based event another command
+//                  list signals again in between
+//   extension      nothing pruned once an extension function was handed out
+//   mutable        nothing pruned on a command list created with a pNext
+//                  chain
+// Every scenario checks the exact calls the driver received; the report
+// the layer prints when unloaded is matched by the test registration.
+
+#include "ze_api.h"
+#include "zet_api.h"
+#include "capture_driver.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace {
+
+void setDefaultEnv(const char *name, const char *value) {
+    if (getenv(name) != nullptr)
+        return;
+#if defined(_WIN32)
+    _putenv_s(name, value);
+#else
+    setenv(name, value, 0);
+#endif
+}
+
+int fail(const char *call, ze_result_t result) {
+    fprintf(stderr, "%s failed: 0x%x\n", call, static_cast<unsigned>(result));
+    return 1;
+}
+
+// The calls the capture driver records, with the names it gives the
+// handles of the fixture.
+std::string barrier(const char *list, const char *signal, const char *waits) {
+    return std::string("zeCommandListAppendBarrier(") + list + ", " + signal + ", " + waits + ")";
+}
+
+std::string copy(const char *list, const char *signal, const char *waits) {
+    return std::string("zeCommandListAppendMemoryCopy(") + list + ", alloc1+0, alloc0+0, 64, " + signal + ", " +
+           waits + ")";
+}
+
+std::string waitOnEvents(const char *list, const char *events) {
+    return std::string("zeCommandListAppendWaitOnEvents(") + list + ", " + events + ")";
+}
+
+std::string created(const char *list) {
+    return std::string("zeCommandListCreate() = ") + list;
+}
+
+std::string destroyed(const char *list) {
+    return std::string("zeCommandListDestroy(") + list + ")";
+}
+
+struct fixture_t {
+    ze_driver_handle_t hDriver = nullptr;
+    ze_context_handle_t hContext = nullptr;
+    ze_device_handle_t hDevice = nullptr;
+    ze_event_handle_t hEvents[2] = {};
+    void *src = nullptr;
+    void *dst = nullptr;
+
+    ze_command_list_handle_t createList(ze_command_list_flags_t flags, const void *pNext = nullptr) {
+        ze_command_list_desc_t desc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC, pNext, 0, flags};
+        ze_command_list_handle_t hCommandList = nullptr;
+        zeCommandListCreate(hContext, hDevice, &desc, &hCommandList);
+        return hCommandList;
+    }
+
+    // A copy stands for any command with a wait list.
+    ze_result_t copy(ze_command_list_handle_t hCommandList, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents,
+                     ze_event_handle_t *phWaitEvents) {
+        return zeCommandListAppendMemoryCopy(hCommandList, dst, src, 64, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
+
+    ze_result_t barrier(ze_command_list_handle_t hCommandList, ze_event_handle_t hSignalEvent = nullptr,
+                        uint32_t numWaitEvents = 0, ze_event_handle_t *phWaitEvents = nullptr) {
+        return zeCommandListAppendBarrier(hCommandList, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
+};
+
+// The first barrier is appended and the next two are removed; a barrier
+// with a signal event is kept, and one directly after it removed. A
+// barrier after a metric command, and one with an event left to wait on,
+// are kept.
+bool backToBack(fixture_t &fixture) {
+    auto event0 = fixture.hEvents[0];
+    auto event1 = fixture.hEvents[1];
+    auto hList = fixture.createList(0);
+    fixture.barrier(hList);
+    fixture.barrier(hList);
+    fixture.barrier(hList);
+    fixture.barrier(hList, event0);
+    fixture.barrier(hList);
+    fixture.copy(hList, nullptr, 0, nullptr);
+    fixture.barrier(hList);
+    zetCommandListAppendMetricQueryBegin(hList, nullptr);
+    fixture.barrier(hList);
+    zetCommandListAppendMetricMemoryBarrier(hList);
+    fixture.barrier(hList);
+    fixture.barrier(hList, nullptr, 1, &event1);
+    zeCommandListDestroy(hList);
+    return capture_driver::expectCalls("back_to_back", {
+        created("list0"),
+        barrier("list0", "null", "[]"),
+        barrier("list0", "event0", "[]"),
+        copy("list0", "null", "[]"),
+        barrier("list0", "null", "[]"),
+        "zetCommandListAppendMetricQueryBegin(list0)",
+        barrier("list0", "null", "[]"),
+        "zetCommandListAppendMetricMemoryBarrier(list0)",
+        barrier("list0", "null", "[]"),
+        barrier("list0", "null", "[event1]"),
+        destroyed("list0"),
+    });
+}
+
+// Every command of an in-order list follows the waits of the previous
+// ones, so repeated events are removed from wait lists, and a wait left
+// without events with its call; new events are kept.
+bool inOrder(fixture_t &fixture) {
+    auto hList = fixture.createList(ZE_COMMAND_LIST_FLAG_IN_ORDER);
+    fixture.copy(hList, nullptr, 1, &fixture.hEvents[0]);
+    fixture.copy(hList, nullptr, 1, &fixture.hEvents[0]);
+    zeCommandListAppendWaitOnEvents(hList, 1, &fixture.hEvents[0]);
+    fixture.copy(hList, nullptr, 2, fixture.hEvents);
+    zeCommandListAppendWaitOnEvents(hList, 2, fixture.hEvents);
+    zeCommandListDestroy(hList);
+    return capture_driver::expectCalls("in_order", {
+        created("list0"),
+        copy("list0", "null", "[event0]"),
+        copy("list0", "null", "[]"),
+        copy("list0", "null", "[event1]"),
+        destroyed("list0"),
+    });
+}
+
+// Later commands may overtake a command of an out-of-order list until a
+// barrier follows it, so only the waits after the barrier are removed.
+bool outOfOrder(fixture_t &fixture) {
+    auto hList = fixture.createList(0);
+    fixture.copy(hList, nullptr, 1, &fixture.hEvents[0]);
+    fixture.copy(hList, nullptr, 1, &fixture.hEvents[0]);
+    fixture.barrier(hList);
+    fixture.copy(hList, nullptr, 1, &fixture.hEvents[0]);
+    zeCommandListAppendWaitOnEvents(hList, 2, fixture.hEvents);
+    zeCommandListDestroy(hList);
+    return capture_driver::expectCalls("out_of_order", {
+        created("list0"),
+        copy("list0", "null", "[event0]"),
+        copy("list0", "null", "[event0]"),
+        barrier("list0", "null", "[]"),
+        copy("list0", "null", "[]"),
+        waitOnEvents("list0", "[event1]"),
+        destroyed("list0"),
+    });
+}
+
+// A reset event is waited on again once, after a host reset as after a
+// reset in another command list.
+bool resets(fixture_t &fixture) {
+    auto event0 = fixture.hEvents[0];
+    auto hList = fixture.createList(ZE_COMMAND_LIST_FLAG_IN_ORDER);
+    auto hOther = fixture.createList(0);
+    fixture.copy(hList, nullptr, 1, &event0);
+    zeEventHostReset(event0);
+    fixture.copy(hList, nullptr, 1, &event0);
+    fixture.copy(hList, nullptr, 1, &event0);
+    zeCommandListAppendEventReset(hOther, event0);
+    fixture.copy(hList, nullptr, 1, &event0);
+    fixture.copy(hList, nullptr, 1, &event0);
+    zeCommandListDestroy(hOther);
+    zeCommandListDestroy(hList);
+    return capture_driver::expectCalls("resets", {
+        created("list0"),
+        created("list1"),
+        copy("list0", "null", "[event0]"),
+        "zeEventHostReset(event0)",
+        copy("list0", "null", "[event0]"),
+        copy("list0", "null", "[]"),
+        "zeCommandListAppendEventReset(list1, event0)",
+        copy("list0", "null", "[event0]"),
+        copy("list0", "null", "[]"),
+        destroyed("list1"),
+        destroyed("list0"),
+    });
+}
+
+// Signaling a counter-based event arms it again, so a wait after another
+// list appended a command, a barrier, a signal or a metric query end
+// signaling it is kept.
+bool reSignal(fixture_t &fixture) {
+    auto event0 = fixture.hEvents[0];
+    auto hWaiter = fixture.createList(ZE_COMMAND_LIST_FLAG_IN_ORDER);
+    auto hSignaler = fixture.createList(ZE_COMMAND_LIST_FLAG_IN_ORDER);
+    fixture.copy(hWaiter, nullptr, 1, &event0);
+    fixture.copy(hSignaler, event0, 0, nullptr);
+    fixture.copy(hWaiter, nullptr, 1, &event0);
+    fixture.copy(hWaiter, nullptr, 1, &event0);
+    fixture.barrier(hSignaler, event0);
+    fixture.copy(hWaiter, nullptr, 1, &event0);
+    zeCommandListAppendSignalEvent(hSignaler, event0);
+    zeCommandListAppendWaitOnEvents(hWaiter, 1, &event0);
+    zetCommandListAppendMetricQueryEnd(hSignaler, nullptr, event0, 0, nullptr);
+    fixture.copy(hWaiter, nullptr, 1, &event0);
+    zeCommandListDestroy(hSignaler);
+    zeCommandListDestroy(hWaiter);
+    return capture_driver::expectCalls("re_signal", {
+        created("list0"),
+        created("list1"),
+        copy("list0", "null", "[event0]"),
+        copy("list1", "event0", "[]"),
+        copy("list0", "null", "[event0]"),
+        copy("list0", "null", "[]"),
+        barrier("list1", "event0", "[]"),
+        copy("list0", "null", "[event0]"),
+        "zeCommandListAppendSignalEvent(list1, event0)",
+        waitOnEvents("list0", "[event0]"),
+        "zetCommandListAppendMetricQueryEnd(list1, event0, [])",
+        copy("list0", "null", "[event0]"),
+        destroyed("list1"),
+        destroyed("list0"),
+    });
+}
+
+// The layer does not see what an extension function appends, so it stops
+// pruning once one is handed out, on lists created before and after.
+bool extension(fixture_t &fixture) {
+    auto event0 = fixture.hEvents[0];
+    auto hList = fixture.createList(0);
+    fixture.barrier(hList);
+    ze_result_t (*appendMarker)(ze_command_list_handle_t) = nullptr;
+    auto result = zeDriverGetExtensionFunctionAddress(fixture.hDriver, "zexCaptureAppendMarker",
+                                                      reinterpret_cast<void **>(&appendMarker));
+    if (result != ZE_RESULT_SUCCESS || !appendMarker) {
+        fail("zeDriverGetExtensionFunctionAddress", result);
+        return false;
+    }
+    appendMarker(hList);
+    fixture.barrier(hList);
+    auto hOther = fixture.createList(ZE_COMMAND_LIST_FLAG_IN_ORDER);
+    fixture.copy(hOther, nullptr, 1, &event0);
+    fixture.copy(hOther, nullptr, 1, &event0);
+    zeCommandListDestroy(hOther);
+    zeCommandListDestroy(hList);
+    return capture_driver::expectCalls("extension", {
+        created("list0"),
+        barrier("list0", "null", "[]"),
+        "zexCaptureAppendMarker(list0)",
+        barrier("list0", "null", "[]"),
+        created("list1"),
+        copy("list1", "null", "[event0]"),
+        copy("list1", "null", "[event0]"),
+        destroyed("list1"),
+        destroyed("list0"),
+    });
+}
+
+// The wait lists of a mutable command list can be updated once appended,
+// so nothing is removed from it.
+bool mutableList(fixture_t &fixture) {
+    auto event0 = fixture.hEvents[0];
+    ze_mutable_command_list_exp_desc_t mutableDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_LIST_EXP_DESC};
+    auto hList = fixture.createList(ZE_COMMAND_LIST_FLAG_IN_ORDER, &mutableDesc);
+    fixture.barrier(hList);
+    fixture.barrier(hList);
+    fixture.copy(hList, nullptr, 1, &event0);
+    fixture.copy(hList, nullptr, 1, &event0);
+    zeCommandListDestroy(hList);
+    return capture_driver::expectCalls("mutable", {
+        created("list0"),
+        barrier("list0", "null", "[]"),
+        barrier("list0", "null", "[]"),
+        copy("list0", "null", "[event0]"),
+        copy("list0", "null", "[event0]"),
+        destroyed("list0"),
+    });
+}
+
+struct scenario_t {
+    const char *name;
+    bool (*run)(fixture_t &);
+};
+
+const scenario_t scenarios[] = {
+    {"back_to_back", backToBack},
+    {"in_order", inOrder},
+    {"out_of_order", outOfOrder},
+    {"resets", resets},
+    {"re_signal", reSignal},
+    {"extension", extension},
+    {"mutable", mutableList},
+};
+
+} // namespace
+
+int main(int argc, char **argv) {
+    setDefaultEnv("ZE_ENABLE_OPTIMIZATION_LAYER", "1");
+    setDefaultEnv("ZE_ENABLE_BARRIER_PRUNING", "1");
+    setDefaultEnv("ZE_OPTIMIZATION_LAYER_REPORT", "1");
+
+    const scenario_t *scenario = nullptr;
+    for (auto &candidate : scenarios)
+        if (argc > 1 && strcmp(argv[1], candidate.name) == 0)
+            scenario = &candidate;
+    if (!scenario) {
+        fprintf(stderr, "usage: %s <scenario>\n", argv[0]);
+        return 1;
+    }
+
+    ze_result_t result = zeInit(0);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeInit", result);
+
+    fixture_t fixture;
+    uint32_t count = 1;
+    result = zeDriverGet(&count, &fixture.hDriver);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeDriverGet", result);
+
+    count = 1;
+    result = zeDeviceGet(fixture.hDriver, &count, &fixture.hDevice);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeDeviceGet", result);
+
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    result = zeContextCreate(fixture.hDriver, &contextDesc, &fixture.hContext);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeContextCreate", result);
+
+    ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+    zeMemAllocDevice(fixture.hContext, &deviceDesc, 64, 64, fixture.hDevice, &fixture.src);
+    zeMemAllocDevice(fixture.hContext, &deviceDesc, 64, 64, fixture.hDevice, &fixture.dst);
+
+    ze_event_pool_counter_based_exp_desc_t counterBasedDesc = {
+        ZE_STRUCTURE_TYPE_COUNTER_BASED_EVENT_POOL_EXP_DESC, nullptr,
+        ZE_EVENT_POOL_COUNTER_BASED_EXP_FLAG_NON_IMMEDIATE};
+    ze_event_pool_desc_t poolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC, nullptr, 0, 2};
+    if (strcmp(scenario->name, "re_signal") == 0)
+        poolDesc.pNext = &counterBasedDesc;
+    ze_event_pool_handle_t hEventPool = nullptr;
+    result = zeEventPoolCreate(fixture.hContext, &poolDesc, 1, &fixture.hDevice, &hEventPool);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeEventPoolCreate", result);
+
+    for (uint32_t i = 0; i < 2; ++i) {
+        ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC, nullptr, i};
+        result = zeEventCreate(hEventPool, &eventDesc, &fixture.hEvents[i]);
+        if (result != ZE_RESULT_SUCCESS)
+            return fail("zeEventCreate", result);
+    }
+    capture_driver::takeCalls();
+
+    bool passed = scenario->run(fixture);
+
+    zeEventDestroy(fixture.hEvents[1]);
+    zeEventDestroy(fixture.hEvents[0]);
+    zeEventPoolDestroy(hEventPool);
+    zeMemFree(fixture.hContext, fixture.dst);
+    zeMemFree(fixture.hContext, fixture.src);
+    zeContextDestroy(fixture.hContext);
+    if (!passed)
+        return 1;
+    printf("Barrier pruning scenario %s done\n", scenario->name);
+    return 0;
+}
@@ -0,0 +1,150 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Checks the calls the command list recycling of the optimization layer
+// sends to the capture driver: destroyed command lists reset and handed
+// out again, lists with another ordinal or queue index created by the
+// driver, the least recently kept list destroyed past
+// ZE_COMMAND_LIST_RECYCLING_MAX_LISTS, and kept lists destroyed with
+// their context.
+
+#include "ze_api.h"
+#include "capture_driver.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+void setDefaultEnv(const char *name, const char *value) {
+    if (getenv(name) != nullptr)
+        return;
+#if defined(_WIN32)
+    _putenv_s(name, value);
+#else
+    setenv(name, value, 0);
+#endif
+}
+
+int failures = 0;
+
+void check(bool condition, const char *what) {
+    if (condition)
+        return;
+    fprintf(stderr, "FAILED: %s\n", what);
+    failures++;
+}
+
+int fail(const char *call, ze_result_t result) {
+    fprintf(stderr, "%s failed: 0x%x\n", call, static_cast<unsigned>(result));
+    return 1;
+}
+
+} // namespace
+
+int main() {
+    setDefaultEnv("ZE_ENABLE_OPTIMIZATION_LAYER", "1");
+    setDefaultEnv("ZE_ENABLE_COMMAND_LIST_RECYCLING", "1");
+    setDefaultEnv("ZE_COMMAND_LIST_RECYCLING_MAX_LISTS", "2");
+
+    ze_result_t result = zeInit(0);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeInit", result);
+
+    uint32_t count = 1;
+    ze_driver_handle_t hDriver = nullptr;
+    result = zeDriverGet(&count, &hDriver);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeDriverGet", result);
+
+    count = 1;
+    ze_device_handle_t hDevice = nullptr;
+    result = zeDeviceGet(hDriver, &count, &hDevice);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeDeviceGet", result);
+
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    ze_context_handle_t hContext = nullptr;
+    result = zeContextCreate(hDriver, &contextDesc, &hContext);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeContextCreate", result);
+
+    ze_command_list_desc_t listDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
+    ze_command_list_handle_t hCommandList = nullptr;
+    result = zeCommandListCreate(hContext, hDevice, &listDesc, &hCommandList);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeCommandListCreate", result);
+    capture_driver::takeCalls();
+
+    // A destroyed list is reset, and the next create with the same
+    // description returns it.
+    ze_command_list_handle_t hFirstList = hCommandList;
+    zeCommandListAppendBarrier(hCommandList, nullptr, 0, nullptr);
+    zeCommandListClose(hCommandList);
+    zeCommandListDestroy(hCommandList);
+    zeCommandListCreate(hContext, hDevice, &listDesc, &hCommandList);
+    check(hCommandList == hFirstList, "destroyed list handed out again");
+    check(capture_driver::expectCalls("recycled list", {
+        "zeCommandListAppendBarrier(list0, null, [])",
+        "zeCommandListClose(list0)",
+        "zeCommandListReset(list0)",
+    }), "recycled list reset");
+
+    // Another ordinal needs a list of its own.
+    ze_command_list_desc_t copyDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
+    copyDesc.commandQueueGroupOrdinal = 1;
+    ze_command_list_handle_t hCopyList = nullptr;
+    zeCommandListCreate(hContext, hDevice, &copyDesc, &hCopyList);
+    check(capture_driver::expectCalls("other ordinal", {
+        "zeCommandListCreate() = list1",
+    }), "list with another ordinal created by the driver");
+
+    // Immediate lists are kept without a reset, and matched on their
+    // queue index too.
+    ze_command_queue_desc_t queueDesc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+    ze_command_list_handle_t hImmediateList = nullptr;
+    zeCommandListCreateImmediate(hContext, hDevice, &queueDesc, &hImmediateList);
+    ze_command_list_handle_t hFirstImmediateList = hImmediateList;
+    zeCommandListDestroy(hImmediateList);
+    queueDesc.index = 1;
+    ze_command_list_handle_t hOtherImmediateList = nullptr;
+    zeCommandListCreateImmediate(hContext, hDevice, &queueDesc, &hOtherImmediateList);
+    queueDesc.index = 0;
+    zeCommandListCreateImmediate(hContext, hDevice, &queueDesc, &hImmediateList);
+    check(hImmediateList == hFirstImmediateList, "destroyed immediate list handed out again");
+    check(capture_driver::expectCalls("immediate lists", {
+        "zeCommandListCreateImmediate() = list2",
+        "zeCommandListCreateImmediate() = list3",
+    }), "immediate list kept without a reset");
+
+    // Past two kept lists, the least recently kept is destroyed.
+    zeCommandListDestroy(hCommandList);
+    zeCommandListDestroy(hCopyList);
+    zeCommandListDestroy(hImmediateList);
+    check(capture_driver::expectCalls("limit", {
+        "zeCommandListReset(list0)",
+        "zeCommandListReset(list1)",
+        "zeCommandListDestroy(list0)",
+    }), "least recently kept list destroyed");
+
+    // Keeping one more destroys list1; the lists still kept are destroyed
+    // with their context.
+    zeCommandListDestroy(hOtherImmediateList);
+    zeContextDestroy(hContext);
+    check(capture_driver::expectCalls("context", {
+        "zeCommandListDestroy(list1)",
+        "zeCommandListDestroy(list2)",
+        "zeCommandListDestroy(list3)",
+        "zeContextDestroy(context0)",
+    }), "kept lists destroyed with their context");
+
+    if (failures)
+        return 1;
+    printf("Command list recycling checks passed\n");
+    return 0;
+}
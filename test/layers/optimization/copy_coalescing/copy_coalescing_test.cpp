@@ -0,0 +1,168 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Checks the copies the copy coalescing of the optimization layer sends to
+// the capture driver: contiguous copies merged into one, copies into
+// allocations that only touch kept apart, held copies appended before
+// metric commands, and no copy held back once an extension function was
+// handed out. The counts of the report are matched by the registration.
+
+#include "ze_api.h"
+#include "zet_api.h"
+#include "capture_driver.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+void setDefaultEnv(const char *name, const char *value) {
+    if (getenv(name) != nullptr)
+        return;
+#if defined(_WIN32)
+    _putenv_s(name, value);
+#else
+    setenv(name, value, 0);
+#endif
+}
+
+int failures = 0;
+
+void check(bool condition, const char *what) {
+    if (condition)
+        return;
+    fprintf(stderr, "FAILED: %s\n", what);
+    failures++;
+}
+
+int fail(const char *call, ze_result_t result) {
+    fprintf(stderr, "%s failed: 0x%x\n", call, static_cast<unsigned>(result));
+    return 1;
+}
+
+} // namespace
+
+int main() {
+    setDefaultEnv("ZE_ENABLE_OPTIMIZATION_LAYER", "1");
+    setDefaultEnv("ZE_ENABLE_COPY_COALESCING", "1");
+    setDefaultEnv("ZE_OPTIMIZATION_LAYER_REPORT", "1");
+
+    ze_result_t result = zeInit(0);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeInit", result);
+
+    uint32_t count = 1;
+    ze_driver_handle_t hDriver = nullptr;
+    result = zeDriverGet(&count, &hDriver);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeDriverGet", result);
+
+    count = 1;
+    ze_device_handle_t hDevice = nullptr;
+    result = zeDeviceGet(hDriver, &count, &hDevice);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeDeviceGet", result);
+
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    ze_context_handle_t hContext = nullptr;
+    result = zeContextCreate(hDriver, &contextDesc, &hContext);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeContextCreate", result);
+
+    // The capture driver places allocations one after the other, so dst and
+    // next touch.
+    ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+    char *src = nullptr;
+    char *dst = nullptr;
+    char *next = nullptr;
+    zeMemAllocDevice(hContext, &deviceDesc, 512, 64, hDevice, reinterpret_cast<void **>(&src));
+    zeMemAllocDevice(hContext, &deviceDesc, 256, 64, hDevice, reinterpret_cast<void **>(&dst));
+    zeMemAllocDevice(hContext, &deviceDesc, 256, 64, hDevice, reinterpret_cast<void **>(&next));
+    check(dst + 256 == next, "allocations placed one after the other");
+
+    ze_command_list_desc_t listDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
+    ze_command_list_handle_t hCommandList = nullptr;
+    result = zeCommandListCreate(hContext, hDevice, &listDesc, &hCommandList);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeCommandListCreate", result);
+    capture_driver::takeCalls();
+
+    // Copies continuing each other, forwards and backwards, are appended as
+    // one before the barrier.
+    zeCommandListAppendMemoryCopy(hCommandList, dst + 64, src + 64, 64, nullptr, 0, nullptr);
+    zeCommandListAppendMemoryCopy(hCommandList, dst + 128, src + 128, 64, nullptr, 0, nullptr);
+    zeCommandListAppendMemoryCopy(hCommandList, dst, src, 64, nullptr, 0, nullptr);
+    zeCommandListAppendBarrier(hCommandList, nullptr, 0, nullptr);
+    check(capture_driver::expectCalls("contiguous copies", {
+        "zeCommandListAppendMemoryCopy(list0, alloc1+0, alloc0+0, 192, null, [])",
+        "zeCommandListAppendBarrier(list0, null, [])",
+    }), "contiguous copies merged");
+
+    // The end of dst touches next, but they are separate allocations.
+    zeCommandListAppendMemoryCopy(hCommandList, dst + 192, src + 192, 64, nullptr, 0, nullptr);
+    zeCommandListAppendMemoryCopy(hCommandList, next, src + 256, 64, nullptr, 0, nullptr);
+    zeCommandListClose(hCommandList);
+    check(capture_driver::expectCalls("touching allocations", {
+        "zeCommandListAppendMemoryCopy(list0, alloc1+192, alloc0+192, 64, null, [])",
+        "zeCommandListAppendMemoryCopy(list0, alloc2+0, alloc0+256, 64, null, [])",
+        "zeCommandListClose(list0)",
+    }), "copies into touching allocations kept apart");
+
+    // Metric commands are appended after the copies before them.
+    zeCommandListReset(hCommandList);
+    zeCommandListAppendMemoryCopy(hCommandList, dst, src, 64, nullptr, 0, nullptr);
+    zetCommandListAppendMetricQueryBegin(hCommandList, nullptr);
+    zeCommandListAppendMemoryCopy(hCommandList, dst + 64, src + 64, 64, nullptr, 0, nullptr);
+    zetCommandListAppendMetricMemoryBarrier(hCommandList);
+    zeCommandListAppendMemoryCopy(hCommandList, dst + 128, src + 128, 64, nullptr, 0, nullptr);
+    zetCommandListAppendMetricStreamerMarker(hCommandList, nullptr, 1);
+    zeCommandListAppendMemoryCopy(hCommandList, dst + 192, src + 192, 64, nullptr, 0, nullptr);
+    zetCommandListAppendMetricQueryEnd(hCommandList, nullptr, nullptr, 0, nullptr);
+    check(capture_driver::expectCalls("metric commands", {
+        "zeCommandListReset(list0)",
+        "zeCommandListAppendMemoryCopy(list0, alloc1+0, alloc0+0, 64, null, [])",
+        "zetCommandListAppendMetricQueryBegin(list0)",
+        "zeCommandListAppendMemoryCopy(list0, alloc1+64, alloc0+64, 64, null, [])",
+        "zetCommandListAppendMetricMemoryBarrier(list0)",
+        "zeCommandListAppendMemoryCopy(list0, alloc1+128, alloc0+128, 64, null, [])",
+        "zetCommandListAppendMetricStreamerMarker(list0)",
+        "zeCommandListAppendMemoryCopy(list0, alloc1+192, alloc0+192, 64, null, [])",
+        "zetCommandListAppendMetricQueryEnd(list0, null, [])",
+    }), "held copies appended before metric commands");
+
+    // A copy held when the extension function is handed out is appended
+    // before the next command; later copies are not held back.
+    zeCommandListReset(hCommandList);
+    zeCommandListAppendMemoryCopy(hCommandList, dst, src, 64, nullptr, 0, nullptr);
+    ze_result_t (*appendMarker)(ze_command_list_handle_t) = nullptr;
+    result = zeDriverGetExtensionFunctionAddress(hDriver, "zexCaptureAppendMarker",
+                                                 reinterpret_cast<void **>(&appendMarker));
+    if (result != ZE_RESULT_SUCCESS || !appendMarker)
+        return fail("zeDriverGetExtensionFunctionAddress", result);
+    zeCommandListAppendMemoryCopy(hCommandList, dst + 64, src + 64, 64, nullptr, 0, nullptr);
+    appendMarker(hCommandList);
+    zeCommandListAppendMemoryCopy(hCommandList, dst + 128, src + 128, 64, nullptr, 0, nullptr);
+    check(capture_driver::expectCalls("extension function", {
+        "zeCommandListReset(list0)",
+        "zeCommandListAppendMemoryCopy(list0, alloc1+0, alloc0+0, 64, null, [])",
+        "zeCommandListAppendMemoryCopy(list0, alloc1+64, alloc0+64, 64, null, [])",
+        "zexCaptureAppendMarker(list0)",
+        "zeCommandListAppendMemoryCopy(list0, alloc1+128, alloc0+128, 64, null, [])",
+    }), "no copy held back after an extension function");
+
+    zeCommandListDestroy(hCommandList);
+    zeMemFree(hContext, next);
+    zeMemFree(hContext, dst);
+    zeMemFree(hContext, src);
+    zeContextDestroy(hContext);
+
+    if (failures)
+        return 1;
+    printf("Copy coalescing checks passed\n");
+    return 0;
+}
@@ -0,0 +1,182 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Checks the calls the event recycling of the optimization layer sends to
+// the capture driver: destroyed events and fences reset and handed out
+// again, events with other scopes and pools with other descriptions
+// created by the driver, pools with live events and signaled fences passed
+// to the driver, and kept objects destroyed with their queue or context.
+
+#include "ze_api.h"
+#include "capture_driver.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+void setDefaultEnv(const char *name, const char *value) {
+    if (getenv(name) != nullptr)
+        return;
+#if defined(_WIN32)
+    _putenv_s(name, value);
+#else
+    setenv(name, value, 0);
+#endif
+}
+
+int failures = 0;
+
+void check(bool condition, const char *what) {
+    if (condition)
+        return;
+    fprintf(stderr, "FAILED: %s\n", what);
+    failures++;
+}
+
+int fail(const char *call, ze_result_t result) {
+    fprintf(stderr, "%s failed: 0x%x\n", call, static_cast<unsigned>(result));
+    return 1;
+}
+
+} // namespace
+
+int main() {
+    setDefaultEnv("ZE_ENABLE_OPTIMIZATION_LAYER", "1");
+    setDefaultEnv("ZE_ENABLE_EVENT_RECYCLING", "1");
+
+    ze_result_t result = zeInit(0);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeInit", result);
+
+    uint32_t count = 1;
+    ze_driver_handle_t hDriver = nullptr;
+    result = zeDriverGet(&count, &hDriver);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeDriverGet", result);
+
+    count = 1;
+    ze_device_handle_t hDevice = nullptr;
+    result = zeDeviceGet(hDriver, &count, &hDevice);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeDeviceGet", result);
+
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    ze_context_handle_t hContext = nullptr;
+    result = zeContextCreate(hDriver, &contextDesc, &hContext);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeContextCreate", result);
+
+    ze_event_pool_desc_t poolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+    poolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    poolDesc.count = 2;
+    ze_event_pool_handle_t hEventPool = nullptr;
+    result = zeEventPoolCreate(hContext, &poolDesc, 1, &hDevice, &hEventPool);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeEventPoolCreate", result);
+
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+    eventDesc.index = 0;
+    eventDesc.signal = ZE_EVENT_SCOPE_FLAG_HOST;
+    eventDesc.wait = ZE_EVENT_SCOPE_FLAG_HOST;
+    ze_event_handle_t hEvent = nullptr;
+    result = zeEventCreate(hEventPool, &eventDesc, &hEvent);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeEventCreate", result);
+    capture_driver::takeCalls();
+
+    // A destroyed event is reset, and the next create at its index with the
+    // same scopes returns it.
+    ze_event_handle_t hFirstEvent = hEvent;
+    zeEventDestroy(hEvent);
+    zeEventCreate(hEventPool, &eventDesc, &hEvent);
+    check(hEvent == hFirstEvent, "destroyed event handed out again");
+    check(capture_driver::expectCalls("recycled event", {
+        "zeEventHostReset(event0)",
+    }), "recycled event reset");
+
+    // Other scopes at the same index replace the kept event.
+    zeEventDestroy(hEvent);
+    eventDesc.signal = ZE_EVENT_SCOPE_FLAG_DEVICE;
+    zeEventCreate(hEventPool, &eventDesc, &hEvent);
+    check(hEvent != hFirstEvent, "event with other scopes created by the driver");
+    check(capture_driver::expectCalls("other scopes", {
+        "zeEventHostReset(event0)",
+        "zeEventDestroy(event0)",
+        "zeEventCreate(pool0) = event1",
+    }), "kept event with other scopes destroyed");
+
+    // A pool without live events is kept with its events, for the next
+    // create with the same description.
+    ze_event_pool_handle_t hFirstPool = hEventPool;
+    zeEventDestroy(hEvent);
+    zeEventPoolDestroy(hEventPool);
+    zeEventPoolCreate(hContext, &poolDesc, 1, &hDevice, &hEventPool);
+    zeEventCreate(hEventPool, &eventDesc, &hEvent);
+    check(hEventPool == hFirstPool, "destroyed pool handed out again");
+    check(capture_driver::expectCalls("recycled pool", {
+        "zeEventHostReset(event1)",
+    }), "recycled pool kept its events");
+
+    // A pool with another count, and one destroyed with a live event, go
+    // to the driver.
+    poolDesc.count = 4;
+    ze_event_pool_handle_t hOtherPool = nullptr;
+    ze_event_handle_t hOtherEvent = nullptr;
+    zeEventPoolCreate(hContext, &poolDesc, 1, &hDevice, &hOtherPool);
+    zeEventCreate(hOtherPool, &eventDesc, &hOtherEvent);
+    zeEventPoolDestroy(hOtherPool);
+    check(capture_driver::expectCalls("other pools", {
+        "zeEventPoolCreate() = pool1",
+        "zeEventCreate(pool1) = event2",
+        "zeEventPoolDestroy(pool1)",
+    }), "pool with another count or a live event passed to the driver");
+
+    // Fences are reset and kept for their queue; signaled ones are not.
+    ze_command_queue_desc_t queueDesc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+    ze_command_queue_handle_t hCommandQueue = nullptr;
+    zeCommandQueueCreate(hContext, hDevice, &queueDesc, &hCommandQueue);
+    ze_fence_desc_t fenceDesc = {ZE_STRUCTURE_TYPE_FENCE_DESC};
+    ze_fence_handle_t hFence = nullptr;
+    zeFenceCreate(hCommandQueue, &fenceDesc, &hFence);
+    ze_fence_handle_t hFirstFence = hFence;
+    zeFenceDestroy(hFence);
+    zeFenceCreate(hCommandQueue, &fenceDesc, &hFence);
+    check(hFence == hFirstFence, "destroyed fence handed out again");
+    zeFenceDestroy(hFence);
+    fenceDesc.flags = ZE_FENCE_FLAG_SIGNALED;
+    zeFenceCreate(hCommandQueue, &fenceDesc, &hFence);
+    zeFenceDestroy(hFence);
+    zeCommandQueueDestroy(hCommandQueue);
+    check(capture_driver::expectCalls("fences", {
+        "zeCommandQueueCreate() = queue0",
+        "zeFenceCreate(queue0) = fence0",
+        "zeFenceReset(fence0)",
+        "zeFenceReset(fence0)",
+        "zeFenceCreate(queue0) = fence1",
+        "zeFenceDestroy(fence1)",
+        "zeFenceDestroy(fence0)",
+        "zeCommandQueueDestroy(queue0)",
+    }), "fences recycled and destroyed with their queue");
+
+    // Kept pools are destroyed with their context.
+    zeEventDestroy(hEvent);
+    zeEventPoolDestroy(hEventPool);
+    zeContextDestroy(hContext);
+    check(capture_driver::expectCalls("context", {
+        "zeEventHostReset(event1)",
+        "zeEventDestroy(event1)",
+        "zeEventPoolDestroy(pool0)",
+        "zeContextDestroy(context0)",
+    }), "kept pools destroyed with their context");
+
+    if (failures)
+        return 1;
+    printf("Event recycling checks passed\n");
+    return 0;
+}
@@ -0,0 +1,172 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Checks the calls the IPC cache of the optimization layer sends to the
+// capture driver, with ZE_IPC_CACHE_MATCH_OPENED: a handle is exported once
+// per pointer and put when its allocation is freed or its event pool
+// destroyed, a handle opened again returns the same pointer or pool and is
+// closed in the driver with its last close, and opens with other flags
+// reach the driver. Exported handles of the capture driver carry their
+// name, so the records show which handle was put or opened.
+
+#include "ze_api.h"
+#include "capture_driver.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+void setDefaultEnv(const char *name, const char *value) {
+    if (getenv(name) != nullptr)
+        return;
+#if defined(_WIN32)
+    _putenv_s(name, value);
+#else
+    setenv(name, value, 0);
+#endif
+}
+
+int failures = 0;
+
+void check(bool condition, const char *what) {
+    if (condition)
+        return;
+    fprintf(stderr, "FAILED: %s\n", what);
+    failures++;
+}
+
+int fail(const char *call, ze_result_t result) {
+    fprintf(stderr, "%s failed: 0x%x\n", call, static_cast<unsigned>(result));
+    return 1;
+}
+
+} // namespace
+
+int main() {
+    setDefaultEnv("ZE_ENABLE_OPTIMIZATION_LAYER", "1");
+    setDefaultEnv("ZE_ENABLE_IPC_CACHE", "1");
+    setDefaultEnv("ZE_IPC_CACHE_MATCH_OPENED", "1");
+
+    ze_result_t result = zeInit(0);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeInit", result);
+
+    uint32_t count = 1;
+    ze_driver_handle_t hDriver = nullptr;
+    result = zeDriverGet(&count, &hDriver);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeDriverGet", result);
+
+    count = 1;
+    ze_device_handle_t hDevice = nullptr;
+    result = zeDeviceGet(hDriver, &count, &hDevice);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeDeviceGet", result);
+
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    ze_context_handle_t hContext = nullptr;
+    result = zeContextCreate(hDriver, &contextDesc, &hContext);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeContextCreate", result);
+
+    ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+    void *ptr = nullptr;
+    result = zeMemAllocDevice(hContext, &deviceDesc, 256, 0, hDevice, &ptr);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeMemAllocDevice", result);
+    capture_driver::takeCalls();
+
+    // A pointer is exported once; putting its handle is deferred.
+    ze_ipc_mem_handle_t handle = {};
+    ze_ipc_mem_handle_t sameHandle = {};
+    ze_ipc_mem_handle_t offsetHandle = {};
+    result = zeMemGetIpcHandle(hContext, ptr, &handle);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeMemGetIpcHandle", result);
+    zeMemPutIpcHandle(hContext, handle);
+    zeMemGetIpcHandle(hContext, ptr, &sameHandle);
+    check(memcmp(handle.data, sameHandle.data, sizeof(handle.data)) == 0, "same handle returned");
+    zeMemGetIpcHandle(hContext, static_cast<char *>(ptr) + 64, &offsetHandle);
+    check(capture_driver::expectCalls("exports", {
+        "zeMemGetIpcHandle(alloc0+0) = ipc0",
+        "zeMemGetIpcHandle(alloc0+64) = ipc1",
+    }), "pointers exported once");
+
+    // A handle opened again returns the same pointer, closed in the driver
+    // with its last close; other flags are another open.
+    void *opened = nullptr;
+    void *openedAgain = nullptr;
+    void *openedCached = nullptr;
+    result = zeMemOpenIpcHandle(hContext, hDevice, handle, 0, &opened);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeMemOpenIpcHandle", result);
+    zeMemOpenIpcHandle(hContext, hDevice, handle, 0, &openedAgain);
+    check(openedAgain == opened, "same pointer opened");
+    zeMemOpenIpcHandle(hContext, hDevice, handle, ZE_IPC_MEMORY_FLAG_BIAS_CACHED, &openedCached);
+    check(openedCached != opened, "other flags opened by the driver");
+    zeMemCloseIpcHandle(hContext, opened);
+    check(capture_driver::expectCalls("first close", {
+        "zeMemOpenIpcHandle(ipc0) = opened0",
+        "zeMemOpenIpcHandle(ipc0) = opened1",
+    }), "handle opened once per flags and kept for its other open");
+    zeMemCloseIpcHandle(hContext, openedAgain);
+    zeMemCloseIpcHandle(hContext, openedCached);
+    check(capture_driver::expectCalls("last close", {
+        "zeMemCloseIpcHandle(opened0+0)",
+        "zeMemCloseIpcHandle(opened1+0)",
+    }), "opened handle closed with its last close");
+
+    // Freeing the allocation puts every handle exported from it.
+    zeMemFree(hContext, ptr);
+    check(capture_driver::expectCalls("free", {
+        "zeMemPutIpcHandle(ipc0)",
+        "zeMemPutIpcHandle(ipc1)",
+        "zeMemFree(alloc0+0)",
+    }), "handles put when the allocation is freed");
+
+    // Event pools are exported and opened the same way.
+    ze_event_pool_desc_t poolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+    poolDesc.flags = ZE_EVENT_POOL_FLAG_IPC;
+    poolDesc.count = 1;
+    ze_event_pool_handle_t hEventPool = nullptr;
+    result = zeEventPoolCreate(hContext, &poolDesc, 1, &hDevice, &hEventPool);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeEventPoolCreate", result);
+    ze_ipc_event_pool_handle_t hIpc = {};
+    zeEventPoolGetIpcHandle(hEventPool, &hIpc);
+    zeEventPoolPutIpcHandle(hContext, hIpc);
+    zeEventPoolGetIpcHandle(hEventPool, &hIpc);
+    ze_event_pool_handle_t hOpenedPool = nullptr;
+    ze_event_pool_handle_t hOpenedPoolAgain = nullptr;
+    zeEventPoolOpenIpcHandle(hContext, hIpc, &hOpenedPool);
+    zeEventPoolOpenIpcHandle(hContext, hIpc, &hOpenedPoolAgain);
+    check(hOpenedPoolAgain == hOpenedPool, "same pool opened");
+    zeEventPoolCloseIpcHandle(hOpenedPool);
+    check(capture_driver::expectCalls("event pool", {
+        "zeEventPoolCreate() = pool0",
+        "zeEventPoolGetIpcHandle(pool0) = ipc2",
+        "zeEventPoolOpenIpcHandle(ipc2) = pool1",
+    }), "event pool exported and opened once");
+    zeEventPoolCloseIpcHandle(hOpenedPoolAgain);
+    zeEventPoolDestroy(hEventPool);
+    check(capture_driver::expectCalls("event pool destroy", {
+        "zeEventPoolCloseIpcHandle(pool1)",
+        "zeEventPoolPutIpcHandle(ipc2)",
+        "zeEventPoolDestroy(pool0)",
+    }), "pool closed with its last close and its handle put when destroyed");
+
+    zeContextDestroy(hContext);
+    capture_driver::takeCalls();
+
+    if (failures)
+        return 1;
+    printf("IPC cache checks passed\n");
+    return 0;
+}
@@ -0,0 +1,174 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Checks the calls the kernel cache of the optimization layer sends to the
+// capture driver, with ZE_KERNEL_CACHE_SHARE_KERNELS: creates of the same
+// kernel share one kernel, other names or flags get their own, a shared
+// kernel is destroyed with its last reference, and kernel properties,
+// names and the kernel names of a module are asked for once. Queries with
+// extension structures or too small a buffer reach the driver.
+
+#include "ze_api.h"
+#include "capture_driver.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+void setDefaultEnv(const char *name, const char *value) {
+    if (getenv(name) != nullptr)
+        return;
+#if defined(_WIN32)
+    _putenv_s(name, value);
+#else
+    setenv(name, value, 0);
+#endif
+}
+
+int failures = 0;
+
+void check(bool condition, const char *what) {
+    if (condition)
+        return;
+    fprintf(stderr, "FAILED: %s\n", what);
+    failures++;
+}
+
+int fail(const char *call, ze_result_t result) {
+    fprintf(stderr, "%s failed: 0x%x\n", call, static_cast<unsigned>(result));
+    return 1;
+}
+
+} // namespace
+
+int main() {
+    setDefaultEnv("ZE_ENABLE_OPTIMIZATION_LAYER", "1");
+    setDefaultEnv("ZE_ENABLE_KERNEL_CACHE", "1");
+    setDefaultEnv("ZE_KERNEL_CACHE_SHARE_KERNELS", "1");
+
+    ze_result_t result = zeInit(0);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeInit", result);
+
+    uint32_t count = 1;
+    ze_driver_handle_t hDriver = nullptr;
+    result = zeDriverGet(&count, &hDriver);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeDriverGet", result);
+
+    count = 1;
+    ze_device_handle_t hDevice = nullptr;
+    result = zeDeviceGet(hDriver, &count, &hDevice);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeDeviceGet", result);
+
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    ze_context_handle_t hContext = nullptr;
+    result = zeContextCreate(hDriver, &contextDesc, &hContext);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeContextCreate", result);
+
+    ze_module_desc_t moduleDesc = {ZE_STRUCTURE_TYPE_MODULE_DESC};
+    ze_module_handle_t hModule = nullptr;
+    result = zeModuleCreate(hContext, hDevice, &moduleDesc, &hModule, nullptr);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeModuleCreate", result);
+    capture_driver::takeCalls();
+
+    // Creates of the same name and flags share a kernel.
+    ze_kernel_desc_t kernelDesc = {ZE_STRUCTURE_TYPE_KERNEL_DESC};
+    kernelDesc.pKernelName = "copy";
+    ze_kernel_handle_t hKernel = nullptr;
+    ze_kernel_handle_t hSharedKernel = nullptr;
+    ze_kernel_handle_t hFillKernel = nullptr;
+    ze_kernel_handle_t hResidentKernel = nullptr;
+    result = zeKernelCreate(hModule, &kernelDesc, &hKernel);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeKernelCreate", result);
+    zeKernelCreate(hModule, &kernelDesc, &hSharedKernel);
+    check(hSharedKernel == hKernel, "kernel shared");
+    kernelDesc.pKernelName = "fill";
+    zeKernelCreate(hModule, &kernelDesc, &hFillKernel);
+    kernelDesc.pKernelName = "copy";
+    kernelDesc.flags = ZE_KERNEL_FLAG_FORCE_RESIDENCY;
+    zeKernelCreate(hModule, &kernelDesc, &hResidentKernel);
+    kernelDesc.flags = 0;
+    check(capture_driver::expectCalls("creates", {
+        "zeKernelCreate(module0, copy) = kernel0",
+        "zeKernelCreate(module0, fill) = kernel1",
+        "zeKernelCreate(module0, copy) = kernel2",
+    }), "kernels created once per name and flags");
+
+    // Properties are asked for once; with extension structures, every time.
+    ze_kernel_properties_t properties = {ZE_STRUCTURE_TYPE_KERNEL_PROPERTIES};
+    zeKernelGetProperties(hKernel, &properties);
+    properties = {ZE_STRUCTURE_TYPE_KERNEL_PROPERTIES};
+    zeKernelGetProperties(hKernel, &properties);
+    check(properties.numKernelArgs == 2 && properties.maxSubgroupSize == 32, "cached properties returned");
+    ze_kernel_preferred_group_size_properties_t groupSize = {ZE_STRUCTURE_TYPE_KERNEL_PREFERRED_GROUP_SIZE_PROPERTIES};
+    properties.pNext = &groupSize;
+    zeKernelGetProperties(hKernel, &properties);
+    check(capture_driver::expectCalls("properties", {
+        "zeKernelGetProperties(kernel0)",
+        "zeKernelGetProperties(kernel0, pNext)",
+    }), "properties answered from the cache");
+
+    // The name is the one the kernel was created with; too small a buffer
+    // gets the answer of the driver.
+    size_t size = 0;
+    zeKernelGetName(hKernel, &size, nullptr);
+    char name[8] = {};
+    zeKernelGetName(hKernel, &size, name);
+    check(size == 5 && strcmp(name, "copy") == 0, "kernel name");
+    size = 2;
+    zeKernelGetName(hKernel, &size, name);
+    check(capture_driver::expectCalls("name", {
+        "zeKernelGetName(kernel0)",
+    }), "name answered from the cache");
+
+    // The kernel names of a module are asked for once.
+    count = 0;
+    zeModuleGetKernelNames(hModule, &count, nullptr);
+    const char *names[3] = {};
+    count = 3;
+    zeModuleGetKernelNames(hModule, &count, names);
+    check(count == 2 && strcmp(names[0], "copy") == 0 && strcmp(names[1], "fill") == 0, "kernel names");
+    count = 1;
+    names[1] = nullptr;
+    zeModuleGetKernelNames(hModule, &count, names);
+    check(count == 1 && names[1] == nullptr, "kernel names read up to the count");
+    check(capture_driver::expectCalls("kernel names", {
+        "zeModuleGetKernelNames(module0, 0, null)",
+        "zeModuleGetKernelNames(module0, 2, names)",
+    }), "kernel names answered from the cache");
+
+    // A shared kernel is destroyed with its last reference, and the next
+    // create gets a new one.
+    zeKernelDestroy(hSharedKernel);
+    check(capture_driver::expectCalls("first destroy", {}), "shared kernel kept for its other create");
+    zeKernelDestroy(hKernel);
+    zeKernelCreate(hModule, &kernelDesc, &hKernel);
+    check(capture_driver::expectCalls("last destroy", {
+        "zeKernelDestroy(kernel0)",
+        "zeKernelCreate(module0, copy) = kernel3",
+    }), "shared kernel destroyed with its last reference");
+
+    zeKernelDestroy(hKernel);
+    zeKernelDestroy(hResidentKernel);
+    zeKernelDestroy(hFillKernel);
+    zeModuleDestroy(hModule);
+    zeContextDestroy(hContext);
+    capture_driver::takeCalls();
+
+    if (failures)
+        return 1;
+    printf("Kernel cache checks passed\n");
+    return 0;
+}
@@ -0,0 +1,144 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Checks the kernel arguments the kernel state filter of the optimization
+// layer sends to the capture driver: a value set again is dropped, a
+// changed value reaches the driver, and a value set again after virtual or
+// physical memory was released reaches the driver, as the same address
+// may now belong to something else.
+
+#include "ze_api.h"
+#include "capture_driver.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+void setDefaultEnv(const char *name, const char *value) {
+    if (getenv(name) != nullptr)
+        return;
+#if defined(_WIN32)
+    _putenv_s(name, value);
+#else
+    setenv(name, value, 0);
+#endif
+}
+
+int failures = 0;
+
+void check(bool condition, const char *what) {
+    if (condition)
+        return;
+    fprintf(stderr, "FAILED: %s\n", what);
+    failures++;
+}
+
+int fail(const char *call, ze_result_t result) {
+    fprintf(stderr, "%s failed: 0x%x\n", call, static_cast<unsigned>(result));
+    return 1;
+}
+
+} // namespace
+
+int main() {
+    setDefaultEnv("ZE_ENABLE_OPTIMIZATION_LAYER", "1");
+    setDefaultEnv("ZE_ENABLE_KERNEL_STATE_FILTER", "1");
+
+    ze_result_t result = zeInit(0);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeInit", result);
+
+    uint32_t count = 1;
+    ze_driver_handle_t hDriver = nullptr;
+    result = zeDriverGet(&count, &hDriver);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeDriverGet", result);
+
+    count = 1;
+    ze_device_handle_t hDevice = nullptr;
+    result = zeDeviceGet(hDriver, &count, &hDevice);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeDeviceGet", result);
+
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    ze_context_handle_t hContext = nullptr;
+    result = zeContextCreate(hDriver, &contextDesc, &hContext);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeContextCreate", result);
+
+    ze_module_desc_t moduleDesc = {ZE_STRUCTURE_TYPE_MODULE_DESC};
+    ze_module_handle_t hModule = nullptr;
+    result = zeModuleCreate(hContext, hDevice, &moduleDesc, &hModule, nullptr);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeModuleCreate", result);
+
+    ze_kernel_desc_t kernelDesc = {ZE_STRUCTURE_TYPE_KERNEL_DESC};
+    kernelDesc.pKernelName = "copy";
+    ze_kernel_handle_t hKernel = nullptr;
+    result = zeKernelCreate(hModule, &kernelDesc, &hKernel);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeKernelCreate", result);
+
+    void *first = nullptr;
+    void *second = nullptr;
+    zeVirtualMemReserve(hContext, nullptr, 4096, &first);
+    zeVirtualMemReserve(hContext, nullptr, 4096, &second);
+    ze_physical_mem_desc_t physicalDesc = {ZE_STRUCTURE_TYPE_PHYSICAL_MEM_DESC};
+    physicalDesc.size = 4096;
+    ze_physical_mem_handle_t hPhysicalMemory = nullptr;
+    zePhysicalMemCreate(hContext, hDevice, &physicalDesc, &hPhysicalMemory);
+    zeVirtualMemMap(hContext, second, 4096, hPhysicalMemory, 0, ZE_MEMORY_ACCESS_ATTRIBUTE_READWRITE);
+    capture_driver::takeCalls();
+
+    // Values set again are dropped; changed ones reach the driver.
+    uint32_t value = 5;
+    zeKernelSetArgumentValue(hKernel, 0, sizeof(first), &first);
+    zeKernelSetArgumentValue(hKernel, 1, sizeof(value), &value);
+    zeKernelSetArgumentValue(hKernel, 0, sizeof(first), &first);
+    zeKernelSetArgumentValue(hKernel, 1, sizeof(value), &value);
+    value = 6;
+    zeKernelSetArgumentValue(hKernel, 0, sizeof(second), &second);
+    zeKernelSetArgumentValue(hKernel, 1, sizeof(value), &value);
+    zeKernelSetArgumentValue(hKernel, 1, sizeof(value), &value);
+    check(capture_driver::expectCalls("changed values", {
+        "zeKernelSetArgumentValue(kernel0, 0, 8, virtual0+0)",
+        "zeKernelSetArgumentValue(kernel0, 1, 4, 0x00000005)",
+        "zeKernelSetArgumentValue(kernel0, 0, 8, virtual1+0)",
+        "zeKernelSetArgumentValue(kernel0, 1, 4, 0x00000006)",
+    }), "changed values reach the driver");
+
+    // Every release of virtual or physical memory forgets the arguments.
+    zeVirtualMemUnmap(hContext, second, 4096);
+    zeKernelSetArgumentValue(hKernel, 0, sizeof(second), &second);
+    zeKernelSetArgumentValue(hKernel, 0, sizeof(second), &second);
+    zePhysicalMemDestroy(hContext, hPhysicalMemory);
+    zeKernelSetArgumentValue(hKernel, 0, sizeof(second), &second);
+    zeVirtualMemFree(hContext, second, 4096);
+    zeKernelSetArgumentValue(hKernel, 0, sizeof(second), &second);
+    zeKernelSetArgumentValue(hKernel, 1, sizeof(value), &value);
+    check(capture_driver::expectCalls("released memory", {
+        "zeVirtualMemUnmap(virtual1+0, 4096)",
+        "zeKernelSetArgumentValue(kernel0, 0, 8, virtual1+0)",
+        "zePhysicalMemDestroy(physical0)",
+        "zeKernelSetArgumentValue(kernel0, 0, 8, virtual1+0)",
+        "zeVirtualMemFree(virtual1+0, 4096)",
+        "zeKernelSetArgumentValue(kernel0, 0, 8, virtual1)",
+        "zeKernelSetArgumentValue(kernel0, 1, 4, 0x00000006)",
+    }), "values set again after a release reach the driver");
+
+    zeKernelDestroy(hKernel);
+    zeModuleDestroy(hModule);
+    zeVirtualMemFree(hContext, first, 4096);
+    zeContextDestroy(hContext);
+
+    if (failures)
+        return 1;
+    printf("Kernel state filter checks passed\n");
+    return 0;
+}
@@ -0,0 +1,172 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Checks the module cache of the optimization layer against the capture
+// driver, in a temporary ZE_MODULE_CACHE_DIR: a SPIR-V module built once
+// is created from its native binary the next time, other build flags miss
+// the cache, and a damaged entry is ignored and written again. The
+// native binary of a capture driver module is its name, so the records
+// show which module a binary came from.
+
+#include "ze_api.h"
+#include "capture_driver.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <dirent.h>
+#include <unistd.h>
+
+namespace {
+
+void setDefaultEnv(const char *name, const char *value) {
+    if (getenv(name) != nullptr)
+        return;
+    setenv(name, value, 0);
+}
+
+int failures = 0;
+
+void check(bool condition, const char *what) {
+    if (condition)
+        return;
+    fprintf(stderr, "FAILED: %s\n", what);
+    failures++;
+}
+
+int fail(const char *call, ze_result_t result) {
+    fprintf(stderr, "%s failed: 0x%x\n", call, static_cast<unsigned>(result));
+    return 1;
+}
+
+std::vector<std::string> listEntries(const std::string &directory) {
+    std::vector<std::string> entries;
+    DIR *dir = opendir(directory.c_str());
+    if (!dir)
+        return entries;
+    while (auto entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        if (name != "." && name != "..")
+            entries.push_back(directory + "/" + name);
+    }
+    closedir(dir);
+    return entries;
+}
+
+} // namespace
+
+int main() {
+    char directory[] = "/tmp/ze_module_cache_test_XXXXXX";
+    if (!mkdtemp(directory)) {
+        perror("mkdtemp");
+        return 1;
+    }
+    setenv("ZE_MODULE_CACHE_DIR", directory, 1);
+    setDefaultEnv("ZE_ENABLE_OPTIMIZATION_LAYER", "1");
+    setDefaultEnv("ZE_ENABLE_MODULE_CACHE", "1");
+
+    ze_result_t result = zeInit(0);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeInit", result);
+
+    uint32_t count = 1;
+    ze_driver_handle_t hDriver = nullptr;
+    result = zeDriverGet(&count, &hDriver);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeDriverGet", result);
+
+    count = 1;
+    ze_device_handle_t hDevice = nullptr;
+    result = zeDeviceGet(hDriver, &count, &hDevice);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeDeviceGet", result);
+
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    ze_context_handle_t hContext = nullptr;
+    result = zeContextCreate(hDriver, &contextDesc, &hContext);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeContextCreate", result);
+    capture_driver::takeCalls();
+
+    // The header of an empty SPIR-V module.
+    const uint32_t spirv[] = {0x07230203, 0x00010000, 0, 1, 0};
+    ze_module_desc_t moduleDesc = {ZE_STRUCTURE_TYPE_MODULE_DESC};
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    moduleDesc.inputSize = sizeof(spirv);
+    moduleDesc.pInputModule = reinterpret_cast<const uint8_t *>(spirv);
+    moduleDesc.pBuildFlags = "-O2";
+
+    // A miss builds the module and stores its binary.
+    ze_module_handle_t hModule = nullptr;
+    result = zeModuleCreate(hContext, hDevice, &moduleDesc, &hModule, nullptr);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeModuleCreate", result);
+    zeModuleDestroy(hModule);
+    check(listEntries(directory).size() == 1, "one entry stored");
+    check(capture_driver::expectCalls("miss", {
+        "zeDeviceGetProperties()",
+        "zeModuleCreate(spirv) = module0",
+        "zeModuleGetNativeBinary(module0)",
+        "zeModuleGetNativeBinary(module0)",
+        "zeModuleDestroy(module0)",
+    }), "module built and stored on a miss");
+
+    // A hit creates the module from the stored binary.
+    zeModuleCreate(hContext, hDevice, &moduleDesc, &hModule, nullptr);
+    zeModuleDestroy(hModule);
+    check(capture_driver::expectCalls("hit", {
+        "zeModuleCreate(native module0) = module1",
+        "zeModuleDestroy(module1)",
+    }), "module created from the stored binary on a hit");
+
+    // Other build flags are another entry.
+    moduleDesc.pBuildFlags = "-O0";
+    zeModuleCreate(hContext, hDevice, &moduleDesc, &hModule, nullptr);
+    zeModuleDestroy(hModule);
+    check(listEntries(directory).size() == 2, "entry per build flags");
+    check(capture_driver::expectCalls("other build flags", {
+        "zeModuleCreate(spirv) = module2",
+        "zeModuleGetNativeBinary(module2)",
+        "zeModuleGetNativeBinary(module2)",
+        "zeModuleDestroy(module2)",
+    }), "other build flags miss the cache");
+
+    // A damaged entry is ignored and written again.
+    for (auto &entry : listEntries(directory)) {
+        FILE *file = fopen(entry.c_str(), "wb");
+        if (file) {
+            fputs("damaged", file);
+            fclose(file);
+        }
+    }
+    zeModuleCreate(hContext, hDevice, &moduleDesc, &hModule, nullptr);
+    zeModuleDestroy(hModule);
+    zeModuleCreate(hContext, hDevice, &moduleDesc, &hModule, nullptr);
+    zeModuleDestroy(hModule);
+    check(capture_driver::expectCalls("damaged entry", {
+        "zeModuleCreate(spirv) = module3",
+        "zeModuleGetNativeBinary(module3)",
+        "zeModuleGetNativeBinary(module3)",
+        "zeModuleDestroy(module3)",
+        "zeModuleCreate(native module3) = module4",
+        "zeModuleDestroy(module4)",
+    }), "damaged entry replaced");
+
+    zeContextDestroy(hContext);
+    capture_driver::takeCalls();
+    for (auto &entry : listEntries(directory))
+        unlink(entry.c_str());
+    rmdir(directory);
+
+    if (failures)
+        return 1;
+    printf("Module cache checks passed\n");
+    return 0;
+}
@@ -0,0 +1,215 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Checks the USM pool of the optimization layer against the null driver:
+// alignment of pooled chunks, the properties and address range reported
+// for interior pointers, refused IPC export of pooled memory, trimming of
+// empty slabs past ZE_USM_POOL_MAX_FREE_BYTES and the release of the slabs
+// of a destroyed context.
+//
+// The null driver answers zeMemGetAddressRange with success without
+// looking at the pointer, while the pool refuses a freed chunk of a slab it
+// still holds, so the query on a freed pointer tells whether its slab was
+// returned to the driver.
+
+#include "ze_api.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+void setDefaultEnv(const char *name, const char *value) {
+  if (getenv(name) != nullptr)
+    return;
+#if defined(_WIN32)
+  _putenv_s(name, value);
+#else
+  setenv(name, value, 0);
+#endif
+}
+
+int failures = 0;
+
+void check(bool condition, const char *what) {
+  if (condition)
+    return;
+  fprintf(stderr, "FAILED: %s\n", what);
+  failures++;
+}
+
+int fail(const char *call, ze_result_t result) {
+  fprintf(stderr, "%s failed: 0x%x\n", call, static_cast<unsigned>(result));
+  return 1;
+}
+
+bool isAligned(const void *ptr, size_t alignment) {
+  return reinterpret_cast<uintptr_t>(ptr) % alignment == 0;
+}
+
+// Whether the pool still holds the slab of a freed pointer.
+bool slabKept(ze_context_handle_t hContext, void *ptr) {
+  void *base = nullptr;
+  size_t size = 0;
+  return zeMemGetAddressRange(hContext, ptr, &base, &size) ==
+         ZE_RESULT_ERROR_INVALID_ARGUMENT;
+}
+
+} // namespace
+
+int main() {
+  setDefaultEnv("ZE_ENABLE_NULL_DRIVER", "1");
+  setDefaultEnv("ZE_ENABLE_OPTIMIZATION_LAYER", "1");
+  setDefaultEnv("ZE_ENABLE_USM_POOL", "1");
+  // Room for one empty slab; a second one is returned to the driver.
+  setDefaultEnv("ZE_USM_POOL_SLAB_SIZE", "65536");
+  setDefaultEnv("ZE_USM_POOL_MAX_FREE_BYTES", "65536");
+
+  ze_result_t result = zeInit(0);
+  if (result != ZE_RESULT_SUCCESS)
+    return fail("zeInit", result);
+
+  uint32_t count = 1;
+  ze_driver_handle_t hDriver = nullptr;
+  result = zeDriverGet(&count, &hDriver);
+  if (result != ZE_RESULT_SUCCESS)
+    return fail("zeDriverGet", result);
+
+  count = 1;
+  ze_device_handle_t hDevice = nullptr;
+  result = zeDeviceGet(hDriver, &count, &hDevice);
+  if (result != ZE_RESULT_SUCCESS)
+    return fail("zeDeviceGet", result);
+
+  ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+  ze_context_handle_t hContext = nullptr;
+  result = zeContextCreate(hDriver, &contextDesc, &hContext);
+  if (result != ZE_RESULT_SUCCESS)
+    return fail("zeContextCreate", result);
+
+  ze_device_mem_alloc_desc_t deviceDesc = {
+      ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+  ze_host_mem_alloc_desc_t hostDesc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
+
+  // Chunks are aligned to the requested alignment, and to their size
+  // class without one.
+  const size_t alignments[] = {0, 64, 256, 4096};
+  for (auto alignment : alignments) {
+    void *ptr = nullptr;
+    result = zeMemAllocDevice(hContext, &deviceDesc, 100, alignment, hDevice,
+                              &ptr);
+    if (result != ZE_RESULT_SUCCESS)
+      return fail("zeMemAllocDevice", result);
+    check(isAligned(ptr, alignment ? alignment : 128),
+          "device chunk aligned");
+    zeMemFree(hContext, ptr);
+
+    result = zeMemAllocHost(hContext, &hostDesc, 100, alignment, &ptr);
+    if (result != ZE_RESULT_SUCCESS)
+      return fail("zeMemAllocHost", result);
+    check(isAligned(ptr, alignment ? alignment : 128), "host chunk aligned");
+    zeMemFree(hContext, ptr);
+
+    result = zeMemAllocShared(hContext, &deviceDesc, &hostDesc, 100,
+                              alignment, hDevice, &ptr);
+    if (result != ZE_RESULT_SUCCESS)
+      return fail("zeMemAllocShared", result);
+    check(isAligned(ptr, alignment ? alignment : 128),
+          "shared chunk aligned");
+    zeMemFree(hContext, ptr);
+  }
+
+  // Interior pointers are answered for the whole allocation, and bytes past
+  // the requested size belong to no allocation.
+  void *first = nullptr;
+  void *second = nullptr;
+  zeMemAllocDevice(hContext, &deviceDesc, 100, 0, hDevice, &first);
+  zeMemAllocDevice(hContext, &deviceDesc, 100, 0, hDevice, &second);
+  auto interior = static_cast<char *>(first) + 40;
+
+  ze_memory_allocation_properties_t properties = {
+      ZE_STRUCTURE_TYPE_MEMORY_ALLOCATION_PROPERTIES};
+  ze_device_handle_t hAllocDevice = nullptr;
+  result =
+      zeMemGetAllocProperties(hContext, interior, &properties, &hAllocDevice);
+  check(result == ZE_RESULT_SUCCESS, "zeMemGetAllocProperties succeeds");
+  check(properties.type == ZE_MEMORY_TYPE_DEVICE, "interior pointer type");
+  check(hAllocDevice == hDevice, "interior pointer device");
+  auto firstId = properties.id;
+  check(firstId != 0, "allocation id set");
+
+  zeMemGetAllocProperties(hContext, second, &properties, nullptr);
+  check(properties.id != firstId, "allocation ids are unique");
+
+  void *base = nullptr;
+  size_t size = 0;
+  result = zeMemGetAddressRange(hContext, interior, &base, &size);
+  check(result == ZE_RESULT_SUCCESS, "zeMemGetAddressRange succeeds");
+  check(base == first, "interior pointer base");
+  check(size == 100, "interior pointer size is the requested size");
+
+  auto pastEnd = static_cast<char *>(first) + 100;
+  check(zeMemGetAddressRange(hContext, pastEnd, &base, &size) ==
+            ZE_RESULT_ERROR_INVALID_ARGUMENT,
+        "no address range past the requested size");
+  zeMemGetAllocProperties(hContext, pastEnd, &properties, nullptr);
+  check(properties.type == ZE_MEMORY_TYPE_UNKNOWN,
+        "unknown type past the requested size");
+
+  // Pooled memory cannot be exported; other allocations still can.
+  ze_ipc_mem_handle_t ipcHandle = {};
+  check(zeMemGetIpcHandle(hContext, interior, &ipcHandle) ==
+            ZE_RESULT_ERROR_UNSUPPORTED_FEATURE,
+        "IPC export of pooled memory refused");
+  void *large = nullptr;
+  zeMemAllocDevice(hContext, &deviceDesc, (1 << 20) + 1, 0, hDevice, &large);
+  check(zeMemGetIpcHandle(hContext, large, &ipcHandle) == ZE_RESULT_SUCCESS,
+        "IPC export of memory passed to the driver");
+  zeMemFree(hContext, large);
+  zeMemFree(hContext, first);
+  zeMemFree(hContext, second);
+
+  // Destroying the context returns every slab above to the driver, so the
+  // limit below only counts the slabs of the next context.
+  zeContextDestroy(hContext);
+  result = zeContextCreate(hDriver, &contextDesc, &hContext);
+  if (result != ZE_RESULT_SUCCESS)
+    return fail("zeContextCreate", result);
+
+  // Two size classes live in two slabs. Once both are empty, only one fits
+  // under the limit and the other is returned to the driver.
+  void *small = nullptr;
+  void *medium = nullptr;
+  zeMemAllocHost(hContext, &hostDesc, 2048, 0, &small);
+  zeMemAllocHost(hContext, &hostDesc, 8192, 0, &medium);
+  zeMemFree(hContext, small);
+  check(slabKept(hContext, small), "empty slab kept under the limit");
+  zeMemFree(hContext, medium);
+  check(slabKept(hContext, small), "first empty slab still kept");
+  check(!slabKept(hContext, medium), "empty slab past the limit released");
+
+  // The slabs of a context are released when it is destroyed, whether they
+  // are empty or not.
+  void *live = nullptr;
+  zeMemAllocDevice(hContext, &deviceDesc, 4096, 0, hDevice, &live);
+  zeContextDestroy(hContext);
+  check(!slabKept(hContext, small), "empty slab released with the context");
+  size = 0;
+  check(zeMemGetAddressRange(hContext, live, &base, &size) ==
+                ZE_RESULT_SUCCESS &&
+            size != 4096,
+        "slab in use released with the context");
+
+  if (failures) {
+    fprintf(stderr, "%d checks failed\n", failures);
+    return 1;
+  }
+  printf("USM pool checks passed\n");
+  return 0;
+}
@@ -0,0 +1,124 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Checks the events the kernel timing of the tracing layer hands to the
+// capture driver with ZEL_TRACING_KERNEL_TIMING_MAX_EVENTS=2: launches get
+// the events of one pool until both are in use, the next launch is not
+// timed, and harvested events are reset and used again. The registration
+// matches the report and the events destroyed at exit.
+
+#include "ze_api.h"
+#include "capture_driver.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+
+void setDefaultEnv(const char *name, const char *value) {
+    if (getenv(name) != nullptr)
+        return;
+#if defined(_WIN32)
+    _putenv_s(name, value);
+#else
+    setenv(name, value, 0);
+#endif
+}
+
+int failures = 0;
+
+void check(bool condition, const char *what) {
+    if (condition)
+        return;
+    fprintf(stderr, "FAILED: %s\n", what);
+    failures++;
+}
+
+int fail(const char *call, ze_result_t result) {
+    fprintf(stderr, "%s failed: 0x%x\n", call, static_cast<unsigned>(result));
+    return 1;
+}
+
+} // namespace
+
+int main() {
+    setDefaultEnv("ZE_ENABLE_TRACING_LAYER", "1");
+    setDefaultEnv("ZEL_TRACING_KERNEL_TIMING", "1");
+    setDefaultEnv("ZEL_TRACING_KERNEL_TIMING_MAX_EVENTS", "2");
+
+    ze_result_t result = zeInit(0);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeInit", result);
+
+    uint32_t count = 1;
+    ze_driver_handle_t hDriver = nullptr;
+    result = zeDriverGet(&count, &hDriver);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeDriverGet", result);
+
+    count = 1;
+    ze_device_handle_t hDevice = nullptr;
+    result = zeDeviceGet(hDriver, &count, &hDevice);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeDeviceGet", result);
+
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    ze_context_handle_t hContext = nullptr;
+    result = zeContextCreate(hDriver, &contextDesc, &hContext);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeContextCreate", result);
+
+    ze_module_desc_t moduleDesc = {ZE_STRUCTURE_TYPE_MODULE_DESC};
+    ze_module_handle_t hModule = nullptr;
+    zeModuleCreate(hContext, hDevice, &moduleDesc, &hModule, nullptr);
+    ze_kernel_desc_t kernelDesc = {ZE_STRUCTURE_TYPE_KERNEL_DESC};
+    kernelDesc.pKernelName = "fill";
+    ze_kernel_handle_t hKernel = nullptr;
+    zeKernelCreate(hModule, &kernelDesc, &hKernel);
+
+    ze_command_queue_desc_t queueDesc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+    ze_command_list_handle_t hCommandList = nullptr;
+    result = zeCommandListCreateImmediate(hContext, hDevice, &queueDesc, &hCommandList);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeCommandListCreateImmediate", result);
+    capture_driver::takeCalls();
+
+    // The two events of the pool are handed out, and the third launch is
+    // not timed.
+    ze_group_count_t groups = {1, 1, 1};
+    zeCommandListAppendLaunchKernel(hCommandList, hKernel, &groups, nullptr, 0, nullptr);
+    zeCommandListAppendLaunchKernel(hCommandList, hKernel, &groups, nullptr, 0, nullptr);
+    zeCommandListAppendLaunchKernel(hCommandList, hKernel, &groups, nullptr, 0, nullptr);
+    check(capture_driver::expectCalls("launches up to the cap", {
+        "zeEventPoolCreate() = pool0",
+        "zeEventCreate(pool0) = event0",
+        "zeEventCreate(pool0) = event1",
+        "zeCommandListAppendLaunchKernel(list0, kernel0, event1, [])",
+        "zeCommandListAppendLaunchKernel(list0, kernel0, event0, [])",
+        "zeCommandListAppendLaunchKernel(list0, kernel0, null, [])",
+    }), "launches beyond the cap not timed");
+
+    // Synchronizing harvests both events, which are reset and timed again.
+    zeCommandListHostSynchronize(hCommandList, UINT64_MAX);
+    zeCommandListAppendLaunchKernel(hCommandList, hKernel, &groups, nullptr, 0, nullptr);
+    check(capture_driver::expectCalls("harvested events", {
+        "zeEventHostReset(event1)",
+        "zeEventHostReset(event0)",
+        "zeCommandListAppendLaunchKernel(list0, kernel0, event0, [])",
+    }), "harvested events used again");
+
+    zeCommandListDestroy(hCommandList);
+    zeKernelDestroy(hKernel);
+    zeModuleDestroy(hModule);
+    capture_driver::takeCalls();
+
+    if (failures)
+        return 1;
+    printf("Kernel timing checks passed\n");
+    return 0;
+}
@@ -0,0 +1,44 @@
+# Copyright (C) 2024 Intel Corporation
+# SPDX-License-Identifier: MIT
+
+# Runs TEST_COMMAND with the timeline exported in FORMAT to a file in
+# OUTPUT_DIR, converts a binary timeline with CONVERT_COMMAND, and checks
+# that the timeline is complete and holds every barrier the test appended.
+set(exitingThreads 4)
+set(barriersPerThread 1500)
+set(barriersOfRunningThread 100)
+math(EXPR expected "(${exitingThreads} + 1) * ${barriersPerThread} + ${barriersOfRunningThread}")
+
+file(MAKE_DIRECTORY ${OUTPUT_DIR})
+set(trace ${OUTPUT_DIR}/trace_${FORMAT})
+file(REMOVE ${trace} ${trace}.json)
+
+execute_process(
+    COMMAND ${CMAKE_COMMAND} -E env ZEL_TRACING_EXPORT_FILE=${trace} ZEL_TRACING_EXPORT_FORMAT=${FORMAT} ${TEST_COMMAND}
+    RESULT_VARIABLE result
+)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${TEST_COMMAND} returned ${result}")
+endif()
+
+if(FORMAT STREQUAL "binary")
+    execute_process(
+        COMMAND ${CONVERT_COMMAND} ${trace} ${trace}.json
+        RESULT_VARIABLE result
+    )
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "${CONVERT_COMMAND} returned ${result}")
+    endif()
+    set(trace ${trace}.json)
+endif()
+
+file(READ ${trace} json)
+if(NOT json MATCHES "^\\[\n{" OR NOT json MATCHES "}}\n\\]\n$")
+    message(FATAL_ERROR "${trace} is not a complete Chrome trace")
+endif()
+string(REGEX MATCHALL "\"name\":\"zeCommandListAppendBarrier\"" barriers "${json}")
+list(LENGTH barriers count)
+if(NOT count EQUAL expected)
+    message(FATAL_ERROR "${trace} holds ${count} barriers instead of ${expected}")
+endif()
+message("${trace} holds all ${count} barriers")
@@ -0,0 +1,112 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Makes calls for the timeline export of the tracing layer to write out
+// against the null driver, from threads that exit before the layer is
+// unloaded, from the main thread, and from a thread still running at
+// unload. Each thread appends more barriers than a trace buffer holds, but
+// the last; check_trace_export.cmake counts the exported barriers.
+
+#include "ze_api.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Keep in sync with check_trace_export.cmake.
+constexpr int exitingThreads = 4;
+constexpr int barriersPerThread = 1500;
+constexpr int barriersOfRunningThread = 100;
+
+void setDefaultEnv(const char *name, const char *value) {
+    if (getenv(name) != nullptr)
+        return;
+#if defined(_WIN32)
+    _putenv_s(name, value);
+#else
+    setenv(name, value, 0);
+#endif
+}
+
+int fail(const char *call, ze_result_t result) {
+    fprintf(stderr, "%s failed: 0x%x\n", call, static_cast<unsigned>(result));
+    return 1;
+}
+
+struct fixture_t {
+    ze_context_handle_t hContext = nullptr;
+    ze_device_handle_t hDevice = nullptr;
+
+    void appendBarriers(int count) {
+        ze_command_list_desc_t desc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
+        ze_command_list_handle_t hCommandList = nullptr;
+        zeCommandListCreate(hContext, hDevice, &desc, &hCommandList);
+        for (int i = 0; i < count; i++)
+            zeCommandListAppendBarrier(hCommandList, nullptr, 0, nullptr);
+        zeCommandListDestroy(hCommandList);
+    }
+};
+
+std::atomic<bool> runningThreadAppended{false};
+
+} // namespace
+
+int main() {
+    setDefaultEnv("ZE_ENABLE_NULL_DRIVER", "1");
+    setDefaultEnv("ZE_ENABLE_TRACING_LAYER", "1");
+    if (getenv("ZEL_TRACING_EXPORT_FILE") == nullptr) {
+        fprintf(stderr, "ZEL_TRACING_EXPORT_FILE is not set\n");
+        return 1;
+    }
+
+    ze_result_t result = zeInit(0);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeInit", result);
+
+    uint32_t count = 1;
+    ze_driver_handle_t hDriver = nullptr;
+    result = zeDriverGet(&count, &hDriver);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeDriverGet", result);
+
+    fixture_t fixture;
+    count = 1;
+    result = zeDeviceGet(hDriver, &count, &fixture.hDevice);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeDeviceGet", result);
+
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    result = zeContextCreate(hDriver, &contextDesc, &fixture.hContext);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeContextCreate", result);
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < exitingThreads; i++)
+        threads.emplace_back([&fixture] { fixture.appendBarriers(barriersPerThread); });
+    for (auto &thread : threads)
+        thread.join();
+
+    // Parks with its records still buffered until the process exits.
+    std::thread([&fixture] {
+        fixture.appendBarriers(barriersOfRunningThread);
+        runningThreadAppended = true;
+        for (;;)
+            std::this_thread::sleep_for(std::chrono::hours(1));
+    }).detach();
+    while (!runningThreadAppended)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    fixture.appendBarriers(barriersPerThread);
+    printf("Trace export calls done\n");
+    return 0;
+}
@@ -0,0 +1,132 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Creates and destroys a large number of events spread over many event
+// pools with handle lifetime tracking enabled, and reports the time spent
+// in each phase. Every event is a dependent of its pool, so destruction
+// exercises removeDependent once per event. Runs against the null driver
+// unless the environment selects otherwise.
+
+#include "ze_api.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace {
+
+void setDefaultEnv(const char *name, const char *value) {
+  if (getenv(name) != nullptr)
+    return;
+#if defined(_WIN32)
+  _putenv_s(name, value);
+#else
+  setenv(name, value, 0);
+#endif
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start)
+      .count();
+}
+
+int fail(const char *call, ze_result_t result) {
+  fprintf(stderr, "%s failed: 0x%x\n", call, static_cast<unsigned>(result));
+  return 1;
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  uint32_t poolCount = 1000;
+  uint32_t eventsPerPool = 1000;
+  if (argc > 1)
+    poolCount = static_cast<uint32_t>(std::stoul(argv[1]));
+  if (argc > 2)
+    eventsPerPool = static_cast<uint32_t>(std::stoul(argv[2]));
+
+  setDefaultEnv("ZE_ENABLE_NULL_DRIVER", "1");
+  setDefaultEnv("ZE_ENABLE_VALIDATION_LAYER", "1");
+  setDefaultEnv("ZE_ENABLE_HANDLE_LIFETIME", "1");
+
+  ze_result_t result = zeInit(0);
+  if (result != ZE_RESULT_SUCCESS)
+    return fail("zeInit", result);
+
+  uint32_t count = 1;
+  ze_driver_handle_t hDriver = nullptr;
+  result = zeDriverGet(&count, &hDriver);
+  if (result != ZE_RESULT_SUCCESS)
+    return fail("zeDriverGet", result);
+
+  ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+  ze_context_handle_t hContext = nullptr;
+  result = zeContextCreate(hDriver, &contextDesc, &hContext);
+  if (result != ZE_RESULT_SUCCESS)
+    return fail("zeContextCreate", result);
+
+  std::vector<ze_event_pool_handle_t> pools(poolCount);
+  std::vector<ze_event_handle_t> events(static_cast<size_t>(poolCount) *
+                                        eventsPerPool);
+
+  auto start = std::chrono::steady_clock::now();
+  for (uint32_t p = 0; p < poolCount; p++) {
+    ze_event_pool_desc_t poolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+    poolDesc.count = eventsPerPool;
+    result = zeEventPoolCreate(hContext, &poolDesc, 0, nullptr, &pools[p]);
+    if (result != ZE_RESULT_SUCCESS)
+      return fail("zeEventPoolCreate", result);
+    for (uint32_t i = 0; i < eventsPerPool; i++) {
+      ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+      eventDesc.index = i;
+      result = zeEventCreate(pools[p], &eventDesc,
+                             &events[static_cast<size_t>(p) * eventsPerPool + i]);
+      if (result != ZE_RESULT_SUCCESS)
+        return fail("zeEventCreate", result);
+    }
+  }
+  auto createTime = secondsSince(start);
+
+  // Destroying a pool that still has events must be refused.
+  if (poolCount && eventsPerPool &&
+      zeEventPoolDestroy(pools[0]) != ZE_RESULT_ERROR_HANDLE_OBJECT_IN_USE) {
+    fprintf(stderr, "zeEventPoolDestroy did not report the live events\n");
+    return 1;
+  }
+
+  start = std::chrono::steady_clock::now();
+  for (auto hEvent : events) {
+    result = zeEventDestroy(hEvent);
+    if (result != ZE_RESULT_SUCCESS)
+      return fail("zeEventDestroy", result);
+  }
+  auto destroyTime = secondsSince(start);
+
+  start = std::chrono::steady_clock::now();
+  for (auto hPool : pools) {
+    result = zeEventPoolDestroy(hPool);
+    if (result != ZE_RESULT_SUCCESS)
+      return fail("zeEventPoolDestroy", result);
+  }
+  auto poolDestroyTime = secondsSince(start);
+
+  result = zeContextDestroy(hContext);
+  if (result != ZE_RESULT_SUCCESS)
+    return fail("zeContextDestroy", result);
+
+  printf("%zu events in %u pools\n", events.size(), poolCount);
+  printf("create:        %8.3f s (%6.0f ns/event)\n", createTime,
+         events.empty() ? 0.0 : createTime * 1e9 / events.size());
+  printf("destroy:       %8.3f s (%6.0f ns/event)\n", destroyTime,
+         events.empty() ? 0.0 : destroyTime * 1e9 / events.size());
+  printf("destroy pools: %8.3f s\n", poolDestroyTime);
+  return 0;
+}
@@ -0,0 +1,130 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Checks the threading validation of the validation layer: a command list
+// used by two threads at once is reported, a kernel launched into two
+// command lists at once is not, but a kernel modified while it is launched
+// is. The capture driver holds the first call until the second one was
+// made. The handles are only created after many command lists were
+// destroyed, so they are only checked when destroyed handles free their
+// entries. The reports are matched by the registration.
+
+#include "ze_api.h"
+#include "capture_driver.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+namespace {
+
+void setDefaultEnv(const char *name, const char *value) {
+    if (getenv(name) != nullptr)
+        return;
+#if defined(_WIN32)
+    _putenv_s(name, value);
+#else
+    setenv(name, value, 0);
+#endif
+}
+
+int fail(const char *call, ze_result_t result) {
+    fprintf(stderr, "%s failed: 0x%x\n", call, static_cast<unsigned>(result));
+    return 1;
+}
+
+} // namespace
+
+int main() {
+    setDefaultEnv("ZE_ENABLE_VALIDATION_LAYER", "1");
+    setDefaultEnv("ZE_ENABLE_THREADING_VALIDATION", "1");
+
+    ze_result_t result = zeInit(0);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeInit", result);
+
+    uint32_t count = 1;
+    ze_driver_handle_t hDriver = nullptr;
+    result = zeDriverGet(&count, &hDriver);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeDriverGet", result);
+
+    count = 1;
+    ze_device_handle_t hDevice = nullptr;
+    result = zeDeviceGet(hDriver, &count, &hDevice);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeDeviceGet", result);
+
+    ze_context_desc_t contextDesc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC};
+    ze_context_handle_t hContext = nullptr;
+    result = zeContextCreate(hDriver, &contextDesc, &hContext);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeContextCreate", result);
+
+    // Twice as many command lists as the table has entries, each with a
+    // handle of its own.
+    ze_command_list_desc_t listDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
+    for (int i = 0; i < 2 * 65536; i++) {
+        ze_command_list_handle_t hCommandList = nullptr;
+        result = zeCommandListCreate(hContext, hDevice, &listDesc, &hCommandList);
+        if (result != ZE_RESULT_SUCCESS)
+            return fail("zeCommandListCreate", result);
+        zeCommandListDestroy(hCommandList);
+    }
+
+    ze_command_list_handle_t hFirstList = nullptr;
+    ze_command_list_handle_t hSecondList = nullptr;
+    zeCommandListCreate(hContext, hDevice, &listDesc, &hFirstList);
+    zeCommandListCreate(hContext, hDevice, &listDesc, &hSecondList);
+
+    ze_module_desc_t moduleDesc = {ZE_STRUCTURE_TYPE_MODULE_DESC};
+    ze_module_handle_t hModule = nullptr;
+    result = zeModuleCreate(hContext, hDevice, &moduleDesc, &hModule, nullptr);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeModuleCreate", result);
+
+    ze_kernel_desc_t kernelDesc = {ZE_STRUCTURE_TYPE_KERNEL_DESC};
+    kernelDesc.pKernelName = "copy";
+    ze_kernel_handle_t hKernel = nullptr;
+    result = zeKernelCreate(hModule, &kernelDesc, &hKernel);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeKernelCreate", result);
+    capture_driver::takeCalls();
+
+    // A command list shared by two threads.
+    capture_driver::holdCall("zeCommandListAppendBarrier");
+    std::thread appending([&] { zeCommandListAppendBarrier(hFirstList, nullptr, 0, nullptr); });
+    capture_driver::waitHeld();
+    zeCommandListClose(hFirstList);
+    capture_driver::release();
+    appending.join();
+
+    // A kernel launched into two command lists, and modified meanwhile.
+    ze_group_count_t groupCount = {1, 1, 1};
+    uint32_t value = 5;
+    capture_driver::holdCall("zeCommandListAppendLaunchKernel");
+    std::thread launching([&] { zeCommandListAppendLaunchKernel(hFirstList, hKernel, &groupCount, nullptr, 0, nullptr); });
+    capture_driver::waitHeld();
+    zeCommandListAppendLaunchKernel(hSecondList, hKernel, &groupCount, nullptr, 0, nullptr);
+    zeKernelSetArgumentValue(hKernel, 0, sizeof(value), &value);
+    capture_driver::release();
+    launching.join();
+
+    // Calls one after the other are not reported.
+    zeKernelSetArgumentValue(hKernel, 0, sizeof(value), &value);
+    zeCommandListClose(hFirstList);
+
+    zeKernelDestroy(hKernel);
+    zeModuleDestroy(hModule);
+    zeCommandListDestroy(hSecondList);
+    zeCommandListDestroy(hFirstList);
+    zeContextDestroy(hContext);
+
+    printf("Threading validation checks done\n");
+    return 0;
+}
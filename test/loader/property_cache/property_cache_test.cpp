@@ -0,0 +1,150 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+// Checks the property cache of the loader against the capture driver,
+// whose device has three command queue groups with one to three queues:
+// repeated queries answered without the driver, count-only, partial and
+// full reads of an array served from one cached copy, and queries with
+// extension structures always forwarded to the driver.
+
+#include "ze_api.h"
+#include "capture_driver.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+void setDefaultEnv(const char *name, const char *value) {
+    if (getenv(name) != nullptr)
+        return;
+#if defined(_WIN32)
+    _putenv_s(name, value);
+#else
+    setenv(name, value, 0);
+#endif
+}
+
+int failures = 0;
+
+void check(bool condition, const char *what) {
+    if (condition)
+        return;
+    fprintf(stderr, "FAILED: %s\n", what);
+    failures++;
+}
+
+int fail(const char *call, ze_result_t result) {
+    fprintf(stderr, "%s failed: 0x%x\n", call, static_cast<unsigned>(result));
+    return 1;
+}
+
+void resetGroups(ze_command_queue_group_properties_t *groups, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        groups[i] = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_GROUP_PROPERTIES};
+        groups[i].numQueues = 99;
+    }
+}
+
+} // namespace
+
+int main() {
+    setDefaultEnv("ZE_ENABLE_LOADER_PROPERTY_CACHE", "1");
+
+    ze_result_t result = zeInit(0);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeInit", result);
+
+    uint32_t count = 1;
+    ze_driver_handle_t hDriver = nullptr;
+    result = zeDriverGet(&count, &hDriver);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeDriverGet", result);
+
+    count = 1;
+    ze_device_handle_t hDevice = nullptr;
+    result = zeDeviceGet(hDriver, &count, &hDevice);
+    if (result != ZE_RESULT_SUCCESS)
+        return fail("zeDeviceGet", result);
+    capture_driver::takeCalls();
+
+    // A repeated query is answered from the cache.
+    ze_device_properties_t first = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES};
+    ze_device_properties_t second = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES};
+    zeDeviceGetProperties(hDevice, &first);
+    zeDeviceGetProperties(hDevice, &second);
+    check(strcmp(second.name, "Null Device") == 0, "cached properties returned");
+    check(capture_driver::expectCalls("repeated query", {
+        "zeDeviceGetProperties()",
+    }), "repeated query answered from the cache");
+
+    // Queries with extension structures reach the driver every time.
+    ze_device_luid_ext_properties_t luid = {ZE_STRUCTURE_TYPE_DEVICE_LUID_EXT_PROPERTIES};
+    ze_device_properties_t extended = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES, &luid};
+    zeDeviceGetProperties(hDevice, &extended);
+    // The null driver writes the whole structure, chain included.
+    extended.pNext = &luid;
+    zeDeviceGetProperties(hDevice, &extended);
+    check(capture_driver::expectCalls("extension structures", {
+        "zeDeviceGetProperties(pNext)",
+        "zeDeviceGetProperties(pNext)",
+    }), "queries with extension structures forwarded");
+
+    // The count is asked for once.
+    count = 0;
+    result = zeDeviceGetCommandQueueGroupProperties(hDevice, &count, nullptr);
+    check(result == ZE_RESULT_SUCCESS && count == 3, "count of the queue groups");
+    count = 0;
+    result = zeDeviceGetCommandQueueGroupProperties(hDevice, &count, nullptr);
+    check(result == ZE_RESULT_SUCCESS && count == 3, "cached count of the queue groups");
+    check(capture_driver::expectCalls("count only", {
+        "zeDeviceGetCommandQueueGroupProperties(0, null)",
+    }), "count answered from the cache");
+
+    // A partial read caches the whole array and returns its start.
+    ze_command_queue_group_properties_t groups[4];
+    resetGroups(groups, 4);
+    count = 2;
+    result = zeDeviceGetCommandQueueGroupProperties(hDevice, &count, groups);
+    check(result == ZE_RESULT_SUCCESS && count == 2, "count of a partial read");
+    check(groups[0].numQueues == 1 && groups[1].numQueues == 2, "start of the array read");
+    check(groups[2].numQueues == 99, "nothing written past the count");
+    check(capture_driver::expectCalls("partial read", {
+        "zeDeviceGetCommandQueueGroupProperties(0, null)",
+        "zeDeviceGetCommandQueueGroupProperties(3, properties)",
+    }), "whole array read on a partial read");
+
+    // Full reads, also with a larger count, come from the cache.
+    resetGroups(groups, 4);
+    count = 3;
+    result = zeDeviceGetCommandQueueGroupProperties(hDevice, &count, groups);
+    check(result == ZE_RESULT_SUCCESS && count == 3, "count of a full read");
+    check(groups[0].numQueues == 1 && groups[1].numQueues == 2 && groups[2].numQueues == 3,
+          "whole array read");
+    resetGroups(groups, 4);
+    count = 4;
+    result = zeDeviceGetCommandQueueGroupProperties(hDevice, &count, groups);
+    check(result == ZE_RESULT_SUCCESS && count == 3, "count lowered to the array size");
+    check(groups[2].numQueues == 3 && groups[3].numQueues == 99, "array read up to its size");
+    check(capture_driver::expectCalls("full read", {}), "full reads answered from the cache");
+
+    // An array with extension structures reaches the driver.
+    resetGroups(groups, 4);
+    groups[0].pNext = &luid;
+    count = 3;
+    zeDeviceGetCommandQueueGroupProperties(hDevice, &count, groups);
+    check(capture_driver::expectCalls("array with extension structures", {
+        "zeDeviceGetCommandQueueGroupProperties(3, properties, pNext)",
+    }), "array with extension structures forwarded");
+
+    if (failures)
+        return 1;
+    printf("Property cache checks passed\n");
+    return 0;
+}